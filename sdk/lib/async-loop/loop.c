@@ -740,6 +740,27 @@ static void async_loop_insert_task_locked(async_loop_t* loop, async_task_t* task
   // and that insertion into the task queue will typically take no more than a few steps. If this
   // assumption proves false and the cost of insertion becomes a problem, we should consider using a
   // more efficient representation for maintaining order.
+  //
+  // Timeouts of different lengths interleave, so a short timeout posted while many long ones are
+  // pending would walk past all of them from the tail. Walk from whichever end of the list has the
+  // closer deadline instead. Either way the task ends up after all tasks with the same deadline.
+  list_node_t* head = list_peek_head(&loop->task_list);
+  if (head) {
+    zx_time_t head_deadline = node_to_task(head)->deadline;
+    zx_time_t tail_deadline = node_to_task(list_peek_tail(&loop->task_list))->deadline;
+    if (task->deadline >= head_deadline && task->deadline < tail_deadline &&
+        (uint64_t)task->deadline - (uint64_t)head_deadline <
+            (uint64_t)tail_deadline - (uint64_t)task->deadline) {
+      list_node_t* node;
+      for (node = head; node != &loop->task_list; node = node->next) {
+        if (task->deadline < node_to_task(node)->deadline)
+          break;
+      }
+      list_add_before(node, task_to_node(task));
+      return;
+    }
+  }
+
   list_node_t* node;
   for (node = loop->task_list.prev; node != &loop->task_list; node = node->prev) {
     if (task->deadline >= node_to_task(node)->deadline)
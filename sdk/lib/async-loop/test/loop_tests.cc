@@ -31,6 +31,7 @@
 #include <random>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <fbl/auto_lock.h>
 #include <fbl/mutex.h>
@@ -809,6 +810,27 @@ TEST(Loop, Task) {
   loop.Shutdown();
 }
 
+TEST(Loop, TasksRunInDeadlineOrder) {
+  async::Loop loop(&kAsyncLoopConfigNoAttachToCurrentThread);
+
+  // All deadlines are in the past, so the tasks run as soon as the loop does. The deadlines are
+  // chosen so that insertion walks the task list from both ends.
+  zx::time start_time = async::Now(loop.dispatcher());
+  const std::pair<int, zx::duration> kTasks[] = {
+      {0, zx::nsec(1000)}, {1, zx::nsec(0)},   {2, zx::nsec(100)}, {3, zx::nsec(900)},
+      {4, zx::nsec(100)},  {5, zx::nsec(1000)}, {6, zx::nsec(50)}, {7, zx::nsec(0)},
+  };
+  std::vector<int> order;
+  for (const auto& [id, offset] : kTasks) {
+    EXPECT_OK(async::PostTaskForTime(
+        loop.dispatcher(), [&order, id = id] { order.push_back(id); },
+        start_time - zx::nsec(1000) + offset));
+  }
+
+  EXPECT_OK(loop.RunUntilIdle());
+  EXPECT_EQ(order, (std::vector<int>{1, 7, 6, 2, 4, 3, 0, 5}));
+}
+
 TEST(Loop, TaskShutdown) {
   async::Loop loop(&kAsyncLoopConfigNoAttachToCurrentThread);
 
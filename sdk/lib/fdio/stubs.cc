@@ -135,17 +135,6 @@ int ttyname_r(int fd, char* name, size_t size) {
   return checkfd(fd, ENOSYS);
 }
 
-__EXPORT
-int sendmmsg(int fd, struct mmsghdr* msgvec, unsigned int vlen, unsigned int flags) {
-  return checkfd(fd, ENOSYS);
-}
-
-__EXPORT
-int recvmmsg(int fd, struct mmsghdr* msgvec, unsigned int vlen, unsigned int flags,
-             struct timespec* timeout) {
-  return checkfd(fd, ENOSYS);
-}
-
 __EXPORT
 int sockatmark(int fd) {
   // ENOTTY is intentional for non-socket objects, but needs more investigation for sockets.
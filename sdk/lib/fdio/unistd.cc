@@ -13,6 +13,7 @@
 #include <lib/fdio/unsafe.h>
 #include <lib/fdio/vfs.h>
 #include <lib/stdcompat/string_view.h>
+#include <lib/zx/clock.h>
 #include <lib/zx/result.h>
 #include <lib/zxio/ops.h>
 #include <lib/zxio/posix_mode.h>
@@ -36,6 +37,7 @@
 #include <zircon/syscalls.h>
 
 #include <cstdarg>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <variant>
@@ -2129,6 +2131,53 @@ ssize_t recvmsg(int fd, struct msghdr* msg, int flags) {
   }
 }
 
+// sendmmsg() and recvmmsg() send or receive each message with its own sendmsg() or recvmsg() call,
+// so they save the caller's per-message overhead but not the per-datagram cost in the socket. As on
+// Linux, an error after at least one message has been transferred is not reported; the number of
+// messages transferred so far is returned instead, and the error is left to be reported by the
+// next call.
+__EXPORT
+int sendmmsg(int fd, struct mmsghdr* msgvec, unsigned int vlen, unsigned int flags) {
+  for (unsigned int i = 0; i < vlen; ++i) {
+    const ssize_t n = sendmsg(fd, &msgvec[i].msg_hdr, static_cast<int>(flags));
+    if (n < 0) {
+      return i == 0 ? -1 : static_cast<int>(i);
+    }
+    msgvec[i].msg_len = static_cast<unsigned int>(n);
+  }
+  return static_cast<int>(vlen);
+}
+
+__EXPORT
+int recvmmsg(int fd, struct mmsghdr* msgvec, unsigned int vlen, unsigned int flags,
+             struct timespec* timeout) {
+  std::optional<zx::time> deadline;
+  if (timeout != nullptr) {
+    if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 || timeout->tv_nsec >= 1'000'000'000) {
+      return ERRNO(EINVAL);
+    }
+    deadline = zx::deadline_after(zx::sec(timeout->tv_sec) + zx::nsec(timeout->tv_nsec));
+  }
+  // MSG_WAITFORONE only blocks for the first message.
+  const bool wait_for_one = (flags & MSG_WAITFORONE) != 0;
+  int msg_flags = static_cast<int>(flags & ~MSG_WAITFORONE);
+  for (unsigned int i = 0; i < vlen; ++i) {
+    const ssize_t n = recvmsg(fd, &msgvec[i].msg_hdr, msg_flags);
+    if (n < 0) {
+      return i == 0 ? -1 : static_cast<int>(i);
+    }
+    msgvec[i].msg_len = static_cast<unsigned int>(n);
+    if (wait_for_one) {
+      msg_flags |= MSG_DONTWAIT;
+    }
+    // As on Linux, the timeout is only checked after each message is received.
+    if (deadline.has_value() && zx::clock::get_monotonic() >= deadline.value()) {
+      return static_cast<int>(i + 1);
+    }
+  }
+  return static_cast<int>(vlen);
+}
+
 __EXPORT
 int shutdown(int fd, int how) {
   const fdio_ptr io = fd_to_io(fd);
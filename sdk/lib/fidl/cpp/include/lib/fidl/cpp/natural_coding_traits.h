@@ -217,8 +217,8 @@ void NaturalDecodeVectorBody(NaturalUseStdCopy<true>, NaturalDecoder* decoder,
                              size_t count, size_t recursion_depth) {
   static_assert(NaturalCodingTraits<T, Constraint>::kInlineSize == sizeof(T),
                 "stride doesn't match object size");
-  *out = std::vector<T>(decoder->template GetPtr<T>(in_begin_offset),
-                        decoder->template GetPtr<T>(in_end_offset));
+  out->assign(decoder->template GetPtr<T>(in_begin_offset),
+              decoder->template GetPtr<T>(in_end_offset));
 }
 
 template <typename T, typename Constraint>
@@ -420,10 +420,9 @@ struct NaturalCodingTraits<cpp17::optional<std::vector<T>>, Constraint> {
     fidl_vector_t* vec = decoder->template GetPtr<fidl_vector_t>(offset);
     switch (reinterpret_cast<uintptr_t>(vec->data)) {
       case FIDL_ALLOC_PRESENT: {
-        std::vector<T> unwrapped;
+        // Decode in place rather than into a temporary, so that no storage is allocated twice.
         fidl::internal::NaturalCodingTraits<std::vector<T>, Constraint>::Decode(
-            decoder, &unwrapped, offset, recursion_depth);
-        value->emplace(std::move(unwrapped));
+            decoder, &value->emplace(), offset, recursion_depth);
         return;
       }
       case FIDL_ALLOC_ABSENT: {
@@ -583,7 +582,7 @@ struct NaturalCodingTraits<::std::string, Constraint> final {
       decoder->SetError(kCodingErrorStringNotValidUtf8);
       return;
     }
-    *value = std::string(payload, string->size);
+    value->assign(payload, string->size);
   }
 };
 
@@ -608,10 +607,9 @@ struct NaturalCodingTraits<cpp17::optional<std::string>, Constraint> {
     fidl_string_t* string = decoder->template GetPtr<fidl_string_t>(offset);
     switch (reinterpret_cast<uintptr_t>(string->data)) {
       case FIDL_ALLOC_PRESENT: {
-        std::string unwrapped;
+        // Decode in place rather than copying a temporary, which would allocate the payload twice.
         fidl::internal::NaturalCodingTraits<std::string, Constraint>::Decode(
-            decoder, &unwrapped, offset, recursion_depth);
-        value->emplace(unwrapped);
+            decoder, &value->emplace(), offset, recursion_depth);
         return;
       }
       case FIDL_ALLOC_ABSENT: {
@@ -785,19 +785,32 @@ using TopLevelCodingTraits =
 using TopLevelEncodeFn = void (*)(WireEncoder*, void*, WirePosition);
 using TopLevelDecodeFn = void (*)(WireDecoder*, WirePosition);
 
+// A memcpy-compatible type has a fixed-size layout with no padding, handles or out-of-line
+// data, so its wire form is its in-memory form. The top-level functions for such types skip the
+// member-wise walk: encoding is a single memcpy and decoding has nothing to validate or fix up.
 template <typename T>
 constexpr TopLevelEncodeFn MakeTopLevelEncodeFn() {
-  return [](WireEncoder* encoder, void* value, WirePosition position) {
-    TopLevelCodingTraits<T>::Encode(encoder, static_cast<T*>(value), position,
-                                    RecursionDepth<WireIsRecursive<T>::value>::Initial());
-  };
+  if constexpr (TopLevelCodingTraits<T>::kIsMemcpyCompatible) {
+    return [](WireEncoder* encoder, void* value, WirePosition position) {
+      memcpy(position.As<void>(), value, TopLevelCodingTraits<T>::kInlineSize);
+    };
+  } else {
+    return [](WireEncoder* encoder, void* value, WirePosition position) {
+      TopLevelCodingTraits<T>::Encode(encoder, static_cast<T*>(value), position,
+                                      RecursionDepth<WireIsRecursive<T>::value>::Initial());
+    };
+  }
 }
 template <typename T>
 constexpr TopLevelDecodeFn MakeTopLevelDecodeFn() {
-  return [](WireDecoder* decoder, WirePosition position) {
-    TopLevelCodingTraits<T>::Decode(decoder, position,
-                                    RecursionDepth<WireIsRecursive<T>::value>::Initial());
-  };
+  if constexpr (TopLevelCodingTraits<T>::kIsMemcpyCompatible) {
+    return [](WireDecoder* decoder, WirePosition position) {};
+  } else {
+    return [](WireDecoder* decoder, WirePosition position) {
+      TopLevelCodingTraits<T>::Decode(decoder, position,
+                                      RecursionDepth<WireIsRecursive<T>::value>::Initial());
+    };
+  }
 }
 
 // |kNullCodingConfig| may be used when an incoming message is all bytes and
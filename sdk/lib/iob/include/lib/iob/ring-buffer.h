@@ -0,0 +1,266 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/fit/result.h>
+#include <lib/stdcompat/atomic.h>
+#include <lib/stdcompat/span.h>
+#include <zircon/assert.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#ifndef LIB_IOB_RING_BUFFER_H_
+#define LIB_IOB_RING_BUFFER_H_
+
+namespace iob {
+
+// Represents a view into an IOBuffer region used as a single-producer,
+// single-consumer ring of sized records, so that a high-rate producer (e.g.,
+// of log or trace records) can hand data to a consumer in another process
+// without a syscall per record.
+//
+// The memory is laid out as follows:
+// --------------------------------
+//   head (8 bytes)     <-- total bytes ever written, only stored by the producer
+//   tail (8 bytes)     <-- total bytes ever consumed, only stored by the consumer
+//   ----------------------------
+//   record data        <-- capacity bytes, indexed by (head or tail) % capacity
+// --------------------------------
+//
+// Each record is an 8-byte header holding the payload size, followed by the
+// payload padded up to a multiple of 8 bytes. The record header is therefore
+// never split across the end of the data area, though the payload may be.
+//
+// Neither side trusts the other: the header and each record are validated
+// before use, and corruption is reported as an error rather than acted upon.
+//
+// The ring has no notification mechanism of its own. A producer that wants to
+// wake a waiting consumer, e.g., by signaling an event pair, can use the
+// WriteInfo returned by Write() to do so only when the amount of unconsumed
+// data crosses a chosen watermark.
+class RingBuffer {
+ public:
+  // The possible failure modes of Write().
+  enum class WriteError {
+    // The header was invalid (purportedly with more unconsumed data than the
+    // capacity, or with misaligned offsets). Suggests invalid initialization
+    // or corruption.
+    kInvalidHeader,
+
+    // There is insufficient space for the record until the consumer catches
+    // up.
+    kOutOfMemory,
+  };
+
+  // The possible failure modes of Read() and NextRecordSize().
+  enum class ReadError {
+    // See WriteError::kInvalidHeader.
+    kInvalidHeader,
+
+    // The next record purportedly extends past the data written so far.
+    // Suggests corruption.
+    kInvalidRecord,
+
+    // There is no record to read.
+    kEmpty,
+
+    // The provided buffer is smaller than the next record, which was not
+    // consumed. Its size can be queried with NextRecordSize().
+    kBufferTooSmall,
+  };
+
+  // The amount of unconsumed data in the ring just before and just after a
+  // successful write.
+  struct WriteInfo {
+    // Whether the write brought the unconsumed data from below |watermark| to
+    // at least |watermark| bytes.
+    constexpr bool CrossedWatermark(size_t watermark) const {
+      return used_before < watermark && watermark <= used_after;
+    }
+
+    size_t used_before;
+    size_t used_after;
+  };
+
+  // The number of bytes a record with a payload of |size| bytes takes in the
+  // ring.
+  static constexpr size_t RecordSize(size_t size) {
+    return sizeof(RecordHeader) + ((size + kAlignment - 1) & ~(kAlignment - 1));
+  }
+
+  // Constructs a view into a ring buffer IOBuffer region. If the provided
+  // memory does not yet reflect this layout, Init() must be called before any
+  // other method.
+  //
+  // The provided memory must be at least 8-byte-aligned (for aligned atomic
+  // access), a multiple of 8 bytes in size, and large enough to hold the
+  // header and at least one record header.
+  explicit RingBuffer(cpp20::span<std::byte> bytes) : bytes_(bytes) {
+    ZX_ASSERT(reinterpret_cast<uintptr_t>(bytes_.data()) % kAlignment == 0);
+    ZX_ASSERT(bytes_.size() % kAlignment == 0);
+    ZX_ASSERT(bytes_.size() >= sizeof(Header) + sizeof(RecordHeader));
+  }
+
+  // Initializes the backing memory as an empty ring. This must only be done
+  // while neither side is using it.
+  void Init() {
+    head().store(0, std::memory_order_relaxed);
+    tail().store(0, std::memory_order_release);
+  }
+
+  // The number of bytes available for records, including their headers.
+  size_t capacity() const { return bytes_.size() - sizeof(Header); }
+
+  // Appends a record with the given payload. Only one thread (or process) may
+  // write at a time.
+  fit::result<WriteError, WriteInfo> Write(cpp20::span<const std::byte> payload) {
+    // Only the producer stores |head|, so a relaxed load suffices. The acquire
+    // load of |tail| ensures that the consumer is done reading any space that
+    // we are about to reuse.
+    const uint64_t head_offset = head().load(std::memory_order_relaxed);
+    const uint64_t tail_offset = tail().load(std::memory_order_acquire);
+    if (!IsValid(head_offset, tail_offset)) [[unlikely]] {
+      return fit::error{WriteError::kInvalidHeader};
+    }
+
+    const size_t used = head_offset - tail_offset;
+    if (payload.size() > std::numeric_limits<uint32_t>::max() ||
+        RecordSize(payload.size()) > capacity() - used) {
+      return fit::error{WriteError::kOutOfMemory};
+    }
+
+    const RecordHeader record{.size = static_cast<uint32_t>(payload.size()), .reserved = 0};
+    CopyIn(head_offset, cpp20::as_bytes(cpp20::span{&record, 1}));
+    CopyIn(head_offset + sizeof(RecordHeader), payload);
+
+    // Publish the record with release semantics so that the consumer sees its
+    // contents once it sees the new head.
+    const size_t record_size = RecordSize(payload.size());
+    head().store(head_offset + record_size, std::memory_order_release);
+    return fit::ok(WriteInfo{.used_before = used, .used_after = used + record_size});
+  }
+
+  // Returns the payload size of the next record, without consuming it.
+  fit::result<ReadError, size_t> NextRecordSize() const {
+    auto located = self()->ReadRecordHeader();
+    if (located.is_error()) {
+      return located.take_error();
+    }
+    return fit::ok(located->size);
+  }
+
+  // Consumes the next record, copying its payload into |dest| and returning
+  // its size. Only one thread (or process) may read at a time.
+  fit::result<ReadError, size_t> Read(cpp20::span<std::byte> dest) {
+    auto located = ReadRecordHeader();
+    if (located.is_error()) {
+      return located.take_error();
+    }
+    const auto [tail_offset, size] = located.value();
+    if (dest.size() < size) {
+      return fit::error{ReadError::kBufferTooSmall};
+    }
+
+    CopyOut(tail_offset + sizeof(RecordHeader), dest.subspan(0, size));
+
+    // Release the space with release semantics so that the producer does not
+    // overwrite it before we are done reading.
+    tail().store(tail_offset + RecordSize(size), std::memory_order_release);
+    return fit::ok(size);
+  }
+
+  // The number of bytes written but not yet consumed, or fit::failed() in the
+  // case of an invalid header.
+  fit::result<fit::failed, size_t> UsedBytes() const {
+    const uint64_t head_offset = self()->head().load(std::memory_order_acquire);
+    const uint64_t tail_offset = self()->tail().load(std::memory_order_acquire);
+    if (!IsValid(head_offset, tail_offset)) [[unlikely]] {
+      return fit::failed();
+    }
+    return fit::ok(head_offset - tail_offset);
+  }
+
+ private:
+  static constexpr size_t kAlignment = 8;
+
+  struct alignas(8) Header {
+    uint64_t head;
+    uint64_t tail;
+  };
+
+  struct alignas(8) RecordHeader {
+    uint32_t size;
+    uint32_t reserved;
+  };
+
+  struct LocatedRecord {
+    uint64_t tail_offset;
+    size_t size;
+  };
+
+  // See WriteError::kInvalidHeader.
+  bool IsValid(uint64_t head_offset, uint64_t tail_offset) const {
+    return tail_offset <= head_offset && head_offset - tail_offset <= capacity() &&
+           head_offset % kAlignment == 0 && tail_offset % kAlignment == 0;
+  }
+
+  // Loads and validates the header of the record at the tail.
+  fit::result<ReadError, LocatedRecord> ReadRecordHeader() {
+    // The acquire load of |head| ensures that the contents of the records up
+    // to it are visible. Only the consumer stores |tail|.
+    const uint64_t head_offset = head().load(std::memory_order_acquire);
+    const uint64_t tail_offset = tail().load(std::memory_order_relaxed);
+    if (!IsValid(head_offset, tail_offset)) [[unlikely]] {
+      return fit::error{ReadError::kInvalidHeader};
+    }
+    if (head_offset == tail_offset) {
+      return fit::error{ReadError::kEmpty};
+    }
+
+    RecordHeader record;
+    CopyOut(tail_offset, cpp20::as_writable_bytes(cpp20::span{&record, 1}));
+    if (RecordSize(record.size) > head_offset - tail_offset) [[unlikely]] {
+      return fit::error{ReadError::kInvalidRecord};
+    }
+    return fit::ok(LocatedRecord{.tail_offset = tail_offset, .size = record.size});
+  }
+
+  // Copies |src| into the data area at the ring offset |offset|, wrapping
+  // around the end of the data area if needed.
+  void CopyIn(uint64_t offset, cpp20::span<const std::byte> src) {
+    cpp20::span<std::byte> data = bytes_.subspan(sizeof(Header));
+    const size_t start = offset % data.size();
+    const size_t first = std::min(src.size(), data.size() - start);
+    memcpy(&data[start], src.data(), first);
+    memcpy(data.data(), src.data() + first, src.size() - first);
+  }
+
+  // Copies from the data area at the ring offset |offset| into |dest|,
+  // wrapping around the end of the data area if needed.
+  void CopyOut(uint64_t offset, cpp20::span<std::byte> dest) const {
+    cpp20::span<const std::byte> data = bytes_.subspan(sizeof(Header));
+    const size_t start = offset % data.size();
+    const size_t first = std::min(dest.size(), data.size() - start);
+    memcpy(dest.data(), &data[start], first);
+    memcpy(dest.data() + first, data.data(), dest.size() - first);
+  }
+
+  // TODO(https://fxbug.dev/354716628): Remove workaround for const/volatile qualified atomic_ref.
+  RingBuffer* self() const { return const_cast<RingBuffer*>(this); }
+  cpp20::atomic_ref<uint64_t> head() {
+    return cpp20::atomic_ref{reinterpret_cast<Header*>(bytes_.data())->head};
+  }
+  cpp20::atomic_ref<uint64_t> tail() {
+    return cpp20::atomic_ref{reinterpret_cast<Header*>(bytes_.data())->tail};
+  }
+
+  cpp20::span<std::byte> bytes_;
+};
+
+}  // namespace iob
+
+#endif  // LIB_IOB_RING_BUFFER_H_
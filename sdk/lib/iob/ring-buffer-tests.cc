@@ -0,0 +1,196 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/iob/ring-buffer.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+struct Header {
+  uint64_t head;
+  uint64_t tail;
+};
+
+cpp20::span<const std::byte> AsBytes(const char* str) {
+  return cpp20::as_bytes(cpp20::span{str, strlen(str)});
+}
+
+TEST(IobRingBufferTests, WriteRead) {
+  alignas(8) std::array<std::byte, 64> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+  EXPECT_EQ(48u, ring.capacity());
+
+  {
+    auto read = ring.NextRecordSize();
+    ASSERT_TRUE(read.is_error());
+    EXPECT_EQ(iob::RingBuffer::ReadError::kEmpty, read.error_value());
+  }
+
+  auto written = ring.Write(AsBytes("hello"));
+  ASSERT_TRUE(written.is_ok());
+  EXPECT_EQ(0u, written->used_before);
+  EXPECT_EQ(iob::RingBuffer::RecordSize(5), written->used_after);
+  EXPECT_EQ(16u, written->used_after);
+
+  written = ring.Write(AsBytes("world!!!!"));
+  ASSERT_TRUE(written.is_ok());
+  EXPECT_EQ(40u, written->used_after);
+
+  // Not enough room until the consumer catches up.
+  {
+    auto full = ring.Write(AsBytes("a"));
+    ASSERT_TRUE(full.is_error());
+    EXPECT_EQ(iob::RingBuffer::WriteError::kOutOfMemory, full.error_value());
+  }
+
+  std::array<std::byte, 4> small;
+  {
+    auto read = ring.Read(small);
+    ASSERT_TRUE(read.is_error());
+    EXPECT_EQ(iob::RingBuffer::ReadError::kBufferTooSmall, read.error_value());
+  }
+
+  std::array<char, 16> payload{};
+  auto read = ring.Read(cpp20::as_writable_bytes(cpp20::span{payload}));
+  ASSERT_TRUE(read.is_ok());
+  EXPECT_EQ(5u, read.value());
+  EXPECT_EQ(0, memcmp(payload.data(), "hello", 5));
+
+  read = ring.Read(cpp20::as_writable_bytes(cpp20::span{payload}));
+  ASSERT_TRUE(read.is_ok());
+  EXPECT_EQ(9u, read.value());
+  EXPECT_EQ(0, memcmp(payload.data(), "world!!!!", 9));
+
+  EXPECT_EQ(0u, ring.UsedBytes().value());
+}
+
+TEST(IobRingBufferTests, PayloadWrapsAround) {
+  alignas(8) std::array<std::byte, 64> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+
+  // Leave the offsets 32 bytes into the 48-byte data area, so that the next
+  // record's 16-byte payload starts 8 bytes before its end and wraps around.
+  std::array<std::byte, 24> discard;
+  ASSERT_TRUE(ring.Write(AsBytes("0123456789abcdefghijklmn")).is_ok());
+  ASSERT_TRUE(ring.Read(discard).is_ok());
+
+  auto written = ring.Write(AsBytes("fedcba9876543210"));
+  ASSERT_TRUE(written.is_ok());
+  EXPECT_EQ(0u, written->used_before);
+
+  std::array<char, 16> payload{};
+  auto read = ring.Read(cpp20::as_writable_bytes(cpp20::span{payload}));
+  ASSERT_TRUE(read.is_ok());
+  EXPECT_EQ(16u, read.value());
+  EXPECT_EQ(0, memcmp(payload.data(), "fedcba9876543210", 16));
+}
+
+TEST(IobRingBufferTests, Watermark) {
+  alignas(8) std::array<std::byte, 80> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+
+  constexpr size_t kWatermark = 32;
+  auto first = ring.Write(AsBytes("one"));
+  ASSERT_TRUE(first.is_ok());
+  EXPECT_FALSE(first->CrossedWatermark(kWatermark));
+
+  auto second = ring.Write(AsBytes("two"));
+  ASSERT_TRUE(second.is_ok());
+  EXPECT_TRUE(second->CrossedWatermark(kWatermark));
+
+  // Already above the watermark, so there's no need to signal again.
+  auto third = ring.Write(AsBytes("three"));
+  ASSERT_TRUE(third.is_ok());
+  EXPECT_FALSE(third->CrossedWatermark(kWatermark));
+}
+
+TEST(IobRingBufferTests, InvalidHeader) {
+  alignas(8) std::array<std::byte, 64> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+
+  Header* header = reinterpret_cast<Header*>(buffer.data());
+
+  // More unconsumed data than the capacity.
+  header->head = 56;
+  EXPECT_EQ(iob::RingBuffer::WriteError::kInvalidHeader, ring.Write(AsBytes("a")).error_value());
+  std::array<std::byte, 8> payload;
+  EXPECT_EQ(iob::RingBuffer::ReadError::kInvalidHeader, ring.Read(payload).error_value());
+
+  // Misaligned.
+  header->head = 4;
+  EXPECT_EQ(iob::RingBuffer::WriteError::kInvalidHeader, ring.Write(AsBytes("a")).error_value());
+  EXPECT_TRUE(ring.UsedBytes().is_error());
+
+  // The tail ahead of the head.
+  header->head = 0;
+  header->tail = 8;
+  EXPECT_EQ(iob::RingBuffer::ReadError::kInvalidHeader, ring.Read(payload).error_value());
+}
+
+TEST(IobRingBufferTests, InvalidRecord) {
+  alignas(8) std::array<std::byte, 64> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+  ASSERT_TRUE(ring.Write(AsBytes("abc")).is_ok());
+
+  // Claim a payload that extends past the head.
+  uint32_t* record_size = reinterpret_cast<uint32_t*>(&buffer[sizeof(Header)]);
+  *record_size = 9;
+
+  std::array<std::byte, 16> payload;
+  auto read = ring.Read(payload);
+  ASSERT_TRUE(read.is_error());
+  EXPECT_EQ(iob::RingBuffer::ReadError::kInvalidRecord, read.error_value());
+}
+
+TEST(IobRingBufferTests, ProducerConsumerThreads) {
+  constexpr uint32_t kNumRecords = 10000;
+
+  alignas(8) std::array<std::byte, 256> buffer;
+  iob::RingBuffer ring(buffer);
+  ring.Init();
+
+  std::thread producer([&ring] {
+    for (uint32_t i = 0; i < kNumRecords;) {
+      // Vary the payload size so that records wrap around at different points.
+      std::vector<uint32_t> payload(i % 7 + 1, i);
+      if (ring.Write(cpp20::as_bytes(cpp20::span{payload})).is_ok()) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  for (uint32_t i = 0; i < kNumRecords;) {
+    std::array<uint32_t, 8> payload;
+    auto read = ring.Read(cpp20::as_writable_bytes(cpp20::span{payload}));
+    if (read.is_error()) {
+      ASSERT_EQ(iob::RingBuffer::ReadError::kEmpty, read.error_value());
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ((i % 7 + 1) * sizeof(uint32_t), read.value());
+    for (size_t j = 0; j < i % 7 + 1; ++j) {
+      ASSERT_EQ(i, payload[j]);
+    }
+    ++i;
+  }
+
+  producer.join();
+  EXPECT_EQ(0u, ring.UsedBytes().value());
+}
+
+}  // namespace
@@ -186,7 +186,9 @@ struct StartupLoadModule : public StartupLoadModuleBase,
 
   void Relocate(Diagnostics& diag, const List& modules) {
     elfldltl::RelocateRelative(diag, memory(), reloc_info(), load_bias());
-    auto resolver = elfldltl::MakeSymbolResolver(*this, modules, diag, kTlsDescResolver);
+    // Many relocations in a module refer to the same symbols, so remember
+    // recent lookups instead of repeating them through the whole module list.
+    auto resolver = elfldltl::MakeCachingSymbolResolver(*this, modules, diag, kTlsDescResolver);
     elfldltl::RelocateSymbolic(memory(), diag, reloc_info(), symbol_info(), load_bias(), resolver);
   }
 
@@ -17,6 +17,8 @@
 #include <atomic>
 #include <limits>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 namespace syslog_runtime {
 
@@ -160,7 +162,7 @@ class LogBuffer final {
   void Encode(KeyValue<const char*, char*> value) { WriteKeyValue(value.key(), value.value()); }
 
   // Encodes a C++ std::string.
-  void Encode(KeyValue<const char*, std::string> value) {
+  void Encode(const KeyValue<const char*, std::string>& value) {
     WriteKeyValue(value.key(), value.value());
   }
 
@@ -276,9 +278,22 @@ class NullSafeStringView final {
   cpp17::optional<cpp17::string_view> string_view_;
 };
 
+// True if |T| is a key-value pair which LogBuffer knows how to encode.
+template <typename T, typename = void>
+struct IsEncodable : std::false_type {};
+
+template <typename T>
+struct IsEncodable<
+    T, std::void_t<decltype(std::declval<LogBuffer&>().Encode(std::declval<const T&>()))>>
+    : std::true_type {};
+
+// Arguments are taken by reference and encoded directly into the record, so
+// no copies of string values are made on the way to the socket.
 template <typename Msg, typename... Args>
 void WriteStructuredLog(fuchsia_logging::LogSeverity severity, const char* file, int line, Msg msg,
-                        Args... args) {
+                        const Args&... args) {
+  static_assert((IsEncodable<Args>::value && ...),
+                "FX_LOG_KV arguments must be FX_KV pairs with a supported value type");
   syslog_runtime::LogBufferBuilder builder(severity);
   if (file) {
     builder.WithFile(file, line);
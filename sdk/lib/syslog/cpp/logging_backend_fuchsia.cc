@@ -25,7 +25,7 @@
 #include <cstddef>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <string>
 
 #include "lib/component/incoming/cpp/protocol.h"
 #include "lib/syslog/cpp/macros.h"
@@ -54,6 +54,9 @@ class LogState {
 
   void HandleInterest(fuchsia_diagnostics::wire::Interest interest);
 
+  // Updates |min_severity_| and publishes it for lock-free severity checks.
+  void SetMinSeverity(fuchsia_logging::RawLogSeverity severity);
+
   fidl::WireSharedClient<fuchsia_logger::LogSink> log_sink_;
   void (*on_severity_changed_)(fuchsia_logging::RawLogSeverity severity);
   // Loop that never runs any code, but is needed so FIDL
@@ -121,12 +124,17 @@ void BeginRecordInternal(LogBuffer* buffer, fuchsia_logging::RawLogSeverity seve
   // occurs if condition isn't set.
   std::optional<std::string> modified_msg;
   if (condition) {
-    std::stringstream s;
-    s << "Check failed: " << *condition << ". ";
+    constexpr cpp17::string_view kPrefix = "Check failed: ";
+    constexpr cpp17::string_view kSeparator = ". ";
+    modified_msg.emplace();
+    modified_msg->reserve(kPrefix.size() + condition->size() + kSeparator.size() +
+                          (msg ? msg->size() : 0));
+    modified_msg->append(kPrefix.data(), kPrefix.size());
+    modified_msg->append(condition->data(), condition->size());
+    modified_msg->append(kSeparator.data(), kSeparator.size());
     if (msg) {
-      s << *msg;
+      modified_msg->append(msg->data(), msg->size());
     }
-    modified_msg = s.str();
     if (severity == fuchsia_logging::LogSeverity::Fatal) {
       // We're crashing -- so leak the string in order to prevent
       // use-after-free of the maybe_fatal_string.
@@ -171,6 +179,12 @@ void SetLogSettings(const fuchsia_logging::LogSettings& settings) {
 }
 
 fuchsia_logging::RawLogSeverity GetMinLogSeverity() {
+  // Every log call checks the severity, so read the published copy rather than contending on the
+  // state lock. It is only unset until the first log state is created.
+  fuchsia_logging::RawLogSeverity severity = internal::FuchsiaLogGetMinSeverity();
+  if (severity != internal::kFuchsiaLogSeverityUnset) {
+    return severity;
+  }
   GlobalStateLock lock;
   return lock->min_severity();
 }
@@ -193,12 +207,17 @@ void internal::LogState::PollInterest() {
 
 void internal::LogState::HandleInterest(fuchsia_diagnostics::wire::Interest interest) {
   if (!interest.has_min_severity()) {
-    min_severity_ = default_severity_;
+    SetMinSeverity(default_severity_);
   } else {
-    min_severity_ = static_cast<fuchsia_logging::RawLogSeverity>(interest.min_severity());
+    SetMinSeverity(static_cast<fuchsia_logging::RawLogSeverity>(interest.min_severity()));
   }
 }
 
+void internal::LogState::SetMinSeverity(fuchsia_logging::RawLogSeverity severity) {
+  min_severity_ = severity;
+  internal::FuchsiaLogSetMinSeverity(severity);
+}
+
 void internal::LogState::Connect() {
   auto default_dispatcher = async_get_default_dispatcher();
   bool missing_dispatcher = false;
@@ -281,8 +300,7 @@ void LogBuffer::WriteKeyValue(cpp17::string_view key, bool value) {
 }
 
 bool LogBuffer::Flush() {
-  GlobalStateLock log_state;
-  if (raw_severity_ < log_state->min_severity()) {
+  if (raw_severity_ < GetMinLogSeverity()) {
     return true;
   }
   auto ret = inner_.FlushRecord();
@@ -309,7 +327,7 @@ internal::LogState::LogState(const fuchsia_logging::LogSettings& settings)
   interest_listener_dispatcher_ =
       static_cast<async_dispatcher_t*>(settings.single_threaded_dispatcher);
   interest_listener_config_ = settings.interest_listener_config_;
-  min_severity_ = settings.min_log_level;
+  SetMinSeverity(settings.min_log_level);
   if (settings.log_sink) {
     provided_log_sink_ = fidl::ClientEnd<fuchsia_logger::LogSink>(zx::channel(settings.log_sink));
   }
@@ -13,12 +13,17 @@
 #include <zircon/process.h>
 #include <zircon/syscalls.h>
 
+#include <atomic>
+
 #define EXPORT __attribute__((visibility("default")))
 
 namespace {
 
 syslog_runtime::internal::LogState* state = nullptr;
 mtx_t state_lock = MTX_INIT;
+// Mirrors the minimum severity of |state| so that severity checks, which happen on every log
+// call, don't need to acquire |state_lock|.
+std::atomic<uint8_t> min_severity{syslog_runtime::internal::kFuchsiaLogSeverityUnset};
 // This thread's koid.
 // Initialized on first use.
 thread_local zx_koid_t tls_thread_koid{ZX_KOID_INVALID};
@@ -53,4 +58,12 @@ EXPORT void FuchsiaLogReleaseState() __TA_NO_THREAD_SAFETY_ANALYSIS { mtx_unlock
 EXPORT
 syslog_runtime::internal::LogState* FuchsiaLogGetStateLocked() { return state; }
 
+EXPORT
+uint8_t FuchsiaLogGetMinSeverity() { return min_severity.load(std::memory_order_relaxed); }
+
+EXPORT
+void FuchsiaLogSetMinSeverity(uint8_t severity) {
+  min_severity.store(severity, std::memory_order_relaxed);
+}
+
 }  // extern "C"
@@ -12,6 +12,10 @@
 namespace syslog_runtime::internal {
 class LogState;
 
+// Returned by FuchsiaLogGetMinSeverity before the log state is initialized.
+// Greater than any severity which can be set.
+constexpr uint8_t kFuchsiaLogSeverityUnset = UINT8_MAX;
+
 // These functions are an internal contract between the Fuchsia logging
 // backend and the logging state shared library. API users should
 // not call these directly, but they need to be exported to allow
@@ -34,6 +38,14 @@ LogState* FuchsiaLogGetStateLocked();
 // Returns the current thread's koid.
 zx_koid_t FuchsiaLogGetCurrentThreadKoid();
 
+// Returns the minimum severity of the current log state without acquiring the
+// state lock, or kFuchsiaLogSeverityUnset if no state has been set yet.
+uint8_t FuchsiaLogGetMinSeverity();
+
+// Publishes the minimum severity returned by FuchsiaLogGetMinSeverity. Called
+// by the log state whenever its minimum severity changes.
+void FuchsiaLogSetMinSeverity(uint8_t severity);
+
 }  // extern "C"
 }  // namespace syslog_runtime::internal
 
@@ -312,6 +312,23 @@ TEST_F(LoggingFixture, MacroCompilationTest) {
   FX_LOG_KV(DEBUG, "test log", FX_KV("key", static_cast<int64_t>(zero)));
 }
 
+TEST_F(LoggingFixture, DisabledSeverityIsFilteredBeforeFormatting) {
+  LogSettingsBuilder builder;
+  builder.WithMinLogSeverity(LogSeverity::Warn).BuildAndInitialize();
+  EXPECT_FALSE(FX_LOG_IS_ON(INFO));
+  EXPECT_TRUE(FX_LOG_IS_ON(WARNING));
+
+  int evaluations = 0;
+  auto evaluate = [&evaluations] { return ++evaluations; };
+  FX_LOGS(INFO) << evaluate();
+  FX_LOG_KV(INFO, "test log", FX_KV("key", evaluate()));
+  EXPECT_EQ(evaluations, 0);
+
+  // Lowering the minimum severity must be visible to the next check.
+  builder.WithMinLogSeverity(LogSeverity::Info).BuildAndInitialize();
+  EXPECT_TRUE(FX_LOG_IS_ON(INFO));
+}
+
 TEST(StructuredLogging, LOGS) {
   std::string str;
   // 5mb log shouldn't crash
@@ -37,7 +37,7 @@ static_assert(ZXIO_SELINUX_CONTEXT_MAX_ATTR_LEN == fio::wire::kMaxSelinuxContext
 zx_status_t RemoteReadv(const fidl::UnownedClientEnd<fio::Readable>& client_end,
                         const zx_iovec_t* vector, size_t vector_count, zxio_flags_t flags,
                         size_t* out_actual) {
-  return zxio_chunked_do_vector<fio::wire::kMaxBuf>(
+  return zxio_coalesced_do_vector<fio::wire::kMaxBuf, /*kIsWrite=*/false>(
       vector, vector_count, flags, out_actual,
       [&client_end](uint8_t* buffer, size_t capacity, size_t* out_actual) {
         // Explicitly allocating message buffers to avoid heap allocation.
@@ -64,7 +64,7 @@ zx_status_t RemoteReadv(const fidl::UnownedClientEnd<fio::Readable>& client_end,
 zx_status_t RemoteWritev(const fidl::UnownedClientEnd<fio::Writable>& client_end,
                          const zx_iovec_t* vector, size_t vector_count, zxio_flags_t flags,
                          size_t* out_actual) {
-  return zxio_chunked_do_vector<fio::wire::kMaxBuf>(
+  return zxio_coalesced_do_vector<fio::wire::kMaxBuf, /*kIsWrite=*/true>(
       vector, vector_count, flags, out_actual,
       [&client_end](uint8_t* buffer, size_t capacity, size_t* out_actual) {
         // Explicitly allocating message buffers to avoid heap allocation.
@@ -94,7 +94,7 @@ namespace {
 zx_status_t FileReadvAt(const fidl::WireSyncClient<fio::File>& client, zx_off_t offset,
                         const zx_iovec_t* vector, size_t vector_count, zxio_flags_t flags,
                         size_t* out_actual) {
-  return zxio_chunked_do_vector<fio::wire::kMaxBuf>(
+  return zxio_coalesced_do_vector<fio::wire::kMaxBuf, /*kIsWrite=*/false>(
       vector, vector_count, flags, out_actual,
       [&client, &offset](uint8_t* buffer, size_t capacity, size_t* out_actual) {
         // Explicitly allocating message buffers to avoid heap allocation.
@@ -123,7 +123,7 @@ zx_status_t FileReadvAt(const fidl::WireSyncClient<fio::File>& client, zx_off_t
 zx_status_t FileWritevAt(const fidl::WireSyncClient<fio::File>& client, zx_off_t offset,
                          const zx_iovec_t* vector, size_t vector_count, zxio_flags_t flags,
                          size_t* out_actual) {
-  return zxio_chunked_do_vector<fio::wire::kMaxBuf>(
+  return zxio_coalesced_do_vector<fio::wire::kMaxBuf, /*kIsWrite=*/true>(
       vector, vector_count, flags, out_actual,
       [&client, &offset](uint8_t* buffer, size_t capacity, size_t* out_actual) {
         // Explicitly allocating message buffers to avoid heap allocation.
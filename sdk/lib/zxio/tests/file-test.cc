@@ -10,6 +10,7 @@
 #include <lib/zxio/ops.h>
 
 #include <atomic>
+#include <iterator>
 #include <memory>
 
 #include <zxtest/zxtest.h>
@@ -45,6 +46,7 @@ class CloseCountingFileServer : public zxio_tests::TestFileServerBase {
   void Describe(DescribeCompleter::Sync& completer) override { completer.Reply({}); }
 
   uint32_t num_close() const { return num_close_.load(); }
+  uint32_t num_io_calls() const { return num_io_calls_.load(); }
 
   void ForceErrorAfterNCalls(uint8_t n, zx_status_t status) {
     EXPECT_EQ(forced_error_after_n_calls_, std::nullopt);
@@ -53,6 +55,7 @@ class CloseCountingFileServer : public zxio_tests::TestFileServerBase {
 
  protected:
   zx_status_t CheckForcedError() {
+    num_io_calls_.fetch_add(1);
     if (forced_error_after_n_calls_) {
       auto& [n, status] = forced_error_after_n_calls_.value();
       if (n == 0) {
@@ -68,6 +71,7 @@ class CloseCountingFileServer : public zxio_tests::TestFileServerBase {
 
  private:
   std::atomic<uint32_t> num_close_ = 0;
+  std::atomic<uint32_t> num_io_calls_ = 0;
   std::optional<std::pair<uint8_t, zx_status_t>> forced_error_after_n_calls_ = std::nullopt;
 };
 
@@ -358,7 +362,9 @@ TEST_F(File, ReadvWritevChannel) {
   auto check_io =
       [&](zx_status_t (*zxio_fn)(zxio_t*, const zx_iovec_t*, size_t, zxio_flags_t, size_t*),
           void* buf, size_t buflen, zx_status_t status) {
-        char random_unused_buf[1];
+        // Large enough that the two buffers do not fit in a single request together, so that
+        // each of them is transferred with its own call.
+        char random_unused_buf[fio::wire::kMaxBuf];
         const zx_iovec_t iov[2] = {
             {
                 .buffer = buf,
@@ -391,6 +397,42 @@ TEST_F(File, ReadvWritevChannel) {
   ASSERT_EQ(strncmp(write_buf, read_buf, sizeof(read_buf)), 0);
 }
 
+// Buffers that fit in a single request together are transferred with one call.
+TEST_F(File, ReadvWritevChannelCoalesced) {
+  ASSERT_NO_FAILURES(StartServer<TestServerChannel>());
+  ASSERT_OK(OpenFile());
+
+  char write_buf[3][4] = {{'a', 'b', 'c', 'd'}, {'e', 'f'}, {'g', 'h', 'i'}};
+  const zx_iovec_t write_iov[3] = {
+      {.buffer = write_buf[0], .capacity = 4},
+      {.buffer = write_buf[1], .capacity = 2},
+      {.buffer = write_buf[2], .capacity = 3},
+  };
+  size_t actual = 0u;
+  ASSERT_OK(zxio_writev(&file_.io, write_iov, std::size(write_iov), 0, &actual));
+  EXPECT_EQ(actual, 9u);
+  EXPECT_EQ(server_->num_io_calls(), 1u);
+
+  size_t seek = 0;
+  ASSERT_OK(zxio_seek(&file_.io, ZXIO_SEEK_ORIGIN_START, 0, &seek));
+  EXPECT_EQ(seek, 0);
+
+  // Ask for more than was written, to check that a short read is scattered correctly.
+  char read_buf[3][4] = {};
+  const zx_iovec_t read_iov[3] = {
+      {.buffer = read_buf[0], .capacity = 2},
+      {.buffer = read_buf[1], .capacity = 4},
+      {.buffer = read_buf[2], .capacity = 4},
+  };
+  ASSERT_OK(zxio_readv(&file_.io, read_iov, std::size(read_iov), 0, &actual));
+  EXPECT_EQ(actual, 9u);
+  EXPECT_EQ(server_->num_io_calls(), 2u);
+  EXPECT_EQ(memcmp(read_buf[0], "ab", 2), 0);
+  EXPECT_EQ(memcmp(read_buf[1], "cdef", 4), 0);
+  EXPECT_EQ(memcmp(read_buf[2], "ghi", 3), 0);
+  EXPECT_EQ(read_buf[2][3], 0);
+}
+
 class TestServerStream final : public CloseCountingFileServer {
  public:
   void Init() override {
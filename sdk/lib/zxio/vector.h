@@ -115,4 +115,50 @@ zx_status_t zxio_chunked_do_vector(const zx_iovec_t* vector, size_t vector_count
   return zxio_stream_do_vector(vector, vector_count, out_actual, std::move(fn_chunked));
 }
 
+// Like |zxio_chunked_do_vector| except that when there are several buffers and they fit in a
+// single chunk together, they are transferred with one call to |fn| through a bounce buffer
+// rather than one call per buffer. For writes (|kIsWrite|), the buffers are gathered into the
+// bounce buffer before calling |fn|; for reads, the bytes |fn| produced are scattered into the
+// buffers afterwards. This saves a round trip per buffer for callers that do small vectored I/O.
+template <size_t kChunkSize, bool kIsWrite, typename F>
+zx_status_t zxio_coalesced_do_vector(const zx_iovec_t* vector, size_t vector_count,
+                                     zxio_flags_t flags, size_t* out_actual, F fn) {
+  if (flags) {
+    return ZX_ERR_NOT_SUPPORTED;
+  }
+  size_t total = 0;
+  for (size_t i = 0; i < vector_count && total <= kChunkSize; ++i) {
+    total += std::min(vector[i].capacity, kChunkSize + 1);
+  }
+  if (vector_count < 2 || total > kChunkSize) {
+    return zxio_chunked_do_vector<kChunkSize>(vector, vector_count, flags, out_actual,
+                                              std::move(fn));
+  }
+
+  uint8_t buffer[kChunkSize];
+  if constexpr (kIsWrite) {
+    size_t offset = 0;
+    for (size_t i = 0; i < vector_count; ++i) {
+      std::copy_n(static_cast<const uint8_t*>(vector[i].buffer), vector[i].capacity,
+                  buffer + offset);
+      offset += vector[i].capacity;
+    }
+  }
+  size_t actual = 0;
+  const zx_status_t status = fn(buffer, total, &actual);
+  if (status != ZX_OK) {
+    return status;
+  }
+  if constexpr (!kIsWrite) {
+    size_t offset = 0;
+    for (size_t i = 0; i < vector_count && offset < actual; ++i) {
+      const size_t count = std::min(vector[i].capacity, actual - offset);
+      std::copy_n(buffer + offset, count, static_cast<uint8_t*>(vector[i].buffer));
+      offset += count;
+    }
+  }
+  *out_actual = actual;
+  return ZX_OK;
+}
+
 #endif  // LIB_ZXIO_VECTOR_H_
@@ -434,7 +434,9 @@ int main(int argv, char** argc) {
       status != ZX_OK) {
     FX_PLOGS(ERROR, status) << "VFS loop exited";
   }
-  auto ldsvc = loader::LoaderService::Create(dispatcher, std::move(lib_fd), "console-launcher");
+  // bootfs is read-only, so the libraries can be cached across the processes we launch.
+  auto ldsvc = loader::LoaderService::Create(dispatcher, std::move(lib_fd), "console-launcher",
+                                             /*cache_objects=*/true);
 
   zx::result result = console_launcher::ConsoleLauncher::Create();
   if (result.is_error()) {
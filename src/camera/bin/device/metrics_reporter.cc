@@ -217,6 +217,8 @@ MetricsReporter::StreamRecord::StreamRecord(MetricsReporter::Impl& impl, inspect
       format_record_(node_),
       frames_received_(node_.CreateUint(kStreamInspectorFramesReceivedPropertyName, 0)),
       frames_dropped_(node_.CreateUint(kStreamInspectorFramesDroppedPropertyName, 0)),
+      capture_latency_last_(node_.CreateUint(kStreamInspectorCaptureLatencyLastPropertyName, 0)),
+      capture_latency_max_(node_.CreateUint(kStreamInspectorCaptureLatencyMaxPropertyName, 0)),
       type_(GetStreamType(config_index, stream_index)) {}
 
 void MetricsReporter::StreamRecord::SetProperties(
@@ -252,6 +254,21 @@ void MetricsReporter::StreamRecord::FrameDropped(cobalt::FrameDropReason why) {
                                cobalt::Logger::BuildDimension(type_, why));
 }
 
+void MetricsReporter::StreamRecord::FrameDelivered(zx::duration capture_latency) {
+  // Frames whose capture timestamp is ahead of the delivery time carry no useful latency.
+  if (capture_latency < zx::duration(0)) {
+    return;
+  }
+  uint64_t usecs = static_cast<uint64_t>(capture_latency.to_usecs());
+  TRACE_COUNTER("camera", "capture_latency_usecs", reinterpret_cast<uintptr_t>(this), "usecs",
+                usecs);
+  capture_latency_last_.Set(usecs);
+  if (usecs > capture_latency_max_usecs_) {
+    capture_latency_max_usecs_ = usecs;
+    capture_latency_max_.Set(usecs);
+  }
+}
+
 MetricsReporter::ImageFormatRecord::ImageFormatRecord(inspect::Node& parent)
     : node_(parent.CreateChild(kStreamInspectorImageFormatNodeName)),
       pixel_format_(node_.CreateString(kFormatInspectorPixelformatPropertyName, "")),
@@ -8,6 +8,7 @@
 #include <fuchsia/camera3/cpp/fidl.h>
 #include <lib/inspect/component/cpp/component.h>
 #include <lib/sys/cpp/component_context.h>
+#include <lib/zx/time.h>
 
 #include <mutex>
 
@@ -140,6 +141,10 @@ class MetricsReporter {
     // Reports that we've dropped/skipped a newly delivered frame.
     void FrameDropped(cobalt::FrameDropReason why);
 
+    // Reports the time between a frame's capture and its delivery to clients. This covers every
+    // stage of the driver pipeline that the frame passed through.
+    void FrameDelivered(zx::duration capture_latency);
+
    private:
     MetricsReporter::Impl& impl_;
 
@@ -156,6 +161,9 @@ class MetricsReporter {
 
     inspect::UintProperty frames_received_;
     inspect::UintProperty frames_dropped_;
+    inspect::UintProperty capture_latency_last_;
+    inspect::UintProperty capture_latency_max_;
+    uint64_t capture_latency_max_usecs_ = 0;
 
     cobalt::StreamType type_;
   };
@@ -215,6 +223,10 @@ inline constexpr const char kFormatInspectorColorSpacePropertyName[] = "color sp
 inline constexpr const char kFormatInspectorDisplayResolutionPropertyName[] = "display resolution";
 inline constexpr const char kFormatInspectorOutputResolutionPropertyName[] = "output resolution";
 inline constexpr const char kFormatInspectorPixelformatPropertyName[] = "pixel format";
+inline constexpr const char kStreamInspectorCaptureLatencyLastPropertyName[] =
+    "capture latency last usecs";
+inline constexpr const char kStreamInspectorCaptureLatencyMaxPropertyName[] =
+    "capture latency max usecs";
 inline constexpr const char kStreamInspectorCropPropertyName[] = "supports crop region";
 inline constexpr const char kStreamInspectorFrameratePropertyName[] = "frame rate";
 inline constexpr const char kStreamInspectorFramesDroppedPropertyName[] = "frames dropped";
@@ -140,6 +140,35 @@ TEST_F(MetricsReporterTest, StreamFrameMetrics) {
                                                     0)}))))))))))))))));
 }
 
+TEST_F(MetricsReporterTest, StreamCaptureLatency) {
+  auto config = MetricsReporter::Get().CreateConfigurationRecord(0, 1);
+
+  // The maximum holds while the last value follows each frame. Negative latencies are ignored.
+  config->GetStreamRecord(0).FrameDelivered(zx::msec(40));
+  config->GetStreamRecord(0).FrameDelivered(zx::msec(25));
+  config->GetStreamRecord(0).FrameDelivered(zx::msec(-5));
+
+  EXPECT_THAT(GetHierarchy(),
+              ChildrenMatch(UnorderedElementsAre(AllOf(
+                  // configuration node
+                  NodeMatches(NameMatches(kConfigurationInspectorNodeName)),
+                  ChildrenMatch(UnorderedElementsAre(AllOf(
+                      // configuration 0
+                      NodeMatches(NameMatches("0")),
+                      ChildrenMatch(UnorderedElementsAre(AllOf(
+                          // stream node
+                          NodeMatches(NameMatches(kStreamInspectorNodeName)),
+                          ChildrenMatch(UnorderedElementsAre(
+                              // stream 0
+                              NodeMatches(AllOf(
+                                  NameMatches("0"),
+                                  PropertyList(IsSupersetOf(
+                                      {UintIs(kStreamInspectorCaptureLatencyLastPropertyName,
+                                              25000),
+                                       UintIs(kStreamInspectorCaptureLatencyMaxPropertyName,
+                                              40000)}))))))))))))))));
+}
+
 TEST_F(MetricsReporterTest, StreamProperties) {
   auto config = MetricsReporter::Get().CreateConfigurationRecord(0, 1);
 
@@ -184,6 +184,11 @@ void StreamImpl::OnFrameAvailable(fuchsia::camera2::FrameAvailableInfo info) {
     return;
   }
 
+  if (capture_timestamp > 0) {
+    record_.FrameDelivered(zx::clock::get_monotonic() -
+                           zx::time(static_cast<zx_time_t>(capture_timestamp)));
+  }
+
   // Queue a waiter so that when the client end of the fence is released, the frame is released back
   // to the driver.
   ZX_ASSERT(frame_waiters_.size() <= max_camping_buffers_);
@@ -5,6 +5,7 @@
 
 #include <lib/ddk/debug.h>
 #include <lib/ddk/trace/event.h>
+#include <lib/zx/clock.h>
 #include <zircon/assert.h>
 #include <zircon/errors.h>
 #include <zircon/types.h>
@@ -66,9 +67,14 @@ void ProcessNode::SetLabel(std::string label) {
 
 void ProcessNode::SendFrame(uint32_t index, frame_metadata_t metadata,
                             fit::closure release_callback) const {
-  TRACE_DURATION("camera", "ProcessNode::SendFrame", "this", this, "index", index);
   ZX_ASSERT(metadata.timestamp > 0);
   ZX_ASSERT(metadata.capture_timestamp > 0);
+  // The time since capture at each node's output, compared against the node before it, gives the
+  // cost of each stage of the pipeline.
+  zx::duration capture_latency =
+      zx::clock::get_monotonic() - zx::time(static_cast<zx_time_t>(metadata.capture_timestamp));
+  TRACE_DURATION("camera", "ProcessNode::SendFrame", "this", this, "index", index, "label", label_,
+                 "capture_latency_us", capture_latency.to_usecs());
   // If the node is shutting down, immediately release the frame.
   if (shutdown_state_.requested) {
     release_callback();
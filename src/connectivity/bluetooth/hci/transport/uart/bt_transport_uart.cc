@@ -66,6 +66,7 @@ BtTransportUart::BtTransportUart(fuchsia_driver_framework::DriverStartArgs start
     buffer.reserve(fhbt::kAclPacketMax + 1);
     available_buffers_.push(std::move(buffer));
   }
+  write_buffer_.reserve(kMaxSendBatchBytes);
 }
 
 zx::result<> BtTransportUart::Start() {
@@ -290,7 +291,7 @@ void BtTransportUart::OnScoData(std::vector<uint8_t>& packet, fit::function<void
 
   auto& buffer = available_buffers_.front();
   buffer = std::move(packet);
-  send_queue_.emplace(std::move(buffer), std::move(callback));
+  send_queue_.emplace_back(std::move(buffer), std::move(callback));
   available_buffers_.pop();
   send_queue_task_.Post(dispatcher_);
 }
@@ -299,7 +300,7 @@ void BtTransportUart::OnScoStop() {
   sco_connection_binding_.RemoveBindings(&sco_connection_server_);
 }
 
-void BtTransportUart::ProcessOnePacketFromSendQueue() {
+void BtTransportUart::ProcessSendQueue() {
   if (!can_send_) {
     return;
   }
@@ -307,14 +308,40 @@ void BtTransportUart::ProcessOnePacketFromSendQueue() {
     return;
   }
 
-  auto& buffer_entry = send_queue_.front();
-  SerialWrite(buffer_entry.data_, std::move(buffer_entry.callback_));
+  // Coalesce as many of the queued packets as fit into a single serial write. The packet indicator
+  // and header make HCI UART packets self-delimiting, so the controller doesn't need the packet
+  // boundaries to line up with the writes.
+  size_t batch_size = 1;
+  size_t batch_bytes = send_queue_.front().data_.size();
+  while (batch_size < send_queue_.size() &&
+         batch_bytes + send_queue_[batch_size].data_.size() <= kMaxSendBatchBytes) {
+    batch_bytes += send_queue_[batch_size].data_.size();
+    batch_size++;
+  }
+  if (batch_size == 1) {
+    SerialWrite(send_queue_.front().data_);
+  } else {
+    write_buffer_.clear();
+    for (size_t i = 0; i < batch_size; i++) {
+      const std::vector<uint8_t>& data = send_queue_[i].data_;
+      write_buffer_.insert(write_buffer_.end(), data.begin(), data.end());
+    }
+    SerialWrite(write_buffer_);
+  }
 
-  auto snoop_data = fidl::VectorView<uint8_t>::FromExternal(buffer_entry.data_.data() + 1,
-                                                            buffer_entry.data_.size() - 1);
+  for (size_t i = 0; i < batch_size; i++) {
+    auto& buffer_entry = send_queue_.front();
+    buffer_entry.callback_();
+    SnoopSentPacket(buffer_entry.data_);
+    buffer_entry.data_.clear();
+    available_buffers_.push(std::move(buffer_entry.data_));
+    send_queue_.pop_front();
+  }
+}
 
+void BtTransportUart::SnoopSentPacket(std::vector<uint8_t>& packet) {
   fhbt::wire::SnoopPacket::Tag snoop_type = fhbt::wire::SnoopPacket::Tag::kIso;
-  switch (buffer_entry.data_[0]) {
+  switch (packet[0]) {
     case BtHciPacketIndicator::kHciAclData:
       snoop_type = fhbt::wire::SnoopPacket::Tag::kAcl;
       break;
@@ -325,18 +352,14 @@ void BtTransportUart::ProcessOnePacketFromSendQueue() {
       snoop_type = fhbt::wire::SnoopPacket::Tag::kSco;
       break;
     default:
-      FDF_LOG(DEBUG, "Unsupported snoop sent packet type: %u", buffer_entry.data_[0]);
-      send_queue_.pop();
+      FDF_LOG(DEBUG, "Unsupported snoop sent packet type: %u", packet[0]);
       return;
   }
+  auto snoop_data = fidl::VectorView<uint8_t>::FromExternal(packet.data() + 1, packet.size() - 1);
   SendSnoop(snoop_data, snoop_type, fhbt::wire::PacketDirection::kHostToController);
-  buffer_entry.data_.clear();
-  available_buffers_.push(std::move(buffer_entry.data_));
-  send_queue_.pop();
 }
 
-void BtTransportUart::SerialWrite(const std::vector<uint8_t>& data,
-                                  fit::function<void(void)> callback) {
+void BtTransportUart::SerialWrite(const std::vector<uint8_t>& data) {
   can_send_ = false;
 
   fdf::Arena arena('WRIT');
@@ -357,7 +380,6 @@ void BtTransportUart::SerialWrite(const std::vector<uint8_t>& data,
         }
         HciTransportWriteComplete(ZX_OK);
       });
-  callback();
 }
 
 void BtTransportUart::HciHandleUartReadEvents(const uint8_t* buf, size_t length) {
@@ -614,8 +636,8 @@ void BtTransportUart::Send(fidl::Server<fhbt::HciTransport>::SendRequest& reques
 
   FDF_LOG(TRACE, "received data type: %s", data_type_name);
 
-  send_queue_.emplace(std::move(buffer),
-                      [completer = completer.ToAsync()]() mutable { completer.Reply(); });
+  send_queue_.emplace_back(std::move(buffer),
+                           [completer = completer.ToAsync()]() mutable { completer.Reply(); });
   available_buffers_.pop();
   send_queue_task_.Post(dispatcher_);
 }
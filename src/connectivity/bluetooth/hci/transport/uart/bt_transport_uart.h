@@ -25,6 +25,7 @@
 #include <threads.h>
 #include <zircon/device/bt-hci.h>
 
+#include <deque>
 #include <mutex>
 
 #include <sdk/lib/driver/logging/cpp/logger.h>
@@ -143,8 +144,9 @@ class BtTransportUart
   void OnScoData(std::vector<uint8_t>& packet, fit::function<void(void)> callback);
   void OnScoStop();
 
-  void ProcessOnePacketFromSendQueue();
-  void SerialWrite(const std::vector<uint8_t>& data, fit::function<void(void)> callback);
+  void ProcessSendQueue();
+  void SnoopSentPacket(std::vector<uint8_t>& packet);
+  void SerialWrite(const std::vector<uint8_t>& data);
 
   // Queues a read callback for async serial on the dispatcher.
   void QueueUartRead();
@@ -231,13 +233,20 @@ class BtTransportUart
   // "ScoConnection::Send" or "HciTransport::Send" after it takes out a packet from the queue and
   // throws it into the bus, for each protocol, the client side shouldn't send more packets if there
   // are 10 sent packets' completers are not replied.
-  std::queue<BufferEntry> send_queue_;
+  std::deque<BufferEntry> send_queue_;
 
-  // The task to fetch and send one packet in |send_queue_|, each task posted aims to deal with one
-  // packet, if the bus is not available, the task will post itself again until one packet gets
-  // sent.
-  async::TaskClosureMethod<BtTransportUart, &BtTransportUart::ProcessOnePacketFromSendQueue>
-      send_queue_task_{this};
+  // The maximum number of bytes of queued packets which are coalesced into a single serial write.
+  // A packet larger than this is still written on its own.
+  static constexpr size_t kMaxSendBatchBytes = 4 * (fuchsia_hardware_bluetooth::kAclPacketMax + 1);
+
+  // Holds the coalesced packets of |send_queue_| while they are being written to the bus.
+  std::vector<uint8_t> write_buffer_;
+
+  // The task to fetch and send the packets in |send_queue_|. Each task posted writes as many of the
+  // queued packets as fit in |kMaxSendBatchBytes| in one go. If the bus is not available, nothing
+  // is sent, and the task is posted again once the pending write completes.
+  async::TaskClosureMethod<BtTransportUart, &BtTransportUart::ProcessSendQueue> send_queue_task_{
+      this};
 
   // Save the serial device pid for vendor drivers to fetch.
   uint32_t serial_pid_ = 0;
@@ -49,6 +49,16 @@ class FakeSerialDevice : public fdf::WireServer<fuchsia_hardware_serialimpl::Dev
 
   std::vector<std::vector<uint8_t>>& writes() { return writes_; }
 
+  // Returns the data of all writes, in order. The driver may coalesce several queued packets into
+  // one write.
+  std::vector<uint8_t> written_bytes() const {
+    std::vector<uint8_t> bytes;
+    for (const std::vector<uint8_t>& write : writes_) {
+      bytes.insert(bytes.end(), write.begin(), write.end());
+    }
+    return bytes;
+  }
+
   bool canceled() const { return canceled_; }
 
   bool enabled() const { return enabled_; }
@@ -427,24 +437,24 @@ TEST_F(BtTransportUartHciTransportProtocolTest, SendAclPackets) {
     ASSERT_EQ(send_result.status(), ZX_OK);
   }
 
+  // A packet indicator should be prepended to each packet.
+  std::vector<uint8_t> expected;
+  for (uint8_t i = 0; i < kNumPackets; i++) {
+    expected.insert(expected.end(), {BtHciPacketIndicator::kHciAclData, i});
+  }
+
   // Allow ACL packets to be processed and sent to the serial device.
   // This function waits until the condition in the lambda is satisfied, The default poll
   // interval is 10 msec.
   driver_test().runtime().RunUntil([&]() {
     return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
-      return env.serial_device_.writes().size();
-    }) == kNumPackets;
+      return env.serial_device_.written_bytes().size();
+    }) == expected.size();
   });
 
-  const std::vector<std::vector<uint8_t>> packets =
-      driver_test().RunInEnvironmentTypeContext<const std::vector<std::vector<uint8_t>>>(
-          [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes(); });
-  ASSERT_EQ(packets.size(), kNumPackets);
-  for (uint8_t i = 0; i < kNumPackets; i++) {
-    // A packet indicator should be prepended.
-    std::vector<uint8_t> expected = {BtHciPacketIndicator::kHciAclData, i};
-    EXPECT_EQ(packets[i], expected);
-  }
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.written_bytes(); }),
+            expected);
 
   driver_test().runtime().RunUntil(
       [&]() { return snoop_sent_acl_packets().size() == kNumPackets; });
@@ -545,23 +555,72 @@ TEST_F(BtTransportUartHciTransportProtocolTest, AclReadableSignalIgnoredUntilFir
   driver_test().RunInEnvironmentTypeContext(
       [](FixtureBasedTestEnvironment& env) { return env.serial_device_.set_writes_paused(false); });
 
+  // A packet indicator should be prepended to each packet.
+  std::vector<uint8_t> expected;
+  for (uint8_t i = 0; i < kNumPackets; i++) {
+    expected.insert(expected.end(), {BtHciPacketIndicator::kHciAclData, i});
+  }
+
   // Wait for the readable signal to be processed, and both packets has been received by fake
   // serial device.
+  driver_test().runtime().RunUntil([&]() {
+    return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
+      return env.serial_device_.written_bytes().size();
+    }) == expected.size();
+  });
+
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.written_bytes(); }),
+            expected);
+}
+
+TEST_F(BtTransportUartHciTransportProtocolTest, PacketsQueuedDuringWriteAreCoalesced) {
+  driver_test().RunInEnvironmentTypeContext(
+      [](FixtureBasedTestEnvironment& env) { return env.serial_device_.set_writes_paused(true); });
+
+  fidl::Arena arena;
+  auto send_acl_packet = [&](uint8_t payload) {
+    std::vector<uint8_t> acl_packet = {payload};
+    auto packet_view = fidl::VectorView<uint8_t>::FromExternal(acl_packet);
+    hci_transport_client_->Send(fhbt::wire::SentPacket::WithAcl(arena, packet_view))
+        .Then([](fidl::WireUnownedResult<fhbt::HciTransport::Send>& result) {
+          ASSERT_EQ(result.status(), ZX_OK);
+        });
+  };
+
+  send_acl_packet(0);
   driver_test().runtime().RunUntil([&]() {
     return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
       return env.serial_device_.writes().size();
-    }) == kNumPackets;
+    }) == 1u;
   });
 
-  const std::vector<std::vector<uint8_t>> packets =
-      driver_test().RunInEnvironmentTypeContext<const std::vector<std::vector<uint8_t>>>(
-          [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes(); });
-  ASSERT_EQ(packets.size(), kNumPackets);
-  for (uint8_t i = 0; i < kNumPackets; i++) {
-    // A packet indicator should be prepended.
-    std::vector<uint8_t> expected = {BtHciPacketIndicator::kHciAclData, i};
-    EXPECT_EQ(packets[i], expected);
+  // These packets are queued while the first write is pending, and are written together once it
+  // completes.
+  const uint8_t kNumQueuedPackets = 3;
+  for (uint8_t i = 1; i <= kNumQueuedPackets; i++) {
+    send_acl_packet(i);
   }
+  driver_test().runtime().RunUntilIdle();
+  driver_test().RunInEnvironmentTypeContext(
+      [](FixtureBasedTestEnvironment& env) { return env.serial_device_.set_writes_paused(false); });
+
+  driver_test().runtime().RunUntil([&]() {
+    return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
+      return env.serial_device_.writes().size();
+    }) == 2u;
+  });
+  std::vector<uint8_t> expected;
+  for (uint8_t i = 1; i <= kNumQueuedPackets; i++) {
+    expected.insert(expected.end(), {BtHciPacketIndicator::kHciAclData, i});
+  }
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes()[1]; }),
+            expected);
+
+  // Each packet is still snooped on its own.
+  driver_test().runtime().RunUntil(
+      [&]() { return snoop_sent_acl_packets().size() == kNumQueuedPackets + 1u; });
 }
 
 TEST_F(BtTransportUartHciTransportProtocolTest, ReceiveAclPacketsIn2Parts) {
@@ -805,18 +864,19 @@ TEST_F(BtTransportUartHciTransportProtocolTest,
   driver_test().RunInEnvironmentTypeContext(
       [](FixtureBasedTestEnvironment& env) { return env.serial_device_.set_writes_paused(false); });
 
+  std::vector<uint8_t> expected = kUartCmd0;
+  expected.insert(expected.end(), kUartCmd1.begin(), kUartCmd1.end());
+
   // Wait for the readable signal to be processed and the second packet is received.
   driver_test().runtime().RunUntil([&]() {
     return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
-      return env.serial_device_.writes().size();
-    }) == 2u;
+      return env.serial_device_.written_bytes().size();
+    }) == expected.size();
   });
 
-  const std::vector<std::vector<uint8_t>> packets =
-      driver_test().RunInEnvironmentTypeContext<const std::vector<std::vector<uint8_t>>>(
-          [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes(); });
-  EXPECT_EQ(packets[0], kUartCmd0);
-  EXPECT_EQ(packets[1], kUartCmd1);
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.written_bytes(); }),
+            expected);
 }
 
 TEST_F(BtTransportUartHciTransportProtocolTest, ReceiveManyHciEventsSplitIntoTwoResponses) {
@@ -867,21 +927,22 @@ TEST_F(BtTransportUartHciTransportProtocolTest, SendScoPackets) {
     auto send_result = sco_client_.sync()->Send(packet_view);
     ASSERT_EQ(send_result.status(), ZX_OK);
   }
+  // A packet indicator should be prepended to each packet.
+  std::vector<uint8_t> expected;
+  for (uint8_t i = 0; i < kNumPackets; i++) {
+    expected.insert(expected.end(), {BtHciPacketIndicator::kHciSco, i});
+  }
+
   // Allow SCO packets to be processed and sent to the serial device.
   driver_test().runtime().RunUntil([&]() {
     return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
-      return env.serial_device_.writes().size();
-    }) == kNumPackets;
+      return env.serial_device_.written_bytes().size();
+    }) == expected.size();
   });
 
-  const std::vector<std::vector<uint8_t>> packets =
-      driver_test().RunInEnvironmentTypeContext<const std::vector<std::vector<uint8_t>>>(
-          [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes(); });
-  for (uint8_t i = 0; i < kNumPackets; i++) {
-    // A packet indicator should be prepended.
-    std::vector<uint8_t> expected = {BtHciPacketIndicator::kHciSco, i};
-    EXPECT_EQ(packets[i], expected);
-  }
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.written_bytes(); }),
+            expected);
 
   driver_test().runtime().RunUntil(
       [&]() { return snoop_sent_sco_packets().size() == kNumPackets; });
@@ -918,22 +979,22 @@ TEST_F(BtTransportUartHciTransportProtocolTest, ScoReadableSignalIgnoredUntilFir
   driver_test().RunInEnvironmentTypeContext(
       [](FixtureBasedTestEnvironment& env) { return env.serial_device_.set_writes_paused(false); });
 
+  // A packet indicator should be prepended to each packet.
+  std::vector<uint8_t> expected;
+  for (uint8_t i = 0; i < kNumPackets; i++) {
+    expected.insert(expected.end(), {BtHciPacketIndicator::kHciSco, i});
+  }
+
   // Wait for the readable signal to be processed and the second packet to be received.
   driver_test().runtime().RunUntil([&]() {
     return driver_test().RunInEnvironmentTypeContext<size_t>([](FixtureBasedTestEnvironment& env) {
-      return env.serial_device_.writes().size();
-    }) == kNumPackets;
+      return env.serial_device_.written_bytes().size();
+    }) == expected.size();
   });
 
-  const std::vector<std::vector<uint8_t>> packets =
-      driver_test().RunInEnvironmentTypeContext<const std::vector<std::vector<uint8_t>>>(
-          [](FixtureBasedTestEnvironment& env) { return env.serial_device_.writes(); });
-  ASSERT_EQ(packets.size(), kNumPackets);
-  for (uint8_t i = 0; i < kNumPackets; i++) {
-    // A packet indicator should be prepended.
-    std::vector<uint8_t> expected = {BtHciPacketIndicator::kHciSco, i};
-    EXPECT_EQ(packets[i], expected);
-  }
+  EXPECT_EQ(driver_test().RunInEnvironmentTypeContext<std::vector<uint8_t>>(
+                [](FixtureBasedTestEnvironment& env) { return env.serial_device_.written_bytes(); }),
+            expected);
 
   driver_test().runtime().RunUntil(
       [&]() { return snoop_sent_sco_packets().size() == kNumPackets; });
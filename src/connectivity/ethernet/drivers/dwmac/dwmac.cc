@@ -48,9 +48,12 @@ int DWMacDevice::Thread() {
   zxlogf(INFO, "dwmac: ethmac started");
 
   zx_status_t status;
+  bool rx_pending = false;
 
   while (true) {
-    status = dma_irq_.wait(nullptr);
+    // Frames left in the rx ring after exhausting the poll budget don't raise a new interrupt, so
+    // go back to polling without waiting for one.
+    status = rx_pending ? ZX_OK : dma_irq_.wait(nullptr);
     if (!running_.load()) {
       status = ZX_OK;
       break;
@@ -64,6 +67,7 @@ int DWMacDevice::Thread() {
       network::SharedAutoLock lock(&state_lock_);  // Note: limited scope of autolock
       if (!started_) {
         // Spurious IRQ.
+        rx_pending = false;
         continue;
       }
       stat = mmio_->Read32(DW_MAC_DMA_STATUS);
@@ -74,8 +78,8 @@ int DWMacDevice::Thread() {
         (void)mmio_->Read32(DW_MAC_MAC_LPICONTROL);
       }
 
-      if (stat & DMA_STATUS_RI) {
-        ProcRxBuffer(stat);
+      if ((stat & DMA_STATUS_RI) || rx_pending) {
+        rx_pending = PollRx();
       }
       if (stat & DMA_STATUS_TI) {
         ProcTxBuffer();
@@ -576,9 +580,28 @@ uint32_t DWMacDevice::DmaRxStatus() {
   return mmio_->ReadMasked32(DMA_STATUS_RS_MASK, DW_MAC_DMA_STATUS) >> DMA_STATUS_RS_POS;
 }
 
-void DWMacDevice::ProcRxBuffer(uint32_t int_status) {
+bool DWMacDevice::PollRx() {
+  // Mask the rx interrupt while polling, frames arriving in the meantime are picked up by the
+  // poll instead of raising an interrupt each.
+  mmio_->ClearBits32(DMA_INT_RIE, DW_MAC_DMA_INTENABLE);
+  size_t budget = kRxPollBudget;
+  while (budget > 0) {
+    // Clear the rx status before looking at the ring, so that a frame completed after the last
+    // look raises the interrupt again once it's unmasked.
+    mmio_->Write32(DMA_STATUS_RI, DW_MAC_DMA_STATUS);
+    size_t completed = ProcRxBuffer(budget);
+    if (completed == 0) {
+      break;
+    }
+    budget -= completed;
+  }
+  mmio_->SetBits32(DMA_INT_RIE, DW_MAC_DMA_INTENABLE);
+  return budget == 0;
+}
+
+size_t DWMacDevice::ProcRxBuffer(size_t budget) {
   if (!started_) {
-    return;
+    return 0;
   }
 
   std::lock_guard lock(rx_lock_);
@@ -588,7 +611,8 @@ void DWMacDevice::ProcRxBuffer(uint32_t int_status) {
   __UNINITIALIZED rx_buffer_part_t rx_buffer_parts[kBatchRxBufs];
   __UNINITIALIZED rx_buffer_t rx_buffer[kBatchRxBufs];
   size_t num_rx_completed = 0;
-  while (rx_queued_ > 0) {
+  size_t total_rx_completed = 0;
+  while (rx_queued_ > 0 && total_rx_completed < budget) {
     uint32_t pkt_stat = rx_descriptors_[rx_tail_].txrx_status;
 
     if (pkt_stat & DESC_RXSTS_OWNBYDMA) {
@@ -597,7 +621,7 @@ void DWMacDevice::ProcRxBuffer(uint32_t int_status) {
     size_t fr_len = (pkt_stat & DESC_RXSTS_FRMLENMSK) >> DESC_RXSTS_FRMLENSHFT;
     if (fr_len > kMtu) {
       zxlogf(ERROR, "dwmac: unsupported packet size received");
-      return;
+      break;
     }
 
     auto [id, addr] = rx_in_flight_buffer_ids_[rx_tail_];
@@ -625,6 +649,7 @@ void DWMacDevice::ProcRxBuffer(uint32_t int_status) {
       loop_count_.fetch_add(1, std::memory_order_relaxed);
     }
     num_rx_completed++;
+    total_rx_completed++;
     rx_queued_--;
     if (num_rx_completed == kBatchRxBufs) {
       netdevice_.CompleteRx(rx_buffer, num_rx_completed);
@@ -634,6 +659,7 @@ void DWMacDevice::ProcRxBuffer(uint32_t int_status) {
   if (num_rx_completed != 0) {
     netdevice_.CompleteRx(rx_buffer, num_rx_completed);
   }
+  return total_rx_completed;
 }
 
 void DWMacDevice::ProcTxBuffer() {
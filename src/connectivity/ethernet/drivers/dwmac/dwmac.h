@@ -160,7 +160,11 @@ class DWMacDevice : public ddk::Device<DWMacDevice, ddk::Unbindable, ddk::Suspen
   void DumpRegisters();
   void DumpStatus(uint32_t status);
   void ReleaseBuffers() __TA_REQUIRES(state_lock_);
-  void ProcRxBuffer(uint32_t int_status) __TA_REQUIRES_SHARED(state_lock_);
+  // Completes up to |budget| received frames. Returns the number of frames completed.
+  size_t ProcRxBuffer(size_t budget) __TA_REQUIRES_SHARED(state_lock_);
+  // Polls the rx ring with the rx interrupt masked, until it's empty or |kRxPollBudget| frames
+  // were completed. Returns true if the budget was exhausted and frames may still be pending.
+  bool PollRx() __TA_REQUIRES_SHARED(state_lock_);
   void ProcTxBuffer() __TA_REQUIRES_SHARED(state_lock_);
   uint32_t DmaRxStatus();
 
@@ -172,6 +176,9 @@ class DWMacDevice : public ddk::Device<DWMacDevice, ddk::Unbindable, ddk::Suspen
   // Number each of tx/rx transaction descriptors
   //  2048 buffers = ~24ms of packets
   static constexpr uint32_t kNumDesc = 2048;
+  // Maximum number of frames completed per interrupt before the interrupt thread gets a chance to
+  // service tx completions and link changes.
+  static constexpr size_t kRxPollBudget = 256;
 
   network::SharedLock state_lock_;
   std::mutex tx_lock_;
@@ -212,16 +212,26 @@ class EthernetDevice : public DeviceType,
   }
 
   int IrqThread() {
+    bool rx_pending = false;
     while (1) {
-      zx_status_t status = irq_.wait(nullptr);
-      if (status != ZX_OK) {
-        zxlogf(DEBUG, "rtl8111: irq wait failed: %s", zx_status_get_string(status));
-        break;
+      // Frames left in the rx ring after exhausting the poll budget don't raise a new interrupt,
+      // so go back to polling without waiting for one.
+      bool waited = !rx_pending;
+      if (waited) {
+        zx_status_t status = irq_.wait(nullptr);
+        if (status != ZX_OK) {
+          zxlogf(DEBUG, "rtl8111: irq wait failed: %s", zx_status_get_string(status));
+          break;
+        }
       }
 
       fbl::AutoLock lock(&lock_);
 
+      // Acknowledge the interrupts before handling them, so that events raised while handling them
+      // aren't lost.
       uint16_t isr = mmio_->Read16(RTL_ISR);
+      mmio_->Write16(RTL_ISR, isr);
+
       if (isr & RTL_INT_LINKCHG) {
         bool was_online = online_;
         bool online = mmio_->Read8(RTL_PHYSTATUS) & RTL_PHYSTATUS_LINKSTS;
@@ -236,33 +246,48 @@ class EthernetDevice : public DeviceType,
       if (isr & RTL_INT_TOK) {
         cnd_signal(&tx_cond_);
       }
-      if (isr & RTL_INT_ROK) {
-        eth_desc_t* rxd;
-        while (!((rxd = rxd_ring_ + rxd_idx_)->status1 & RX_DESC_OWN)) {
-          if (ifc_.ops) {
-            size_t len = rxd->status1 & RX_DESC_LEN_MASK;
-            ethernet_ifc_recv(&ifc_, static_cast<uint8_t*>(rxb_) + (rxd_idx_ * ETH_BUF_SIZE), len,
-                              0);
-          } else {
-            zxlogf(ERROR, "rtl8111: No ethmac callback, dropping packet");
-          }
-
-          bool is_end = rxd_idx_ == (ETH_BUF_COUNT - 1);
-          rxd->status1 = RX_DESC_OWN | (is_end ? RX_DESC_EOR : 0) | ETH_BUF_SIZE;
-
-          rxd_idx_ = (rxd_idx_ + 1) % ETH_BUF_COUNT;
+      if ((isr & RTL_INT_ROK) || rx_pending) {
+        bool was_pending = rx_pending;
+        rx_pending = PollRx();
+        // Keep the rx interrupt masked for as long as we're polling.
+        if (rx_pending != was_pending) {
+          uint16_t imr = mmio_->Read16(RTL_IMR);
+          mmio_->Write16(RTL_IMR, rx_pending ? (imr & ~RTL_INT_ROK) : (imr | RTL_INT_ROK));
         }
       }
 
-      mmio_->Write16(RTL_ISR, 0xffff);
-
-      if (irq_mode_ == fuchsia_hardware_pci::InterruptMode::kLegacy) {
+      if (waited && irq_mode_ == fuchsia_hardware_pci::InterruptMode::kLegacy) {
         pci_.AckInterrupt();
       }
     }
     return 0;
   }
 
+  // Delivers up to |kRxPollBudget| received frames, handing their descriptors back to the
+  // hardware once they've all been delivered. Returns true if the budget was exhausted and frames
+  // may still be pending. Must be called with |lock_| held.
+  bool PollRx() {
+    int first_idx = rxd_idx_;
+    int count = 0;
+    while (count < kRxPollBudget && !(rxd_ring_[rxd_idx_].status1 & RX_DESC_OWN)) {
+      if (ifc_.ops) {
+        size_t len = rxd_ring_[rxd_idx_].status1 & RX_DESC_LEN_MASK;
+        ethernet_ifc_recv(&ifc_, static_cast<uint8_t*>(rxb_) + (rxd_idx_ * ETH_BUF_SIZE), len,
+                          0);
+      } else {
+        zxlogf(ERROR, "rtl8111: No ethmac callback, dropping packet");
+      }
+      rxd_idx_ = (rxd_idx_ + 1) % ETH_BUF_COUNT;
+      count++;
+    }
+
+    for (int i = 0, idx = first_idx; i < count; i++, idx = (idx + 1) % ETH_BUF_COUNT) {
+      bool is_end = idx == (ETH_BUF_COUNT - 1);
+      rxd_ring_[idx].status1 = RX_DESC_OWN | (is_end ? RX_DESC_EOR : 0) | ETH_BUF_SIZE;
+    }
+    return count == kRxPollBudget;
+  }
+
   zx_status_t EthernetImplQuery(uint32_t options, ethernet_info_t* info) {
     if (options) {
       return ZX_ERR_INVALID_ARGS;
@@ -383,6 +408,10 @@ class EthernetDevice : public DeviceType,
   int rxd_idx_;
   void* rxb_;
 
+  // Maximum number of frames delivered per interrupt before the interrupt thread releases the
+  // lock and services other interrupts.
+  static constexpr int kRxPollBudget = ETH_BUF_COUNT / 2;
+
   uint8_t mac_[6];
   bool online_;
 
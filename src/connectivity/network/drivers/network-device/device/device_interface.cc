@@ -672,23 +672,47 @@ void DeviceInterface::OpenSession(OpenSessionRequestView request,
       return zx::error(ZX_ERR_INVALID_ARGS);
     }
     zx::vmo& vmo = session_info.data();
+    zx_info_handle_basic_t vmo_info;
+    if (zx_status_t status =
+            vmo.get_info(ZX_INFO_HANDLE_BASIC, &vmo_info, sizeof(vmo_info), nullptr, nullptr);
+        status != ZX_OK) {
+      return zx::error(status);
+    }
     // NB: It's safe to register the VMO after session creation (and thread start) because sessions
     // always start in a paused state, so the tx path can't be running while we hold the control
     // lock.
-    if (vmo_store_.is_full()) {
-      return zx::error(ZX_ERR_NO_RESOURCES);
+    std::optional<uint8_t> shared_vmo_id;
+    for (size_t i = 0; i < data_vmo_registrations_.size(); i++) {
+      const DataVmoRegistration& registration = data_vmo_registrations_[i];
+      if (registration.sessions != 0 && registration.koid == vmo_info.koid) {
+        shared_vmo_id = static_cast<uint8_t>(i);
+        break;
+      }
     }
-    // Duplicate the VMO to share with the device implementation.
+
+    // The device implementation is only given the VMO when it is first registered, sessions
+    // opened with an already registered VMO share its id.
     zx::vmo device_vmo;
-    if (zx_status_t status = vmo.duplicate(ZX_RIGHT_SAME_RIGHTS, &device_vmo); status != ZX_OK) {
-      return zx::error(status);
-    }
+    uint8_t vmo_id;
+    if (shared_vmo_id.has_value()) {
+      vmo_id = shared_vmo_id.value();
+    } else {
+      if (vmo_store_.is_full()) {
+        return zx::error(ZX_ERR_NO_RESOURCES);
+      }
+      // Duplicate the VMO to share with the device implementation.
+      if (zx_status_t status = vmo.duplicate(ZX_RIGHT_SAME_RIGHTS, &device_vmo); status != ZX_OK) {
+        return zx::error(status);
+      }
 
-    zx::result registration = vmo_store_.Register(std::move(vmo));
-    if (registration.is_error()) {
-      return registration.take_error();
+      zx::result registration = vmo_store_.Register(std::move(vmo));
+      if (registration.is_error()) {
+        return registration.take_error();
+      }
+      vmo_id = registration.value();
+      data_vmo_registrations_[vmo_id].koid = vmo_info.koid;
     }
-    const uint8_t vmo_id = registration.value();
+    data_vmo_registrations_[vmo_id].sessions++;
     session->SetDataVmo(vmo_id, vmo_store_.GetVmo(vmo_id));
     session->AssertParentTxLock(*this);
     session->InstallTx();
@@ -718,6 +742,11 @@ void DeviceInterface::OpenSession(OpenSessionRequestView request,
   }
 
   auto [response, vmo_id, device_vmo] = std::move(sync_result.value());
+  if (!device_vmo.is_valid()) {
+    // The session shares a VMO that is already prepared by the device implementation.
+    completer.ReplySuccess(std::move(response.session), std::move(response.fifos));
+    return;
+  }
   fdf::Arena arena('NETD');
   // Use ThenExactlyOnce here to ensure that no matter what the completer is used to respond to the
   // incoming request. This prevents something in the vendor driver from blocking the FIDL request.
@@ -1256,6 +1285,14 @@ void DeviceInterface::OnPortTeardownComplete(DevicePort& port) {
 void DeviceInterface::ReleaseVmo(Session& session, fit::callback<void()>&& on_complete) {
   uint8_t vmo;
   vmo = session.ClearDataVmo();
+  if (vmo < data_vmo_registrations_.size() && data_vmo_registrations_[vmo].sessions > 1) {
+    // Other sessions still use this VMO, keep it registered with the device implementation. The
+    // callback must not be called inline, it acquires the control lock.
+    data_vmo_registrations_[vmo].sessions--;
+    async::PostTask(dispatchers_.impl_->async_dispatcher(),
+                    [on_complete = std::move(on_complete)]() mutable { on_complete(); });
+    return;
+  }
   zx::result result = vmo_store_.Unregister(vmo);
   if (result.is_error()) {
     // Avoid notifying the device implementation if unregistration fails.
@@ -1264,6 +1301,7 @@ void DeviceInterface::ReleaseVmo(Session& session, fit::callback<void()>&& on_co
     LOGF_WARN("%s: Failed to unregister VMO %d: %s", session.name(), vmo, result.status_string());
     return;
   }
+  data_vmo_registrations_[vmo] = {};
 
   fdf::Arena arena('NETD');
   device_impl_.buffer(arena)->ReleaseVmo(vmo).Then(
@@ -266,7 +266,8 @@ class DeviceInterface : public fidl::WireServer<netdev::Device>,
   PendingDeviceOperation SetDeviceStatus(DeviceStatus status) __TA_REQUIRES(control_lock_);
 
   // Notifies the device implementation that the VMO used by the provided session will no longer be
-  // used. It is called right before sessions are destroyed.
+  // used. It is called right before sessions are destroyed. If other sessions still share the VMO,
+  // the registration is kept and |on_complete| is posted to the implementation dispatcher instead.
   // ReleaseVMO acquires the vmos_lock_ internally, so we mark it as excluding the vmos_lock_.
   void ReleaseVmo(Session& session, fit::callback<void()>&& on_complete)
       __TA_REQUIRES(control_lock_);
@@ -331,6 +332,14 @@ class DeviceInterface : public fidl::WireServer<netdev::Device>,
   // We don't need to keep any data associated with the VMO ids, we use the slab to guarantee
   // non-overlapping unique identifiers within a set of valid IDs.
   DataVmoStore vmo_store_ __TA_GUARDED(control_lock_);
+  // Tracks the VMO object registered in each |vmo_store_| slot and how many sessions use it.
+  // Sessions opened with the same data VMO share a single registration with the device
+  // implementation, so the buffers they exchange live at the same VMO id and offsets.
+  struct DataVmoRegistration {
+    zx_koid_t koid = ZX_KOID_INVALID;
+    uint32_t sessions = 0;
+  };
+  std::array<DataVmoRegistration, MAX_VMOS> data_vmo_registrations_ __TA_GUARDED(control_lock_);
   BindingList bindings_ __TA_GUARDED(control_lock_);
   PortWatcher::List port_watchers_ __TA_GUARDED(control_lock_);
 
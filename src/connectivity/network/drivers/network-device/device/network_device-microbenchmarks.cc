@@ -7,6 +7,10 @@
 #include <lib/fdf/cpp/env.h>
 #include <lib/sync/cpp/completion.h>
 
+#include <array>
+#include <memory>
+#include <vector>
+
 #include <perftest/perftest.h>
 
 #include "device_interface.h"
@@ -32,7 +36,9 @@ class FakeDeviceImpl : public ddk::NetworkPortProtocol<FakeDeviceImpl>,
       {.type = static_cast<uint8_t>(netdev::wire::FrameType::kEthernet)},
   };
 
-  FakeDeviceImpl(perftest::RepeatState* state) : perftest_state_(state) {}
+  // If |state| is not null, each batch of buffers the device receives marks the next step of the
+  // test.
+  explicit FakeDeviceImpl(perftest::RepeatState* state) : perftest_state_(state) {}
 
   void NetworkDeviceImplInit(const network_device_ifc_protocol_t* iface,
                              network_device_impl_init_callback callback, void* cookie) {
@@ -72,7 +78,9 @@ class FakeDeviceImpl : public ddk::NetworkPortProtocol<FakeDeviceImpl>,
     // NB: This may be called on a thread different than the test thread. To guarantee this doesn't
     // happen concurrently with other perftest actions, the latency test must make sure that no
     // descriptors belong to the device upon each test iteration.
-    perftest_state_->NextStep();
+    if (perftest_state_) {
+      perftest_state_->NextStep();
+    }
     std::array<tx_result_t, kDepth> result;
     auto iter = result.begin();
     for (auto& buff : cpp20::span(buf_list, buf_count)) {
@@ -89,7 +97,9 @@ class FakeDeviceImpl : public ddk::NetworkPortProtocol<FakeDeviceImpl>,
     // NB: This may be called on a thread different than the test thread. To guarantee this doesn't
     // happen concurrently with other perftest actions, the latency test must make sure that no
     // descriptors belong to the device upon each test iteration.
-    perftest_state_->NextStep();
+    if (perftest_state_) {
+      perftest_state_->NextStep();
+    }
     std::array<rx_buffer_t, kDepth> result;
     std::array<rx_buffer_part_t, kDepth> parts;
     auto result_iter = result.begin();
@@ -188,6 +198,80 @@ class RxTestSession : public BaseTestSession {
   const zx::fifo& test_fifo() override { return rx_fifo(); }
 };
 
+// An in-process network device backed by |FakeDeviceImpl|, with a single port.
+class TestDevice {
+ public:
+  explicit TestDevice(perftest::RepeatState* state) : impl_(state) {
+    zx::result dispatchers = network::OwnedDeviceInterfaceDispatchers::Create();
+    ZX_ASSERT_OK(dispatchers.status_value(), "failed to create dispatchers");
+    dispatchers_ = std::move(dispatchers.value());
+
+    zx::result shim_dispatchers = network::OwnedShimDispatchers::Create();
+    ZX_ASSERT_OK(shim_dispatchers.status_value(), "failed to create shim dispatchers");
+    shim_dispatchers_ = std::move(shim_dispatchers.value());
+
+    std::unique_ptr shim =
+        std::make_unique<network::NetworkDeviceShim>(impl_.client(), shim_dispatchers_->Unowned());
+
+    zx::result device_status =
+        network::internal::DeviceInterface::Create(dispatchers_->Unowned(), std::move(shim));
+    ZX_ASSERT_OK(device_status.status_value(), "failed to create device");
+    device_ = std::move(device_status.value());
+
+    auto device_endpoints = fidl::Endpoints<network::netdev::Device>::Create();
+    ZX_ASSERT_OK(device_->Bind(std::move(device_endpoints.server)), "failed to bind to device");
+    client_ = fidl::WireSyncClient(std::move(device_endpoints.client));
+
+    auto port_endpoints = fidl::Endpoints<network::netdev::Port>::Create();
+    ZX_ASSERT_OK(
+        device_->BindPort(network::FakeDeviceImpl::kPortId, std::move(port_endpoints.server)),
+        "failed to bind port");
+    fidl::WireSyncClient port{(std::move(port_endpoints.client))};
+    fidl::WireResult port_info_result = port->GetInfo();
+    ZX_ASSERT_OK(port_info_result.status(), "failed to get port info");
+    const network::netdev::wire::PortInfo& port_info = port_info_result->info;
+    ZX_ASSERT_MSG(port_info.has_id(), "port id missing");
+    port_id_ = port_info.id();
+  }
+
+  ~TestDevice() {
+    sync_completion_t completion;
+    device_->Teardown([&completion]() { sync_completion_signal(&completion); });
+    zx_status_t status = sync_completion_wait(&completion, zx::duration::infinite().get());
+    ZX_ASSERT_OK(status, "sync_completion_wait(_, _) failed ");
+    dispatchers_->ShutdownSync();
+    shim_dispatchers_->ShutdownSync();
+  }
+
+  // Opens |session| with |buffer_count| descriptors on the device and attaches it to the port.
+  // Descriptor |i| is set up for the port and written to |descriptors[i]|.
+  void OpenSession(BaseTestSession& session, const char* name,
+                   network::netdev::wire::SessionFlags flags, uint16_t buffer_count,
+                   uint16_t* descriptors) {
+    zx_status_t status = session.Open(client_, name, flags, buffer_count);
+    ZX_ASSERT_OK(status, "failed to open session");
+    status = session.AttachPort(port_id_, {network::netdev::wire::FrameType::kEthernet});
+    ZX_ASSERT_OK(status, "failed to attach port");
+    for (uint16_t i = 0; i < buffer_count; i++) {
+      buffer_descriptor_t& descriptor = session.ResetDescriptor(i);
+      // Tx tests need to set the port id here.
+      descriptor.port_id = {
+          .base = port_id_.base,
+          .salt = port_id_.salt,
+      };
+      descriptors[i] = i;
+    }
+  }
+
+ private:
+  network::FakeDeviceImpl impl_;
+  std::unique_ptr<network::OwnedDeviceInterfaceDispatchers> dispatchers_;
+  std::unique_ptr<network::OwnedShimDispatchers> shim_dispatchers_;
+  std::unique_ptr<network::internal::DeviceInterface> device_;
+  fidl::WireSyncClient<network::netdev::Device> client_;
+  network::netdev::wire::PortId port_id_;
+};
+
 // LatencyTest measures the round trip latency between a client and a device using an in-process
 // fake network device.
 //
@@ -207,59 +291,18 @@ bool LatencyTest(perftest::RepeatState* state, const uint16_t buffer_count) {
                 "can't measure latency with more buffers (%d) than device depth (%d)", buffer_count,
                 network::FakeDeviceImpl::kDepth);
 
-  zx::result dispatchers = network::OwnedDeviceInterfaceDispatchers::Create();
-  ZX_ASSERT_OK(dispatchers.status_value(), "failed to create dispatchers");
-
-  zx::result shim_dispatchers = network::OwnedShimDispatchers::Create();
-  ZX_ASSERT_OK(shim_dispatchers.status_value(), "failed to create shim dispatchers");
-
-  network::FakeDeviceImpl impl(state);
-
-  std::unique_ptr shim =
-      std::make_unique<network::NetworkDeviceShim>(impl.client(), shim_dispatchers->Unowned());
-
-  zx::result device_status =
-      network::internal::DeviceInterface::Create(dispatchers->Unowned(), std::move(shim));
-  ZX_ASSERT_OK(device_status.status_value(), "failed to create device");
-  std::unique_ptr device = std::move(device_status.value());
-
-  auto device_endpoints = fidl::Endpoints<network::netdev::Device>::Create();
-  ZX_ASSERT_OK(device->Bind(std::move(device_endpoints.server)), "failed to bind to device");
-
-  auto port_endpoints = fidl::Endpoints<network::netdev::Port>::Create();
-  ZX_ASSERT_OK(device->BindPort(network::FakeDeviceImpl::kPortId, std::move(port_endpoints.server)),
-               "failed to bind port");
-  fidl::WireSyncClient port{(std::move(port_endpoints.client))};
-  fidl::WireResult port_info_result = port->GetInfo();
-  ZX_ASSERT_OK(port_info_result.status(), "failed to get port info");
-  const network::netdev::wire::PortInfo& port_info = port_info_result->info;
-  ZX_ASSERT_MSG(port_info.has_id(), "port id missing");
-  const network::netdev::wire::PortId& port_id = port_info.id();
-
+  TestDevice device(state);
   Session session;
-  fidl::WireSyncClient client{std::move(device_endpoints.client)};
-  zx_status_t status =
-      session.Open(client, "session", network::netdev::wire::SessionFlags::kPrimary, buffer_count);
-  ZX_ASSERT_OK(status, "failed to open session");
-  status = session.AttachPort(port_id, {network::netdev::wire::FrameType::kEthernet});
-  ZX_ASSERT_OK(status, "failed to attach port");
-
   std::array<uint16_t, network::FakeDeviceImpl::kDepth> write_descriptors, returned_descriptors;
-  for (uint16_t i = 0; i < buffer_count; i++) {
-    buffer_descriptor_t& descriptor = session.ResetDescriptor(i);
-    // Tx tests need to set the port id here.
-    descriptor.port_id = {
-        .base = port_id.base,
-        .salt = port_id.salt,
-    };
-    write_descriptors[i] = i;
-  }
+  device.OpenSession(session, "session", network::netdev::wire::SessionFlags::kPrimary,
+                     buffer_count, write_descriptors.data());
 
   state->DeclareStep("outbound");
   state->DeclareStep("return");
   while (state->KeepRunning()) {
     size_t actual;
-    status = session.SendDescriptors(&*write_descriptors.begin(), buffer_count, &actual);
+    zx_status_t status =
+        session.SendDescriptors(&*write_descriptors.begin(), buffer_count, &actual);
     ZX_ASSERT_OK(status, "failed to send descriptors");
     ZX_ASSERT_MSG(actual == buffer_count, "partial FIFO write %ld/%d", actual, buffer_count);
 
@@ -272,13 +315,56 @@ bool LatencyTest(perftest::RepeatState* state, const uint16_t buffer_count) {
     ZX_ASSERT_MSG(actual == buffer_count, "unexpected partial FIFO batch read %ld/%d", actual,
                   buffer_count);
   }
+  return true;
+}
+
+// MultiSessionTxTest measures tx throughput when several sessions share a device. Each iteration
+// has every session send |kMultiSessionBatch| buffers, and completes once all of them have been
+// returned. Throughput in packets per second is the number of sessions times the batch size
+// divided by the time per iteration.
+constexpr uint16_t kMultiSessionBatch = 16;
+
+bool MultiSessionTxTest(perftest::RepeatState* state, const uint16_t session_count) {
+  ZX_ASSERT_MSG(session_count * kMultiSessionBatch <= network::FakeDeviceImpl::kDepth,
+                "can't have more buffers in flight (%d) than device depth (%d)",
+                session_count * kMultiSessionBatch, network::FakeDeviceImpl::kDepth);
+
+  TestDevice device(nullptr);
+  std::vector<std::unique_ptr<TxTestSession>> sessions;
+  std::array<uint16_t, kMultiSessionBatch> write_descriptors, returned_descriptors;
+  for (uint16_t i = 0; i < session_count; i++) {
+    auto& session = sessions.emplace_back(std::make_unique<TxTestSession>());
+    device.OpenSession(*session, fxl::StringPrintf("session-%d", i).c_str(),
+                       i == 0 ? network::netdev::wire::SessionFlags::kPrimary
+                              : network::netdev::wire::SessionFlags(),
+                       kMultiSessionBatch, write_descriptors.data());
+  }
 
-  sync_completion_t completion;
-  device->Teardown([&completion]() { sync_completion_signal(&completion); });
-  status = sync_completion_wait(&completion, zx::duration::infinite().get());
-  ZX_ASSERT_OK(status, "sync_completion_wait(_, _) failed ");
-  dispatchers->ShutdownSync();
-  shim_dispatchers->ShutdownSync();
+  while (state->KeepRunning()) {
+    for (auto& session : sessions) {
+      size_t actual;
+      zx_status_t status =
+          session->SendDescriptors(write_descriptors.data(), kMultiSessionBatch, &actual);
+      ZX_ASSERT_OK(status, "failed to send descriptors");
+      ZX_ASSERT_MSG(actual == kMultiSessionBatch, "partial FIFO write %ld/%d", actual,
+                    kMultiSessionBatch);
+    }
+    // Wait for every buffer to be returned, so the device isn't doing any work in its background
+    // threads between iterations.
+    for (auto& session : sessions) {
+      size_t returned = 0;
+      while (returned < kMultiSessionBatch) {
+        zx_status_t status =
+            session->test_fifo().wait_one(ZX_FIFO_READABLE, zx::time::infinite(), nullptr);
+        ZX_ASSERT_OK(status, "wait FIFO readable");
+        size_t actual;
+        status = session->FetchDescriptors(returned_descriptors.data(),
+                                           kMultiSessionBatch - returned, &actual);
+        ZX_ASSERT_OK(status, "failed to fetch descriptors");
+        returned += actual;
+      }
+    }
+  }
   return true;
 }
 
@@ -290,6 +376,11 @@ void RegisterTests() {
     perftest::RegisterTest(fxl::StringPrintf("Latency/Tx/%d", batch_size).c_str(),
                            LatencyTest<TxTestSession>, batch_size);
   }
+  constexpr uint16_t kSessionCounts[] = {1, 2, 4, 8};
+  for (auto& session_count : kSessionCounts) {
+    perftest::RegisterTest(fxl::StringPrintf("MultiSession/Tx/%d", session_count).c_str(),
+                           MultiSessionTxTest, session_count);
+  }
 }
 PERFTEST_CTOR(RegisterTests)
 
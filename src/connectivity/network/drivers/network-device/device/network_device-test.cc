@@ -9,6 +9,7 @@
 #include <lib/sync/cpp/completion.h>
 #include <lib/syslog/global.h>
 
+#include <algorithm>
 #include <future>
 #include <iomanip>
 
@@ -936,6 +937,55 @@ TEST_F(NetworkDeviceTest, TwoSessionsRx) {
   }
 }
 
+TEST_F(NetworkDeviceTest, SessionsShareDataVmo) {
+  ASSERT_OK(CreateDeviceWithPort13());
+  TestSession session_a;
+  ASSERT_OK(OpenSession(&session_a));
+
+  // Open a second session with a handle to the same data VMO.
+  TestSession session_b;
+  ASSERT_OK(session_b.Init(kDefaultDescriptorCount, kDefaultBufferLength));
+  zx::result info = session_b.GetInfo(netdev::wire::SessionFlags::kPrimary);
+  ASSERT_OK(info.status_value());
+  ASSERT_OK(session_a.data_vmo().duplicate(ZX_RIGHT_SAME_RIGHTS, &info->data()));
+  fidl::WireSyncClient connection = OpenConnection();
+  fidl::WireResult result =
+      connection->OpenSession(fidl::StringView::FromExternal("test_session_b"), info.value());
+  ASSERT_OK(result.status());
+  ASSERT_TRUE(result->is_ok()) << zx_status_get_string(result->error_value());
+  session_b.Setup(std::move(result->value()->session), std::move(result->value()->fifos));
+
+  auto prepared_vmos = [this]() {
+    cpp20::span vmos = impl_.vmos();
+    return std::count_if(vmos.begin(), vmos.end(),
+                         [](const zx::vmo& vmo) { return vmo.is_valid(); });
+  };
+  // Both sessions use a single registration with the device implementation.
+  ASSERT_EQ(prepared_vmos(), 1);
+  ASSERT_OK(AttachSessionPort(session_a, port13_));
+  ASSERT_OK(WaitSessionStarted());
+  ASSERT_OK(AttachSessionPort(session_b, port13_));
+  ASSERT_OK(WaitSessionStarted());
+  session_a.ResetDescriptor(kDescriptorIndex0);
+  ASSERT_OK(session_a.SendRx(kDescriptorIndex0));
+  ASSERT_OK(WaitRxAvailable());
+  std::unique_ptr rx_buff = impl_.PopRxBuffer();
+  ASSERT_EQ(rx_buff->space().region.vmo, impl_.first_vmo_id().value());
+
+  // Closing one of the sessions keeps the VMO prepared for the other.
+  ASSERT_OK(session_b.Close());
+  ASSERT_OK(session_b.WaitClosed(TEST_DEADLINE));
+  ASSERT_EQ(prepared_vmos(), 1);
+
+  RxFidlReturnTransaction rx_transaction(&impl_);
+  rx_transaction.Enqueue(std::move(rx_buff), kPort13);
+  rx_transaction.Commit();
+  ASSERT_OK(session_a.Close());
+  ASSERT_OK(session_a.WaitClosed(TEST_DEADLINE));
+  impl_.WaitReleased();
+  ASSERT_EQ(prepared_vmos(), 0);
+}
+
 TEST_F(NetworkDeviceTest, ListenSession) {
   ASSERT_OK(CreateDeviceWithPort13());
   fidl::WireSyncClient connection = OpenConnection();
@@ -3667,6 +3717,30 @@ TEST_F(NetworkDeviceShimTest, TeardownFromOtherDispatcher) {
   teardown_complete.Wait();
 }
 
+TEST_F(NetworkDeviceShimTest, GetInfoForwardsAccelerations) {
+  // Verify that the tx and rx acceleration lists are translated independently of each other.
+  constexpr uint8_t kTxAccel[] = {0};
+  constexpr uint8_t kRxAccel[] = {1, 2};
+  device_impl_info_t& info = banjo_impl_.info();
+  info.tx_accel_list = kTxAccel;
+  info.tx_accel_count = std::size(kTxAccel);
+  info.rx_accel_list = kRxAccel;
+  info.rx_accel_count = std::size(kRxAccel);
+
+  fdf::Arena arena('NETD');
+  auto result = fidl_impl_.buffer(arena)->GetInfo();
+  ASSERT_OK(result.status());
+  const netdriver::wire::DeviceImplInfo& fidl_info = result->info;
+  ASSERT_TRUE(fidl_info.has_tx_accel());
+  ASSERT_EQ(fidl_info.tx_accel().count(), std::size(kTxAccel));
+  EXPECT_EQ(static_cast<uint8_t>(fidl_info.tx_accel()[0]), kTxAccel[0]);
+  ASSERT_TRUE(fidl_info.has_rx_accel());
+  ASSERT_EQ(fidl_info.rx_accel().count(), std::size(kRxAccel));
+  for (size_t i = 0; i < std::size(kRxAccel); ++i) {
+    EXPECT_EQ(static_cast<uint8_t>(fidl_info.rx_accel()[i]), kRxAccel[i]);
+  }
+}
+
 TEST_F(NetworkDeviceShimTest, AddPort) {
   // Verify that AddPort works and manages the lifetime of the NetworkPortShim object correctly.
   ASSERT_OK(InitImpl());
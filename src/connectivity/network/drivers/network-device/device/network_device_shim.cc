@@ -161,7 +161,7 @@ void NetworkDeviceShim::GetInfo(fdf::Arena& arena, GetInfoCompleter::Sync& compl
       fidl::VectorView<netdev::wire::TxAcceleration>::FromExternal(tx_accel);
 
   std::vector<netdev::wire::RxAcceleration> rx_accel;
-  std::transform(info.rx_accel_list, info.rx_accel_list + info.tx_accel_count,
+  std::transform(info.rx_accel_list, info.rx_accel_list + info.rx_accel_count,
                  std::back_inserter(rx_accel),
                  [](const auto& accel) { return netdev::wire::RxAcceleration(accel); });
   fidl::VectorView rx_accel_view =
@@ -70,6 +70,7 @@ class TestSession {
 
   uint64_t canonical_offset(uint16_t index) const { return buffer_length_ * index; }
 
+  const zx::vmo& data_vmo() const { return data_vmo_; }
   const zx::fifo& tx_fifo() const { return fifos_.tx; }
   const zx::fifo& rx_fifo() const { return fifos_.rx; }
   const zx::channel& channel() const { return session_.client_end().channel(); }
@@ -11,6 +11,10 @@
 #include <zircon/errors.h>
 #include <zircon/types.h>
 
+#include <array>
+#include <optional>
+#include <utility>
+
 #include "device_interface.h"
 #include "fbl/auto_lock.h"
 #include "lib/fit/defer.h"
@@ -56,19 +60,13 @@ zx_status_t TxQueue::EnqueueUserPacket(uint64_t key) {
   return port_.queue(&packet);
 }
 
-void TxQueue::SessionTransaction::Commit() {
-  // when we destroy a session transaction, we commit all the queued buffers to
-  // the device.
-  if (queued_ != 0) {
-    // Send buffers in batches of at most |MAX_TX_BUFFERS| at a time to stay within the FIDL
-    // channel maximum.
-    netdriver::wire::TxBuffer* buffers = buffers_.data();
-    while (queued_ > 0) {
-      const uint32_t batch = std::min(static_cast<uint32_t>(queued_), MAX_TX_BUFFERS);
-      queue_->parent_->QueueTx(cpp20::span(buffers, batch));
-      buffers += batch;
-      queued_ -= batch;
-    }
+void TxQueue::QueueTx(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers) {
+  // Send buffers in batches of at most |MAX_TX_BUFFERS| at a time to stay within the FIDL
+  // channel maximum.
+  while (!buffers.empty()) {
+    const size_t batch = std::min(buffers.size(), static_cast<size_t>(MAX_TX_BUFFERS));
+    parent_->QueueTx(buffers.subspan(0, batch));
+    buffers = buffers.subspan(batch);
   }
 }
 
@@ -180,10 +178,13 @@ zx::result<std::unique_ptr<TxQueue>> TxQueue::Create(DeviceInterface* parent) {
 }
 
 void TxQueue::Thread(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers) {
+  std::array<FifoSignal, kMaxFifoSignalBatch> signals;
+  std::optional<zx_port_packet_t> pending;
   for (;;) {
     zx_port_packet_t packet;
-    zx_status_t status = port_.wait(zx::time::infinite(), &packet);
-    if (status != ZX_OK) {
+    if (pending.has_value()) {
+      packet = *std::exchange(pending, std::nullopt);
+    } else if (zx_status_t status = port_.wait(zx::time::infinite(), &packet); status != ZX_OK) {
       LOGF_ERROR("tx thread port wait failed: %s", zx_status_get_string(status));
       return;
     }
@@ -202,13 +203,30 @@ void TxQueue::Thread(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer
             ZX_PANIC("unexpected user packet key %ld", packet.key);
         }
         break;
-      case ZX_PKT_TYPE_SIGNAL_ONE:
-        if (zx_status_t status = HandleFifoSignal(buffers, packet.key, packet.signal.observed);
+      case ZX_PKT_TYPE_SIGNAL_ONE: {
+        // Collect the signals of any other sessions that are already pending so that they're all
+        // served with one acquisition of the tx lock and one batch of buffers to the device. Any
+        // other packet is handled after the batch, preserving its order relative to the signals.
+        size_t count = 0;
+        signals[count++] = {.session = packet.key, .signals = packet.signal.observed};
+        while (count < signals.size()) {
+          zx_port_packet_t next;
+          if (port_.wait(zx::time::infinite_past(), &next) != ZX_OK) {
+            break;
+          }
+          if (next.type != ZX_PKT_TYPE_SIGNAL_ONE) {
+            pending = next;
+            break;
+          }
+          signals[count++] = {.session = next.key, .signals = next.signal.observed};
+        }
+        if (zx_status_t status = HandleFifoSignals(buffers, cpp20::span(signals.data(), count));
             status != ZX_OK) {
           LOGF_ERROR("failed to handle FIFO signal: %s", zx_status_get_string(status));
           return;
         }
         break;
+      }
       default:
         ZX_PANIC("unexpected packet type %d", packet.type);
     }
@@ -255,11 +273,34 @@ zx_status_t TxQueue::UpdateFifoWatches() {
   return ZX_OK;
 }
 
-zx_status_t TxQueue::HandleFifoSignal(
-    cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers, SessionKey key,
-    zx_signals_t signals) {
+zx_status_t TxQueue::HandleFifoSignals(
+    cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers,
+    cpp20::span<const FifoSignal> signals) {
   fbl::AutoLock lock(&parent_->tx_lock());
-  SessionWaiter* find_session = sessions_.Get(key);
+  size_t queued = 0;
+
+  // TA really doesn't like defers or its interplay with AutoLock.
+  auto defer = fit::defer([this, &buffers, &queued, &lock]() __TA_NO_THREAD_SAFETY_ANALYSIS {
+    // Committing the buffers must not be holding any locks, because we call into the device.
+    lock.release();
+    QueueTx(buffers.subspan(0, queued));
+  });
+
+  for (const FifoSignal& signal : signals) {
+    uint32_t session_queued = 0;
+    zx_status_t status = HandleFifoSignal(buffers.subspan(queued), signal, &session_queued);
+    queued += session_queued;
+    if (status != ZX_OK) {
+      return status;
+    }
+  }
+  return ZX_OK;
+}
+
+zx_status_t TxQueue::HandleFifoSignal(
+    cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers, const FifoSignal& signal,
+    uint32_t* queued) {
+  SessionWaiter* find_session = sessions_.Get(signal.session);
   // Session already removed from Tx queue, packet was lingering in the port.
   if (find_session == nullptr) {
     return ZX_OK;
@@ -270,16 +311,9 @@ zx_status_t TxQueue::HandleFifoSignal(
   Session& session = *waiter.session;
   const zx::fifo& fifo = session.tx_fifo();
   SessionTransaction transaction(buffers, this, &session);
+  auto defer = fit::defer([&transaction, queued]() { *queued = transaction.queued(); });
 
-  // TA really doesn't like defers or its interplay with AutoLock.
-  auto defer = fit::defer([&transaction, &lock]() __TA_NO_THREAD_SAFETY_ANALYSIS {
-    // Committing the transaction must not be holding any locks, because we call
-    // into the device.
-    lock.release();
-    transaction.Commit();
-  });
-
-  if (signals & ZX_FIFO_READABLE) {
+  if (signal.signals & ZX_FIFO_READABLE) {
     session.AssertParentTxLock(*parent_);
     zx_status_t status = session.FetchTx(transaction);
     switch (status) {
@@ -300,12 +334,13 @@ zx_status_t TxQueue::HandleFifoSignal(
     }
   }
 
-  if (signals & ZX_FIFO_PEER_CLOSED) {
+  if (signal.signals & ZX_FIFO_PEER_CLOSED) {
     // FIFO is closed, don't reinstall the wait.
     return ZX_OK;
   }
 
-  if (zx_status_t status = fifo.wait_async(port_, key, ZX_FIFO_PEER_CLOSED | ZX_FIFO_READABLE, 0);
+  if (zx_status_t status =
+          fifo.wait_async(port_, signal.session, ZX_FIFO_PEER_CLOSED | ZX_FIFO_READABLE, 0);
       status != ZX_OK) {
     LOGF_ERROR("failed to start FIFO wait for session %s: %s", session.name(),
                zx_status_get_string(status));
@@ -56,9 +56,11 @@ class TxQueue {
    public:
     SessionTransaction(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers,
                        TxQueue* parent, Session* session) __TA_REQUIRES(parent->parent_->tx_lock());
-    void Commit() __TA_EXCLUDES(queue_->parent_->tx_lock());
 
     uint32_t available() const { return available_; }
+    // The number of buffers pushed into the front of |buffers|, which the caller must send to the
+    // device once the tx lock is released.
+    uint32_t queued() const { return queued_; }
     bool overrun() const { return available_ == 0; }
     fuchsia_hardware_network_driver::wire::TxBuffer* GetBuffer();
     void Push(uint16_t descriptor) __TA_REQUIRES(queue_->parent_->tx_lock());
@@ -90,8 +92,27 @@ class TxQueue {
   zx_status_t EnqueueUserPacket(uint64_t key);
   zx_status_t UpdateFifoWatches();
 
+  // A FIFO signal packet observed on |port_|.
+  struct FifoSignal {
+    SessionKey session;
+    zx_signals_t signals;
+  };
+  // The maximum number of FIFO signals handled in one batch.
+  static constexpr size_t kMaxFifoSignalBatch = 16;
+
+  // Fetches tx buffers from every session in |signals| under a single acquisition of the tx lock,
+  // and sends all of them to the device together once the lock is released.
+  zx_status_t HandleFifoSignals(
+      cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers,
+      cpp20::span<const FifoSignal> signals);
+  // Fetches tx buffers from a single session into |buffers|, re-arming the wait on its FIFO as
+  // needed. Returns the number of buffers queued in |queued|.
   zx_status_t HandleFifoSignal(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers,
-                               SessionKey session, zx_signals_t signals);
+                               const FifoSignal& signal, uint32_t* queued)
+      __TA_REQUIRES(parent_->tx_lock());
+  // Sends |buffers| to the device, in batches that fit the FIDL channel maximum.
+  void QueueTx(cpp20::span<fuchsia_hardware_network_driver::wire::TxBuffer> buffers)
+      __TA_EXCLUDES(parent_->tx_lock());
 
   struct InFlightBuffer {
     InFlightBuffer() = default;
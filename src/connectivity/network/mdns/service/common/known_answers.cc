@@ -0,0 +1,41 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/connectivity/network/mdns/service/common/known_answers.h"
+
+#include <lib/syslog/cpp/macros.h>
+
+namespace mdns {
+
+void KnownAnswers::Add(std::shared_ptr<DnsResource> resource) {
+  FX_DCHECK(resource);
+  resources_by_name_[resource->name_.dotted_string_].push_back(std::move(resource));
+}
+
+bool KnownAnswers::Suppresses(const DnsResource& answer) const {
+  auto iter = resources_by_name_.find(answer.name_.dotted_string_);
+  if (iter == resources_by_name_.end()) {
+    return false;
+  }
+
+  for (const auto& known : iter->second) {
+    if (known->type_ != answer.type_ || known->class_ != answer.class_ ||
+        known->time_to_live_ < answer.time_to_live_ / 2) {
+      continue;
+    }
+
+    // |DnsResource::operator==| also compares the TTL and cache flush bit, which aren't part of
+    // the resource data.
+    DnsResource known_data(*known);
+    known_data.time_to_live_ = answer.time_to_live_;
+    known_data.cache_flush_ = answer.cache_flush_;
+    if (known_data == answer) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace mdns
@@ -0,0 +1,43 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_CONNECTIVITY_NETWORK_MDNS_SERVICE_COMMON_KNOWN_ANSWERS_H_
+#define SRC_CONNECTIVITY_NETWORK_MDNS_SERVICE_COMMON_KNOWN_ANSWERS_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/connectivity/network/mdns/service/encoding/dns_message.h"
+
+namespace mdns {
+
+// The known-answer list of an inbound query, indexed by name. Used to implement known-answer
+// suppression as described in RFC 6762 section 7.1: a responder must not answer a query with a
+// resource that is already listed in the query's answer section with a TTL of at least half the
+// correct value.
+class KnownAnswers {
+ public:
+  KnownAnswers() = default;
+
+  // Adds |resource| to the known-answer list.
+  void Add(std::shared_ptr<DnsResource> resource);
+
+  // Returns true if |answer| is listed with the same data and a TTL of at least half that of
+  // |answer|, meaning the querier already knows it.
+  bool Suppresses(const DnsResource& answer) const;
+
+  // Removes all known answers.
+  void Clear() { resources_by_name_.clear(); }
+
+  bool empty() const { return resources_by_name_.empty(); }
+
+ private:
+  std::unordered_map<std::string, std::vector<std::shared_ptr<DnsResource>>> resources_by_name_;
+};
+
+}  // namespace mdns
+
+#endif  // SRC_CONNECTIVITY_NETWORK_MDNS_SERVICE_COMMON_KNOWN_ANSWERS_H_
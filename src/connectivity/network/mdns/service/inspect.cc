@@ -12,6 +12,9 @@ namespace mdns {
 constexpr std::string_view kNode_Time = "@time";
 constexpr std::string_view kNode_MdnsStatus = "mdns_status";
 constexpr std::string_view kNode_MdnsStatus_State = "state";
+constexpr std::string_view kNode_KnownAnswerSuppression = "known_answer_suppression";
+constexpr std::string_view kNode_KnownAnswerSuppression_Answers = "answers";
+constexpr std::string_view kNode_KnownAnswerSuppression_Messages = "messages";
 
 constexpr int kMaxMdnsStatusEntries = 10;
 
@@ -30,12 +33,17 @@ MdnsInspector& MdnsInspector::GetMdnsInspector() {
 MdnsInspector::MdnsInspector(async_dispatcher_t* dispatcher)
     : inspector_(
           std::make_unique<inspect::ComponentInspector>(dispatcher, inspect::PublishOptions{})),
-      mdns_status_(inspector_->root()) {}
+      mdns_status_(inspector_->root()),
+      known_answer_suppression_(inspector_->root()) {}
 
 void MdnsInspector::NotifyStateChange(const MdnsState& new_state) {
   mdns_status_.RecordStateChange(new_state);
 }
 
+void MdnsInspector::NotifyKnownAnswerSuppression(uint64_t answer_count, bool message_suppressed) {
+  known_answer_suppression_.RecordSuppression(answer_count, message_suppressed);
+}
+
 MdnsInspector::MdnsStatusNode::MdnsStatusEntry::MdnsStatusEntry(
     inspect::Node& parent_node, const MdnsCurrentStatus& current_status)
     : mdns_status_entry_node_(parent_node.CreateChild(parent_node.UniqueName(""))) {
@@ -64,4 +72,17 @@ void MdnsInspector::MdnsStatusNode::RecordStateChange(const MdnsInspector::MdnsS
   LogCurrentStatus();
 }
 
+MdnsInspector::KnownAnswerSuppressionNode::KnownAnswerSuppressionNode(inspect::Node& parent_node)
+    : node_(parent_node.CreateChild(kNode_KnownAnswerSuppression)),
+      answers_property_(node_.CreateUint(kNode_KnownAnswerSuppression_Answers, 0)),
+      messages_property_(node_.CreateUint(kNode_KnownAnswerSuppression_Messages, 0)) {}
+
+void MdnsInspector::KnownAnswerSuppressionNode::RecordSuppression(uint64_t answer_count,
+                                                                  bool message_suppressed) {
+  answers_property_.Add(answer_count);
+  if (message_suppressed) {
+    messages_property_.Add(1);
+  }
+}
+
 }  // namespace mdns
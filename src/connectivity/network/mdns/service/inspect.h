@@ -44,6 +44,10 @@ class MdnsInspectorTest;
 //         ..
 //         ..
 //       },
+//       "known_answer_suppression": {
+//         "answers": 12,
+//         "messages": 3,
+//       },
 //   }
 
 class MdnsInspector final {
@@ -63,6 +67,11 @@ class MdnsInspector final {
   // This will add a new entry with all current statuses to mdns_status node.
   void NotifyStateChange(const MdnsState& new_state);
 
+  // Function to be called when |answer_count| answers are omitted from an outbound message
+  // because the querier already knows them. |message_suppressed| indicates that the message was
+  // not sent at all as a result.
+  void NotifyKnownAnswerSuppression(uint64_t answer_count, bool message_suppressed);
+
   friend class testing::MdnsInspectorTest;
 
  private:
@@ -104,8 +113,22 @@ class MdnsInspector final {
     MdnsCurrentStatus current_status_;
   };
 
+  // Counts sends avoided by known-answer suppression.
+  class KnownAnswerSuppressionNode {
+   public:
+    explicit KnownAnswerSuppressionNode(inspect::Node& parent_node);
+
+    void RecordSuppression(uint64_t answer_count, bool message_suppressed);
+
+   private:
+    inspect::Node node_;
+    inspect::UintProperty answers_property_;
+    inspect::UintProperty messages_property_;
+  };
+
   std::unique_ptr<inspect::ComponentInspector> inspector_;
   MdnsStatusNode mdns_status_;
+  KnownAnswerSuppressionNode known_answer_suppression_;
 };
 
 }  // namespace mdns
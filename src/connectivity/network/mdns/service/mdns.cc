@@ -103,6 +103,13 @@ void Mdns::Start(fuchsia::net::interfaces::WatcherPtr interfaces_watcher,
         // to |FlushSentItems| in the interim.
         defer_flush_ = true;
 
+        // Answers in a query are the querier's known answers, which we don't need to send back.
+        if (!message->questions_.empty()) {
+          for (const auto& resource : message->answers_) {
+            known_answers_.Add(resource);
+          }
+        }
+
         for (const auto& question : message->questions_) {
           // We reply to questions using unicast if specifically requested in
           // the question or if the sender's port isn't 5353.
@@ -136,6 +143,7 @@ void Mdns::Start(fuchsia::net::interfaces::WatcherPtr interfaces_watcher,
         defer_flush_ = false;
 
         SendMessages();
+        known_answers_.Clear();
       },
       MdnsInterfaceTransceiver::Create);
 
@@ -644,6 +652,9 @@ void Mdns::SendMessages() {
   for (const auto& [reply_address, builder] : outbound_message_builders_by_reply_address_) {
     DnsMessage message;
     builder.Build(message);
+    if (!known_answers_.empty() && !SuppressKnownAnswers(message)) {
+      continue;
+    }
 
 #ifdef MDNS_TRACE
     if (verbose_) {
@@ -687,6 +698,28 @@ void Mdns::SendMessages() {
   outbound_message_builders_by_reply_address_.clear();
 }
 
+bool Mdns::SuppressKnownAnswers(DnsMessage& message) {
+  if (message.answers_.empty()) {
+    return true;
+  }
+
+  size_t suppressed = std::erase_if(message.answers_, [this](const auto& answer) {
+    // The address placeholder is replaced with actual addresses per interface, so it can't be
+    // matched against known answers here.
+    return answer != address_placeholder_ && known_answers_.Suppresses(*answer);
+  });
+  if (suppressed == 0) {
+    return true;
+  }
+
+  // Without answers, the remaining records only support answers the querier already has.
+  bool send = !message.answers_.empty() || !message.questions_.empty() ||
+              !message.authorities_.empty();
+  MdnsInspector::GetMdnsInspector().NotifyKnownAnswerSuppression(suppressed, !send);
+  message.UpdateCounts();
+  return send;
+}
+
 void Mdns::ReceiveQuestion(const DnsQuestion& question, const ReplyAddress& reply_address,
                            const ReplyAddress& sender_address) {
   // |reply_address| should never be the V6 multicast address, because the V4 multicast address
@@ -21,6 +21,7 @@
 #include "src/connectivity/network/mdns/service/agents/address_prober.h"
 #include "src/connectivity/network/mdns/service/agents/address_responder.h"
 #include "src/connectivity/network/mdns/service/agents/mdns_agent.h"
+#include "src/connectivity/network/mdns/service/common/known_answers.h"
 #include "src/connectivity/network/mdns/service/common/service_instance.h"
 #include "src/connectivity/network/mdns/service/encoding/dns_message.h"
 #include "src/connectivity/network/mdns/service/transport/mdns_interface_transceiver.h"
@@ -508,9 +509,13 @@ class Mdns : public MdnsAgent::Owner {
   void AddAgent(std::shared_ptr<MdnsAgent> agent);
 
   // Sends any messages found in |outbound_messages_by_reply_address_| and
-  // clears |outbound_messages_by_reply_address_|.
+  // clears |outbound_messages_by_reply_address_|. Answers listed in |known_answers_| are omitted.
   void SendMessages();
 
+  // Removes answers from |message| that are listed in |known_answers_|. Returns false if nothing
+  // is left worth sending.
+  bool SuppressKnownAnswers(DnsMessage& message);
+
   // Distributes questions to all the agents except the resource renewer.
   void ReceiveQuestion(const DnsQuestion& question, const ReplyAddress& reply_address,
                        const ReplyAddress& sender_address);
@@ -547,6 +552,8 @@ class Mdns : public MdnsAgent::Owner {
   std::unordered_map<std::string, std::shared_ptr<AddressResponder>>
       address_responders_by_host_full_name_;
   std::shared_ptr<DnsResource> address_placeholder_;
+  // Known answers of the inbound query currently being processed.
+  KnownAnswers known_answers_;
 #ifdef MDNS_TRACE
   // Because |verbose_| defaults to true, traffic will be logged as long as the
   // enable_mdns_trace gn arg is set to true. This is preferred, as there is no
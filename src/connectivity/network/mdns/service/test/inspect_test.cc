@@ -15,6 +15,9 @@ namespace mdns::testing {
 constexpr std::string kNode_Time = "@time";
 constexpr std::string kNode_MdnsStatus = "mdns_status";
 constexpr std::string kNode_MdnsStatus_State = "state";
+constexpr std::string kNode_KnownAnswerSuppression = "known_answer_suppression";
+constexpr std::string kNode_KnownAnswerSuppression_Answers = "answers";
+constexpr std::string kNode_KnownAnswerSuppression_Messages = "messages";
 
 class MdnsInspectorTest : public ::gtest::RealLoopFixture {
  public:
@@ -77,4 +80,28 @@ TEST_F(MdnsInspectorTest, NotifyMdnsStatusChanges) {
   ValidateMdnsStatusEntryNode(mdns_status_node_1, status);
 }
 
+TEST_F(MdnsInspectorTest, NotifyKnownAnswerSuppression) {
+  auto& mdns_inspector = GetTestMdnsInspector();
+
+  mdns_inspector.NotifyKnownAnswerSuppression(2, false);
+  mdns_inspector.NotifyKnownAnswerSuppression(1, true);
+
+  fpromise::result<inspect::Hierarchy> hierarchy =
+      RunPromise(inspect::ReadFromInspector(*GetInspector()));
+  ASSERT_TRUE(hierarchy.is_ok());
+
+  auto* suppression = hierarchy.value().GetByPath({kNode_KnownAnswerSuppression});
+  ASSERT_TRUE(suppression);
+
+  auto* answers = suppression->node().get_property<inspect::UintPropertyValue>(
+      kNode_KnownAnswerSuppression_Answers);
+  ASSERT_TRUE(answers);
+  EXPECT_EQ(answers->value(), 3u);
+
+  auto* messages = suppression->node().get_property<inspect::UintPropertyValue>(
+      kNode_KnownAnswerSuppression_Messages);
+  ASSERT_TRUE(messages);
+  EXPECT_EQ(messages->value(), 1u);
+}
+
 }  // namespace mdns::testing
@@ -0,0 +1,57 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/connectivity/network/mdns/service/common/known_answers.h"
+
+#include <gtest/gtest.h>
+
+namespace mdns {
+namespace test {
+
+constexpr char kServiceName[] = "_testservice._tcp.local.";
+constexpr char kInstanceName[] = "TestInstance._testservice._tcp.local.";
+constexpr char kOtherInstanceName[] = "OtherInstance._testservice._tcp.local.";
+
+std::shared_ptr<DnsResource> MakePtr(const std::string& instance_name, uint32_t time_to_live) {
+  auto resource = std::make_shared<DnsResource>(kServiceName, DnsType::kPtr);
+  resource->ptr_.pointer_domain_name_.dotted_string_ = instance_name;
+  resource->time_to_live_ = time_to_live;
+  return resource;
+}
+
+// Tests that an answer is suppressed only by a known answer with the same data.
+TEST(KnownAnswersTest, MatchesData) {
+  KnownAnswers under_test;
+  EXPECT_TRUE(under_test.empty());
+  EXPECT_FALSE(under_test.Suppresses(*MakePtr(kInstanceName, DnsResource::kLongTimeToLive)));
+
+  under_test.Add(MakePtr(kInstanceName, DnsResource::kLongTimeToLive));
+  EXPECT_FALSE(under_test.empty());
+  EXPECT_TRUE(under_test.Suppresses(*MakePtr(kInstanceName, DnsResource::kLongTimeToLive)));
+  EXPECT_FALSE(under_test.Suppresses(*MakePtr(kOtherInstanceName, DnsResource::kLongTimeToLive)));
+
+  // The cache flush bit isn't part of the data.
+  auto flushed = MakePtr(kInstanceName, DnsResource::kLongTimeToLive);
+  flushed->cache_flush_ = true;
+  EXPECT_TRUE(under_test.Suppresses(*flushed));
+
+  under_test.Clear();
+  EXPECT_TRUE(under_test.empty());
+  EXPECT_FALSE(under_test.Suppresses(*MakePtr(kInstanceName, DnsResource::kLongTimeToLive)));
+}
+
+// Tests that a known answer only suppresses an answer if its TTL is at least half the answer's.
+TEST(KnownAnswersTest, RequiresHalfTimeToLive) {
+  constexpr uint32_t kTimeToLive = DnsResource::kLongTimeToLive;
+  KnownAnswers under_test;
+  under_test.Add(MakePtr(kInstanceName, kTimeToLive / 2));
+  EXPECT_TRUE(under_test.Suppresses(*MakePtr(kInstanceName, kTimeToLive)));
+
+  under_test.Clear();
+  under_test.Add(MakePtr(kInstanceName, kTimeToLive / 2 - 1));
+  EXPECT_FALSE(under_test.Suppresses(*MakePtr(kInstanceName, kTimeToLive)));
+}
+
+}  // namespace test
+}  // namespace mdns
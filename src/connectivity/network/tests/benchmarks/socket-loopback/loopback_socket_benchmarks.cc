@@ -253,8 +253,13 @@ bool TcpWriteRead(perftest::RepeatState* state, int transfer) {
 // Measures the time to write `message_count` messages of size `message_size`
 // bytes on one end of the socket and read them out on the other end on the
 // same thread and calculates the throughput.
+//
+// If `batched` is true, all the messages are written with a single sendmmsg()
+// call and read with a single recvmmsg() call instead of one write() and read()
+// each.
 template <typename Ip>
-bool UdpWriteRead(perftest::RepeatState* state, int message_size, int message_count) {
+bool UdpWriteRead(perftest::RepeatState* state, int message_size, int message_count,
+                  bool batched) {
   TemplateIsIpVersion<Ip>();
   using Addr = typename Ip::SockAddr;
 
@@ -312,6 +317,46 @@ bool UdpWriteRead(perftest::RepeatState* state, int message_size, int message_co
   send_bytes.resize(message_size, 0xAA);
   recv_bytes.resize(message_size, 0xBB);
 
+  if (batched) {
+    // Every message is sent from, and received into, the same buffer.
+    iovec send_iov = {.iov_base = send_bytes.data(), .iov_len = send_bytes.size()};
+    iovec recv_iov = {.iov_base = recv_bytes.data(), .iov_len = recv_bytes.size()};
+    std::vector<mmsghdr> send_msgs(message_count), recv_msgs(message_count);
+    for (int i = 0; i < message_count; i++) {
+      send_msgs[i].msg_hdr.msg_iov = &send_iov;
+      send_msgs[i].msg_hdr.msg_iovlen = 1;
+      recv_msgs[i].msg_hdr.msg_iov = &recv_iov;
+      recv_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (state->KeepRunning()) {
+      int sent;
+      {
+#ifdef __Fuchsia__
+        TRACE_DURATION(kSocketBenchmarksTracingCategory, "udp_sendmmsg");
+#endif
+        sent = sendmmsg(client_sock.get(), send_msgs.data(), message_count, 0);
+      }
+      CHECK_TRUE_ERRNO(sent >= 0);
+      FX_CHECK(sent == message_count) << "sent " << sent << " expected " << message_count;
+      int received;
+      {
+#ifdef __Fuchsia__
+        TRACE_DURATION(kSocketBenchmarksTracingCategory, "udp_recvmmsg");
+#endif
+        received = recvmmsg(server_sock.get(), recv_msgs.data(), message_count, 0, nullptr);
+      }
+      CHECK_TRUE_ERRNO(received >= 0);
+      FX_CHECK(received == message_count)
+          << "received " << received << " expected " << message_count;
+      for (const mmsghdr& msg : recv_msgs) {
+        FX_CHECK(msg.msg_len == static_cast<unsigned int>(message_size))
+            << "read " << msg.msg_len << " expected " << message_size;
+      }
+    }
+    return true;
+  }
+
   while (state->KeepRunning()) {
     for (int i = 0; i < message_count; i++) {
       ssize_t wr;
@@ -452,9 +497,23 @@ void RegisterTests() {
   for (int message_size : kMessageSizesForUdp) {
     for (int message_count : kMessageCountsForUdp) {
       perftest::RegisterTest(get_udp_test_name(Network::kIpv4, message_size, message_count).c_str(),
-                             UdpWriteRead<Ipv4>, message_size, message_count);
+                             UdpWriteRead<Ipv4>, message_size, message_count, false);
       perftest::RegisterTest(get_udp_test_name(Network::kIpv6, message_size, message_count).c_str(),
-                             UdpWriteRead<Ipv6>, message_size, message_count);
+                             UdpWriteRead<Ipv6>, message_size, message_count, false);
+    }
+  }
+
+  // Batched variants of the small-datagram cases above, where the per-message
+  // overhead dominates.
+  constexpr int kMessageSizesForBatchedUdp[] = {1, 100, 1 << 10};
+  for (int message_size : kMessageSizesForBatchedUdp) {
+    for (int message_count : {10, 50}) {
+      auto [bytes, bytes_unit] = bytes_with_unit(message_size);
+      perftest::RegisterTest(
+          fxl::StringPrintf("BatchedWriteRead/UDP/IPv4/%ld%s/%dMessages", bytes, bytes_unit,
+                            message_count)
+              .c_str(),
+          UdpWriteRead<Ipv4>, message_size, message_count, true);
     }
   }
 
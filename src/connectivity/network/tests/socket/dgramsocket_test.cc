@@ -179,6 +179,64 @@ TEST(LocalhostTest, SendToZeroPort) {
       << strerror(errno);
 }
 
+TEST(LocalhostTest, DatagramSocketSendmmsgRecvmmsg) {
+  fbl::unique_fd recvfd;
+  ASSERT_TRUE(recvfd = fbl::unique_fd(socket(AF_INET, SOCK_DGRAM, 0))) << strerror(errno);
+  sockaddr_in addr = LoopbackSockaddrV4(0);
+  ASSERT_EQ(bind(recvfd.get(), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)), 0)
+      << strerror(errno);
+  socklen_t addrlen = sizeof(addr);
+  ASSERT_EQ(getsockname(recvfd.get(), reinterpret_cast<sockaddr*>(&addr), &addrlen), 0)
+      << strerror(errno);
+
+  fbl::unique_fd sendfd;
+  ASSERT_TRUE(sendfd = fbl::unique_fd(socket(AF_INET, SOCK_DGRAM, 0))) << strerror(errno);
+
+  constexpr size_t kMessageCount = 3;
+  std::array<char, kMessageCount> send_bufs = {'a', 'b', 'c'};
+  std::array<iovec, kMessageCount> send_iovs;
+  std::array<mmsghdr, kMessageCount> send_msgs = {};
+  for (size_t i = 0; i < kMessageCount; ++i) {
+    send_iovs[i] = {.iov_base = &send_bufs[i], .iov_len = 1};
+    send_msgs[i].msg_hdr = {
+        .msg_name = &addr,
+        .msg_namelen = addrlen,
+        .msg_iov = &send_iovs[i],
+        .msg_iovlen = 1,
+    };
+  }
+  ASSERT_EQ(sendmmsg(sendfd.get(), send_msgs.data(), kMessageCount, 0), int(kMessageCount))
+      << strerror(errno);
+  for (const mmsghdr& msg : send_msgs) {
+    EXPECT_EQ(msg.msg_len, 1u);
+  }
+
+  // Ask for one more message than was sent. MSG_WAITFORONE makes recvmmsg() return the messages
+  // that are already queued once the first one has arrived, rather than blocking for the rest.
+  std::array<char, kMessageCount + 1> recv_bufs = {};
+  std::array<iovec, kMessageCount + 1> recv_iovs;
+  std::array<mmsghdr, kMessageCount + 1> recv_msgs = {};
+  for (size_t i = 0; i < recv_msgs.size(); ++i) {
+    recv_iovs[i] = {.iov_base = &recv_bufs[i], .iov_len = 1};
+    recv_msgs[i].msg_hdr = {
+        .msg_iov = &recv_iovs[i],
+        .msg_iovlen = 1,
+    };
+  }
+  int received = 0;
+  while (received < int(kMessageCount)) {
+    const int n = recvmmsg(recvfd.get(), recv_msgs.data() + received, recv_msgs.size() - received,
+                           MSG_WAITFORONE, nullptr);
+    ASSERT_GT(n, 0) << strerror(errno);
+    received += n;
+  }
+  ASSERT_EQ(received, int(kMessageCount));
+  for (size_t i = 0; i < kMessageCount; ++i) {
+    EXPECT_EQ(recv_msgs[i].msg_len, 1u);
+    EXPECT_EQ(recv_bufs[i], send_bufs[i]);
+  }
+}
+
 TEST(LocalhostTest, DatagramSocketIgnoresMsgWaitAll) {
   fbl::unique_fd recvfd;
   ASSERT_TRUE(recvfd = fbl::unique_fd(socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0)))
@@ -215,14 +215,7 @@ TEST_F(NetStreamSocketsTest, Sendmmsg) {
       .msg_len = 0,
   };
   int result = sendmmsg(client().get(), &header, 0u, 0u);
-  if (kIsFuchsia) {
-    // Fuchsia does not support sendmmsg().
-    // TODO(https://fxbug.dev/42121767, https://fxbug.dev/42118897): Implement sendmmsg().
-    EXPECT_EQ(result, -1);
-    EXPECT_EQ(errno, ENOSYS) << strerror(errno);
-  } else {
-    EXPECT_EQ(result, 0) << strerror(errno);
-  }
+  EXPECT_EQ(result, 0) << strerror(errno);
 }
 
 TEST_F(NetStreamSocketsTest, Recvmmsg) {
@@ -232,13 +225,7 @@ TEST_F(NetStreamSocketsTest, Recvmmsg) {
   };
   int result = recvmmsg(client().get(), &header, 1u, MSG_DONTWAIT, nullptr);
   EXPECT_EQ(result, -1);
-  if (kIsFuchsia) {
-    // Fuchsia does not support recvmmsg().
-    // TODO(https://fxbug.dev/42121765): Implement recvmmsg().
-    EXPECT_EQ(errno, ENOSYS) << strerror(errno);
-  } else {
-    EXPECT_EQ(errno, EAGAIN) << strerror(errno);
-  }
+  EXPECT_EQ(errno, EAGAIN) << strerror(errno);
 }
 
 TEST_F(NetStreamSocketsTest, BlockingAcceptDupWrite) {
@@ -202,6 +202,24 @@ bool DeviceAdapter::TryGetTxBuffer(fit::callback<zx_status_t(TxBuffer&, size_t)>
   return true;
 }
 
+bool DeviceAdapter::TryGetTxBuffers(fit::function<bool()> more,
+                                    fit::function<zx_status_t(TxBuffer&, size_t)> callback) {
+  fbl::AutoLock lock(&tx_lock_);
+  bool exhausted = false;
+  while (more()) {
+    if (tx_buffers_.empty()) {
+      exhausted = true;
+      break;
+    }
+    auto& buff = tx_buffers_.front();
+    zx_status_t status = callback(buff, tx_buffers_.size() - 1);
+    EnqueueTx(buff.id(), status);
+    tx_buffers_.pop();
+  }
+  CommitTx();
+  return !exhausted;
+}
+
 void DeviceAdapter::RetainTxBuffers(fit::function<zx_status_t(TxBuffer&)> func) {
   fbl::AutoLock lock(&tx_lock_);
   for (size_t size = tx_buffers_.size(); size > 0; size--) {
@@ -220,6 +238,29 @@ void DeviceAdapter::RetainTxBuffers(fit::function<zx_status_t(TxBuffer&)> func)
 zx::result<size_t> DeviceAdapter::WriteRxFrame(
     PortAdapter& port, fuchsia_hardware_network::wire::FrameType frame_type, const uint8_t* data,
     size_t count, const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta) {
+  fbl::AutoLock lock(&rx_lock_);
+  zx::result result = WriteRxFrameLocked(port, frame_type, data, count, meta);
+  CommitRx();
+  return result;
+}
+
+void DeviceAdapter::WriteRxFrames(fit::function<void(const RxFrameWriter&)> func) {
+  fbl::AutoLock lock(&rx_lock_);
+  RxFrameWriter writer = [this](PortAdapter& port,
+                                fuchsia_hardware_network::wire::FrameType frame_type,
+                                const fidl::VectorView<uint8_t>& data,
+                                const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta) {
+    // The writer is only called by `func`, while the lock is held.
+    []() __TA_ASSERT(rx_lock_) {}();
+    return WriteRxFrameLocked(port, frame_type, data.data(), data.count(), meta);
+  };
+  func(writer);
+  CommitRx();
+}
+
+zx::result<size_t> DeviceAdapter::WriteRxFrameLocked(
+    PortAdapter& port, fuchsia_hardware_network::wire::FrameType frame_type, const uint8_t* data,
+    size_t count, const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta) {
   if (!port.online()) {
     return zx::error(ZX_ERR_BAD_STATE);
   }
@@ -227,7 +268,6 @@ zx::result<size_t> DeviceAdapter::WriteRxFrame(
     return zx::error(ZX_ERR_INVALID_ARGS);
   }
 
-  fbl::AutoLock lock(&rx_lock_);
   if (rx_buffers_.empty()) {
     return zx::error(ZX_ERR_SHOULD_WAIT);
   }
@@ -241,7 +281,6 @@ zx::result<size_t> DeviceAdapter::WriteRxFrame(
     return zx::error(status);
   }
   EnqueueRx(port.id(), frame_type, std::move(buffer), count, meta);
-  CommitRx();
 
   return zx::ok(rx_buffers_.size());
 }
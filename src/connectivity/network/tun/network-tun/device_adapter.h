@@ -89,6 +89,12 @@ class DeviceAdapter : public ddk::NetworkDeviceImplProtocol<DeviceAdapter> {
   // Returns `true` if a buffer was successfully allocated. The buffer given to `callback` is
   // discarded from the list of pending buffers and marked as pending for return.
   bool TryGetTxBuffer(fit::callback<zx_status_t(TxBuffer&, size_t)> callback);
+  // Like `TryGetTxBuffer`, but keeps calling `callback` with pending transmit buffers for as long
+  // as `more` returns `true`. All consumed buffers are returned to the `NetworkDeviceInterface` in a
+  // single batch.
+  // Returns `false` if the pending buffers ran out while `more` still returned `true`.
+  bool TryGetTxBuffers(fit::function<bool()> more,
+                       fit::function<zx_status_t(TxBuffer&, size_t)> callback);
   // Calls `func` with all currently enqueued tx buffers.
   // If `func` returns a value different than `ZX_OK`, the buffer is returned to the device
   // implementation with that error.
@@ -110,6 +116,14 @@ class DeviceAdapter : public ddk::NetworkDeviceImplProtocol<DeviceAdapter> {
                                   fuchsia_hardware_network::wire::FrameType frame_type,
                                   const std::vector<uint8_t>& data,
                                   const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta);
+  // Writes a single frame with the same semantics as `WriteRxFrame`.
+  using RxFrameWriter = fit::function<zx::result<size_t>(
+      PortAdapter&, fuchsia_hardware_network::wire::FrameType, const fidl::VectorView<uint8_t>&,
+      const std::optional<fuchsia_net_tun::wire::FrameMetadata>&)>;
+  // Calls `func` with a writer that can be used to write any number of frames into available rx
+  // buffers. The buffers are returned to the `NetworkDeviceInterface` in a single batch once `func`
+  // returns, instead of once per frame.
+  void WriteRxFrames(fit::function<void(const RxFrameWriter&)> func);
   // Copies all pending tx buffers from `this` consuming any available rx buffers from `other`.
   // If `return_failed_buffers` is `true`, all buffers from `this` that couldn't be immediately
   // copied into available buffers from `other` will be returned to applications in a failure state,
@@ -134,6 +148,11 @@ class DeviceAdapter : public ddk::NetworkDeviceImplProtocol<DeviceAdapter> {
                  RxBuffer buffer, size_t length,
                  const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta)
       __TA_REQUIRES(rx_lock_);
+  // Writes a single rx frame into an available buffer and enqueues it, without committing it.
+  zx::result<size_t> WriteRxFrameLocked(
+      PortAdapter& port, fuchsia_hardware_network::wire::FrameType frame_type, const uint8_t* data,
+      size_t count, const std::optional<fuchsia_net_tun::wire::FrameMetadata>& meta)
+      __TA_REQUIRES(rx_lock_);
   // Commits all pending rx buffers, returning them to the `NetworkDeviceInterface`.
   void CommitRx() __TA_REQUIRES(rx_lock_);
   // Enqueues a single consumed tx frame.
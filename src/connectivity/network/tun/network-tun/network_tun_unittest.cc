@@ -1102,6 +1102,69 @@ TEST_F(TunTest, SimpleRxTx) {
   EXPECT_EQ(data[1], 0xBB);
 }
 
+TEST_F(TunTest, PipelinedBlockingWrites) {
+  fuchsia_net_tun::wire::DeviceConfig device_config = DefaultDeviceConfig();
+  fuchsia_net_tun::wire::DevicePortConfig port_config = DefaultDevicePortConfig();
+  port_config.set_online(true);
+
+  zx::result device_and_port =
+      CreateDeviceAndPort(std::move(device_config), std::move(port_config));
+  ASSERT_OK(device_and_port.status_value());
+  auto [device_client_end, port_client_end] = std::move(device_and_port.value());
+
+  zx::result maybe_port_id = GetPortId(port_client_end);
+  ASSERT_OK(maybe_port_id.status_value());
+  const fuchsia_hardware_network::wire::PortId port_id = maybe_port_id.value();
+
+  fidl::WireClient tun(std::move(device_client_end), dispatcher());
+
+  SimpleClient client;
+  zx::result request = client.NewRequest();
+  ASSERT_OK(request.status_value());
+  ASSERT_OK(tun->GetDevice(std::move(request.value())).status());
+  ASSERT_OK(client.OpenSession());
+  ASSERT_OK(client.AttachPort(port_id));
+
+  // Pipeline writes before any rx buffers are available, they must all complete once the session
+  // provides buffers.
+  constexpr uint8_t kFrameCount = 3;
+  uint8_t data[kFrameCount][2];
+  size_t completed = 0;
+  for (uint8_t i = 0; i < kFrameCount; i++) {
+    fuchsia_net_tun::wire::Frame frame(alloc_);
+    frame.set_frame_type(fuchsia_hardware_network::wire::FrameType::kEthernet);
+    frame.set_port(kDefaultTestPort);
+    data[i][0] = i;
+    data[i][1] = 0xAA;
+    frame.set_data(alloc_, fidl::VectorView<uint8_t>::FromExternal(data[i]));
+    tun->WriteFrame(std::move(frame))
+        .Then([&completed](fidl::WireUnownedResult<fuchsia_net_tun::Device::WriteFrame>& result) {
+          ASSERT_OK(result.status());
+          if (result->is_error()) {
+            GTEST_FAIL() << "WriteFrame failed: " << zx_status_get_string(result->error_value());
+          }
+          completed++;
+        });
+  }
+  RunLoopUntilIdle();
+  ASSERT_EQ(completed, 0u);
+
+  ASSERT_OK(client.SendRx({0x00, 0x01, 0x02}, true));
+  ASSERT_TRUE(RunLoopWithTimeoutOrUntil([&completed]() { return completed == kFrameCount; },
+                                        kTimeout, zx::duration::infinite()));
+
+  // Frames must've been written in order.
+  for (uint8_t i = 0; i < kFrameCount; i++) {
+    uint16_t desc;
+    ASSERT_OK(client.FetchRx(&desc));
+    auto* d = client.descriptor(desc);
+    ASSERT_EQ(d->data_length, 2u);
+    auto frame_data = client.data(d);
+    EXPECT_EQ(frame_data[0], i);
+    EXPECT_EQ(frame_data[1], 0xAA);
+  }
+}
+
 TEST_F(TunTest, PairRxTx) {
   SimpleClient left, right;
 
@@ -134,68 +134,82 @@ bool TunDevice::WriteWith(F fn, C& completer) {
 }
 
 bool TunDevice::RunWriteFrame() {
-  while (!pending_write_frame_.empty()) {
-    auto& pending = pending_write_frame_.front();
-    bool handled = WriteWith(
-        [this, &pending]() -> zx::result<size_t> {
-          std::unique_ptr<Port>& port = ports_[pending.port_id];
-          if (!port) {
-            return zx::error(ZX_ERR_NOT_FOUND);
-          }
-          return device_->WriteRxFrame(port->adapter(), pending.frame_type, pending.data,
-                                       pending.meta);
-        },
-        pending.completer);
-    if (!handled) {
-      return false;
+  if (pending_write_frame_.empty()) {
+    return true;
+  }
+  // Write all the frames we can in one batch, so the device interface is only notified once.
+  bool drained = true;
+  device_->WriteRxFrames([this, &drained](const DeviceAdapter::RxFrameWriter& write) {
+    while (!pending_write_frame_.empty()) {
+      auto& pending = pending_write_frame_.front();
+      bool handled = WriteWith(
+          [this, &pending, &write]() -> zx::result<size_t> {
+            std::unique_ptr<Port>& port = ports_[pending.port_id];
+            if (!port) {
+              return zx::error(ZX_ERR_NOT_FOUND);
+            }
+            return write(port->adapter(), pending.frame_type,
+                         fidl::VectorView<uint8_t>::FromExternal(pending.data), pending.meta);
+          },
+          pending.completer);
+      if (!handled) {
+        drained = false;
+        return;
+      }
+      pending_write_frame_.pop();
     }
-    pending_write_frame_.pop();
-  }
-  return true;
+  });
+  return drained;
 }
 
 void TunDevice::RunReadFrame() {
   while (!pending_read_frame_.empty()) {
-    bool success = device_->TryGetTxBuffer([this](TxBuffer& buff, size_t avail) {
-      uint8_t port_id = buff.port_id();
-      if (!ports_[port_id] || !ports_[port_id]->adapter().online()) {
-        return ZX_ERR_UNAVAILABLE;
-      }
-      std::vector<uint8_t> data;
-      zx_status_t status = buff.Read(data);
-      if (status != ZX_OK) {
-        FX_LOGF(ERROR, "tun", "Failed to read from tx buffer: %s", zx_status_get_string(status));
-        // The error reported here is relayed back to clients as an errored tx frame. There's a
-        // contract about specific meanings of errors returned in a tx frame through the netdevice
-        // banjo API and it might not match the semantics of the buffer API that generated this
-        // error. To avoid the possible impedance mismatch, return a fixed error.
-        return ZX_ERR_INTERNAL;
-      }
-      if (data.empty()) {
-        FX_LOG(WARNING, "tun", "Ignoring empty tx buffer");
-        return ZX_OK;
-      }
-      fidl::WireTableFrame<fuchsia_net_tun::wire::Frame> fidl_frame;
-      fuchsia_net_tun::wire::Frame frame(
-          fidl::ObjectView<fidl::WireTableFrame<fuchsia_net_tun::wire::Frame>>::FromExternal(
-              &fidl_frame));
-      fidl::VectorView data_view = fidl::VectorView<uint8_t>::FromExternal(data);
-      frame.set_data(fidl::ObjectView<fidl::VectorView<uint8_t>>::FromExternal(&data_view));
-      frame.set_frame_type(buff.frame_type());
-      frame.set_port(port_id);
-      std::optional meta = buff.TakeMetadata();
-      if (meta.has_value()) {
-        frame.set_meta(
-            fidl::ObjectView<fuchsia_net_tun::wire::FrameMetadata>::FromExternal(&meta.value()));
-      }
-      pending_read_frame_.front().ReplySuccess(frame);
-      pending_read_frame_.pop();
-      if (avail == 0) {
-        // clear Signals::READABLE if we don't have any more tx buffers.
-        signals_self_.signal_peer(uint32_t(fuchsia_net_tun::wire::Signals::kReadable), 0);
-      }
-      return ZX_OK;
-    });
+    // Serve as many pending reads as we can in one batch, so the device interface is only notified
+    // once.
+    bool success = device_->TryGetTxBuffers(
+        [this]() { return !pending_read_frame_.empty(); },
+        [this](TxBuffer& buff, size_t avail) {
+          uint8_t port_id = buff.port_id();
+          if (!ports_[port_id] || !ports_[port_id]->adapter().online()) {
+            return ZX_ERR_UNAVAILABLE;
+          }
+          std::vector<uint8_t> data;
+          zx_status_t status = buff.Read(data);
+          if (status != ZX_OK) {
+            FX_LOGF(ERROR, "tun", "Failed to read from tx buffer: %s",
+                    zx_status_get_string(status));
+            // The error reported here is relayed back to clients as an errored tx frame. There's
+            // a contract about specific meanings of errors returned in a tx frame through the
+            // netdevice banjo API and it might not match the semantics of the buffer API that
+            // generated this error. To avoid the possible impedance mismatch, return a fixed
+            // error.
+            return ZX_ERR_INTERNAL;
+          }
+          if (data.empty()) {
+            FX_LOG(WARNING, "tun", "Ignoring empty tx buffer");
+            return ZX_OK;
+          }
+          fidl::WireTableFrame<fuchsia_net_tun::wire::Frame> fidl_frame;
+          fuchsia_net_tun::wire::Frame frame(
+              fidl::ObjectView<fidl::WireTableFrame<fuchsia_net_tun::wire::Frame>>::FromExternal(
+                  &fidl_frame));
+          fidl::VectorView data_view = fidl::VectorView<uint8_t>::FromExternal(data);
+          frame.set_data(fidl::ObjectView<fidl::VectorView<uint8_t>>::FromExternal(&data_view));
+          frame.set_frame_type(buff.frame_type());
+          frame.set_port(port_id);
+          std::optional meta = buff.TakeMetadata();
+          if (meta.has_value()) {
+            frame.set_meta(fidl::ObjectView<fuchsia_net_tun::wire::FrameMetadata>::FromExternal(
+                &meta.value()));
+          }
+          pending_read_frame_.front().ReplySuccess(frame);
+          pending_read_frame_.pop();
+          if (avail == 0) {
+            // clear Signals::READABLE if we don't have any more tx buffers.
+            signals_self_.signal_peer(uint32_t(fuchsia_net_tun::wire::Signals::kReadable), 0);
+          }
+          return ZX_OK;
+        });
     if (!success) {
       if (IsBlocking()) {
         return;
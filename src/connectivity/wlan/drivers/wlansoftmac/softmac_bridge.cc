@@ -332,9 +332,8 @@ void SoftmacBridge::UpdateWmmParameters(UpdateWmmParametersRequest& request,
       ForwardResult<fuchsia_wlan_softmac::WlanSoftmac::UpdateWmmParameters>(completer.ToAsync()));
 }
 
-zx::result<> SoftmacBridge::EthernetTx(std::unique_ptr<eth::BorrowedOperation<>> op,
-                                       trace_async_id_t async_id) const {
-  return softmac_ifc_bridge_->EthernetTx(std::move(op), async_id);
+zx::result<> SoftmacBridge::EthernetTx(EthernetTxOperation op) const {
+  return softmac_ifc_bridge_->EthernetTx(std::move(op));
 }
 
 // Queues a packet for transmission.
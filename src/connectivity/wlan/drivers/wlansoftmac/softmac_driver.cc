@@ -197,7 +197,10 @@ void SoftmacDriver::PrepareStop(fdf::PrepareStopCompleter completer) {
   });
 }
 
-void SoftmacDriver::Stop() { WLAN_TRACE_DURATION(); }
+void SoftmacDriver::Stop() {
+  WLAN_TRACE_DURATION();
+  pending_tx_.CompleteAll(ZX_ERR_CANCELED);
+}
 
 zx_status_t SoftmacDriver::EthernetImplQuery(uint32_t options, ethernet_info_t* out_info) {
   WLAN_TRACE_DURATION();
@@ -208,7 +211,7 @@ zx_status_t SoftmacDriver::EthernetImplQuery(uint32_t options, ethernet_info_t*
   *out_info = {
       .features = ETHERNET_FEATURE_WLAN,
       .mtu = 1500,
-      .netbuf_size = eth::BorrowedOperation<>::OperationSize(sizeof(ethernet_netbuf_t)),
+      .netbuf_size = EthernetTxOperation::OperationSize(sizeof(ethernet_netbuf_t)),
   };
 
   auto cleanup = fit::defer([out_info]() { *out_info = {}; });
@@ -319,19 +322,39 @@ void SoftmacDriver::EthernetImplQueueTx(uint32_t options, ethernet_netbuf_t* net
   WLAN_TRACE_ASYNC_BEGIN_TX(async_id, "ethernet");
   WLAN_TRACE_DURATION();
 
-  auto op = std::make_unique<eth::BorrowedOperation<>>(netbuf, callback, cookie,
-                                                       sizeof(ethernet_netbuf_t));
+  EthernetTxOperation op(netbuf, callback, cookie, sizeof(ethernet_netbuf_t));
+  *op.private_storage() = async_id;
+  pending_tx_.push(std::move(op));
 
   // Post a task to sequence queuing the Ethernet frame with other calls from
   // `softmac_ifc_bridge_` to the bridged wlansoftmac driver. The `SoftmacIfcBridge`
   // class is not designed to be thread-safe. Making calls to its methods from
   // different dispatchers could result in unexpected behavior.
-  async::PostTask(dispatcher(), [&, op = std::move(op), async_id]() mutable {
-    auto result = softmac_bridge_->EthernetTx(std::move(op), async_id);
+  //
+  // Only one task is posted for all the frames queued before it runs, so a burst of frames
+  // is forwarded in a single pass instead of with a task per frame.
+  if (!tx_drain_posted_.exchange(true, std::memory_order_acq_rel)) {
+    async::PostTask(dispatcher(), [this]() { DrainPendingTx(); });
+  }
+}
+
+void SoftmacDriver::DrainPendingTx() {
+  WLAN_TRACE_DURATION();
+  // Clear the flag before draining. A frame queued after this point is either drained by this
+  // pass or posts another task.
+  tx_drain_posted_.exchange(false, std::memory_order_acq_rel);
+  for (auto op = pending_tx_.pop(); op; op = pending_tx_.pop()) {
+    trace_async_id_t async_id = *op->private_storage();
+    if (!softmac_bridge_) {
+      op->Complete(ZX_ERR_BAD_STATE);
+      WLAN_TRACE_ASYNC_END_TX(async_id, ZX_ERR_BAD_STATE);
+      continue;
+    }
+    auto result = softmac_bridge_->EthernetTx(std::move(*op));
     if (!result.is_ok()) {
       WLAN_TRACE_ASYNC_END_TX(async_id, result.status_value());
     }
-  });
+  }
 }
 
 zx_status_t SoftmacDriver::EthernetImplSetParam(uint32_t param, int32_t value,
@@ -21,6 +21,7 @@
 #include <zircon/compiler.h>
 
 #include <memory>
+#include <atomic>
 #include <mutex>
 
 #include <ddktl/device.h>
@@ -63,6 +64,9 @@ class SoftmacDriver : public fdf::DriverBase, public ddk::EthernetImplProtocol<S
   void PrepareStop(fdf::PrepareStopCompleter completer) override;
   void Stop() override;
 
+  // Forwards every frame in `pending_tx_` to `softmac_bridge_`.
+  void DrainPendingTx();
+
   // Mark `ethernet_proxy_lock_` as a mutable member of this class to allow const functions
   // to acquire it.
   mutable std::shared_ptr<std::mutex> ethernet_proxy_lock_;
@@ -83,6 +87,12 @@ class SoftmacDriver : public fdf::DriverBase, public ddk::EthernetImplProtocol<S
 
   std::unique_ptr<SoftmacBridge> softmac_bridge_;
 
+  // Ethernet frames queued by `EthernetImplQueueTx`, waiting to be forwarded on the driver
+  // dispatcher. The queue is intrusive, so queuing a frame allocates nothing.
+  eth::BorrowedOperationQueue<trace_async_id_t> pending_tx_;
+  // Whether a task to drain `pending_tx_` has been posted and hasn't started draining yet.
+  std::atomic<bool> tx_drain_posted_ = false;
+
   // The FIDL client to communicate with the parent driver's WlanSoftmac server.
   fdf::SharedClient<fuchsia_wlan_softmac::WlanSoftmac> softmac_client_;
 
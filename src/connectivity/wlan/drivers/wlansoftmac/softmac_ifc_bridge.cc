@@ -99,23 +99,24 @@ void SoftmacIfcBridge::Recv(RecvRequestView fdf_request, fdf::Arena& arena,
 
 // Safety: This function type matches the requirement of
 // fuchsia.wlan.softmac/EthernetTx.complete_borrowed_operation.
-void complete_borrowed_operation(eth::BorrowedOperation<>* op, zx_status_t status) {
-  op->Complete(status);
-  delete op;
+//
+// The borrowed operation is the netbuf itself. Its private storage was initialized when the frame
+// was queued, so it can be wrapped again here without any allocation.
+void complete_borrowed_operation(ethernet_netbuf_t* netbuf, zx_status_t status) {
+  EthernetTxOperation(netbuf, sizeof(ethernet_netbuf_t)).Complete(status);
 }
 
-zx::result<> SoftmacIfcBridge::EthernetTx(std::unique_ptr<eth::BorrowedOperation<>> op,
-                                          trace_async_id_t async_id) const {
+zx::result<> SoftmacIfcBridge::EthernetTx(EthernetTxOperation op) const {
   WLAN_TRACE_DURATION();
   fuchsia_wlan_softmac::EthernetTxTransferRequest request;
-  request.packet_address(reinterpret_cast<uint64_t>(op->operation()->data_buffer));
-  request.packet_size(reinterpret_cast<uint64_t>(op->operation()->data_size));
-  request.async_id(async_id);
+  request.packet_address(reinterpret_cast<uint64_t>(op.operation()->data_buffer));
+  request.packet_size(reinterpret_cast<uint64_t>(op.operation()->data_size));
+  request.async_id(*op.private_storage());
 
   // Safety: These fields are properly set according to the requirements of
   // fuchsia.wlan.softmac/EthernetTx.
-  auto op_ptr = op.release();
-  request.borrowed_operation(reinterpret_cast<uint64_t>(op_ptr));
+  auto* netbuf = op.take();
+  request.borrowed_operation(reinterpret_cast<uint64_t>(netbuf));
   request.complete_borrowed_operation(reinterpret_cast<uint64_t>(complete_borrowed_operation));
 
   auto fidl_request_persisted = ::fidl::Persist(request);
@@ -131,7 +132,7 @@ zx::result<> SoftmacIfcBridge::EthernetTx(std::unique_ptr<eth::BorrowedOperation
   // wlan_ffi_transport::EthernetTx::ethernet_tx_transfer returns ZX_ERR_BAD_STATE if and only if
   // it did not take ownership of the BorrowedOperation before returning.
   if (result.status_value() == ZX_ERR_BAD_STATE) {
-    complete_borrowed_operation(op_ptr, result.status_value());
+    complete_borrowed_operation(netbuf, result.status_value());
   }
   return result;
 }
@@ -18,6 +18,11 @@
 
 namespace wlan::drivers::wlansoftmac {
 
+// An Ethernet frame queued for transmission. The private storage of the operation holds the trace
+// async ID of the frame, so queuing the frame and handing it to the bridged driver allocates
+// nothing.
+using EthernetTxOperation = eth::BorrowedOperation<trace_async_id_t>;
+
 class SoftmacIfcBridge : public fdf::WireServer<fuchsia_wlan_softmac::WlanSoftmacIfc> {
  public:
   static zx::result<std::unique_ptr<SoftmacIfcBridge>> New(
@@ -30,8 +35,7 @@ class SoftmacIfcBridge : public fdf::WireServer<fuchsia_wlan_softmac::WlanSoftma
 
   void Recv(RecvRequestView fdf_request, fdf::Arena& arena,
             RecvCompleter::Sync& completer) override;
-  zx::result<> EthernetTx(std::unique_ptr<eth::BorrowedOperation<>> op,
-                          trace_async_id_t async_id) const;
+  zx::result<> EthernetTx(EthernetTxOperation op) const;
   void ReportTxResult(ReportTxResultRequestView request, fdf::Arena& arena,
                       ReportTxResultCompleter::Sync& completer) override;
   void NotifyScanComplete(NotifyScanCompleteRequestView request, fdf::Arena& arena,
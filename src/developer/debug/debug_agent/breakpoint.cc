@@ -4,6 +4,7 @@
 
 #include "src/developer/debug/debug_agent/breakpoint.h"
 
+#include "src/developer/debug/debug_agent/automation_instruction_executor.h"
 #include "src/developer/debug/debug_agent/process_breakpoint.h"
 #include "src/developer/debug/shared/logging/logging.h"
 #include "src/lib/fxl/strings/string_printf.h"
@@ -228,10 +229,21 @@ bool Breakpoint::AppliesToThread(zx_koid_t pid, zx_koid_t tid) const {
   return false;
 }
 
-// In the future we will want to have breakpoints that trigger on a specific
-// hit count or other conditions and will need a "kContinue" result.
+bool Breakpoint::ConditionsMet(const GeneralRegisters& regs, const ProcessHandle& handle) const {
+  if (settings_.conditions.empty())
+    return true;
+
+  AutomationInstructionExecutor executor;
+  return executor.EvalConditionVect(settings_.conditions, regs, handle);
+}
+
 Breakpoint::HitResult Breakpoint::OnHit() {
   stats_.hit_count++;
+  if (stats_.hit_count <= settings_.ignore_count) {
+    DEBUG_LOG(Breakpoint) << Preamble(this) << "Hit " << stats_.hit_count << " of "
+                          << settings_.ignore_count << " ignored.";
+    return HitResult::kContinue;
+  }
   if (settings_.one_shot) {
     DEBUG_LOG(Breakpoint) << Preamble(this) << "One-shot breakpoint. Will be deleted.";
     stats_.should_delete = true;
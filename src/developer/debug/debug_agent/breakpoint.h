@@ -10,6 +10,8 @@
 #include <set>
 #include <string>
 
+#include "src/developer/debug/debug_agent/general_registers.h"
+#include "src/developer/debug/debug_agent/process_handle.h"
 #include "src/developer/debug/ipc/records.h"
 #include "src/developer/debug/shared/status.h"
 #include "src/lib/fxl/macros.h"
@@ -40,9 +42,9 @@ class Breakpoint {
     // when it sees this result.
     kOneShotHit,
 
-    // This will need to be expanded to include "kContinue" to indicate that
-    // this doesn't count as hitting the breakpoint (for when we implement
-    // "break on hit count == 5" or "multiple of 7").
+    // The hit was counted but the breakpoint's ignore count has not been reached yet, so it
+    // should not stop.
+    kContinue,
   };
 
   // The process delegate should outlive the Breakpoint object. It allows
@@ -82,6 +84,11 @@ class Breakpoint {
   // hitting an exception needs to query whether it should apply to it or not.
   bool AppliesToThread(zx_koid_t process_koid, zx_koid_t thread_koid) const;
 
+  // Evaluates the settings' conditions against the state of the thread that hit this breakpoint.
+  // Returns true when there are no conditions. A hit for which this returns false should not be
+  // reported to OnHit().
+  bool ConditionsMet(const GeneralRegisters& regs, const ProcessHandle& handle) const;
+
   // Notification that this breakpoint was just hit.
   HitResult OnHit();
 
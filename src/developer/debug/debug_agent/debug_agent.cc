@@ -415,6 +415,13 @@ void DebugAgent::OnReadMemory(const debug_ipc::ReadMemoryRequest& request,
     proc->OnReadMemory(request, reply);
 }
 
+void DebugAgent::OnReadMemoryBatch(const debug_ipc::ReadMemoryBatchRequest& request,
+                                   debug_ipc::ReadMemoryBatchReply* reply) {
+  DebuggedProcess* proc = GetDebuggedProcess(request.process_koid);
+  if (proc)
+    proc->OnReadMemoryBatch(request, reply);
+}
+
 void DebugAgent::OnReadRegisters(const debug_ipc::ReadRegistersRequest& request,
                                  debug_ipc::ReadRegistersReply* reply) {
   DebuggedThread* thread = GetDebuggedThread(request.id);
@@ -215,7 +215,19 @@ void DebuggedProcess::OnResume(const debug_ipc::ResumeRequest& request) {
 
 void DebuggedProcess::OnReadMemory(const debug_ipc::ReadMemoryRequest& request,
                                    debug_ipc::ReadMemoryReply* reply) {
-  reply->blocks = process_handle_->ReadMemoryBlocks(request.address, request.size);
+  reply->blocks = ReadMemoryBlocks(request.address, request.size);
+}
+
+void DebuggedProcess::OnReadMemoryBatch(const debug_ipc::ReadMemoryBatchRequest& request,
+                                        debug_ipc::ReadMemoryBatchReply* reply) {
+  reply->blocks.reserve(request.ranges.size());
+  for (const auto& range : request.ranges)
+    reply->blocks.push_back(ReadMemoryBlocks(range.address, range.size));
+}
+
+std::vector<debug_ipc::MemoryBlock> DebuggedProcess::ReadMemoryBlocks(uint64_t address,
+                                                                      uint32_t size) {
+  std::vector<debug_ipc::MemoryBlock> blocks = process_handle_->ReadMemoryBlocks(address, size);
 
   // Remove any breakpoint instructions we've inserted.
   //
@@ -225,10 +237,12 @@ void DebuggedProcess::OnReadMemory(const debug_ipc::ReadMemoryRequest& request,
     // Generally there will be only one block. If we start reading many megabytes that cross
     // mapped memory boundaries, a top-level range check would be a good idea to avoid unnecessary
     // iteration.
-    for (auto& block : reply->blocks) {
+    for (auto& block : blocks) {
       bp->FixupMemoryBlock(&block);
     }
   }
+
+  return blocks;
 }
 
 void DebuggedProcess::OnKill(const debug_ipc::KillRequest& request, debug_ipc::KillReply* reply) {
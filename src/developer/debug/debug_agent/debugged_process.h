@@ -98,6 +98,8 @@ class DebuggedProcess : public ProcessHandleObserver {
   // IPC handlers.
   void OnResume(const debug_ipc::ResumeRequest& request);
   void OnReadMemory(const debug_ipc::ReadMemoryRequest& request, debug_ipc::ReadMemoryReply* reply);
+  void OnReadMemoryBatch(const debug_ipc::ReadMemoryBatchRequest& request,
+                         debug_ipc::ReadMemoryBatchReply* reply);
   void OnKill(const debug_ipc::KillRequest& request, debug_ipc::KillReply* reply);
   void OnAddressSpace(const debug_ipc::AddressSpaceRequest& request,
                       debug_ipc::AddressSpaceReply* reply);
@@ -225,6 +227,10 @@ class DebuggedProcess : public ProcessHandleObserver {
   void OnStdout(bool close);
   void OnStderr(bool close);
 
+  // Reads memory for a ReadMemory or ReadMemoryBatch request, with the original contents of any
+  // memory replaced by software breakpoints.
+  std::vector<debug_ipc::MemoryBlock> ReadMemoryBlocks(uint64_t address, uint32_t size);
+
   // Sends a IO notification over to the client.
   void SendIO(debug_ipc::NotifyIO::Type, const std::vector<char>& data);
 
@@ -297,8 +297,13 @@ void DebuggedThread::HandleHardwareBreakpoint(debug_ipc::NotifyException* except
                                               GeneralRegisters& regs) {
   uint64_t breakpoint_address = arch::BreakpointInstructionForHardwareExceptionAddress(regs.ip());
   if (HardwareBreakpoint* found_bp = process_->FindHardwareBreakpoint(breakpoint_address)) {
-    UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType::kHardware, found_bp,
-                                  exception->hit_breakpoints, exception->other_affected_threads);
+    if (!UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType::kHardware, found_bp, regs,
+                                       exception->hit_breakpoints,
+                                       exception->other_affected_threads)) {
+      DEBUG_LOG(Thread) << ThreadPreamble(this) << "HW Breakpoint conditions not met. Ignoring.";
+      ResumeFromException();
+      return;
+    }
     // Note: may have deleted found_bp.
   } else {
     // Hit a hw debug exception that doesn't belong to any ProcessBreakpoint. This is probably a
@@ -337,10 +342,16 @@ void DebuggedThread::HandleWatchpoint(debug_ipc::NotifyException* exception,
   }
 
   // TODO(donosoc): Plumb in R/RW types.
-  UpdateForHitProcessBreakpoint(watchpoint->Type(), watchpoint, exception->hit_breakpoints,
-                                exception->other_affected_threads);
+  bool should_stop = UpdateForHitProcessBreakpoint(watchpoint->Type(), watchpoint, regs,
+                                                   exception->hit_breakpoints,
+                                                   exception->other_affected_threads);
   // The ProcessBreakpoint could'be been deleted, so we cannot use it anymore.
   watchpoint = nullptr;
+  if (!should_stop) {
+    DEBUG_LOG(Thread) << "Watchpoint conditions not met. Ignoring.";
+    ResumeFromException();
+    return;
+  }
   SendExceptionNotification(exception, regs);
 }
 
@@ -563,8 +574,11 @@ DebuggedThread::OnStop DebuggedThread::UpdateForSoftwareBreakpoint(
       return OnStop::kResume;
     }
 
-    UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType::kSoftware, found_bp, hit_breakpoints,
-                                  other_affected_threads);
+    if (!UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType::kSoftware, found_bp, regs,
+                                       hit_breakpoints, other_affected_threads)) {
+      DEBUG_LOG(Thread) << ThreadPreamble(this) << "SW Breakpoint conditions not met. Ignoring.";
+      return OnStop::kResume;
+    }
     // Note: may have deleted found_bp!
   } else if (IsBreakpointInstructionAtAddress(breakpoint_address)) {
     // Hit a software breakpoint that doesn't correspond to any current breakpoint.
@@ -590,13 +604,14 @@ DebuggedThread::OnStop DebuggedThread::UpdateForSoftwareBreakpoint(
   return OnStop::kNotify;
 }
 
-void DebuggedThread::UpdateForHitProcessBreakpoint(
+bool DebuggedThread::UpdateForHitProcessBreakpoint(
     debug_ipc::BreakpointType exception_type, ProcessBreakpoint* process_breakpoint,
-    std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
+    const GeneralRegisters& regs, std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
     std::vector<debug_ipc::ThreadRecord>& other_affected_threads) {
   current_breakpoint_ = process_breakpoint;
 
-  process_breakpoint->OnHit(this, exception_type, hit_breakpoints, other_affected_threads);
+  bool should_stop = process_breakpoint->OnHit(this, exception_type, regs, hit_breakpoints,
+                                               other_affected_threads);
 
   // Delete any one-shot breakpoints. Since there can be multiple Breakpoints (some one-shot, some
   // not) referring to the current ProcessBreakpoint, this operation could delete the
@@ -606,6 +621,7 @@ void DebuggedThread::UpdateForHitProcessBreakpoint(
     if (stats.should_delete)
       process_->debug_agent()->RemoveBreakpoint(stats.id);
   }
+  return should_stop;
 }
 
 bool DebuggedThread::IsBreakpointInstructionAtAddress(uint64_t address) const {
@@ -152,8 +152,12 @@ class DebuggedThread {
   //
   // WARNING: The ProcessBreakpoint argument could be deleted in this call if it was a one-shot
   //          breakpoint, so it must not be used after this call.
-  void UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType exception_type,
+  //
+  // Returns false when the breakpoints' conditions or ignore counts filtered out this hit. The
+  // caller should then resume the thread instead of notifying the client.
+  bool UpdateForHitProcessBreakpoint(debug_ipc::BreakpointType exception_type,
                                      ProcessBreakpoint* process_breakpoint,
+                                     const GeneralRegisters& regs,
                                      std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
                                      std::vector<debug_ipc::ThreadRecord>& stopped_threads);
 
@@ -70,8 +70,9 @@ bool ProcessBreakpoint::ShouldHitThread(zx_koid_t thread_koid) const {
   return false;
 }
 
-void ProcessBreakpoint::OnHit(DebuggedThread* hitting_thread,
+bool ProcessBreakpoint::OnHit(DebuggedThread* hitting_thread,
                               debug_ipc::BreakpointType exception_type,
+                              const GeneralRegisters& regs,
                               std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
                               std::vector<debug_ipc::ThreadRecord>& other_affected_threads) {
   // This will be filled in with the largest scope to stop.
@@ -82,13 +83,21 @@ void ProcessBreakpoint::OnHit(DebuggedThread* hitting_thread,
   // How much stack to capture for the suspended threads.
   constexpr auto kSuspendedStackAmount = debug_ipc::ThreadRecord::StackAmount::kMinimal;
 
+  // Set when a breakpoint applied to this exception but its conditions or ignore count filtered
+  // out the hit.
+  bool filtered = false;
+
   hit_breakpoints.clear();
   for (Breakpoint* breakpoint : breakpoints_) {
     // Only care for breakpoints that match the exception type.
     if (!Breakpoint::DoesExceptionApply(breakpoint->settings().type, exception_type))
       continue;
 
-    breakpoint->OnHit();
+    if (!breakpoint->ConditionsMet(regs, process_->process_handle()) ||
+        breakpoint->OnHit() == Breakpoint::HitResult::kContinue) {
+      filtered = true;
+      continue;
+    }
 
     // The breakpoint stats are for the client.
     hit_breakpoints.push_back(breakpoint->stats());
@@ -97,6 +106,9 @@ void ProcessBreakpoint::OnHit(DebuggedThread* hitting_thread,
       max_stop = breakpoint->settings().stop;
   }
 
+  if (filtered && hit_breakpoints.empty())
+    return false;
+
   // Apply the maximal stop mode.
   switch (max_stop) {
     case debug_ipc::Stop::kNone: {
@@ -134,6 +146,7 @@ void ProcessBreakpoint::OnHit(DebuggedThread* hitting_thread,
       break;
     }
   }
+  return true;
 }
 
 void ProcessBreakpoint::BeginStepOver(DebuggedThread* thread) {
@@ -9,6 +9,7 @@
 
 #include "src/developer/debug/debug_agent/arch.h"
 #include "src/developer/debug/debug_agent/debugged_process.h"
+#include "src/developer/debug/debug_agent/general_registers.h"
 #include "src/developer/debug/ipc/records.h"
 #include "src/developer/debug/shared/status.h"
 #include "src/lib/fxl/macros.h"
@@ -71,18 +72,23 @@ class ProcessBreakpoint {
   // if the breakpoint was indeed intended to apply to it (we can have thread-specific breakpoints).
   bool ShouldHitThread(zx_koid_t thread_koid) const;
 
-  // Notification that this breakpoint was just hit. All affected Breakpoints will have their stats
-  // updated and placed in the *stats param. This makes a difference whether the exceptions was
-  // software or hardware (debug registers) triggered.
+  // Notification that this breakpoint was just hit. All affected Breakpoints that should stop will
+  // have their stats updated and placed in the *stats param. This makes a difference whether the
+  // exceptions was software or hardware (debug registers) triggered. Breakpoints whose conditions
+  // don't match |regs| are skipped, and ones still within their ignore count are counted but not
+  // reported.
   //
   // All threads requested to be suspended (in any process) by this breakpoint's settings will be
   // filled into |other_affected_threads|.
   //
+  // Returns false if every Breakpoint that applied was filtered out this way, in which case the
+  // caller should resume the thread without notifying the client.
+  //
   // IMPORTANT: The caller should check the stats and for any breakpoint with "should_delete" set,
   // remove the breakpoints. This can't conveniently be done within this call because it will cause
   // this ProcessBreakpoint object to be deleted from within itself.
-  void OnHit(DebuggedThread* hitting_thread, debug_ipc::BreakpointType exception_type,
-             std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
+  bool OnHit(DebuggedThread* hitting_thread, debug_ipc::BreakpointType exception_type,
+             const GeneralRegisters& regs, std::vector<debug_ipc::BreakpointStats>& hit_breakpoints,
              std::vector<debug_ipc::ThreadRecord>& other_affected_threads);
 
   // Call before single-stepping over a breakpoint. This will remove the breakpoint such that it
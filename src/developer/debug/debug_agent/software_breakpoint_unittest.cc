@@ -17,6 +17,7 @@
 #include "src/developer/debug/debug_agent/mock_system_interface.h"
 #include "src/developer/debug/debug_agent/mock_thread.h"
 #include "src/developer/debug/shared/logging/debug.h"
+#include "src/developer/debug/shared/register_info.h"
 
 namespace debug_agent {
 
@@ -807,8 +808,8 @@ TEST(ProcessBreakpoint, HitCount) {
   // Hitting the ProcessBreakpoint should update both Breakpoints.
   std::vector<debug_ipc::BreakpointStats> stats;
   std::vector<debug_ipc::ThreadRecord> affected_threads;
-  process_delegate.bps().begin()->second->OnHit(thread, debug_ipc::BreakpointType::kSoftware, stats,
-                                                affected_threads);
+  EXPECT_TRUE(process_delegate.bps().begin()->second->OnHit(
+      thread, debug_ipc::BreakpointType::kSoftware, GeneralRegisters(), stats, affected_threads));
   ASSERT_EQ(2u, stats.size());
 
   // Order of the vector is not defined so allow either.
@@ -828,4 +829,67 @@ TEST(ProcessBreakpoint, HitCount) {
   ASSERT_EQ(0u, process_delegate.bps().size());
 }
 
+TEST(ProcessBreakpoint, Conditions) {
+  DebugAgent debug_agent(std::make_unique<MockSystemInterface>(MockJobHandle(99999)));
+  TestProcessDelegate process_delegate;
+
+  constexpr zx_koid_t kProcess1 = 1;
+  auto owning_process = std::make_unique<MockProcess>(&debug_agent, kProcess1);
+  DebuggedProcess* process = owning_process.get();
+  owning_process->mock_process_handle().mock_memory().AddMemory(kAddress, GetOriginalData());
+  process_delegate.InjectMockProcess(std::move(owning_process));
+
+  auto owning_thread = std::make_unique<MockThread>(process, 28374);
+  MockThread* thread = owning_thread.get();
+  process->InjectThreadForTest(std::move(owning_thread));
+
+  // The breakpoint only applies when the IP register is at kAddress.
+  debug_ipc::AutomationOperand ip_operand;
+  ip_operand.InitRegister(
+      debug::GetSpecialRegisterID(arch::GetCurrentArch(), debug::SpecialRegisterType::kIP));
+  debug_ipc::AutomationCondition condition;
+  condition.InitEquals(ip_operand, kAddress);
+
+  constexpr uint32_t kBreakpointId = 12;
+  debug_ipc::BreakpointSettings settings;
+  settings.id = kBreakpointId;
+  settings.type = debug_ipc::BreakpointType::kSoftware;
+  settings.stop = debug_ipc::Stop::kThread;
+  settings.conditions.push_back(condition);
+  settings.ignore_count = 1;
+  settings.locations.resize(1);
+  settings.locations.back().id = {.process = kProcess1, .thread = 0};
+  settings.locations.back().address = kAddress;
+
+  Breakpoint breakpoint(&process_delegate);
+  ASSERT_TRUE(breakpoint.SetSettings(settings).ok());
+  ASSERT_EQ(1u, process_delegate.bps().size());
+  ProcessBreakpoint* process_breakpoint = process_delegate.bps().begin()->second.get();
+
+  GeneralRegisters regs;
+  std::vector<debug_ipc::BreakpointStats> stats;
+  std::vector<debug_ipc::ThreadRecord> affected_threads;
+
+  // A hit that doesn't match the condition is neither counted nor reported.
+  regs.set_ip(kAddress + 4);
+  EXPECT_FALSE(process_breakpoint->OnHit(thread, debug_ipc::BreakpointType::kSoftware, regs,
+                                         stats, affected_threads));
+  EXPECT_TRUE(stats.empty());
+  EXPECT_EQ(0u, breakpoint.stats().hit_count);
+
+  // The first matching hit is counted but ignored.
+  regs.set_ip(kAddress);
+  EXPECT_FALSE(process_breakpoint->OnHit(thread, debug_ipc::BreakpointType::kSoftware, regs,
+                                         stats, affected_threads));
+  EXPECT_TRUE(stats.empty());
+  EXPECT_EQ(1u, breakpoint.stats().hit_count);
+
+  // The next one stops.
+  EXPECT_TRUE(process_breakpoint->OnHit(thread, debug_ipc::BreakpointType::kSoftware, regs, stats,
+                                        affected_threads));
+  ASSERT_EQ(1u, stats.size());
+  EXPECT_EQ(kBreakpointId, stats[0].id);
+  EXPECT_EQ(2u, stats[0].hit_count);
+}
+
 }  // namespace debug_agent
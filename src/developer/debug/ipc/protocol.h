@@ -37,7 +37,7 @@ namespace debug_ipc {
 // CURRENT_SUPPORTED_API_LEVEL is equal to the numbered API level currently represented by "NEXT".
 // If not, continue reading the comments below.
 
-constexpr uint32_t kCurrentProtocolVersion = 66;
+constexpr uint32_t kCurrentProtocolVersion = 68;
 
 // How to decide kMinimumProtocolVersion
 // -------------------------------------
@@ -106,7 +106,8 @@ static_assert(static_cast<int>(debug::Arch::kArm64) == 2);
   FN(UpdateGlobalSettings)        \
   FN(SaveMinidump)                \
   FN(RunComponent)                \
-  FN(RunTest)
+  FN(RunTest)                     \
+  FN(ReadMemoryBatch)
 
 // The "notify" messages are sent unrequested from the agent to the client.
 //
@@ -160,6 +161,7 @@ struct MsgHeader {
     kSaveMinidump = 24,
     kRunComponent = 25,
     kRunTest = 26,
+    kReadMemoryBatch = 27,
 
     kNotifyException = 101,
     kNotifyIO = 102,
@@ -398,6 +400,25 @@ struct ReadMemoryReply {
   void Serialize(Serializer& ser, uint32_t ver) { ser | blocks; }
 };
 
+// Reads several ranges of a process's memory with one request. Each request costs a round trip,
+// which can be several milliseconds over a network connection, so clients that know a set of
+// addresses up-front should prefer this over a series of ReadMemory requests.
+struct ReadMemoryBatchRequest {
+  static constexpr uint32_t kSupportedSinceVersion = 67;
+
+  uint64_t process_koid = 0;
+  std::vector<MemoryRange> ranges;
+
+  void Serialize(Serializer& ser, uint32_t ver) { ser | process_koid | ranges; }
+};
+struct ReadMemoryBatchReply {
+  // One entry for each requested range, in the same order, with the blocks a ReadMemoryReply for
+  // that range would have. Empty if the process doesn't exist.
+  std::vector<std::vector<MemoryBlock>> blocks;
+
+  void Serialize(Serializer& ser, uint32_t ver) { ser | blocks; }
+};
+
 struct AddOrChangeBreakpointRequest {
   BreakpointSettings breakpoint;
 
@@ -421,6 +421,55 @@ TEST(Protocol, ReadMemoryReply) {
   EXPECT_TRUE(second.blocks[1].data.empty());
 }
 
+TEST(Protocol, ReadMemoryBatchRequest) {
+  ReadMemoryBatchRequest initial;
+  initial.process_koid = 91823765;
+  initial.ranges.push_back({.address = 983462384, .size = 8});
+  initial.ranges.push_back({.address = 0x1000, .size = 0x2000});
+
+  ReadMemoryBatchRequest second;
+  ASSERT_TRUE(SerializeDeserialize(initial, &second));
+  EXPECT_EQ(initial.process_koid, second.process_koid);
+  ASSERT_EQ(2u, second.ranges.size());
+  EXPECT_EQ(initial.ranges[0].address, second.ranges[0].address);
+  EXPECT_EQ(initial.ranges[0].size, second.ranges[0].size);
+  EXPECT_EQ(initial.ranges[1].address, second.ranges[1].address);
+  EXPECT_EQ(initial.ranges[1].size, second.ranges[1].size);
+}
+
+TEST(Protocol, ReadMemoryBatchReply) {
+  ReadMemoryBatchReply initial;
+  initial.blocks.resize(2);
+  initial.blocks[0].resize(1);
+  initial.blocks[0][0].address = 876234;
+  initial.blocks[0][0].valid = true;
+  initial.blocks[0][0].size = 4;
+  initial.blocks[0][0].data = {1, 2, 3, 4};
+  initial.blocks[1].resize(2);
+  initial.blocks[1][0].address = 0x1000;
+  initial.blocks[1][0].valid = false;
+  initial.blocks[1][0].size = 0x1000;
+  initial.blocks[1][1].address = 0x2000;
+  initial.blocks[1][1].valid = true;
+  initial.blocks[1][1].size = 1;
+  initial.blocks[1][1].data = {9};
+
+  ReadMemoryBatchReply second;
+  ASSERT_TRUE(SerializeDeserialize(initial, &second));
+
+  ASSERT_EQ(2u, second.blocks.size());
+  ASSERT_EQ(1u, second.blocks[0].size());
+  EXPECT_EQ(initial.blocks[0][0].address, second.blocks[0][0].address);
+  EXPECT_TRUE(second.blocks[0][0].valid);
+  EXPECT_EQ(initial.blocks[0][0].data, second.blocks[0][0].data);
+  ASSERT_EQ(2u, second.blocks[1].size());
+  EXPECT_EQ(initial.blocks[1][0].address, second.blocks[1][0].address);
+  EXPECT_FALSE(second.blocks[1][0].valid);
+  EXPECT_EQ(initial.blocks[1][0].size, second.blocks[1][0].size);
+  EXPECT_TRUE(second.blocks[1][0].data.empty());
+  EXPECT_EQ(initial.blocks[1][1].data, second.blocks[1][1].data);
+}
+
 // AddOrChangeBreakpoint ---------------------------------------------------------------------------
 
 TEST(Protocol, AddOrChangeBreakpointRequest) {
@@ -453,6 +502,9 @@ TEST(Protocol, AddOrChangeBreakpointRequest) {
   initial.breakpoint.instructions[0].InitLoopLoadMemory(
       address, length, struct_pointer_offset, struct_length_offset, item_size, conditions);
 
+  initial.breakpoint.conditions.push_back(conditions[0]);
+  initial.breakpoint.ignore_count = 3;
+
   ProcessBreakpointSettings& pr_settings = initial.breakpoint.locations.back();
   pr_settings.id = {.process = 1234, .thread = 14612};
   pr_settings.address = 0x723456234;
@@ -534,6 +586,14 @@ TEST(Protocol, AddOrChangeBreakpointRequest) {
             second.breakpoint.instructions[0].conditions()[1].constant());
   EXPECT_EQ(initial.breakpoint.instructions[0].conditions()[1].mask(),
             second.breakpoint.instructions[0].conditions()[1].mask());
+
+  ASSERT_EQ(1u, second.breakpoint.conditions.size());
+  EXPECT_EQ(initial.breakpoint.conditions[0].kind(), second.breakpoint.conditions[0].kind());
+  EXPECT_EQ(initial.breakpoint.conditions[0].operand().index(),
+            second.breakpoint.conditions[0].operand().index());
+  EXPECT_EQ(initial.breakpoint.conditions[0].constant(),
+            second.breakpoint.conditions[0].constant());
+  EXPECT_EQ(initial.breakpoint.ignore_count, second.breakpoint.ignore_count);
 }
 
 TEST(Protocol, AddOrChangeBreakpointReply) {
@@ -354,6 +354,14 @@ struct MemoryBlock {
   void Serialize(Serializer& ser, uint32_t ver) { ser | address | valid | size | data; }
 };
 
+// A range of memory to read, see ReadMemoryBatchRequest.
+struct MemoryRange {
+  uint64_t address = 0;
+  uint32_t size = 0;
+
+  void Serialize(Serializer& ser, uint32_t ver) { ser | address | size; }
+};
+
 struct ProcessBreakpointSettings {
   // The process is required to be nonzero. A zero thread ID indicates this is a process-wide
   // breakpoint. Otherwise, this is the thread to break.
@@ -425,8 +433,20 @@ struct BreakpointSettings {
 
   std::vector<debug_ipc::AutomationInstruction> instructions;
 
+  // Conditions evaluated by the debug_agent each time the breakpoint is hit, before anything is
+  // reported to the client. When any of them is false the hit is ignored: it is not counted and
+  // the thread is resumed without a notification. An empty vector always matches.
+  std::vector<debug_ipc::AutomationCondition> conditions;
+
+  // Number of matching hits to count but otherwise ignore before the breakpoint stops. A value of
+  // 2 means the breakpoint stops from the third hit on.
+  uint32_t ignore_count = 0;
+
   void Serialize(Serializer& ser, uint32_t ver) {
     ser | id | type | name | one_shot | stop | locations | has_automation | instructions;
+    if (ver >= 68) {
+      ser | conditions | ignore_count;
+    }
   }
 };
 
@@ -673,6 +673,24 @@ void MinidumpRemoteAPI::ReadMemory(const debug_ipc::ReadMemoryRequest& request,
   Succeed(std::move(cb), reply);
 }
 
+void MinidumpRemoteAPI::ReadMemoryBatch(
+    const debug_ipc::ReadMemoryBatchRequest& request,
+    fit::callback<void(const Err&, debug_ipc::ReadMemoryBatchReply)> cb) {
+  if (!minidump_) {
+    ErrNoDump(std::move(cb));
+    return;
+  }
+
+  debug_ipc::ReadMemoryBatchReply reply;
+
+  if (static_cast<pid_t>(request.process_koid) == minidump_->ProcessID()) {
+    for (const auto& range : request.ranges)
+      reply.blocks.push_back(memory_->ReadMemoryBlocks(range.address, range.size));
+  }
+
+  Succeed(std::move(cb), reply);
+}
+
 void MinidumpRemoteAPI::ReadRegisters(
     const debug_ipc::ReadRegistersRequest& request,
     fit::callback<void(const Err&, debug_ipc::ReadRegistersReply)> cb) {
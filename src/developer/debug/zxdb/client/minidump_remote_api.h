@@ -64,6 +64,9 @@ class MinidumpRemoteAPI : public RemoteAPI, public DownloadObserver {
                fit::callback<void(const Err&, debug_ipc::ThreadsReply)> cb) override;
   void ReadMemory(const debug_ipc::ReadMemoryRequest& request,
                   fit::callback<void(const Err&, debug_ipc::ReadMemoryReply)> cb) override;
+  void ReadMemoryBatch(
+      const debug_ipc::ReadMemoryBatchRequest& request,
+      fit::callback<void(const Err&, debug_ipc::ReadMemoryBatchReply)> cb) override;
   void ReadRegisters(const debug_ipc::ReadRegistersRequest& request,
                      fit::callback<void(const Err&, debug_ipc::ReadRegistersReply)> cb) override;
   void AddOrChangeBreakpoint(
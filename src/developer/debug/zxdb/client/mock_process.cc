@@ -66,6 +66,15 @@ void MockProcess::ReadMemory(uint64_t address, uint32_t size,
                                    [cb = std::move(cb)]() mutable { cb(Err(), MemoryDump()); });
 }
 
+void MockProcess::ReadMemoryBatch(
+    std::vector<debug_ipc::MemoryRange> ranges,
+    fit::callback<void(const Err&, std::vector<MemoryDump>)> cb) {
+  MessageLoop::Current()->PostTask(
+      FROM_HERE, [count = ranges.size(), cb = std::move(cb)]() mutable {
+        cb(Err(), std::vector<MemoryDump>(count));
+      });
+}
+
 void MockProcess::WriteMemory(uint64_t address, std::vector<uint8_t> data,
                               fit::callback<void(const Err&)> callback) {
   // Currently always just report success.
@@ -54,6 +54,8 @@ class MockProcess : public Process {
   void GetTLSHelpers(GetTLSHelpersCallback cb) override;
   void ReadMemory(uint64_t address, uint32_t size,
                   fit::callback<void(const Err&, MemoryDump)> callback) override;
+  void ReadMemoryBatch(std::vector<debug_ipc::MemoryRange> ranges,
+                       fit::callback<void(const Err&, std::vector<MemoryDump>)> callback) override;
   void WriteMemory(uint64_t address, std::vector<uint8_t> data,
                    fit::callback<void(const Err&)> callback) override;
   void LoadInfoHandleTable(
@@ -108,6 +108,26 @@ void MockRemoteAPI::ReadMemory(const debug_ipc::ReadMemoryRequest& request,
                                           });
 }
 
+void MockRemoteAPI::ReadMemoryBatch(
+    const debug_ipc::ReadMemoryBatchRequest& request,
+    fit::callback<void(const Err&, debug_ipc::ReadMemoryBatchReply)> cb) {
+  // Each range is returned as one block, like ReadMemory() above.
+  debug_ipc::ReadMemoryBatchReply reply;
+  for (const auto& range : request.ranges) {
+    auto& block = reply.blocks.emplace_back().emplace_back();
+    block.address = range.address;
+    block.valid = range.size > 0;
+    block.size = range.size;
+    if (block.valid)
+      block.data = memory_.ReadMemory(range.address, range.size);
+  }
+
+  debug::MessageLoop::Current()->PostTask(
+      FROM_HERE, [reply = std::move(reply), cb = std::move(cb)]() mutable {
+        cb(Err(), std::move(reply));
+      });
+}
+
 void MockRemoteAPI::ReadRegisters(
     const debug_ipc::ReadRegistersRequest& request,
     fit::callback<void(const Err&, debug_ipc::ReadRegistersReply)> cb) {
@@ -75,6 +75,9 @@ class MockRemoteAPI : public RemoteAPI {
               fit::callback<void(const Err&, debug_ipc::ResumeReply)> cb) override;
   void ReadMemory(const debug_ipc::ReadMemoryRequest& request,
                   fit::callback<void(const Err&, debug_ipc::ReadMemoryReply)> cb) override;
+  void ReadMemoryBatch(
+      const debug_ipc::ReadMemoryBatchRequest& request,
+      fit::callback<void(const Err&, debug_ipc::ReadMemoryBatchReply)> cb) override;
   void ReadRegisters(const debug_ipc::ReadRegistersRequest& request,
                      fit::callback<void(const Err&, debug_ipc::ReadRegistersReply)> cb) override;
   void WriteRegisters(const debug_ipc::WriteRegistersRequest& request,
@@ -153,6 +153,14 @@ class Process : public ClientObject {
   virtual void ReadMemory(uint64_t address, uint32_t size,
                           fit::callback<void(const Err&, MemoryDump)> callback) = 0;
 
+  // Reads several ranges of memory from the debugged process with one request to the debug agent.
+  // On success the callback receives one MemoryDump for each range, in the same order. Prefer this
+  // over several ReadMemory() calls when the addresses are known up-front since each request is a
+  // round trip to the target.
+  virtual void ReadMemoryBatch(
+      std::vector<debug_ipc::MemoryRange> ranges,
+      fit::callback<void(const Err&, std::vector<MemoryDump>)> callback) = 0;
+
   // Write memory to the debugged process.
   virtual void WriteMemory(uint64_t address, std::vector<uint8_t> data,
                            fit::callback<void(const Err&)> callback) = 0;
@@ -8,6 +8,7 @@
 #include <lib/syslog/cpp/macros.h>
 
 #include <algorithm>
+#include <memory>
 #include <set>
 
 #include "lib/fit/defer.h"
@@ -226,6 +227,33 @@ void ProcessImpl::ReadMemory(uint64_t address, uint32_t size,
       });
 }
 
+void ProcessImpl::ReadMemoryBatch(
+    std::vector<debug_ipc::MemoryRange> ranges,
+    fit::callback<void(const Err&, std::vector<MemoryDump>)> callback) {
+  debug_ipc::ReadMemoryBatchRequest request;
+  request.process_koid = koid_;
+  request.ranges = ranges;
+  session()->remote_api()->ReadMemoryBatch(
+      request, [this, weak_this = GetWeakPtr(), ranges = std::move(ranges),
+                callback = std::move(callback)](
+                   const Err& err, debug_ipc::ReadMemoryBatchReply reply) mutable {
+        if (err.type() == ErrType::kNotSupported && weak_this) {
+          ReadMemoryRangesSeparately(std::move(ranges), std::move(callback));
+          return;
+        }
+        if (err.has_error()) {
+          callback(err, {});
+          return;
+        }
+
+        // The reply is empty if the process is gone, which reads as empty dumps like ReadMemory().
+        std::vector<MemoryDump> dumps(ranges.size());
+        for (size_t i = 0; i < dumps.size() && i < reply.blocks.size(); i++)
+          dumps[i] = MemoryDump(std::move(reply.blocks[i]));
+        callback(Err(), std::move(dumps));
+      });
+}
+
 void ProcessImpl::WriteMemory(uint64_t address, std::vector<uint8_t> data,
                               fit::callback<void(const Err&)> callback) {
   debug_ipc::WriteMemoryRequest request;
@@ -468,14 +496,53 @@ void ProcessImpl::LoadTLSHelpers() {
         helper_waiters_.clear();
       }));
 
+  std::vector<debug_ipc::MemoryRange> ranges;
   for (const auto& region : regions) {
-    ReadMemory(region.addr, region.size,
-               [target = region.target, weak_this = GetWeakPtr(), finish](const Err& err,
-                                                                          MemoryDump dump) {
-                 if (weak_this && !err.has_error() && dump.AllValid()) {
-                   for (const auto& block : dump.blocks()) {
-                     std::copy(block.data.begin(), block.data.end(), std::back_inserter(*target));
-                   }
+    ranges.push_back({.address = region.addr, .size = static_cast<uint32_t>(region.size)});
+  }
+
+  ReadMemoryBatch(std::move(ranges), [regions, weak_this = GetWeakPtr(), finish](
+                                         const Err& err, std::vector<MemoryDump> dumps) {
+    if (!weak_this || err.has_error())
+      return;
+    for (size_t i = 0; i < regions.size() && i < dumps.size(); i++) {
+      if (dumps[i].AllValid()) {
+        for (const auto& block : dumps[i].blocks()) {
+          std::copy(block.data.begin(), block.data.end(), std::back_inserter(*regions[i].target));
+        }
+      }
+    }
+  });
+}
+
+void ProcessImpl::ReadMemoryRangesSeparately(
+    std::vector<debug_ipc::MemoryRange> ranges,
+    fit::callback<void(const Err&, std::vector<MemoryDump>)> callback) {
+  struct State {
+    std::vector<MemoryDump> dumps;
+    Err err;
+    fit::callback<void(const Err&, std::vector<MemoryDump>)> callback;
+  };
+  auto state = std::make_shared<State>();
+  state->dumps.resize(ranges.size());
+  state->callback = std::move(callback);
+
+  // Issues the callback once the last read completes and drops its reference to the state.
+  auto finish = std::make_shared<fit::deferred_callback>(fit::defer_callback([state]() {
+    if (state->err.has_error()) {
+      state->callback(state->err, {});
+    } else {
+      state->callback(Err(), std::move(state->dumps));
+    }
+  }));
+
+  for (size_t i = 0; i < ranges.size(); i++) {
+    ReadMemory(ranges[i].address, ranges[i].size,
+               [state, finish, i](const Err& err, MemoryDump dump) {
+                 if (err.has_error()) {
+                   state->err = err;
+                 } else {
+                   state->dumps[i] = std::move(dump);
                  }
                });
   }
@@ -62,6 +62,8 @@ class ProcessImpl : public Process, public ProcessSymbols::Notifications {
   void GetTLSHelpers(GetTLSHelpersCallback cb) override;
   void ReadMemory(uint64_t address, uint32_t size,
                   fit::callback<void(const Err&, MemoryDump)> callback) override;
+  void ReadMemoryBatch(std::vector<debug_ipc::MemoryRange> ranges,
+                       fit::callback<void(const Err&, std::vector<MemoryDump>)> callback) override;
   void WriteMemory(uint64_t address, std::vector<uint8_t> data,
                    fit::callback<void(const Err&)> callback) override;
   void LoadInfoHandleTable(
@@ -112,6 +114,12 @@ class ProcessImpl : public Process, public ProcessSymbols::Notifications {
   // Load the TLS helpers.
   void LoadTLSHelpers();
 
+  // Implements ReadMemoryBatch() with one ReadMemory() per range for debug agents that predate the
+  // batch request.
+  void ReadMemoryRangesSeparately(
+      std::vector<debug_ipc::MemoryRange> ranges,
+      fit::callback<void(const Err&, std::vector<MemoryDump>)> callback);
+
   // Updates modules with empty names to reflect the name of the process binary. By convention,
   // the dynamic loader will set the main binary to have a blank name.
   void FixupEmptyModuleNames(std::vector<debug_ipc::Module>& modules) const;
@@ -21,6 +21,7 @@
 #include <llvm/Object/ELFObjectFile.h>
 #include <llvm/Object/ObjectFile.h>
 #include <llvm/Support/Error.h>
+#include <llvm/Support/WithColor.h>
 
 #include "src/developer/debug/shared/logging/logging.h"
 #include "src/developer/debug/zxdb/common/file_util.h"
@@ -220,10 +221,11 @@ Err DwarfBinaryImpl::Load(fxl::WeakPtr<DwarfSymbolFactory::Delegate> delegate,
   binary_buffer_ = std::move(binary_pair.second);
   binary_ = std::move(binary_pair.first);
 
-  // Overwrite the default Error handler object, but leave everything else default.
-  context_ = llvm::DWARFContext::create(*GetLLVMObjectFile(),
-                                        llvm::DWARFContext::ProcessDebugRelocations::Process,
-                                        nullptr, "", &LLVMErrorHandler);
+  // Overwrite the default Error handler object, but leave everything else default except for
+  // thread safety: Index::CreateIndex() scans the units of large binaries on several threads.
+  context_ = llvm::DWARFContext::create(
+      *GetLLVMObjectFile(), llvm::DWARFContext::ProcessDebugRelocations::Process, nullptr, "",
+      &LLVMErrorHandler, llvm::WithColor::defaultWarningHandler, /*ThreadSafe=*/true);
 
   return Err();
 }
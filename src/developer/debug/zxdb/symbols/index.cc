@@ -4,13 +4,20 @@
 
 #include "src/developer/debug/zxdb/symbols/index.h"
 
+#include <string.h>
+
+#include <algorithm>
+#include <condition_variable>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
 #include "llvm/DebugInfo/DWARF/DWARFDebugInfoEntry.h"
 #include "src/developer/debug/shared/string_util.h"
 #include "src/developer/debug/zxdb/common/adapters.h"
 #include "src/developer/debug/zxdb/common/file_util.h"
+#include "src/developer/debug/zxdb/common/worker_pool.h"
 #include "src/developer/debug/zxdb/symbols/dwarf_binary_impl.h"
 #include "src/developer/debug/zxdb/symbols/dwarf_die_decoder.h"
 #include "src/developer/debug/zxdb/symbols/dwarf_die_scanner.h"
@@ -25,6 +32,10 @@ namespace {
 // Don't index more than this number of levels to prevent infinite recursion.
 constexpr size_t kMaxParentPath = 16;
 
+// Number of threads scanning units for Index::IndexUnitsInParallel(). Beyond this the serial
+// insertion of the scanned units into the tree on the calling thread becomes the bottleneck.
+constexpr size_t kIndexWorkerThreads = 6;
+
 // Stores a name with a SymbolRef for later indexing.
 class NamedSymbolRef : public IndexNode::SymbolRef {
  public:
@@ -626,29 +637,247 @@ void RecursiveFindExact(const IndexNode* node, const Identifier& input, size_t i
     RecursiveFindExact(&found->second, input, input_index, result);
 }
 
+// Identifies the serialized index format. Bump the version whenever the encoding or the indexing
+// rules change so that stale cache files are rebuilt.
+constexpr std::string_view kSerializedMagic = "ZXDBINDX";
+constexpr uint32_t kSerializedVersion = 1;
+
+// Child nodes are nested at most kMaxParentPath deep by the indexer, so anything much deeper than
+// that in serialized data is corrupt (and would otherwise recurse without bound).
+constexpr int kMaxSerializedDepth = kMaxParentPath * 2;
+
+class IndexWriter {
+ public:
+  explicit IndexWriter(std::string& out) : out_(out) {}
+
+  void WriteU32(uint32_t value) { WriteRaw(&value, sizeof(value)); }
+  void WriteU64(uint64_t value) { WriteRaw(&value, sizeof(value)); }
+
+  void WriteString(std::string_view str) {
+    WriteU32(static_cast<uint32_t>(str.size()));
+    out_.append(str);
+  }
+
+  void WriteRef(const IndexNode::SymbolRef& ref) {
+    WriteU32(ref.kind());
+    WriteU32(static_cast<uint32_t>(ref.dwo_index()));
+    WriteU64(ref.offset());
+  }
+
+  void WriteNode(const IndexNode& node) {
+    for (int i = 0; i < static_cast<int>(IndexNode::Kind::kEndPhysical); i++) {
+      const IndexNode::Map& map = node.MapForKind(static_cast<IndexNode::Kind>(i));
+      WriteU32(static_cast<uint32_t>(map.size()));
+      for (const auto& [name, child] : map) {
+        WriteString(name);
+        WriteNode(child);
+      }
+    }
+    WriteU32(static_cast<uint32_t>(node.dies().size()));
+    for (const auto& ref : node.dies())
+      WriteRef(ref);
+  }
+
+ private:
+  void WriteRaw(const void* value, size_t size) {
+    out_.append(reinterpret_cast<const char*>(value), size);
+  }
+
+  std::string& out_;
+};
+
+class IndexReader {
+ public:
+  explicit IndexReader(std::string_view data) : data_(data) {}
+
+  bool at_end() const { return data_.empty(); }
+
+  bool ReadU32(uint32_t* value) { return ReadRaw(value, sizeof(*value)); }
+  bool ReadU64(uint64_t* value) { return ReadRaw(value, sizeof(*value)); }
+
+  bool ReadString(std::string* str) {
+    uint32_t size;
+    if (!ReadU32(&size) || size > data_.size())
+      return false;
+    str->assign(data_.substr(0, size));
+    data_.remove_prefix(size);
+    return true;
+  }
+
+  bool ReadRef(IndexNode::SymbolRef* ref) {
+    uint32_t kind, dwo_index;
+    uint64_t offset;
+    if (!ReadU32(&kind) || !ReadU32(&dwo_index) || !ReadU64(&offset))
+      return false;
+    if (kind != IndexNode::SymbolRef::kDwarf && kind != IndexNode::SymbolRef::kDwarfDeclaration)
+      return false;
+    *ref = IndexNode::SymbolRef(static_cast<IndexNode::SymbolRef::Kind>(kind),
+                                static_cast<int32_t>(dwo_index), offset);
+    return true;
+  }
+
+  bool ReadNode(IndexNode* node, int depth) {
+    if (depth > kMaxSerializedDepth)
+      return false;
+
+    for (int i = 0; i < static_cast<int>(IndexNode::Kind::kEndPhysical); i++) {
+      const auto kind = static_cast<IndexNode::Kind>(i);
+      IndexNode::Map& map = node->MapForKind(kind);
+      uint32_t count;
+      if (!ReadU32(&count))
+        return false;
+      for (uint32_t child_index = 0; child_index < count; child_index++) {
+        std::string name;
+        if (!ReadString(&name))
+          return false;
+        // The names were written in map order, so each one goes at the end.
+        auto child = map.emplace_hint(map.end(), std::move(name), IndexNode(kind));
+        if (!ReadNode(&child->second, depth + 1))
+          return false;
+      }
+    }
+
+    uint32_t die_count;
+    if (!ReadU32(&die_count))
+      return false;
+    // Only types, functions, and variables store DIEs (see IndexNode::AddDie()).
+    if (die_count > 0 && node->kind() != IndexNode::Kind::kType &&
+        node->kind() != IndexNode::Kind::kFunction && node->kind() != IndexNode::Kind::kVar)
+      return false;
+    for (uint32_t i = 0; i < die_count; i++) {
+      IndexNode::SymbolRef ref;
+      if (!ReadRef(&ref))
+        return false;
+      node->AddDie(ref);
+    }
+    return true;
+  }
+
+ private:
+  bool ReadRaw(void* value, size_t size) {
+    if (data_.size() < size)
+      return false;
+    memcpy(value, data_.data(), size);
+    data_.remove_prefix(size);
+    return true;
+  }
+
+  std::string_view data_;
+};
+
 }  // namespace
 
 void Index::CreateIndex(DwarfBinary& binary, int32_t dwo_index, bool force_slow_path) {
+  // The DwarfUnit objects are created lazily by the binary, which isn't thread-safe, so collect
+  // them all up-front.
+  //
+  // Index any DWO units too. .dwo files store their units in a separate DWARF section. Normally
+  // there will either be many normal units and no DWO units, or no normal units and exactly one
+  // DWO unit. But this loops over all of both for generality.
   size_t unit_count = binary.GetNormalUnitCount();
+  size_t dwo_unit_count = binary.GetDWOUnitCount();
+  UnitVector units;
+  units.reserve(unit_count + dwo_unit_count);
   for (size_t i = 0; i < unit_count; i++) {
     UnitIndex unit_index(false, i);
     if (auto unit_ref_ptr = binary.GetUnitAtIndex(unit_index))
-      IndexCompileUnit(*unit_ref_ptr, dwo_index, unit_index, force_slow_path);
+      units.emplace_back(unit_index, std::move(unit_ref_ptr));
   }
-
-  // Index any DWO units. .dwo files store their units in a separate DWARF section. Normally there
-  // will either be many normal units and no DWO units, or no normal units and exactly one DWO unit.
-  // But this loops over all of both for generality.
-  size_t dwo_unit_count = binary.GetDWOUnitCount();
   for (size_t i = 0; i < dwo_unit_count; i++) {
     UnitIndex unit_index(true, i);
     if (auto unit_ref_ptr = binary.GetUnitAtIndex(unit_index))
-      IndexCompileUnit(*unit_ref_ptr, dwo_index, unit_index, force_slow_path);
+      units.emplace_back(unit_index, std::move(unit_ref_ptr));
+  }
+
+  if (units.size() >= parallel_unit_threshold_) {
+    IndexUnitsInParallel(units, dwo_index, force_slow_path);
+  } else {
+    for (const auto& [unit_index, unit] : units)
+      IndexCompileUnit(*unit, dwo_index, unit_index, force_slow_path);
   }
 
   IndexFileNames();
 }
 
+// Scanning a unit (extracting and decoding all of its DIEs, and parsing its line table) only
+// touches that unit and is most of the cost of indexing, so it is done on worker threads. Adding
+// the scanned entries to the tree is done on this thread, one unit at a time in unit order, so the
+// result is the same as indexing serially and the tree needs no locking.
+void Index::IndexUnitsInParallel(const UnitVector& units, int32_t dwo_index,
+                                 bool force_slow_path) {
+  struct ScannedUnit {
+    bool done = false;
+    llvm::DWARFDie unit_die;
+
+    // Null for skeleton units and invalid units, which have nothing to scan.
+    std::unique_ptr<UnitIndexer> indexer;
+    std::vector<IndexNode::SymbolRef> main_functions;
+  };
+
+  std::mutex mutex;
+  std::condition_variable scan_done;               // Signaled when any entry becomes done.
+  std::vector<ScannedUnit> scanned(units.size());  // Guarded by mutex.
+
+  auto scan = [&units, &mutex, &scan_done, &scanned, dwo_index, force_slow_path](size_t i) {
+    const DwarfUnit& unit = *units[i].second;
+
+    ScannedUnit result;
+    result.unit_die = unit.GetUnitDie();
+    if (result.unit_die.isValid() &&
+        static_cast<int>(result.unit_die.getTag()) != static_cast<int>(DwarfTag::kSkeletonUnit)) {
+      result.indexer = std::make_unique<UnitIndexer>(unit, dwo_index);
+      result.indexer->set_force_slow_path(force_slow_path);
+      result.indexer->Scan(&result.main_functions);
+    }
+
+    // Parses the line table into the LLVM context's cache for IndexCompileUnitSourceFiles().
+    unit.GetLLVMLineTable();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      scanned[i] = std::move(result);
+      scanned[i].done = true;
+    }
+    scan_done.notify_all();
+  };
+
+  // Only keep a bounded number of units scanned ahead of this thread so the memory used by the
+  // scan results is proportional to the number of workers rather than the size of the binary.
+  WorkerPool pool(kIndexWorkerThreads);
+  size_t next_to_scan = 0;
+  auto post_next_scan = [&]() {
+    if (next_to_scan < units.size()) {
+      pool.PostTask([&scan, i = next_to_scan]() { scan(i); });
+      next_to_scan++;
+    }
+  };
+  for (size_t i = 0; i < kIndexWorkerThreads * 4; i++)
+    post_next_scan();
+
+  for (size_t i = 0; i < units.size(); i++) {
+    ScannedUnit unit_scan;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      scan_done.wait(lock, [&scanned, i]() { return scanned[i].done; });
+      unit_scan = std::move(scanned[i]);
+    }
+    post_next_scan();
+
+    const auto& [unit_index, unit] = units[i];
+    if (!unit_scan.unit_die.isValid())
+      continue;
+
+    if (unit_scan.indexer) {
+      main_functions_.insert(main_functions_.end(), unit_scan.main_functions.begin(),
+                             unit_scan.main_functions.end());
+      unit_scan.indexer->Index(&root_);
+      IndexCompileUnitSourceFiles(*unit, unit_index);
+    } else {
+      IndexSkeletonCompileUnit(*unit, unit_scan.unit_die, unit_index);
+    }
+  }
+}
+
 void Index::DumpFileIndex(std::ostream& out) const {
   for (const auto& [filename, file_index_entry] : file_name_index_) {
     const auto& [filepath, compilation_units] = *file_index_entry;
@@ -656,6 +885,95 @@ void Index::DumpFileIndex(std::ostream& out) const {
   }
 }
 
+void Index::Serialize(std::string& out) const {
+  IndexWriter writer(out);
+  out.append(kSerializedMagic);
+  writer.WriteU32(kSerializedVersion);
+
+  writer.WriteNode(root_);
+
+  writer.WriteU32(static_cast<uint32_t>(files_.size()));
+  for (const auto& [name, units] : files_) {
+    writer.WriteString(name);
+    writer.WriteU32(static_cast<uint32_t>(units.size()));
+    for (const UnitIndex& unit : units) {
+      writer.WriteU32(unit.is_dwo);
+      writer.WriteU32(unit.index);
+    }
+  }
+
+  writer.WriteU32(static_cast<uint32_t>(main_functions_.size()));
+  for (const auto& ref : main_functions_)
+    writer.WriteRef(ref);
+
+  writer.WriteU32(static_cast<uint32_t>(dwo_refs_.size()));
+  for (const SkeletonUnit& skeleton : dwo_refs_) {
+    writer.WriteU64(skeleton.skeleton_die_offset);
+    writer.WriteString(skeleton.dwo_name);
+    writer.WriteString(skeleton.comp_dir);
+    writer.WriteU64(skeleton.addr_base);
+  }
+}
+
+bool Index::Deserialize(std::string_view data) {
+  FX_DCHECK(files_.empty() && dwo_refs_.empty() && main_functions_.empty());
+
+  if (!debug::StringStartsWith(data, kSerializedMagic))
+    return false;
+  IndexReader reader(data.substr(kSerializedMagic.size()));
+
+  uint32_t version;
+  if (!reader.ReadU32(&version) || version != kSerializedVersion)
+    return false;
+
+  if (!reader.ReadNode(&root_, 0))
+    return false;
+
+  uint32_t file_count;
+  if (!reader.ReadU32(&file_count))
+    return false;
+  for (uint32_t i = 0; i < file_count; i++) {
+    std::string name;
+    uint32_t unit_count;
+    if (!reader.ReadString(&name) || !reader.ReadU32(&unit_count))
+      return false;
+    std::vector<UnitIndex>& units = files_.emplace_hint(files_.end(), std::move(name),
+                                                        std::vector<UnitIndex>())->second;
+    for (uint32_t unit_index = 0; unit_index < unit_count; unit_index++) {
+      uint32_t is_dwo, index;
+      if (!reader.ReadU32(&is_dwo) || !reader.ReadU32(&index))
+        return false;
+      units.emplace_back(is_dwo != 0, index);
+    }
+  }
+
+  uint32_t main_count;
+  if (!reader.ReadU32(&main_count))
+    return false;
+  for (uint32_t i = 0; i < main_count; i++) {
+    IndexNode::SymbolRef ref;
+    if (!reader.ReadRef(&ref))
+      return false;
+    main_functions_.push_back(ref);
+  }
+
+  uint32_t dwo_count;
+  if (!reader.ReadU32(&dwo_count))
+    return false;
+  for (uint32_t i = 0; i < dwo_count; i++) {
+    SkeletonUnit& skeleton = dwo_refs_.emplace_back();
+    if (!reader.ReadU64(&skeleton.skeleton_die_offset) || !reader.ReadString(&skeleton.dwo_name) ||
+        !reader.ReadString(&skeleton.comp_dir) || !reader.ReadU64(&skeleton.addr_base))
+      return false;
+  }
+
+  if (!reader.at_end())
+    return false;
+
+  IndexFileNames();
+  return true;
+}
+
 std::vector<IndexNode::SymbolRef> Index::FindExact(const Identifier& input) const {
   std::vector<IndexNode::SymbolRef> result;
   RecursiveFindExact(&root_, input, 0, &result);
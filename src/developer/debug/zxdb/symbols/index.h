@@ -9,12 +9,15 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "src/developer/debug/zxdb/symbols/identifier.h"
 #include "src/developer/debug/zxdb/symbols/index_node.h"
 #include "src/developer/debug/zxdb/symbols/skeleton_unit.h"
 #include "src/developer/debug/zxdb/symbols/unit_index.h"
 #include "src/lib/fxl/macros.h"
+#include "src/lib/fxl/memory/ref_ptr.h"
 
 namespace llvm {
 
@@ -48,11 +51,31 @@ class Index {
   // Normal callers will want to use the fast path (which internally falls back to the slow path
   // for cross unit references). Tests can set the force_slow_path flag to cause everything to be
   // indexed with the slow path for validation purposes.
+  //
+  // Binaries with at least parallel_unit_threshold() units have their units scanned on a pool of
+  // worker threads. The result is identical to indexing them serially.
   void CreateIndex(DwarfBinary& binary, int32_t dwo_index, bool force_slow_path = false);
 
+  // The default is high enough that small binaries and .dwo files (which have one unit each and are
+  // already indexed on their own threads) don't pay for the thread pool. Tests can lower it to
+  // exercise the parallel path on small binaries.
+  static constexpr size_t kDefaultParallelUnitThreshold = 16;
+  size_t parallel_unit_threshold() const { return parallel_unit_threshold_; }
+  void set_parallel_unit_threshold(size_t threshold) { parallel_unit_threshold_ = threshold; }
+
   // Dumps the file index to the stream for debugging.
   void DumpFileIndex(std::ostream& out) const;
 
+  // Appends a compact binary encoding of the whole index to |out|, and fills an empty index from
+  // such an encoding. Together these allow the index of a module to be cached on disk keyed by its
+  // build ID, since building it from DWARF can take many seconds for large binaries. Deserialize
+  // returns false if the data is truncated, corrupt, or from an incompatible version, in which case
+  // the index should be discarded.
+  //
+  // The encoding uses the host's byte order and is not meant to be moved between machines.
+  void Serialize(std::string& out) const;
+  bool Deserialize(std::string_view data);
+
   // Takes a fully-qualified name with namespaces and classes and template parameters and returns
   // the list of symbols which match exactly.
   //
@@ -89,6 +112,9 @@ class Index {
   size_t CountSymbolsIndexed() const;
 
  private:
+  using UnitVector = std::vector<std::pair<UnitIndex, fxl::RefPtr<DwarfUnit>>>;
+
+  void IndexUnitsInParallel(const UnitVector& units, int32_t dwo_index, bool force_slow_path);
   void IndexCompileUnit(const DwarfUnit& unit, int32_t dwo_index, UnitIndex unit_index,
                         bool force_slow_path);
   void IndexSkeletonCompileUnit(const DwarfUnit& unit, const llvm::DWARFDie& unit_die,
@@ -98,6 +124,8 @@ class Index {
   // Populates the file_name_index_ given a now-unchanging files_ map.
   void IndexFileNames();
 
+  size_t parallel_unit_threshold_ = kDefaultParallelUnitThreshold;
+
   // DWO files referenced by this symbol file. SymbolRef.dwo_index_ is an index into this vector.
   std::vector<SkeletonUnit> dwo_refs_;
 
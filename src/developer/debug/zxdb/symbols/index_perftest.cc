@@ -2,16 +2,42 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "src/developer/debug/zxdb/common/perf_test.h"
+#include "src/developer/debug/zxdb/symbols/dwarf_binary_impl.h"
 #include "src/developer/debug/zxdb/symbols/index.h"
+#include "src/developer/debug/zxdb/symbols/module_symbols_impl.h"
+#include "src/developer/debug/zxdb/symbols/test_symbol_module.h"
 
 namespace zxdb {
 
+// Compares building the index of a module from its DWARF to reading it back from the serialized
+// form that is saved in the symbol cache directory.
 TEST(ModuleLoad, Perf) {
-  PerfTimeLogger logger("zxdb", "ModuleLoad");
-  // TODO(brettw) write this.
+  TestSymbolModule setup(TestSymbolModule::kCheckedIn);
+  ASSERT_TRUE(setup.Init("", false).ok());
+
+  Index index;
+  {
+    PerfTimeLogger logger("zxdb", "ModuleLoad/IndexDwarf");
+    index.CreateIndex(*setup.symbols()->binary(), IndexNode::SymbolRef::kMainBinary);
+  }
+
+  std::string data;
+  {
+    PerfTimeLogger logger("zxdb", "ModuleLoad/SerializeIndex");
+    index.Serialize(data);
+  }
+
+  Index loaded;
+  {
+    PerfTimeLogger logger("zxdb", "ModuleLoad/DeserializeIndex");
+    ASSERT_TRUE(loaded.Deserialize(data));
+  }
+  EXPECT_EQ(index.CountSymbolsIndexed(), loaded.CountSymbolsIndexed());
 }
 
 }  // namespace zxdb
@@ -7,6 +7,7 @@
 #include <inttypes.h>
 #include <time.h>
 
+#include <limits>
 #include <ostream>
 #include <sstream>
 
@@ -282,6 +283,79 @@ TEST(Index, Fission) {
   EXPECT_EQ("main.dwo", index.dwo_refs()[1].dwo_name);
 }
 
+// Tests that scanning the units on worker threads produces the same index as the serial path.
+TEST(Index, ParallelMatchesSerial) {
+  TestSymbolModule setup(TestSymbolModule::kCheckedIn);
+  ASSERT_TRUE(setup.Init("", false).ok());
+
+  Index serial;
+  serial.set_parallel_unit_threshold(std::numeric_limits<size_t>::max());
+  serial.CreateIndex(*setup.symbols()->binary(), IndexNode::SymbolRef::kMainBinary);
+
+  Index parallel;
+  parallel.set_parallel_unit_threshold(1);
+  parallel.CreateIndex(*setup.symbols()->binary(), IndexNode::SymbolRef::kMainBinary);
+
+  std::ostringstream serial_symbols;
+  serial.root().Dump(serial_symbols, setup.symbols()->GetSymbolFactory(), 0);
+  std::ostringstream parallel_symbols;
+  parallel.root().Dump(parallel_symbols, setup.symbols()->GetSymbolFactory(), 0);
+  EXPECT_EQ(serial_symbols.str(), parallel_symbols.str());
+
+  std::ostringstream serial_files;
+  serial.DumpFileIndex(serial_files);
+  std::ostringstream parallel_files;
+  parallel.DumpFileIndex(parallel_files);
+  EXPECT_EQ(serial_files.str(), parallel_files.str());
+
+  EXPECT_EQ(serial.main_functions().size(), parallel.main_functions().size());
+}
+
+// Tests that an index read back from its serialized form matches the original.
+TEST(Index, SerializeRoundTrip) {
+  TestSymbolModule setup(TestSymbolModule::kCheckedIn);
+  ASSERT_TRUE(setup.Init("", false).ok());
+
+  Index index;
+  index.CreateIndex(*setup.symbols()->binary(), IndexNode::SymbolRef::kMainBinary);
+
+  std::string data;
+  index.Serialize(data);
+
+  Index loaded;
+  ASSERT_TRUE(loaded.Deserialize(data));
+
+  std::ostringstream expected_symbols;
+  index.root().Dump(expected_symbols, setup.symbols()->GetSymbolFactory(), 0);
+  std::ostringstream loaded_symbols;
+  loaded.root().Dump(loaded_symbols, setup.symbols()->GetSymbolFactory(), 0);
+  EXPECT_EQ(expected_symbols.str(), loaded_symbols.str());
+
+  std::ostringstream expected_files;
+  index.DumpFileIndex(expected_files);
+  std::ostringstream loaded_files;
+  loaded.DumpFileIndex(loaded_files);
+  EXPECT_EQ(expected_files.str(), loaded_files.str());
+
+  EXPECT_EQ(index.CountSymbolsIndexed(), loaded.CountSymbolsIndexed());
+  EXPECT_EQ(index.files_indexed(), loaded.files_indexed());
+
+  ASSERT_EQ(index.main_functions().size(), loaded.main_functions().size());
+  for (size_t i = 0; i < index.main_functions().size(); i++) {
+    EXPECT_EQ(index.main_functions()[i].kind(), loaded.main_functions()[i].kind());
+    EXPECT_EQ(index.main_functions()[i].dwo_index(), loaded.main_functions()[i].dwo_index());
+    EXPECT_EQ(index.main_functions()[i].offset(), loaded.main_functions()[i].offset());
+  }
+
+  // Truncated or foreign data is rejected.
+  Index truncated;
+  EXPECT_FALSE(truncated.Deserialize(std::string_view(data).substr(0, data.size() - 1)));
+  std::string bad_magic = data;
+  bad_magic[0] ^= 0xff;
+  Index wrong_magic;
+  EXPECT_FALSE(wrong_magic.Deserialize(bad_magic));
+}
+
 // Enable and substitute a path on your system to dump the index for a DWARF file.
 #if 0
 TEST(Index, DumpIndex) {
@@ -7,6 +7,8 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <set>
 
@@ -957,6 +959,9 @@ Location ModuleSymbolsImpl::MakeElfSymbolLocation(const SymbolContext& symbol_co
 }
 
 void ModuleSymbolsImpl::CreateIndex() {
+  if (LoadCachedIndex())
+    return;
+
   // Create the index for the main binary.
   //
   // We could consider creating a new binary/object file just for indexing. The indexing will page
@@ -976,6 +981,55 @@ void ModuleSymbolsImpl::CreateIndex() {
       dwo_skeleton_offset_to_index_[dwos_[i]->skeleton().skeleton_die_offset] = i;
     }
   }
+
+  SaveCachedIndex();
+}
+
+bool ModuleSymbolsImpl::LoadCachedIndex() {
+  if (index_cache_path_.empty())
+    return false;
+
+  std::ifstream file(index_cache_path_, std::ios::binary);
+  if (!file)
+    return false;
+  std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  // Modules with .dwo files are never saved (see SaveCachedIndex()), so a cached index that
+  // references them can't be trusted.
+  auto index = std::make_unique<Index>();
+  if (!index->Deserialize(data) || !index->dwo_refs().empty())
+    return false;
+
+  index_ = std::move(index);
+  return true;
+}
+
+void ModuleSymbolsImpl::SaveCachedIndex() const {
+  // The .dwo files have to be opened and loaded on every run anyway, so there's little to be saved
+  // by caching the index of a binary that uses them.
+  if (index_cache_path_.empty() || !index_->dwo_refs().empty())
+    return;
+
+  std::string data;
+  index_->Serialize(data);
+
+  // Write to a temporary file and rename it into place so that a concurrent or interrupted
+  // debugger never reads a partial index.
+  std::error_code ec;
+  std::filesystem::create_directories(index_cache_path_.parent_path(), ec);
+  if (ec)
+    return;
+
+  std::filesystem::path temp_path = index_cache_path_;
+  temp_path += ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file.write(data.data(), static_cast<std::streamsize>(data.size())))
+      return;
+  }
+  std::filesystem::rename(temp_path, index_cache_path_, ec);
+  if (ec)
+    std::filesystem::remove(temp_path, ec);
 }
 
 void ModuleSymbolsImpl::FillElfSymbols() {
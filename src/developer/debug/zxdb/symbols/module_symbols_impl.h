@@ -5,6 +5,7 @@
 #ifndef SRC_DEVELOPER_DEBUG_ZXDB_SYMBOLS_MODULE_SYMBOLS_IMPL_H_
 #define SRC_DEVELOPER_DEBUG_ZXDB_SYMBOLS_MODULE_SYMBOLS_IMPL_H_
 
+#include <filesystem>
 #include <map>
 #include <unordered_map>
 
@@ -53,6 +54,12 @@ class ModuleSymbolsImpl final : public ModuleSymbols, public DwarfSymbolFactory:
   // from its name, e.g., in some test scenarios or in symbolizer.
   Err Load(bool create_index);
 
+  // Sets the file used to persist the symbol index between debugger sessions. Must be called
+  // before Load(). When set, Load() reads the index from this file if it is present and valid
+  // instead of walking the DWARF, and writes the newly created index to it otherwise. Since the
+  // file is keyed only by its path, callers should name it by the build ID.
+  void set_index_cache_path(std::filesystem::path path) { index_cache_path_ = std::move(path); }
+
   DwarfBinaryImpl* binary() { return binary_.get(); }
 
   fxl::WeakPtr<ModuleSymbolsImpl> GetWeakPtr();
@@ -171,6 +178,11 @@ class ModuleSymbolsImpl final : public ModuleSymbols, public DwarfSymbolFactory:
   // Fills the index and populates the dwo files.
   void CreateIndex();
 
+  // Reads and writes index_ from index_cache_path_. Loading returns false if there is no usable
+  // cached index. Saving is best-effort since the cache is only an optimization.
+  bool LoadCachedIndex();
+  void SaveCachedIndex() const;
+
   // Fills the forward and backward indices for ELF symbols.
   void FillElfSymbols();
 
@@ -186,6 +198,9 @@ class ModuleSymbolsImpl final : public ModuleSymbols, public DwarfSymbolFactory:
 
   std::string build_dir_;
 
+  // See set_index_cache_path(). Empty means the index is not cached.
+  std::filesystem::path index_cache_path_;
+
   // Guaranteed non-null. This is a unique pointer to allow us to move it despite the Index object
   // being non-moveable.
   std::unique_ptr<Index> index_;
@@ -4,6 +4,7 @@
 
 #include "src/developer/debug/zxdb/symbols/system_symbols.h"
 
+#include <filesystem>
 #include <memory>
 
 #include "src/developer/debug/zxdb/common/file_util.h"
@@ -95,6 +96,8 @@ Err SystemSymbols::GetModule(const std::string& name, const std::string& build_i
 
   auto binary = std::make_unique<DwarfBinaryImpl>(entry.debug_info, entry.binary, build_id);
   auto module_impl = fxl::MakeRefCounted<ModuleSymbolsImpl>(std::move(binary), entry.build_dir);
+  if (std::filesystem::path cache_dir = build_id_index_.GetCacheDir(); !cache_dir.empty())
+    module_impl->set_index_cache_path(cache_dir / "zxdb_index" / (build_id + ".index"));
   if (Err err = module_impl->Load(create_index_); err.has_error()) {
     return err;
   }
@@ -5,6 +5,7 @@
 #include "src/developer/forensics/crash_reports/snapshot_collector.h"
 
 #include <lib/async/cpp/task.h>
+#include <lib/async/cpp/time.h>
 #include <lib/fit/defer.h>
 #include <lib/fpromise/bridge.h>
 #include <lib/fpromise/result.h>
@@ -143,15 +144,24 @@ void SnapshotCollector::Shutdown() {
 std::string SnapshotCollector::MakeNewSnapshotRequest(const zx::time_monotonic start_time,
                                                       const zx::duration timeout) {
   const auto uuid = uuid::Generate();
+  const zx::time request_time = async::Now(dispatcher_);
   snapshot_requests_.emplace_back(std::unique_ptr<SnapshotRequest>(new SnapshotRequest{
       .uuid = uuid,
+      .start_time = request_time,
       .promise_ids = {},
       .blocked_promises = {},
       .delayed_get_snapshot = async::TaskClosure(),
   }));
 
-  snapshot_requests_.back()->delayed_get_snapshot.set_handler([this, timeout, uuid]() {
+  snapshot_requests_.back()->delayed_get_snapshot.set_handler([this, timeout, uuid,
+                                                                request_time]() {
+    // The data is collected concurrently by |data_provider_| so the time left before |timeout|
+    // expires applies to each piece of data.
     zx::duration collection_timeout_per_data = timeout;
+    if (timeout != zx::duration::infinite()) {
+      collection_timeout_per_data =
+          std::max(timeout - (async::Now(dispatcher_) - request_time), zx::duration(0));
+    }
     data_provider_->GetSnapshotInternal(
         collection_timeout_per_data, uuid,
         [this, uuid](feedback::Annotations annotations, fuchsia::feedback::Attachment archive) {
@@ -179,6 +189,8 @@ void SnapshotCollector::CompleteWithSnapshot(const std::string& uuid,
   // they're unchanging and not the result of the SnapshotManager's data management.
   AddAnnotation("debug.snapshot.shared-request.num-clients", request->promise_ids.size(),
                 annotations);
+  AddAnnotation("debug.snapshot.shared-request.duration-ms",
+                (async::Now(dispatcher_) - request->start_time).to_msecs(), annotations);
 
   if (archive.key.empty() || !archive.value.vmo.is_valid()) {
     AddAnnotation(feedback::kDebugSnapshotPresentKey, std::string("false"), annotations);
@@ -33,6 +33,9 @@ namespace crash_reports {
 //
 // To limit memory usage, SnapshotCollector will return the same Uuid to all calls to GetUuid that
 // occur within  |shared_request_window_| of a fuchsia.feedback.DataProvider/GetSnapshot request.
+//
+// The timeout given to GetReport bounds the whole collection, including the time spent waiting for
+// other crashes to share the request, rather than each piece of data on its own.
 class SnapshotCollector {
  public:
   SnapshotCollector(async_dispatcher_t* dispatcher, timekeeper::Clock* clock,
@@ -43,6 +46,9 @@ class SnapshotCollector {
   // Returns a promise of a report. The report may have a snapshot uuid, with that snapshot
   // containing the most up-to-date system data (a new snapshot will be created if all existing
   // snapshots contain data that is out-of-date). No snapshot will be saved if |timeout| expires.
+  //
+  // |timeout| starts now, so the snapshot request's data collection is only given what is left of
+  // it once the shared request window has passed.
   ::fpromise::promise<Report> GetReport(zx::duration timeout,
                                         fuchsia::feedback::CrashReport fidl_report,
                                         ReportId report_id,
@@ -69,6 +75,10 @@ class SnapshotCollector {
     // The uuid of the request's snapshot.
     std::string uuid;
 
+    // When the first report using this request was filed, used to report how long the reports
+    // waited for their snapshot.
+    zx::time start_time;
+
     // Ids of pending promises associated with this request. There should be one promise for each
     // report using this snapshot request.
     std::set<uint64_t> promise_ids;
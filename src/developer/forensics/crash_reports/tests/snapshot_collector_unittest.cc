@@ -264,6 +264,34 @@ TEST_F(SnapshotCollectorTest, Check_AsynchronousDataProviderResponse) {
   EXPECT_TRUE(GetSnapshotStore()->SnapshotExists(report->SnapshotUuid()));
 }
 
+TEST_F(SnapshotCollectorTest, Check_TimeoutIncludesSharedRequestWindow) {
+  auto data_provider_owner =
+      std::make_unique<stubs::DataProviderReturnsOnDemand>(kDefaultAnnotations, kDefaultArchiveKey);
+  auto data_provider = data_provider_owner.get();
+
+  SetUpDataProviderServer(std::move(data_provider_owner));
+  SetUpDefaultSnapshotManager();
+
+  std::optional<Report> report{std::nullopt};
+  ScheduleGetReportAndThen(kWindow + zx::sec(30), 1,
+                           ([&report](Report& new_report) { report = std::move(new_report); }));
+
+  // The data is collected with whatever is left of the timeout after the shared request window.
+  RunLoopFor(kWindow);
+  EXPECT_EQ(data_provider->GetLastTimeout(), zx::sec(30));
+
+  RunLoopFor(zx::sec(5));
+  data_provider->PopSnapshotInternalCallback();
+  RunLoopUntilIdle();
+
+  ASSERT_TRUE(report.has_value());
+  EXPECT_THAT(BuildFeedbackAnnotations(report->Annotations().Raw()),
+              IsSupersetOf({
+                  Pair("debug.snapshot.shared-request.duration-ms",
+                       ErrorOrString(std::to_string((kWindow + zx::sec(5)).to_msecs()))),
+              }));
+}
+
 TEST_F(SnapshotCollectorTest, Check_MultipleSimultaneousRequests) {
   // Setup report store to not have room for more than 1 report.
   report_store_ = std::make_unique<ScopedTestReportStore>(
@@ -11,6 +11,10 @@ namespace forensics {
 namespace exceptions {
 
 constexpr size_t kMaxNumExceptionHandlers = 10;
+
+// The number of handler subprocesses launched at startup, so the first exceptions don't wait on a
+// process launch. The other handlers launch their subprocess when they get their first exception.
+constexpr size_t kNumPrespawnedExceptionHandlers = 2;
 constexpr zx::duration kExceptionTtl = zx::min(5);
 
 // The handler waits on a response from the component lookup service for 30 seconds.
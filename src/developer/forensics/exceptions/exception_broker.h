@@ -37,6 +37,9 @@ class ExceptionBroker : public fuchsia::exception::Handler {
 
   void IsActive(IsActiveCallback) override;
 
+  // Launches the first |num_handlers| exception handler subprocesses ahead of any exception.
+  void PrespawnHandlers(size_t num_handlers) { handler_manager_.PrespawnHandlers(num_handlers); }
+
   ProcessLimboManager& limbo_manager() { return limbo_manager_; }
   const ProcessLimboManager& limbo_manager() const { return limbo_manager_; }
 
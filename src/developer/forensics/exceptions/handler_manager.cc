@@ -3,6 +3,8 @@
 
 #include "src/developer/forensics/exceptions/handler_manager.h"
 
+#include <algorithm>
+
 namespace forensics {
 namespace exceptions {
 
@@ -35,6 +37,12 @@ void HandlerManager::Handle(zx::exception exception) {
   HandleNextPendingException();
 }
 
+void HandlerManager::PrespawnHandlers(const size_t num_handlers) {
+  for (size_t i = 0; i < std::min(num_handlers, handlers_.size()); ++i) {
+    handlers_[i].Prespawn();
+  }
+}
+
 void HandlerManager::HandleNextPendingException() {
   if (pending_exceptions_.empty() || available_handlers_.empty()) {
     return;
@@ -31,6 +31,11 @@ class HandlerManager {
   // be in an exception and exceptions.cml could still handle exceptions in separate sub-processes.
   void Handle(zx::exception exception);
 
+  // Launches the subprocesses of the first |num_handlers| handlers now so exceptions handled by
+  // them don't have to wait for a process launch. Available handlers are used in that order, so
+  // the prespawned ones handle exceptions first.
+  void PrespawnHandlers(size_t num_handlers);
+
  private:
   void HandleNextPendingException();
 
@@ -39,6 +39,8 @@ int main() {
   if (!broker)
     return EXIT_FAILURE;
 
+  broker->PrespawnHandlers(kNumPrespawnedExceptionHandlers);
+
   // Create the bindings for the protocols.
   fidl::BindingSet<fuchsia::exception::Handler> handler_bindings;
   component.AddPublicService(handler_bindings.GetHandler(broker.get()));
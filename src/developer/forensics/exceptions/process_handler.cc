@@ -72,7 +72,10 @@ ProcessHandler::ProcessHandler(async_dispatcher_t* dispatcher, bool suspend_enab
       on_available_(std::move(on_available)) {
   crash_reporter_.set_error_handler([this](const zx_status_t status) {
     FX_PLOGS(WARNING, status) << "Lost connection to subprocess";
-    on_available_();
+    if (handling_) {
+      handling_ = false;
+      on_available_();
+    }
   });
 }
 
@@ -82,25 +85,41 @@ ProcessHandler::~ProcessHandler() {
   }
 }
 
-void ProcessHandler::Handle(zx::exception exception, zx::process process, zx::thread thread) {
-  if (!crash_reporter_.is_bound()) {
-    zx::channel client;
-
-    // If we are not able to spawn a sub-process, we will have to lose the exception.
-    if (!SpawnSubprocess(&client, &subprocess_, suspend_enabled_)) {
-      const std::string thread_name =
-          (thread.is_valid()) ? fsl::GetObjectName(thread.get()) : "unknown";
-      const std::string process_name =
-          (process.is_valid()) ? fsl::GetObjectName(process.get()) : "unknown";
-      FX_LOGS(WARNING) << "Dropping the exception for thread '" << thread_name << "' in process '"
-                       << process_name << "'";
-      on_available_();
-      return;
-    }
+bool ProcessHandler::EnsureSubprocess() {
+  if (crash_reporter_.is_bound()) {
+    return true;
+  }
+
+  zx::channel client;
+  if (!SpawnSubprocess(&client, &subprocess_, suspend_enabled_)) {
+    return false;
+  }
 
-    crash_reporter_.Bind(std::move(client), dispatcher_);
+  crash_reporter_.Bind(std::move(client), dispatcher_);
+  return true;
+}
+
+void ProcessHandler::Prespawn() {
+  if (!EnsureSubprocess()) {
+    FX_LOGS(WARNING) << "Failed to prespawn exception handler, it will be retried on the next "
+                        "exception";
+  }
+}
+
+void ProcessHandler::Handle(zx::exception exception, zx::process process, zx::thread thread) {
+  // If we are not able to spawn a sub-process, we will have to lose the exception.
+  if (!EnsureSubprocess()) {
+    const std::string thread_name =
+        (thread.is_valid()) ? fsl::GetObjectName(thread.get()) : "unknown";
+    const std::string process_name =
+        (process.is_valid()) ? fsl::GetObjectName(process.get()) : "unknown";
+    FX_LOGS(WARNING) << "Dropping the exception for thread '" << thread_name << "' in process '"
+                     << process_name << "'";
+    on_available_();
+    return;
   }
 
+  handling_ = true;
   crash_reporter_->Send(std::move(exception), std::move(process), std::move(thread),
                         [this](const ::fidl::StringPtr moniker) {
                           // Log |moniker| before calling |on_available_| because the lambda may
@@ -109,6 +128,7 @@ void ProcessHandler::Handle(zx::exception exception, zx::process process, zx::th
                             log_moniker_(*moniker);
                           }
 
+                          handling_ = false;
                           on_available_();
                         });
 }
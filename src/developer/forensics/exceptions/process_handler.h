@@ -29,12 +29,23 @@ class ProcessHandler {
 
   void Handle(zx::exception exception, zx::process process, zx::thread thread);
 
+  // Launches the subprocess now, if it isn't running, instead of when the next exception arrives.
+  void Prespawn();
+
  private:
+  // Launches the subprocess and connects to it if that isn't already done. Returns false if the
+  // subprocess couldn't be launched.
+  bool EnsureSubprocess();
+
   async_dispatcher_t* dispatcher_;
   bool suspend_enabled_;
   LogMonikerFn log_moniker_;
   fit::closure on_available_;
 
+  // Whether an exception has been sent to the subprocess and not yet completed. A prespawned
+  // subprocess is idle and already available, so losing it must not signal availability again.
+  bool handling_{false};
+
   zx::process subprocess_;
   fuchsia::exception::internal::CrashReporterPtr crash_reporter_;
 };
@@ -27,6 +27,17 @@ TEST_F(ProcessLaunchFailureTest, HandleOnlyOnce) {
   handler_manager.Handle(zx::exception{});
 }
 
+// A failure to prespawn a handler's subprocess should not make the handler unavailable, and the
+// launch is retried when an exception arrives.
+TEST_F(ProcessLaunchFailureTest, PrespawnFailureThenHandleOnlyOnce) {
+  HandlerManager handler_manager(dispatcher(), CrashCounter(&InspectRoot()), 2u,
+                                 zx::duration::infinite(), /*suspend_enabled=*/false);
+  handler_manager.PrespawnHandlers(2u);
+  handler_manager.Handle(zx::exception{});
+  handler_manager.Handle(zx::exception{});
+  RunLoopUntilIdle();
+}
+
 }  // namespace
 }  // namespace exceptions
 }  // namespace forensics
@@ -17,6 +17,8 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -174,11 +176,14 @@ void DataProvider::GetSnapshotInternal(
 
         const auto& annotations = std::get<0>(results).value();
         const auto& attachments = std::get<1>(results).value();
-        std::map<std::string, std::string> snapshot_files;
+
+        // |snapshot_files| only references the attachments' content, which can be several
+        // megabytes of Inspect data and logs, so it isn't copied before being compressed.
+        std::map<std::string, std::string_view> snapshot_files;
 
         // Add the annotations to |snapshot_files|
-        auto file = feedback::Encode<std::string>(annotations);
-        snapshot_files[kAttachmentAnnotations] = std::move(file);
+        const std::string annotations_file = feedback::Encode<std::string>(annotations);
+        snapshot_files[kAttachmentAnnotations] = annotations_file;
 
         // Add the attachments to |snapshot_files|
         for (const auto& [key, value] : attachments) {
@@ -187,8 +192,9 @@ void DataProvider::GetSnapshotInternal(
           }
         }
 
-        snapshot_files[kAttachmentMetadata] = metadata_.MakeMetadata(
+        const std::string metadata_file = metadata_.MakeMetadata(
             annotations, attachments, uuid, annotation_manager_->IsMissingNonPlatformAnnotations());
+        snapshot_files[kAttachmentMetadata] = metadata_file;
 
         fsl::SizedVmo archive;
 
@@ -146,6 +146,7 @@ void DataProviderReturnsOnDemand::GetSnapshotInternal(
     fit::callback<void(feedback::Annotations, fuchsia::feedback::Attachment)> callback) {
   snapshot_internal_callbacks_.push(std::move(callback));
   pending_uuids_.push_back(uuid);
+  last_timeout_ = timeout;
 }
 
 std::deque<std::string> DataProviderReturnsOnDemand::GetPendingUuids() { return pending_uuids_; }
@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "src/developer/forensics/feedback_data/data_provider.h"
@@ -164,6 +165,9 @@ class DataProviderReturnsOnDemand : public DataProviderBase {
   // popped via PopSnapshotInternalCallback.
   std::deque<std::string> GetPendingUuids();
 
+  // Returns the timeout given to the most recent call to GetSnapshotInternal, if any.
+  std::optional<zx::duration> GetLastTimeout() const { return last_timeout_; }
+
   void PopSnapshotCallback();
   void PopSnapshotInternalCallback();
 
@@ -173,6 +177,7 @@ class DataProviderReturnsOnDemand : public DataProviderBase {
   std::queue<GetSnapshotCallback> snapshot_callbacks_;
   std::queue<GetSnapshotInternalCallback> snapshot_internal_callbacks_;
   std::deque<std::string> pending_uuids_;
+  std::optional<zx::duration> last_timeout_;
 };
 
 class DataProviderSnapshotOnly : public DataProviderBase {
@@ -20,8 +20,9 @@ namespace {
 
 using fuchsia::mem::Buffer;
 
-bool Archive(const std::map<std::string, std::string>& files, const std::string& archive_filename,
-             zipFile* zf, std::map<std::string, ArchiveFileStats>* file_to_size_stats) {
+bool Archive(const std::map<std::string, std::string_view>& files,
+             const std::string& archive_filename, zipFile* zf,
+             std::map<std::string, ArchiveFileStats>* file_to_size_stats) {
   uint64_t old_zip_size = 0;
   uint64_t new_zip_size = 0;
 
@@ -64,6 +65,15 @@ bool Archive(const std::map<std::string, std::string>& files, const std::string&
 
 bool Archive(const std::map<std::string, std::string>& files, fsl::SizedVmo* archive,
              std::map<std::string, ArchiveFileStats>* file_to_size_stats) {
+  std::map<std::string, std::string_view> file_views;
+  for (const auto& [filename, content] : files) {
+    file_views.emplace(filename, content);
+  }
+  return Archive(file_views, archive, file_to_size_stats);
+}
+
+bool Archive(const std::map<std::string, std::string_view>& files, fsl::SizedVmo* archive,
+             std::map<std::string, ArchiveFileStats>* file_to_size_stats) {
   // We write the archive to a temporary file because in-memory archiving in minizip is complicated.
   files::ScopedTempDir tmp_dir;
   std::string archive_filename;
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 
 #include "src/lib/fsl/vmo/sized_vmo.h"
 
@@ -24,6 +25,11 @@ struct ArchiveFileStats {
 bool Archive(const std::map<std::string, std::string>& files, fsl::SizedVmo* archive,
              std::map<std::string, ArchiveFileStats>* file_to_size_stats = nullptr);
 
+// Same as above, but the content is not owned by |files| so large files, e.g., Inspect data, don't
+// need to be copied before being compressed.
+bool Archive(const std::map<std::string, std::string_view>& files, fsl::SizedVmo* archive,
+             std::map<std::string, ArchiveFileStats>* file_to_size_stats = nullptr);
+
 // Unpack a ZIP archive into a map of filenames to string content.
 bool Unpack(const fuchsia::mem::Buffer& archive, std::map<std::string, std::string>* files);
 
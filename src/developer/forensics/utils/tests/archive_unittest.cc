@@ -10,6 +10,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -59,6 +60,30 @@ TEST(ArchiveTest, Archive) {
   EXPECT_EQ(actual_bytes, expected_bytes);
 }
 
+TEST(ArchiveTest, ArchiveStringViews) {
+  std::map<std::string, std::string_view> attachment_views;
+  for (const auto& [filename, content] : kAttachments) {
+    attachment_views.emplace(filename, content);
+  }
+
+  std::map<std::string, ArchiveFileStats> file_size_stats;
+  fsl::SizedVmo archive;
+  ASSERT_TRUE(Archive(attachment_views, &archive, &file_size_stats));
+
+  fsl::SizedVmo expected_vmo;
+  ASSERT_TRUE(fsl::VmoFromFilename("/pkg/data/test_data.zip", &expected_vmo));
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_TRUE(fsl::VectorFromVmo(expected_vmo, &expected_bytes));
+  std::vector<uint8_t> actual_bytes;
+  ASSERT_TRUE(fsl::VectorFromVmo(archive, &actual_bytes));
+  EXPECT_EQ(actual_bytes, expected_bytes);
+
+  ASSERT_EQ(file_size_stats.size(), kAttachments.size());
+  for (const auto& [filename, content] : kAttachments) {
+    EXPECT_EQ(file_size_stats[filename].raw_bytes, content.size());
+  }
+}
+
 TEST(ArchiveTest, Unpack) {
   fsl::SizedVmo vmo;
   ASSERT_TRUE(fsl::VmoFromFilename("/pkg/data/test_data.zip", &vmo));
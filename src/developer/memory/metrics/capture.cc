@@ -238,7 +238,7 @@ zx_status_t CaptureMaker::GetCapture(Capture* capture, CaptureLevel level,
     return err;
   }
 
-  StarnixCaptureStrategy strategy;
+  StarnixCaptureStrategy strategy(STARNIX_KERNEL_PROCESS_NAME, &buffers_);
   // We don't have a guarantee on the iteration order of GetProcesses. To be able to filter jobs
   // correctly based on the name of their processes, we need to go through all processes first. We
   // extract the process handle and keep it to avoid walking the process tree a second time.
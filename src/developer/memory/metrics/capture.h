@@ -78,6 +78,14 @@ class OS {
 // Returns an OS implementation querying Zircon Kernel.
 std::unique_ptr<OS> CreateDefaultOS();
 
+// Buffers for the |ZX_INFO_PROCESS_VMOS| and |ZX_INFO_PROCESS_MAPS| queries. Each query that finds
+// its buffer too small costs a second syscall, so keeping the buffers across captures means that,
+// once they fit the largest process, each process costs a single syscall per topic.
+struct CaptureBuffers {
+  std::vector<zx_info_vmo_t> vmos;
+  std::vector<zx_info_maps_t> mappings;
+};
+
 // Extracts VMO information out of a process tree.
 // TODO(b/366157407): Remove CaptureStrategy abstraction.
 class CaptureStrategy {
@@ -146,6 +154,7 @@ class CaptureMaker {
   // zx_koid_t self_koid_;
   fidl::WireSyncClient<fuchsia_kernel::Stats> stats_client_;
   std::unique_ptr<OS> os_;
+  CaptureBuffers buffers_;
 
   friend class TestUtils;
 };
@@ -46,7 +46,8 @@ zx::result<size_t> GetInfoVector(OS& os, zx_handle_t handle, uint32_t topic,
 
 zx_status_t BaseCaptureStrategy::OnNewProcess(OS& os, Process process, zx::handle process_handle) {
   TRACE_DURATION_BEGIN("memory_metrics", "BaseCaptureStrategy::OnNewProcess::GetVMOs");
-  auto result = GetInfoVector<zx_info_vmo_t>(os, process_handle.get(), ZX_INFO_PROCESS_VMOS, vmos_);
+  std::vector<zx_info_vmo_t>& vmos = buffers_->vmos;
+  auto result = GetInfoVector<zx_info_vmo_t>(os, process_handle.get(), ZX_INFO_PROCESS_VMOS, vmos);
   // We don't want to show processes for which we don't have data (e.g. because they exited).
   if (result.is_error()) {
     return result.error_value();
@@ -58,7 +59,7 @@ zx_status_t BaseCaptureStrategy::OnNewProcess(OS& os, Process process, zx::handl
   std::unordered_map<zx_koid_t, const zx_info_vmo_t&> unique_vmos;
   unique_vmos.reserve(num_vmos);
   for (size_t i = 0; i < num_vmos; i++) {
-    const auto& vmo_info = vmos_[i];
+    const auto& vmo_info = vmos[i];
     unique_vmos.try_emplace(vmo_info.koid, vmo_info);
   }
   TRACE_DURATION_END("memory_metrics", "BaseCaptureStrategy::OnNewProcess::UniqueProcessVMOs");
@@ -80,8 +81,9 @@ BaseCaptureStrategy::Finalize(OS& os) {
   return zx::ok(std::make_tuple(std::move(koid_to_process_), std::move(koid_to_vmo_)));
 }
 
-StarnixCaptureStrategy::StarnixCaptureStrategy(std::string process_name)
-    : process_name_(std::move(process_name)) {}
+StarnixCaptureStrategy::StarnixCaptureStrategy(std::string process_name,
+                                               CaptureBuffers* buffers)
+    : process_name_(std::move(process_name)), buffers_(buffers ? buffers : &own_buffers_) {}
 
 zx_status_t StarnixCaptureStrategy::OnNewProcess(OS& os, Process process,
                                                  zx::handle process_handle) {
@@ -97,7 +99,7 @@ zx::result<std::tuple<std::unordered_map<zx_koid_t, Process>, std::unordered_map
 StarnixCaptureStrategy::Finalize(OS& os) {
   TRACE_DURATION("memory_metrics", "StarnixCaptureStrategy::Finalize");
 
-  BaseCaptureStrategy base;
+  BaseCaptureStrategy base(buffers_);
 
   // The cutoff address between the restricted space and the Starnix kernel depends on the
   // architecture. We rely on the fact that shared processes, as used by Starnix, have two root
@@ -121,7 +123,7 @@ StarnixCaptureStrategy::Finalize(OS& os) {
     // once as we assume this list is shared by all processes in that job.
     if (!starnix_proc->second.vmos_retrieved) {
       TRACE_DURATION_BEGIN("memory_metrics", "StarnixCaptureStrategy::Finalize::StarnixVMOs");
-      std::vector<zx_info_vmo_t> vmos;
+      std::vector<zx_info_vmo_t>& vmos = buffers_->vmos;
       auto result =
           GetInfoVector(os, process_handles_[process.koid].get(), ZX_INFO_PROCESS_VMOS, vmos);
       if (result.status_value() == ZX_ERR_BAD_STATE) {
@@ -147,8 +149,9 @@ StarnixCaptureStrategy::Finalize(OS& os) {
     }
 
     TRACE_DURATION_BEGIN("memory_metrics", "StarnixCaptureStrategy::Finalize::StarnixMappings");
+    std::vector<zx_info_maps_t>& mappings = buffers_->mappings;
     auto result =
-        GetInfoVector(os, process_handles_[process.koid].get(), ZX_INFO_PROCESS_MAPS, mappings_);
+        GetInfoVector(os, process_handles_[process.koid].get(), ZX_INFO_PROCESS_MAPS, mappings);
     if (result.status_value() == ZX_ERR_BAD_STATE) {
       continue;
     }
@@ -158,7 +161,7 @@ StarnixCaptureStrategy::Finalize(OS& os) {
 
     size_t num_mappings = result.value();
     for (size_t i = 0; i < num_mappings; i++) {
-      const auto& mapping = mappings_[i];
+      const auto& mapping = mappings[i];
       if (!starnix_kernel_cutoff.has_value() && mapping.type == ZX_INFO_MAPS_TYPE_VMAR &&
           mapping.depth == 1) {
         starnix_kernel_cutoff = mapping.base + mapping.size;
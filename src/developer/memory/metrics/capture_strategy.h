@@ -22,7 +22,11 @@ const char STARNIX_KERNEL_PROCESS_NAME[] = "starnix_kernel.cm";
 // |ZX_INFO_PROCESS_VMOS| zx_object_info topic.
 class BaseCaptureStrategy : public CaptureStrategy {
  public:
-  explicit BaseCaptureStrategy() = default;
+  // |buffers| must outlive this strategy. When null, the strategy uses its own buffers.
+  explicit BaseCaptureStrategy(CaptureBuffers* buffers = nullptr)
+      : buffers_(buffers ? buffers : &own_buffers_) {}
+  BaseCaptureStrategy(const BaseCaptureStrategy&) = delete;
+  BaseCaptureStrategy& operator=(const BaseCaptureStrategy&) = delete;
 
   zx_status_t OnNewProcess(OS& os, Process process, zx::handle process_handle) override;
 
@@ -32,7 +36,8 @@ class BaseCaptureStrategy : public CaptureStrategy {
  private:
   std::unordered_map<zx_koid_t, Process> koid_to_process_;
   std::unordered_map<zx_koid_t, Vmo> koid_to_vmo_;
-  std::vector<zx_info_vmo_t> vmos_;
+  CaptureBuffers own_buffers_;
+  CaptureBuffers* const buffers_;
 };
 
 // When a job contains a process named |process_name|, assume all processes within that job are
@@ -45,7 +50,11 @@ class BaseCaptureStrategy : public CaptureStrategy {
 // For all other processes, this delegates to |BaseCaptureStrategy|.
 class StarnixCaptureStrategy : public CaptureStrategy {
  public:
-  explicit StarnixCaptureStrategy(std::string process_name = STARNIX_KERNEL_PROCESS_NAME);
+  // |buffers| must outlive this strategy. When null, the strategy uses its own buffers.
+  explicit StarnixCaptureStrategy(std::string process_name = STARNIX_KERNEL_PROCESS_NAME,
+                                  CaptureBuffers* buffers = nullptr);
+  StarnixCaptureStrategy(const StarnixCaptureStrategy&) = delete;
+  StarnixCaptureStrategy& operator=(const StarnixCaptureStrategy&) = delete;
 
   zx_status_t OnNewProcess(OS& os, Process process, zx::handle process_handle) override;
 
@@ -67,7 +76,8 @@ class StarnixCaptureStrategy : public CaptureStrategy {
 
   const std::string process_name_;
 
-  std::vector<zx_info_maps_t> mappings_;
+  CaptureBuffers own_buffers_;
+  CaptureBuffers* const buffers_;
   std::unordered_map<zx_koid_t, StarnixJob> starnix_jobs_;
 };
 
@@ -219,6 +219,38 @@ TEST_F(StarnixCaptureStrategyTest, NoStarnixProcess) {
                                                 Pair(koid_vmo_1, MakeVmoMatcher(_vmo_1))));
 }
 
+TEST_F(StarnixCaptureStrategyTest, SharedBuffers) {
+  MockOS os({.get_info = {vmo_0_info, vmo_1_info}});
+  CaptureBuffers buffers;
+
+  // Captures that share |buffers| keep the results correct and leave the buffers sized for the
+  // next capture.
+  for (int i = 0; i < 2; i++) {
+    StarnixCaptureStrategy strategy(STARNIX_KERNEL_PROCESS_NAME, &buffers);
+
+    memory::Process process_0{.koid = koid_process_0, .job = koid_job_0};
+    std::strncpy(process_0.name, kProcessName_0, ZX_MAX_NAME_LEN);
+    memory::Process process_1{.koid = koid_process_1, .job = koid_job_1};
+    std::strncpy(process_1.name, kProcessName_1, ZX_MAX_NAME_LEN);
+
+    strategy.OnNewProcess(os, std::move(process_0), zx::handle(handle_process_0));
+    strategy.OnNewProcess(os, std::move(process_1), zx::handle(handle_process_1));
+    auto result = strategy.Finalize(os);
+    ASSERT_TRUE(result.is_ok());
+
+    auto& [koid_to_process, koid_to_vmo] = result.value();
+    EXPECT_THAT(koid_to_process,
+                UnorderedElementsAre(
+                    Pair(koid_process_0, MakeProcessMatcher(koid_process_0, koid_job_0,
+                                                            kProcessName_0, {koid_vmo_0})),
+                    Pair(koid_process_1, MakeProcessMatcher(koid_process_1, koid_job_1,
+                                                            kProcessName_1, {koid_vmo_1}))));
+    EXPECT_THAT(koid_to_vmo, UnorderedElementsAre(Pair(koid_vmo_0, MakeVmoMatcher(_vmo_0)),
+                                                  Pair(koid_vmo_1, MakeVmoMatcher(_vmo_1))));
+    EXPECT_FALSE(buffers.vmos.empty());
+  }
+}
+
 TEST_F(StarnixCaptureStrategyTest, WithStarnixProcess) {
   MockOS os(
       {.get_info = {vmo_0_info, vmo_1_info, vmo_2_info, maps_2_info, vmo_3_info, maps_3_info}});
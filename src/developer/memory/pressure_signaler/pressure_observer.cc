@@ -10,6 +10,7 @@
 #include <lib/fdio/directory.h>
 #include <lib/syslog/cpp/macros.h>
 #include <lib/zx/channel.h>
+#include <lib/zx/clock.h>
 #include <lib/zx/event.h>
 #include <lib/zx/job.h>
 #include <sys/stat.h>
@@ -127,6 +128,7 @@ void PressureObserver::WaitOnLevelChange() {
 
 void PressureObserver::OnLevelChanged(zx_handle_t handle) {
   FX_LOGS(INFO) << "PressureObserver::OnLevelChanged " << handle << " Old level " << level_;
+  const Level old_level = level_;
   for (size_t i = 0; i < Level::kNumLevels; i++) {
     if (events_[i].get() == handle) {
       level_ = Level(i);
@@ -136,6 +138,21 @@ void PressureObserver::OnLevelChanged(zx_handle_t handle) {
 
   FX_LOGS(INFO) << "PressureObserver::OnLevelChanged new level " << level_;
 
+  // How fast pressure rises is what decides whether clients had time to react to the previous
+  // level, so report how long the previous level lasted.
+  const zx::time now = zx::clock::get_monotonic();
+  if (level_initialized_) {
+    const int64_t seconds_in_old_level = (now - level_change_time_).to_secs();
+    if (level_ < old_level) {
+      FX_LOGS(WARNING) << "Memory pressure rose from " << kLevelNames[old_level] << " to "
+                       << kLevelNames[level_] << " after " << seconds_in_old_level << "s";
+    } else {
+      FX_LOGS(INFO) << "Memory pressure fell from " << kLevelNames[old_level] << " to "
+                    << kLevelNames[level_] << " after " << seconds_in_old_level << "s";
+    }
+  }
+  level_change_time_ = now;
+
   if (unlikely(!level_initialized_)) {
     // Record that the level has been initialized if this is the first time. Before this, the
     // |PressureNotifier| will advertise the pressure level as Normal when watchers register. This
@@ -9,6 +9,7 @@
 #include <lib/async-loop/default.h>
 #include <lib/async/cpp/task.h>
 #include <lib/zx/event.h>
+#include <lib/zx/time.h>
 #include <zircon/types.h>
 
 #include <array>
@@ -68,6 +69,8 @@ class PressureObserver {
   async::Loop loop_ = async::Loop(&kAsyncLoopConfigNoAttachToCurrentThread);
   PressureNotifier* const notifier_;
   bool level_initialized_ = false;
+  // When |level_| last changed. Only accessed on the memory-pressure-loop thread.
+  zx::time level_change_time_;
 
   friend class test::PressureObserverUnitTest;
   friend class test::PressureNotifierUnitTest;
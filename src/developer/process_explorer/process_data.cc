@@ -4,9 +4,9 @@
 
 #include "src/developer/process_explorer/process_data.h"
 
+#include <algorithm>
 #include <unordered_map>
 
-#include "third_party/rapidjson/include/rapidjson/document.h"
 #include "third_party/rapidjson/include/rapidjson/rapidjson.h"
 #include "third_party/rapidjson/include/rapidjson/stringbuffer.h"
 #include "third_party/rapidjson/include/rapidjson/writer.h"
@@ -14,49 +14,47 @@
 namespace process_explorer {
 
 std::string WriteProcessesDataAsJson(std::vector<Process> processes_data) {
-  rapidjson::Document json_document;
-  json_document.SetObject();
-  auto& allocator = json_document.GetAllocator();
-
-  rapidjson::Value processes_json(rapidjson::kArrayType);
-  processes_json.Reserve((unsigned int)processes_data.size(), allocator);
+  // Stream straight into the output buffer rather than building a DOM first, which would hold a
+  // second copy of every process and object while the snapshot is serialized.
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
+  writer.StartObject();
+  writer.Key("Processes");
+  writer.StartArray();
   for (const auto& process : processes_data) {
-    rapidjson::Value process_objects_json(rapidjson::kArrayType);
-    process_objects_json.Reserve((unsigned int)process.objects.size(), allocator);
-
+    writer.StartObject();
+    writer.Key("koid");
+    writer.Uint64(process.koid);
+    writer.Key("name");
+    writer.String(process.name.c_str(), static_cast<rapidjson::SizeType>(process.name.length()));
+    writer.Key("objects");
+    writer.StartArray();
     for (const auto& object : process.objects) {
-      rapidjson::Value object_json(rapidjson::kObjectType);
-      object_json.AddMember("object_type", object.object_type, allocator)
-          .AddMember("koid", object.koid, allocator)
-          .AddMember("related_koid", object.related_koid, allocator)
-          .AddMember("peer_owner_koid", object.peer_owner_koid, allocator);
-      process_objects_json.PushBack(object_json, allocator);
+      writer.StartObject();
+      writer.Key("object_type");
+      writer.Uint(object.object_type);
+      writer.Key("koid");
+      writer.Uint64(object.koid);
+      writer.Key("related_koid");
+      writer.Uint64(object.related_koid);
+      writer.Key("peer_owner_koid");
+      writer.Uint64(object.peer_owner_koid);
+      writer.EndObject();
     }
-
-    rapidjson::Value process_name(rapidjson::kObjectType);
-    const std::string s(process.name);
-    process_name.SetString(s.c_str(), static_cast<rapidjson::SizeType>(s.length()), allocator);
-
-    rapidjson::Value process_json(rapidjson::kObjectType);
-    process_json.AddMember("koid", process.koid, allocator)
-        .AddMember("name", process_name, allocator)
-        .AddMember("objects", process_objects_json, allocator);
-    processes_json.PushBack(process_json, allocator);
+    writer.EndArray();
+    writer.EndObject();
   }
-
-  json_document.AddMember("Processes", processes_json, allocator);
-
-  rapidjson::StringBuffer buffer;
-  buffer.Clear();
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  json_document.Accept(writer);
+  writer.EndArray();
+  writer.EndObject();
 
   return std::string(buffer.GetString(), buffer.GetSize());
 }
 
 zx_status_t GetHandles(zx::unowned_process process, std::vector<zx_info_handle_extended_t>* out) {
-  size_t avail = 8;
+  // Start with whatever |out| already has room for, so that callers reusing the same vector across
+  // processes usually need a single call and no allocation.
+  size_t avail = std::max<size_t>(out->capacity(), 8u);
 
   while (true) {
     out->resize(avail);
@@ -67,7 +65,9 @@ zx_status_t GetHandles(zx::unowned_process process, std::vector<zx_info_handle_e
       return status;
     }
     if (actual < avail) {
-      avail *= 2u;
+      // |avail| is the number of handles at the time of the call. Leave some room for handles
+      // created before the next one.
+      avail += avail / 8 + 1;
       continue;
     }
     out->resize(actual);
@@ -77,6 +77,11 @@ zx_status_t GetHandles(zx::unowned_process process, std::vector<zx_info_handle_e
 
 void FillPeerOwnerKoid(std::vector<Process>& processes_data) {
   std::unordered_map<zx_koid_t, zx_koid_t> object_to_process;
+  size_t object_count = 0;
+  for (const Process& process : processes_data) {
+    object_count += process.objects.size();
+  }
+  object_to_process.reserve(object_count);
   for (const Process& process : processes_data) {
     for (const KernelObject& object : process.objects) {
       if (object.related_koid != 0) {
@@ -88,9 +93,10 @@ void FillPeerOwnerKoid(std::vector<Process>& processes_data) {
   for (Process& process : processes_data) {
     for (KernelObject& object : process.objects) {
       if (object.related_koid != 0) {
-        if (object_to_process.find(object.koid) == object_to_process.end())
+        auto it = object_to_process.find(object.koid);
+        if (it == object_to_process.end())
           continue;
-        object.peer_owner_koid = object_to_process[object.koid];
+        object.peer_owner_koid = it->second;
       }
     }
   }
@@ -47,21 +47,20 @@ class ProcessWalker : public TaskEnumerator {
       return status;
     }
 
-    std::vector<zx_info_handle_extended_t> handles;
-    if (auto status = GetHandles(std::move(process), &handles); status != ZX_OK) {
+    if (auto status = GetHandles(std::move(process), &handles_); status != ZX_OK) {
       FX_LOGS(ERROR) << "Unable to get associated handles for process: "
                      << zx_status_get_string(status);
       return status;
     }
 
     std::vector<KernelObject> process_objects;
-    for (auto const& handle : handles) {
+    process_objects.reserve(handles_.size());
+    for (auto const& handle : handles_) {
       process_objects.push_back(
           {handle.type, handle.koid, handle.related_koid, handle.peer_owner_koid});
     }
 
-    std::string process_name(name);
-    processes_.push_back({koid, process_name, process_objects});
+    processes_.push_back({koid, std::string(name), std::move(process_objects)});
 
     return ZX_OK;
   }
@@ -71,6 +70,8 @@ class ProcessWalker : public TaskEnumerator {
 
  private:
   std::vector<Process> processes_;
+  // Reused for every process, so that the handle table buffer is only grown a few times per walk.
+  std::vector<zx_info_handle_extended_t> handles_;
 };
 
 zx_status_t GetProcessesData(std::vector<Process>* processes_data) {
@@ -6,7 +6,6 @@
 
 #include <unordered_map>
 
-#include "third_party/rapidjson/include/rapidjson/document.h"
 #include "third_party/rapidjson/include/rapidjson/rapidjson.h"
 #include "third_party/rapidjson/include/rapidjson/stringbuffer.h"
 #include "third_party/rapidjson/include/rapidjson/writer.h"
@@ -14,44 +13,40 @@
 namespace process_explorer {
 
 std::string WriteTaskHierarchyDataAsJson(std::vector<Task> tasks_data) {
-  rapidjson::Document json_document;
-  json_document.SetObject();
-  auto& allocator = json_document.GetAllocator();
-
-  rapidjson::Value tasks_json(rapidjson::kArrayType);
-  tasks_json.Reserve(static_cast<unsigned int>(tasks_data.size()), allocator);
+  // See WriteProcessesDataAsJson.
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
-  auto get_task_type = [&](TaskType type) -> rapidjson::Value {
+  auto get_task_type = [](TaskType type) -> const char* {
     switch (type) {
       case TaskType::Job:
-        return rapidjson::Value("job", allocator);
+        return "job";
       case TaskType::Process:
-        return rapidjson::Value("process", allocator);
+        return "process";
       case TaskType::Thread:
-        return rapidjson::Value("thread", allocator);
+        return "thread";
     }
   };
 
+  writer.StartObject();
+  writer.Key("Tasks");
+  writer.StartArray();
   for (const auto& task : tasks_data) {
-    rapidjson::Value task_name(rapidjson::kObjectType);
-    const std::string s(task.name);
-    task_name.SetString(s.c_str(), static_cast<rapidjson::SizeType>(s.length()), allocator);
-
-    rapidjson::Value task_json(rapidjson::kObjectType);
-    task_json.AddMember("depth", task.depth, allocator)
-        .AddMember("koid", task.koid, allocator)
-        .AddMember("parent_koid", task.parent_koid, allocator)
-        .AddMember("type", get_task_type(task.type), allocator)
-        .AddMember("name", task_name, allocator);
-    tasks_json.PushBack(task_json, allocator);
+    writer.StartObject();
+    writer.Key("depth");
+    writer.Int(task.depth);
+    writer.Key("koid");
+    writer.Uint64(task.koid);
+    writer.Key("parent_koid");
+    writer.Uint64(task.parent_koid);
+    writer.Key("type");
+    writer.String(get_task_type(task.type));
+    writer.Key("name");
+    writer.String(task.name.c_str(), static_cast<rapidjson::SizeType>(task.name.length()));
+    writer.EndObject();
   }
-
-  json_document.AddMember("Tasks", tasks_json, allocator);
-
-  rapidjson::StringBuffer buffer;
-  buffer.Clear();
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  json_document.Accept(writer);
+  writer.EndArray();
+  writer.EndObject();
 
   return std::string(buffer.GetString(), buffer.GetSize());
 }
@@ -6,6 +6,8 @@
 
 #include <lib/async/cpp/time.h>
 
+#include <algorithm>
+
 #include <src/devices/lib/log/log.h>
 
 namespace driver_manager {
@@ -17,7 +19,10 @@ zx::duration kLastUpdatedTimeoutDuration = zx::sec(10);
 
 }  // namespace
 
-void BootupTracker::Start() { UpdateTrackerAndResetTimer(); }
+void BootupTracker::Start() {
+  bootup_start_timestamp_ = async::Now(dispatcher_);
+  UpdateTrackerAndResetTimer();
+}
 
 void BootupTracker::WaitForBootup(fit::callback<void()> callback) {
   if (bootup_done_) {
@@ -32,13 +37,27 @@ void BootupTracker::NotifyNewStartRequest(std::string node_moniker, std::string
     LOGF(WARNING, "Bootup tracker received conflicting start requests for node %s",
          node_moniker.c_str());
   }
-  outstanding_start_requests_[node_moniker] = driver_url;
+  outstanding_start_requests_[node_moniker] = StartRequest{
+      .driver_url = std::move(driver_url),
+      .start_time = async::Now(dispatcher_),
+  };
+  max_concurrent_start_requests_ =
+      std::max(max_concurrent_start_requests_, outstanding_start_requests_.size());
   UpdateTrackerAndResetTimer();
 }
 
 void BootupTracker::NotifyStartComplete(std::string node_moniker) {
   if (auto itr = outstanding_start_requests_.find(node_moniker);
       itr != outstanding_start_requests_.end()) {
+    if (!bootup_done_) {
+      zx::duration start_duration = async::Now(dispatcher_) - itr->second.start_time;
+      completed_start_requests_++;
+      total_start_duration_ += start_duration;
+      if (start_duration > slowest_start_duration_) {
+        slowest_start_duration_ = start_duration;
+        slowest_start_moniker_ = node_moniker;
+      }
+    }
     outstanding_start_requests_.erase(itr);
   } else {
     LOGF(ERROR, "Bootup tracker notified for an unknown start request for %s",
@@ -49,6 +68,25 @@ void BootupTracker::NotifyStartComplete(std::string node_moniker) {
 
 void BootupTracker::NotifyBindingChanged() { UpdateTrackerAndResetTimer(); }
 
+void BootupTracker::RecordInspect(inspect::Inspector& inspector) const {
+  auto bootup = inspector.GetRoot().CreateChild("bootup");
+  bootup.RecordBool("done", bootup_done_);
+  if (bootup_done_) {
+    bootup.RecordInt("duration_ms", bootup_duration_.to_msecs());
+  }
+  bootup.RecordUint("completed_start_requests", completed_start_requests_);
+  bootup.RecordUint("outstanding_start_requests", outstanding_start_requests_.size());
+  bootup.RecordUint("max_concurrent_start_requests", max_concurrent_start_requests_);
+  if (completed_start_requests_ > 0) {
+    bootup.RecordInt("average_start_duration_ms",
+                     total_start_duration_.to_msecs() /
+                         static_cast<int64_t>(completed_start_requests_));
+    bootup.RecordString("slowest_start_moniker", slowest_start_moniker_);
+    bootup.RecordInt("slowest_start_duration_ms", slowest_start_duration_.to_msecs());
+  }
+  inspector.GetRoot().Record(std::move(bootup));
+}
+
 void BootupTracker::CheckBootupDone() {
   bool deadline_exceeded = IsUpdateDeadlineExceeded();
   if (!deadline_exceeded &&
@@ -60,8 +98,8 @@ void BootupTracker::CheckBootupDone() {
   if (deadline_exceeded) {
     LOGF(WARNING, "Deadline exceeded in the bootup tracker with:");
     LOGF(WARNING, "    %u unfinished start requests:", outstanding_start_requests_.size());
-    for (const auto& [moniker, url] : outstanding_start_requests_) {
-      LOGF(WARNING, "         - %s - %s", moniker.c_str(), url.c_str());
+    for (const auto& [moniker, request] : outstanding_start_requests_) {
+      LOGF(WARNING, "         - %s - %s", moniker.c_str(), request.driver_url.c_str());
     }
     if (bind_manager_->HasOngoingBind()) {
       LOGF(WARNING, "    a hanging bind process in the bind manager");
@@ -70,6 +108,14 @@ void BootupTracker::CheckBootupDone() {
     LOGF(INFO, "Bootup completed.");
   }
 
+  // The bootup timeout only fires after a quiet period, which should not count towards bootup.
+  bootup_duration_ = last_update_timestamp_ - bootup_start_timestamp_;
+  LOGF(INFO,
+       "Bootup took %ld ms: started %zu drivers, at most %zu at once, slowest start was %s "
+       "taking %ld ms",
+       bootup_duration_.to_msecs(), completed_start_requests_, max_concurrent_start_requests_,
+       slowest_start_moniker_.c_str(), slowest_start_duration_.to_msecs());
+
   for (auto& callback : callbacks_) {
     callback();
   }
@@ -6,6 +6,7 @@
 #define SRC_DEVICES_BIN_DRIVER_MANAGER_BOOTUP_TRACKER_H_
 
 #include <lib/async/cpp/task.h>
+#include <lib/inspect/cpp/inspect.h>
 
 #include "src/devices/bin/driver_manager/bind/bind_manager.h"
 
@@ -32,6 +33,9 @@ class BootupTracker {
   // Called when the ongoing bind state in the bind manager has changed.
   void NotifyBindingChanged();
 
+  // Records the bootup timing statistics under a "bootup" node.
+  void RecordInspect(inspect::Inspector& inspector) const;
+
  protected:
   // Exposed for testing.
   virtual void ResetBootupTimer();
@@ -46,8 +50,22 @@ class BootupTracker {
   void CheckBootupDone();
   void UpdateTrackerAndResetTimer();
 
-  // Contains all outstanding start requests. Maps the node's component moniker to a driver url.
-  std::unordered_map<std::string, std::string> outstanding_start_requests_;
+  struct StartRequest {
+    std::string driver_url;
+    zx::time start_time;
+  };
+
+  // Contains all outstanding start requests. Maps the node's component moniker to the request.
+  std::unordered_map<std::string, StartRequest> outstanding_start_requests_;
+
+  // Timing statistics for the driver starts during bootup.
+  zx::time bootup_start_timestamp_;
+  zx::duration bootup_duration_;
+  size_t completed_start_requests_ = 0;
+  size_t max_concurrent_start_requests_ = 0;
+  zx::duration total_start_duration_;
+  std::string slowest_start_moniker_;
+  zx::duration slowest_start_duration_;
 
   BindManager* bind_manager_;
 
@@ -64,6 +64,7 @@ zx::result<zx::vmo> DriverHostLoaderService::LoadObjectImpl(std::string path) {
   if (!InAllowlist(path)) {
     return zx::error(ZX_ERR_ACCESS_DENIED);
   }
+
   return LoaderService::LoadObjectImpl(path);
 }
 
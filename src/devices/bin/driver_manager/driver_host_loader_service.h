@@ -5,11 +5,17 @@
 #ifndef SRC_DEVICES_BIN_DRIVER_MANAGER_DRIVER_HOST_LOADER_SERVICE_H_
 #define SRC_DEVICES_BIN_DRIVER_MANAGER_DRIVER_HOST_LOADER_SERVICE_H_
 
+#include <string>
+
 #include "src/lib/loader_service/loader_service.h"
 
 namespace driver_manager {
 // A loader service for driver_hosts that restricts access to dynamic libraries by applying an
 // allowlist, but then otherwise simply loads them from the given lib directory.
+//
+// Every driver host loads the same handful of libraries, so each library is only read from the
+// lib directory once. Later requests are served with a read-only copy-on-write child of the
+// cached VMO, which also lets the driver hosts share the library's pages.
 class DriverHostLoaderService : public loader::LoaderService {
  public:
   static std::shared_ptr<DriverHostLoaderService> Create(async_dispatcher_t* dispatcher,
@@ -18,7 +24,7 @@ class DriverHostLoaderService : public loader::LoaderService {
 
  private:
   DriverHostLoaderService(async_dispatcher_t* dispatcher, fbl::unique_fd lib_fd, std::string name)
-      : LoaderService(dispatcher, std::move(lib_fd), std::move(name)) {}
+      : LoaderService(dispatcher, std::move(lib_fd), std::move(name), /*cache_objects=*/true) {}
 
   virtual zx::result<zx::vmo> LoadObjectImpl(std::string path) override;
 };
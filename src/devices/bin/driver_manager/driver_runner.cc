@@ -358,6 +358,7 @@ fpromise::promise<inspect::Inspector> DriverRunner::Inspect() const {
   inspector.GetRoot().Record(std::move(device_tree));
 
   bind_manager_.RecordInspect(inspector);
+  bootup_tracker_->RecordInspect(inspector);
 
   return fpromise::make_ok_promise(inspector);
 }
@@ -4,6 +4,8 @@
 
 #include "src/devices/bin/driver_manager/bootup_tracker.h"
 
+#include <lib/inspect/cpp/reader.h>
+
 #include "src/devices/bin/driver_manager/tests/bind_manager_test_base.h"
 
 class TestBootupTracker : public driver_manager::BootupTracker {
@@ -69,6 +71,38 @@ TEST_F(BootupTrackerTest, StartRequestsOnly) {
   EXPECT_TRUE(bootup_completed());
 }
 
+TEST_F(BootupTrackerTest, RecordsStartStatistics) {
+  WaitForBootup();
+
+  tracker->NotifyNewStartRequest("node_1", "driver_url");
+  tracker->NotifyNewStartRequest("node_2", "driver_url");
+  tracker->NotifyStartComplete("node_1");
+  tracker->NotifyNewStartRequest("node_3", "driver_url");
+  tracker->NotifyStartComplete("node_2");
+  tracker->NotifyStartComplete("node_3");
+  TriggerBootupTimeout();
+  ASSERT_TRUE(bootup_completed());
+
+  inspect::Inspector inspector;
+  tracker->RecordInspect(inspector);
+  auto hierarchy = inspect::ReadFromVmo(inspector.DuplicateVmo());
+  ASSERT_TRUE(hierarchy.is_ok());
+  const inspect::Hierarchy* bootup = hierarchy.value().GetByPath({"bootup"});
+  ASSERT_NE(bootup, nullptr);
+
+  auto* done = bootup->node().get_property<inspect::BoolPropertyValue>("done");
+  ASSERT_NE(done, nullptr);
+  EXPECT_TRUE(done->value());
+  auto* completed =
+      bootup->node().get_property<inspect::UintPropertyValue>("completed_start_requests");
+  ASSERT_NE(completed, nullptr);
+  EXPECT_EQ(completed->value(), 3u);
+  auto* max_concurrent =
+      bootup->node().get_property<inspect::UintPropertyValue>("max_concurrent_start_requests");
+  ASSERT_NE(max_concurrent, nullptr);
+  EXPECT_EQ(max_concurrent->value(), 2u);
+}
+
 TEST_F(BootupTrackerTest, StartHookHanging) {
   WaitForBootup();
 
@@ -39,4 +39,27 @@ TEST_F(LoaderServiceTest, LoadObject) {
   EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libother.so", zx::error(ZX_ERR_ACCESS_DENIED)));
 }
 
+// Libraries are only read from the lib directory once, and later requests are served from the
+// loader's cache.
+TEST_F(LoaderServiceTest, LoadObjectCached) {
+  std::shared_ptr<driver_manager::DriverHostLoaderService> loader;
+  std::vector<TestDirectoryEntry> config = {
+      {"libfdio.so", "fdio", true},
+  };
+  ASSERT_NO_FATAL_FAILURE(CreateTestLoader(std::move(config), &loader));
+
+  auto status = loader->Connect();
+  ASSERT_TRUE(status.is_ok());
+  fidl::WireSyncClient<fldsvc::Loader> client(std::move(status.value()));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libfdio.so", zx::ok("fdio")));
+
+  // Remove the library, so that only a cached copy can satisfy the next load.
+  ASSERT_EQ(root_dir()->Unlink("libfdio.so", false), ZX_OK);
+
+  status = loader->Connect();
+  ASSERT_TRUE(status.is_ok());
+  fidl::WireSyncClient<fldsvc::Loader> client2(std::move(status.value()));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client2, "libfdio.so", zx::ok("fdio")));
+}
+
 }  // namespace
@@ -4,8 +4,49 @@
 
 #include "src/devices/bin/driver_runtime/arena.h"
 
+#include <array>
+#include <atomic>
+
 #include <fbl/ref_ptr.h>
 
+namespace {
+
+// Arenas are typically created and destroyed for every message, so an arena which outgrows its
+// initial buffer would otherwise allocate and free an extra block each time. Each thread keeps a
+// few freed blocks of the standard size around for the next arena to use.
+constexpr size_t kMaxCachedBlocksPerThread = 4;
+
+class BlockCache {
+ public:
+  ~BlockCache() {
+    for (size_t i = 0; i < count_; i++) {
+      delete[] blocks_[i];
+    }
+  }
+
+  uint8_t* Take() { return count_ > 0 ? blocks_[--count_] : nullptr; }
+
+  bool Put(uint8_t* block) {
+    if (count_ == blocks_.size()) {
+      return false;
+    }
+    blocks_[count_++] = block;
+    return true;
+  }
+
+ private:
+  std::array<uint8_t*, kMaxCachedBlocksPerThread> blocks_;
+  size_t count_ = 0;
+};
+
+thread_local BlockCache g_block_cache;
+
+std::atomic<uint64_t> g_blocks_allocated = 0;
+std::atomic<uint64_t> g_blocks_reused = 0;
+std::atomic<uint64_t> g_blocks_freed = 0;
+
+}  // namespace
+
 // static
 zx_status_t fdf_arena::Create(uint32_t options, uint32_t tag, fdf_arena** out_arena) {
   auto arena = fbl::AdoptRef(new fdf_arena(tag));
@@ -24,10 +65,9 @@ void* fdf_arena::Allocate(size_t bytes) {
   if (available_size_ < bytes) {
     // The data doesn't fit within the current block => allocate a new block.
     size_t block_size = (bytes > ExtraBlock::kExtraSize) ? bytes : ExtraBlock::kExtraSize;
-    size_t extra_bytes = block_size + FIDL_ALIGN(sizeof(ExtraBlockNode));
 
     // Account for the new block
-    auto extra_block = new (new uint8_t[extra_bytes]) ExtraBlock();
+    auto extra_block = NewExtraBlock(block_size);
     extra_blocks_.push_front(extra_block);
     uint8_t* data = extra_block->data();
     allocated_ranges_.insert({reinterpret_cast<uintptr_t>(data), block_size});
@@ -53,6 +93,41 @@ void* fdf_arena::Allocate(size_t bytes) {
   return data;
 }
 
+// static
+fdf_arena::ExtraBlock* fdf_arena::NewExtraBlock(size_t block_size) {
+  uint8_t* memory = nullptr;
+  if (block_size == ExtraBlock::kExtraSize) {
+    memory = g_block_cache.Take();
+  }
+  if (memory) {
+    g_blocks_reused.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    memory = new uint8_t[block_size + FIDL_ALIGN(sizeof(ExtraBlockNode))];
+    g_blocks_allocated.fetch_add(1, std::memory_order_relaxed);
+  }
+  return new (memory) ExtraBlock();
+}
+
+// static
+void fdf_arena::DeleteExtraBlock(ExtraBlock* block, size_t block_size) {
+  block->~ExtraBlock();
+  auto* memory = reinterpret_cast<uint8_t*>(block);
+  if (block_size == ExtraBlock::kExtraSize && g_block_cache.Put(memory)) {
+    return;
+  }
+  delete[] memory;
+  g_blocks_freed.fetch_add(1, std::memory_order_relaxed);
+}
+
+// static
+fdf_arena::Stats fdf_arena::GetStats() {
+  return Stats{
+      .blocks_allocated = g_blocks_allocated.load(std::memory_order_relaxed),
+      .blocks_reused = g_blocks_reused.load(std::memory_order_relaxed),
+      .blocks_freed = g_blocks_freed.load(std::memory_order_relaxed),
+  };
+}
+
 // No-op for initial implementation.
 void fdf_arena::Free(void* data) {}
 
@@ -106,6 +181,7 @@ fdf_arena::~fdf_arena() __TA_NO_THREAD_SAFETY_ANALYSIS {
   // Deletes all the extra blocks.
   while (!extra_blocks_.is_empty()) {
     auto* to_be_deleted = extra_blocks_.pop_front();
-    delete[] reinterpret_cast<uint8_t*>(to_be_deleted);
+    DeleteExtraBlock(to_be_deleted,
+                     allocated_ranges_[reinterpret_cast<uintptr_t>(to_be_deleted->data())]);
   }
 }
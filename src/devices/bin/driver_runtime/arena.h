@@ -28,6 +28,17 @@ struct fdf_arena : public fbl::RefCounted<fdf_arena> {
   void Free(void* data);
   void Destroy();
 
+  // Process-wide counters of the extra blocks backing arenas.
+  struct Stats {
+    // Blocks allocated from the heap.
+    uint64_t blocks_allocated = 0;
+    // Blocks taken from a thread's pool of recycled blocks instead.
+    uint64_t blocks_reused = 0;
+    // Blocks returned to the heap, as they were oversized or the thread's pool was full.
+    uint64_t blocks_freed = 0;
+  };
+  static Stats GetStats();
+
  private:
   // Size of the buffer allocated on construction of the arena.
   static constexpr size_t kInitialBufferSize = 4ull * 1024;
@@ -51,6 +62,13 @@ struct fdf_arena : public fbl::RefCounted<fdf_arena> {
 
   fdf_arena(uint32_t tag) : tag_(tag) {}
 
+  // Returns a block with room for |block_size| bytes of data. Blocks of the standard size are
+  // taken from the current thread's pool of recycled blocks if possible.
+  static ExtraBlock* NewExtraBlock(size_t block_size);
+  // Returns |block| to the current thread's pool if it is of the standard size and the pool is
+  // not full, otherwise frees it.
+  static void DeleteExtraBlock(ExtraBlock* block, size_t block_size);
+
   // Returns a pointer to the newest allocated buffer.
   uint8_t* NewestBufferLocked() __TA_REQUIRES(&lock_) {
     return extra_blocks_.is_empty() ? initial_buffer_ : extra_blocks_.front().data();
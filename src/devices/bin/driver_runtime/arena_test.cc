@@ -170,3 +170,31 @@ TEST(fdf_arena, FidlArenaAllocationsAreFreed) {
     ASSERT_NOT_NULL(ptr);
   }
 }
+
+// Tests that the extra blocks of a destroyed arena are reused by the next arena on the thread,
+// and that oversized blocks are returned to the heap.
+TEST(fdf_arena, ExtraBlocksAreRecycled) {
+  // Larger than the initial buffer, but fits in a standard extra block.
+  constexpr size_t kAllocSize = 8ull * 1024;
+
+  fdf_arena* arena;
+  ASSERT_EQ(ZX_OK, fdf_arena::Create(0, 'AREN', &arena));
+  EXPECT_NOT_NULL(arena->Allocate(kAllocSize));
+  arena->Destroy();
+
+  fdf_arena::Stats before = fdf_arena::GetStats();
+  ASSERT_EQ(ZX_OK, fdf_arena::Create(0, 'AREN', &arena));
+  void* data = arena->Allocate(kAllocSize);
+  EXPECT_NOT_NULL(data);
+  EXPECT_TRUE(arena->Contains(data, kAllocSize));
+  arena->Destroy();
+
+  fdf_arena::Stats after = fdf_arena::GetStats();
+  EXPECT_EQ(after.blocks_reused, before.blocks_reused + 1);
+  EXPECT_EQ(after.blocks_allocated, before.blocks_allocated);
+
+  ASSERT_EQ(ZX_OK, fdf_arena::Create(0, 'AREN', &arena));
+  EXPECT_NOT_NULL(arena->Allocate(0x100000));
+  arena->Destroy();
+  EXPECT_EQ(fdf_arena::GetStats().blocks_freed, after.blocks_freed + 1);
+}
@@ -1101,13 +1101,34 @@ void Dispatcher::QueueRegisteredCallback(driver_runtime::CallbackRequest* reques
     }
     dispatching_sync_ = true;
   }
-  DispatchCallback(std::move(callback_request));
 
-  fbl::AutoLock lock(&callback_lock_);
-  dispatching_sync_ = false;
-  if (!callback_queue_.is_empty() && event_waiter_ && !event_waiter_->signaled() &&
-      IsRunningLocked()) {
-    event_waiter_->signal();
+  uint32_t num_callbacks_dispatched = 0;
+  while (callback_request) {
+    DispatchCallback(std::move(callback_request));
+    num_callbacks_dispatched++;
+
+    fbl::AutoLock lock(&callback_lock_);
+    dispatching_sync_ = false;
+    // Channel reads that the peer driver queued while we were calling into it (typically replies
+    // written from within the callback itself, which would have been reentrant at the time) can
+    // now be run directly on this thread, rather than waiting for a dispatcher thread to wake up.
+    // We stop at the first request that must not be inlined so that ordering is preserved.
+    if (!unsynchronized_ && (num_callbacks_dispatched < kBatchSize) && IsRunningLocked() &&
+        !callback_queue_.is_empty() &&
+        callback_queue_.front().request_type() == CallbackRequest::RequestType::kOther) {
+      auto next = callback_queue_.pop_front();
+      if (ShouldInline(next).is_ok()) {
+        debug_stats_.num_drained_inline_requests++;
+        dispatching_sync_ = true;
+        callback_request = std::move(next);
+        continue;
+      }
+      callback_queue_.push_front(std::move(next));
+    }
+    if (!callback_queue_.is_empty() && event_waiter_ && !event_waiter_->signaled() &&
+        IsRunningLocked()) {
+      event_waiter_->signal();
+    }
   }
 }
 
@@ -1272,6 +1293,9 @@ void Dispatcher::DispatchCallbacks(std::unique_ptr<EventWaiter> event_waiter,
 
   uint32_t num_callbacks_dispatched = 0;
 
+  // Queried before acquiring |callback_lock_|, as the thread pool lock must not be nested inside.
+  uint32_t max_active_threads = unsynchronized_ ? thread_pool_->max_threads_per_dispatcher() : 1;
+
   fbl::DoublyLinkedList<std::unique_ptr<CallbackRequest>> to_call;
   {
     fbl::AutoLock lock(&callback_lock_);
@@ -1291,8 +1315,12 @@ void Dispatcher::DispatchCallbacks(std::unique_ptr<EventWaiter> event_waiter,
     num_callbacks_dispatched += TakeNextCallbacks(&to_call);
 
     // Check if there are callbacks left to process and we should wake up an additional
-    // thread. For synchronized dispatchers, parallel callbacks are disallowed.
-    if (unsynchronized_ && !callback_queue_.is_empty()) {
+    // thread. For synchronized dispatchers, parallel callbacks are disallowed. Unsynchronized
+    // dispatchers only wake up another thread while they are below their share of the thread
+    // pool, otherwise the remaining callbacks wait for this thread to finish its batch, which
+    // keeps a busy dispatcher from monopolizing threads needed by other dispatchers.
+    if (unsynchronized_ && !callback_queue_.is_empty() &&
+        num_active_threads_ < max_active_threads) {
       zx_status_t status = event_waiter->BeginWaitWithRef(std::move(event_waiter), dispatcher_ref);
       if (status == ZX_ERR_BAD_STATE) {
         event_waiter_ = nullptr;
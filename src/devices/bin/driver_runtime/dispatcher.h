@@ -31,6 +31,7 @@
 #include <fbl/ref_counted.h>
 #include <fbl/string_buffer.h>
 
+#include "src/devices/bin/driver_runtime/arena.h"
 #include "src/devices/bin/driver_runtime/async_loop_owned_event_handler.h"
 #include "src/devices/bin/driver_runtime/callback_request.h"
 #include "src/devices/bin/driver_runtime/driver_context.h"
@@ -177,6 +178,17 @@ class Dispatcher : public async_dispatcher_t,
       return num_dispatchers_;
     }
 
+    // Returns how many threads a single unsynchronized dispatcher may occupy at once. When other
+    // dispatchers share the pool, one thread is held back so that a dispatcher with a deep queue
+    // cannot starve its neighbours of threads.
+    uint32_t max_threads_per_dispatcher() const {
+      fbl::AutoLock al(&lock_);
+      if (num_dispatchers_ <= 1 || num_threads_ <= 1) {
+        return UINT32_MAX;
+      }
+      return num_threads_ - 1;
+    }
+
     bool is_unmanaged() const { return is_unmanaged_; }
 
     std::string_view scheduler_role() const { return scheduler_role_; }
@@ -305,6 +317,9 @@ class Dispatcher : public async_dispatcher_t,
 
     size_t num_inlined_requests = 0;
     size_t num_total_requests = 0;
+    // Requests which were queued, but then run directly by a thread which had just finished
+    // inlining another request on the dispatcher.
+    size_t num_drained_inline_requests = 0;
   };
 
   struct TaskDebugInfo {
@@ -331,6 +346,8 @@ class Dispatcher : public async_dispatcher_t,
     DispatcherState state;
     std::vector<TaskDebugInfo> queued_tasks;
     DebugStats debug_stats;
+    // Process-wide, rather than specific to |dispatcher_to_dump|.
+    fdf_arena::Stats arena_stats;
   };
 
   // Public for std::make_unique.
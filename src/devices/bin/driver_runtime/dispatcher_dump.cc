@@ -68,6 +68,7 @@ void Dispatcher::Dump(DumpState* out_state) {
   out_state->state = state_;
   out_state->queued_tasks.clear();
   out_state->debug_stats = debug_stats_;
+  out_state->arena_stats = fdf_arena::GetStats();
 
   for (auto& callback_request : callback_queue_) {
     if (callback_request.request_type() == CallbackRequest::RequestType::kTask) {
@@ -102,6 +103,11 @@ void Dispatcher::FormatDump(DumpState* state, std::vector<std::string>* dump_out
                         state->debug_stats.num_total_requests,
                         state->debug_stats.num_inlined_requests);
 
+  if (state->debug_stats.num_drained_inline_requests > 0) {
+    OutputFormattedString(dump_out, "%lu queued requests were later run inline",
+                          state->debug_stats.num_drained_inline_requests);
+  }
+
   const auto& non_inlined_stats = state->debug_stats.non_inlined;
   if (state->debug_stats.num_total_requests != state->debug_stats.num_inlined_requests) {
     OutputFormattedString(dump_out, "Reasons why requests were not inlined:");
@@ -136,6 +142,10 @@ void Dispatcher::FormatDump(DumpState* state, std::vector<std::string>* dump_out
     }
   }
 
+  OutputFormattedString(dump_out, "Arena blocks: %lu allocated, %lu reused, %lu freed",
+                        state->arena_stats.blocks_allocated, state->arena_stats.blocks_reused,
+                        state->arena_stats.blocks_freed);
+
   if (state->queued_tasks.empty()) {
     OutputFormattedString(dump_out, "No queued tasks");
   } else {
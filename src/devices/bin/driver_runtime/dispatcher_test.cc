@@ -259,6 +259,42 @@ TEST_F(DispatcherTest, SyncDispatcherCallOnLoop) {
   ASSERT_OK(sync_completion_wait(&read_completion, ZX_TIME_INFINITE));
 }
 
+// Tests that a channel read which a driver queues from within an inlined callback is run
+// directly once that callback returns, rather than waiting for the async loop.
+TEST_F(DispatcherTest, SyncDispatcherDirectCallRunsQueuedReadsInline) {
+  const void* local_driver = CreateFakeDriver();
+  const void* remote_driver = CreateFakeDriver();
+
+  // We should bypass the async loop, so use an unmanaged dispatcher.
+  fdf_dispatcher_t* dispatcher;
+  ASSERT_NO_FATAL_FAILURE(CreateUnmanagedDispatcher(0, __func__, local_driver, &dispatcher));
+
+  uint32_t num_reads = 0;
+  fdf::ChannelRead channel_read(
+      local_ch_, 0 /* options */,
+      [&](fdf_dispatcher_t* dispatcher, fdf::ChannelRead* channel_read, zx_status_t status) {
+        ASSERT_OK(status);
+        ASSERT_NO_FATAL_FAILURE(AssertRead(channel_read->channel(), nullptr, 0, nullptr, 0));
+        if (++num_reads == 1) {
+          // As the local driver is now in the call stack, the second message will be queued.
+          ASSERT_EQ(ZX_OK, fdf_channel_write(remote_ch_, 0, nullptr, nullptr, 0, nullptr, 0));
+          ASSERT_OK(channel_read->Begin(dispatcher));
+          ASSERT_EQ(1, static_cast<driver_runtime::Dispatcher*>(dispatcher)
+                           ->callback_queue_size_slow());
+        }
+      });
+  ASSERT_OK(channel_read.Begin(dispatcher));
+
+  {
+    driver_context::PushDriver(remote_driver);
+    auto pop_driver = fit::defer([]() { driver_context::PopDriver(); });
+    ASSERT_EQ(ZX_OK, fdf_channel_write(remote_ch_, 0, nullptr, nullptr, 0, nullptr, 0));
+  }
+  // Both reads should have completed without running the async loop.
+  ASSERT_EQ(2u, num_reads);
+  ASSERT_EQ(0, static_cast<driver_runtime::Dispatcher*>(dispatcher)->callback_queue_size_slow());
+}
+
 // Tests that a synchronous dispatcher only allows one callback to be running at a time.
 // We will register a callback that blocks and one that doesn't. We will then send
 // 2 requests, and check that the second callback is not run until the first returns.
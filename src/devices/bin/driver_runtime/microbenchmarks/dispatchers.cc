@@ -14,12 +14,15 @@
 #include <lib/fdf/cpp/dispatcher.h>
 #include <lib/fdf/cpp/env.h>
 #include <lib/fdf/testing.h>
+#include <lib/fit/function.h>
 #include <lib/sync/cpp/completion.h>
 #include <lib/syslog/cpp/macros.h>
 #include <lib/zx/event.h>
 #include <lib/zx/interrupt.h>
 
+#include <atomic>
 #include <map>
+#include <vector>
 
 #include <fbl/string_printf.h>
 #include <perftest/perftest.h>
@@ -171,6 +174,71 @@ bool DispatcherTaskTest(perftest::RepeatState* state, AsyncDispatcher::Type disp
   return true;
 }
 
+// Measure the time taken for a batch of tasks to be posted to and completed by each of
+// |num_dispatchers| dispatchers, each owned by a different driver, sharing the runtime's threads.
+bool ManyDispatcherTaskTest(perftest::RepeatState* state, uint32_t num_dispatchers,
+                            uint32_t batch_size) {
+  std::vector<std::unique_ptr<RuntimeDispatcher>> dispatchers;
+  for (uint32_t i = 0; i < num_dispatchers; i++) {
+    dispatchers.push_back(std::make_unique<RuntimeDispatcher>(true /* use_threads */));
+  }
+
+  while (state->KeepRunning()) {
+    std::vector<libsync::Completion> task_completions(num_dispatchers);
+    for (uint32_t i = 0; i < batch_size; i++) {
+      for (uint32_t d = 0; d < num_dispatchers; d++) {
+        bool complete = (i == batch_size - 1);
+        libsync::Completion* task_completion = &task_completions[d];
+        ASSERT_OK(async::PostTask(dispatchers[d]->async_dispatcher(), [complete, task_completion] {
+          if (complete) {
+            task_completion->Signal();
+          }
+        }));
+      }
+    }
+    for (auto& task_completion : task_completions) {
+      task_completion.Wait();
+    }
+  }
+
+  return true;
+}
+
+// Measure the time taken for a task to complete on one dispatcher while another driver's
+// dispatcher on the same threads is kept continuously busy.
+bool NeighborDispatcherTaskTest(perftest::RepeatState* state) {
+  auto busy_dispatcher = std::make_unique<RuntimeDispatcher>(true /* use_threads */);
+  auto dispatcher = std::make_unique<RuntimeDispatcher>(true /* use_threads */);
+
+  // Keeps a fixed number of tasks queued on |busy_dispatcher|, each reposting itself when run.
+  constexpr uint32_t kBusyTasks = 100;
+  std::atomic_bool stop = false;
+  std::atomic_uint32_t busy_tasks = kBusyTasks;
+  libsync::Completion busy_completion;
+  fit::function<void()> busy_task = [&] {
+    if (!stop) {
+      ASSERT_OK(async::PostTask(busy_dispatcher->async_dispatcher(), busy_task.share()));
+    } else if (busy_tasks.fetch_sub(1) == 1) {
+      busy_completion.Signal();
+    }
+  };
+  for (uint32_t i = 0; i < kBusyTasks; i++) {
+    ASSERT_OK(async::PostTask(busy_dispatcher->async_dispatcher(), busy_task.share()));
+  }
+
+  while (state->KeepRunning()) {
+    libsync::Completion task_completion;
+    ASSERT_OK(async::PostTask(dispatcher->async_dispatcher(),
+                              [&task_completion] { task_completion.Signal(); }));
+    task_completion.Wait();
+  }
+
+  stop = true;
+  busy_completion.Wait();
+
+  return true;
+}
+
 // Measure the time taken for a wait callback to be completed.
 bool DispatcherWaitTest(perftest::RepeatState* state, AsyncDispatcher::Type dispatcher_type,
                         bool use_threads) {
@@ -325,6 +393,22 @@ void RegisterTests() {
       perftest::RegisterTest(irq_name.c_str(), DispatcherIrqTest, type, use_threads);
     }
   }
+
+  static const unsigned kNumDispatchers[] = {
+      4,
+      16,
+      64,
+  };
+  for (auto num_dispatchers : kNumDispatchers) {
+    for (auto batch_size : kTaskBatchSize) {
+      auto task_name = fbl::StringPrintf("Dispatcher/Runtime/ManyDispatchers/%u/Task/%utasks",
+                                         num_dispatchers, batch_size);
+      perftest::RegisterTest(task_name.c_str(), ManyDispatcherTaskTest, num_dispatchers,
+                             batch_size);
+    }
+  }
+  perftest::RegisterTest("Dispatcher/Runtime/NeighborTask/Threads", NeighborDispatcherTaskTest);
+
   perftest::RegisterTest("Dispatcher/Runtime/ChannelRead/Threads", DispatcherChannelReadTest, true);
   perftest::RegisterTest("Dispatcher/Runtime/ChannelRead/NoThreads", DispatcherChannelReadTest,
                          false);
@@ -185,6 +185,26 @@ TEST_F(BlockVerifierTestFixture, VerifyZeroBlockSucceeds) {
   }
 }
 
+TEST_F(BlockVerifierTestFixture, VerifiedIntegrityBlocksAreCached) {
+  EXPECT_EQ(0u, bv_.verified_integrity_block_count());
+
+  // The first block is covered by integrity block 0, under the root block 2.
+  EXPECT_OK(bv_.VerifyDataBlockSync(0, kZeroBlock));
+  EXPECT_EQ(2u, bv_.verified_integrity_block_count());
+
+  // The rest of the blocks covered by integrity block 0 need no more of the tree.
+  EXPECT_OK(bv_.VerifyDataBlockSync(1, kZeroBlock));
+  EXPECT_EQ(2u, bv_.verified_integrity_block_count());
+
+  // The last block is covered by integrity block 1.
+  EXPECT_OK(bv_.VerifyDataBlockSync(kDataBlocks - 1, kZeroBlock));
+  EXPECT_EQ(3u, bv_.verified_integrity_block_count());
+
+  // A cached tree must still catch corrupted data blocks.
+  uint8_t non_zero_block[block_verity::kBlockSize] = {0x01};
+  EXPECT_EQ(ZX_ERR_IO_DATA_INTEGRITY, bv_.VerifyDataBlockSync(0, non_zero_block));
+}
+
 TEST_F(BlockVerifierTestFixture, CorruptedDataBlockFails) {
   // Verifying a non-zero block should fail for all blocks
   uint8_t non_zero_block[block_verity::kBlockSize] = {0x01};
@@ -67,6 +67,8 @@ zx_status_t BlockVerifier::PrepareAsync(void* cookie, BlockVerifierCallback call
     }
     integrity_block_base_ = reinterpret_cast<const uint8_t*>(address);
     cleanup.cancel();
+    verified_integrity_blocks_ = std::make_unique<std::atomic<bool>[]>(
+        geometry_.allocation_.integrity_shape.integrity_block_count);
 
     cookie_ = cookie;
     callback_ = callback;
@@ -112,6 +114,12 @@ const uint8_t* BlockVerifier::MemoryLocationForBlock(IntegrityBlockIndex i) cons
   return integrity_block_base_ + offset;
 }
 
+void BlockVerifier::MarkIntegrityBlockVerified(IntegrityBlockIndex i) {
+  if (!verified_integrity_blocks_[i].exchange(true, std::memory_order_release)) {
+    verified_integrity_block_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 zx_status_t BlockVerifier::VerifyDataBlockSync(uint64_t data_block_index,
                                                const uint8_t* block_data) {
   {
@@ -133,15 +141,29 @@ zx_status_t BlockVerifier::VerifyDataBlockSync(uint64_t data_block_index,
     return ZX_ERR_IO_DATA_INTEGRITY;
   }
 
-  // Future performance improvement: make this cache successfully-hashed
-  // indirect integrity blocks rather than rehashing to the root every time.
+  // Hash our way up the tree until we reach an integrity block which has
+  // already been verified, or the root.  Every block above a verified block has
+  // been verified too, so that's all the hashing that's needed.
+  const uint32_t tree_depth = geometry_.allocation_.integrity_shape.tree_depth;
   uint32_t distance_from_leaf = 0;
   HashLocation previous = leaf_hash_location;
-  while (distance_from_leaf < geometry_.allocation_.integrity_shape.tree_depth - 1) {
+  while (!verified_integrity_blocks_[previous.integrity_block].load(std::memory_order_acquire)) {
     // Get address of containing block.  Hash it.
     const uint8_t* containing_block = MemoryLocationForBlock(previous.integrity_block);
     hasher.Hash(containing_block, kBlockSize);
 
+    if (distance_from_leaf == tree_depth - 1) {
+      // Validate the root hash.  The last integrity range we checked should
+      // have been in the final integrity block, which is the root integrity
+      // block.
+      ZX_ASSERT(previous.integrity_block ==
+                geometry_.allocation_.integrity_shape.integrity_block_count - 1);
+      if (!hasher.Equals(root_hash_.data(), kHashOutputSize)) {
+        return ZX_ERR_IO_DATA_INTEGRITY;
+      }
+      break;
+    }
+
     HashLocation up_one =
         geometry_.NextIntegrityBlockUp(distance_from_leaf, previous.integrity_block);
     if (!hasher.Equals(MemoryLocationForHash(up_one), kHashOutputSize)) {
@@ -152,17 +174,13 @@ zx_status_t BlockVerifier::VerifyDataBlockSync(uint64_t data_block_index,
     distance_from_leaf++;
   }
 
-  // Validate the root hash.  By now the last integrity range we checked
-  // should have been in the final integrity block, which is the root integrity
-  // block.
-  ZX_ASSERT(previous.integrity_block ==
-            geometry_.allocation_.integrity_shape.integrity_block_count - 1);
-
-  const uint8_t* root_integrity_block = MemoryLocationForBlock(previous.integrity_block);
-  hasher.Hash(root_integrity_block, kBlockSize);
-  if (!hasher.Equals(root_hash_.data(), kHashOutputSize)) {
-    return ZX_ERR_IO_DATA_INTEGRITY;
+  // Everything on the path we just hashed is now known to be good.
+  IntegrityBlockIndex block = leaf_hash_location.integrity_block;
+  for (uint32_t distance = 0; distance < distance_from_leaf; distance++) {
+    MarkIntegrityBlockVerified(block);
+    block = geometry_.NextIntegrityBlockUp(distance, block).integrity_block;
   }
+  MarkIntegrityBlockVerified(block);
 
   return ZX_OK;
 }
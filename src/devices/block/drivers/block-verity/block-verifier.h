@@ -6,6 +6,8 @@
 #define SRC_DEVICES_BLOCK_DRIVERS_BLOCK_VERITY_BLOCK_VERIFIER_H_
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 #include "src/devices/block/drivers/block-verity/block-loader-interface.h"
@@ -48,11 +50,18 @@ class BlockVerifier final {
 
   // Actually do the hashing to determine if the kBlockSize bytes of data
   // pointed to by block_data correctly represent the contents of data block
-  // `block_index`.  In the future, it might make sense to move to async
-  // block verification.
+  // `block_index`.  Integrity blocks are only hashed up to the root the first
+  // time they're needed; afterwards only the data block itself is hashed.
+  // Safe to call from multiple threads at once.
   zx_status_t VerifyDataBlockSync(uint64_t data_block_index, const uint8_t* block_data)
       __TA_EXCLUDES(&mtx_);
 
+  // The number of integrity blocks which have been verified against the root
+  // hash so far.
+  uint64_t verified_integrity_block_count() const {
+    return verified_integrity_block_count_.load(std::memory_order_relaxed);
+  }
+
   // Issue the request to load integrity blocks to `block_loader_`.
   void LoadIntegrityBlocks() __TA_EXCLUDES(&mtx_);
 
@@ -71,6 +80,9 @@ class BlockVerifier final {
   // be found mapped into the current address space.
   const uint8_t* MemoryLocationForBlock(IntegrityBlockIndex i) const;
 
+  // Records that integrity block `i` chains up to the root hash.
+  void MarkIntegrityBlockVerified(IntegrityBlockIndex i);
+
   enum BlockVerifierState {
     // State on construction.
     kInitial,
@@ -107,6 +119,12 @@ class BlockVerifier final {
   // look at all integrity data in a flat array.
   const uint8_t* integrity_block_base_;
 
+  // One flag per integrity block, set once the block has been verified against
+  // the root hash.  The integrity data never changes after it's loaded, so a
+  // verified block stays verified, and so do all of the blocks above it.
+  std::unique_ptr<std::atomic<bool>[]> verified_integrity_blocks_;
+  std::atomic<uint64_t> verified_integrity_block_count_ = 0;
+
   // Args to `PrepareAsync` that we save so we can call them back later,
   // possibly across an async boundary.
   void* cookie_;
@@ -8,6 +8,8 @@
 #include <lib/zx/vmo.h>
 #include <zircon/status.h>
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 
 #include "src/devices/block/drivers/block-verity/constants.h"
@@ -206,9 +208,6 @@ void VerifiedDevice::ForwardTranslatedBlockOp(block_op_t* block_op) {
 }
 
 void VerifiedDevice::OnClientBlockRequestComplete(zx_status_t status, block_op_t* block) {
-  std::lock_guard<std::mutex> lock(mtx_);
-  outstanding_block_requests_--;
-
   // Restore data that may have changed
   extra_op_t* extra = BlockToExtra(block, info_.op_size);
   block->rw.vmo = extra->vmo;
@@ -218,33 +217,45 @@ void VerifiedDevice::OnClientBlockRequestComplete(zx_status_t status, block_op_t
 
   if (status != ZX_OK) {
     zxlogf(DEBUG, "parent device returned %s", zx_status_get_string(status));
-    BlockComplete(block, status);
-    return;
+  } else {
+    // Verification only reads immutable state, so it runs without holding
+    // mtx_ and requests completed on different threads are verified in
+    // parallel.  The request stays outstanding until it's done.
+    status = VerifyBlocks(block);
   }
 
-  // Verify each block that we read against the hash from the integrity data.
-  for (uint32_t block_offset = 0; block_offset < block->rw.length; block_offset++) {
-    uint8_t buf[kBlockSize];
-    off_t vmo_offset = extra->offset_vmo + (block_offset * kBlockSize);
-    status = zx_vmo_read(extra->vmo, buf, vmo_offset, kBlockSize);
+  std::lock_guard<std::mutex> lock(mtx_);
+  outstanding_block_requests_--;
+  BlockComplete(block, status);
+}
+
+zx_status_t VerifiedDevice::VerifyBlocks(const block_op_t* block) {
+  // Copy the data out of the VMO a batch of blocks at a time, rather than with
+  // one syscall per block.
+  const uint32_t batch_blocks = std::min(block->rw.length, kVerifyBatchBlocks);
+  auto buf = std::make_unique<uint8_t[]>(static_cast<size_t>(batch_blocks) * kBlockSize);
+
+  for (uint32_t batch_offset = 0; batch_offset < block->rw.length; batch_offset += batch_blocks) {
+    const uint32_t count = std::min(batch_blocks, block->rw.length - batch_offset);
+    const uint64_t vmo_offset = (block->rw.offset_vmo + batch_offset) * kBlockSize;
+    zx_status_t status = zx_vmo_read(block->rw.vmo, buf.get(), vmo_offset, count * kBlockSize);
     if (status != ZX_OK) {
       zxlogf(WARNING, "Couldn't read from VMO to verify block data: %s",
              zx_status_get_string(status));
-      BlockComplete(block, status);
-      return;
+      return status;
     }
 
-    // Check integrity of the block with BlockVerifier.
+    // Check integrity of each block with BlockVerifier.
     // The offset given is the index into the data block section.
-    uint64_t data_block_index = extra->offset_dev + block_offset;
-    status = block_verifier_.VerifyDataBlockSync(data_block_index, buf);
-    if (status != ZX_OK) {
-      BlockComplete(block, status);
-      return;
+    for (uint32_t i = 0; i < count; i++) {
+      uint64_t data_block_index = block->rw.offset_dev + batch_offset + i;
+      status = block_verifier_.VerifyDataBlockSync(data_block_index, buf.get() + i * kBlockSize);
+      if (status != ZX_OK) {
+        return status;
+      }
     }
   }
-
-  BlockComplete(block, ZX_OK);
+  return ZX_OK;
 }
 
 void VerifiedDevice::OnBlockVerifierPrepareComplete(zx_status_t status) {
@@ -82,8 +82,16 @@ class VerifiedDevice final : public VerifiedDeviceType,
   void BlockComplete(block_op_t* block, zx_status_t status) __TA_REQUIRES(mtx_);
 
  private:
+  // The number of blocks which `VerifyBlocks` copies out of a request's VMO at
+  // once.
+  static constexpr uint32_t kVerifyBatchBlocks = 16;
+
   void ForwardTranslatedBlockOp(block_op_t* block_op) __TA_REQUIRES(mtx_);
 
+  // Verifies every block read by the completed request `block` against the
+  // integrity data.
+  zx_status_t VerifyBlocks(const block_op_t* block) __TA_EXCLUDES(mtx_);
+
   // Completes the UnbindTxn if outstanding_block_requests_ has gone to 0.
   void TeardownIfQuiesced() __TA_REQUIRES(mtx_);
 
@@ -152,7 +152,7 @@ zx::result<vmoid_t> Server::FindVmoIdLocked() {
 }
 
 zx::result<vmoid_t> Server::AttachVmo(zx::vmo vmo) {
-  fbl::AutoLock server_lock(&server_lock_);
+  fbl::AutoLock vmo_lock(&vmo_lock_);
   zx::result vmoid = FindVmoIdLocked();
   if (vmoid.is_ok()) {
     fbl::AllocChecker ac;
@@ -239,7 +239,7 @@ zx_status_t Server::ProcessReadWriteRequest(block_fifo_request_t* request) {
 
   fbl::RefPtr<IoBuffer> iobuf;
   {
-    fbl::AutoLock lock(&server_lock_);
+    fbl::AutoLock lock(&vmo_lock_);
     auto iter = tree_.find(request->vmoid);
     if (!iter.IsValid()) {
       // Operation which is not accessing a valid vmo.
@@ -393,7 +393,7 @@ zx_status_t Server::ProcessReadWriteRequest(block_fifo_request_t* request) {
 }
 
 zx_status_t Server::ProcessCloseVmoRequest(block_fifo_request_t* request) {
-  fbl::AutoLock lock(&server_lock_);
+  fbl::AutoLock lock(&vmo_lock_);
   auto iobuf = tree_.find(request->vmoid);
   if (!iobuf.IsValid()) {
     // Operation which is not accessing a valid vmo
@@ -43,7 +43,7 @@ class Server : public fidl::WireServer<fuchsia_hardware_block::Session> {
   zx_status_t Serve() TA_EXCL(server_lock_);
 
   zx::result<zx::fifo> GetFifo();
-  zx::result<vmoid_t> AttachVmo(zx::vmo vmo) TA_EXCL(server_lock_) TA_EXCL(server_lock_);
+  zx::result<vmoid_t> AttachVmo(zx::vmo vmo) TA_EXCL(vmo_lock_);
   void Close();
 
   void GetFifo(GetFifoCompleter::Sync& completer) override;
@@ -83,7 +83,7 @@ class Server : public fidl::WireServer<fuchsia_hardware_block::Session> {
 
   zx_status_t Read(block_fifo_request_t* requests, size_t* count);
 
-  zx::result<vmoid_t> FindVmoIdLocked() TA_REQ(server_lock_);
+  zx::result<vmoid_t> FindVmoIdLocked() TA_REQ(vmo_lock_);
 
   // Sends the request embedded in the message down to the lower layers.
   void Enqueue(std::unique_ptr<Message> message) TA_EXCL(server_lock_);
@@ -103,8 +103,13 @@ class Server : public fidl::WireServer<fuchsia_hardware_block::Session> {
   std::unique_ptr<MessageGroup> groups_[MAX_TXN_GROUP_COUNT];
 
   fbl::Mutex server_lock_;
-  fbl::WAVLTree<vmoid_t, fbl::RefPtr<IoBuffer>> tree_ TA_GUARDED(server_lock_);
-  vmoid_t last_id_ TA_GUARDED(server_lock_);
+
+  // Attached VMOs are looked up for every read and write, while |server_lock_| is also taken on the
+  // completion path of every request, so the two are guarded separately to keep submission and
+  // completion from contending.
+  fbl::Mutex vmo_lock_;
+  fbl::WAVLTree<vmoid_t, fbl::RefPtr<IoBuffer>> tree_ TA_GUARDED(vmo_lock_);
+  vmoid_t last_id_ TA_GUARDED(vmo_lock_);
 };
 
 #endif  // SRC_DEVICES_BLOCK_DRIVERS_CORE_SERVER_H_
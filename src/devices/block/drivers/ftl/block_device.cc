@@ -394,6 +394,8 @@ int BlockDevice::WorkerThread() {
       metrics_.max_wear().Set(counters.wear_count);
       metrics_.initial_bad_blocks().Set(counters.initial_bad_blocks);
       metrics_.running_bad_blocks().Set(counters.running_bad_blocks);
+      metrics_.map_cache_hits().Set(counters.map_cache_hits);
+      metrics_.map_cache_misses().Set(counters.map_cache_misses);
     }
 
     // Update all counters and rates for the supported operation type.
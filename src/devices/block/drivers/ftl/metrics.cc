@@ -120,6 +120,8 @@ std::vector<std::string> Metrics::GetPropertyNames<inspect::UintProperty>() {
   property_names.push_back("nand.erase_block.max_wear");
   property_names.push_back("nand.initial_bad_blocks");
   property_names.push_back("nand.running_bad_blocks");
+  property_names.push_back("map_cache.hits");
+  property_names.push_back("map_cache.misses");
   for (int i = 0; i < kReasonCount; ++i)
     property_names.push_back(GetMapBlockEndPageFailureReasonPropertyName(i));
   return property_names;
@@ -146,6 +148,8 @@ Metrics::Metrics()
   max_wear_ = root_.CreateUint("nand.erase_block.max_wear", 0);
   initial_bad_blocks_ = root_.CreateUint("nand.initial_bad_blocks", 0);
   running_bad_blocks_ = root_.CreateUint("nand.running_bad_blocks", 0);
+  map_cache_hits_ = root_.CreateUint("map_cache.hits", 0);
+  map_cache_misses_ = root_.CreateUint("map_cache.misses", 0);
   for (int i = 0; i < kReasonCount; ++i) {
     map_block_end_page_failure_reasons_[i] =
         root_.CreateUint(GetMapBlockEndPageFailureReasonPropertyName(i), 0);
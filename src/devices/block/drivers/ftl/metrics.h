@@ -94,6 +94,9 @@ class Metrics {
   inspect::UintProperty& initial_bad_blocks() { return initial_bad_blocks_; }
   inspect::UintProperty& running_bad_blocks() { return running_bad_blocks_; }
 
+  inspect::UintProperty& map_cache_hits() { return map_cache_hits_; }
+  inspect::UintProperty& map_cache_misses() { return map_cache_misses_; }
+
   BlockOperationProperties& read() { return read_; }
   BlockOperationProperties& write() { return write_; }
   BlockOperationProperties& trim() { return trim_; }
@@ -121,6 +124,10 @@ class Metrics {
   inspect::UintProperty initial_bad_blocks_;
   inspect::UintProperty running_bad_blocks_;
 
+  // Map page cache lookups, and how many of them had to read the map page from the device.
+  inspect::UintProperty map_cache_hits_;
+  inspect::UintProperty map_cache_misses_;
+
   // Properties for each block operation type.
   BlockOperationProperties read_;
   BlockOperationProperties write_;
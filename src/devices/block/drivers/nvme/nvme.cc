@@ -131,6 +131,14 @@ zx::result<Completion> Nvme::DoAdminCommandSync(Submission& submission,
 }
 
 void Nvme::ProcessIoSubmissions() {
+  // Everything queued since the last wakeup is handed to the controller with one doorbell write.
+  bool ring_doorbell = false;
+  auto ring_submission_doorbell = fit::defer([&] {
+    if (ring_doorbell) {
+      io_queue_->RingSubmissionDb();
+    }
+  });
+
   while (true) {
     IoCommand* io_cmd;
     {
@@ -148,7 +156,7 @@ void Nvme::ProcessIoSubmissions() {
       NvmIoFlushSubmission submission;
       submission.namespace_id = io_cmd->namespace_id;
 
-      status = io_queue_->Submit(submission, std::nullopt, 0, 0, io_cmd);
+      status = io_queue_->Enqueue(submission, std::nullopt, 0, 0, io_cmd);
     } else {
       NvmIoSubmission submission(opcode == BLOCK_OPCODE_WRITE);
       submission.namespace_id = io_cmd->namespace_id;
@@ -158,12 +166,13 @@ void Nvme::ProcessIoSubmissions() {
       }
 
       // Convert op.rw.offset_vmo and op.rw.length to bytes.
-      status = io_queue_->Submit(submission, zx::unowned_vmo(io_cmd->op.rw.vmo),
-                                 io_cmd->op.rw.offset_vmo * io_cmd->block_size_bytes,
-                                 io_cmd->op.rw.length * io_cmd->block_size_bytes, io_cmd);
+      status = io_queue_->Enqueue(submission, zx::unowned_vmo(io_cmd->op.rw.vmo),
+                                  io_cmd->op.rw.offset_vmo * io_cmd->block_size_bytes,
+                                  io_cmd->op.rw.length * io_cmd->block_size_bytes, io_cmd);
     }
     switch (status) {
       case ZX_OK:
+        ring_doorbell = true;
         break;
       case ZX_ERR_SHOULD_WAIT:
         // We can't proceed if there is no available space in the submission queue. Put command back
@@ -108,6 +108,33 @@ TEST_F(QueuePairTest, TestSubmit) {
   sync_completion_wait(&rang, ZX_TIME_INFINITE);
 }
 
+TEST_F(QueuePairTest, TestEnqueueBatchesDoorbell) {
+  auto pair = QueuePair::Create(fake_bti_.borrow(), 0, 100, caps_, mmio_, /*prealloc_prp=*/false);
+  ASSERT_OK(pair.status_value());
+
+  size_t doorbell_ring_count = 0;
+  uint16_t last_value = 0;
+  doorbell_ring_ = [&doorbell_ring_count, &last_value](bool is_completion, size_t queue_id,
+                                                       uint16_t value) {
+    ASSERT_FALSE(is_completion);
+    ASSERT_EQ(0u, queue_id);
+    doorbell_ring_count++;
+    last_value = value;
+  };
+
+  constexpr uint16_t kSubmissions = 3;
+  for (uint16_t i = 0; i < kSubmissions; i++) {
+    Submission s(0x9f);
+    ASSERT_OK(pair->Enqueue(s, std::nullopt, 0, 0));
+  }
+  EXPECT_EQ(doorbell_ring_count, 0u);
+
+  // A single doorbell write publishes every enqueued submission.
+  pair->RingSubmissionDb();
+  EXPECT_EQ(doorbell_ring_count, 1u);
+  EXPECT_EQ(last_value, kSubmissions);
+}
+
 TEST_F(QueuePairTest, TestCheckCompletionsNothingReady) {
   auto pair = QueuePair::Create(fake_bti_.borrow(), 0, 100, caps_, mmio_, /*prealloc_prp=*/false);
   ASSERT_OK(pair.status_value());
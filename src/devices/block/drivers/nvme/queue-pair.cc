@@ -114,9 +114,14 @@ void QueuePair::RingCompletionDb() {
   completion_doorbell_.set_value(static_cast<uint32_t>(completion_.NextIndex())).WriteTo(&mmio_);
 }
 
-zx_status_t QueuePair::Submit(cpp20::span<uint8_t> submission_data,
-                              std::optional<zx::unowned_vmo> data_vmo, zx_off_t vmo_offset,
-                              size_t bytes, IoCommand* io_cmd) {
+void QueuePair::RingSubmissionDb() {
+  // Ring the doorbell.
+  submission_doorbell_.set_value(static_cast<uint32_t>(submission_.NextIndex())).WriteTo(&mmio_);
+}
+
+zx_status_t QueuePair::Enqueue(cpp20::span<uint8_t> submission_data,
+                               std::optional<zx::unowned_vmo> data_vmo, zx_off_t vmo_offset,
+                               size_t bytes, IoCommand* io_cmd) {
   if ((submission_.NextIndex() + 1) % submission_.entry_count() == sq_head_) {
     // No room. Try again later.
     return ZX_ERR_SHOULD_WAIT;
@@ -202,9 +207,6 @@ zx_status_t QueuePair::Submit(cpp20::span<uint8_t> submission_data,
   // We used Peek() before, so advance the pointer, and mark the transaction as in-flight.
   submission_.Next();
   txn_data.active = true;
-
-  // Ring the doorbell.
-  submission_doorbell_.set_value(static_cast<uint32_t>(submission_.NextIndex())).WriteTo(&mmio_);
   return ZX_OK;
 }
 
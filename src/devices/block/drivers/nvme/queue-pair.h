@@ -89,16 +89,30 @@ class QueuePair {
   // When submitting an admin command, io_cmd need not be supplied.
   zx_status_t Submit(Submission& submission, std::optional<zx::unowned_vmo> data,
                      zx_off_t vmo_offset, size_t bytes, IoCommand* io_cmd = nullptr) {
-    return Submit(cpp20::span<uint8_t>(reinterpret_cast<uint8_t*>(&submission), sizeof(submission)),
-                  std::move(data), vmo_offset, bytes, io_cmd);
+    zx_status_t status = Enqueue(submission, std::move(data), vmo_offset, bytes, io_cmd);
+    if (status == ZX_OK) {
+      RingSubmissionDb();
+    }
+    return status;
   }
 
+  // Like Submit(), but doesn't ring the submission doorbell. The controller doesn't see the
+  // submission until RingSubmissionDb() is called, which lets a batch of submissions share a single
+  // doorbell write.
+  zx_status_t Enqueue(Submission& submission, std::optional<zx::unowned_vmo> data,
+                      zx_off_t vmo_offset, size_t bytes, IoCommand* io_cmd = nullptr) {
+    return Enqueue(
+        cpp20::span<uint8_t>(reinterpret_cast<uint8_t*>(&submission), sizeof(submission)),
+        std::move(data), vmo_offset, bytes, io_cmd);
+  }
+  void RingSubmissionDb();
+
  private:
   friend class QueuePairTest;
 
-  // Raw implementation of submit that operates on a byte span rather than a submission.
-  zx_status_t Submit(cpp20::span<uint8_t> submission, std::optional<zx::unowned_vmo> data,
-                     zx_off_t vmo_offset, size_t bytes, IoCommand* io_cmd);
+  // Raw implementation of enqueue that operates on a byte span rather than a submission.
+  zx_status_t Enqueue(cpp20::span<uint8_t> submission, std::optional<zx::unowned_vmo> data,
+                      zx_off_t vmo_offset, size_t bytes, IoCommand* io_cmd);
 
   // TODO(https://fxbug.dev/42053036): Use this if setting up PRP lists that span more than one
   // page. See QueuePair::kMaxTransferPages. Puts a PRP list in |buf| containing the given
@@ -70,6 +70,15 @@ zx_status_t DecodeCsd(const std::array<uint8_t, SDMMC_CSD_SIZE>& raw_csd, fdf::L
   return ZX_OK;
 }
 
+// Returns the number of tasks the device can queue in command queue mode (section 7.4.19, eMMC
+// standard 5.1), or zero if the device doesn't support command queueing.
+uint32_t GetCommandQueueDepth(const std::array<uint8_t, MMC_EXT_CSD_SIZE>& raw_ext_csd) {
+  if (!(raw_ext_csd[MMC_EXT_CSD_CMDQ_SUPPORT] & MMC_EXT_CSD_CMDQ_SUPPORT_MASK)) {
+    return 0;
+  }
+  return (raw_ext_csd[MMC_EXT_CSD_CMDQ_DEPTH] & MMC_EXT_CSD_CMDQ_DEPTH_MASK) + 1;
+}
+
 uint64_t GetCacheSizeBits(const std::array<uint8_t, MMC_EXT_CSD_SIZE>& raw_ext_csd) {
   uint64_t cache_size = raw_ext_csd[MMC_EXT_CSD_CACHE_SIZE_MSB] << 24 |
                         raw_ext_csd[MMC_EXT_CSD_CACHE_SIZE_251] << 16 |
@@ -532,6 +541,7 @@ void SdmmcBlockDevice::MmcSetInspectProperties() {
       root_.CreateUint("max_packed_reads_effective", max_packed_reads_effective_);
   properties_.max_packed_writes_effective_ =
       root_.CreateUint("max_packed_writes_effective", max_packed_writes_effective_);
+  properties_.cmdq_depth_ = root_.CreateUint("cmdq_depth", GetCommandQueueDepth(raw_ext_csd_));
   properties_.using_fidl_ = root_.CreateBool("using_fidl", sdmmc_->using_fidl());
   properties_.power_suspended_ = root_.CreateBool("power_suspended", power_suspended_);
 }
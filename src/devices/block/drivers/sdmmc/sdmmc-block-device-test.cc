@@ -2091,6 +2091,8 @@ TEST_P(SdmmcBlockDeviceTest, Inspect) {
     out_data[MMC_EXT_CSD_DEVICE_LIFE_TIME_EST_TYP_B] = 7;
     out_data[MMC_EXT_CSD_MAX_PACKED_WRITES] = 63;
     out_data[MMC_EXT_CSD_MAX_PACKED_READS] = 62;
+    out_data[MMC_EXT_CSD_CMDQ_SUPPORT] = 1;
+    out_data[MMC_EXT_CSD_CMDQ_DEPTH] = 31;
   });
 
   ASSERT_OK(StartDriverForMmc());
@@ -2154,6 +2156,10 @@ TEST_P(SdmmcBlockDeviceTest, Inspect) {
   ASSERT_NOT_NULL(max_packed_writes_effective);
   EXPECT_EQ(max_packed_writes_effective->value(), 16);
 
+  const auto* cmdq_depth = root->node().get_property<inspect::UintPropertyValue>("cmdq_depth");
+  ASSERT_NOT_NULL(cmdq_depth);
+  EXPECT_EQ(cmdq_depth->value(), 32);
+
   // IO error count should be a successful block op.
   std::optional<block::Operation<OperationContext>> op1;
   ASSERT_NO_FATAL_FAILURE(MakeBlockOp(BLOCK_OPCODE_WRITE, 5, 0x8000, &op1));
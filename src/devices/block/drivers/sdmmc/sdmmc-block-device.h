@@ -299,6 +299,7 @@ class SdmmcBlockDevice : public block_server::Interface {
     inspect::UintProperty max_packed_writes_;            // Set once by the init thread.
     inspect::UintProperty max_packed_reads_effective_;   // Set once by the init thread.
     inspect::UintProperty max_packed_writes_effective_;  // Set once by the init thread.
+    inspect::UintProperty cmdq_depth_;                   // Set once by the init thread.
     inspect::BoolProperty using_fidl_;                   // Set once by the init thread.
     inspect::BoolProperty power_suspended_;              // Updated whenever power state changes.
   } properties_;
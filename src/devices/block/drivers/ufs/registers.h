@@ -397,6 +397,18 @@ class UicCommandArgument3Reg
   }
 };
 
+// UFSHCI Specification Version 3.0, section 5.7.1
+// "Offset 100h: CCAP – Crypto Capability".
+class CryptoCapabilityReg
+    : public hwreg::RegisterBase<CryptoCapabilityReg, uint32_t, hwreg::EnablePrinter> {
+ public:
+  DEF_FIELD(31, 24, config_array_pointer);  // In units of 0x100 bytes from the register base.
+  DEF_FIELD(15, 8, config_count);           // The number of keyslots, 0's based value
+  DEF_FIELD(7, 0, capability_count);
+
+  static auto Get() { return hwreg::RegisterAddr<CryptoCapabilityReg>(RegisterMap::kCCAP); }
+};
+
 }  // namespace ufs
 
 #endif  // SRC_DEVICES_BLOCK_DRIVERS_UFS_REGISTERS_H_
@@ -28,6 +28,13 @@ TEST_F(RegisterTest, HostCapabilities) {
       ufs_mock_device::UfsMockDevice::kNutrs);
 }
 
+TEST_F(RegisterTest, CryptoCapabilities) {
+  // Read only register. The mock device has no inline crypto engine.
+  ASSERT_FALSE(CapabilityReg::Get().ReadFrom(&dut_->GetMmio()).crypto_support());
+  EXPECT_EQ(CryptoCapabilityReg::Get().ReadFrom(&dut_->GetMmio()).capability_count(), 0u);
+  EXPECT_EQ(CryptoCapabilityReg::Get().ReadFrom(&dut_->GetMmio()).config_count(), 0u);
+}
+
 TEST_F(RegisterTest, Version) {
   // Read only register
   EXPECT_EQ(VersionReg::Get().ReadFrom(&dut_->GetMmio()).major_version_number(),
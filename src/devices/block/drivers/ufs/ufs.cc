@@ -670,6 +670,17 @@ void Ufs::PopulateCapabilitiesInspect(inspect::Node* inspect_node) {
                       caps_reg.number_of_outstanding_rtt_requests_supported());
   properties_.number_of_utp_transfer_request_slots = caps.CreateUint(
       "number_of_utp_transfer_request_slots", caps_reg.number_of_utp_transfer_request_slots());
+  if (caps_reg.crypto_support()) {
+    // The inline crypto engine isn't used yet, but record what it offers so that we know which
+    // devices could take encryption off the CPU.
+    CryptoCapabilityReg crypto_caps_reg = CryptoCapabilityReg::Get().ReadFrom(&mmio);
+    properties_.crypto_capability_count =
+        caps.CreateUint("crypto_capability_count", crypto_caps_reg.capability_count());
+    properties_.crypto_keyslot_count =
+        caps.CreateUint("crypto_keyslot_count", crypto_caps_reg.config_count() + 1);
+    FDF_LOG(INFO, "Inline crypto engine found: %u capabilities, %u keyslots",
+            crypto_caps_reg.capability_count(), crypto_caps_reg.config_count() + 1);
+  }
   inspector().inspector().emplace(std::move(caps));
 }
 
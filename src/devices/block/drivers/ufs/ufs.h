@@ -101,6 +101,8 @@ struct InspectProperties {
   inspect::UintProperty version_suffix;        // Set once by the init thread.
   // Capabilities
   inspect::BoolProperty crypto_support;                        // Set once by the init thread.
+  inspect::UintProperty crypto_capability_count;               // Set once by the init thread.
+  inspect::UintProperty crypto_keyslot_count;                  // Set once by the init thread.
   inspect::BoolProperty uic_dme_test_mode_command_supported;   // Set once by the init thread.
   inspect::BoolProperty out_of_order_data_delivery_supported;  // Set once by the init thread.
   inspect::BoolProperty _64_bit_addressing_supported;          // Set once by the init thread.
@@ -105,7 +105,7 @@ void UsbMassStorageDevice::PrepareStop(fdf::PrepareStopCompleter completer) {
     usb_request_release(csw_req_);
   }
   if (data_transfer_req_) {
-    // release_frees is indirectly cleared by DataTransfer; set it again here so that
+    // release_frees is indirectly cleared by FinishDataTransfer; set it again here so that
     // data_transfer_req_ is freed by usb_request_release.
     data_transfer_req_->release_frees = true;
     usb_request_release(data_transfer_req_);
@@ -320,6 +320,18 @@ zx_status_t UsbMassStorageDevice::Reset() {
 
 zx_status_t UsbMassStorageDevice::SendCbw(uint8_t lun, uint32_t transfer_length, uint8_t flags,
                                           uint8_t command_len, void* command) {
+  sync_completion_t completion;
+  zx_status_t status = QueueCbw(lun, transfer_length, flags, command_len, command, &completion);
+  if (status != ZX_OK) {
+    return status;
+  }
+  waiter_->Wait(&completion, ZX_TIME_INFINITE);
+  return cbw_req_->response.status;
+}
+
+zx_status_t UsbMassStorageDevice::QueueCbw(uint8_t lun, uint32_t transfer_length, uint8_t flags,
+                                           uint8_t command_len, void* command,
+                                           sync_completion_t* completion) {
   usb_request_t* req = cbw_req_;
 
   ums_cbw_t* cbw;
@@ -340,26 +352,31 @@ zx_status_t UsbMassStorageDevice::SendCbw(uint8_t lun, uint32_t transfer_length,
   // copy command_len bytes from the command passed in into the command_len
   memcpy(cbw->CBWCB, command, command_len);
 
-  sync_completion_t completion;
   usb_request_complete_callback_t complete = {
       .callback = ReqComplete,
-      .ctx = &completion,
+      .ctx = completion,
   };
   RequestQueue(req, &complete);
-  waiter_->Wait(&completion, ZX_TIME_INFINITE);
-  return req->response.status;
+  return ZX_OK;
 }
 
 zx_status_t UsbMassStorageDevice::ReadCsw(uint32_t* out_residue, bool retry) {
   sync_completion_t completion;
+  QueueCsw(&completion);
+  waiter_->Wait(&completion, ZX_TIME_INFINITE);
+  return FinishCsw(out_residue, retry);
+}
+
+void UsbMassStorageDevice::QueueCsw(sync_completion_t* completion) {
   usb_request_complete_callback_t complete = {
       .callback = ReqComplete,
-      .ctx = &completion,
+      .ctx = completion,
   };
+  RequestQueue(csw_req_, &complete);
+}
 
+zx_status_t UsbMassStorageDevice::FinishCsw(uint32_t* out_residue, bool retry) {
   usb_request_t* csw_request = csw_req_;
-  RequestQueue(csw_request, &complete);
-  waiter_->Wait(&completion, ZX_TIME_INFINITE);
   if (csw_request->response.status != ZX_OK) {
     if (csw_request->response.status == ZX_ERR_IO_REFUSED) {
       if (retry) {
@@ -484,8 +501,9 @@ zx_status_t UsbMassStorageDevice::ExecuteCommandSync(uint8_t target, uint16_t lu
   return status;
 }
 
-zx_status_t UsbMassStorageDevice::DataTransfer(zx_handle_t vmo_handle, zx_off_t offset,
-                                               size_t length, uint8_t ep_address) {
+zx_status_t UsbMassStorageDevice::QueueDataTransfer(zx_handle_t vmo_handle, zx_off_t offset,
+                                                    size_t length, uint8_t ep_address,
+                                                    sync_completion_t* completion) {
   usb_request_t* req = data_transfer_req_;
 
   zx_status_t status = usb_request_init(req, vmo_handle, offset, length, ep_address);
@@ -493,15 +511,18 @@ zx_status_t UsbMassStorageDevice::DataTransfer(zx_handle_t vmo_handle, zx_off_t
     return status;
   }
 
-  sync_completion_t completion;
   usb_request_complete_callback_t complete = {
       .callback = ReqComplete,
-      .ctx = &completion,
+      .ctx = completion,
   };
   RequestQueue(req, &complete);
-  waiter_->Wait(&completion, ZX_TIME_INFINITE);
+  return ZX_OK;
+}
 
-  status = req->response.status;
+zx_status_t UsbMassStorageDevice::FinishDataTransfer(size_t length) {
+  usb_request_t* req = data_transfer_req_;
+
+  zx_status_t status = req->response.status;
   if (status == ZX_OK && req->response.actual != length) {
     status = ZX_ERR_IO;
   }
@@ -518,30 +539,70 @@ zx_status_t UsbMassStorageDevice::DoTransaction(Transaction* txn, uint8_t flags,
                                ? sizeof(txn->data_buffer)
                                : op.rw.length * txn->block_size_bytes;
 
-  zx_status_t status =
-      SendCbw(txn->lun, static_cast<uint32_t>(num_bytes), flags, txn->cdb_length, txn->cdb_buffer);
+  // All three stages of the transaction are queued up front rather than each one after the
+  // completion of the previous one, so that the host controller can move on to the next stage as
+  // soon as the device is ready for it. Requests on an endpoint complete in order, so the CSW,
+  // which shares the bulk IN endpoint with read data, is only received after the data stage.
+  sync_completion_t cbw_completion;
+  zx_status_t status = QueueCbw(txn->lun, static_cast<uint32_t>(num_bytes), flags, txn->cdb_length,
+                                txn->cdb_buffer, &cbw_completion);
   if (status != ZX_OK) {
     FDF_LOG(WARNING, "UMS: SendCbw during %s failed with status %s", action.c_str(),
             zx_status_get_string(status));
     return status;
   }
 
+  sync_completion_t data_completion;
+  bool data_queued = false;
   if (num_bytes) {
     if (op.command.opcode == BLOCK_OPCODE_TRIM) {
-      status = DataTransfer(txn->data_vmo.get(), 0, num_bytes, ep_address);
+      status = QueueDataTransfer(txn->data_vmo.get(), 0, num_bytes, ep_address, &data_completion);
     } else {
       zx_off_t vmo_offset = op.rw.offset_vmo * txn->block_size_bytes;
-      status = DataTransfer(op.rw.vmo, vmo_offset, num_bytes, ep_address);
+      status = QueueDataTransfer(op.rw.vmo, vmo_offset, num_bytes, ep_address, &data_completion);
     }
+    data_queued = status == ZX_OK;
+  }
+
+  sync_completion_t csw_completion;
+  bool csw_queued = false;
+  if (status == ZX_OK) {
+    QueueCsw(&csw_completion);
+    csw_queued = true;
+  }
 
+  waiter_->Wait(&cbw_completion, ZX_TIME_INFINITE);
+  if (status == ZX_OK) {
+    status = cbw_req_->response.status;
     if (status != ZX_OK) {
-      return status;
+      FDF_LOG(WARNING, "UMS: SendCbw during %s failed with status %s", action.c_str(),
+              zx_status_get_string(status));
     }
   }
 
+  if (status != ZX_OK) {
+    // The device won't go on to the stages which are still queued, so cancel them.
+    CancelQueuedStages();
+  }
+  if (data_queued) {
+    waiter_->Wait(&data_completion, ZX_TIME_INFINITE);
+    zx_status_t data_status = FinishDataTransfer(num_bytes);
+    if (status == ZX_OK && data_status != ZX_OK) {
+      status = data_status;
+      CancelQueuedStages();
+    }
+  }
+  if (!csw_queued) {
+    return status;
+  }
+  waiter_->Wait(&csw_completion, ZX_TIME_INFINITE);
+  if (status != ZX_OK) {
+    return status;
+  }
+
   // receive CSW
   uint32_t residue;
-  status = ReadCsw(&residue);
+  status = FinishCsw(&residue);
   if (status == ZX_OK && residue) {
     FDF_LOG(ERROR, "unexpected residue in %s", action.c_str());
     status = ZX_ERR_IO;
@@ -550,6 +611,16 @@ zx_status_t UsbMassStorageDevice::DoTransaction(Transaction* txn, uint8_t flags,
   return status;
 }
 
+void UsbMassStorageDevice::CancelQueuedStages() {
+  for (uint8_t ep_address : {bulk_out_addr_, bulk_in_addr_}) {
+    zx_status_t status = usb_.CancelAll(ep_address);
+    if (status != ZX_OK) {
+      FDF_LOG(DEBUG, "UMS: cancelling requests on endpoint 0x%02x failed: %s", ep_address,
+              zx_status_get_string(status));
+    }
+  }
+}
+
 zx_status_t UsbMassStorageDevice::CheckLunsReady() {
   if (dead_) {
     return ZX_OK;
@@ -110,22 +110,38 @@ class UsbMassStorageDevice : public fdf::DriverBase, public scsi::Controller {
   zx_status_t SendCbw(uint8_t lun, uint32_t transfer_length, uint8_t flags, uint8_t command_len,
                       void* command);
 
+  // Queues a Command Block Wrapper without waiting for it to be sent. |completion| is signaled
+  // once cbw_req_ completes.
+  zx_status_t QueueCbw(uint8_t lun, uint32_t transfer_length, uint8_t flags, uint8_t command_len,
+                       void* command, sync_completion_t* completion);
+
   // Reads a Command Status Wrapper from a USB mass storage device
   // and validates that the command index in the response matches the index
   // in the previous request.
   zx_status_t ReadCsw(uint32_t* out_residue, bool retry = false);
 
+  // Queues csw_req_ to receive a Command Status Wrapper. |completion| is signaled once it
+  // completes, after which FinishCsw() validates it.
+  void QueueCsw(sync_completion_t* completion);
+  zx_status_t FinishCsw(uint32_t* out_residue, bool retry = false);
+
   // Validates the command index and signature of a command status wrapper.
   csw_status_t VerifyCsw(usb_request_t* csw_request, uint32_t* out_residue);
 
   zx_status_t ReadSync(size_t transfer_length);
 
-  zx_status_t DataTransfer(zx_handle_t vmo_handle, zx_off_t offset, size_t length,
-                           uint8_t ep_address);
+  // Queues the data stage of a transaction using data_transfer_req_. Once |completion| is
+  // signaled, FinishDataTransfer() must be called to check the result and release the request.
+  zx_status_t QueueDataTransfer(zx_handle_t vmo_handle, zx_off_t offset, size_t length,
+                                uint8_t ep_address, sync_completion_t* completion);
+  zx_status_t FinishDataTransfer(size_t length);
 
   zx_status_t DoTransaction(Transaction* txn, uint8_t flags, uint8_t ep_address,
                             const std::string& action);
 
+  // Cancels the requests of a transaction which are still queued on the bulk endpoints.
+  void CancelQueuedStages();
+
   zx_status_t CheckLunsReady();
 
   void WorkerLoop();
@@ -165,7 +181,7 @@ class UsbMassStorageDevice : public fdf::DriverBase, public scsi::Controller {
 
   usb_request_t* csw_req_;
 
-  usb_request_t* data_transfer_req_;  // for use in DataTransfer
+  usb_request_t* data_transfer_req_;  // for use in QueueDataTransfer
 
   size_t parent_req_size_;
 
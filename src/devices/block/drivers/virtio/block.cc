@@ -130,7 +130,9 @@ zx_status_t BlockDevice::Init() {
     zxlogf(INFO, "virtio device supports discard");
     supports_discard_ = true;
   }
-  features &= (VIRTIO_F_VERSION_1 | VIRTIO_BLK_F_DISCARD);
+  constexpr uint64_t kIndirectDesc = 1ull << VIRTIO_RING_F_INDIRECT_DESC;
+  constexpr uint64_t kEventIdx = 1ull << VIRTIO_RING_F_EVENT_IDX;
+  features &= (VIRTIO_F_VERSION_1 | VIRTIO_BLK_F_DISCARD | kIndirectDesc | kEventIdx);
   DriverFeaturesAck(features);
   if (zx_status_t status = DeviceStatusFeaturesOk(); status != ZX_OK) {
     zxlogf(ERROR, "Feature negotiation failed: %s", zx_status_get_string(status));
@@ -143,6 +145,10 @@ zx_status_t BlockDevice::Init() {
     zxlogf(ERROR, "failed to allocate vring");
     return err;
   }
+  if (features & kEventIdx) {
+    zxlogf(INFO, "virtio device supports event index");
+    vring_.SetUseEventIndex(true);
+  }
 
   // Allocate a queue of block requests.
   size_t size = sizeof(virtio_blk_req_t) * blk_req_count + sizeof(uint8_t) * blk_req_count;
@@ -167,6 +173,19 @@ zx_status_t BlockDevice::Init() {
   zxlogf(TRACE, "allocated blk responses at %p, physical address %#" PRIxPTR "", blk_res_,
          blk_res_pa_);
 
+  if (features & kIndirectDesc) {
+    const size_t indirect_size =
+        fbl::round_up(sizeof(vring_desc) * indirect_desc_count * blk_req_count,
+                      zx_system_get_page_size());
+    status = buffer_factory->CreateContiguous(bti_, indirect_size, 0, &indirect_desc_buf_);
+    if (status != ZX_OK) {
+      zxlogf(ERROR, "cannot alloc indirect descriptors: %s", zx_status_get_string(status));
+      return status;
+    }
+    indirect_desc_ = static_cast<vring_desc*>(indirect_desc_buf_->virt());
+    zxlogf(INFO, "virtio device supports indirect descriptors");
+  }
+
   StartIrqThread();
   DriverStatusOk();
 
@@ -345,12 +364,19 @@ zx_status_t BlockDevice::QueueTxn(block_txn_t* txn, uint32_t type, size_t bytes,
   vring_desc* desc;
   uint16_t num_descriptors =
       (type == VIRTIO_BLK_T_DISCARD ? 3u : 2u) + static_cast<uint16_t>(pagecount);
+  // With indirect descriptors, the chain is built in the table of |req_index| and the ring only
+  // holds a single descriptor pointing to it.
+  vring_desc* table = nullptr;
+  if (indirect_desc_ && num_descriptors <= indirect_desc_count) {
+    table = &indirect_desc_[req_index * indirect_desc_count];
+  }
   {
     std::lock_guard<std::mutex> lock(ring_lock_);
-    desc = vring_.AllocDescChain(num_descriptors, &i);
+    desc = vring_.AllocDescChain(table ? 1 : num_descriptors, &i);
   }
   if (!desc) {
-    zxlogf(TRACE, "failed to allocate descriptor chain of length %zu", 2u + pagecount);
+    zxlogf(TRACE, "failed to allocate descriptor chain of length %u",
+           table ? 1u : num_descriptors);
     std::lock_guard<std::mutex> lock(txn_lock_);
     free_blk_req(req_index);
     if (discard_req_index) {
@@ -364,6 +390,23 @@ zx_status_t BlockDevice::QueueTxn(block_txn_t* txn, uint32_t type, size_t bytes,
   // Point the txn at this head descriptor.
   txn->desc = desc;
 
+  if (table) {
+    desc->addr = indirect_desc_buf_->phys() + req_index * indirect_desc_count * sizeof(vring_desc);
+    desc->len = static_cast<uint32_t>(num_descriptors * sizeof(vring_desc));
+    desc->flags = VRING_DESC_F_INDIRECT;
+    if (zxlog_level_enabled(TRACE)) {
+      virtio_dump_desc(desc);
+    }
+    for (uint16_t n = 0; n < num_descriptors; n++) {
+      table[n].next = static_cast<uint16_t>(n + 1);
+    }
+    desc = &table[0];
+  }
+  // Descriptors of the chain are linked through |next|, which indexes either the table or the ring.
+  auto next_desc = [this, table](const vring_desc* prev) {
+    return table ? &table[prev->next] : vring_.DescFromIndex(prev->next);
+  };
+
   // Set up the descriptor pointing to the head.
   desc->addr = blk_req_buf_->phys() + req_index * sizeof(virtio_blk_req_t);
   desc->len = sizeof(virtio_blk_req_t);
@@ -373,7 +416,7 @@ zx_status_t BlockDevice::QueueTxn(block_txn_t* txn, uint32_t type, size_t bytes,
   }
 
   for (size_t n = 0; n < pagecount; n++) {
-    desc = vring_.DescFromIndex(desc->next);
+    desc = next_desc(desc);
     desc->addr = pages[n];  // |pages| are all page-aligned addresses.
     desc->len = static_cast<uint32_t>((bytes > kPageSize) ? kPageSize : bytes);
     if (n == 0) {
@@ -405,7 +448,7 @@ zx_status_t BlockDevice::QueueTxn(block_txn_t* txn, uint32_t type, size_t bytes,
   assert(bytes == 0);
 
   if (type == VIRTIO_BLK_T_DISCARD) {
-    desc = vring_.DescFromIndex(desc->next);
+    desc = next_desc(desc);
     desc->addr = blk_req_buf_->phys() + *discard_req_index * sizeof(virtio_blk_req_t);
     desc->len = sizeof(virtio_blk_discard_write_zeroes_t);
     desc->flags = VRING_DESC_F_NEXT;
@@ -415,7 +458,7 @@ zx_status_t BlockDevice::QueueTxn(block_txn_t* txn, uint32_t type, size_t bytes,
   }
 
   // Set up the descriptor pointing to the response.
-  desc = vring_.DescFromIndex(desc->next);
+  desc = next_desc(desc);
   desc->addr = blk_res_pa_ + req_index;
   desc->len = 1;
   desc->flags = VRING_DESC_F_WRITE;
@@ -102,6 +102,12 @@ class BlockDevice : public Device,
   uint32_t blk_req_bitmap_ = 0;
   static_assert(blk_req_count <= sizeof(blk_req_bitmap_) * CHAR_BIT, "");
 
+  // If VIRTIO_RING_F_INDIRECT_DESC is negotiated, each block request gets a descriptor table of
+  // its own, so that a transfer takes a single descriptor of the ring however many pages it spans.
+  static const uint16_t indirect_desc_count = ring_size;
+  std::unique_ptr<dma_buffer::ContiguousBuffer> indirect_desc_buf_;
+  vring_desc* indirect_desc_ = nullptr;
+
   // When a transaction is enqueued, its start time (in the monotonic clock) is recorded, and the
   // timestamp is cleared when the transaction completes.  A watchdog task will fire after a
   // configured interval, and all timestamps will be checked against a deadline; if any exceed the
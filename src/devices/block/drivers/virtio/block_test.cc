@@ -8,6 +8,7 @@
 #include <lib/sync/completion.h>
 #include <lib/virtio/backends/fake.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
 #include <memory>
@@ -44,6 +45,8 @@ class FakeBackendForBlock : public virtio::FakeBackend {
   }
 
   void set_status(uint8_t status) { status_ = status; }
+  void set_extra_features(uint64_t features) { extra_features_ = features; }
+  size_t indirect_chains() const { return indirect_chains_; }
 
   uint64_t ReadFeatures() override {
     uint64_t bitmap = FakeBackend::ReadFeatures();
@@ -51,7 +54,7 @@ class FakeBackendForBlock : public virtio::FakeBackend {
     // Declare support for VIRTIO_F_VERSION_1.
     bitmap |= VIRTIO_F_VERSION_1;
 
-    return bitmap;
+    return bitmap | extra_features_;
   }
 
   void RingKick(uint16_t ring_index) override {
@@ -92,14 +95,27 @@ class FakeBackendForBlock : public virtio::FakeBackend {
                             sizeof(descriptors)));
 
       // Find the last descriptor.
+      vring_desc* chain = descriptors;
       vring_desc* desc = &descriptors[avail.ring[index]];
+      vring_desc table[kRingSize];
+      if (desc->flags & VRING_DESC_F_INDIRECT) {
+        // The chain lives in an indirect table, which is in the third VMO.
+        ASSERT_LE(3, count);
+        ASSERT_FALSE(desc->flags & VRING_DESC_F_NEXT);
+        ASSERT_LE(desc->len, sizeof(table));
+        ASSERT_OK(zx_vmo_read(vmos[2].vmo, table, vmos[2].offset + desc->addr - FAKE_BTI_PHYS_ADDR,
+                              desc->len));
+        chain = table;
+        desc = &table[0];
+        ++indirect_chains_;
+      }
       uint16_t count = 1;
       uint16_t data_descriptor_idx = UINT16_MAX;
       while (desc->flags & VRING_DESC_F_NEXT) {
         if (desc->addr % zx_system_get_page_size() == kBlkSize * kVmoOffsetBlocks) {
           data_descriptor_idx = count;
         }
-        desc = &descriptors[desc->next];
+        desc = &chain[desc->next];
         ++count;
       }
       // The second-last descriptor describes the first page of data transfer (the first descriptor
@@ -187,6 +203,9 @@ class FakeBackendForBlock : public virtio::FakeBackend {
 
   // The status returned for any operations.
   uint8_t status_ = VIRTIO_BLK_S_OK;
+
+  uint64_t extra_features_ = 0;
+  std::atomic<size_t> indirect_chains_ = 0;
 };
 
 TEST(BlockTest, InitSuccess) {
@@ -206,11 +225,13 @@ class BlockDeviceTest : public zxtest::Test {
  public:
   ~BlockDeviceTest() {}
 
-  void InitDevice(uint8_t status = VIRTIO_BLK_S_OK) {
+  void InitDevice(uint8_t status = VIRTIO_BLK_S_OK, uint64_t extra_features = 0) {
     zx::bti bti(ZX_HANDLE_INVALID);
     ASSERT_OK(fake_bti_create(bti.reset_and_get_address()));
     auto backend = std::make_unique<FakeBackendForBlock>(bti.get());
     backend->set_status(status);
+    backend->set_extra_features(extra_features);
+    backend_ = backend.get();
 
     fake_root_ = MockDevice::FakeRootParent();
     device_ =
@@ -257,6 +278,7 @@ class BlockDeviceTest : public zxtest::Test {
 
  protected:
   std::unique_ptr<virtio::BlockDevice> device_;
+  FakeBackendForBlock* backend_ = nullptr;
   block_info_t info_;
   size_t operation_size_;
 
@@ -324,6 +346,22 @@ TEST_F(BlockDeviceTest, ReadError) {
   RemoveDevice();
 }
 
+TEST_F(BlockDeviceTest, ReadOkWithIndirectDescriptors) {
+  InitDevice(VIRTIO_BLK_S_OK, 1ull << VIRTIO_RING_F_INDIRECT_DESC);
+
+  virtio::block_txn_t txn = TestReadCommand();
+  zx::vmo vmo;
+  ASSERT_OK(zx::vmo::create(zx_system_get_page_size(), 0, &vmo));
+  txn.op.rw.vmo = vmo.get();
+  device_->BlockImplQueue(reinterpret_cast<block_op_t*>(&txn), &BlockDeviceTest::CompletionCb,
+                          this);
+  ASSERT_TRUE(Wait());
+  ASSERT_EQ(ZX_OK, OperationStatus());
+  ASSERT_EQ(1u, backend_->indirect_chains());
+
+  RemoveDevice();
+}
+
 TEST_F(BlockDeviceTest, Trim) {
   InitDevice();
 
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <zircon/errors.h>
 #include <zircon/status.h>
+#include <zircon/syscalls.h>
 #include <zircon/syscalls/port.h>
 
 #include <algorithm>
@@ -54,7 +55,15 @@ zx_status_t Device::Init(const DdkVolume& volume) {
   }
 
   // Start workers
-  for (size_t i = 0; i < kNumWorkers; ++i) {
+  const uint32_t num_workers = std::clamp(zx_system_get_num_cpus(), kMinWorkers, kMaxWorkers);
+  fbl::AllocChecker ac;
+  workers_.reset(new (&ac) Worker[num_workers]);
+  if (!ac.check()) {
+    zxlogf(ERROR, "failed to allocate %u workers", num_workers);
+    return ZX_ERR_NO_MEMORY;
+  }
+  num_workers_ = num_workers;
+  for (size_t i = 0; i < num_workers_; ++i) {
     if ((rc = workers_[i].Start(this, volume, worker_queue_)) != ZX_OK) {
       zxlogf(ERROR, "failed to start worker %zu: %s", i, zx_status_get_string(rc));
       return rc;
@@ -68,6 +77,9 @@ zx_status_t Device::Init(const DdkVolume& volume) {
     info_.partition_protocol.GetGuid(GUIDTYPE_INSTANCE, &guid);
     instance_guid_ = inspect_.CreateString("instance_guid", guid_str);
   }
+  num_workers_property_ = inspect_.CreateUint("num_workers", num_workers_);
+  bytes_encrypted_ = inspect_.CreateUint("bytes_encrypted", 0);
+  bytes_decrypted_ = inspect_.CreateUint("bytes_decrypted", 0);
 
   // Enable the device.
   active_.store(true);
@@ -115,7 +127,7 @@ void Device::DdkRelease() {
 
   // Stop workers; send a stop message to each, then join each (possibly in different order).
   StopWorkersIfDone();
-  for (size_t i = 0; i < kNumWorkers; ++i) {
+  for (size_t i = 0; i < num_workers_; ++i) {
     workers_[i].Stop();
   }
 }
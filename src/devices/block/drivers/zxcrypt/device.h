@@ -18,6 +18,7 @@
 #include <zircon/types.h>
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 
 #include <bitmap/raw-bitmap.h>
@@ -89,12 +90,17 @@ class Device final : public DeviceType,
   // Returns a completed |block| request to the caller of |BlockQueue|.
   void BlockComplete(block_op_t* block, zx_status_t status) __TA_EXCLUDES(mtx_);
 
+  // Called by the workers to account for the bytes they have transformed.
+  void OnEncrypted(uint64_t bytes) { bytes_encrypted_.Add(bytes); }
+  void OnDecrypted(uint64_t bytes) { bytes_decrypted_.Add(bytes); }
+
  private:
   DISALLOW_COPY_ASSIGN_AND_MOVE(Device);
 
-  // TODO(aarongreen): Investigate performance impact of changing this.
-  // Number of encrypting/decrypting workers
-  static const size_t kNumWorkers = 2;
+  // Bounds on the number of encrypting/decrypting workers. Within these, one worker is started per
+  // CPU.
+  static constexpr uint32_t kMinWorkers = 2;
+  static constexpr uint32_t kMaxWorkers = 8;
 
   // Adds |block| to the write queue if not null, and sends to the workers as many write requests
   // as fit in the space available in the write buffer.
@@ -127,7 +133,8 @@ class Device final : public DeviceType,
   Queue<block_op_t*> worker_queue_;
 
   // Threads that performs encryption/decryption.
-  Worker workers_[kNumWorkers];
+  std::unique_ptr<Worker[]> workers_;
+  size_t num_workers_ = 0;
 
   // Primary lock for accessing the write queue
   std::mutex mtx_;
@@ -141,6 +148,9 @@ class Device final : public DeviceType,
   // inspect::Node tracking unsealed device GUID.
   inspect::Node inspect_;
   inspect::StringProperty instance_guid_;
+  inspect::UintProperty num_workers_property_;
+  inspect::UintProperty bytes_encrypted_;
+  inspect::UintProperty bytes_decrypted_;
 
   // Hint as to where in the bitmap to begin looking for available space.
   size_t hint_ __TA_GUARDED(mtx_);
@@ -122,6 +122,7 @@ zx_status_t Worker::EncryptWrite(block_op_t* block) {
     zxlogf(ERROR, "failed to encrypt: %s", zx_status_get_string(rc));
     return rc;
   }
+  device_->OnEncrypted(length);
 
   return ZX_OK;
 }
@@ -173,6 +174,7 @@ zx_status_t Worker::DecryptRead(block_op_t* block) {
     zxlogf(ERROR, "failed to decrypt: %s", zx_status_get_string(rc));
     return rc;
   }
+  device_->OnDecrypted(length);
 
   return ZX_OK;
 }
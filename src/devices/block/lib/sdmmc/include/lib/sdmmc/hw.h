@@ -152,6 +152,8 @@ __BEGIN_CDECLS
 // EXT_CSD fields (MMC)
 #define MMC_EXT_CSD_SIZE 512
 
+#define MMC_EXT_CSD_CMDQ_MODE_EN 15
+
 #define MMC_EXT_CSD_FLUSH_CACHE 32
 #define MMC_EXT_CSD_FLUSH_MASK 0x01
 #define MMC_EXT_CSD_CACHE_CTRL 33
@@ -197,6 +199,11 @@ __BEGIN_CDECLS
 // All invalid values are set to this.
 #define MMC_EXT_CSD_DEVICE_LIFE_TIME_EST_INVALID 0xc
 
+#define MMC_EXT_CSD_CMDQ_DEPTH 307
+#define MMC_EXT_CSD_CMDQ_DEPTH_MASK 0x1f
+#define MMC_EXT_CSD_CMDQ_SUPPORT 308
+#define MMC_EXT_CSD_CMDQ_SUPPORT_MASK 0x01
+
 #define MMC_EXT_CSD_MAX_PACKED_WRITES 500
 #define MMC_EXT_CSD_MAX_PACKED_READS 501
 
@@ -36,6 +36,10 @@ class Ring {
   void SubmitChain(uint16_t desc_index);
   void Kick();
 
+  // Uses the used_event and avail_event fields to suppress notifications in both directions. Only
+  // enable this if VIRTIO_RING_F_EVENT_IDX was negotiated with the device.
+  void SetUseEventIndex(bool use) { use_event_index_ = use; }
+
   struct vring_desc* DescFromIndex(uint16_t index) { return &ring_.desc[index]; }
 
   template <typename T>
@@ -70,6 +74,11 @@ class Ring {
   uint16_t index_ = 0;
 
   vring ring_ = {};
+
+  bool use_event_index_ = false;
+  // The avail->idx value at the last notification, used to decide whether the device asked to be
+  // notified about the chains submitted since.
+  uint16_t kicked_avail_idx_ = 0;
 };
 
 // perform the main loop of finding free descriptor chains and passing it to a passed in function
@@ -82,21 +91,33 @@ inline void Ring::IrqRingUpdate(T free_chain) {
   //        ring_.last_used);
 
   // find a new free chain of descriptors
-  uint16_t cur_idx = ring_.used->idx;
   uint16_t i = ring_.last_used;
-  // Read memory barrier before processing a descriptor chain. If we see an updated used->idx
-  // we must see updated descriptor chains in the used ring.
-  hw_rmb();
-  for (; i != cur_idx; ++i) {
-    // TRACEF("looking at idx %u\n", i);
-
-    struct vring_used_elem* used_elem = &ring_.used->ring[i & ring_.num_mask];
-    // TRACEF("used chain id %u, len %u\n", used_elem->id, used_elem->len);
-
-    // free the chain
-    free_chain(used_elem);
+  for (;;) {
+    uint16_t cur_idx = ring_.used->idx;
+    // Read memory barrier before processing a descriptor chain. If we see an updated used->idx
+    // we must see updated descriptor chains in the used ring.
+    hw_rmb();
+    for (; i != cur_idx; ++i) {
+      // TRACEF("looking at idx %u\n", i);
+
+      struct vring_used_elem* used_elem = &ring_.used->ring[i & ring_.num_mask];
+      // TRACEF("used chain id %u, len %u\n", used_elem->id, used_elem->len);
+
+      // free the chain
+      free_chain(used_elem);
+    }
+    ring_.last_used = i;
+    if (!use_event_index_) {
+      break;
+    }
+    // Ask for an interrupt when the device uses the next chain. The device may have used more
+    // chains before it could see the new used_event, so check used->idx again after publishing it.
+    vring_used_event(&ring_) = i;
+    hw_mb();
+    if (ring_.used->idx == i) {
+      break;
+    }
   }
-  ring_.last_used = i;
 }
 
 void virtio_dump_desc(const struct vring_desc* desc);
@@ -36,6 +36,8 @@ Ring::Ring(Ring&& other) noexcept {
   ring_buffer_ = std::move(other.ring_buffer_);
   ring_ = other.ring_;
   other.ring_ = vring{};
+  use_event_index_ = other.use_event_index_;
+  kicked_avail_idx_ = other.kicked_avail_idx_;
 }
 
 Ring::~Ring() = default;
@@ -47,6 +49,8 @@ Ring& Ring::operator=(Ring&& other) noexcept {
   ring_buffer_ = std::move(other.ring_buffer_);
   ring_ = other.ring_;
   other.ring_ = vring{};
+  use_event_index_ = other.use_event_index_;
+  kicked_avail_idx_ = other.kicked_avail_idx_;
   return *this;
 }
 
@@ -172,6 +176,17 @@ void Ring::Kick() {
   // before the device sees the wakeup notification (so it processes the latest descriptors).
   hw_mb();
 
+  if (use_event_index_) {
+    // Virtio 1.0 Section 2.4.7.2: only notify if the device's avail_event lies within the chains
+    // submitted since the last notification.
+    uint16_t new_idx = ring_.avail->idx;
+    uint16_t old_idx = kicked_avail_idx_;
+    kicked_avail_idx_ = new_idx;
+    if (!vring_need_event(vring_avail_event(&ring_), new_idx, old_idx)) {
+      return;
+    }
+  }
+
   device_->RingKick(index_);
 }
 
@@ -470,6 +470,54 @@ TEST_F(AmlCpuTest, TestCpuInfo) {
   });
 }
 
+TEST_F(AmlCpuTest, TestOperatingPointResidency) {
+  using namespace inspect::testing;
+
+  StartWithMetadata(kTestPerfDomains, kTestOperatingPoints);
+  ConnectToCpuCtrl(kTestPerfDomains[0]);
+
+  // Init already switched from the slowest opp to the fastest one, then go down and back up.
+  const uint32_t min_opp_index = static_cast<uint32_t>(kTestOperatingPoints.size() - 1);
+  driver_test().RunInEnvironmentTypeContext([](AmlCpuEnvironment& env) {
+    env.power_server_.SetVoltage(kTestOperatingPoints.back().volt_uv);
+  });
+  auto min_result = cpu_ctrl_->SetCurrentOperatingPoint(min_opp_index);
+  ASSERT_OK(min_result.status());
+  ASSERT_TRUE(min_result->is_ok());
+
+  driver_test().RunInEnvironmentTypeContext([](AmlCpuEnvironment& env) {
+    env.power_server_.SetVoltage(kTestOperatingPoints.front().volt_uv);
+  });
+  auto max_result = cpu_ctrl_->SetCurrentOperatingPoint(0);
+  ASSERT_OK(max_result.status());
+  ASSERT_TRUE(max_result->is_ok());
+
+  driver_test().RunInDriverContext([min_opp_index](AmlCpuDriver& driver) {
+    auto& dut = driver.performance_domains().front();
+
+    auto hierarchy = inspect::ReadFromVmo(dut->Inspector().inspector().DuplicateVmo());
+    ASSERT_TRUE(hierarchy.is_ok());
+    auto* residency = hierarchy.value().GetByPath({"opp_residency_testpd"});
+    ASSERT_TRUE(residency);
+    EXPECT_THAT(*residency,
+                NodeMatches(PropertyList(testing::ElementsAre(UintIs("transitions", 3)))));
+
+    auto* fastest = residency->GetByPath({"0"});
+    ASSERT_TRUE(fastest);
+    EXPECT_THAT(*fastest, NodeMatches(PropertyList(testing::IsSupersetOf({
+                              UintIs("frequency_hz", kTestOperatingPoints.front().freq_hz),
+                              UintIs("entries", 2),
+                          }))));
+
+    auto* slowest = residency->GetByPath({std::to_string(min_opp_index)});
+    ASSERT_TRUE(slowest);
+    EXPECT_THAT(*slowest, NodeMatches(PropertyList(testing::IsSupersetOf({
+                              UintIs("frequency_hz", kTestOperatingPoints.back().freq_hz),
+                              UintIs("entries", 1),
+                          }))));
+  });
+}
+
 TEST_F(AmlCpuTest, TestGetOperatingPointCount) {
   StartWithMetadata(kTestPerfDomains, kTestOperatingPoints);
   ConnectToCpuCtrl(kTestPerfDomains[0]);
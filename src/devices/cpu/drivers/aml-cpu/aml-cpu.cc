@@ -12,8 +12,10 @@
 #include <lib/trace-engine/types.h>
 #include <lib/trace/event.h>
 #include <lib/trace/event_args.h>
+#include <lib/zx/clock.h>
 #include <zircon/syscalls/smc.h>
 
+#include <string>
 #include <vector>
 
 namespace amlogic_cpu {
@@ -260,6 +262,7 @@ zx_status_t AmlCpu::SetCurrentOperatingPointInternal(uint32_t requested_opp, uin
 
   FDF_LOG(DEBUG, "switch opp from %u to %u success!\n", current_operating_point_, requested_opp);
 
+  RecordOperatingPointSwitch(requested_opp);
   current_operating_point_ = requested_opp;
 
   // Cancel any deferred unwind calls.
@@ -339,6 +342,8 @@ zx_status_t AmlCpu::Init(fidl::ClientEnd<fuchsia_hardware_clock::Clock> plldiv16
     }
   }
 
+  InitOperatingPointStats();
+
   uint32_t actual;
   // Returns ZX_ERR_OUT_OF_RANGE if `operating_points_` is empty.
   zx_status_t result = SetCurrentOperatingPointInternal(kInitialOpp, &actual);
@@ -356,6 +361,35 @@ zx_status_t AmlCpu::Init(fidl::ClientEnd<fuchsia_hardware_clock::Clock> plldiv16
   return ZX_OK;
 }
 
+void AmlCpu::InitOperatingPointStats() {
+  std::scoped_lock lock(lock_);
+
+  inspect_transitions_ = opp_residency_.CreateUint("transitions", 0);
+  opp_stats_.clear();
+  opp_stats_.reserve(operating_points_.size());
+  for (size_t i = 0; i < operating_points_.size(); ++i) {
+    OperatingPointStats stats;
+    stats.node = opp_residency_.CreateChild(std::to_string(i));
+    stats.frequency_hz = stats.node.CreateUint("frequency_hz", operating_points_[i].freq_hz);
+    stats.residency_ns = stats.node.CreateUint("residency_ns", 0);
+    stats.entries = stats.node.CreateUint("entries", 0);
+    opp_stats_.push_back(std::move(stats));
+  }
+  opp_entered_at_ = zx::clock::get_monotonic();
+}
+
+void AmlCpu::RecordOperatingPointSwitch(uint32_t new_opp) {
+  if (opp_stats_.empty()) {
+    return;
+  }
+
+  const zx::time now = zx::clock::get_monotonic();
+  opp_stats_[current_operating_point_].residency_ns.Add((now - opp_entered_at_).to_nsecs());
+  opp_stats_[new_opp].entries.Add(1);
+  inspect_transitions_.Add(1);
+  opp_entered_at_ = now;
+}
+
 void AmlCpu::SetCpuInfo(uint32_t cpu_version_packed) {
   const uint8_t major_revision = (cpu_version_packed >> 24) & 0xff;
   const uint8_t minor_revision = (cpu_version_packed >> 8) & 0xff;
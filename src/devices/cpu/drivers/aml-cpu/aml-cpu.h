@@ -12,8 +12,10 @@
 #include <lib/device-protocol/pdev-fidl.h>
 #include <lib/driver/component/cpp/driver_base.h>
 #include <lib/inspect/cpp/inspector.h>
+#include <lib/zx/time.h>
 
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <soc/aml-common/aml-cpu-metadata.h>
@@ -97,6 +99,22 @@ class AmlCpu : public fidl::WireServer<fuchsia_hardware_cpu_ctrl::Device> {
   inspect::ComponentInspector& Inspector() { return inspect_; }
 
  private:
+  // Time spent at, and number of switches to, one operating point.
+  struct OperatingPointStats {
+    inspect::Node node;
+    inspect::UintProperty frequency_hz;
+    inspect::UintProperty residency_ns;
+    inspect::UintProperty entries;
+  };
+
+  // Creates the Inspect residency stats for every operating point, starting now at the current
+  // one.
+  void InitOperatingPointStats() __TA_EXCLUDES(lock_);
+
+  // Accounts the time since the last switch to the current operating point and records the switch
+  // to |new_opp|.
+  void RecordOperatingPointSwitch(uint32_t new_opp) __TA_REQUIRES(lock_);
+
   fidl::WireSyncClient<fuchsia_hardware_clock::Clock> plldiv16_;
   fidl::WireSyncClient<fuchsia_hardware_clock::Clock> cpudiv16_;
   fidl::WireSyncClient<fuchsia_hardware_clock::Clock> cpuscaler_;
@@ -116,6 +134,14 @@ class AmlCpu : public fidl::WireServer<fuchsia_hardware_cpu_ctrl::Device> {
   inspect::UintProperty inspect_major_revision_;
   inspect::UintProperty inspect_minor_revision_;
   inspect::UintProperty inspect_package_id_;
+
+  // Operating point residency. The time at the current operating point is only added to its
+  // residency when switching away from it, at which point |transitions| is also incremented.
+  inspect::Node opp_residency_ =
+      inspect_.root().CreateChild(std::string("opp_residency_") + perf_domain_.name);
+  inspect::UintProperty inspect_transitions_;
+  std::vector<OperatingPointStats> opp_stats_ __TA_GUARDED(lock_);
+  zx::time opp_entered_at_ __TA_GUARDED(lock_);
 };
 
 std::vector<operating_point_t> PerformanceDomainOpPoints(const perf_domain_t& perf_domain,
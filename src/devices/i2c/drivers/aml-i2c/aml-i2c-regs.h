@@ -64,8 +64,11 @@ class TokenList : public hwreg::RegisterBase<TokenList, uint64_t> {
     kStop,
   };
 
+  static constexpr uint32_t kTokenSizeBits = 4;
+  static constexpr uint32_t kMaxTokens = std::numeric_limits<uint64_t>::digits / kTokenSizeBits;
+
   void Push(const Token token) {
-    ZX_ASSERT((kTokenSizeBits * token_count_) < std::numeric_limits<uint64_t>::digits);
+    ZX_ASSERT(token_count_ < kMaxTokens);
 
     const uint64_t token_mask = static_cast<uint64_t>(token) << (kTokenSizeBits * token_count_++);
     set_reg_value(reg_value() | token_mask);
@@ -87,8 +90,6 @@ class TokenList : public hwreg::RegisterBase<TokenList, uint64_t> {
   static auto Get() { return hwreg::RegisterAddr<TokenList>(kTokenList0Reg); }
 
  private:
-  static constexpr uint32_t kTokenSizeBits = 4;
-
   uint32_t token_count_ = 0;
 };
 
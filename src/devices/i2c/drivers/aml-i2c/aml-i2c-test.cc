@@ -725,6 +725,47 @@ TEST_F(AmlI2cTest, ManyTransactions) {
   });
 }
 
+TEST_F(AmlI2cTest, CombinedWriteRead) {
+  InitDriver();
+
+  const std::vector<uint8_t> kExpectedReadData{0x5a, 0xc3};
+  controller().SetReadData({kExpectedReadData.data(), kExpectedReadData.size()});
+
+  const std::vector<uint8_t> kWriteData{0x7e};
+  fidl::VectorView<uint8_t> write_buffer{arena_, kWriteData};
+
+  std::vector<fuchsia_hardware_i2cimpl::wire::I2cImplOp> ops = {
+      {0x26,
+       fuchsia_hardware_i2cimpl::wire::I2cImplOpType::WithWriteData(
+           fidl::ObjectView<fidl::VectorView<uint8_t>>::FromExternal(&write_buffer)),
+       false},
+      {0x26, fuchsia_hardware_i2cimpl::wire::I2cImplOpType::WithReadSize(kExpectedReadData.size()),
+       true},
+  };
+
+  i2c_.buffer(arena_)->Transact({arena_, ops}).Then([&](auto& transact_result) {
+    ASSERT_EQ(ZX_OK, transact_result.status());
+    ASSERT_FALSE(transact_result->is_error());
+    const auto& read = transact_result->value()->read;
+    ASSERT_EQ(read.count(), 1);
+    EXPECT_THAT(kExpectedReadData, ::testing::ElementsAreArray(read[0].data));
+    runtime().Quit();
+  });
+  runtime().Run();
+
+  // The write and the read should have been issued as a single token list, with a repeated start
+  // and no end token in between.
+  const std::vector transfers = controller().GetTransfers();
+  ASSERT_EQ(transfers.size(), 2);
+
+  EXPECT_EQ(transfers[0].target_addr, 0x26);
+  EXPECT_EQ(transfers[0].write_data, kWriteData);
+  transfers[0].ExpectTokenListEq({kStart, kTargetAddrWr, kData});
+
+  EXPECT_EQ(transfers[1].target_addr, 0x26);
+  transfers[1].ExpectTokenListEq({kStart, kTargetAddrRd, kData, kDataLast, kStop, kEnd});
+}
+
 TEST_F(AmlI2cTest, WriteTransactionTooBig) {
   InitDriver();
 
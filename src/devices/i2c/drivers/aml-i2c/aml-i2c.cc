@@ -262,6 +262,73 @@ zx_status_t AmlI2c::Read(cpp20::span<uint8_t> dst, const bool stop) const {
   return ZX_OK;
 }
 
+bool AmlI2c::CanCombineWriteRead(const fuchsia_hardware_i2cimpl::wire::I2cImplOp& write,
+                                 const fuchsia_hardware_i2cimpl::wire::I2cImplOp& read) {
+  if (!write.type.is_write_data() || write.stop || !read.type.is_read_size() ||
+      write.address != read.address) {
+    return false;
+  }
+  const size_t write_size = write.type.write_data().count();
+  const size_t read_size = read.type.read_size();
+  if (write_size == 0 || write_size > WriteData::kMaxWriteBytesPerTransfer || read_size == 0 ||
+      read_size > ReadData::kMaxReadBytesPerTransfer) {
+    return false;
+  }
+  // Start and address tokens for each half, the data tokens, and an optional stop, leaving room
+  // for the end token.
+  const size_t token_count = 4 + write_size + read_size + (read.stop ? 1 : 0);
+  return token_count < TokenList::kMaxTokens;
+}
+
+zx_status_t AmlI2c::WriteRead(cpp20::span<uint8_t> src, cpp20::span<uint8_t> dst,
+                              const bool stop) const {
+  TRACE_DURATION("i2c", "aml-i2c WriteRead");
+  ZX_DEBUG_ASSERT(!src.empty() && src.size() <= WriteData::kMaxWriteBytesPerTransfer);
+  ZX_DEBUG_ASSERT(!dst.empty() && dst.size() <= ReadData::kMaxReadBytesPerTransfer);
+
+  // The common register read pattern (write the register address, then read its value) is issued
+  // as one token list with a repeated start, rather than as one transfer and interrupt for each
+  // half.
+  TokenList tokens = TokenList::Get().FromValue(0);
+  tokens.Push(TokenList::Token::kStart);
+  tokens.Push(TokenList::Token::kTargetAddrWr);
+  WriteData wdata = WriteData::Get().FromValue(0);
+  for (uint8_t byte : src) {
+    tokens.Push(TokenList::Token::kData);
+    wdata.Push(byte);
+  }
+
+  tokens.Push(TokenList::Token::kStart);
+  tokens.Push(TokenList::Token::kTargetAddrRd);
+  for (size_t i = 0; i < dst.size() - 1; i++) {
+    tokens.Push(TokenList::Token::kData);
+  }
+  tokens.Push(TokenList::Token::kDataLast);
+  if (stop) {
+    tokens.Push(TokenList::Token::kStop);
+  }
+
+  tokens.WriteTo(&regs_iobuff());
+  wdata.WriteTo(&regs_iobuff());
+
+  // clear registers to prevent data leaking from last xfer
+  ReadData rdata = ReadData::Get().FromValue(0).WriteTo(&regs_iobuff());
+
+  StartXfer();
+
+  zx_status_t status = WaitTransferComplete();
+  if (status != ZX_OK) {
+    return status;
+  }
+
+  rdata.ReadFrom(&regs_iobuff());
+  for (uint8_t& byte : dst) {
+    byte = rdata.Pop();
+  }
+
+  return ZX_OK;
+}
+
 zx_status_t AmlI2c::StartIrqThread() {
   const char* kRoleName = "fuchsia.devices.i2c.drivers.aml-i2c.interrupt";
   zx::result dispatcher = fdf::SynchronizedDispatcher::Create(
@@ -315,11 +382,17 @@ void AmlI2c::Transact(TransactRequestView request, fdf::Arena& arena,
   }
 
   std::vector<fuchsia_hardware_i2cimpl::wire::ReadData> reads;
-  for (const auto& op : request->op) {
+  for (size_t i = 0; i < request->op.count(); i++) {
+    const auto& op = request->op[i];
     SetTargetAddr(op.address);
 
     zx_status_t status;
-    if (op.type.is_read_size()) {
+    if (i + 1 < request->op.count() && CanCombineWriteRead(op, request->op[i + 1])) {
+      const auto& read_op = request->op[++i];
+      auto dst = fidl::VectorView<uint8_t>{arena, read_op.type.read_size()};
+      status = WriteRead(op.type.write_data().get(), dst.get(), read_op.stop);
+      reads.push_back({dst});
+    } else if (op.type.is_read_size()) {
       if (op.type.read_size() > 0) {
         auto dst = fidl::VectorView<uint8_t>{arena, op.type.read_size()};
         status = Read(dst.get(), op.stop);
@@ -53,6 +53,12 @@ class AmlI2c : public fdf::DriverBase, public fdf::WireServer<fuchsia_hardware_i
   zx_status_t Read(cpp20::span<uint8_t> dst, bool stop) const;
   zx_status_t Write(cpp20::span<uint8_t> src, bool stop) const;
 
+  // Writes |src| and then, after a repeated start, reads into |dst| as a single hardware transfer.
+  // Both must fit in the controller's data registers; see CanCombineWriteRead().
+  zx_status_t WriteRead(cpp20::span<uint8_t> src, cpp20::span<uint8_t> dst, bool stop) const;
+  static bool CanCombineWriteRead(const fuchsia_hardware_i2cimpl::wire::I2cImplOp& write,
+                                  const fuchsia_hardware_i2cimpl::wire::I2cImplOp& read);
+
   zx_status_t StartIrqThread();
   void HandleIrq(async_dispatcher_t* dispatcher, async::IrqBase* irq, zx_status_t status,
                  const zx_packet_interrupt_t* interrupt);
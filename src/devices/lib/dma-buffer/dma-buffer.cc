@@ -131,4 +131,46 @@ std::unique_ptr<BufferFactory> CreateBufferFactory() {
   return std::make_unique<BufferFactoryImpl>();
 }
 
+zx_status_t ContiguousBufferPool::Acquire(size_t size, std::unique_ptr<ContiguousBuffer>* out) {
+  if (size == 0 || size > (SIZE_MAX >> 1) + 1) {
+    return ZX_ERR_INVALID_ARGS;
+  }
+  size_t class_size = zx_system_get_page_size();
+  while (class_size < size) {
+    class_size <<= 1;
+  }
+  FreeList& free_list = free_lists_[__builtin_ctzl(class_size)];
+  if (!free_list.is_empty()) {
+    *out = free_list.pop_front();
+    return ZX_OK;
+  }
+  return factory_.CreateContiguous(*bti_, class_size, alignment_log2_, out);
+}
+
+void ContiguousBufferPool::Release(std::unique_ptr<ContiguousBuffer> buffer) {
+  const size_t size = buffer->size();
+  // Only buffers of an exact size class can have come from `Acquire`.
+  if (size < zx_system_get_page_size() || (size & (size - 1)) != 0) {
+    return;
+  }
+  FreeList& free_list = free_lists_[__builtin_ctzl(size)];
+  if (free_list.size() < max_cached_per_class_) {
+    free_list.push_front(std::move(buffer));
+  }
+}
+
+void ContiguousBufferPool::Trim() {
+  for (FreeList& free_list : free_lists_) {
+    free_list.clear();
+  }
+}
+
+size_t ContiguousBufferPool::cached_count() const {
+  size_t count = 0;
+  for (const FreeList& free_list : free_lists_) {
+    count += free_list.size();
+  }
+  return count;
+}
+
 }  // namespace dma_buffer
@@ -10,6 +10,7 @@
 #include <lib/zx/vmo.h>
 #include <zircon/process.h>
 
+#include <array>
 #include <optional>
 #include <vector>
 
@@ -57,6 +58,55 @@ class BufferFactory {
 
 std::unique_ptr<BufferFactory> CreateBufferFactory();
 
+// Pool of contiguous buffers created by a `BufferFactory`, for drivers that allocate and free DMA
+// buffers on a hot path. Creating a contiguous buffer allocates, maps and pins a VMO; the pool
+// instead keeps released buffers pinned and hands them out again.
+//
+// Requested sizes are rounded up to a power-of-two size class of at least a page, so a buffer
+// from `Acquire` may be larger than requested. Up to `max_cached_per_class` released buffers are
+// kept per size class, and the rest are destroyed. Cached buffers stay pinned until `Trim` is
+// called or the pool is destroyed.
+//
+// This class is not thread-safe.
+class ContiguousBufferPool {
+ public:
+  // `factory` and `bti` must outlive the pool. `alignment_log2` is passed to
+  // `BufferFactory::CreateContiguous` for every buffer.
+  ContiguousBufferPool(const BufferFactory& factory, zx::unowned_bti bti, uint32_t alignment_log2,
+                       size_t max_cached_per_class)
+      : factory_(factory),
+        bti_(std::move(bti)),
+        alignment_log2_(alignment_log2),
+        max_cached_per_class_(max_cached_per_class) {}
+
+  // Returns a cached buffer of `size`'s size class, or creates one if there is none.
+  //
+  // Returns `ZX_ERR_INVALID_ARGS` if `size` is zero or too large to round up.
+  // For other possible errors, see `BufferFactory::CreateContiguous`.
+  zx_status_t Acquire(size_t size, std::unique_ptr<ContiguousBuffer>* out);
+
+  // Returns `buffer` to the pool. Buffers that did not come from `Acquire` are destroyed.
+  void Release(std::unique_ptr<ContiguousBuffer> buffer);
+
+  // Destroys all cached buffers.
+  void Trim();
+
+  // The number of buffers currently cached across all size classes.
+  size_t cached_count() const;
+
+ private:
+  using FreeList = fbl::SizedDoublyLinkedList<std::unique_ptr<ContiguousBuffer>>;
+
+  // Size classes are indexed by the log2 of their size.
+  static constexpr size_t kSizeClassCount = sizeof(size_t) * 8;
+
+  const BufferFactory& factory_;
+  zx::unowned_bti bti_;
+  const uint32_t alignment_log2_;
+  const size_t max_cached_per_class_;
+  std::array<FreeList, kSizeClassCount> free_lists_;
+};
+
 }  // namespace dma_buffer
 
 #endif  // SRC_DEVICES_LIB_DMA_BUFFER_INCLUDE_LIB_DMA_BUFFER_BUFFER_H_
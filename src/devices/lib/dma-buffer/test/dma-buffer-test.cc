@@ -218,4 +218,40 @@ TEST(DmaBufferTests, InitCachedMultiPageBuffer) {
   ASSERT_TRUE(unpinned);
 }
 
+TEST(DmaBufferTests, ContiguousBufferPool) {
+  auto factory = CreateBufferFactory();
+  ContiguousBufferPool pool(*factory, kFakeBti.borrow(), 0, 1);
+  const size_t page_size = zx_system_get_page_size();
+
+  // Sizes are rounded up to a power-of-two number of bytes of at least a page.
+  std::unique_ptr<ContiguousBuffer> small;
+  ASSERT_OK(pool.Acquire(100, &small));
+  EXPECT_EQ(small->size(), page_size);
+  std::unique_ptr<ContiguousBuffer> large;
+  ASSERT_OK(pool.Acquire(page_size * 3, &large));
+  EXPECT_EQ(large->size(), page_size * 4);
+
+  // A released buffer is handed out again for any size in its class.
+  ContiguousBuffer* small_ptr = small.get();
+  pool.Release(std::move(small));
+  EXPECT_EQ(pool.cached_count(), 1u);
+  ASSERT_OK(pool.Acquire(page_size, &small));
+  EXPECT_EQ(small.get(), small_ptr);
+  EXPECT_EQ(pool.cached_count(), 0u);
+
+  // Only one buffer is cached per class.
+  std::unique_ptr<ContiguousBuffer> other;
+  ASSERT_OK(pool.Acquire(page_size, &other));
+  EXPECT_NE(other.get(), small_ptr);
+  pool.Release(std::move(small));
+  pool.Release(std::move(other));
+  pool.Release(std::move(large));
+  EXPECT_EQ(pool.cached_count(), 2u);
+
+  pool.Trim();
+  EXPECT_EQ(pool.cached_count(), 0u);
+
+  EXPECT_STATUS(pool.Acquire(0, &small), ZX_ERR_INVALID_ARGS);
+}
+
 }  // namespace dma_buffer
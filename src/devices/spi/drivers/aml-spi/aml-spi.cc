@@ -665,6 +665,20 @@ void AmlSpi::ExchangeVmo(fuchsia_hardware_spiimpl::wire::SpiImplExchangeVmoReque
 }
 
 zx_status_t AmlSpi::ExchangeDma(const uint8_t* txdata, uint8_t* out_rxdata, uint64_t size) {
+  const size_t chunk_size = DmaChunkSize();
+  for (uint64_t offset = 0; offset < size; offset += chunk_size) {
+    const size_t transfer_size = std::min<uint64_t>(size - offset, chunk_size);
+    zx_status_t status =
+        ExchangeDmaChunk(txdata ? txdata + offset : nullptr,
+                         out_rxdata ? out_rxdata + offset : nullptr, transfer_size);
+    if (status != ZX_OK) {
+      return status;
+    }
+  }
+  return ZX_OK;
+}
+
+zx_status_t AmlSpi::ExchangeDmaChunk(const uint8_t* txdata, uint8_t* out_rxdata, uint64_t size) {
   constexpr size_t kBytesPerWord = sizeof(uint64_t);
 
   if (txdata) {
@@ -787,11 +801,15 @@ size_t AmlSpi::DoDmaTransfer(size_t words_remaining) {
   return request_size * request_count;
 }
 
+size_t AmlSpi::DmaChunkSize() const {
+  const size_t buffer_size = std::min(tx_buffer_.mapped.size(), rx_buffer_.mapped.size());
+  return buffer_size - (buffer_size % sizeof(uint64_t));
+}
+
 bool AmlSpi::UseDma(size_t size) const {
-  // TODO(https://fxbug.dev/42051588): Support DMA transfers greater than the pre-allocated buffer
-  // size.
-  return size % sizeof(uint64_t) == 0 && size <= tx_buffer_.mapped.size() &&
-         size <= rx_buffer_.mapped.size();
+  // Transfers larger than the DMA buffers are split into chunks by ExchangeDma(), which is still
+  // far cheaper than moving every word through the FIFO by PIO.
+  return size % sizeof(uint64_t) == 0 && (size == 0 || DmaChunkSize() > 0);
 }
 
 fbl::Array<AmlSpi::ChipInfo> AmlSpiDriver::InitChips(const amlogic_spi::amlspi_config_t& config) {
@@ -200,7 +200,11 @@ class AmlSpi : public fdf::WireServer<fuchsia_hardware_spiimpl::SpiImpl> {
   void WaitForTransferComplete();
   void WaitForDmaTransferComplete();
 
+  // Splits transfers larger than the DMA buffers into buffer-sized chunks, with chip select held
+  // asserted throughout.
   zx_status_t ExchangeDma(const uint8_t* txdata, uint8_t* out_rxdata, uint64_t size);
+  zx_status_t ExchangeDmaChunk(const uint8_t* txdata, uint8_t* out_rxdata, uint64_t size);
+  size_t DmaChunkSize() const;
 
   size_t DoDmaTransfer(size_t words_remaining);
 
@@ -25,6 +25,7 @@ class AmlSpiBtiPaddrEnvironment : public BaseTestEnvironment {
   }
 
   zx::unowned_bti& GetBtiLocal() { return bti_local_; }
+  zx::interrupt& interrupt() { return interrupt_; }
 
  private:
   zx::unowned_bti bti_local_;
@@ -179,6 +180,74 @@ class AmlSpiBtiEmptyTest : public ::testing::Test {
   fdf_testing::ForegroundDriverTest<AmlSpiBtiEmptyFixtureConfig> driver_test_;
 };
 
+TEST_F(AmlSpiBtiPaddrTest, TransmitDmaLargerThanBuffer) {
+  auto spiimpl_client = driver_test().Connect<fuchsia_hardware_spiimpl::Service::Device>();
+  ASSERT_TRUE(spiimpl_client.is_ok());
+
+  fdf::WireClient<fuchsia_hardware_spiimpl::SpiImpl> spiimpl(*std::move(spiimpl_client),
+                                                             fdf::Dispatcher::GetCurrent()->get());
+
+  fake_bti_pinned_vmo_info_t dma_vmos[2] = {};
+  size_t actual_vmos = 0;
+  zx::interrupt interrupt;
+  driver_test().RunInEnvironmentTypeContext(
+      [&dma_vmos, &actual_vmos, &interrupt](AmlSpiBtiPaddrEnvironment& env) {
+        EXPECT_OK(fake_bti_get_pinned_vmos(env.GetBtiLocal()->get(), dma_vmos, std::size(dma_vmos),
+                                           &actual_vmos));
+        EXPECT_EQ(actual_vmos, std::size(dma_vmos));
+        EXPECT_OK(env.interrupt().duplicate(ZX_RIGHT_SAME_RIGHTS, &interrupt));
+      });
+
+  zx::vmo tx_dma_vmo(dma_vmos[0].vmo);
+  uint64_t dma_buffer_size = 0;
+  ASSERT_OK(tx_dma_vmo.get_size(&dma_buffer_size));
+
+  // One full buffer followed by two more words.
+  constexpr size_t kTailSize = 2 * sizeof(uint64_t);
+  std::vector<uint8_t> tx_data(dma_buffer_size + kTailSize);
+  for (size_t i = 0; i < tx_data.size(); i++) {
+    tx_data[i] = static_cast<uint8_t>(i * 7);
+  }
+
+  // Each chunk is a separate DMA run that waits for its own interrupt.
+  size_t dma_runs = 0;
+  driver_test().driver()->mmio()[AML_SPI_DRADDR].SetWriteCallback(
+      [&dma_runs, &interrupt](uint64_t value) {
+        EXPECT_EQ(value, AmlSpiBtiPaddrEnvironment::kDmaPaddrs[0]);
+        dma_runs++;
+        interrupt.trigger(0, zx::clock::get_boot());
+      });
+
+  fdf::Arena arena('TEST');
+  spiimpl.buffer(arena)
+      ->TransmitVector(0, fidl::VectorView<uint8_t>::FromExternal(tx_data))
+      .Then([&](auto& result) {
+        ASSERT_TRUE(result.ok());
+        EXPECT_TRUE(result->is_ok());
+        driver_test().runtime().Quit();
+      });
+  driver_test().runtime().Run();
+
+  EXPECT_EQ(dma_runs, 2u);
+
+  // The TX VMO should hold the last chunk, with the endianness of each word reversed.
+  uint8_t reversed_tail[kTailSize];
+  for (size_t i = 0; i < kTailSize; i += sizeof(uint64_t)) {
+    uint64_t tmp;
+    memcpy(&tmp, tx_data.data() + dma_buffer_size + i, sizeof(tmp));
+    tmp = htobe64(tmp);
+    memcpy(reversed_tail + i, &tmp, sizeof(tmp));
+  }
+  uint8_t buf[kTailSize] = {};
+  EXPECT_OK(tx_dma_vmo.read(buf, 0, sizeof(buf)));
+  EXPECT_TRUE(IsBytesEqual(reversed_tail, buf, sizeof(buf)));
+
+  driver_test().RunInEnvironmentTypeContext([](BaseTestEnvironment& env) {
+    EXPECT_FALSE(env.ControllerReset());
+    EXPECT_EQ(env.cs_toggle_count(), 2u);
+  });
+}
+
 TEST_F(AmlSpiBtiEmptyTest, ExchangeFallBackToPio) {
   constexpr uint8_t kTxData[15] = {
       0x3c, 0xa7, 0x5f, 0xc8, 0x4b, 0x0b, 0xdf, 0xef, 0xb9, 0xa0, 0xcb, 0xbd, 0xd4, 0xcf, 0xa8,
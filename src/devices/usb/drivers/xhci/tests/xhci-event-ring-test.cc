@@ -56,6 +56,7 @@ class EventRingHarness : public ::testing::Test {
       ERDP reg;
       reg.set_reg_value(value);
       erdp_ = reg.Pointer();
+      erdp_writes_++;
     });
 
     // Port/per-slot registers
@@ -128,6 +129,8 @@ class EventRingHarness : public ::testing::Test {
 
   TRB* trb() { return ddk_fake::PhysToVirt<TRB*>(erdp_); }
 
+  size_t erdp_writes() const { return erdp_writes_; }
+
   using TestRequest = usb::CallbackRequest<sizeof(max_align_t)>;
   template <typename Callback>
   zx_status_t AllocateRequest(std::optional<TestRequest>* request, uint32_t device_id,
@@ -232,6 +235,7 @@ class EventRingHarness : public ::testing::Test {
   CommandRing command_ring_;
   uint64_t dcbaa_[128];
   uint64_t erdp_;
+  size_t erdp_writes_ = 0;
   std::optional<ddk_fake::FakeMmioRegRegion> region_;
 };
 
@@ -392,6 +396,22 @@ TEST_F(EventRingHarness, ShortTransferTest) {
   ASSERT_EQ(trb_list[1], reinterpret_cast<TRB*>(kFakeTrbVirt));
 }
 
+TEST_F(EventRingHarness, BatchesErdpUpdates) {
+  TRB trb;
+  trb.ptr = 0;
+  Control::FromTRB(&trb).set_Type(Control::HostControllerEvent).ToTrb(&trb);
+  constexpr size_t kEventCount = 10;
+  for (size_t i = 0; i < kEventCount; i++) {
+    AddTRB(trb);
+  }
+  TRB* end = this->trb();
+  size_t writes = erdp_writes();
+  Interrupt();
+  // All of the events are relinquished to the controller with a single ERDP update.
+  EXPECT_EQ(erdp_writes() - writes, 1u);
+  EXPECT_EQ(this->trb(), end);
+}
+
 TEST_F(EventRingHarness, NormalStall) {
   InitSlot(1);
   TRB* start = trb();
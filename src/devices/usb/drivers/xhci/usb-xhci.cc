@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <fbl/alloc_checker.h>
@@ -98,15 +99,16 @@ void UsbXhci::RingDoorbell(uint8_t slot, uint8_t target) {
 }
 
 uint16_t UsbXhci::InterrupterMapping() {
-  // No inactive interrupters. Find one with least pressure.
-  uint16_t idx = 0;
-  size_t min_pressure = interrupter(0).ring().GetPressure();
+  // Find the active secondary interrupter with the least pressure. The primary interrupter also
+  // services the command ring and port status changes, so it is only used when there is no other.
+  uint16_t idx = kPrimaryInterrupter;
+  std::optional<size_t> min_pressure;
   for (uint16_t i = 0; i < interrupters_.size(); i++) {
-    if (!interrupter(i).active()) {
+    if (i == kPrimaryInterrupter || !interrupter(i).active()) {
       continue;
     }
     size_t pressure = interrupter(i).ring().GetPressure();
-    if (min_pressure < pressure) {
+    if (!min_pressure.has_value() || pressure < *min_pressure) {
       idx = i;
       min_pressure = pressure;
     }
@@ -735,8 +737,11 @@ fpromise::promise<void, zx_status_t> UsbXhci::UsbHciEnableEndpoint(
     // Allocate the transfer ring (see section 4.9)
     control[0] = 0;
     control[1] = 1 | (1 << (index + 1));
+    // Endpoints are mapped to interrupters individually, so that the completions of busy bulk
+    // and isochronous endpoints of a device are spread across interrupters (and their dispatchers)
+    // rather than all being funneled through the one its slot was assigned.
     zx_status_t status = state->InitEndpoint(
-        ep_desc->b_endpoint_address, &this->interrupter(state->GetInterrupterTarget()).ring(),
+        ep_desc->b_endpoint_address, &this->interrupter(InterrupterMapping()).ring(),
         &mmio_.value());
     if (status != ZX_OK) {
       return fpromise::make_error_promise<zx_status_t>(status);
@@ -311,8 +311,8 @@ class UsbXhci : public fdf::DriverBase,
   fpromise::promise<void, zx_status_t> UsbHciHubDeviceAddedAsync(uint32_t device_id, uint32_t port,
                                                                  usb_speed_t speed);
 
-  // InterrupterMapping: finds an interrupter. Currently finds the interrupter with the least
-  // pressure.
+  // InterrupterMapping: finds an interrupter for a new device slot or endpoint. Currently finds the
+  // secondary interrupter with the least pressure, falling back to the primary interrupter.
   uint16_t InterrupterMapping();
 
   const xhci_config::Config config_ = {};
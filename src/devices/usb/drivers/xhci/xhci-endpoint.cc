@@ -30,6 +30,7 @@ inline usb_setup_t ToBanjo(fuchsia_hardware_usb_descriptor::UsbSetup setup) {
 }  // namespace
 
 zx_status_t Endpoint::Init(EventRing* event_ring, fdf::MmioBuffer* mmio) {
+  interrupter_target_ = event_ring ? event_ring->interrupter() : kPrimaryInterrupter;
   return transfer_ring_.Init(hci_->GetPageSize(), hci_->bti(), event_ring,
                              hci_->Is32BitController(), mmio, hci_);
 }
@@ -402,9 +403,8 @@ void Endpoint::NormalRequestQueue(usb_endpoint::RequestVariant request) {
   auto rollback_transaction = [&]() __TA_NO_THREAD_SAFETY_ANALYSIS {
     transfer_ring_.Restore(pending_transfer.transaction);
   };
-  auto status = StartNormalTransaction(
-      &pending_transfer,
-      static_cast<uint8_t>(hci_->GetDeviceState()[device_id_]->GetInterrupterTarget()));
+  auto status =
+      StartNormalTransaction(&pending_transfer, static_cast<uint8_t>(interrupter_target_));
   if (status != ZX_OK) {
     rollback_transaction();
     transaction_lock.release();
@@ -127,6 +127,9 @@ class Endpoint : public usb_endpoint::UsbEndpoint {
   async::Loop loop_{&kAsyncLoopConfigNeverAttachToThread};
   UsbXhci* hci_;
   uint32_t device_id_;
+  // The interrupter targeted by normal transfers. This is the interrupter owning the event ring
+  // which the transfer ring was initialized with.
+  uint16_t interrupter_target_ = kPrimaryInterrupter;
   TransferRing transfer_ring_;
 };
 
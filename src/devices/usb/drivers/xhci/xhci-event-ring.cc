@@ -637,7 +637,7 @@ zx_status_t EventRing::HandleIRQ() {
       AdvanceErdp();
       control = CurrentErdp();
 
-      if (processed_trbs % kUpdateERDPAfterTRBs) {
+      if (processed_trbs % kUpdateERDPAfterTRBs == 0) {
         last_phys = UpdateErdpReg(last_phys, processed_trbs / kUpdateERDPAfterTRBs + 1);
       }
     }
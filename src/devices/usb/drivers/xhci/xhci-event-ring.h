@@ -104,6 +104,8 @@ class EventRing {
     return AddSegmentIfNone();
   }
   zx_paddr_t erdp_phys() { return erdp_phys_; }
+  // Index of the interrupter that owns this event ring.
+  uint16_t interrupter() const { return interrupter_; }
   TRB* erdp_virt() { return erdp_virt_; }
   zx_status_t HandleIRQ();
   zx_status_t Ring0Bringup();
@@ -216,7 +218,7 @@ class EventRing {
   // When xHCI shuts down, this pointer will be invalid.
   uint64_t* dcbaa_;
 
-  uint16_t interrupter_;
+  uint16_t interrupter_ = kPrimaryInterrupter;
   bool reevaluate_ = false;
   bool resynchronize_ = false;
 
@@ -539,9 +539,10 @@ void Client::SetLayerPrimaryPosition(SetLayerPrimaryPositionRequestView request,
     TearDown();
     return;
   }
-  layer->SetPrimaryPosition(request->image_source_transformation, request->image_source,
-                            request->display_destination);
-  pending_config_valid_ = false;
+  if (layer->SetPrimaryPosition(request->image_source_transformation, request->image_source,
+                                request->display_destination)) {
+    pending_config_valid_ = false;
+  }
   // no Reply defined
 }
 
@@ -565,8 +566,9 @@ void Client::SetLayerPrimaryAlpha(SetLayerPrimaryAlphaRequestView request,
     TearDown();
     return;
   }
-  layer->SetPrimaryAlpha(request->mode, request->val);
-  pending_config_valid_ = false;
+  if (layer->SetPrimaryAlpha(request->mode, request->val)) {
+    pending_config_valid_ = false;
+  }
   // no Reply defined
 }
 
@@ -592,8 +594,9 @@ void Client::SetLayerColorConfig(SetLayerColorConfigRequestView request,
     return;
   }
 
-  layer->SetColorConfig(request->color);
-  pending_config_valid_ = false;
+  if (layer->SetColorConfig(request->color)) {
+    pending_config_valid_ = false;
+  }
   // no Reply defined
 }
 
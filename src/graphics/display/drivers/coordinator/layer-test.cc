@@ -5,6 +5,7 @@
 #include "src/graphics/display/drivers/coordinator/layer.h"
 
 #include <fidl/fuchsia.hardware.display.types/cpp/wire.h>
+#include <fidl/fuchsia.images2/cpp/wire.h>
 #include <fidl/fuchsia.math/cpp/wire.h>
 #include <lib/async-loop/cpp/loop.h>
 #include <lib/driver/testing/cpp/driver_runtime.h>
@@ -80,6 +81,36 @@ TEST_F(LayerTest, PrimaryBasic) {
   layer.ApplyChanges({.h_addressable = kDisplayWidth, .v_addressable = kDisplayHeight});
 }
 
+TEST_F(LayerTest, RestatingPropertiesIsNotAChange) {
+  Layer layer(DriverLayerId(1));
+  fhdt::wire::ImageMetadata image_metadata = {.width = kDisplayWidth,
+                                              .height = kDisplayHeight,
+                                              .tiling_type = fhdt::wire::kImageTilingTypeLinear};
+  fuchsia_math::wire::RectU display_area = {.width = kDisplayWidth, .height = kDisplayHeight};
+  fuchsia_math::wire::RectU half_area = {.width = kDisplayWidth / 2, .height = kDisplayHeight};
+  layer.SetPrimaryConfig(image_metadata);
+
+  EXPECT_TRUE(layer.SetPrimaryPosition(fhdt::wire::CoordinateTransformation::kIdentity,
+                                       display_area, display_area));
+  EXPECT_FALSE(layer.SetPrimaryPosition(fhdt::wire::CoordinateTransformation::kIdentity,
+                                        display_area, display_area));
+  EXPECT_TRUE(layer.SetPrimaryPosition(fhdt::wire::CoordinateTransformation::kIdentity,
+                                       display_area, half_area));
+  EXPECT_TRUE(layer.SetPrimaryPosition(fhdt::wire::CoordinateTransformation::kRotateCcw180,
+                                       display_area, half_area));
+
+  EXPECT_TRUE(layer.SetPrimaryAlpha(fhdt::wire::AlphaMode::kPremultiplied, 0.5f));
+  EXPECT_FALSE(layer.SetPrimaryAlpha(fhdt::wire::AlphaMode::kPremultiplied, 0.5f));
+  EXPECT_TRUE(layer.SetPrimaryAlpha(fhdt::wire::AlphaMode::kPremultiplied, 1.0f));
+
+  fhdt::wire::Color color = {.format = fuchsia_images2::wire::PixelFormat::kB8G8R8A8};
+  color.bytes[0] = 1;
+  EXPECT_TRUE(layer.SetColorConfig(color));
+  EXPECT_FALSE(layer.SetColorConfig(color));
+  color.bytes[0] = 2;
+  EXPECT_TRUE(layer.SetColorConfig(color));
+}
+
 TEST_F(LayerTest, CleanUpImage) {
   Layer layer(DriverLayerId(1));
   fhdt::wire::ImageMetadata image_metadata = {.width = kDisplayWidth,
@@ -247,19 +247,29 @@ void Layer::SetPrimaryConfig(fhdt::wire::ImageMetadata image_metadata) {
   config_change_ = true;
 }
 
-void Layer::SetPrimaryPosition(fhdt::wire::CoordinateTransformation image_source_transformation,
+bool Layer::SetPrimaryPosition(fhdt::wire::CoordinateTransformation image_source_transformation,
                                fuchsia_math::wire::RectU image_source,
                                fuchsia_math::wire::RectU display_destination) {
   primary_layer_t& primary_layer = pending_layer_.cfg.primary;
 
-  primary_layer.image_source = Rectangle::From(image_source).ToBanjo();
-  primary_layer.display_destination = Rectangle::From(display_destination).ToBanjo();
-  primary_layer.image_source_transformation = static_cast<uint8_t>(image_source_transformation);
+  const Rectangle new_image_source = Rectangle::From(image_source);
+  const Rectangle new_display_destination = Rectangle::From(display_destination);
+  const uint8_t new_transformation = static_cast<uint8_t>(image_source_transformation);
+  if (Rectangle::From(primary_layer.image_source) == new_image_source &&
+      Rectangle::From(primary_layer.display_destination) == new_display_destination &&
+      primary_layer.image_source_transformation == new_transformation) {
+    return false;
+  }
+
+  primary_layer.image_source = new_image_source.ToBanjo();
+  primary_layer.display_destination = new_display_destination.ToBanjo();
+  primary_layer.image_source_transformation = new_transformation;
 
   config_change_ = true;
+  return true;
 }
 
-void Layer::SetPrimaryAlpha(fhdt::wire::AlphaMode mode, float val) {
+bool Layer::SetPrimaryAlpha(fhdt::wire::AlphaMode mode, float val) {
   primary_layer_t* primary_layer = &pending_layer_.cfg.primary;
 
   static_assert(static_cast<alpha_t>(fhdt::wire::AlphaMode::kDisable) == ALPHA_DISABLE,
@@ -269,25 +279,40 @@ void Layer::SetPrimaryAlpha(fhdt::wire::AlphaMode mode, float val) {
   static_assert(static_cast<alpha_t>(fhdt::wire::AlphaMode::kHwMultiply) == ALPHA_HW_MULTIPLY,
                 "Bad constant");
 
+  // NaN never compares equal, so a NaN alpha value always counts as a change.
+  if (primary_layer->alpha_mode == static_cast<alpha_t>(mode) &&
+      primary_layer->alpha_layer_val == val) {
+    return false;
+  }
+
   primary_layer->alpha_mode = static_cast<alpha_t>(mode);
   primary_layer->alpha_layer_val = val;
 
   config_change_ = true;
+  return true;
 }
 
-void Layer::SetColorConfig(fuchsia_hardware_display_types::wire::Color color) {
+bool Layer::SetColorConfig(fuchsia_hardware_display_types::wire::Color color) {
   // Increase the size of the static array when large color formats are introduced
   static_assert(color.bytes.size() == sizeof(pending_color_bytes_));
 
-  pending_layer_.type = LAYER_TYPE_COLOR;
   color_layer_t* color_layer = &pending_layer_.cfg.color;
-
   ZX_DEBUG_ASSERT(!color.format.IsUnknown());
-  color_layer->format = static_cast<fuchsia_images2_pixel_format_enum_value_t>(color.format);
+  const auto format = static_cast<fuchsia_images2_pixel_format_enum_value_t>(color.format);
+  if (pending_layer_.type == LAYER_TYPE_COLOR && color_layer->format == format &&
+      std::memcmp(pending_color_bytes_, color.bytes.data(), sizeof(pending_color_bytes_)) == 0) {
+    // Color layers never have a pending image, so there is nothing to reset.
+    ZX_DEBUG_ASSERT(pending_image_ == nullptr);
+    return false;
+  }
+
+  pending_layer_.type = LAYER_TYPE_COLOR;
+  color_layer->format = format;
   std::memcpy(pending_color_bytes_, color.bytes.data(), sizeof(pending_color_bytes_));
 
   pending_image_ = nullptr;
   config_change_ = true;
+  return true;
 }
 
 void Layer::SetImage(fbl::RefPtr<Image> image, EventId wait_event_id, EventId signal_event_id) {
@@ -103,11 +103,16 @@ class Layer : public IdMappable<std::unique_ptr<Layer>, DriverLayerId> {
   bool AppendToConfig(fbl::DoublyLinkedList<LayerNode*>* list);
 
   void SetPrimaryConfig(fuchsia_hardware_display_types::wire::ImageMetadata image_metadata);
-  void SetPrimaryPosition(
+
+  // The setters below return false if the pending configuration already had
+  // the given values. Clients often restate unchanged layer properties every
+  // frame alongside a new image, and such calls must not force the next
+  // ApplyConfig() to re-run the full config check.
+  bool SetPrimaryPosition(
       fuchsia_hardware_display_types::wire::CoordinateTransformation image_source_transformation,
       fuchsia_math::wire::RectU image_source, fuchsia_math::wire::RectU display_destination);
-  void SetPrimaryAlpha(fuchsia_hardware_display_types::wire::AlphaMode mode, float val);
-  void SetColorConfig(fuchsia_hardware_display_types::wire::Color color);
+  bool SetPrimaryAlpha(fuchsia_hardware_display_types::wire::AlphaMode mode, float val);
+  bool SetColorConfig(fuchsia_hardware_display_types::wire::Color color);
   void SetImage(fbl::RefPtr<Image> image_id, EventId wait_event_id, EventId signal_event_id);
 
  private:
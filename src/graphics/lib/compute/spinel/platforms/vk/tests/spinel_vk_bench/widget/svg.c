@@ -9,6 +9,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "common/macros.h"
 #include "spinel/ext/svg2spinel/svg2spinel.h"
@@ -82,6 +83,16 @@ struct impl_input
   bool                    is_control;
 };
 
+//
+// Accumulated host time spent declaring paths or rasters
+//
+
+struct impl_decode_stats
+{
+  uint64_t count;
+  uint64_t nsecs;
+};
+
 //
 //
 //
@@ -95,6 +106,16 @@ struct widget_svg
   spinel_raster_t * rasters;
   bool              is_srgb;
 
+  //
+  // Host-side cost of decoding the svg into path and raster builder calls.
+  // This includes any flushes the builders perform along the way.
+  //
+  struct
+  {
+    struct impl_decode_stats paths;
+    struct impl_decode_stats rasters;
+  } decode;
+
   //
   // FIXME(allanmac): Eventually decide whether or not the svg always
   // (or never) creates its own styling group.
@@ -106,6 +127,42 @@ struct widget_svg
 //
 //
 
+static uint64_t
+impl_timestamp(void)
+{
+  struct timespec ts;
+
+  timespec_get(&ts, TIME_UTC);  // ignore return value
+
+  uint64_t const timestamp = ts.tv_sec * 1000000000UL + ts.tv_nsec;
+
+  return timestamp;
+}
+
+static void
+impl_decode_stats_add(struct impl_decode_stats * stats, uint64_t const t0)
+{
+  stats->count += 1;
+  stats->nsecs += impl_timestamp() - t0;
+}
+
+static void
+impl_decode_stats_print(struct impl_decode_stats const * stats, char const * name)
+{
+  if (stats->count > 0)
+    {
+      fprintf(stderr,
+              "SVG %s decode: %" PRIu64 " regens, %.3f msecs avg\n",
+              name,
+              stats->count,
+              (double)stats->nsecs / (1e+6 * (double)stats->count));
+    }
+}
+
+//
+//
+//
+
 static void
 impl_paths_release(struct widget_svg * impl, struct widget_context * const context)
 {
@@ -137,6 +194,9 @@ impl_destroy(struct widget * widget, struct widget_context * const context)
 {
   widget_svg_t svg = { .widget = widget };
 
+  impl_decode_stats_print(&svg.impl->decode.paths, "paths");
+  impl_decode_stats_print(&svg.impl->decode.rasters, "rasters");
+
   impl_paths_release(svg.impl, context);
 
   impl_rasters_release(svg.impl, context);
@@ -186,7 +246,11 @@ impl_regen(struct widget *                     widget,
       impl_paths_release(svg.impl, context);
 
       // create new
+      uint64_t const t0 = impl_timestamp();
+
       svg.impl->paths = spinel_svg_paths_decode(svg.impl->svg, context->pb);
+
+      impl_decode_stats_add(&svg.impl->decode.paths, t0);
     }
 
   //
@@ -218,10 +282,14 @@ impl_regen(struct widget *                     widget,
       spinel_transform_stack_concat(context->ts);
 
       // define rasters
+      uint64_t const t0 = impl_timestamp();
+
       svg.impl->rasters = spinel_svg_rasters_decode(svg.impl->svg,  //
                                                     context->rb,
                                                     svg.impl->paths,
                                                     context->ts);
+
+      impl_decode_stats_add(&svg.impl->decode.rasters, t0);
       // restore transform stack
       spinel_transform_stack_restore(context->ts, ts_save);
     }
@@ -4,6 +4,7 @@
 
 #include "magma_system_connection.h"
 
+#include <lib/magma/platform/platform_trace.h>
 #include <lib/magma/util/macros.h>
 
 #include <vector>
@@ -11,6 +12,15 @@
 #include "magma_system_device.h"
 
 namespace msd {
+namespace {
+// Identifies a performance counter dump in the trace so that the async slice started by
+// DumpPerformanceCounters is ended by the matching read completion. Trigger ids are chosen by
+// the client, so this is only unique per pool for as long as the client doesn't reuse them.
+uint64_t PerfCounterDumpTraceId(uint64_t pool_id, uint32_t trigger_id) {
+  return (pool_id << 32) ^ trigger_id;
+}
+}  // namespace
+
 MagmaSystemConnection::MagmaSystemConnection(Owner* owner,
                                              std::unique_ptr<msd::Connection> msd_connection_t)
     : owner_(owner), msd_connection_(std::move(msd_connection_t)) {
@@ -238,6 +248,13 @@ void MagmaSystemConnection::ContextKilled() {
 }
 void MagmaSystemConnection::PerformanceCounterReadCompleted(const msd::PerfCounterResult& result) {
   MAGMA_DASSERT(notification_handler_);
+  TRACE_DURATION("magma", "MagmaSystemConnection::PerformanceCounterReadCompleted");
+  // The completion timestamp comes from the GPU, so it's recorded as an argument rather than used
+  // as the end of the slice.
+  TRACE_ASYNC_END("magma", "PerformanceCounterDump",
+                  PerfCounterDumpTraceId(result.pool_id, result.trigger_id), "buffer_id",
+                  result.buffer_id, "buffer_offset", result.buffer_offset, "timestamp",
+                  result.timestamp, "result_flags", result.result_flags);
   std::lock_guard<std::mutex> lock(pool_map_mutex_);
 
   auto pool_it = pool_map_.find(result.pool_id);
@@ -403,7 +420,18 @@ magma::Status MagmaSystemConnection::DumpPerformanceCounters(uint64_t pool_id,
   msd::PerfCountPool* msd_pool = LookupPerfCountPool(pool_id);
   if (!msd_pool)
     return MAGMA_DRET(MAGMA_STATUS_INVALID_ARGS);
-  return msd_connection()->DumpPerformanceCounters(*msd_pool, trigger_id);
+  TRACE_DURATION("magma", "MagmaSystemConnection::DumpPerformanceCounters", "pool_id", pool_id,
+                 "trigger_id", trigger_id);
+  // Begin the slice before handing off to the driver, which may complete the dump before it
+  // returns.
+  TRACE_ASYNC_BEGIN("magma", "PerformanceCounterDump", PerfCounterDumpTraceId(pool_id, trigger_id),
+                    "pool_id", pool_id, "trigger_id", trigger_id);
+  magma::Status status = msd_connection()->DumpPerformanceCounters(*msd_pool, trigger_id);
+  if (!status.ok()) {
+    TRACE_ASYNC_END("magma", "PerformanceCounterDump", PerfCounterDumpTraceId(pool_id, trigger_id),
+                    "status", status.get());
+  }
+  return status;
 }
 
 magma::Status MagmaSystemConnection::ClearPerformanceCounters(const uint64_t* counters,
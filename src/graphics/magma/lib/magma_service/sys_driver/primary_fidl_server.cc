@@ -11,6 +11,7 @@
 #include <lib/magma/util/utils.h>
 #include <zircon/assert.h>
 
+#include <algorithm>
 #include <optional>
 
 #include "fidl/fuchsia.gpu.magma/cpp/wire_types.h"
@@ -267,22 +268,7 @@ void PrimaryFidlServer::ExecuteCommand(ExecuteCommandRequestView request,
   TRACE_DURATION("magma", "PrimaryFidlServer::ExecuteCommand");
   FlowControl();
 
-  // TODO(https://fxbug.dev/42174299) - support > 1 command buffer
-  if (request->command_buffers.count() > 1) {
-    SetError(&completer, MAGMA_STATUS_UNIMPLEMENTED);
-    return;
-  }
-
-  auto command_buffer = std::make_unique<magma_command_buffer>();
-
-  *command_buffer = {
-      .resource_count = static_cast<uint32_t>(request->resources.count()),
-      .batch_buffer_resource_index = request->command_buffers[0].resource_index,
-      .batch_start_offset = request->command_buffers[0].start_offset,
-      .wait_semaphore_count = static_cast<uint32_t>(request->wait_semaphores.count()),
-      .signal_semaphore_count = static_cast<uint32_t>(request->signal_semaphores.count()),
-      .flags = static_cast<uint64_t>(request->flags),
-  };
+  const size_t command_buffer_count = request->command_buffers.count();
 
   std::vector<magma_exec_resource> resources;
   resources.reserve(request->resources.count());
@@ -295,22 +281,55 @@ void PrimaryFidlServer::ExecuteCommand(ExecuteCommandRequestView request,
     });
   }
 
-  // Merge semaphores into one vector
-  std::vector<uint64_t> semaphores;
-  semaphores.reserve(request->wait_semaphores.count() + request->signal_semaphores.count());
-
-  for (uint64_t semaphore_id : request->wait_semaphores) {
-    semaphores.push_back(semaphore_id);
-  }
-  for (uint64_t semaphore_id : request->signal_semaphores) {
-    semaphores.push_back(semaphore_id);
-  }
+  // A batch of command buffers shares one resource list, waits on the wait semaphores before the
+  // first command buffer and signals the signal semaphores after the last. The command buffers are
+  // submitted to the driver in order, so the first carries the waits and the last the signals. As
+  // for a single command buffer, any submission error closes the connection.
+  //
+  // With no command buffers, submit a single one without a batch buffer so that the semaphores are
+  // still waited on and signaled.
+  const size_t submit_count = std::max<size_t>(command_buffer_count, 1);
+  for (size_t i = 0; i < submit_count; i++) {
+    const bool is_first = i == 0;
+    const bool is_last = i == submit_count - 1;
+
+    auto command_buffer = std::make_unique<magma_command_buffer>();
+    *command_buffer = {
+        .resource_count = static_cast<uint32_t>(request->resources.count()),
+        .batch_buffer_resource_index =
+            command_buffer_count ? request->command_buffers[i].resource_index : 0,
+        .batch_start_offset = command_buffer_count ? request->command_buffers[i].start_offset : 0,
+        .wait_semaphore_count =
+            is_first ? static_cast<uint32_t>(request->wait_semaphores.count()) : 0,
+        .signal_semaphore_count =
+            is_last ? static_cast<uint32_t>(request->signal_semaphores.count()) : 0,
+        .flags = static_cast<uint64_t>(request->flags),
+    };
+
+    // Merge semaphores into one vector
+    std::vector<uint64_t> semaphores;
+    semaphores.reserve(command_buffer->wait_semaphore_count +
+                       command_buffer->signal_semaphore_count);
+
+    if (is_first) {
+      for (uint64_t semaphore_id : request->wait_semaphores) {
+        semaphores.push_back(semaphore_id);
+      }
+    }
+    if (is_last) {
+      for (uint64_t semaphore_id : request->signal_semaphores) {
+        semaphores.push_back(semaphore_id);
+      }
+    }
 
-  magma::Status status = delegate_->ExecuteCommandBufferWithResources(
-      request->context_id, std::move(command_buffer), std::move(resources), std::move(semaphores));
+    magma::Status status = delegate_->ExecuteCommandBufferWithResources(
+        request->context_id, std::move(command_buffer), resources, std::move(semaphores));
 
-  if (!status)
-    SetError(&completer, status.get());
+    if (!status) {
+      SetError(&completer, status.get());
+      return;
+    }
+  }
 }
 
 void PrimaryFidlServer::ExecuteImmediateCommands(
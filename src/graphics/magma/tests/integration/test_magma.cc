@@ -1499,7 +1499,8 @@ class TestConnectionWithContext : public TestConnection {
     EXPECT_EQ(MAGMA_STATUS_OK,
               magma_connection_execute_command(connection(), context_id(), &descriptor));
 
-    EXPECT_EQ(magma_connection_flush(connection()), MAGMA_STATUS_UNIMPLEMENTED);
+    // Batches of command buffers are accepted, but these resources don't name imported buffers.
+    EXPECT_EQ(magma_connection_flush(connection()), MAGMA_STATUS_INVALID_ARGS);
   }
 
  private:
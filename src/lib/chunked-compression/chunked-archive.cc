@@ -113,6 +113,8 @@ Status HeaderReader::Parse(const void* void_data, size_t len, size_t file_length
   }
 
   out->entries_ = std::move(table);
+  out->dictionary_id_ =
+      reinterpret_cast<const DictionaryIdType*>(data + kChunkArchiveDictionaryIdOffset)[0];
 
   return kStatusOk;
 }
@@ -326,6 +328,7 @@ Status HeaderWriter::Finalize() {
   memcpy(dst_, kChunkArchiveMagic, kArchiveMagicLength);
   reinterpret_cast<ArchiveVersionType*>(dst_ + kChunkArchiveVersionOffset)[0] = kVersion;
   reinterpret_cast<ChunkCountType*>(dst_ + kChunkArchiveNumChunksOffset)[0] = num_frames_;
+  reinterpret_cast<DictionaryIdType*>(dst_ + kChunkArchiveDictionaryIdOffset)[0] = dictionary_id_;
 
   // Always compute checkum last.
   reinterpret_cast<uint32_t*>(dst_ + kChunkArchiveHeaderCrc32Offset)[0] =
@@ -32,7 +32,7 @@
 //    +-----+-----+-----+-----+-----+-----+-----+-----+
 // 16 |    Header CRC32       |        Reserved       |  // Reserved bytes must be zero.
 //    +-----+-----+-----+-----+-----+-----+-----+-----+
-// 24 |                    Reserved                   |  // Reserved bytes must be zero.
+// 24 |     Dictionary ID     |        Reserved       |  // Reserved bytes must be zero.
 //    +-----+-----+-----+-----+-----+-----+-----+-----+
 // 32 |                                               |
 // 40 |                   Seek Table                  |
@@ -47,6 +47,11 @@
 //
 // The Header CRC32 is computed based on the entire header including each Seek Table Entry.
 //
+// The Dictionary ID is zero if the frames were compressed without a dictionary. Otherwise it is the
+// zstd dictionary ID of the trained dictionary which every frame was compressed with. The
+// dictionary itself is not part of the archive (it is typically shared by every archive in an
+// image), and must be supplied separately to decompress the frames.
+//
 // ### Seek Table
 //
 // Each Seek Table Entry describes a contiguous range of data in the compressed space, and where
@@ -91,6 +96,10 @@ namespace chunked_compression {
 
 using ArchiveVersionType = uint16_t;
 using ChunkCountType = uint32_t;
+using DictionaryIdType = uint32_t;
+
+// The Dictionary ID of archives which were compressed without a dictionary.
+constexpr DictionaryIdType kNoDictionary = 0u;
 
 // The magic number is an arbitrary unique value used to identify files as being of this format.  It
 // can be derived as follows:
@@ -109,6 +118,8 @@ constexpr size_t kChunkArchiveReserved1Offset = 10ul;
 constexpr size_t kChunkArchiveNumChunksOffset = 12ul;
 constexpr size_t kChunkArchiveHeaderCrc32Offset = 16ul;
 constexpr size_t kChunkArchiveReserved2Offset = 20ul;
+constexpr size_t kChunkArchiveDictionaryIdOffset = 24ul;
+constexpr size_t kChunkArchiveReserved3Offset = 28ul;
 constexpr size_t kChunkArchiveSeekTableOffset = 32ul;
 
 // A single entry into the seek table. Describes where an extent of decompressed
@@ -144,8 +155,12 @@ static_assert(kChunkArchiveHeaderCrc32Offset ==
               "Breaking change to archive format");
 static_assert(kChunkArchiveReserved2Offset == kChunkArchiveHeaderCrc32Offset + sizeof(uint32_t),
               "Breaking change to archive format");
-static_assert(kChunkArchiveSeekTableOffset ==
-                  kChunkArchiveReserved2Offset + sizeof(uint32_t) + sizeof(uint64_t),
+static_assert(kChunkArchiveDictionaryIdOffset == kChunkArchiveReserved2Offset + sizeof(uint32_t),
+              "Breaking change to archive format");
+static_assert(kChunkArchiveReserved3Offset ==
+                  kChunkArchiveDictionaryIdOffset + sizeof(DictionaryIdType),
+              "Breaking change to archive format");
+static_assert(kChunkArchiveSeekTableOffset == kChunkArchiveReserved3Offset + sizeof(uint32_t),
               "Breaking change to archive format");
 
 // A parsed view of a chunked archive's seek table.
@@ -161,6 +176,9 @@ class SeekTable {
   // Returns a reference to the seek table of the archive.
   const fbl::Array<SeekTableEntry>& Entries() const { return entries_; }
 
+  // Returns the ID of the dictionary the archive's frames were compressed with, or kNoDictionary.
+  DictionaryIdType DictionaryId() const { return dictionary_id_; }
+
   // Returns the size of the compressed archive.
   // Equal to the end of the greatest frame (i.e. its offset + size).
   size_t CompressedSize() const;
@@ -185,6 +203,7 @@ class SeekTable {
 
  private:
   fbl::Array<SeekTableEntry> entries_;
+  DictionaryIdType dictionary_id_ = kNoDictionary;
 };
 
 // HeaderReader reads chunked archive headers and produces in-memory SeekTable representations.
@@ -250,6 +269,9 @@ class HeaderWriter {
   // full.
   Status AddEntry(const SeekTableEntry& entry);
 
+  // Records that the archive's frames are compressed with the dictionary identified by |id|.
+  void SetDictionaryId(DictionaryIdType id) { dictionary_id_ = id; }
+
   // Finishes writing the header out to the target buffer.
   //
   // Returns an error if the header was not fully initialized (i.e. not every seek table entry
@@ -269,6 +291,7 @@ class HeaderWriter {
   size_t dst_length_;
   size_t current_frame_ = 0;
   ChunkCountType num_frames_;
+  DictionaryIdType dictionary_id_ = kNoDictionary;
 };
 
 }  // namespace chunked_compression
@@ -7,10 +7,13 @@
 
 #include <lib/fit/function.h>
 
+#include <memory>
+
 #include <fbl/array.h>
 #include <fbl/macros.h>
 
 #include "chunked-archive.h"
+#include "compression-dictionary.h"
 #include "compression-params.h"
 #include "status.h"
 #include "streaming-chunked-compressor.h"
@@ -48,6 +51,11 @@ class ChunkedCompressor {
   // Returns the minimum size that a buffer must be to hold the result of compressing |len| bytes.
   size_t ComputeOutputSizeLimit(size_t len) { return inner_.ComputeOutputSizeLimit(len); }
 
+  // See StreamingChunkedCompressor::SetDictionary.
+  void SetDictionary(std::shared_ptr<const CompressionDictionary> dictionary) {
+    inner_.SetDictionary(std::move(dictionary));
+  }
+
   // Reads from |input| and writes the compressed representation to |output|.
   // |output_len| must be at least |ComputeOutputSizeLimit(input_len)| bytes long.
   // Returns the number of compressed bytes written in |bytes_written_out|.
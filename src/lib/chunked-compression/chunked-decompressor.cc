@@ -89,7 +89,10 @@ Status ChunkedDecompressor::DecompressFrame(const void* compressed_buffer,
                                             size_t compressed_buffer_len, void* dst, size_t dst_len,
                                             size_t* bytes_written_out) {
   size_t decompressed_size =
-      ZSTD_decompressDCtx(context_->inner_, dst, dst_len, compressed_buffer, compressed_buffer_len);
+      dictionary_ ? ZSTD_decompress_usingDDict(context_->inner_, dst, dst_len, compressed_buffer,
+                                               compressed_buffer_len, dictionary_->ddict())
+                  : ZSTD_decompressDCtx(context_->inner_, dst, dst_len, compressed_buffer,
+                                        compressed_buffer_len);
   if (ZSTD_isError(decompressed_size)) {
     FX_LOG_KV(ERROR, "Decompression failed", FX_KV("status", decompressed_size),
               FX_KV("status_str", ZSTD_getErrorName(decompressed_size)));
@@ -120,6 +123,13 @@ Status ChunkedDecompressor::DecompressFrame(const SeekTable& table, unsigned tab
   if (compressed_buffer_len < entry.compressed_size || dst_len < entry.decompressed_size) {
     return kStatusErrBufferTooSmall;
   }
+  if (table.DictionaryId() != kNoDictionary &&
+      (!dictionary_ || dictionary_->id() != table.DictionaryId())) {
+    FX_LOG_KV(ERROR, "Archive requires a different dictionary",
+              FX_KV("dictionary_id", table.DictionaryId()),
+              FX_KV("provided", dictionary_ ? dictionary_->id() : kNoDictionary));
+    return kStatusErrBadState;
+  }
 
   return DecompressFrame(compressed_buffer, entry.compressed_size, dst, entry.decompressed_size,
                          bytes_written_out);
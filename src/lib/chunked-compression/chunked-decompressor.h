@@ -11,6 +11,7 @@
 #include <fbl/macros.h>
 
 #include "chunked-archive.h"
+#include "compression-dictionary.h"
 #include "status.h"
 
 namespace chunked_compression {
@@ -55,6 +56,13 @@ class ChunkedDecompressor {
   static Status DecompressBytes(const void* input, size_t len, fbl::Array<uint8_t>* output,
                                 size_t* bytes_written_out);
 
+  // Decompresses frames with |dictionary|, which is required for archives whose header refers to
+  // it. The same dictionary can be shared by any number of decompressors. Passing nullptr goes back
+  // to decompressing without a dictionary.
+  void SetDictionary(std::shared_ptr<const DecompressionDictionary> dictionary) {
+    dictionary_ = std::move(dictionary);
+  }
+
   // Returns the minimum size that a buffer must be to hold the result of decompressing the archive
   // described by |table|.
   static size_t ComputeOutputSize(const SeekTable& table) { return table.DecompressedSize(); }
@@ -75,6 +83,8 @@ class ChunkedDecompressor {
   // |output| starts at the first byte to write the result, and |output_len| must be the resulting
   // decompressed size.
   //
+  // The frame is decompressed with the dictionary set by SetDictionary(), if any.
+  //
   // Returns the number of decompressed bytes written in |bytes_written_out|.
   Status DecompressFrame(const void* input_frame, size_t input_frame_len, void* output,
                          size_t output_len, size_t* bytes_written_out);
@@ -86,6 +96,9 @@ class ChunkedDecompressor {
   // to span the entire frame.
   // |output_len| must be at least as big as |table.Entries()[table_index].decompressed_size|.
   //
+  // Returns kStatusErrBadState if the archive was compressed with a dictionary other than the one
+  // set by SetDictionary().
+  //
   // Returns the number of decompressed bytes written in |bytes_written_out|.
   Status DecompressFrame(const SeekTable& table, unsigned table_index, const void* input_frame,
                          size_t input_frame_len, void* output, size_t output_len,
@@ -94,6 +107,7 @@ class ChunkedDecompressor {
  private:
   struct DecompressionContext;
   std::unique_ptr<DecompressionContext> context_;
+  std::shared_ptr<const DecompressionDictionary> dictionary_;
 };
 
 }  // namespace chunked_compression
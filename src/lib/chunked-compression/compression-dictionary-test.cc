@@ -0,0 +1,172 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdio.h>
+
+#include <memory>
+#include <string>
+
+#include <fbl/array.h>
+#include <src/lib/chunked-compression/chunked-archive.h>
+#include <src/lib/chunked-compression/chunked-compressor.h>
+#include <src/lib/chunked-compression/chunked-decompressor.h>
+#include <src/lib/chunked-compression/compression-dictionary.h>
+#include <src/lib/chunked-compression/status.h>
+#include <zxtest/zxtest.h>
+
+namespace chunked_compression {
+namespace {
+
+constexpr DictionaryIdType kDictionaryId = 1234u;
+
+// A 512-byte dictionary trained with `zstd --train --maxdict=512 --dictID=1234` on 200 samples
+// produced by |Manifest()|.
+constexpr uint8_t kDictionary[] = {
+    0x37, 0xa4, 0x30, 0xec, 0xd2, 0x04, 0x00, 0x00, 0x16, 0x10, 0xf0, 0x6c,
+    0x1c, 0x00, 0x00, 0x00, 0xbc, 0x90, 0x52, 0x4a, 0x29, 0x53, 0x7a, 0xc6,
+    0xd8, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x3b, 0x83, 0x03, 0x00, 0x00, 0x00,
+    0x80, 0x12, 0x76, 0xbe, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x17, 0x42, 0x10, 0x00, 0x00, 0x00, 0x34, 0xac, 0x2a, 0x06, 0x00,
+    0x00, 0x3c, 0x4a, 0x0c, 0x00, 0x8f, 0xd2, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xd4, 0x91, 0x66, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2e, 0x63, 0x6d, 0x22,
+    0x7d, 0x0a, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x2f, 0x70, 0x6b, 0x67,
+    0x31, 0x35, 0x23, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x70, 0x6b, 0x67, 0x2e,
+    0x63, 0x6d, 0x22, 0x7d, 0x0a, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+    0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+    0x2d, 0x33, 0x39, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x22, 0x7d,
+    0x0a, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x63,
+    0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2d, 0x31, 0x32, 0x36,
+    0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+    0x3a, 0x20, 0x38, 0x38, 0x32, 0x2c, 0x20, 0x22, 0x63, 0x61, 0x70, 0x61,
+    0x22, 0x7d, 0x0a, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20,
+    0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2d, 0x31,
+    0x34, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+    0x6e, 0x22, 0x3a, 0x20, 0x39, 0x39, 0x34, 0x2c, 0x20, 0x22, 0x63, 0x61,
+    0x70, 0x61, 0x7d, 0x0a, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a,
+    0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2d,
+    0x31, 0x36, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69,
+    0x6f, 0x6e, 0x22, 0x3a, 0x20, 0x31, 0x31, 0x37, 0x36, 0x2c, 0x20, 0x22,
+    0x63, 0x61, 0x70, 0x61, 0x6d, 0x22, 0x7d, 0x0a, 0x7b, 0x22, 0x6e, 0x61,
+    0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e,
+    0x65, 0x6e, 0x74, 0x2d, 0x34, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x20, 0x32, 0x38, 0x37, 0x2c,
+    0x20, 0x22, 0x63, 0x61, 0x70, 0x61, 0x22, 0x7d, 0x0a, 0x7b, 0x22, 0x6e,
+    0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f,
+    0x6e, 0x65, 0x6e, 0x74, 0x2d, 0x31, 0x31, 0x33, 0x22, 0x2c, 0x20, 0x22,
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x20, 0x37, 0x39,
+    0x31, 0x2c, 0x20, 0x22, 0x63, 0x61, 0x70, 0x61, 0x7b, 0x22, 0x6e, 0x61,
+    0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e,
+    0x65, 0x6e, 0x74, 0x2d, 0x31, 0x35, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x76,
+    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x20, 0x31, 0x30, 0x38,
+    0x35, 0x2c, 0x20, 0x22, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x3a, 0x20,
+    0x22, 0x66, 0x75, 0x63, 0x68, 0x73, 0x69, 0x61, 0x2d, 0x70, 0x6b, 0x67,
+    0x3a, 0x2f, 0x2f, 0x66, 0x75, 0x63, 0x68, 0x73, 0x69, 0x61, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x70, 0x6b, 0x67, 0x31, 0x35,
+};
+static_assert(sizeof(kDictionary) == 512);
+
+// Produces a small, manifest-like input of the kind the dictionary was trained on.
+std::string Manifest(int i) {
+  char buf[256];
+  snprintf(buf, sizeof(buf),
+           "{\"name\": \"component-%d\", \"version\": %d, \"capabilities\": "
+           "[\"fuchsia.logger.LogSink\", \"fuchsia.tracing.provider.Registry\"], "
+           "\"url\": \"fuchsia-pkg://fuchsia.com/pkg%d#meta/pkg.cm\"}\n",
+           i, i * 7, i);
+  return buf;
+}
+
+fbl::Array<uint8_t> Compress(const std::string& input,
+                             std::shared_ptr<const CompressionDictionary> dictionary,
+                             size_t* compressed_len) {
+  ChunkedCompressor compressor;
+  compressor.SetDictionary(std::move(dictionary));
+  size_t output_limit = compressor.ComputeOutputSizeLimit(input.size());
+  fbl::Array<uint8_t> output(new uint8_t[output_limit], output_limit);
+  EXPECT_EQ(compressor.Compress(input.data(), input.size(), output.get(), output.size(),
+                                compressed_len),
+            kStatusOk);
+  return output;
+}
+
+}  // namespace
+
+TEST(CompressionDictionaryTest, Create_RejectsRawContent) {
+  const std::string raw = Manifest(0);
+  std::shared_ptr<const CompressionDictionary> cdict;
+  EXPECT_EQ(CompressionDictionary::Create(raw.data(), raw.size(),
+                                          CompressionParams::DefaultCompressionLevel(), &cdict),
+            kStatusErrInvalidArgs);
+  std::shared_ptr<const DecompressionDictionary> ddict;
+  EXPECT_EQ(DecompressionDictionary::Create(raw.data(), raw.size(), &ddict),
+            kStatusErrInvalidArgs);
+}
+
+TEST(CompressionDictionaryTest, CompressDecompress) {
+  std::shared_ptr<const CompressionDictionary> cdict;
+  ASSERT_EQ(CompressionDictionary::Create(kDictionary, sizeof(kDictionary),
+                                          CompressionParams::DefaultCompressionLevel(), &cdict),
+            kStatusOk);
+  EXPECT_EQ(cdict->id(), kDictionaryId);
+  std::shared_ptr<const DecompressionDictionary> ddict;
+  ASSERT_EQ(DecompressionDictionary::Create(kDictionary, sizeof(kDictionary), &ddict), kStatusOk);
+  EXPECT_EQ(ddict->id(), kDictionaryId);
+
+  const std::string input = Manifest(1000);
+  size_t plain_len;
+  Compress(input, nullptr, &plain_len);
+  size_t compressed_len;
+  fbl::Array<uint8_t> compressed = Compress(input, cdict, &compressed_len);
+  EXPECT_LT(compressed_len, plain_len);
+
+  SeekTable table;
+  HeaderReader reader;
+  ASSERT_EQ(reader.Parse(compressed.get(), compressed_len, compressed_len, &table), kStatusOk);
+  EXPECT_EQ(table.DictionaryId(), kDictionaryId);
+  ASSERT_EQ(ChunkedDecompressor::ComputeOutputSize(table), input.size());
+
+  fbl::Array<uint8_t> output(new uint8_t[input.size()], input.size());
+  size_t decompressed_len;
+
+  // The dictionary is required.
+  ChunkedDecompressor decompressor;
+  EXPECT_EQ(decompressor.Decompress(table, compressed.get(), compressed_len, output.get(),
+                                    output.size(), &decompressed_len),
+            kStatusErrBadState);
+
+  decompressor.SetDictionary(ddict);
+  ASSERT_EQ(decompressor.Decompress(table, compressed.get(), compressed_len, output.get(),
+                                    output.size(), &decompressed_len),
+            kStatusOk);
+  ASSERT_EQ(decompressed_len, input.size());
+  EXPECT_BYTES_EQ(output.get(), input.data(), input.size());
+}
+
+TEST(CompressionDictionaryTest, DictionaryNotUsedByDefault) {
+  const std::string input = Manifest(1);
+  size_t compressed_len;
+  fbl::Array<uint8_t> compressed = Compress(input, nullptr, &compressed_len);
+
+  SeekTable table;
+  HeaderReader reader;
+  ASSERT_EQ(reader.Parse(compressed.get(), compressed_len, compressed_len, &table), kStatusOk);
+  EXPECT_EQ(table.DictionaryId(), kNoDictionary);
+
+  // Archives without a dictionary can still be decompressed by a decompressor which has one.
+  std::shared_ptr<const DecompressionDictionary> ddict;
+  ASSERT_EQ(DecompressionDictionary::Create(kDictionary, sizeof(kDictionary), &ddict), kStatusOk);
+  ChunkedDecompressor decompressor;
+  decompressor.SetDictionary(std::move(ddict));
+  fbl::Array<uint8_t> output(new uint8_t[input.size()], input.size());
+  size_t decompressed_len;
+  ASSERT_EQ(decompressor.Decompress(table, compressed.get(), compressed_len, output.get(),
+                                    output.size(), &decompressed_len),
+            kStatusOk);
+  EXPECT_BYTES_EQ(output.get(), input.data(), input.size());
+}
+
+}  // namespace chunked_compression
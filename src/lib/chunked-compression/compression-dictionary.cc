@@ -0,0 +1,63 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/syslog/cpp/macros.h>
+
+#include <memory>
+
+#include <src/lib/chunked-compression/chunked-archive.h>
+#include <src/lib/chunked-compression/compression-dictionary.h>
+#include <src/lib/chunked-compression/status.h>
+#include <zstd/zstd.h>
+
+namespace chunked_compression {
+
+// CompressionDictionary
+
+CompressionDictionary::~CompressionDictionary() { ZSTD_freeCDict(cdict_); }
+
+Status CompressionDictionary::Create(const void* data, size_t len, int compression_level,
+                                     std::shared_ptr<const CompressionDictionary>* out) {
+  if (!data || !out) {
+    return kStatusErrInvalidArgs;
+  }
+  // Raw content dictionaries have no ID, so archives could not refer to them.
+  DictionaryIdType id = ZSTD_getDictID_fromDict(data, len);
+  if (id == kNoDictionary) {
+    FX_LOG_KV(ERROR, "Not a trained zstd dictionary");
+    return kStatusErrInvalidArgs;
+  }
+  ZSTD_CDict* cdict = ZSTD_createCDict(data, len, compression_level);
+  if (cdict == nullptr) {
+    FX_LOG_KV(ERROR, "Failed to digest compression dictionary");
+    return kStatusErrInvalidArgs;
+  }
+  out->reset(new CompressionDictionary(cdict, id));
+  return kStatusOk;
+}
+
+// DecompressionDictionary
+
+DecompressionDictionary::~DecompressionDictionary() { ZSTD_freeDDict(ddict_); }
+
+Status DecompressionDictionary::Create(const void* data, size_t len,
+                                       std::shared_ptr<const DecompressionDictionary>* out) {
+  if (!data || !out) {
+    return kStatusErrInvalidArgs;
+  }
+  DictionaryIdType id = ZSTD_getDictID_fromDict(data, len);
+  if (id == kNoDictionary) {
+    FX_LOG_KV(ERROR, "Not a trained zstd dictionary");
+    return kStatusErrInvalidArgs;
+  }
+  ZSTD_DDict* ddict = ZSTD_createDDict(data, len);
+  if (ddict == nullptr) {
+    FX_LOG_KV(ERROR, "Failed to digest decompression dictionary");
+    return kStatusErrInvalidArgs;
+  }
+  out->reset(new DecompressionDictionary(ddict, id));
+  return kStatusOk;
+}
+
+}  // namespace chunked_compression
@@ -0,0 +1,90 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_LIB_CHUNKED_COMPRESSION_COMPRESSION_DICTIONARY_H_
+#define SRC_LIB_CHUNKED_COMPRESSION_COMPRESSION_DICTIONARY_H_
+
+#include <memory>
+
+#include <fbl/macros.h>
+
+#include "chunked-archive.h"
+#include "status.h"
+
+// Opaque zstd types, so that users of this library need not depend on zstd's headers.
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace chunked_compression {
+
+// CompressionDictionary holds a digested, trained zstd dictionary (e.g. the output of
+// `zstd --train`) for compressing the frames of chunked archives.
+//
+// Small inputs compress poorly on their own, since each frame of an archive is compressed
+// independently and has little history to draw on. Compressing them with a dictionary trained on
+// similar data (e.g. every small blob in an image) lets even the first bytes of a frame refer back
+// to common content.
+//
+// Archives compressed with a dictionary record its ID in their header (see chunked-archive.h), and
+// can only be decompressed with the same dictionary (see DecompressionDictionary).
+//
+// Digesting a dictionary is relatively expensive, so an instance should be created once and shared
+// between compressors. Instances are immutable and thread-safe.
+class CompressionDictionary {
+ public:
+  ~CompressionDictionary();
+  DISALLOW_COPY_ASSIGN_AND_MOVE(CompressionDictionary);
+
+  // Digests the dictionary in |data| for compression at |compression_level| (see
+  // CompressionParams). |data| is copied, and need not outlive the dictionary.
+  //
+  // Returns kStatusErrInvalidArgs if |data| is not a trained zstd dictionary, which is required
+  // for it to have a non-zero ID.
+  static Status Create(const void* data, size_t len, int compression_level,
+                       std::shared_ptr<const CompressionDictionary>* out);
+
+  DictionaryIdType id() const { return id_; }
+
+  // For use by the compressors.
+  const ZSTD_CDict_s* cdict() const { return cdict_; }
+
+ private:
+  CompressionDictionary(ZSTD_CDict_s* cdict, DictionaryIdType id) : cdict_(cdict), id_(id) {}
+
+  ZSTD_CDict_s* cdict_;
+  DictionaryIdType id_;
+};
+
+// DecompressionDictionary holds a digested zstd dictionary for decompressing the frames of chunked
+// archives which were compressed with the same dictionary (see CompressionDictionary).
+//
+// Digesting a dictionary is relatively expensive, so an instance should be created once (e.g. when
+// a filesystem is mounted) and shared between decompressors. Instances are immutable and
+// thread-safe.
+class DecompressionDictionary {
+ public:
+  ~DecompressionDictionary();
+  DISALLOW_COPY_ASSIGN_AND_MOVE(DecompressionDictionary);
+
+  // Digests the dictionary in |data|. |data| is copied, and need not outlive the dictionary.
+  //
+  // Returns kStatusErrInvalidArgs if |data| is not a trained zstd dictionary.
+  static Status Create(const void* data, size_t len,
+                       std::shared_ptr<const DecompressionDictionary>* out);
+
+  DictionaryIdType id() const { return id_; }
+
+  // For use by the decompressors.
+  const ZSTD_DDict_s* ddict() const { return ddict_; }
+
+ private:
+  DecompressionDictionary(ZSTD_DDict_s* ddict, DictionaryIdType id) : ddict_(ddict), id_(id) {}
+
+  ZSTD_DDict_s* ddict_;
+  DictionaryIdType id_;
+};
+
+}  // namespace chunked_compression
+
+#endif  // SRC_LIB_CHUNKED_COMPRESSION_COMPRESSION_DICTIONARY_H_
@@ -65,6 +65,8 @@ void StreamingChunkedCompressor::MoveFrom(StreamingChunkedCompressor&& o) {
 
   params_ = o.params_;
 
+  dictionary_ = std::move(o.dictionary_);
+
   context_ = std::move(o.context_);
 }
 
@@ -87,6 +89,13 @@ Status StreamingChunkedCompressor::Init(size_t stream_len, void* output, size_t
       return kStatusErrInternal;
     }
   }
+  // ZSTD_initCStream drops any dictionary referenced for a previous archive. A referenced
+  // dictionary persists across the per-frame session resets in StartFrame.
+  r = ZSTD_CCtx_refCDict(context_->inner_, dictionary_ ? dictionary_->cdict() : nullptr);
+  if (ZSTD_isError(r)) {
+    FX_LOG_KV(ERROR, "Failed to set dictionary");
+    return kStatusErrInternal;
+  }
 
   compressed_output_ = static_cast<uint8_t*>(output);
   compressed_output_len_ = output_len;
@@ -106,6 +115,7 @@ Status StreamingChunkedCompressor::Init(size_t stream_len, void* output, size_t
     compressed_output_ = nullptr;
     return status;
   }
+  header_writer_.SetDictionaryId(dictionary_ ? dictionary_->id() : kNoDictionary);
 
   return kStatusOk;
 }
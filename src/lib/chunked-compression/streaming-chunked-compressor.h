@@ -14,6 +14,7 @@
 #include <fbl/macros.h>
 
 #include "chunked-archive.h"
+#include "compression-dictionary.h"
 #include "compression-params.h"
 #include "status.h"
 
@@ -52,6 +53,14 @@ class StreamingChunkedCompressor {
   // Returns the minimum size that a buffer must be to hold the result of compressing |len| bytes.
   size_t ComputeOutputSizeLimit(size_t len) { return params_.ComputeOutputSizeLimit(len); }
 
+  // Compresses the frames of subsequently initialized archives with |dictionary|, recording its ID
+  // in their headers. Passing nullptr goes back to compressing without a dictionary.
+  //
+  // |dictionary| should have been created for |params().compression_level|.
+  void SetDictionary(std::shared_ptr<const CompressionDictionary> dictionary) {
+    dictionary_ = std::move(dictionary);
+  }
+
   // Initializes the compressor to prepare to receive |stream_len| bytes of input data.
   //
   // The compressed data will be written to |output|. |output_len| must be at least
@@ -110,6 +119,8 @@ class StreamingChunkedCompressor {
 
   CompressionParams params_;
 
+  std::shared_ptr<const CompressionDictionary> dictionary_;
+
   struct CompressionContext;
   std::unique_ptr<CompressionContext> context_;
 };
@@ -59,7 +59,9 @@ size_t NodeDigest::Append(const void* buf, size_t buf_len) {
 }
 
 void NodeDigest::PadWithZeros() {
-  static const uint8_t kZeroes[64] = {0};
+  // Large enough that padding the tail of a typical partial node takes only a few calls into the
+  // SHA-256 implementation rather than one per block.
+  static const uint8_t kZeroes[1024] = {0};
   size_t padding = to_append_ + pad_len_;
   if (padding == 0) {
     return;
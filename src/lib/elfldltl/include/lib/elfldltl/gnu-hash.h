@@ -106,6 +106,16 @@ class GnuHash {
 
   static constexpr bool Valid(std::span<const Addr> table) { return GetSizes(table).has_value(); }
 
+  // This is the same as checking Valid() and then constructing, but it only
+  // decodes and checks the header once.  This is what gets used for each
+  // module in each symbol lookup, so it's worth not doing that work twice.
+  static constexpr std::optional<GnuHash> FromTable(std::span<const Addr> table) {
+    if (auto sizes = GetSizes(table)) [[likely]] {
+      return GnuHash(table, *sizes);
+    }
+    return std::nullopt;
+  }
+
   constexpr uint32_t symtab_size() const {
     // First run through the buckets to find the largest symbol table index.
     uint32_t max_symndx = 0;
@@ -192,11 +202,20 @@ class GnuHash {
     return 0;  // Table didn't end with an end marker.
   }
 
-  constexpr uint32_t Bucket(uint32_t hash) const {
+  // This checks only the Bloom filter.  If it returns false, then no symbol
+  // with this hash value is in the table.  A true return value just means
+  // that Bucket() must be consulted.  Most lookups in a module list are for
+  // symbols that aren't defined in most of the modules, and this is all the
+  // work that's needed to rule out each of those modules.
+  constexpr bool MayContain(uint32_t hash) const {
     size_type filter = tables_[(hash / kAddrBits) & filter_index_mask_];
     uint32_t bit1 = hash % kAddrBits;
     uint32_t bit2 = (hash >> filter_hash_shift_) % kAddrBits;
-    if ((filter >> bit1) & (filter >> bit2) & 1) {
+    return (filter >> bit1) & (filter >> bit2) & 1;
+  }
+
+  constexpr uint32_t Bucket(uint32_t hash) const {
+    if (MayContain(hash)) {
       uint32_t bucket = hash % bucket_count_;
       if constexpr (sizeof(Addr) == sizeof(uint32_t)) {
         return tables_[filter_index_mask_ + 1 + bucket];
@@ -7,6 +7,9 @@
 
 #include <lib/fit/result.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -247,6 +250,69 @@ constexpr auto MakeSymbolResolver(const Module& ref_module, ModuleList& modules,
   };
 }
 
+// This wraps a `resolve` callable for RelocateSymbolic, such as one returned
+// by MakeSymbolResolver, so that repeated references to the same symbol are
+// only looked up once.  Large C++ modules have many relocations referring to
+// the same few symbols (vtables, typeinfo, common functions), and each of
+// those would otherwise repeat the hash lookup through every module in the
+// list.  The cache is a direct-mapped table of N entries indexed by the
+// referring symbol table entry, so it needs no allocation and is suitable for
+// the startup dynamic linker.  Only successful results are cached, so errors
+// are still diagnosed at each reference.
+//
+// The wrapped Resolver must return the same result for the same referring
+// symbol and RelocateTls type, as MakeSymbolResolver's does.  A single cache
+// should only be used for the relocations of one referring module.
+template <class Sym, class Resolver, size_t N = 64>
+class SymbolResolverCache {
+ public:
+  using Result = std::invoke_result_t<Resolver&, const Sym&, RelocateTls>;
+  using Definition = typename Result::value_type;
+
+  static_assert(N > 0 && (N & (N - 1)) == 0, "cache size must be a power of two");
+
+  constexpr explicit SymbolResolverCache(Resolver resolver) : resolver_(std::move(resolver)) {}
+
+  Result operator()(const Sym& ref, RelocateTls tls_type) {
+    Entry& entry = entries_[(reinterpret_cast<uintptr_t>(&ref) / sizeof(Sym)) % N];
+    if (entry.ref == &ref && entry.tls_type == tls_type) {
+      ++hits_;
+      return fit::ok(entry.definition);
+    }
+    Result result = resolver_(ref, tls_type);
+    if (result.is_ok()) {
+      entry = {.ref = &ref, .tls_type = tls_type, .definition = result.value()};
+    }
+    return result;
+  }
+
+  // The number of references resolved from the cache.
+  size_t hits() const { return hits_; }
+
+ private:
+  struct Entry {
+    const Sym* ref = nullptr;
+    RelocateTls tls_type = RelocateTls::kNone;
+    Definition definition{};
+  };
+
+  Resolver resolver_;
+  std::array<Entry, N> entries_{};
+  size_t hits_ = 0;
+};
+
+// This returns a SymbolResolverCache wrapping the result of
+// MakeSymbolResolver called with the same arguments.
+template <size_t N = 64, class Module, class ModuleList, class Diagnostics,
+          typename TlsDescResolver>
+constexpr auto MakeCachingSymbolResolver(const Module& ref_module, ModuleList& modules,
+                                         Diagnostics& diag, TlsDescResolver& tlsdesc_resolver,
+                                         ResolverPolicy policy = ResolverPolicy::kStrictLinkOrder) {
+  using Sym = typename ResolverDefinition<Module, TlsDescResolver>::Sym;
+  auto resolver = MakeSymbolResolver(ref_module, modules, diag, tlsdesc_resolver, policy);
+  return SymbolResolverCache<Sym, decltype(resolver), N>{std::move(resolver)};
+}
+
 }  // namespace elfldltl
 
 #endif  // SRC_LIB_ELFLDLTL_INCLUDE_LIB_ELFLDLTL_RESOLVE_H_
@@ -310,12 +310,7 @@ class SymbolInfo {
     return {};
   }
 
-  constexpr std::optional<GnuHash> gnu_hash() const {
-    if (GnuHash::Valid(gnu_hash_)) {
-      return GnuHash(gnu_hash_);
-    }
-    return {};
-  }
+  constexpr std::optional<GnuHash> gnu_hash() const { return GnuHash::FromTable(gnu_hash_); }
 
   constexpr std::string_view soname() const {
     if (soname_ != 0) {
@@ -157,6 +157,33 @@ TYPED_TEST(ElfldltlResolveTests, SingleModule) {
   EXPECT_EQ(found->symbol().value, 1ul);
 }
 
+TYPED_TEST(ElfldltlResolveTests, CachingResolver) {
+  using Elf = typename TestFixture::Elf;
+  using Sym = typename Elf::Sym;
+  using TestModule = typename ElfldltlResolveTests<Elf>::TestModule;
+
+  auto diag = ExpectOkDiagnostics();
+
+  std::array modules{TestModule("first"), TestModule("second")};
+  if (this->HasFatalFailure()) {
+    return;
+  }
+
+  const Sym* a = kASymbol.Lookup(modules[0].symbol_info());
+  ASSERT_NE(a, nullptr);
+  const Sym* a2 = kASymbol.Lookup(modules[1].symbol_info());
+  ASSERT_NE(a2, nullptr);
+
+  auto resolve = elfldltl::MakeCachingSymbolResolver(modules[1], modules, diag, kNoTlsdesc<Elf>);
+  for (int i = 0; i < 3; ++i) {
+    auto found = resolve(*a2, elfldltl::RelocateTls::kNone);
+    ASSERT_TRUE(found.is_ok()) << found.error_value();
+    ASSERT_FALSE(found->undefined_weak());
+    EXPECT_EQ(&found->symbol(), a);
+  }
+  EXPECT_EQ(resolve.hits(), 2u);
+}
+
 TYPED_TEST(ElfldltlResolveTests, DefBothFoundFirst) {
   using Elf = typename TestFixture::Elf;
   using Sym = typename Elf::Sym;
@@ -162,6 +162,31 @@ void EnumerateHashTable() {
   }
 }
 
+TYPED_TEST(ElfldltlSymbolTests, GnuHashMayContain) {
+  using Elf = typename TestFixture::Elf;
+
+  elfldltl::SymbolInfo<Elf> si;
+  kTestSymbols<Elf>.SetInfo(si);
+  si.set_gnu_hash(kTestGnuHash<typename Elf::Addr>);
+  const auto hash_table = si.gnu_hash();
+  ASSERT_TRUE(hash_table);
+
+  // The Bloom filter can have false positives, but never false negatives.
+  for (std::string_view name : GnuHash<Elf>::kNames) {
+    const uint32_t hash = elfldltl::SymbolName(name).gnu_hash();
+    EXPECT_TRUE(hash_table->MayContain(hash)) << name;
+    EXPECT_NE(hash_table->Bucket(hash), 0u) << name;
+  }
+
+  // Whenever the filter rules a hash value out, there is no bucket for it.
+  const uint32_t not_found_hash = kNotFoundSymbol.gnu_hash();
+  if (!hash_table->MayContain(not_found_hash)) {
+    EXPECT_EQ(hash_table->Bucket(not_found_hash), 0u);
+  }
+
+  EXPECT_FALSE(elfldltl::GnuHash<Elf>::FromTable({}));
+}
+
 TYPED_TEST(ElfldltlSymbolTests, EnumerateCompatHash) {
   EnumerateHashTable<typename TestFixture::Elf, CompatHash>();
 }
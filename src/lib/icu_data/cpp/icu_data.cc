@@ -4,14 +4,18 @@
 
 #include "src/lib/icu_data/cpp/icu_data.h"
 
+#include <fcntl.h>
+#include <lib/fdio/io.h>
 #include <lib/syslog/cpp/macros.h>
 #include <lib/zx/vmar.h>
+#include <sys/stat.h>
 #include <zircon/errors.h>
 
 #include <fstream>
 #include <optional>
 #include <string>
 
+#include <fbl/unique_fd.h>
 #include <src/lib/files/directory.h>
 
 #include "src/lib/fsl/vmo/file.h"
@@ -31,6 +35,30 @@ static const size_t kMinRevisionIdLength = 5;
 // Maximum number of chars in a revision ID.
 static const size_t kMaxRevisionIdLength = 15;
 
+// Loads the ICU data file at |path| into |icu_data|.
+//
+// Prefers the filesystem's own VMO for the file, so that every process maps
+// the very same pages: the data file is immutable and only ever mapped
+// read-only, and sharing the pager-backed pages means that only the parts of
+// the file ICU actually touches (e.g., the few locales a component uses) are
+// ever paged in, once for the whole system rather than once per process.
+// Falls back to a private copy if the filesystem doesn't hand out its VMO.
+bool LoadIcuData(const char* path, fsl::SizedVmo* icu_data) {
+  fbl::unique_fd fd(open(path, O_RDONLY));
+  if (!fd.is_valid())
+    return false;
+
+  struct stat stat_struct;
+  zx::vmo vmo;
+  if (fstat(fd.get(), &stat_struct) == 0 &&
+      fdio_get_vmo_exact(fd.get(), vmo.reset_and_get_address()) == ZX_OK) {
+    *icu_data = fsl::SizedVmo(std::move(vmo), stat_struct.st_size);
+    return true;
+  }
+
+  return fsl::VmoFromFd(std::move(fd), icu_data);
+}
+
 // Map the memory into the process and return a pointer to the memory.
 // |size_out| is required and is set with the size of the mapped memory
 // region.
@@ -98,7 +126,7 @@ zx_status_t InitializeWithTzResourceDirAndValidate(const char tz_files_dir[],
   }
 
   fsl::SizedVmo icu_data;
-  if (!fsl::VmoFromFilename(kIcuDataPath, &icu_data)) {
+  if (!LoadIcuData(kIcuDataPath, &icu_data)) {
     FX_LOGS(ERROR) << "could not create VMO from filename: " << kIcuDataPath;
     return ZX_ERR_IO;
   }
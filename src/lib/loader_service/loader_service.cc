@@ -8,6 +8,7 @@
 #include <lib/fdio/directory.h>
 #include <lib/fdio/io.h>
 #include <lib/syslog/cpp/macros.h>
+#include <string.h>
 #include <zircon/errors.h>
 
 #include "src/lib/files/path.h"
@@ -129,15 +130,59 @@ void LoaderConnection::Clone(CloneRequestView request, CloneCompleter::Sync& com
   completer.Reply(ZX_OK);
 }
 
+namespace {
+
+// Returns a read-only copy-on-write child of |vmo|, so that clients neither observe each other's
+// writes nor need the library to be read again.
+zx::result<zx::vmo> CloneObject(const zx::vmo& vmo) {
+  uint64_t size;
+  zx_status_t status = vmo.get_size(&size);
+  if (status != ZX_OK) {
+    return zx::error(status);
+  }
+  // A no-write child keeps the parent's ZX_RIGHT_EXECUTE.
+  zx::vmo child;
+  status = vmo.create_child(ZX_VMO_CHILD_SNAPSHOT_AT_LEAST_ON_WRITE | ZX_VMO_CHILD_NO_WRITE, 0,
+                            size, &child);
+  if (status != ZX_OK) {
+    return zx::error(status);
+  }
+  char name[ZX_MAX_NAME_LEN];
+  if (vmo.get_property(ZX_PROP_NAME, name, sizeof(name)) == ZX_OK) {
+    child.set_property(ZX_PROP_NAME, name, strlen(name));
+  }
+  return zx::ok(std::move(child));
+}
+
+}  // namespace
+
 // static
 std::shared_ptr<LoaderService> LoaderService::Create(async_dispatcher_t* dispatcher,
-                                                     fbl::unique_fd lib_dir, std::string name) {
+                                                     fbl::unique_fd lib_dir, std::string name,
+                                                     bool cache_objects) {
   // Can't use make_shared because constructor is protected
   return std::shared_ptr<LoaderService>(
-      new LoaderService(dispatcher, std::move(lib_dir), std::move(name)));
+      new LoaderService(dispatcher, std::move(lib_dir), std::move(name), cache_objects));
 }
 
 zx::result<zx::vmo> LoaderService::LoadObjectImpl(std::string path) {
+  if (!cache_objects_) {
+    return OpenObject(path);
+  }
+
+  std::lock_guard guard(lock_);
+  auto it = cached_objects_.find(path);
+  if (it == cached_objects_.end()) {
+    zx::result vmo = OpenObject(path);
+    if (vmo.is_error()) {
+      return vmo.take_error();
+    }
+    it = cached_objects_.emplace(path, std::move(vmo.value())).first;
+  }
+  return CloneObject(it->second);
+}
+
+zx::result<zx::vmo> LoaderService::OpenObject(const std::string& path) {
   const fio::Flags kFlags = fio::Flags::kProtocolFile | fio::kPermReadable | fio::kPermExecutable;
 
   fbl::unique_fd fd;
@@ -10,9 +10,13 @@
 #include <lib/zx/channel.h>
 #include <lib/zx/result.h>
 #include <lib/zx/vmo.h>
+#include <zircon/compiler.h>
 #include <zircon/types.h>
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <fbl/macros.h>
@@ -107,16 +111,34 @@ class LoaderService : public LoaderServiceBase {
   // This takes ownership of the 'lib_dir` fd and will close it automatically once all connections
   // to the loader service are closed and copies of this object are destroyed. `name` is used to
   // provide context when logging.
+  //
+  // If `cache_objects` is true, each library is only read from `lib_dir` once, and later requests
+  // for it are served with a read-only copy-on-write child of the cached VMO. This saves a
+  // directory round trip per library when the same libraries are loaded repeatedly, e.g. by every
+  // process launched from the same package, but is only correct if the contents of `lib_dir` do
+  // not change.
   static std::shared_ptr<LoaderService> Create(async_dispatcher_t* dispatcher,
-                                               fbl::unique_fd lib_dir, std::string name);
+                                               fbl::unique_fd lib_dir, std::string name,
+                                               bool cache_objects = false);
 
  protected:
-  LoaderService(async_dispatcher_t* dispatcher, fbl::unique_fd lib_dir, std::string name)
-      : LoaderServiceBase(dispatcher, std::move(name)), dir_(std::move(lib_dir)) {}
+  LoaderService(async_dispatcher_t* dispatcher, fbl::unique_fd lib_dir, std::string name,
+                bool cache_objects = false)
+      : LoaderServiceBase(dispatcher, std::move(name)),
+        dir_(std::move(lib_dir)),
+        cache_objects_(cache_objects) {}
   zx::result<zx::vmo> LoadObjectImpl(std::string path) override;
 
  private:
+  // Opens `path` in `dir_` and returns its executable VMO, bypassing the cache.
+  zx::result<zx::vmo> OpenObject(const std::string& path);
+
   fbl::unique_fd dir_;
+  const bool cache_objects_;
+
+  std::mutex lock_;
+  // Maps a library path to the VMO it was loaded as. Only used if `cache_objects_` is true.
+  std::unordered_map<std::string, zx::vmo> cached_objects_ __TA_GUARDED(lock_);
 };
 
 }  // namespace loader
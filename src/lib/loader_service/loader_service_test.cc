@@ -131,6 +131,38 @@ TEST_F(LoaderServiceTest, LoadObject) {
   EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libnoexec.so", zx::error(ZX_ERR_ACCESS_DENIED)));
 }
 
+TEST_F(LoaderServiceTest, LoadObjectCached) {
+  fbl::unique_fd root_fd;
+  std::vector<TestDirectoryEntry> config;
+  config.emplace_back("libfoo.so", "science", true);
+  config.emplace_back("libnoexec.so", "rules", false);
+  ASSERT_NO_FATAL_FAILURE(CreateTestDirectory(config, &root_fd));
+
+  const ::testing::TestInfo* const test_info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  auto loader = LoaderService::Create(loader_loop().dispatcher(), std::move(root_fd),
+                                      test_info->name(), /*cache_objects=*/true);
+
+  auto status = loader->Connect();
+  ASSERT_TRUE(status.is_ok());
+  fidl::WireSyncClient<fldsvc::Loader> client(std::move(status.value()));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libfoo.so", zx::ok("science")));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libnoexec.so", zx::error(ZX_ERR_ACCESS_DENIED)));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client, "libmissing.so", zx::error(ZX_ERR_NOT_FOUND)));
+
+  // Remove the library, so that only a cached copy can satisfy the next load. Failed loads are not
+  // cached, so a library that is added later can still be found.
+  ASSERT_EQ(root_dir()->Unlink("libfoo.so", false), ZX_OK);
+  ASSERT_NO_FATAL_FAILURE(
+      AddDirectoryEntry(root_dir(), TestDirectoryEntry("libmissing.so", "found", true)));
+
+  status = loader->Connect();
+  ASSERT_TRUE(status.is_ok());
+  fidl::WireSyncClient<fldsvc::Loader> client2(std::move(status.value()));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client2, "libfoo.so", zx::ok("science")));
+  EXPECT_NO_FATAL_FAILURE(LoadObject(client2, "libmissing.so", zx::ok("found")));
+}
+
 TEST_F(LoaderServiceTest, Config) {
   std::shared_ptr<LoaderService> loader;
   std::vector<TestDirectoryEntry> config;
@@ -12,6 +12,7 @@
 #include <zircon/assert.h>
 #include <zircon/types.h>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -30,22 +31,12 @@ namespace {
 template<class T>
 constexpr bool sfinae_false_v = false;
 
-// This is essentially the same code as cobalt buckets_config BucketIndex.
-uint32_t BucketIndex(std::vector<int64_t>& floors, int64_t val) {
-  // 0 is the underflow bucket.
-  if (val < floors[0]) {
-    return 0;
-  }
-
-  // TODO(b/278918086): Maybe switch to binary search?
-  for (uint32_t i = 1; i < floors.size(); i++) {
-    if (val >= floors[i - 1] && val < floors[i]) {
-      return i;
-    }
-  }
-
-  // floors_.size() is the overflow bucket.
-  return static_cast<uint32_t>(floors.size());
+// This computes the same index as cobalt buckets_config BucketIndex. 0 is the underflow bucket,
+// and floors.size() is the overflow bucket.
+uint32_t BucketIndex(const std::vector<int64_t>& floors, int64_t val) {
+  // The floors are sorted, so the bucket is the number of floors at or below val.
+  return static_cast<uint32_t>(std::upper_bound(floors.begin(), floors.end(), val) -
+                               floors.begin());
 }
 
 } // namespace
@@ -116,7 +107,9 @@ void MetricsBuffer::SetServiceDirectory(std::shared_ptr<sys::ServiceDirectory> s
       loop_ = std::move(loop);
       cobalt_logger_ = std::move(new_logger);
       ZX_DEBUG_ASSERT(!!loop_ && !!cobalt_logger_);
-      if (!pending_counts_.empty()) {
+      // Any flush posted to the old loop won't run.
+      flush_posted_ = false;
+      if (!pending_counts_.empty() || !pending_strings_.empty() || !pending_histograms_.empty()) {
         LOG(INFO, "MetricsBuffer::SetServiceDirectory() flushing counts soon.");
         TryPostFlushCountsLocked();
       }
@@ -150,18 +143,15 @@ void MetricsBuffer::SetMinLoggingPeriod(zx::duration min_logging_period) {
 
 void MetricsBuffer::LogEventCount(uint32_t metric_id, std::vector<uint32_t> dimension_values,
                                   uint32_t count) {
+  MetricKey key(metric_id, std::move(dimension_values));
   std::lock_guard<std::mutex> lock(lock_);
   ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
-  bool was_empty = pending_counts_.empty();
-  MetricKey key(metric_id, std::move(dimension_values));
-  pending_counts_[key] += count;
-  if (was_empty) {
-    // We don't try to process locally, because if we're logging infrequently then the optimization
-    // wouldn't matter, and if we're logging frequently then we need to post in order to delay
-    // anyway.  So we opt to keep the code simpler and always post even if the deadline is in the
-    // past.
-    TryPostFlushCountsLocked();
-  }
+  pending_counts_[std::move(key)] += count;
+  // We don't try to process locally, because if we're logging infrequently then the optimization
+  // wouldn't matter, and if we're logging frequently then we need to post in order to delay
+  // anyway.  So we opt to keep the code simpler and always post even if the deadline is in the
+  // past.
+  TryPostFlushCountsLocked();
 }
 
 void MetricsBuffer::LogEvent(uint32_t metric_id, std::vector<uint32_t> dimension_values) {
@@ -170,76 +160,86 @@ void MetricsBuffer::LogEvent(uint32_t metric_id, std::vector<uint32_t> dimension
 
 void MetricsBuffer::LogString(uint32_t metric_id, std::vector<uint32_t> dimension_values,
                               std::string string_value) {
+  MetricKey key(metric_id, std::move(dimension_values));
   std::lock_guard<std::mutex> lock(lock_);
   ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
-  bool was_empty = pending_strings_.empty();
-  MetricKey key(metric_id, std::move(dimension_values));
-  // By design, this emplace can fail if a matching string is already in the set.
-  pending_strings_[key].emplace(std::move(string_value));
-  if (was_empty) {
-    TryPostFlushCountsLocked();
+  auto& strings = pending_strings_[std::move(key)];
+  if (strings.size() >= kMaxPendingStringsPerKey) {
+    return;
   }
+  // By design, this emplace can fail if a matching string is already in the set.
+  strings.emplace(std::move(string_value));
+  TryPostFlushCountsLocked();
 }
 
 void MetricsBuffer::LogHistogramValue(const HistogramInfo& histogram_info,
-                                      std::vector<int64_t>& floors,
+                                      const std::vector<int64_t>& floors,
                                       std::vector<uint32_t> dimension_values, int64_t value) {
-  std::lock_guard<std::mutex> lock(lock_);
-  ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
-  bool was_empty = pending_histograms_.empty();
   MetricKey key(histogram_info.metric_id, std::move(dimension_values));
   uint32_t bucket_index = BucketIndex(floors, value);
-  pending_histograms_[key][bucket_index]++;
-  if (was_empty) {
-    TryPostFlushCountsLocked();
-  }
-}
-
-void MetricsBuffer::FlushPendingEventCounts() {
   std::lock_guard<std::mutex> lock(lock_);
   ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
-  if (!cobalt_logger_) {
-    // In some testing scenarios, we may not have access to a real MetricEventLoggerFactory, and we
-    // can end up here if SetServiceDirectory() hit an error while (or shortly after) switching from
-    // an old loop_ and cobalt_logger_ to a new loop_ and cobalt_logger_.
-    //
-    // If later we get a new cobalt_logger_ from a new SetServiceDirectory(), this method will run
-    // again.
-    return;
-  }
-  last_flushed_ = zx::clock::get_monotonic();
+  pending_histograms_[std::move(key)][bucket_index]++;
+  TryPostFlushCountsLocked();
+}
+
+void MetricsBuffer::FlushPendingEventCounts(async_dispatcher_t* dispatcher) {
+  PendingCounts snapped_pending_event_counts;
+  PendingStrings snapped_pending_strings;
+  PendingHistograms snapped_pending_histograms;
+  cobalt::MetricsImpl* cobalt_logger;
+  {  // scope lock
+    std::lock_guard<std::mutex> lock(lock_);
+    ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
+    if (loop_ && loop_->dispatcher() != dispatcher) {
+      // Posted to a loop that SetServiceDirectory() has since replaced, and which will be
+      // destroyed after this task. The new loop has its own flush.
+      return;
+    }
+    flush_posted_ = false;
+    if (!cobalt_logger_) {
+      // In some testing scenarios, we may not have access to a real MetricEventLoggerFactory, and
+      // we can end up here if SetServiceDirectory() hit an error while (or shortly after) switching
+      // from an old loop_ and cobalt_logger_ to a new loop_ and cobalt_logger_.
+      //
+      // If later we get a new cobalt_logger_ from a new SetServiceDirectory(), this method will
+      // run again.
+      return;
+    }
+    last_flushed_ = zx::clock::get_monotonic();
+    snapped_pending_event_counts.swap(pending_counts_);
+    snapped_pending_strings.swap(pending_strings_);
+    snapped_pending_histograms.swap(pending_histograms_);
+    // SetServiceDirectory() only deletes a MetricsImpl by posting to the loop that created it,
+    // which is the loop this task runs on, so it stays valid until we return.
+    cobalt_logger = cobalt_logger_.get();
+  }  // ~lock
 
   constexpr uint32_t kMaxBatchSize = 64;
   std::vector<fuchsia_metrics::MetricEvent> batch;
 
-  PendingCounts snapped_pending_event_counts;
-  snapped_pending_event_counts.swap(pending_counts_);
   for (auto& [key, count] : snapped_pending_event_counts) {
     batch.emplace_back(key.metric_id(), key.dimension_values(),
                        fuchsia_metrics::MetricEventPayload::WithCount(count));
     ZX_DEBUG_ASSERT(batch.size() <= kMaxBatchSize);
     if (batch.size() == kMaxBatchSize) {
-      cobalt_logger_->LogMetricEvents(std::move(batch));
+      cobalt_logger->LogMetricEvents(std::move(batch));
       batch.clear();
     }
   }
 
-  PendingStrings snapped_pending_strings;
-  snapped_pending_strings.swap(pending_strings_);
   for (auto& [key, strings] : snapped_pending_strings) {
     for (auto& string : strings) {
       batch.emplace_back(key.metric_id(), key.dimension_values(),
                          fuchsia_metrics::MetricEventPayload::WithStringValue(string));
       ZX_DEBUG_ASSERT(batch.size() <= kMaxBatchSize);
       if (batch.size() == kMaxBatchSize) {
-        cobalt_logger_->LogMetricEvents(std::move(batch));
+        cobalt_logger->LogMetricEvents(std::move(batch));
         batch.clear();
       }
     }
   }
 
-  PendingHistograms snapped_pending_histograms;
-  snapped_pending_histograms.swap(pending_histograms_);
   for (auto& [histogram_key, pending_buckets] : snapped_pending_histograms) {
     std::vector<fuchsia_metrics::HistogramBucket> buckets;
     auto bucket_iter = pending_buckets.begin();
@@ -257,7 +257,7 @@ void MetricsBuffer::FlushPendingEventCounts() {
         buckets.clear();
         ZX_DEBUG_ASSERT(batch.size() <= kMaxBatchSize);
         if (batch.size() == kMaxBatchSize) {
-          cobalt_logger_->LogMetricEvents(std::move(batch));
+          cobalt_logger->LogMetricEvents(std::move(batch));
           batch.clear();
         }
       }
@@ -266,17 +266,19 @@ void MetricsBuffer::FlushPendingEventCounts() {
 
   ZX_DEBUG_ASSERT(batch.size() < kMaxBatchSize);
   if (!batch.empty()) {
-    cobalt_logger_->LogMetricEvents(std::move(batch));
+    cobalt_logger->LogMetricEvents(std::move(batch));
     batch.clear();
   }
 }
 
 void MetricsBuffer::TryPostFlushCountsLocked() {
   ZX_DEBUG_ASSERT(!!loop_ == !!cobalt_logger_);
-  if (cobalt_logger_) {
+  if (cobalt_logger_ && !flush_posted_) {
     ZX_DEBUG_ASSERT(loop_);
+    flush_posted_ = true;
     async::PostTaskForTime(
-        loop_->dispatcher(), [this] { FlushPendingEventCounts(); },
+        loop_->dispatcher(),
+        [this, dispatcher = loop_->dispatcher()] { FlushPendingEventCounts(dispatcher); },
         last_flushed_ + min_logging_period_);
   }
 }
@@ -129,6 +129,10 @@ class HistogramMetricBuffer {
 // Methods of this class can be called on any thread.
 class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
  public:
+  // The most distinct strings buffered per metric and dimension values between flushes. Further
+  // strings logged in the same flush period are dropped.
+  static constexpr size_t kMaxPendingStringsPerKey = 64;
+
   // Initially a noop instance, so unit tests don't need to wire up cobalt.  Call
   // SetServiceDirectory() to enable and start logging.
   static std::shared_ptr<MetricsBuffer> Create(uint32_t project_id);
@@ -162,7 +166,8 @@ class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
   void LogEventCount(uint32_t metric_id, std::vector<uint32_t> dimension_values, uint32_t count);
 
   // The string_value is not an arbitrary string; it must be one of the potential strings defined in
-  // the metric definition, or the string_value ends up getting ignored.
+  // the metric definition, or the string_value ends up getting ignored. See also
+  // kMaxPendingStringsPerKey.
   void LogString(uint32_t metric_id, std::vector<uint32_t> dimension_values,
                  std::string string_value);
 
@@ -180,7 +185,7 @@ class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
   friend class HistogramMetricBuffer;
 
   // This computes which histogram bucket, and adds 1 to the tally of that bucket.
-  void LogHistogramValue(const HistogramInfo& histogram_info, std::vector<int64_t>& floors,
+  void LogHistogramValue(const HistogramInfo& histogram_info, const std::vector<int64_t>& floors,
                          std::vector<uint32_t> dimension_values, int64_t value);
 
   explicit MetricsBuffer(uint32_t project_id) __TA_EXCLUDES(lock_);
@@ -241,7 +246,9 @@ class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
   };
 
   void TryPostFlushCountsLocked() __TA_REQUIRES(lock_);
-  void FlushPendingEventCounts() __TA_EXCLUDES(lock_);
+  // Only holds lock_ long enough to take the pending events, so that logging from other threads
+  // doesn't wait while the batches are built.
+  void FlushPendingEventCounts(async_dispatcher_t* dispatcher) __TA_EXCLUDES(lock_);
 
   static constexpr zx::duration kDefaultMinLoggingPeriod = zx::sec(5);
 
@@ -258,6 +265,10 @@ class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
 
   zx::time last_flushed_ __TA_GUARDED(lock_) = zx::time::infinite_past();
 
+  // Whether a flush is posted and hasn't taken the pending events yet. A single flush covers all
+  // the pending counts, strings and histograms.
+  bool flush_posted_ __TA_GUARDED(lock_) = false;
+
   // From component and event to event count.
   using PendingCounts = std::unordered_map<MetricKey, int64_t, MetricKeyHash, MetricKeyEqual>;
   PendingCounts pending_counts_ __TA_GUARDED(lock_);
@@ -265,9 +276,8 @@ class MetricsBuffer final : public std::enable_shared_from_this<MetricsBuffer> {
   // We don't keep a count per string; instead we collapse out any additional string instances per
   // flush period, since each tally of a string would require an additional item in the batch. We
   // want to avoid creating a large number of items in a batch or a large number of batches due to
-  // a noisy string. We also want to avoid using unbounded memory in the MetricsBuffer. We could
-  // achieve this with a cap on how many instances of the same string we're willing to buffer and
-  // batch, but for now we just cap at buffering 1 of a given string at any given time.
+  // a noisy string. We also want to avoid using unbounded memory in the MetricsBuffer, so we cap at
+  // buffering 1 of a given string, and kMaxPendingStringsPerKey strings per key, at any given time.
   using PendingStrings =
       std::unordered_map<MetricKey, std::unordered_set<std::string>, MetricKeyHash, MetricKeyEqual>;
   PendingStrings pending_strings_ __TA_GUARDED(lock_);
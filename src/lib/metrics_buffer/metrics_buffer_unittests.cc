@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -499,6 +500,27 @@ TEST_F(MetricsBufferTest, Strings) {
   EXPECT_TRUE(e.string_value == "the_string" || e.string_value == "other_string");
 }
 
+TEST_F(MetricsBufferTest, StringsCappedPerFlush) {
+  auto& s = state();
+
+  auto metrics_buffer = cobalt::MetricsBuffer::Create(42, s.aux_service_directory());
+  metrics_buffer->SetMinLoggingPeriod(zx::msec(500));
+  auto string_buffer = metrics_buffer->CreateStringMetricBuffer(12);
+
+  // The first flush happens right away; the rest are at least min_logging_period apart.
+  string_buffer.LogString({1u}, "first");
+  s.WaitUntilEventCountAtLeast(1);
+
+  // These all land in the second flush, which only keeps the first kMaxPendingStringsPerKey.
+  const uint32_t kStringCount = cobalt::MetricsBuffer::kMaxPendingStringsPerKey + 10;
+  for (uint32_t i = 0; i < kStringCount; ++i) {
+    string_buffer.LogString({1u}, "string_" + std::to_string(i));
+  }
+  s.WaitUntilEventCountAtLeast(1 + cobalt::MetricsBuffer::kMaxPendingStringsPerKey);
+  zx::nanosleep(zx::deadline_after(zx::msec(100)));
+  EXPECT_EQ(1 + cobalt::MetricsBuffer::kMaxPendingStringsPerKey, s.event_count());
+}
+
 TEST_F(MetricsBufferTest, Histograms) {
   auto& s = state();
 
@@ -12,6 +12,7 @@
 #include <cstdio>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include "src/lib/unwinder/cfi_parser.h"
 #include "src/lib/unwinder/error.h"
@@ -237,6 +238,10 @@ Error CfiModule::Step(Memory* stack, const Registers& current, Registers& next)
     return Error("pc %#" PRIx64 " is outside of the executable area", pc);
   }
 
+  if (auto it = pc_rules_cache_.find(pc); it != pc_rules_cache_.end()) {
+    return it->second.cfi_parser.Step(stack, it->second.return_address_register, current, next);
+  }
+
   DwarfCie cie;
   DwarfFde fde;
   // Search for .eh_frame first.
@@ -265,6 +270,10 @@ Error CfiModule::Step(Memory* stack, const Registers& current, Registers& next)
     return err;
   }
 
+  if (pc_rules_cache_.size() < kMaxCachedPcs) {
+    pc_rules_cache_.emplace(pc, PcRules{cfi_parser, cie.return_address_register});
+  }
+
   if (auto err = cfi_parser.Step(stack, cie.return_address_register, current, next);
       err.has_err()) {
     return err;
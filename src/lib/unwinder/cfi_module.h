@@ -7,7 +7,9 @@
 
 #include <cstdint>
 #include <map>
+#include <unordered_map>
 
+#include "src/lib/unwinder/cfi_parser.h"
 #include "src/lib/unwinder/error.h"
 #include "src/lib/unwinder/memory.h"
 #include "src/lib/unwinder/module.h"
@@ -19,7 +21,8 @@ namespace unwinder {
 // of one ELF module.
 //
 // This class doesn't cache the memory so if repeated lookups are required, it's recommended to use
-// a cached Memory implementation.
+// a cached Memory implementation. It does cache the parsed rules for each PC it has stepped from,
+// so that unwinding through the same PC again doesn't need to search and parse the CFI.
 class CfiModule {
  public:
   // Caller must ensure elf to outlive us.
@@ -91,6 +94,16 @@ class CfiModule {
   // Binary search table for .debug_frame, similar to .eh_frame_hdr.
   // To save space, we only store the mapping from pc to the start of FDE.
   std::map<uint64_t, uint64_t> debug_frame_map_;
+
+  // The rules to unwind from a PC, i.e., the CFI parsed up to that PC.
+  struct PcRules {
+    CfiParser cfi_parser;
+    RegisterID return_address_register;
+  };
+  // Profilers unwind through the same return addresses again and again, so the rules are cached
+  // per PC. The cache stops growing at |kMaxCachedPcs| entries to bound its memory usage.
+  static constexpr size_t kMaxCachedPcs = 4096;
+  std::unordered_map<uint64_t, PcRules> pc_rules_cache_;
 };
 
 }  // namespace unwinder
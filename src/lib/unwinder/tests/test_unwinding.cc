@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <link.h>
+
 #include <algorithm>
 #include <cinttypes>
 #include <cstdint>
@@ -9,6 +11,9 @@
 #include <gtest/gtest.h>
 
 #include "src/lib/fxl/strings/string_printf.h"
+#include "src/lib/unwinder/memory.h"
+#include "src/lib/unwinder/third_party/libunwindstack/context.h"
+#include "src/lib/unwinder/unwind.h"
 #include "src/lib/unwinder/unwind_local.h"
 
 namespace unwinder {
@@ -102,6 +107,40 @@ TEST(Unwinder, HybridUnwinding) {
   check_stack();
 }
 
+// Unwinding again with the same unwinder uses the cached CFI rules and should give the same stack.
+TEST(Unwinder, RepeatedUnwinding) {
+  std::vector<uint64_t> load_addresses;
+  dl_iterate_phdr(
+      [](dl_phdr_info* info, size_t, void* p_load_addresses) {
+        reinterpret_cast<std::vector<uint64_t>*>(p_load_addresses)->push_back(info->dlpi_addr);
+        return 0;
+      },
+      &load_addresses);
+
+  LocalMemory mem;
+  std::vector<Module> modules;
+  for (uint64_t load_address : load_addresses) {
+    modules.emplace_back(load_address, &mem, Module::AddressMode::kProcess);
+  }
+
+  Unwinder unwinder(modules);
+  Registers regs = GetContext();
+  std::vector<Frame> first = unwinder.Unwind(&mem, regs);
+  std::vector<Frame> second = unwinder.Unwind(&mem, regs);
+
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); i++) {
+    uint64_t first_pc, second_pc, first_sp, second_sp;
+    ASSERT_TRUE(first[i].regs.GetPC(first_pc).ok());
+    ASSERT_TRUE(second[i].regs.GetPC(second_pc).ok());
+    EXPECT_EQ(first_pc, second_pc) << "frame " << i;
+    if (first[i].regs.GetSP(first_sp).ok() && second[i].regs.GetSP(second_sp).ok()) {
+      EXPECT_EQ(first_sp, second_sp) << "frame " << i;
+    }
+    EXPECT_EQ(first[i].trust, second[i].trust) << "frame " << i;
+  }
+}
+
 #if __has_feature(shadow_call_stack)
 TEST(Unwinder, Scs) {
   // SCS unwinder cannot be combined with other unwinders, e.g.
@@ -177,6 +177,61 @@ TEST_F(MapPinTest, PinSingleRegion) {
   ASSERT_EQ(region_count, 0u);
 }
 
+TEST_F(MapPinTest, PinLazily) {
+  auto options = DefaultPinOptions();
+  options.pin->lazy_chunk_size = ZX_PAGE_SIZE * 2;
+  VmoStore store(std::move(options));
+  zx::result result = CreateAndRegister(store);
+  ASSERT_OK(result.status_value());
+  size_t key = result.value();
+  auto* vmo = store.GetVmo(key);
+  // Nothing is pinned on registration.
+  ASSERT_EQ(vmo->pinned_vmo().region_count(), 0u);
+  size_t pinned_count;
+  ASSERT_OK(fake_bti_get_pinned_vmos(GetBti()->get(), nullptr, 0, &pinned_count));
+  ASSERT_EQ(pinned_count, 0u);
+
+  constexpr uint64_t kOffset = 100;
+  fzl::PinnedVmo::Region regions[kVmoPages];
+  size_t region_count;
+  // Only the first chunk is needed for this range.
+  ASSERT_STATUS(vmo->GetPinnedRegions(kOffset, ZX_PAGE_SIZE, nullptr, 0, &region_count),
+                ZX_ERR_BUFFER_TOO_SMALL);
+  ASSERT_EQ(region_count, 2u);
+  ASSERT_OK(fake_bti_get_pinned_vmos(GetBti()->get(), nullptr, 0, &pinned_count));
+  ASSERT_EQ(pinned_count, 1u);
+
+  // Querying the same chunk again reuses the pin.
+  ASSERT_OK(vmo->GetPinnedRegions(kOffset, ZX_PAGE_SIZE, regions, kVmoPages, &region_count));
+  ASSERT_EQ(region_count, 2u);
+  // Physical addresses returned by fake bti are always ZX_PAGE_SIZE.
+  EXPECT_EQ(regions[0].phys_addr, ZX_PAGE_SIZE + kOffset);
+  EXPECT_EQ(regions[0].size, ZX_PAGE_SIZE - kOffset);
+  EXPECT_EQ(regions[1].phys_addr, ZX_PAGE_SIZE);
+  EXPECT_EQ(regions[1].size, kOffset);
+  ASSERT_OK(fake_bti_get_pinned_vmos(GetBti()->get(), nullptr, 0, &pinned_count));
+  ASSERT_EQ(pinned_count, 1u);
+
+  // A range spanning both chunks pins the second one.
+  ASSERT_OK(vmo->GetPinnedRegions(ZX_PAGE_SIZE + kOffset, ZX_PAGE_SIZE * 2, regions, kVmoPages,
+                                  &region_count));
+  ASSERT_EQ(region_count, 3u);
+  EXPECT_EQ(regions[0].size, ZX_PAGE_SIZE - kOffset);
+  EXPECT_EQ(regions[1].size, ZX_PAGE_SIZE);
+  EXPECT_EQ(regions[2].size, kOffset);
+  ASSERT_OK(fake_bti_get_pinned_vmos(GetBti()->get(), nullptr, 0, &pinned_count));
+  ASSERT_EQ(pinned_count, 2u);
+
+  ASSERT_STATUS(vmo->GetPinnedRegions(kVmoSize, 1, regions, 0, &region_count), ZX_ERR_OUT_OF_RANGE);
+  ASSERT_STATUS(vmo->GetPinnedRegions(0, kVmoSize + 1, regions, 0, &region_count),
+                ZX_ERR_OUT_OF_RANGE);
+
+  // The chunks are unpinned when the VMO is unregistered.
+  ASSERT_OK(store.Unregister(key).status_value());
+  ASSERT_OK(fake_bti_get_pinned_vmos(GetBti()->get(), nullptr, 0, &pinned_count));
+  ASSERT_EQ(pinned_count, 0u);
+}
+
 TEST_F(MapPinTest, NoMapOrPin) {
   VmoStore store(Options{cpp17::nullopt, cpp17::nullopt});
   zx::result result = CreateAndRegister(store);
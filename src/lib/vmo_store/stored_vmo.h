@@ -8,8 +8,11 @@
 #include <lib/fzl/pinned-vmo.h>
 #include <lib/fzl/vmo-mapper.h>
 #include <lib/stdcompat/span.h>
+#include <lib/zx/bti.h>
 #include <lib/zx/vmo.h>
 
+#include <algorithm>
+#include <memory>
 #include <utility>
 
 #include <fbl/alloc_checker.h>
@@ -81,7 +84,7 @@ class StoredVmo {
   // Returns `ZX_ERR_ALREADY_BOUND` if the VMO is already pinned.
   // For other possible errors, see `fzl::PinnedVmo::Pin`.
   zx_status_t Pin(const zx::bti& bti, uint32_t options, bool index = true) {
-    if (pinned_.region_count() != 0) {
+    if (pinned_.region_count() != 0 || lazy_pin_) {
       return ZX_ERR_ALREADY_BOUND;
     }
     zx_status_t status = pinned_.Pin(vmo_, bti, options);
@@ -106,6 +109,43 @@ class StoredVmo {
     return ZX_OK;
   }
 
+  // Prepares the VMO to be pinned lazily using `bti`, in chunks of `chunk_size` bytes.
+  //
+  // Nothing is pinned here. A chunk is pinned the first time `GetPinnedRegions` touches it and
+  // stays pinned, so later requests reuse its IOMMU mapping, until the `StoredVmo` is destroyed.
+  // Regions returned by `GetPinnedRegions` are then split at chunk boundaries as well as at
+  // physical discontinuities. `pinned_vmo` stays empty in this mode.
+  //
+  // `options` has the same meaning as for `Pin`. `bti` must outlive the `StoredVmo`.
+  //
+  // Returns `ZX_ERR_ALREADY_BOUND` if the VMO is already pinned.
+  // Returns `ZX_ERR_INVALID_ARGS` if `chunk_size` is zero or not a multiple of the page size.
+  zx_status_t PinLazily(zx::unowned_bti bti, uint32_t options, uint64_t chunk_size) {
+    if (pinned_.region_count() != 0 || lazy_pin_) {
+      return ZX_ERR_ALREADY_BOUND;
+    }
+    if (chunk_size == 0 || chunk_size % zx_system_get_page_size() != 0) {
+      return ZX_ERR_INVALID_ARGS;
+    }
+    uint64_t vmo_size;
+    zx_status_t status = vmo_.get_size(&vmo_size);
+    if (status != ZX_OK) {
+      return status;
+    }
+    fbl::AllocChecker ac;
+    std::unique_ptr<LazyPin> lazy_pin(new (&ac) LazyPin{std::move(bti), options, chunk_size,
+                                                        vmo_size, nullptr});
+    if (!ac.check()) {
+      return ZX_ERR_NO_MEMORY;
+    }
+    lazy_pin->chunks.reset(new (&ac) fzl::PinnedVmo[(vmo_size + chunk_size - 1) / chunk_size]);
+    if (!ac.check()) {
+      return ZX_ERR_NO_MEMORY;
+    }
+    lazy_pin_ = std::move(lazy_pin);
+    return ZX_OK;
+  }
+
   // Accesses mapped VMO data.
   // An empty span is returned if the VMO was not mapped to virtual memory.
   cpp20::span<uint8_t> data() {
@@ -126,6 +166,8 @@ class StoredVmo {
   //
   // Returns `ZX_ERR_BAD_STATE` if the VMO is not pinned, or region indexing was not enabled during
   // pinning.
+  // If the VMO is pinned lazily, also returns errors from pinning the chunks covering the range.
+  // See `fzl::PinnedVmo::PinRange`.
   // Returns `ZX_ERR_OUT_RANGE` if the requested range does not fit within the pinned VMO.
   // Returns `ZX_ERR_BUFFER_TOO_SMALL` if all the necessary regions to cover the requested range
   // won't fit the provided buffer. In this case, `region_count_actual` contains the necessary
@@ -139,6 +181,9 @@ class StoredVmo {
   // appropriate for the intended use of the pinned regions.
   zx_status_t GetPinnedRegions(uint64_t offset, uint64_t len, fzl::PinnedVmo::Region* out_regions,
                                size_t region_count, size_t* region_count_actual) {
+    if (lazy_pin_) {
+      return GetLazilyPinnedRegions(offset, len, out_regions, region_count, region_count_actual);
+    }
     // Can't get regions if there aren't any or if indexing wasn't performed for more than 1
     // region.
     if (pinned_.region_count() == 0 || (pinned_.region_count() > 1 && !pinned_region_index_)) {
@@ -228,12 +273,69 @@ class StoredVmo {
   zx::vmo take_vmo() { return std::move(vmo_); }
 
  private:
+  // State for `PinLazily`.
+  struct LazyPin {
+    zx::unowned_bti bti;
+    uint32_t options;
+    uint64_t chunk_size;
+    uint64_t vmo_size;
+    // Allocated with one entry per chunk. A chunk is pinned if its `region_count` is non-zero.
+    std::unique_ptr<fzl::PinnedVmo[]> chunks;
+  };
+
+  // `GetPinnedRegions` for VMOs pinned with `PinLazily`.
+  zx_status_t GetLazilyPinnedRegions(uint64_t offset, uint64_t len,
+                                     fzl::PinnedVmo::Region* out_regions, size_t region_count,
+                                     size_t* region_count_actual) {
+    *region_count_actual = 0;
+    if (offset > lazy_pin_->vmo_size || len > lazy_pin_->vmo_size - offset) {
+      return ZX_ERR_OUT_OF_RANGE;
+    }
+    auto* out_end = out_regions + region_count;
+    while (len != 0) {
+      const uint64_t chunk_index = offset / lazy_pin_->chunk_size;
+      const uint64_t chunk_start = chunk_index * lazy_pin_->chunk_size;
+      fzl::PinnedVmo& chunk = lazy_pin_->chunks[chunk_index];
+      if (chunk.region_count() == 0) {
+        zx_status_t status = chunk.PinRange(
+            chunk_start, std::min(lazy_pin_->chunk_size, lazy_pin_->vmo_size - chunk_start), vmo_,
+            *lazy_pin_->bti, lazy_pin_->options);
+        if (status != ZX_OK) {
+          *region_count_actual = 0;
+          return status;
+        }
+      }
+      // A chunk holds at most one region per page, so walk its regions linearly.
+      uint64_t region_offset = offset - chunk_start;
+      for (uint32_t i = 0; i < chunk.region_count() && len != 0; i++) {
+        auto& region = chunk.region(i);
+        if (region_offset >= region.size) {
+          region_offset -= region.size;
+          continue;
+        }
+        uint64_t use_len = std::min(region.size - region_offset, len);
+        if (out_regions != out_end) {
+          out_regions->phys_addr = region.phys_addr + region_offset;
+          out_regions->size = use_len;
+          out_regions++;
+        }
+        (*region_count_actual)++;
+        offset += use_len;
+        len -= use_len;
+        region_offset = 0;
+      }
+    }
+    return *region_count_actual <= region_count ? ZX_OK : ZX_ERR_BUFFER_TOO_SMALL;
+  }
+
   zx::vmo vmo_;
   internal::MetaStorage<Meta> meta_;
   fzl::VmoMapper mapper_;
   fzl::PinnedVmo pinned_;
   // pinned_region_index_ is allocated with `pinned_.region_count()` entries.
   std::unique_ptr<uint64_t[]> pinned_region_index_;
+  // Only set for VMOs pinned with `PinLazily`.
+  std::unique_ptr<LazyPin> lazy_pin_;
   // Owner cookie. Set by `internal::VmoOwner`, used to provide ownership association.
   void* owner_cookie_ = nullptr;
 };
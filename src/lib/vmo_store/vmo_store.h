@@ -27,6 +27,10 @@ struct PinOptions {
   uint32_t bti_pin_options;
   // Index pinned pages for fast lookup. See `StoredVmo::Map` for more details.
   bool index;
+  // If non-zero, VMOs are not pinned on registration. Instead, chunks of `lazy_chunk_size` bytes
+  // are pinned the first time `StoredVmo::GetPinnedRegions` needs them, and reused until the VMO is
+  // unregistered. Must be a multiple of the page size. See `StoredVmo::PinLazily`.
+  uint64_t lazy_chunk_size = 0;
 };
 
 struct MapOptions {
@@ -198,7 +202,12 @@ class VmoStore : public VmoStoreBase<Backing> {
     }
     if (options_.pin) {
       const auto& pin_options = *options_.pin;
-      status = vmo->Pin(*pin_options.bti, pin_options.bti_pin_options, pin_options.index);
+      if (pin_options.lazy_chunk_size != 0) {
+        status = vmo->PinLazily(zx::unowned_bti(pin_options.bti), pin_options.bti_pin_options,
+                                pin_options.lazy_chunk_size);
+      } else {
+        status = vmo->Pin(*pin_options.bti, pin_options.bti_pin_options, pin_options.index);
+      }
       if (status != ZX_OK) {
         return status;
       }
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string_view>
+#include <utility>
 
 #include "storage-traits.h"
 
@@ -40,6 +41,61 @@ class OneShot {
     return DecompressImpl(dctx, out, payload);
   }
 
+  // A payload can be a sequence of independent frames, as `zbi
+  // --compress-frame-size` writes it.  Each frame records its own
+  // decompressed size, so once the frames have been split apart each one can
+  // be passed to Decompress separately along with its own part of the output
+  // buffer, e.g. to spread the work across several CPUs or to interleave it
+  // with other work.  Decompress on the whole payload still works too.
+  struct Frame {
+    ByteView payload;
+    size_t size;  // Decompressed size.
+  };
+
+  // Split the first frame off of the payload, updating it to leave only the
+  // remaining frames.  This fails if the frame is malformed or does not record
+  // its decompressed size.
+  static fit::result<std::string_view, Frame> SplitFrame(ByteView& payload);
+
+  // Decompress only the part of a payload that yields the decompressed bytes
+  // [offset, offset + out.size()).  Both ends of that range must fall on frame
+  // boundaries or the end of the payload.  When the payload was written with a
+  // frame size that's a multiple of the page size, any page-aligned range
+  // qualifies, so e.g. a pager serving a compressed BOOTFS image can
+  // decompress just the pages that are touched rather than the whole image.
+  // Frames before the range are skipped by reading only their headers.
+  template <typename Allocator>
+  static fit::result<std::string_view> DecompressRange(cpp20::span<std::byte> out,
+                                                       ByteView payload, size_t offset,
+                                                       Allocator&& allocator) {
+    while (offset > 0) {
+      auto frame = SplitFrame(payload);
+      if (frame.is_error()) {
+        return frame.take_error();
+      }
+      if (frame->size > offset) {
+        return fit::error{"decompression range does not start on a frame boundary"};
+      }
+      offset -= frame->size;
+    }
+
+    const ByteView frames = payload;
+    size_t size = 0;
+    while (size < out.size()) {
+      auto frame = SplitFrame(payload);
+      if (frame.is_error()) {
+        return frame.take_error();
+      }
+      size += frame->size;
+    }
+    if (size != out.size()) {
+      return fit::error{"decompression range does not end on a frame boundary"};
+    }
+
+    return Decompress(out, frames.subspan(0, frames.size() - payload.size()),
+                      std::forward<Allocator>(allocator));
+  }
+
  private:
   struct Context;  // Opaque.
 
@@ -46,16 +46,17 @@ fit::result<std::string_view, cpp20::span<std::byte>> Streaming::Decompress(
       return fit::error{std::string_view{ZSTD_getErrorName(result)}};
     }
 
-    // Finished decompressing and flushed all the output.
+    // Finished decompressing a frame and flushed all its output.  The payload
+    // may be a sequence of independent frames (see OneShot::SplitFrame), in
+    // which case ZSTD_decompressStream() starts on the next frame in the next
+    // iteration.  Anything but another valid frame after this one will be
+    // diagnosed then.  The scratch space was sized for the first frame's
+    // window, which all the frames in one payload are expected to share.
     if (result == 0) {
       ZX_ASSERT(in.pos <= in.size);
-      // While it is reasonable for ZSTD_decompressStream() to allow for midway
-      // end-of-stream indicators, the presence here in a payload indicates bad
-      // or corrupted data.
-      if (in.pos != in.size) {
-        return fit::error{"bad or corrupted data: end-of-stream indicator found too soon"};
+      if (in.pos == in.size) {
+        break;
       }
-      break;
     }
   } while (in.pos < in.size && out.pos < out.size);
 
@@ -6,6 +6,7 @@
 #include <zircon/assert.h>
 
 #include <functional>
+#include <limits>
 
 #include <zstd/zstd.h>
 
@@ -41,4 +42,25 @@ fit::result<std::string_view> OneShot::DecompressImpl(Context* ctx, cpp20::span<
   return fit::ok();
 }
 
+fit::result<std::string_view, OneShot::Frame> OneShot::SplitFrame(ByteView& payload) {
+  const size_t frame_size = ZSTD_findFrameCompressedSize(payload.data(), payload.size());
+  if (ZSTD_isError(frame_size)) {
+    return fit::error{std::string_view{ZSTD_getErrorName(frame_size)}};
+  }
+  ZX_DEBUG_ASSERT(frame_size <= payload.size());
+  const unsigned long long int content_size = ZSTD_getFrameContentSize(payload.data(), frame_size);
+  if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+    return fit::error{"bad or corrupted data: invalid frame header"sv};
+  }
+  if (content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+    return fit::error{"frame does not record its decompressed size"sv};
+  }
+  if (content_size > std::numeric_limits<size_t>::max()) {
+    return fit::error{"frame decompressed size is too large"sv};
+  }
+  Frame frame{payload.subspan(0, frame_size), static_cast<size_t>(content_size)};
+  payload = payload.subspan(frame_size);
+  return fit::ok(frame);
+}
+
 }  // namespace zbitl::decompress
@@ -102,6 +102,11 @@ class NoteHeader {
 
 constexpr std::byte kZeroBytes[NoteAlign() - 1] = {};
 
+// DumpMemory leaves pages that are all zero bytes out of the file.
+bool IsZeroPage(ByteView page) {
+  return std::all_of(page.begin(), page.end(), [](std::byte b) { return b == std::byte{}; });
+}
+
 // This returns a ByteView of as many zero bytes are needed for alignment
 // padding after the given ELF note payload data.
 constexpr ByteView PadForElfNote(ByteView data) {
@@ -840,6 +845,7 @@ class ProcessDump::Collector : public CollectorBase<ProcessRemarkClass> {
   // until all the data has been dumped, and the final `dump` callback's return
   // value will be the "success" return value.
   fit::result<Error, size_t> DumpMemory(DumpCallback dump, size_t limit) {
+    const size_t page_size = process_.get().dump_page_size();
     size_t offset = headers_size_bytes() + notes_size_bytes() + remarks_size_bytes();
     for (const auto& segment : phdrs_) {
       if (segment.type == elfldltl::ElfPhdrType::kLoad) {
@@ -857,19 +863,42 @@ class ProcessDump::Collector : public CollectorBase<ProcessRemarkClass> {
           // This yields some nonempty subset of the requested range, and
           // possibly more than requested.
           auto read =
-              process_.get().read_memory<std::byte, ByteView>(vaddr, size, ReadMemorySize::kLess);
+              process_.get().read_memory<std::byte, ByteView>(vaddr, left, ReadMemorySize::kLess);
           if (read.is_error()) {
             return read.take_error();
           }
 
           // Note the buffer is still owned by read.value().
-          ByteView chunk = read.value()->subspan(0, std::min(size, read.value()->size()));
+          ByteView chunk = read.value()->subspan(0, std::min(left, read.value()->size()));
           // TODO(mcgrathr): subset dump must be detected in layout phase
           ZX_DEBUG_ASSERT(!chunk.empty());
 
-          // Send it to the callback to write it out.
-          if (dump(offset, chunk)) {
-            return fit::ok(offset);
+          // Send it to the callback to write it out, but leave out whole pages
+          // of zeros.  The callback must accept offsets that skip ahead, and
+          // the writers seek over the gap to leave a hole in the file (or fill
+          // it with zeros when they can't seek).  The last page of each
+          // segment is always written so the file covers the whole segment.
+          const bool last_chunk = chunk.size() == left;
+          size_t pos = 0;
+          while (pos < chunk.size()) {
+            size_t run = 0;
+            while (pos + run < chunk.size()) {
+              const size_t start = pos + run;
+              ByteView page = chunk.subspan(start, std::min(page_size, chunk.size() - start));
+              const bool last_page = last_chunk && start + page.size() == chunk.size();
+              if (page.size() == page_size && !last_page && IsZeroPage(page)) {
+                break;
+              }
+              run += page.size();
+            }
+            if (run == 0) {
+              pos += page_size;
+              continue;
+            }
+            if (dump(offset + pos, chunk.subspan(pos, run))) {
+              return fit::ok(offset + pos);
+            }
+            pos += run;
           }
 
           vaddr += chunk.size();
@@ -10,7 +10,9 @@
 #include <zircon/assert.h>
 #include <zircon/syscalls.h>
 
+#include <algorithm>
 #include <cinttypes>
+#include <memory>
 
 #include "buffer-impl.h"
 
@@ -19,6 +21,15 @@ namespace {
 
 const size_t kPagesize = zx_system_get_page_size();
 
+// A ReadMemorySize::kLess read that spans at least this many pages doesn't go
+// through the page cache.  Instead, up to kBulkReadMaxSize bytes are read with
+// a single zx_process_read_memory call into a buffer of their own.  This is
+// the case for dumping memory segments, where the data is only looked at once
+// and caching it would just evict the pages that are worth keeping, e.g. for
+// ELF header and note reads that get repeated.
+constexpr size_t kBulkReadMinPages = 16;
+constexpr size_t kBulkReadMaxSize = 1 << 20;  // 1 MiB
+
 }  // namespace
 
 cpp20::span<const std::byte> TaskHolder::LiveMemoryCache::Page::contents() const {
@@ -134,6 +145,29 @@ fit::result<Error, Buffer<>> Process::LiveMemory::ReadLiveMemory(
   uint64_t first_page = vaddr & -kPagesize;
   uint64_t last_page = (vaddr + size - 1) & -kPagesize;
 
+  // A large read that can be satisfied piecemeal is done in bulk, unless its
+  // first page is already cached anyway.
+  if (size_mode == ReadMemorySize::kLess &&
+      (last_page - first_page) / kPagesize + 1 >= kBulkReadMinPages &&
+      cache_index_.find(first_page) == cache_index_.end()) {
+    const size_t bulk_size = std::min(last_page + kPagesize - first_page, kBulkReadMaxSize);
+    auto bulk = std::make_unique<internal::BufferImplVector>(bulk_size);
+    size_t bytes_read = 0;
+    zx_status_t status = process->read_memory(first_page, bulk->data(), bulk_size, &bytes_read);
+
+    // A failure or short read here might just mean that the range crossed
+    // into a part of the address space that can't be read.  Then this falls
+    // back to the single-page path below, which will either read that first
+    // page successfully or diagnose the error precisely.
+    if (status == ZX_OK && bytes_read > (vaddr - first_page)) {
+      bulk->resize(bytes_read);
+      Buffer<> buffer;
+      buffer.data_ = cpp20::span<const std::byte>(*bulk).subspan(vaddr - first_page);
+      buffer.impl_ = std::move(bulk);
+      return fit::ok(std::move(buffer));
+    }
+  }
+
   // Most reads will fit inside a single page.
   if (first_page == last_page || size_mode == ReadMemorySize::kLess) {
     auto result = read_one_page(vaddr & -kPagesize);
@@ -21,7 +21,9 @@ struct MixProfileConfig {
   // Mix profile capacity to process.
   zx::duration capacity = kDefaultCapacity;
 
-  // Mix profile deadline.
+  // Mix profile deadline. Output devices wake this far before the hardware would read unmixed
+  // frames, since the mix thread is guaranteed `capacity` within this window. A deadline shorter
+  // than the period therefore lowers the output lead time.
   zx::duration deadline = kDefaultDeadline;
 
   // Mix profile period.
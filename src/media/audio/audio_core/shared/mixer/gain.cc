@@ -6,6 +6,9 @@
 
 #include <lib/trace/event.h>
 
+#include <algorithm>
+#include <optional>
+
 #include "src/media/audio/audio_core/shared/mixer/logging_flags.h"
 #include "src/media/audio/lib/processing/gain.h"
 
@@ -106,28 +109,48 @@ void Gain::Control::Advance(int64_t num_frames,
   }
 }
 
-void Gain::Control::AccumulateScaleArrayForRamp(
-    AScale* scale_arr, int64_t num_frames,
-    const TimelineRate& destination_frames_per_reference_tick) const {
-  FX_CHECK(IsRamping());
+Gain::Control::RampIterator::RampIterator(
+    const Control& control, const TimelineRate& destination_frames_per_reference_tick)
+    : start_scale_(control.ramp_start_scale_),
+      end_scale_((control.ramp_end_scale_ <= media_audio::kMinGainScale)
+                     ? kMuteScale
+                     : control.ramp_end_scale_),
+      ramp_duration_nsecs_(control.ramp_duration_.to_nsecs()),
+      inverse_ramp_duration_(1.0f / static_cast<float>(control.ramp_duration_.to_nsecs())) {
+  FX_CHECK(control.IsRamping());
+
+  // Frame `n` of the ramp starts at `n * output_to_local` nsecs, truncated.
+  const TimelineRate output_to_local = destination_frames_per_reference_tick.Inverse();
+  denominator_ = output_to_local.reference_delta();
+  step_ = output_to_local.subject_delta() / denominator_;
+  step_remainder_ = output_to_local.subject_delta() % denominator_;
+
+  const unsigned __int128 start_product =
+      static_cast<unsigned __int128>(control.frames_ramped_so_far_) *
+      output_to_local.subject_delta();
+  const unsigned __int128 start_time = start_product / denominator_;
+  remainder_ = static_cast<uint64_t>(start_product % denominator_);
+  // A start time past the end of the ramp only needs to compare as such.
+  frame_time_ = static_cast<int64_t>(
+      std::min(start_time, static_cast<unsigned __int128>(ramp_duration_nsecs_)));
+}
 
-  TimelineRate output_to_local = destination_frames_per_reference_tick.Inverse();
+Gain::AScale Gain::Control::RampIterator::Next() {
+  if (frame_time_ >= ramp_duration_nsecs_) {
+    return end_scale_;
+  }
 
-  const auto start_scale = ramp_start_scale_;
-  const auto end_scale =
-      (ramp_end_scale_ <= media_audio::kMinGainScale) ? kMuteScale : ramp_end_scale_;
-  const float inverse_source_ramp_duration = 1.0f / static_cast<float>(ramp_duration_.to_nsecs());
+  const auto ramp_fraction = static_cast<float>(frame_time_) * inverse_ramp_duration_;
+  const auto scale_factor = start_scale_ + (end_scale_ - start_scale_) * ramp_fraction;
 
-  for (int64_t idx = 0; idx < num_frames; ++idx) {
-    zx::duration frame_time = zx::nsec(output_to_local.Scale(frames_ramped_so_far_ + idx));
-    if (frame_time >= ramp_duration_) {
-      scale_arr[idx] *= end_scale;
-    } else {
-      auto ramp_fraction = static_cast<float>(frame_time.to_nsecs()) * inverse_source_ramp_duration;
-      auto scale_factor = start_scale + (end_scale - start_scale) * ramp_fraction;
-      scale_arr[idx] *= (scale_factor <= media_audio::kMinGainScale) ? kMuteScale : scale_factor;
-    }
+  frame_time_ += static_cast<int64_t>(step_);
+  remainder_ += step_remainder_;
+  if (remainder_ >= denominator_) {
+    remainder_ -= denominator_;
+    ++frame_time_;
   }
+
+  return (scale_factor <= media_audio::kMinGainScale) ? kMuteScale : scale_factor;
 }
 
 Gain::AScale Gain::CalculateScaleArray(AScale* scale_arr, int64_t num_frames,
@@ -149,69 +172,50 @@ Gain::AScale Gain::CalculateScaleArray(AScale* scale_arr, int64_t num_frames,
     return GetUnadjustedGainScale();
   }
 
-  // Accumulate from Source.
+  // Every control contributes either a constant or a ramp. Combine them, track the max and apply
+  // the limits in a single pass over `scale_arr`.
+  std::optional<Control::RampIterator> source_ramp;
+  std::optional<Control::RampIterator> dest_ramp;
+  std::optional<Control::RampIterator> adjustment_ramp;
+  AScale source_scale = media_audio::kUnityGainScale;
+  AScale dest_scale = media_audio::kUnityGainScale;
+  AScale adjustment_scale = media_audio::kUnityGainScale;
   if (source_.IsRamping()) {
-    // Since there is no prior gain control, start with 1.0.
-    for (int64_t idx = 0; idx < num_frames; ++idx) {
-      scale_arr[idx] = 1.0f;
-    }
-    source_.AccumulateScaleArrayForRamp(scale_arr, num_frames,
-                                        destination_frames_per_reference_tick);
+    source_ramp.emplace(source_, destination_frames_per_reference_tick);
   } else {
-    auto db = source_.GainDb();
-    auto scale = media_audio::DbToScale(db);
-    for (int64_t idx = 0; idx < num_frames; ++idx) {
-      scale_arr[idx] = scale;
-    }
+    source_scale = media_audio::DbToScale(source_.GainDb());
   }
-
-  // Accumulate from Dest.
   if (dest_.IsRamping()) {
-    dest_.AccumulateScaleArrayForRamp(scale_arr, num_frames, destination_frames_per_reference_tick);
+    dest_ramp.emplace(dest_, destination_frames_per_reference_tick);
   } else {
-    auto db = dest_.GainDb();
-    auto scale = media_audio::DbToScale(db);
-    if (scale != 1.0f) {
-      for (int64_t idx = 0; idx < num_frames; ++idx) {
-        scale_arr[idx] *= scale;
-      }
-    }
+    dest_scale = media_audio::DbToScale(dest_.GainDb());
+  }
+  if (adjustment_.IsRamping()) {
+    adjustment_ramp.emplace(adjustment_, destination_frames_per_reference_tick);
+  } else {
+    adjustment_scale = media_audio::DbToScale(adjustment_.GainDb());
   }
 
-  // Compute the max of the combination of source and dest.
+  // The max is of the combination of source and dest, without the adjustment.
   AScale max_scale = kMuteScale;
   for (int64_t idx = 0; idx < num_frames; ++idx) {
-    max_scale = std::max(max_scale, scale_arr[idx]);
+    AScale scale = source_ramp ? source_ramp->Next() : source_scale;
+    scale *= dest_ramp ? dest_ramp->Next() : dest_scale;
+    max_scale = std::max(max_scale, scale);
+    scale *= adjustment_ramp ? adjustment_ramp->Next() : adjustment_scale;
+
+    // Apply gain limits and normalize sub-kMinScale values to kMuteScale.
+    scale_arr[idx] = (scale > media_audio::kMinGainScale)
+                         ? std::clamp(scale, min_gain_scale_, max_gain_scale_)
+                         : kMuteScale;
   }
+
   if (max_scale > media_audio::kMinGainScale) {
     max_scale = std::clamp(max_scale, min_gain_scale_, max_gain_scale_);
   } else {
     max_scale = kMuteScale;
   }
 
-  // Accumulate from adjustment.
-  if (adjustment_.IsRamping()) {
-    adjustment_.AccumulateScaleArrayForRamp(scale_arr, num_frames,
-                                            destination_frames_per_reference_tick);
-  } else {
-    auto db = adjustment_.GainDb();
-    auto scale = media_audio::DbToScale(db);
-    if (scale != 1.0f) {
-      for (int64_t idx = 0; idx < num_frames; ++idx) {
-        scale_arr[idx] *= scale;
-      }
-    }
-  }
-
-  // Apply gain limits and normalize sub-kMinScale values to kMuteScale.
-  for (int64_t idx = 0; idx < num_frames; ++idx) {
-    if (scale_arr[idx] > media_audio::kMinGainScale) {
-      scale_arr[idx] = std::clamp(scale_arr[idx], min_gain_scale_, max_gain_scale_);
-    } else {
-      scale_arr[idx] = 0.0f;
-    }
-  }
-
   return max_scale;
 }
 
@@ -217,10 +217,31 @@ class Gain {
 
     void Advance(int64_t num_frames, const TimelineRate& rate);
 
-    // Caller must fill scale_arr with initial values (e.g. 1.0). The Control must be ramping.
-    void AccumulateScaleArrayForRamp(
-        AScale* scale_arr, int64_t num_frames,
-        const TimelineRate& destination_frames_per_reference_tick) const;
+    // Produces this Control's ramp scale for successive destination frames, starting at the
+    // current ramp position. The ramp time of each frame is stepped exactly from the previous one,
+    // rather than scaling every frame position by the rate. The Control must be ramping.
+    class RampIterator {
+     public:
+      RampIterator(const Control& control,
+                   const TimelineRate& destination_frames_per_reference_tick);
+
+      // Returns the scale for the next frame.
+      AScale Next();
+
+     private:
+      const AScale start_scale_;
+      const AScale end_scale_;
+      const int64_t ramp_duration_nsecs_;
+      const float inverse_ramp_duration_;
+
+      // The current frame's time within the ramp is `frame_time_ + remainder_ / denominator_`
+      // nsecs, and each frame advances it by `step_ + step_remainder_ / denominator_`.
+      int64_t frame_time_;
+      uint64_t remainder_;
+      uint64_t step_;
+      uint64_t step_remainder_;
+      uint64_t denominator_;
+    };
 
    private:
     // For debugging only.
@@ -1465,5 +1465,33 @@ TEST(GainLimitsTest, GainScaleArrayRespectsMaxWhenNotRamping) {
   EXPECT_FALSE(gain.IsRamping());
 }
 
+// At rates that don't divide a second evenly, every frame of the scale array must still use the
+// same (truncated) ramp time as scaling its frame position by the rate would.
+TEST(GainRampTest, ScaleArrayAtNonIntegralFramePeriod) {
+  const TimelineRate rate_44k(44100, ZX_SEC(1));
+  constexpr int64_t kFramesAdvanced = 100;
+  constexpr auto kRampDuration = zx::msec(10);
+  Gain::AScale scale_arr[480];
+
+  Gain gain;
+  gain.SetSourceGainWithRamp(-20.0f, kRampDuration);
+  gain.Advance(kFramesAdvanced, rate_44k);
+  gain.CalculateScaleArray(scale_arr, std::size(scale_arr), rate_44k);
+
+  const float start_scale = media_audio::kUnityGainScale;
+  const float end_scale = media_audio::DbToScale(-20.0f);
+  const float inverse_duration = 1.0f / static_cast<float>(kRampDuration.to_nsecs());
+  const TimelineRate output_to_local = rate_44k.Inverse();
+  for (int64_t idx = 0; idx < static_cast<int64_t>(std::size(scale_arr)); ++idx) {
+    const int64_t frame_time = output_to_local.Scale(kFramesAdvanced + idx);
+    const float expect =
+        (frame_time >= kRampDuration.to_nsecs())
+            ? end_scale
+            : start_scale + (end_scale - start_scale) * static_cast<float>(frame_time) *
+                                inverse_duration;
+    EXPECT_FLOAT_EQ(scale_arr[idx], expect) << idx;
+  }
+}
+
 }  // namespace
 }  // namespace media::audio
@@ -84,6 +84,8 @@ class OutputDeviceNop : public Reporter::OutputDevice {
                     std::optional<zx::duration> external_delay) override {}
   void DeviceUnderflow(zx::time start_time, zx::time end_time) override {}
   void PipelineUnderflow(zx::time start_time, zx::time end_time) override {}
+  void MixJob(zx::duration duration) override {}
+  void SetMixerLeadTime(zx::duration lead_time) override {}
 };
 
 class InputDeviceNop : public Reporter::InputDevice {
@@ -731,7 +733,12 @@ class Reporter::OutputDeviceImpl : public Reporter::OutputDevice {
                 .is_underflow = true,
                 .cobalt_component_id =
                     AudioSessionDurationMigratedMetricDimensionComponent::OutputPipeline,
-            })) {
+            })),
+        mixer_lead_time_(node_.CreateUint("mixer lead time (ns)", 0)),
+        mix_jobs_node_(node_.CreateChild("mix jobs")),
+        mix_job_count_(mix_jobs_node_.CreateUint("count", 0)),
+        mix_job_total_duration_(mix_jobs_node_.CreateUint("total duration (ns)", 0)),
+        mix_job_max_duration_(mix_jobs_node_.CreateUint("max duration (ns)", 0)) {
     time_since_death_ = node_.CreateLazyValues("OutputDeviceTimeSinceDeath", [this] {
       inspect::Inspector i;
       i.GetRoot().CreateUint(
@@ -773,6 +780,17 @@ class Reporter::OutputDeviceImpl : public Reporter::OutputDevice {
     pipeline_underflows_->Report(start_time, end_time);
   }
 
+  void MixJob(zx::duration duration) override {
+    mix_job_count_.Add(1);
+    mix_job_total_duration_.Add(duration.get());
+    if (duration > max_mix_job_duration_) {
+      max_mix_job_duration_ = duration;
+      mix_job_max_duration_.Set(duration.get());
+    }
+  }
+
+  void SetMixerLeadTime(zx::duration lead_time) override { mixer_lead_time_.Set(lead_time.get()); }
+
  private:
   inspect::Node node_;
   inspect::LazyNode time_since_death_;
@@ -781,6 +799,12 @@ class Reporter::OutputDeviceImpl : public Reporter::OutputDevice {
   DeviceGainInfo gain_info_;
   std::unique_ptr<OverflowUnderflowTracker> device_underflows_;
   std::unique_ptr<OverflowUnderflowTracker> pipeline_underflows_;
+  inspect::UintProperty mixer_lead_time_;
+  inspect::Node mix_jobs_node_;
+  inspect::UintProperty mix_job_count_;
+  inspect::UintProperty mix_job_total_duration_;
+  inspect::UintProperty mix_job_max_duration_;
+  zx::duration max_mix_job_duration_;  // Needed because we cannot compare based on the prop.
   std::optional<zx::time> time_of_death_;
 };
 
@@ -90,6 +90,11 @@ class Reporter {
    public:
     virtual void DeviceUnderflow(zx::time start_time, zx::time end_time) = 0;
     virtual void PipelineUnderflow(zx::time start_time, zx::time end_time) = 0;
+
+    // Records the wall-clock duration of one mix job, for comparison against the mix profile.
+    virtual void MixJob(zx::duration duration) = 0;
+    // Records how far ahead of the hardware the mixer fills the ring buffer.
+    virtual void SetMixerLeadTime(zx::duration lead_time) = 0;
   };
 
   class InputDevice : public Device {};
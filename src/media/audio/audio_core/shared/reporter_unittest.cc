@@ -227,7 +227,8 @@ TEST_F(ReporterTest, DeviceMetrics) {
                 ChildrenMatch(UnorderedElementsAre(AllOf(
                     NodeMatches(AllOf(NameMatches("output_device"),
                                       PropertyList(UnorderedElementsAre(
-                                          StringIs("mixer thread name", "output_thread"))))),
+                                          StringIs("mixer thread name", "output_thread"),
+                                          UintIs("mixer lead time (ns)", 0))))),
                     ChildrenMatch(UnorderedElementsAre(
                         NodeMatches(AllOf(NameMatches("driver"),
                                           PropertyList(UnorderedElementsAre(
@@ -256,7 +257,11 @@ TEST_F(ReporterTest, DeviceMetrics) {
                         NodeMatches(AllOf(NameMatches("pipeline underflows"),
                                           PropertyList(UnorderedElementsAre(
                                               UintIs("count", 0), UintIs("duration (ns)", 0),
-                                              UintIs("session count", 0))))))))))),
+                                              UintIs("session count", 0))))),
+                        NodeMatches(AllOf(NameMatches("mix jobs"),
+                                          PropertyList(UnorderedElementsAre(
+                                              UintIs("count", 0), UintIs("total duration (ns)", 0),
+                                              UintIs("max duration (ns)", 0))))))))))),
           AllOf(NodeMatches(NameMatches("input devices")),
                 ChildrenMatch(UnorderedElementsAre(AllOf(
                     NodeMatches(AllOf(NameMatches("input_device"),
@@ -315,6 +320,10 @@ TEST_F(ReporterTest, DeviceMetrics) {
   output_device->DeviceUnderflow(zx::time(91), zx::time(92));
   output_device->PipelineUnderflow(zx::time(93), zx::time(96));
   output_device->StopSession(zx::time(100));
+  output_device->SetMixerLeadTime(zx::msec(20));
+  output_device->MixJob(zx::usec(300));
+  output_device->MixJob(zx::usec(700));
+  output_device->MixJob(zx::usec(500));
 
   EXPECT_THAT(
       GetHierarchy(),
@@ -329,7 +338,16 @@ TEST_F(ReporterTest, DeviceMetrics) {
                   NameMatches("pipeline underflows"),
                   PropertyList(UnorderedElementsAre(UintIs("count", 1), UintIs("duration (ns)", 3),
                                                     UintIs("session count", 2))))),
+              NodeMatches(AllOf(NameMatches("mix jobs"),
+                                PropertyList(UnorderedElementsAre(
+                                    UintIs("count", 3), UintIs("total duration (ns)", 1'500'000),
+                                    UintIs("max duration (ns)", 700'000))))),
           }))))))));
+  EXPECT_THAT(GetHierarchy(),
+              ChildrenMatch(Contains(AllOf(
+                  NodeMatches(NameMatches("output devices")),
+                  ChildrenMatch(Contains(NodeMatches(PropertyList(
+                      Contains(UintIs("mixer lead time (ns)", zx::msec(20).get()))))))))));
 }
 
 // Test method Device::SetGainInfo.
@@ -344,7 +362,8 @@ TEST_F(ReporterTest, DeviceSetGainInfo) {
                 ChildrenMatch(UnorderedElementsAre(AllOf(
                     NodeMatches(AllOf(NameMatches("output_device"),
                                       PropertyList(UnorderedElementsAre(
-                                          StringIs("mixer thread name", "output_thread"))))),
+                                          StringIs("mixer thread name", "output_thread"),
+                                          UintIs("mixer lead time (ns)", 0))))),
                     ChildrenMatch(Contains(NodeMatches(AllOf(
                         NameMatches("device gain"),
                         PropertyList(UnorderedElementsAre(
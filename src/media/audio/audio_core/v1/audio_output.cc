@@ -67,7 +67,8 @@ void AudioOutput::Process() {
     StageMetricsTimer timer("AudioOutput::Process");
     timer.Start();
 
-    if (auto mix_frames = StartMixJob(ref_now); mix_frames) {
+    auto mix_frames = StartMixJob(ref_now);
+    if (mix_frames) {
       ProcessMixJob(ctx, *mix_frames);
       FinishMixJob(*mix_frames);
     } else {
@@ -76,7 +77,11 @@ void AudioOutput::Process() {
     }
 
     auto mono_end = async::Now(mix_domain().dispatcher());
-    if (auto dt = mono_end - mono_now; dt > MixDeadline()) {
+    auto dt = mono_end - mono_now;
+    if (mix_frames && reporter_) {
+      reporter_.value()->MixJob(dt);
+    }
+    if (dt > MixDeadline()) {
       timer.Stop();
       TRACE_INSTANT("audio", "AudioOutput::MIX_UNDERFLOW", TRACE_SCOPE_THREAD);
       TRACE_ALERT("audio", "audiounderflow");
@@ -187,6 +187,46 @@ TEST_F(AudioRendererTestSyntheticClocks, AllocatePacketQueueForLinks) {
   }
 }
 
+TEST_F(AudioRendererTestSyntheticClocks, RingBufferReplacesPacketQueue) {
+  auto renderer = renderer_;
+  context().route_graph().AddRenderer(std::move(renderer_));
+  context().route_graph().AddDeviceToRoutes(fake_output_.get());
+
+  fidl_renderer_->SetPcmStreamType(PcmStreamType());
+  RunLoopUntilIdle();
+
+  constexpr int64_t kRingFrames = kAudioRendererUnittestVmoSize / sizeof(float);
+  auto ring = static_cast<float*>(vmo_mapper_.start());
+  for (int64_t frame = 0; frame < kRingFrames; ++frame) {
+    ring[frame] = static_cast<float>(frame);
+  }
+  zx::vmo duplicate;
+  ASSERT_EQ(ZX_OK, vmo_.duplicate(ZX_RIGHT_SAME_RIGHTS, &duplicate));
+  renderer->SetRingBuffer(std::move(duplicate), kRingFrames);
+  fidl_renderer_->PlayNoReply(fuchsia::media::NO_TIMESTAMP, 0);
+  RunLoopUntilIdle();
+
+  std::vector<LinkMatrix::LinkHandle> links;
+  context().link_matrix().SourceLinks(*fake_output_, &links);
+  ASSERT_EQ(1u, links.size());
+  auto stream = links[0].stream;
+  ASSERT_TRUE(stream);
+
+  // Playback starts in the future, so the whole ring, from frame 0 on, is readable.
+  {
+    auto buffer = stream->ReadLock(rlctx, Fixed(16), 16);
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(buffer->start().Floor(), 16);
+    EXPECT_EQ(buffer->length(), 16);
+    EXPECT_EQ(static_cast<float*>(buffer->payload())[0], 16.0f);
+    EXPECT_TRUE(buffer->usage_mask().contains(StreamUsage::WithRenderUsage(RenderUsage::MEDIA)));
+  }
+
+  // Once the presentation frame has passed these frames, the client may have overwritten them.
+  context().clock_factory()->AdvanceMonoTimeBy(zx::sec(1));
+  EXPECT_FALSE(stream->ReadLock(rlctx, Fixed(32), 16));
+}
+
 TEST_F(AudioRendererTestSyntheticClocks, SendPacket_NO_TIMESTAMP) {
   context().route_graph().AddRenderer(std::move(renderer_));
   context().route_graph().AddDeviceToRoutes(fake_output_.get());
@@ -74,6 +74,16 @@ fpromise::result<std::shared_ptr<ReadableStream>, zx_status_t> BaseRenderer::Ini
     const AudioObject& dest) {
   TRACE_DURATION("audio", "BaseRenderer::InitializeDestLink");
 
+  auto stream_usage = usage();
+  FX_DCHECK(stream_usage) << "A renderer cannot be linked without a usage";
+
+  if (ring_buffer_) {
+    auto stream = ring_buffer_->Dup();
+    stream->set_usage(*stream_usage);
+    ring_buffer_streams_.insert({&dest, stream});
+    return fpromise::ok(std::move(stream));
+  }
+
   // The PacketQueue uses our same clock.
   auto queue =
       std::make_shared<PacketQueue>(*format(), reference_clock_to_fractional_frames_, clock_);
@@ -82,8 +92,6 @@ fpromise::result<std::shared_ptr<ReadableStream>, zx_status_t> BaseRenderer::Ini
     auto now = zx::clock::get_monotonic();
     reporter_->PacketQueueUnderflow(now - underflow_duration, now);
   });
-  auto stream_usage = usage();
-  FX_DCHECK(stream_usage) << "A renderer cannot be linked without a usage";
   queue->set_usage(*stream_usage);
   packet_queues_.insert({&dest, queue});
   return fpromise::ok(std::move(queue));
@@ -91,6 +99,11 @@ fpromise::result<std::shared_ptr<ReadableStream>, zx_status_t> BaseRenderer::Ini
 
 void BaseRenderer::CleanupDestLink(const AudioObject& dest) {
   TRACE_DURATION("audio", "BaseRenderer::CleanupDestLink");
+  // Ring buffer streams read the client's memory directly, so there is nothing to flush.
+  if (ring_buffer_streams_.erase(&dest)) {
+    return;
+  }
+
   auto it = packet_queues_.find(&dest);
   FX_DCHECK(it != packet_queues_.end());
   auto queue = std::move(it->second);
@@ -116,6 +129,9 @@ void BaseRenderer::RecomputeMinLeadTime() {
   for (const auto& [_, packet_queue] : packet_queues_) {
     cur_lead_time = std::max(cur_lead_time, packet_queue->GetPresentationDelay());
   }
+  for (const auto& [_, stream] : ring_buffer_streams_) {
+    cur_lead_time = std::max(cur_lead_time, stream->GetPresentationDelay());
+  }
 
   if constexpr (kLogPresentationDelay) {
     FX_LOGS(INFO) << "    (" << this << ") " << __FUNCTION__ << " calculated "
@@ -139,6 +155,11 @@ void BaseRenderer::RecomputeMinLeadTime() {
 bool BaseRenderer::IsOperating() {
   TRACE_DURATION("audio", "BaseRenderer::IsOperating");
 
+  // A ring buffer is always full as far as we can tell, so it is operating while playing.
+  if (ring_buffer_ && IsPlaying()) {
+    return true;
+  }
+
   for (const auto& [_, packet_queue] : packet_queues_) {
     // If the packet queue is not empty then this link _is_ operating.
     if (!packet_queue->empty()) {
@@ -154,7 +175,7 @@ bool BaseRenderer::ValidateConfig() {
     return true;
   }
 
-  if (!format_valid() || payload_buffers_.empty()) {
+  if (!format_valid() || (payload_buffers_.empty() && !ring_buffer_)) {
     return false;
   }
 
@@ -315,6 +336,64 @@ void BaseRenderer::RemovePayloadBufferInternal(uint32_t id) {
   cleanup.cancel();
 }
 
+void BaseRenderer::SetRingBuffer(zx::vmo ring_buffer, int64_t frame_count) {
+  TRACE_DURATION("audio", "BaseRenderer::SetRingBuffer", "frame_count", frame_count);
+  auto cleanup = fit::defer([this]() { context_.route_graph().RemoveRenderer(*this); });
+
+  if (IsOperating()) {
+    FX_LOGS(ERROR) << "Attempted to set ring buffer while in operational mode.";
+    return;
+  }
+  if (!format_valid()) {
+    FX_LOGS(ERROR) << "Attempted to set ring buffer before setting the format.";
+    return;
+  }
+  if (frame_count <= 0 || frame_count > Fixed::Max().Floor()) {
+    FX_LOGS(ERROR) << "Invalid ring buffer frame count (" << frame_count << ")";
+    return;
+  }
+
+  zx_info_vmo_t info;
+  zx_status_t status = ring_buffer.get_info(ZX_INFO_VMO, &info, sizeof(info), nullptr, nullptr);
+  if (status != ZX_OK) {
+    FX_PLOGS(ERROR, status) << "Failed to get ring buffer info";
+    return;
+  }
+
+  // As with payload buffers, shrinking a mapped VMO could crash us.
+  if ((info.flags & ZX_INFO_VMO_RESIZABLE) != 0) {
+    FX_LOGS(ERROR) << "Resizable ring buffers not supported";
+    return;
+  }
+  if (static_cast<uint64_t>(frame_count) * format()->bytes_per_frame() > info.size_bytes) {
+    FX_LOGS(ERROR) << "Ring buffer of " << frame_count << " frames does not fit in a VMO of "
+                   << info.size_bytes << " bytes";
+    return;
+  }
+
+  // The client owns the frames from the current presentation frame to a ring's length beyond it.
+  auto safe_read_frame = [timeline = reference_clock_to_fractional_frames_, clock = clock_,
+                          frame_count]() {
+    auto [ref_time_to_frac_frame, _] = timeline->get();
+    return Fixed::FromRaw(ref_time_to_frac_frame.Apply(clock->now().get())).Floor() +
+           frame_count - 1;
+  };
+  ring_buffer_ = BaseRingBuffer::CreateReadableHardwareBuffer(
+      *format(), reference_clock_to_fractional_frames_, clock_, std::move(ring_buffer),
+      frame_count, std::move(safe_read_frame));
+
+  // Replace the PacketQueues of any existing links with ring buffer streams.
+  if (auto stream_usage = usage(); stream_usage) {
+    context_.route_graph().SetRendererRoutingProfile(
+        *this, {.routable = false, .usage = *stream_usage});
+    context_.route_graph().SetRendererRoutingProfile(
+        *this, {.routable = true, .usage = *stream_usage});
+  }
+
+  InvalidateConfiguration();
+  cleanup.cancel();
+}
+
 void BaseRenderer::SetPtsUnits(uint32_t tick_per_second_numerator,
                                uint32_t tick_per_second_denominator) {
   TRACE_DURATION("audio", "BaseRenderer::SetPtsUnits");
@@ -435,6 +514,11 @@ void BaseRenderer::SendPacketInternal(fuchsia::media::StreamPacket packet,
     return;
   }
 
+  if (ring_buffer_) {
+    FX_LOGS(ERROR) << "SendPacket is not supported in ring buffer mode";
+    return;
+  }
+
   // Lookup our payload buffer.
   auto it = payload_buffers_.find(packet.payload_buffer_id);
   if (it == payload_buffers_.end()) {
@@ -22,6 +22,7 @@
 #include "src/media/audio/audio_core/v1/context.h"
 #include "src/media/audio/audio_core/v1/link_matrix.h"
 #include "src/media/audio/audio_core/v1/packet_queue.h"
+#include "src/media/audio/audio_core/v1/ring_buffer.h"
 #include "src/media/audio/audio_core/v1/route_graph.h"
 #include "src/media/audio/audio_core/v1/utils.h"
 #include "src/media/audio/lib/analysis/dropout.h"
@@ -65,6 +66,16 @@ class BaseRenderer : public AudioObject,
 
   std::shared_ptr<Clock> reference_clock() { return clock_; }
 
+  // Switches this renderer from packets to a client-written ring buffer of |frame_count| frames in
+  // the renderer's format. Frame N of the renderer's timeline (as established by Play) lives at
+  // ring offset N % |frame_count|, and the ring is read as if it holds the |frame_count| frames
+  // starting at the current presentation frame. The client keeps the ring written at least the
+  // min lead time ahead of that frame, so no per-packet messages are needed. The format must be
+  // set first, and SendPacket is an error once this mode is enabled.
+  //
+  // TODO(https://fxbug.dev/42086172): Expose this through fuchsia.media.AudioRenderer.
+  void SetRingBuffer(zx::vmo ring_buffer, int64_t frame_count);
+
  protected:
   BaseRenderer(fidl::InterfaceRequest<fuchsia::media::AudioRenderer> audio_renderer_request,
                Context* context);
@@ -170,6 +181,11 @@ class BaseRenderer : public AudioObject,
   std::unordered_map<const AudioObject*, std::shared_ptr<PacketQueue>> packet_queues_;
   Packet::Allocator packet_allocator_;
 
+  // Ring-buffer mode state. When |ring_buffer_| is set, each link reads a duplicate of it instead
+  // of a PacketQueue.
+  std::shared_ptr<ReadableRingBuffer> ring_buffer_;
+  std::unordered_map<const AudioObject*, std::shared_ptr<ReadableRingBuffer>> ring_buffer_streams_;
+
   WavWriter<kEnableRendererWavWriters> wav_writer_;
   Reporter::Container<Reporter::Renderer, Reporter::kObjectsToCache>::Ptr reporter_;
   size_t continuity_underflow_count_ = 0;
@@ -76,7 +76,7 @@ DriverOutput::DriverOutput(const std::string& name, const DeviceConfig& config,
                            EffectsLoaderV2* effects_loader_v2)
     : AudioOutput(name, config, threading_model, registry, link_matrix, std::move(clock_factory),
                   effects_loader_v2, std::make_unique<AudioDriver>(this)),
-      low_water_duration_(mix_profile_config.period),
+      low_water_duration_(std::min(mix_profile_config.deadline, mix_profile_config.period)),
       high_water_duration_(low_water_duration_ + mix_profile_config.period),
       initial_stream_channel_(channel.TakeChannel()) {}
 
@@ -603,6 +603,7 @@ void DriverOutput::OnDriverStartComplete() {
       .emplace(Reporter::Singleton().CreateOutputDevice(
           DeviceUniqueIdToString(this->driver()->persistent_unique_id()), mix_domain().name()))
       ->SetDriverInfo(driver()->info_for_reporter());
+  reporter().value()->SetMixerLeadTime(high_water_duration_);
 
   // Set up the mix task in the AudioOutput.
   //
@@ -94,8 +94,9 @@ class DriverOutput : public AudioOutput {
   // `DriverOutput` knows where the audio hardware is currently reading in the ring buffer. It sets
   // a timer to awaken when the amount of unread audio reaches the "low-water" amount, then requests
   // enough mixed data from its upstream pipeline to fill the ring buffer to the "high-water" level.
-  // It can take as long as an entire mix profile period for the thread to be scheduled and mix the
-  // needed audio into the ring buffer.
+  // The mix thread runs with a deadline profile, so once woken it is guaranteed to have been
+  // scheduled and to have mixed the needed audio within the profile's deadline. The low-water
+  // amount is that deadline, and each job mixes a further profile period beyond it.
   zx::duration low_water_duration_;
   zx::duration high_water_duration_;
 
@@ -4,8 +4,11 @@
 
 #include "src/media/audio/audio_core/v1/effects_stage_v1.h"
 
+#include <mutex>
+
 #include <fbl/algorithm.h>
 
+#include "src/lib/fxl/synchronization/thread_annotations.h"
 #include "src/media/audio/audio_core/shared/logging_flags.h"
 #include "src/media/audio/audio_core/shared/mixer/intersect.h"
 #include "src/media/audio/audio_core/v1/silence_padding_stream.h"
@@ -40,12 +43,21 @@ constexpr uint32_t kSupportedUsageMask =
                      StreamUsage::WithRenderUsage(RenderUsage::SYSTEM_AGENT)})
         .mask();
 
+// Each effects library is loaded once per process and shared by every EffectsStageV1 that uses
+// it, rather than being loaded and queried again for each output's pipeline. Pipelines are
+// created on their output's mix thread, so loads are serialized by `mutex_`.
 class MultiLibEffectsLoader {
  public:
+  static MultiLibEffectsLoader& Get() {
+    static auto* loader = new MultiLibEffectsLoader;
+    return *loader;
+  }
+
   EffectV1 CreateEffectByName(std::string_view lib_name, std::string_view effect_name,
                               std::string_view instance_name, uint32_t frame_rate,
                               uint16_t channels_in, uint16_t channels_out,
                               std::string_view config) {
+    std::lock_guard<std::mutex> lock(mutex_);
     auto it = std::find_if(holders_.begin(), holders_.end(),
                            [lib_name](auto& holder) { return holder.lib_name == lib_name; });
     if (it == holders_.end()) {
@@ -71,7 +83,8 @@ class MultiLibEffectsLoader {
     std::string lib_name;
     std::unique_ptr<EffectsLoaderV1> loader;
   };
-  std::vector<Holder> holders_;
+  std::mutex mutex_;
+  std::vector<Holder> holders_ FXL_GUARDED_BY(mutex_);
 };
 
 }  // namespace
@@ -88,7 +101,7 @@ std::shared_ptr<EffectsStageV1> EffectsStageV1::Create(
 
   auto processor = std::make_unique<EffectsProcessorV1>();
 
-  MultiLibEffectsLoader loader;
+  auto& loader = MultiLibEffectsLoader::Get();
   uint32_t frame_rate = source->format().frames_per_second();
   uint16_t channels_in = source->format().channels();
   for (const auto& effect_spec : effects) {
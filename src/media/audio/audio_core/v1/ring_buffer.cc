@@ -283,7 +283,7 @@ std::optional<ReadableStream::Buffer> ReadableRingBuffer::ReadLockImpl(ReadLockC
         // If we return a cached buffer at step 1, then step 4 will return the portion of that
         // cached buffer representing frames [10,99], but this is incorrect: the ring buffer has
         // wrapped around. Those frames are no longer available (step 4 should return null).
-        return MakeUncachedBuffer(Fixed(start), length, payload, StreamUsageMask(),
+        return MakeUncachedBuffer(Fixed(start), length, payload, usage_mask_,
                                   media_audio::kUnityGainDb);
       });
 }
@@ -96,6 +96,12 @@ class ReadableRingBuffer : public ReadableStream, public BaseRingBuffer {
   // all stream-specific state, such as the current Trim position.
   std::shared_ptr<ReadableRingBuffer> Dup() const;
 
+  // Tags every buffer read from this stream with |usage|. By default buffers have no usage.
+  void set_usage(const StreamUsage& usage) {
+    usage_mask_.clear();
+    usage_mask_.insert(usage);
+  }
+
   // |media::audio::ReadableStream|
   BaseStream::TimelineFunctionSnapshot ref_time_to_frac_presentation_frame() const override;
   std::shared_ptr<Clock> reference_clock() override { return audio_clock_; }
@@ -111,6 +117,7 @@ class ReadableRingBuffer : public ReadableStream, public BaseRingBuffer {
   void TrimImpl(Fixed frame) override {}
 
   SafeReadWriteFrameFn safe_read_frame_;
+  StreamUsageMask usage_mask_;
 };
 
 class WritableRingBuffer : public WritableStream, public BaseRingBuffer {
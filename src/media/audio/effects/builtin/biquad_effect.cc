@@ -0,0 +1,150 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/media/audio/effects/builtin/biquad_effect.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include <rapidjson/document.h>
+
+namespace media::audio_effects_builtin {
+
+//
+// BiquadEffect: static member functions
+//
+
+// static
+bool BiquadEffect::GetInfo(fuchsia_audio_effects_description* desc) {
+  strlcpy(desc->name, "Biquad", sizeof(desc->name));
+  desc->incoming_channels = FUCHSIA_AUDIO_EFFECTS_CHANNELS_ANY;
+  desc->outgoing_channels = FUCHSIA_AUDIO_EFFECTS_CHANNELS_SAME_AS_IN;
+  return true;
+}
+
+// static
+BiquadEffect* BiquadEffect::Create(uint32_t frame_rate, uint16_t channels_in,
+                                   uint16_t channels_out, std::string_view config) {
+  if (channels_in != channels_out || channels_in == 0) {
+    return nullptr;
+  }
+  auto stages = ParseConfig(config);
+  if (!stages) {
+    return nullptr;
+  }
+  return new BiquadEffect(frame_rate, channels_in, std::move(*stages));
+}
+
+// static
+std::optional<std::vector<BiquadEffect::Coefficients>> BiquadEffect::ParseConfig(
+    std::string_view config) {
+  rapidjson::Document document;
+  document.Parse(config.data(), config.size());
+  if (!document.IsObject()) {
+    return std::nullopt;
+  }
+  auto stages_it = document.FindMember("stages");
+  if (stages_it == document.MemberEnd() || !stages_it->value.IsArray() ||
+      stages_it->value.Size() > kMaxStages) {
+    return std::nullopt;
+  }
+
+  std::vector<Coefficients> stages;
+  for (const auto& stage : stages_it->value.GetArray()) {
+    if (!stage.IsObject()) {
+      return std::nullopt;
+    }
+    Coefficients coefficients;
+    const std::pair<const char*, float*> fields[] = {
+        {"b0", &coefficients.b0}, {"b1", &coefficients.b1}, {"b2", &coefficients.b2},
+        {"a1", &coefficients.a1}, {"a2", &coefficients.a2},
+    };
+    for (auto [name, value] : fields) {
+      auto it = stage.FindMember(name);
+      if (it == stage.MemberEnd() || !it->value.IsNumber() ||
+          !std::isfinite(it->value.GetFloat())) {
+        return std::nullopt;
+      }
+      *value = it->value.GetFloat();
+    }
+    stages.push_back(coefficients);
+  }
+  return stages;
+}
+
+//
+// BiquadEffect: instance member functions
+//
+BiquadEffect::BiquadEffect(uint32_t frame_rate, uint16_t channels,
+                           std::vector<Coefficients> stages)
+    : EffectBase(frame_rate, channels),
+      stages_(std::move(stages)),
+      z1_(stages_.size() * channels, 0.0f),
+      z2_(stages_.size() * channels, 0.0f) {}
+
+bool BiquadEffect::UpdateConfiguration(std::string_view config) {
+  auto stages = ParseConfig(config);
+  if (!stages) {
+    return false;
+  }
+  // The filter state only has meaning for the coefficients it was computed with.
+  stages_ = std::move(*stages);
+  z1_.assign(stages_.size() * channels(), 0.0f);
+  z2_.assign(stages_.size() * channels(), 0.0f);
+  return true;
+}
+
+void BiquadEffect::ProcessInplace(uint32_t num_frames, float* audio_buff) {
+  switch (channels()) {
+    case 1:
+      ProcessFrames<1>(num_frames, 1, audio_buff);
+      break;
+    case 2:
+      ProcessFrames<2>(num_frames, 2, audio_buff);
+      break;
+    case 4:
+      ProcessFrames<4>(num_frames, 4, audio_buff);
+      break;
+    case 8:
+      ProcessFrames<8>(num_frames, 8, audio_buff);
+      break;
+    default:
+      ProcessFrames<0>(num_frames, channels(), audio_buff);
+      break;
+  }
+}
+
+// `kChannels` is the channel count when it is known at compile time, or 0 to use `channels`.
+template <uint16_t kChannels>
+void BiquadEffect::ProcessFrames(uint32_t num_frames, uint16_t channels, float* audio_buff) {
+  if constexpr (kChannels > 0) {
+    channels = kChannels;
+  }
+  for (size_t stage = 0; stage < stages_.size(); ++stage) {
+    // Run each stage over the whole buffer before the next, so that its coefficients and state
+    // stay in registers across frames.
+    const Coefficients c = stages_[stage];
+    float* z1 = &z1_[stage * channels];
+    float* z2 = &z2_[stage * channels];
+    for (uint32_t frame = 0; frame < num_frames; ++frame) {
+      float* samples = audio_buff + frame * channels;
+      for (uint16_t chan = 0; chan < channels; ++chan) {
+        const float x = samples[chan];
+        const float y = c.b0 * x + z1[chan];
+        z1[chan] = c.b1 * x - c.a1 * y + z2[chan];
+        z2[chan] = c.b2 * x - c.a2 * y;
+        samples[chan] = y;
+      }
+    }
+  }
+}
+
+void BiquadEffect::Flush() {
+  std::fill(z1_.begin(), z1_.end(), 0.0f);
+  std::fill(z2_.begin(), z2_.end(), 0.0f);
+}
+
+}  // namespace media::audio_effects_builtin
@@ -0,0 +1,69 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_BIQUAD_EFFECT_H_
+#define SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_BIQUAD_EFFECT_H_
+
+#include <lib/media/audio/effects/audio_effects.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "src/media/audio/effects/builtin/effect_base.h"
+
+namespace media::audio_effects_builtin {
+
+// BiquadEffect: a cascade of biquad filter stages, such as a parametric EQ, applied identically to
+// every channel. Each stage is a transposed direct form II section, normalized so that a0 == 1:
+//
+//   y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+//
+// The config is a JSON object with one entry per stage, applied in order:
+//
+//   {"stages": [{"b0": 1.0, "b1": 0.0, "b2": 0.0, "a1": 0.0, "a2": 0.0}, ...]}
+//
+// Samples are interleaved, so the filter runs frame by frame with the per-channel state laid out
+// contiguously. For the common channel counts the channel loop has a compile-time length, which
+// lets the compiler vectorize it across channels.
+class BiquadEffect : public EffectBase {
+ public:
+  static constexpr uint32_t kMaxStages = 16;
+
+  struct Coefficients {
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+  };
+
+  static bool GetInfo(fuchsia_audio_effects_description* desc);
+
+  static BiquadEffect* Create(uint32_t frame_rate, uint16_t channels_in, uint16_t channels_out,
+                              std::string_view config);
+
+  // Returns the stages described by `config`, or std::nullopt if it is malformed.
+  static std::optional<std::vector<Coefficients>> ParseConfig(std::string_view config);
+
+  BiquadEffect(uint32_t frame_rate, uint16_t channels, std::vector<Coefficients> stages);
+
+  bool UpdateConfiguration(std::string_view config) override;
+  void ProcessInplace(uint32_t num_frames, float* audio_buff) override;
+  void Flush() override;
+
+ private:
+  template <uint16_t kChannels>
+  void ProcessFrames(uint32_t num_frames, uint16_t channels, float* audio_buff);
+
+  std::vector<Coefficients> stages_;
+  // Two delay elements per stage per channel, indexed [stage][channel].
+  std::vector<float> z1_;
+  std::vector<float> z2_;
+};
+
+}  // namespace media::audio_effects_builtin
+
+#endif  // SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_BIQUAD_EFFECT_H_
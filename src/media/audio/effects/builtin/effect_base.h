@@ -0,0 +1,49 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_EFFECT_BASE_H_
+#define SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_EFFECT_BASE_H_
+
+#include <lib/media/audio/effects/audio_effects.h>
+#include <stdint.h>
+
+#include <string_view>
+
+namespace media::audio_effects_builtin {
+
+// The effects in this module, in the order that they are exposed through the effects ABI.
+enum Effect : uint32_t { Biquad = 0, Limiter = 1, Count = 2 };
+
+// Base class for the built-in effects. Every built-in effect processes in place, with the same
+// channel count in and out, and adds no latency.
+class EffectBase {
+ public:
+  EffectBase(uint32_t frame_rate, uint16_t channels)
+      : frame_rate_(frame_rate), channels_(channels) {}
+  virtual ~EffectBase() = default;
+
+  bool GetParameters(fuchsia_audio_effects_parameters* effect_params) const {
+    effect_params->frame_rate = frame_rate_;
+    effect_params->channels_in = channels_;
+    effect_params->channels_out = channels_;
+    effect_params->signal_latency_frames = 0;
+    effect_params->max_frames_per_buffer = 0;
+    return true;
+  }
+
+  virtual bool UpdateConfiguration(std::string_view config) = 0;
+  virtual void ProcessInplace(uint32_t num_frames, float* audio_buff) = 0;
+  virtual void Flush() = 0;
+
+  uint32_t frame_rate() const { return frame_rate_; }
+  uint16_t channels() const { return channels_; }
+
+ private:
+  uint32_t frame_rate_;
+  uint16_t channels_;
+};
+
+}  // namespace media::audio_effects_builtin
+
+#endif  // SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_EFFECT_BASE_H_
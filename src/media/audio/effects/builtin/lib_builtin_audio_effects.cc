@@ -0,0 +1,123 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/media/audio/effects/audio_effects.h>
+
+#include "src/media/audio/effects/builtin/biquad_effect.h"
+#include "src/media/audio/effects/builtin/effect_base.h"
+#include "src/media/audio/effects/builtin/limiter_effect.h"
+
+namespace {
+
+using media::audio_effects_builtin::BiquadEffect;
+using media::audio_effects_builtin::Effect;
+using media::audio_effects_builtin::EffectBase;
+using media::audio_effects_builtin::LimiterEffect;
+
+EffectBase* ToEffect(fuchsia_audio_effects_handle_t effects_handle) {
+  return reinterpret_cast<EffectBase*>(effects_handle);
+}
+
+bool builtin_audio_effects_get_info(uint32_t effect_id, fuchsia_audio_effects_description* desc) {
+  if (desc == nullptr) {
+    return false;
+  }
+  switch (effect_id) {
+    case Effect::Biquad:
+      return BiquadEffect::GetInfo(desc);
+    case Effect::Limiter:
+      return LimiterEffect::GetInfo(desc);
+  }
+  return false;
+}
+
+fuchsia_audio_effects_handle_t builtin_audio_effects_create(uint32_t effect_id, uint32_t frame_rate,
+                                                            uint16_t channels_in,
+                                                            uint16_t channels_out,
+                                                            const char* config,
+                                                            size_t config_length) {
+  if (channels_in > FUCHSIA_AUDIO_EFFECTS_CHANNELS_MAX) {
+    return FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE;
+  }
+
+  EffectBase* effect = nullptr;
+  switch (effect_id) {
+    case Effect::Biquad:
+      effect = BiquadEffect::Create(frame_rate, channels_in, channels_out, {config, config_length});
+      break;
+    case Effect::Limiter:
+      effect =
+          LimiterEffect::Create(frame_rate, channels_in, channels_out, {config, config_length});
+      break;
+  }
+  if (effect == nullptr) {
+    return FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE;
+  }
+  return effect;
+}
+
+bool builtin_audio_effects_update_configuration(fuchsia_audio_effects_handle_t effects_handle,
+                                                const char* config, size_t config_length) {
+  if (effects_handle == FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE) {
+    return false;
+  }
+  return ToEffect(effects_handle)->UpdateConfiguration({config, config_length});
+}
+
+bool builtin_audio_effects_delete(fuchsia_audio_effects_handle_t effects_handle) {
+  if (effects_handle == FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE) {
+    return false;
+  }
+  delete ToEffect(effects_handle);
+  return true;
+}
+
+bool builtin_audio_effects_get_parameters(fuchsia_audio_effects_handle_t effects_handle,
+                                          fuchsia_audio_effects_parameters* effects_params) {
+  if (effects_handle == FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE || effects_params == nullptr) {
+    return false;
+  }
+  return ToEffect(effects_handle)->GetParameters(effects_params);
+}
+
+bool builtin_audio_effects_process_inplace(fuchsia_audio_effects_handle_t effects_handle,
+                                           uint32_t num_frames, float* audio_buff_in_out) {
+  if (effects_handle == FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE || audio_buff_in_out == nullptr) {
+    return false;
+  }
+  ToEffect(effects_handle)->ProcessInplace(num_frames, audio_buff_in_out);
+  return true;
+}
+
+// None of the built-in effects change the channelization, so they only process in place.
+bool builtin_audio_effects_process(fuchsia_audio_effects_handle_t, uint32_t, const float*,
+                                   float**) {
+  return false;
+}
+
+bool builtin_audio_effects_flush(fuchsia_audio_effects_handle_t effects_handle) {
+  if (effects_handle == FUCHSIA_AUDIO_EFFECTS_INVALID_HANDLE) {
+    return false;
+  }
+  ToEffect(effects_handle)->Flush();
+  return true;
+}
+
+void builtin_audio_effects_set_stream_info(fuchsia_audio_effects_handle_t,
+                                           const fuchsia_audio_effects_stream_info*) {}
+
+}  // namespace
+
+DECLARE_FUCHSIA_AUDIO_EFFECTS_MODULE_V1{
+    Effect::Count,
+    &builtin_audio_effects_get_info,
+    &builtin_audio_effects_create,
+    &builtin_audio_effects_update_configuration,
+    &builtin_audio_effects_delete,
+    &builtin_audio_effects_get_parameters,
+    &builtin_audio_effects_process_inplace,
+    &builtin_audio_effects_process,
+    &builtin_audio_effects_flush,
+    &builtin_audio_effects_set_stream_info,
+};
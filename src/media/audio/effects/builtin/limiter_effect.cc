@@ -0,0 +1,142 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/media/audio/effects/builtin/limiter_effect.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <rapidjson/document.h>
+
+namespace media::audio_effects_builtin {
+namespace {
+
+std::optional<float> GetFloatMember(const rapidjson::Document& document, const char* name) {
+  auto it = document.FindMember(name);
+  if (it == document.MemberEnd() || !it->value.IsNumber()) {
+    return std::nullopt;
+  }
+  return it->value.GetFloat();
+}
+
+}  // namespace
+
+//
+// LimiterEffect: static member functions
+//
+
+// static
+bool LimiterEffect::GetInfo(fuchsia_audio_effects_description* desc) {
+  strlcpy(desc->name, "Limiter", sizeof(desc->name));
+  desc->incoming_channels = FUCHSIA_AUDIO_EFFECTS_CHANNELS_ANY;
+  desc->outgoing_channels = FUCHSIA_AUDIO_EFFECTS_CHANNELS_SAME_AS_IN;
+  return true;
+}
+
+// static
+LimiterEffect* LimiterEffect::Create(uint32_t frame_rate, uint16_t channels_in,
+                                     uint16_t channels_out, std::string_view config) {
+  if (channels_in != channels_out || channels_in == 0 || frame_rate == 0) {
+    return nullptr;
+  }
+  auto parsed = ParseConfig(config);
+  if (!parsed) {
+    return nullptr;
+  }
+  return new LimiterEffect(frame_rate, channels_in, *parsed);
+}
+
+// static
+std::optional<LimiterEffect::Config> LimiterEffect::ParseConfig(std::string_view config) {
+  rapidjson::Document document;
+  document.Parse(config.data(), config.size());
+  if (!document.IsObject()) {
+    return std::nullopt;
+  }
+  auto threshold_db = GetFloatMember(document, "threshold_db");
+  auto release_ms = GetFloatMember(document, "release_ms");
+  // The negated comparisons also reject NaN.
+  if (!threshold_db || !(*threshold_db >= kMinThresholdDb && *threshold_db <= 0.0f) ||
+      !release_ms || !(*release_ms > 0.0f && *release_ms <= kMaxReleaseMs)) {
+    return std::nullopt;
+  }
+  return Config{*threshold_db, *release_ms};
+}
+
+//
+// LimiterEffect: instance member functions
+//
+LimiterEffect::LimiterEffect(uint32_t frame_rate, uint16_t channels, Config config)
+    : EffectBase(frame_rate, channels) {
+  ApplyConfig(config);
+}
+
+void LimiterEffect::ApplyConfig(const Config& config) {
+  threshold_ = std::pow(10.0f, config.threshold_db / 20.0f);
+  const float release_frames = config.release_ms * static_cast<float>(frame_rate()) / 1000.0f;
+  release_coefficient_ = std::exp(-1.0f / release_frames);
+}
+
+bool LimiterEffect::UpdateConfiguration(std::string_view config) {
+  auto parsed = ParseConfig(config);
+  if (!parsed) {
+    return false;
+  }
+  // Keep the current gain, so that a new setting does not cause a discontinuity.
+  ApplyConfig(*parsed);
+  return true;
+}
+
+void LimiterEffect::ProcessInplace(uint32_t num_frames, float* audio_buff) {
+  switch (channels()) {
+    case 1:
+      ProcessFrames<1>(num_frames, 1, audio_buff);
+      break;
+    case 2:
+      ProcessFrames<2>(num_frames, 2, audio_buff);
+      break;
+    case 4:
+      ProcessFrames<4>(num_frames, 4, audio_buff);
+      break;
+    case 8:
+      ProcessFrames<8>(num_frames, 8, audio_buff);
+      break;
+    default:
+      ProcessFrames<0>(num_frames, channels(), audio_buff);
+      break;
+  }
+}
+
+// `kChannels` is the channel count when it is known at compile time, or 0 to use `channels`.
+template <uint16_t kChannels>
+void LimiterEffect::ProcessFrames(uint32_t num_frames, uint16_t channels, float* audio_buff) {
+  if constexpr (kChannels > 0) {
+    channels = kChannels;
+  }
+  float gain = gain_;
+  for (uint32_t frame = 0; frame < num_frames; ++frame) {
+    float* samples = audio_buff + frame * channels;
+
+    float peak = 0.0f;
+    for (uint16_t chan = 0; chan < channels; ++chan) {
+      peak = std::max(peak, std::abs(samples[chan]));
+    }
+
+    // Release toward unity, but never above the gain that keeps this frame within the threshold.
+    gain = 1.0f - (1.0f - gain) * release_coefficient_;
+    if (peak * gain > threshold_) {
+      gain = threshold_ / peak;
+    }
+
+    for (uint16_t chan = 0; chan < channels; ++chan) {
+      samples[chan] *= gain;
+    }
+  }
+  gain_ = gain;
+}
+
+void LimiterEffect::Flush() { gain_ = 1.0f; }
+
+}  // namespace media::audio_effects_builtin
@@ -0,0 +1,65 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_LIMITER_EFFECT_H_
+#define SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_LIMITER_EFFECT_H_
+
+#include <lib/media/audio/effects/audio_effects.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+
+#include "src/media/audio/effects/builtin/effect_base.h"
+
+namespace media::audio_effects_builtin {
+
+// LimiterEffect: a peak limiter that keeps every sample within a threshold. All channels share one
+// gain, so the stereo image is preserved. The gain drops immediately when a frame would exceed the
+// threshold, and recovers toward unity with an exponential release. The config is a JSON object:
+//
+//   {"threshold_db": -1.0, "release_ms": 50.0}
+//
+// where `threshold_db` is in dBFS, in [kMinThresholdDb, 0], and `release_ms` is the time constant
+// of the release, in (0, kMaxReleaseMs].
+class LimiterEffect : public EffectBase {
+ public:
+  static constexpr float kMinThresholdDb = -60.0f;
+  static constexpr float kMaxReleaseMs = 10000.0f;
+
+  struct Config {
+    float threshold_db;
+    float release_ms;
+  };
+
+  static bool GetInfo(fuchsia_audio_effects_description* desc);
+
+  static LimiterEffect* Create(uint32_t frame_rate, uint16_t channels_in, uint16_t channels_out,
+                               std::string_view config);
+
+  // Returns the settings described by `config`, or std::nullopt if it is malformed.
+  static std::optional<Config> ParseConfig(std::string_view config);
+
+  LimiterEffect(uint32_t frame_rate, uint16_t channels, Config config);
+
+  bool UpdateConfiguration(std::string_view config) override;
+  void ProcessInplace(uint32_t num_frames, float* audio_buff) override;
+  void Flush() override;
+
+ private:
+  template <uint16_t kChannels>
+  void ProcessFrames(uint32_t num_frames, uint16_t channels, float* audio_buff);
+
+  void ApplyConfig(const Config& config);
+
+  // Linear threshold, and the per-frame decay of the distance between the gain and unity.
+  float threshold_;
+  float release_coefficient_;
+  // The gain applied to the most recent frame.
+  float gain_ = 1.0f;
+};
+
+}  // namespace media::audio_effects_builtin
+
+#endif  // SRC_MEDIA_AUDIO_EFFECTS_BUILTIN_LIMITER_EFFECT_H_
@@ -0,0 +1,70 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/media/audio/effects/builtin/limiter_effect.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace media::audio_effects_builtin {
+namespace {
+
+constexpr uint32_t kFrameRate = 48000;
+
+// A threshold of -6.0206 dBFS is a linear threshold of 0.5.
+constexpr char kConfig[] = R"({"threshold_db": -6.0206, "release_ms": 1.0})";
+constexpr float kThreshold = 0.5f;
+
+TEST(LimiterEffectTest, RejectsBadConfigs) {
+  EXPECT_FALSE(LimiterEffect::ParseConfig(""));
+  EXPECT_FALSE(LimiterEffect::ParseConfig(R"({"threshold_db": -1.0})"));
+  EXPECT_FALSE(LimiterEffect::ParseConfig(R"({"release_ms": 10.0})"));
+  EXPECT_FALSE(LimiterEffect::ParseConfig(R"({"threshold_db": 1.0, "release_ms": 10.0})"));
+  EXPECT_FALSE(LimiterEffect::ParseConfig(R"({"threshold_db": -1.0, "release_ms": 0.0})"));
+  EXPECT_TRUE(LimiterEffect::ParseConfig(R"({"threshold_db": 0, "release_ms": 10})"));
+  EXPECT_EQ(LimiterEffect::Create(kFrameRate, 1, 2, kConfig), nullptr);
+}
+
+TEST(LimiterEffectTest, PassesQuietAudio) {
+  std::unique_ptr<LimiterEffect> effect(LimiterEffect::Create(kFrameRate, 2, 2, kConfig));
+  ASSERT_NE(effect, nullptr);
+
+  std::vector<float> buffer = {0.1f, -0.2f, 0.4f, -0.45f, 0.0f, 0.3f};
+  const std::vector<float> input = buffer;
+  effect->ProcessInplace(3, buffer.data());
+  EXPECT_EQ(buffer, input);
+}
+
+TEST(LimiterEffectTest, LimitsPeaksThenReleases) {
+  for (uint16_t channels : {1, 2, 3}) {
+    SCOPED_TRACE("channels " + std::to_string(channels));
+    std::unique_ptr<LimiterEffect> effect(
+        LimiterEffect::Create(kFrameRate, channels, channels, kConfig));
+    ASSERT_NE(effect, nullptr);
+
+    // One loud frame on the last channel, then quiet audio.
+    constexpr size_t kFrames = 480;
+    std::vector<float> buffer(kFrames * channels, 0.25f);
+    buffer[channels - 1] = 1.0f;
+    effect->ProcessInplace(kFrames, buffer.data());
+
+    // The whole loud frame shares one gain, which brings its peak down to the threshold.
+    EXPECT_NEAR(buffer[channels - 1], kThreshold, 1e-4f);
+    for (uint16_t chan = 0; chan + 1 < channels; ++chan) {
+      EXPECT_NEAR(buffer[chan], 0.25f * kThreshold, 1e-4f);
+    }
+    // The gain then recovers monotonically, and is back at unity well after the release time.
+    for (size_t frame = 2; frame < kFrames; ++frame) {
+      EXPECT_GE(buffer[frame * channels], buffer[(frame - 1) * channels]);
+    }
+    EXPECT_NEAR(buffer[(kFrames - 1) * channels], 0.25f, 1e-4f);
+  }
+}
+
+}  // namespace
+}  // namespace media::audio_effects_builtin
@@ -0,0 +1,101 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_MEDIA_AUDIO_LIB_PROCESSING_DOT_PRODUCT_H_
+#define SRC_MEDIA_AUDIO_LIB_PROCESSING_DOT_PRODUCT_H_
+
+#include <cstdint>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+namespace media_audio {
+
+// Dot product kernels for the convolution filters. The vector width is chosen at compile time, as
+// in //sdk/lib/utf-utils: NEON on arm64, AVX when the target has it and SSE otherwise on x64, with
+// a scalar fallback for everything else. The vector versions sum the products in a different order
+// than the scalar loop, so results can differ by a few ULPs.
+
+// Returns the sum of `samples[i] * coefficients[i]` for i in [0, count).
+inline float DotProduct(const float* samples, const float* coefficients, int64_t count) {
+  int64_t idx = 0;
+  float result = 0.0f;
+#if defined(__aarch64__)
+  float32x4_t sum = vdupq_n_f32(0.0f);
+  for (; idx + 4 <= count; idx += 4) {
+    sum = vmlaq_f32(sum, vld1q_f32(samples + idx), vld1q_f32(coefficients + idx));
+  }
+  result = vaddvq_f32(sum);
+#elif defined(__AVX__)
+  __m256 sum = _mm256_setzero_ps();
+  for (; idx + 8 <= count; idx += 8) {
+    sum = _mm256_add_ps(
+        sum, _mm256_mul_ps(_mm256_loadu_ps(samples + idx), _mm256_loadu_ps(coefficients + idx)));
+  }
+  __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+  sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+  result = _mm_cvtss_f32(_mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 1)));
+#elif defined(__SSE__)
+  __m128 sum = _mm_setzero_ps();
+  for (; idx + 4 <= count; idx += 4) {
+    sum =
+        _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(samples + idx), _mm_loadu_ps(coefficients + idx)));
+  }
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  result = _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+#endif
+  for (; idx < count; ++idx) {
+    result += samples[idx] * coefficients[idx];
+  }
+  return result;
+}
+
+// Returns the sum of `samples[-i] * coefficients[i]` for i in [0, count). That is, `samples` is
+// walked backwards from `samples[0]` while `coefficients` is walked forwards, as for the negative
+// side of a symmetric filter.
+inline float ReversedDotProduct(const float* samples, const float* coefficients, int64_t count) {
+  int64_t idx = 0;
+  float result = 0.0f;
+#if defined(__aarch64__)
+  float32x4_t sum = vdupq_n_f32(0.0f);
+  for (; idx + 4 <= count; idx += 4) {
+    // Load samples [-idx-3, -idx] and reverse them into [-idx, -idx-3].
+    float32x4_t s = vrev64q_f32(vld1q_f32(samples - idx - 3));
+    s = vcombine_f32(vget_high_f32(s), vget_low_f32(s));
+    sum = vmlaq_f32(sum, s, vld1q_f32(coefficients + idx));
+  }
+  result = vaddvq_f32(sum);
+#elif defined(__AVX__)
+  __m256 sum = _mm256_setzero_ps();
+  for (; idx + 8 <= count; idx += 8) {
+    __m256 s = _mm256_loadu_ps(samples - idx - 7);
+    s = _mm256_permute2f128_ps(s, s, 1);
+    s = _mm256_permute_ps(s, _MM_SHUFFLE(0, 1, 2, 3));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(s, _mm256_loadu_ps(coefficients + idx)));
+  }
+  __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+  sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+  result = _mm_cvtss_f32(_mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 1)));
+#elif defined(__SSE__)
+  __m128 sum = _mm_setzero_ps();
+  for (; idx + 4 <= count; idx += 4) {
+    __m128 s = _mm_loadu_ps(samples - idx - 3);
+    s = _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 1, 2, 3));
+    sum = _mm_add_ps(sum, _mm_mul_ps(s, _mm_loadu_ps(coefficients + idx)));
+  }
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  result = _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+#endif
+  for (; idx < count; ++idx) {
+    result += samples[-idx] * coefficients[idx];
+  }
+  return result;
+}
+
+}  // namespace media_audio
+
+#endif  // SRC_MEDIA_AUDIO_LIB_PROCESSING_DOT_PRODUCT_H_
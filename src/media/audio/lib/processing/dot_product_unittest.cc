@@ -0,0 +1,61 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/media/audio/lib/processing/dot_product.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace media_audio {
+namespace {
+
+constexpr int64_t kMaxCount = 37;
+
+std::vector<float> MakeSignal(float step) {
+  std::vector<float> signal(kMaxCount);
+  for (int64_t i = 0; i < kMaxCount; ++i) {
+    signal[i] = std::sin(static_cast<float>(i) * step);
+  }
+  return signal;
+}
+
+// The kernels sum in a different order than these loops, so only compare within a tolerance.
+constexpr float kTolerance = 1e-5f;
+
+TEST(DotProductTest, MatchesScalar) {
+  const std::vector<float> samples = MakeSignal(0.37f);
+  const std::vector<float> coefficients = MakeSignal(0.11f);
+
+  // Cover the empty case, the scalar tails and several full vectors.
+  for (int64_t count = 0; count <= kMaxCount; ++count) {
+    SCOPED_TRACE("count " + std::to_string(count));
+    float expected = 0.0f;
+    for (int64_t i = 0; i < count; ++i) {
+      expected += samples[i] * coefficients[i];
+    }
+    EXPECT_NEAR(DotProduct(samples.data(), coefficients.data(), count), expected, kTolerance);
+  }
+}
+
+TEST(DotProductTest, ReversedMatchesScalar) {
+  const std::vector<float> samples = MakeSignal(0.37f);
+  const std::vector<float> coefficients = MakeSignal(0.11f);
+
+  for (int64_t count = 0; count <= kMaxCount; ++count) {
+    SCOPED_TRACE("count " + std::to_string(count));
+    // Walk backwards from the last sample so that every count reads only valid samples.
+    const float* last = &samples[kMaxCount - 1];
+    float expected = 0.0f;
+    for (int64_t i = 0; i < count; ++i) {
+      expected += last[-i] * coefficients[i];
+    }
+    EXPECT_NEAR(ReversedDotProduct(last, coefficients.data(), count), expected, kTolerance);
+  }
+}
+
+}  // namespace
+}  // namespace media_audio
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "src/media/audio/lib/processing/coefficient_table.h"
+#include "src/media/audio/lib/processing/dot_product.h"
 #include "src/media/audio/lib/processing/flags.h"
 
 namespace media_audio {
@@ -63,38 +64,34 @@ void Filter::DisplayTable(const CoefficientTable& filter_coefficients) {
 // We first calculate the contribution of the negative side of the filter, and then the contribution
 // of the positive side. To avoid double-counting it, we include center subframe 0 only in the
 // negative-side calculation.
+//
+// Both sides are dot products over contiguous coefficients (see dot_product.h). The negative side
+// walks the source samples backwards from the center. When several channels are computed at the
+// same `frac_offset`, the coefficient slices are shared by all of them.
 float Filter::ComputeSampleFromTable(const CoefficientTable& filter_coefficients,
                                      int64_t frac_offset, float* center) {
+  float result;
+  ComputeSamplesFromTable(filter_coefficients, frac_offset, &center, 1, &result);
+  return result;
+}
+
+void Filter::ComputeSamplesFromTable(const CoefficientTable& filter_coefficients,
+                                     int64_t frac_offset, float* const* centers,
+                                     int64_t channel_count, float* results) {
   FX_DCHECK(frac_offset <= frac_size_) << frac_offset;
   if constexpr (kTraceFilterComputation) {
     FX_LOGS(INFO) << "For frac_offset 0x" << std::hex << frac_offset << " ("
                   << (static_cast<double>(frac_offset) / static_cast<double>(frac_size_)) << "):";
   }
 
-  // We use some raw pointers here to make loops vectorizable.
-  float* sample_ptr;
-  const float* coefficient_ptr;
-  float result = 0.0f;
-
   // Negative side examples --
   // side_length 1.601, frac_offset 0.600 requires source range (-1.001, 0.600]: frames -1 and 0.
   // side_length 1.601, frac_offset 0.601 requires source range (-1.000, 0.601]: frame 0.
-  int64_t source_frames = (side_length_ - 1 + frac_size_ - frac_offset) >> num_frac_bits_;
-  if (source_frames > 0) {
-    sample_ptr = center;
-    coefficient_ptr = filter_coefficients.ReadSlice(frac_offset, source_frames);
-    FX_DCHECK(coefficient_ptr != nullptr);
-
-    for (int64_t source_idx = 0; source_idx < source_frames; ++source_idx) {
-      auto contribution = (*sample_ptr) * coefficient_ptr[source_idx];
-      if constexpr (kTraceFilterComputation) {
-        FX_LOGS(INFO) << "Adding source[" << -static_cast<ssize_t>(source_idx) << "] "
-                      << (*sample_ptr) << " x " << coefficient_ptr[source_idx] << " = "
-                      << contribution;
-      }
-      result += contribution;
-      --sample_ptr;
-    }
+  const int64_t neg_source_frames = (side_length_ - 1 + frac_size_ - frac_offset) >> num_frac_bits_;
+  const float* neg_coefficient_ptr = nullptr;
+  if (neg_source_frames > 0) {
+    neg_coefficient_ptr = filter_coefficients.ReadSlice(frac_offset, neg_source_frames);
+    FX_DCHECK(neg_coefficient_ptr != nullptr);
   }
 
   // Positive side examples --
@@ -102,27 +99,43 @@ float Filter::ComputeSampleFromTable(const CoefficientTable& filter_coefficients
   // side_length 1.601, frac_offset 0.399 requires source range (0.399, 2.000): frame 1.
   //
   // Reduction of: side_length_ + (frac_size_-1) - (frac_size_-frac_offset)
-  source_frames = (side_length_ - 1 + frac_offset) >> num_frac_bits_;
-  if (source_frames > 0) {
-    sample_ptr = center + 1;
-    coefficient_ptr = filter_coefficients.ReadSlice(frac_size_ - frac_offset, source_frames);
-    FX_DCHECK(coefficient_ptr != nullptr);
-
-    for (int64_t source_idx = 0; source_idx < source_frames; ++source_idx) {
-      auto contribution = sample_ptr[source_idx] * coefficient_ptr[source_idx];
+  const int64_t pos_source_frames = (side_length_ - 1 + frac_offset) >> num_frac_bits_;
+  const float* pos_coefficient_ptr = nullptr;
+  if (pos_source_frames > 0) {
+    pos_coefficient_ptr =
+        filter_coefficients.ReadSlice(frac_size_ - frac_offset, pos_source_frames);
+    FX_DCHECK(pos_coefficient_ptr != nullptr);
+  }
+
+  for (int64_t chan = 0; chan < channel_count; ++chan) {
+    const float* center = centers[chan];
+    float result = 0.0f;
+    if (neg_source_frames > 0) {
       if constexpr (kTraceFilterComputation) {
-        FX_LOGS(INFO) << "Adding source[" << 1 + source_idx << "] " << std::setprecision(13)
-                      << sample_ptr[source_idx] << " x " << coefficient_ptr[source_idx] << " = "
-                      << contribution;
+        for (int64_t source_idx = 0; source_idx < neg_source_frames; ++source_idx) {
+          FX_LOGS(INFO) << "Adding source[" << -static_cast<ssize_t>(source_idx) << "] "
+                        << center[-source_idx] << " x " << neg_coefficient_ptr[source_idx] << " = "
+                        << center[-source_idx] * neg_coefficient_ptr[source_idx];
+        }
       }
-      result += contribution;
+      result += ReversedDotProduct(center, neg_coefficient_ptr, neg_source_frames);
+    }
+    if (pos_source_frames > 0) {
+      if constexpr (kTraceFilterComputation) {
+        for (int64_t source_idx = 0; source_idx < pos_source_frames; ++source_idx) {
+          FX_LOGS(INFO) << "Adding source[" << 1 + source_idx << "] " << std::setprecision(13)
+                        << center[1 + source_idx] << " x " << pos_coefficient_ptr[source_idx]
+                        << " = " << center[1 + source_idx] * pos_coefficient_ptr[source_idx];
+        }
+      }
+      result += DotProduct(center + 1, pos_coefficient_ptr, pos_source_frames);
     }
-  }
 
-  if constexpr (kTraceFilterComputation) {
-    FX_LOGS(INFO) << "... to get " << std::setprecision(13) << result;
+    if constexpr (kTraceFilterComputation) {
+      FX_LOGS(INFO) << "... to get " << std::setprecision(13) << result;
+    }
+    results[chan] = result;
   }
-  return result;
 }
 
 SincFilter::CacheT* CreateSincFilterCoefficientTableCache() {
@@ -37,6 +37,12 @@ class Filter {
   // Computes sample at `center` frame with `frac_offset`.
   virtual float ComputeSample(int64_t frac_offset, float* center) = 0;
 
+  // Computes a sample for each of `channel_count` channels at the same `frac_offset`, where
+  // `centers[i]` is the center frame of channel `i`, and writes it into `results[i]`. This is
+  // equivalent to calling `ComputeSample` for each channel, but reads the coefficients only once.
+  virtual void ComputeSamples(int64_t frac_offset, float* const* centers, int64_t channel_count,
+                              float* results) = 0;
+
   // Displays the filter table values. Used for debugging purposes only.
   virtual void Display() = 0;
 
@@ -56,6 +62,8 @@ class Filter {
  protected:
   float ComputeSampleFromTable(const CoefficientTable& filter_coefficients, int64_t frac_offset,
                                float* center);
+  void ComputeSamplesFromTable(const CoefficientTable& filter_coefficients, int64_t frac_offset,
+                               float* const* centers, int64_t channel_count, float* results);
   inline void DisplayTable(const CoefficientTable& filter_coefficients);
 
  private:
@@ -85,6 +93,11 @@ class LinearFilter : public Filter {
     return ComputeSampleFromTable(*filter_coefficients_, frac_offset, center);
   }
 
+  void ComputeSamples(int64_t frac_offset, float* const* centers, int64_t channel_count,
+                      float* results) override {
+    ComputeSamplesFromTable(*filter_coefficients_, frac_offset, centers, channel_count, results);
+  }
+
   void Display() override {
     if constexpr (kEnableDisplayForFilterTablesAndComputation) {
       DisplayTable(*filter_coefficients_);
@@ -128,6 +141,11 @@ class SincFilter : public Filter {
     return ComputeSampleFromTable(*filter_coefficients_, frac_offset, center);
   }
 
+  void ComputeSamples(int64_t frac_offset, float* const* centers, int64_t channel_count,
+                      float* results) override {
+    ComputeSamplesFromTable(*filter_coefficients_, frac_offset, centers, channel_count, results);
+  }
+
   void Display() override {
     if constexpr (kEnableDisplayForFilterTablesAndComputation) {
       DisplayTable(*filter_coefficients_);
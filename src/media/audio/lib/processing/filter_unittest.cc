@@ -7,6 +7,8 @@
 #include <lib/syslog/cpp/macros.h>
 
 #include <limits>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -285,5 +287,38 @@ TEST(SincFilterTest, ComputeSample) {
   ValidateSincComputeSample(source_rate, dest_rate, side_length, num_frac_bits);
 }
 
+TEST(SincFilterTest, ComputeSamplesMatchesComputeSample) {
+  constexpr int64_t kChannelCount = 3;
+  constexpr int64_t kFrameCount = 64;
+  SincFilter filter(44100, 48000);
+  const int64_t side_frames = (filter.side_length() >> filter.num_frac_bits()) + 1;
+  ASSERT_LT(2 * side_frames, kFrameCount);
+
+  // Planar data, with a different signal in each channel.
+  std::vector<float> data(kChannelCount * kFrameCount);
+  for (int64_t chan = 0; chan < kChannelCount; ++chan) {
+    for (int64_t frame = 0; frame < kFrameCount; ++frame) {
+      data[chan * kFrameCount + frame] =
+          static_cast<float>((frame * (chan + 3)) % 17) / 17.0f - 0.5f;
+    }
+  }
+
+  const int64_t center_frame = kFrameCount / 2;
+  float* centers[kChannelCount];
+  for (int64_t chan = 0; chan < kChannelCount; ++chan) {
+    centers[chan] = &data[chan * kFrameCount + center_frame];
+  }
+
+  for (const int64_t frac_offset : {int64_t{0}, filter.frac_size() / 3, filter.frac_size() / 2,
+                                    filter.frac_size() - 1}) {
+    SCOPED_TRACE("frac_offset " + std::to_string(frac_offset));
+    float results[kChannelCount];
+    filter.ComputeSamples(frac_offset, centers, kChannelCount, results);
+    for (int64_t chan = 0; chan < kChannelCount; ++chan) {
+      EXPECT_FLOAT_EQ(results[chan], filter.ComputeSample(frac_offset, centers[chan]));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace media_audio
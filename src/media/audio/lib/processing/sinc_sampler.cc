@@ -9,6 +9,7 @@
 #include <lib/trace/event.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <memory>
 
@@ -199,10 +200,17 @@ class SincSamplerImpl : public SincSampler {
             scale = gain.scale_ramp[position_.dest_offset() - dest_ramp_start];
           }
 
+          // All channels share the same filter position, so compute them together to read the
+          // filter coefficients only once per frame.
+          std::array<float*, DestChannelCount> centers;
           for (size_t dest_chan = 0; dest_chan < DestChannelCount; ++dest_chan) {
-            const float sample = filter_.ComputeSample(
-                frac_interp_fraction, &(working_data_[dest_chan][cache_center_idx]));
-            MixSample<Type, Accumulate>(sample, &dest_frame[dest_chan], scale);
+            centers[dest_chan] = &(working_data_[dest_chan][cache_center_idx]);
+          }
+          std::array<float, DestChannelCount> samples;
+          filter_.ComputeSamples(frac_interp_fraction, centers.data(), DestChannelCount,
+                                 samples.data());
+          for (size_t dest_chan = 0; dest_chan < DestChannelCount; ++dest_chan) {
+            MixSample<Type, Accumulate>(samples[dest_chan], &dest_frame[dest_chan], scale);
           }
 
           frac_source_offset = position_.AdvanceFrame();
@@ -0,0 +1,96 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <fidl/fuchsia.audio/cpp/wire_types.h>
+#include <lib/syslog/cpp/macros.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <perftest/perftest.h>
+
+#include "src/media/audio/lib/format2/fixed.h"
+#include "src/media/audio/lib/format2/format.h"
+#include "src/media/audio/lib/processing/gain.h"
+#include "src/media/audio/lib/processing/sampler.h"
+#include "src/media/audio/lib/processing/sinc_sampler.h"
+#include "src/media/audio/lib/timeline/timeline_rate.h"
+
+namespace media_audio {
+namespace {
+
+using ::fuchsia_audio::SampleType;
+using ::media::TimelineRate;
+
+// Each run produces this many destination frames (10ms at 48kHz), so the ns/frame cost of a
+// configuration is its per-run time divided by `kDestFrameCount`.
+constexpr int64_t kDestFrameCount = 480;
+
+// Measures `SincSampler::Process` resampling float source into float dest with the same channel
+// count on both sides, which is the common case in the mixer.
+bool SincSamplerProcess(perftest::RepeatState* state, int64_t channel_count,
+                        int32_t source_frame_rate, int32_t dest_frame_rate) {
+  auto sampler = SincSampler::Create(
+      Format::CreateOrDie({SampleType::kFloat32, channel_count, source_frame_rate}),
+      Format::CreateOrDie({SampleType::kFloat32, channel_count, dest_frame_rate}));
+  FX_CHECK(sampler);
+  sampler->EagerlyPrepare();
+  sampler->state().ResetSourceStride(
+      TimelineRate(Fixed(source_frame_rate).raw_value(), dest_frame_rate));
+
+  // Enough source for a full destination buffer, plus the filter width on both sides.
+  const int64_t source_frame_count =
+      kDestFrameCount * source_frame_rate / dest_frame_rate +
+      2 * (sampler->pos_filter_length().Ceiling() + 1);
+  std::vector<float> source_samples(source_frame_count * channel_count);
+  for (size_t i = 0; i < source_samples.size(); ++i) {
+    source_samples[i] = std::sin(static_cast<float>(i) * 0.01f);
+  }
+  std::vector<float> dest_samples(kDestFrameCount * channel_count);
+
+  while (state->KeepRunning()) {
+    Fixed source_offset = sampler->pos_filter_length() - Fixed::FromRaw(1);
+    int64_t dest_offset = 0;
+    sampler->Process({source_samples.data(), &source_offset, source_frame_count},
+                     {dest_samples.data(), &dest_offset, kDestFrameCount},
+                     {.type = GainType::kUnity, .scale = kUnityGainScale},
+                     /*accumulate=*/false);
+    FX_CHECK(dest_offset == kDestFrameCount) << dest_offset;
+  }
+  return true;
+}
+
+void RegisterTests() {
+  constexpr struct {
+    int32_t source_frame_rate;
+    int32_t dest_frame_rate;
+  } kRates[] = {
+      {48000, 44100},
+      {44100, 48000},
+      {96000, 48000},
+      {16000, 48000},
+  };
+
+  for (const auto& [source_frame_rate, dest_frame_rate] : kRates) {
+    for (int64_t channel_count = 1; channel_count <= 4; ++channel_count) {
+      perftest::RegisterTest(("SincSampler/" + std::to_string(source_frame_rate) + "-" +
+                              std::to_string(dest_frame_rate) + "/" +
+                              std::to_string(channel_count) + "Chan")
+                                 .c_str(),
+                             SincSamplerProcess, channel_count, source_frame_rate,
+                             dest_frame_rate);
+    }
+  }
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
+}  // namespace media_audio
+
+int main(int argc, char** argv) {
+  return perftest::PerfTestMain(argc, argv, "fuchsia.audio.processing");
+}
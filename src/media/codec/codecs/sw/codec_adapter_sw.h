@@ -17,6 +17,7 @@
 
 #include <optional>
 #include <queue>
+#include <utility>
 
 #include "buffer_pool.h"
 #include "src/lib/fxl/macros.h"
@@ -95,6 +96,10 @@ class CodecAdapterSW : public CodecAdapter {
     if (port != kOutputPort) {
       return;
     }
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      configured_output_constraints_ = std::exchange(requested_output_constraints_, std::nullopt);
+    }
     std::vector<CodecPacket*> all_packets;
     for (auto& packet : packets) {
       all_packets.push_back(packet.get());
@@ -211,6 +216,9 @@ class CodecAdapterSW : public CodecAdapter {
     staged_output_buffers_.clear();
 
     free_output_packets_.Reset();
+
+    std::lock_guard<std::mutex> lock(lock_);
+    configured_output_constraints_ = std::nullopt;
   }
 
   void CoreCodecMidStreamOutputBufferReConfigPrepare() override {
@@ -276,6 +284,29 @@ class CodecAdapterSW : public CodecAdapter {
     stream_stopped_condition.wait(lock, [&stream_stopped] { return stream_stopped; });
   }
 
+  // Reports the output constraints for a stream whose input format details have just been
+  // processed. If the output buffers that are still configured from an earlier stream were
+  // allocated for the same constraints, they're kept and only the new output format is sent, so a
+  // run of short streams in one format doesn't allocate a new buffer collection for each stream.
+  // Otherwise the client is asked to configure new output buffers.
+  void OnStreamOutputConstraints() {
+    auto constraints = CoreCodecGetBufferCollectionConstraints2(kOutputPort, {}, {});
+    bool keep_buffers;
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      keep_buffers = configured_output_constraints_ == constraints;
+      if (!keep_buffers) {
+        requested_output_constraints_ = std::move(constraints);
+      }
+    }
+    if (keep_buffers) {
+      events_->onCoreCodecOutputFormatChange();
+    } else {
+      events_->onCoreCodecMidStreamOutputConstraintsChange(
+          /*output_re_config_required=*/true);
+    }
+  }
+
   // We don't give the codec any buffers in its output pool until
   // configuration is finished or a stream starts. Until finishing
   // configuration we stage all the buffers. Here we load all the staged
@@ -311,6 +342,13 @@ class CodecAdapterSW : public CodecAdapter {
   // complete.
   std::vector<const CodecBuffer*> staged_output_buffers_;
 
+  // The output constraints most recently sent to the client, and the ones that the currently
+  // configured output buffers were allocated for.
+  std::optional<fuchsia_sysmem2::BufferCollectionConstraints> requested_output_constraints_
+      FXL_GUARDED_BY(lock_);
+  std::optional<fuchsia_sysmem2::BufferCollectionConstraints> configured_output_constraints_
+      FXL_GUARDED_BY(lock_);
+
   uint64_t input_format_details_version_ordinal_;
 
   async::Loop input_processing_loop_;
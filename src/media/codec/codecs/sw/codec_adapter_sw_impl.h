@@ -107,8 +107,7 @@ class CodecAdapterSWImpl : public CodecAdapterSW<fit::deferred_action<fit::closu
         // regardless of whether the input format is ultimately provided during
         // StreamProcessor create or via a format item queued from the client.
         // So we can be sure that this call happens before any input packets.
-        events_->onCoreCodecMidStreamOutputConstraintsChange(
-            /*output_re_config_required=*/true);
+        OnStreamOutputConstraints();
       } else if (item.is_end_of_stream()) {
         if (ProcessEndOfStream(&item) == kShouldTerminate) {
           // A failure was reported through `events_` or the stream was stopped.
@@ -5,7 +5,9 @@
 #include "avcodec_context.h"
 
 #include <lib/media/codec_impl/codec_buffer.h>
+#include <zircon/syscalls.h>
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <string>
@@ -15,6 +17,10 @@ namespace {
 // TODO(turnage): Add VP9, and more.
 static const std::map<std::string, AVCodecID> codec_ids = {{"video/h264", AV_CODEC_ID_H264}};
 
+// The most decode threads to use, however many cores there are. This is the same limit ffmpeg
+// applies when it picks a thread count itself.
+constexpr uint32_t kMaxDecodeThreads = 16;
+
 static inline constexpr uint32_t make_fourcc(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
   return (static_cast<uint32_t>(d) << 24) | (static_cast<uint32_t>(c) << 16) |
          (static_cast<uint32_t>(b) << 8) | static_cast<uint32_t>(a);
@@ -49,6 +55,14 @@ std::optional<std::unique_ptr<AvCodecContext>> AvCodecContext::CreateDecoder(
 
   avcodec_context->get_buffer2 = AvCodecContext::GetBufferCallbackRouter;
 
+  // Decode the slices of each frame in parallel, with up to one thread per core. Frame threading
+  // isn't an option: ffmpeg disables it when AV_CODEC_FLAG2_CHUNKS is set. Slice threading also
+  // keeps every get_buffer2 call on the thread calling into the decoder, which GetBuffer()
+  // relies on to keep output format changes in order with output frames.
+  avcodec_context->thread_type = FF_THREAD_SLICE;
+  avcodec_context->thread_count =
+      static_cast<int>(std::min(zx_system_get_num_cpus(), kMaxDecodeThreads));
+
   std::unique_ptr<AvCodecContext> decoder(
       new AvCodecContext(std::move(avcodec_context), std::move(get_buffer_callback)));
 
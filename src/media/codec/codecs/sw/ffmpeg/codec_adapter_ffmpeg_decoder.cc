@@ -147,8 +147,14 @@ int CodecAdapterFfmpegDecoder::GetBuffer(
   }
 
   if (should_config_output) {
-    events_->onCoreCodecMidStreamOutputConstraintsChange(
-        /*output_re_config_required=*/need_new_buffers);
+    if (need_new_buffers) {
+      events_->onCoreCodecMidStreamOutputConstraintsChange(
+          /*output_re_config_required=*/true);
+    } else {
+      // The configured output buffers are large enough for the new format, so keep them (across
+      // streams as well as within one) rather than asking the client to allocate new ones.
+      events_->onCoreCodecOutputFormatChange();
+    }
   }
 
   auto buffer = output_buffer_pool_.AllocateBuffer(decoded_output_info.buffer_bytes_needed);
@@ -45,8 +45,7 @@ void CodecAdapterSbcDecoder::ProcessInputLoop() {
         return;
       }
 
-      events_->onCoreCodecMidStreamOutputConstraintsChange(
-          /*output_re_config_required=*/true);
+      OnStreamOutputConstraints();
     } else if (input_item.is_end_of_stream()) {
       ZX_DEBUG_ASSERT(context_);
 
@@ -60,8 +60,7 @@ void CodecAdapterSbcEncoder::ProcessInputLoop() {
         return;
       }
 
-      events_->onCoreCodecMidStreamOutputConstraintsChange(
-          /*output_re_config_required=*/true);
+      OnStreamOutputConstraints();
     } else if (input_item.is_end_of_stream()) {
       ZX_DEBUG_ASSERT(context_);
       if (EncodeInput(nullptr) == kShouldTerminate) {
@@ -14,6 +14,8 @@
 #include <lib/media/codec_impl/log.h>
 #include <lib/stdcompat/optional.h>
 #include <lib/stdcompat/variant.h>
+#include <lib/trace/event.h>
+#include <lib/zx/clock.h>
 #include <threads.h>
 #include <zircon/compiler.h>
 #include <zircon/threads.h>
@@ -3710,6 +3712,16 @@ void CodecImpl::onCoreCodecOutputPacket(CodecPacket* packet, bool error_detected
     // coherent for codecs that don't output the same buffer repeatedly and
     // concurrently.
     all_packets_[kOutputPort][packet->packet_index()]->SetFree(false);
+
+    // Short streams (a notification sound, a thumbnail) are dominated by their startup cost, so
+    // record how long each stream took to produce its first output, including any output buffer
+    // configuration.
+    if (auto time_to_first_output = stream_->TakeTimeToFirstOutputPacket()) {
+      TRACE_INSTANT("media", "CodecImpl first output packet", TRACE_SCOPE_PROCESS,
+                    "stream_lifetime_ordinal", stream_lifetime_ordinal_, "time_to_first_output_ns",
+                    time_to_first_output->get());
+    }
+
     ZX_DEBUG_ASSERT(packet->has_start_offset());
     ZX_DEBUG_ASSERT(packet->has_valid_length_bytes());
     // packet->has_timestamp_ish() is optional even if
@@ -3780,7 +3792,9 @@ void CodecImpl::onCoreCodecLogEvent(
 }
 
 CodecImpl::Stream::Stream(const CodecImpl* const parent, uint64_t stream_lifetime_ordinal)
-    : parent_(parent), stream_lifetime_ordinal_(stream_lifetime_ordinal) {
+    : parent_(parent),
+      stream_lifetime_ordinal_(stream_lifetime_ordinal),
+      creation_time_(zx::clock::get_monotonic()) {
   // nothing else to do here
 }
 
@@ -3843,6 +3857,14 @@ void CodecImpl::Stream::SetOutputEndOfStream() {
 
 bool CodecImpl::Stream::output_end_of_stream() { return output_end_of_stream_; }
 
+std::optional<zx::duration> CodecImpl::Stream::TakeTimeToFirstOutputPacket() {
+  if (output_packet_seen_) {
+    return std::nullopt;
+  }
+  output_packet_seen_ = true;
+  return zx::clock::get_monotonic() - creation_time_;
+}
+
 void CodecImpl::Stream::SetFailureSeen() {
   ZX_DEBUG_ASSERT(!failure_seen_);
   failure_seen_ = true;
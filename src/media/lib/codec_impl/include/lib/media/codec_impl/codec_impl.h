@@ -17,11 +17,13 @@
 #include <lib/stdcompat/optional.h>
 #include <lib/stdcompat/variant.h>
 #include <lib/thread-safe-deleter/thread_safe_deleter.h>
+#include <lib/zx/time.h>
 #include <zircon/compiler.h>
 
 #include <atomic>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <queue>
 
 #include <fbl/macros.h>
@@ -338,6 +340,11 @@ class CodecImpl : public fuchsia::media::StreamProcessor,
     void ClearMidStreamOutputConstraintsChangeActive();
     __WARN_UNUSED_RESULT bool is_mid_stream_output_constraints_change_active();
 
+    // Returns the time from the creation of this stream to now on the first call, and
+    // std::nullopt on every later call.  Called as each output packet is sent, so the first
+    // result is the stream's time to first output.
+    std::optional<zx::duration> TakeTimeToFirstOutputPacket();
+
    private:
     // The parent_ field is only for __TA_GUARDED() usage below.
     const CodecImpl* const parent_ = nullptr;
@@ -370,6 +377,9 @@ class CodecImpl : public fuchsia::media::StreamProcessor,
     // It's not permitted for the core codec to emit output while a mid-stream
     // output constraints change is active.
     bool is_mid_stream_output_constraints_change_active_ = false;
+
+    const zx::time creation_time_;
+    bool output_packet_seen_ = false;
   };
 
   // PortSettings
@@ -226,11 +226,10 @@ zx::result<> profiler::KernelSampler::Stop() {
         std::get<trace::LargeRecordData::BlobEvent>(blob);
     // The blob we are given is an array of instruction pointers of size blob_size
     const uint64_t* read_head = reinterpret_cast<const uint64_t*>(blob_event.blob);
-    const std::vector<uint64_t> stack{read_head,
-                                      read_head + blob_event.blob_size / sizeof(uint64_t)};
+    std::vector<uint64_t> stack{read_head, read_head + blob_event.blob_size / sizeof(uint64_t)};
     const zx_koid_t pid = blob_event.process_thread.process_koid();
     const zx_koid_t tid = blob_event.process_thread.thread_koid();
-    samples_[pid].push_back({pid, tid, std::move(stack)});
+    RecordSample({pid, tid, std::move(stack)});
 
     // TODO(gmtr) figure out how properly measure the overhead of kernel sampling
     inspecting_durations_.emplace_back(0);
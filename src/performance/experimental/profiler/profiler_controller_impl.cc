@@ -544,7 +544,7 @@ void profiler::ProfilerControllerImpl::Stop(StopCompleter::Sync& completer) {
     }
   }
 
-  const auto samples = sampler_->GetSamples();
+  const auto& samples = sampler_->GetSamples();
   std::vector<zx::ticks> inspecting_durations = sampler_->SamplingDurations();
 
   fuchsia_cpu_profiler::SessionStopResponse stats{{
@@ -585,7 +585,7 @@ void profiler::ProfilerControllerImpl::Stop(StopCompleter::Sync& completer) {
   completer.Reply(std::move(stats));
 
   FX_LOGS(DEBUG) << "Sending samples.";
-  for (const auto& [pid, samples] : sampler_->GetSamples()) {
+  for (const auto& [pid, samples] : samples) {
     if (!fsl::BlockingCopyFromString(profiler::symbolizer_markup::kReset, socket_)) {
       FX_LOGS(ERROR) << "Failed to write symbolizer markup to socket";
       return;
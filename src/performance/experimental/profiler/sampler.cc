@@ -34,9 +34,11 @@
 #include "symbolization_context.h"
 #include "targets.h"
 
+// Sets |*out_blocked| to whether the thread was blocked, as opposed to running, when sampled.
 std::pair<zx::ticks, std::vector<uint64_t>> SampleThread(const zx::unowned_process& process,
                                                          const zx::unowned_thread& thread,
-                                                         unwinder::FramePointerUnwinder& unwinder) {
+                                                         unwinder::FramePointerUnwinder& unwinder,
+                                                         bool* out_blocked) {
   TRACE_DURATION("cpu_profiler", __PRETTY_FUNCTION__);
   zx_info_thread_t thread_info;
   zx_status_t status =
@@ -52,6 +54,7 @@ std::pair<zx::ticks, std::vector<uint64_t>> SampleThread(const zx::unowned_proce
         (thread_info.state & ZX_THREAD_STATE_BLOCKED))) {
     return {zx::ticks(), std::vector<uint64_t>()};
   }
+  *out_blocked = thread_info.state != ZX_THREAD_STATE_RUNNING;
 
   zx::ticks before = zx::ticks::now();
   zx::suspend_token suspend_token;
@@ -246,7 +249,8 @@ zx::result<> profiler::Sampler::Start(size_t buffer_size_mb /* unused, we buffer
 zx::result<> profiler::Sampler::Stop() {
   TRACE_DURATION("cpu_profiler", __PRETTY_FUNCTION__);
   sample_task_.Cancel();
-  FX_LOGS(INFO) << "Stopped! Collected " << inspecting_durations_.size() << " samples";
+  FX_LOGS(INFO) << "Stopped! Collected " << inspecting_durations_.size() << " samples ("
+                << blocked_samples_ << " of blocked threads)";
   sample_task_.Cancel();
   return zx::ok();
 }
@@ -264,10 +268,11 @@ void profiler::Sampler::CollectSamples(async_dispatcher_t* dispatcher, async::Ta
           TRACE_DURATION("cpu_profiler", "Sampler::CollectSamples/ForEachProcess");
           unwinder::CfiUnwinder cfi_unwinder{target.unwinder_data->modules};
           unwinder::FramePointerUnwinder fp_unwinder{&cfi_unwinder};
+          bool blocked = false;
           auto [time_sampling, pcs] =
-              SampleThread(target.handle.borrow(), thread.handle.borrow(), fp_unwinder);
+              SampleThread(target.handle.borrow(), thread.handle.borrow(), fp_unwinder, &blocked);
           if (time_sampling != zx::ticks()) {
-            samples_[target.pid].push_back({target.pid, thread.tid, pcs});
+            RecordSample({target.pid, thread.tid, std::move(pcs), blocked});
             inspecting_durations_.push_back(time_sampling);
           }
         }
@@ -281,6 +286,38 @@ void profiler::Sampler::CollectSamples(async_dispatcher_t* dispatcher, async::Ta
   sample_task_.PostDelayed(dispatcher_, zx::msec(10));
 }
 
+void profiler::Sampler::RecordSample(Sample sample) {
+  if (sample.blocked) {
+    blocked_samples_++;
+  }
+
+  // FNV-1a over the thread, state, and stack.
+  uint64_t hash = 0xcbf29ce484222325;
+  auto mix = [&hash](uint64_t value) {
+    hash ^= value;
+    hash *= 0x100000001b3;
+  };
+  mix(sample.tid);
+  mix(sample.blocked);
+  for (uint64_t pc : sample.stack) {
+    mix(pc);
+  }
+
+  std::vector<Sample>& samples = samples_[sample.pid];
+  std::unordered_multimap<uint64_t, size_t>& index = sample_index_[sample.pid];
+  auto [begin, end] = index.equal_range(hash);
+  for (auto it = begin; it != end; ++it) {
+    Sample& existing = samples[it->second];
+    if (existing.tid == sample.tid && existing.blocked == sample.blocked &&
+        existing.stack == sample.stack) {
+      existing.count += sample.count;
+      return;
+    }
+  }
+  index.emplace(hash, samples.size());
+  samples.push_back(std::move(sample));
+}
+
 zx::result<profiler::SymbolizationContext> profiler::Sampler::GetContexts() {
   TRACE_DURATION("cpu_profiler", __PRETTY_FUNCTION__);
   std::map<zx_koid_t, std::vector<profiler::Module>> contexts;
@@ -36,6 +36,11 @@ struct Sample {
   zx_koid_t pid;
   zx_koid_t tid;
   std::vector<uint64_t> stack;
+  // Whether the thread was blocked, rather than running, when it was sampled. Samples of blocked
+  // threads show where time is spent off-CPU; their stacks end in the blocking call.
+  bool blocked = false;
+  // The number of identical samples this entry stands for.
+  uint64_t count = 1;
 };
 
 class Sampler {
@@ -52,7 +57,7 @@ class Sampler {
   // Return the information needed to symbolize the samples
   zx::result<profiler::SymbolizationContext> GetContexts();
 
-  std::unordered_map<zx_koid_t, std::vector<Sample>> GetSamples() { return samples_; }
+  const std::unordered_map<zx_koid_t, std::vector<Sample>>& GetSamples() const { return samples_; }
   std::vector<zx::ticks> SamplingDurations() { return inspecting_durations_; }
   virtual zx::result<> AddTarget(JobTarget&& target);
   virtual ~Sampler() = default;
@@ -65,6 +70,11 @@ class Sampler {
 
   void CollectSamples(async_dispatcher_t* dispatcher, async::TaskBase* task, zx_status_t status);
 
+  // Adds |sample| to |samples_|. A sample identical to one already recorded for the same thread
+  // only increments that entry's count, so memory grows with the number of distinct stacks rather
+  // than with the length of the session.
+  void RecordSample(Sample sample);
+
   async_dispatcher_t* dispatcher_;
   async::TaskMethod<profiler::Sampler, &profiler::Sampler::CollectSamples> sample_task_{this};
 
@@ -72,6 +82,10 @@ class Sampler {
   std::vector<fuchsia_cpu_profiler::SamplingConfig> sample_specs_;
   std::vector<zx::ticks> inspecting_durations_;
   std::unordered_map<zx_koid_t, std::vector<Sample>> samples_;
+  // The number of samples in |samples_| taken of blocked threads.
+  size_t blocked_samples_ = 0;
+  // For each process, the index in |samples_| of each distinct sample, keyed by the sample's hash.
+  std::unordered_map<zx_koid_t, std::unordered_multimap<uint64_t, size_t>> sample_index_;
 
   // Watchers cannot be moved, so we need to box them
   std::unordered_map<zx_koid_t, std::unique_ptr<ProcessWatcher>> process_watchers_;
@@ -41,12 +41,16 @@ std::string profiler::symbolizer_markup::FormatSample(const profiler::Sample& sa
   TRACE_DURATION("cpu_profiler", __PRETTY_FUNCTION__);
   std::string markup;
   ::symbolizer_markup::Writer writer(Sink{markup});
-  writer.DecimalDigits(sample.pid).Newline().DecimalDigits(sample.tid).Newline();
-  for (unsigned n = 0; n < sample.stack.size(); n++) {
-    if (n == 0) {
-      writer.ExactPcFrame(n, sample.stack[n]).Newline();
-    } else {
-      writer.ReturnAddressFrame(n, sample.stack[n]).Newline();
+  // The markup has no notion of a sample count, so a deduplicated sample is expanded back into one
+  // copy per occurrence.
+  for (uint64_t i = 0; i < sample.count; i++) {
+    writer.DecimalDigits(sample.pid).Newline().DecimalDigits(sample.tid).Newline();
+    for (unsigned n = 0; n < sample.stack.size(); n++) {
+      if (n == 0) {
+        writer.ExactPcFrame(n, sample.stack[n]).Newline();
+      } else {
+        writer.ReturnAddressFrame(n, sample.stack[n]).Newline();
+      }
     }
   }
   return markup;
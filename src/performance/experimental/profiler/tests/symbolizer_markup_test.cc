@@ -26,6 +26,22 @@ TEST(SymbolizMarkupTest, FormatSample) {
   EXPECT_EQ(expected, formatted);
 }
 
+TEST(SymbolizMarkupTest, FormatDeduplicatedSample) {
+  profiler::Sample sample{.pid = 1, .tid = 2, .stack = {1, 2}, .count = 2};
+
+  std::string formatted = profiler::symbolizer_markup::FormatSample(sample);
+  std::string expected =
+      "1\n"
+      "2\n"
+      "{{{bt:0:0x1:pc}}}\n"
+      "{{{bt:1:0x2:ra}}}\n"
+      "1\n"
+      "2\n"
+      "{{{bt:0:0x1:pc}}}\n"
+      "{{{bt:1:0x2:ra}}}\n";
+  EXPECT_EQ(expected, formatted);
+}
+
 TEST(SymbolizMarkupTest, FormatModule) {
   profiler::Module mod{
       .module_id = 1,
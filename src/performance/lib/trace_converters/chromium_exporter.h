@@ -5,6 +5,7 @@
 #ifndef SRC_PERFORMANCE_LIB_TRACE_CONVERTERS_CHROMIUM_EXPORTER_H_
 #define SRC_PERFORMANCE_LIB_TRACE_CONVERTERS_CHROMIUM_EXPORTER_H_
 
+#include <array>
 #include <memory>
 #include <ostream>
 #include <tuple>
@@ -13,7 +14,6 @@
 
 #include <trace-reader/reader.h>
 
-#include "rapidjson/ostreamwrapper.h"
 #include "rapidjson/writer.h"
 #include "src/performance/lib/perfmon/writer.h"
 
@@ -43,9 +43,41 @@ class ChromiumExporter {
   // "args" key object.
   void WriteArgs(const std::vector<trace::Argument>& arguments);
 
+  // A rapidjson output stream which batches writes to the underlying std::ostream.
+  // rapidjson::OStreamWrapper calls std::ostream::put() for every character, which dominates the
+  // conversion time of large traces.
+  class BufferedOStreamWrapper {
+   public:
+    using Ch = char;
+
+    explicit BufferedOStreamWrapper(std::ostream& out) : out_(out) {}
+    ~BufferedOStreamWrapper() { Flush(); }
+
+    void Put(char c) {
+      if (size_ == buffer_.size()) {
+        Drain();
+      }
+      buffer_[size_++] = c;
+    }
+    void Flush() {
+      Drain();
+      out_.flush();
+    }
+
+   private:
+    void Drain() {
+      out_.write(buffer_.data(), static_cast<std::streamsize>(size_));
+      size_ = 0;
+    }
+
+    std::ostream& out_;
+    std::array<char, 64 * 1024> buffer_;
+    size_t size_ = 0;
+  };
+
   std::unique_ptr<std::ostream> stream_out_;
-  rapidjson::OStreamWrapper wrapper_;
-  rapidjson::Writer<rapidjson::OStreamWrapper> writer_;
+  BufferedOStreamWrapper wrapper_;
+  rapidjson::Writer<BufferedOStreamWrapper> writer_;
 
   // Scale factor to get to microseconds.
   // By default ticks are in nanoseconds.
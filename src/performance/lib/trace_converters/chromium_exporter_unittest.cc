@@ -5,6 +5,7 @@
 #include "src/performance/lib/trace_converters/chromium_exporter.h"
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -136,6 +137,32 @@ TEST(ChromiumExporterTest, EmptyTrace) {
             "],\"systemTraceEvents\":{\"type\":\"fuchsia\",\"events\":[]}}");
 }
 
+TEST(ChromiumExporterTest, LargeTraceIsWrittenCompletely) {
+  constexpr size_t kNumEvents = 10000;
+  std::string expected_events;
+
+  std::ostringstream out_stream;
+  {
+    tracing::ChromiumExporter exporter(out_stream);
+    for (size_t i = 0; i < kNumEvents; i++) {
+      trace::EventData data(trace::EventData::Instant{trace::EventScope::kGlobal});
+      trace::Record record(trace::Record::Event{1000, trace::ProcessThread(45, 46), "cat", "name",
+                                                {}, std::move(data)});
+      exporter.ExportRecord(record);
+      if (i > 0) {
+        expected_events += ",";
+      }
+      expected_events +=
+          "{\"cat\":\"cat\",\"name\":\"name\",\"ts\":1.0,\"pid\":45,\"tid\":46,\"ph\":"
+          "\"i\",\"s\":\"g\"}";
+    }
+  }
+
+  // The output is much larger than the exporter's write buffer.
+  EXPECT_EQ(out_stream.str(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" + expected_events +
+                                  "],\"systemTraceEvents\":{\"type\":\"fuchsia\",\"events\":[]}}");
+}
+
 TEST(ChromiumExporterTest, LastBranchRecords) {
   const unsigned num_branches = 4;
   char blob[perfmon::LastBranchRecordBlobSize(num_branches)];
@@ -74,8 +74,11 @@ void Recorder::MaybeRecordAllocation(void* address, size_t size) {
 
   // Store the address of the allocation.
   {
-    fbl::AutoLock lock(&lock_);
-    recorded_allocations_.emplace(address);
+    fbl::AutoLock lock(&allocations_lock_);
+    if (recorded_allocations_.emplace(address).second) {
+      sampled_address_filter_[SampledAddressFilterSlot(address)].fetch_add(
+          1, std::memory_order_relaxed);
+    }
   }
 
   RecordAllocation(address, size);
@@ -97,13 +100,20 @@ void Recorder::RecordAllocation(void* address, size_t size) {
 }
 
 void Recorder::MaybeForgetAllocation(void* address) {
+  // An allocation is recorded before it is returned to the program, so a deallocation of a recorded
+  // address always observes its slot as non-zero.
+  std::atomic<uint32_t>& slot = sampled_address_filter_[SampledAddressFilterSlot(address)];
+  if (slot.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
   {
-    fbl::AutoLock lock(&lock_);
+    fbl::AutoLock lock(&allocations_lock_);
     auto allocation = recorded_allocations_.find(address);
     if (allocation == recorded_allocations_.end()) {
       return;
     }
     recorded_allocations_.erase(allocation);
+    slot.fetch_sub(1, std::memory_order_relaxed);
   }
 
   ForgetAllocation(address);
@@ -173,6 +183,15 @@ void Recorder::SetModulesInfo() {
   }
 }
 
+size_t Recorder::SampledAddressFilterSlot(void* address) {
+  // Allocations are at least 16-byte aligned, so the low bits carry no information. Fibonacci
+  // hashing spreads the rest over the slots.
+  static_assert((kSampledAddressFilterSize & (kSampledAddressFilterSize - 1)) == 0);
+  constexpr int kSlotBits = __builtin_ctzll(kSampledAddressFilterSize);
+  const uint64_t hash = (reinterpret_cast<uint64_t>(address) >> 4) * 0x9e3779b97f4a7c15ull;
+  return static_cast<size_t>(hash >> (64 - kSlotBits));
+}
+
 Recorder::Recorder(fidl::SyncClient<fuchsia_memory_sampler::Sampler> client,
                    std::function<PoissonSampler&()> get_poisson_sampler)
     : client_(std::move(client)), GetPoissonSampler(std::move(get_poisson_sampler)) {}
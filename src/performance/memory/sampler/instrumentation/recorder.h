@@ -8,6 +8,8 @@
 #include <fidl/fuchsia.memory.sampler/cpp/fidl.h>
 #include <lib/component/incoming/cpp/protocol.h>
 
+#include <array>
+#include <atomic>
 #include <unordered_set>
 
 #include <fbl/macros.h>
@@ -36,10 +38,11 @@ class Recorder {
   static Recorder *GetIfReady();
   // Decides whether to discard or sample this allocation, and acts
   // appropriately.
-  void MaybeRecordAllocation(void *address, size_t size) __TA_EXCLUDES(&lock_);
+  void MaybeRecordAllocation(void *address, size_t size)
+      __TA_EXCLUDES(&lock_, &allocations_lock_);
   // Decides whether to discard or sample this deallocation, and acts
   // appropriately.
-  void MaybeForgetAllocation(void *address) __TA_EXCLUDES(&lock_);
+  void MaybeForgetAllocation(void *address) __TA_EXCLUDES(&lock_, &allocations_lock_);
   // Collects the module layout of the current process and
   // communicates it to the profiler.
   void SetModulesInfo();
@@ -54,14 +57,26 @@ class Recorder {
   // The average count of bytes allocated between two samples.
   static constexpr size_t kSamplingIntervalBytes = static_cast<size_t>(128 * 1024);
 
+  // The number of slots in |sampled_address_filter_|.
+  static constexpr size_t kSampledAddressFilterSize = 4096;
+
  private:
   Recorder(fidl::SyncClient<fuchsia_memory_sampler::Sampler> client,
            std::function<PoissonSampler &()> get_poisson_sampler);
   // Initializes the singleton into statically-allocated storage.
   static void InitSingletonOnce();
+  // Returns the slot of |sampled_address_filter_| that counts |address|.
+  static size_t SampledAddressFilterSlot(void *address);
+
   fbl::Mutex lock_;
   fidl::SyncClient<fuchsia_memory_sampler::Sampler> client_ __TA_GUARDED(&lock_);
-  std::unordered_set<void *> recorded_allocations_ __TA_GUARDED(&lock_);
+  // Kept separate from |lock_| so that deallocations don't wait for another thread's FIDL call.
+  fbl::Mutex allocations_lock_;
+  std::unordered_set<void *> recorded_allocations_ __TA_GUARDED(&allocations_lock_);
+  // A counting filter over |recorded_allocations_|: each slot counts the recorded addresses that
+  // hash to it. Every deallocation passes through |MaybeForgetAllocation|, and almost none of them
+  // are of sampled allocations; a zero slot lets those return without taking a lock.
+  std::array<std::atomic<uint32_t>, kSampledAddressFilterSize> sampled_address_filter_{};
   std::function<PoissonSampler &()> GetPoissonSampler;
 
   // Records an allocation's address and size and communicates it to
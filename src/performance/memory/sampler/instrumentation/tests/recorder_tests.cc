@@ -235,5 +235,40 @@ TEST(RecorderTest, MaybeForgetAllocationIsNoOpIfAllocationWasNotSampled) {
   recorder.MaybeForgetAllocation(kTestAddress);
   loop.RunUntilIdle();
 }
+TEST(RecorderTest, UnsampledDeallocationsDoNotForgetSampledAllocations) {
+  // Sampler server that verifies the sampled allocation was forgotten exactly once.
+  class Sampler : public SamplerImpl {
+   public:
+    using SamplerImpl::SamplerImpl;
+    void RecordAllocation(fuchsia_memory_sampler::wire::SamplerRecordAllocationRequest* request,
+                          RecordAllocationCompleter::Sync& completer) override {}
+    void RecordDeallocation(fuchsia_memory_sampler::wire::SamplerRecordDeallocationRequest* request,
+                            RecordDeallocationCompleter::Sync& completer) override {
+      EXPECT_EQ(reinterpret_cast<uint64_t>(kTestAddress), request->address);
+      deallocations_++;
+    }
+    ~Sampler() override { EXPECT_EQ(1U, deallocations_); }
+
+   private:
+    size_t deallocations_ = 0;
+  };
+
+  async::Loop loop(&kAsyncLoopConfigNeverAttachToThread);
+  async_dispatcher_t* dispatcher = loop.dispatcher();
+  auto endpoints = fidl::CreateEndpoints<fuchsia_memory_sampler::Sampler>();
+  Sampler sampler{dispatcher, std::move(endpoints->server)};
+
+  auto recorder = memory_sampler::Recorder::CreateRecorderForTesting(
+      fidl::SyncClient{std::move(endpoints->client)}, GetSamplerThatAlwaysSamples);
+  recorder.MaybeRecordAllocation(kTestAddress, kTestSize);
+
+  // Enough unrecorded addresses that some share a filter slot with |kTestAddress|.
+  for (uintptr_t i = 1; i <= 4 * Recorder::kSampledAddressFilterSize; i++) {
+    recorder.MaybeForgetAllocation(reinterpret_cast<void*>(0x100000 + i * 16));
+  }
+  recorder.MaybeForgetAllocation(kTestAddress);
+  recorder.MaybeForgetAllocation(kTestAddress);
+  loop.RunUntilIdle();
+}
 }  // namespace
 }  // namespace memory_sampler
@@ -0,0 +1,77 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/trace/event.h>
+
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <perftest/perftest.h>
+#include <trace-test-utils/fixture.h>
+
+namespace {
+
+// Measures how fast the trace engine accepts records when several threads in one process write
+// duration events at the same time. Unlike the streaming benchmark, the engine runs in-process
+// against a fixture handler, so the numbers only cover record allocation and encoding, not moving
+// the data to trace_manager.
+//
+// Each thread writes |kEventsPerThread| begin/end pairs per run, so the records/sec throughput is
+// 2 * kEventsPerThread * num_threads / the "write" step time.
+constexpr size_t kEventsPerThread = 10000;
+
+// Large enough that the circular buffer only wraps a handful of times per run.
+constexpr size_t kBufferSize = size_t{32} * 1024 * 1024;
+
+template <size_t num_threads>
+bool EngineThroughput(perftest::RepeatState* state) {
+  state->DeclareStep("setup");
+  state->DeclareStep("write");
+  state->DeclareStep("cleanup");
+
+  fixture_set_up_with_categories(kNoAttachToThread, TRACE_BUFFERING_MODE_CIRCULAR, kBufferSize,
+                                 std::vector<std::string>{"benchmark"});
+  fixture_initialize_and_start_tracing();
+
+  while (state->KeepRunning()) {
+    std::latch ready{num_threads + 1};
+    std::latch start{1};
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++) {
+      threads.emplace_back([&ready, &start] {
+        ready.count_down();
+        start.wait();
+        for (size_t j = 0; j < kEventsPerThread; j++) {
+          TRACE_DURATION_BEGIN("benchmark", "EngineThroughput");
+          TRACE_DURATION_END("benchmark", "EngineThroughput");
+        }
+      });
+    }
+    ready.arrive_and_wait();
+    state->NextStep();
+
+    start.count_down();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    state->NextStep();
+  }
+
+  fixture_stop_and_terminate_tracing();
+  fixture_tear_down();
+  return true;
+}
+
+void RegisterTests() {
+  perftest::RegisterTest("EngineThroughput/1Threads", EngineThroughput<1>);
+  perftest::RegisterTest("EngineThroughput/2Threads", EngineThroughput<2>);
+  perftest::RegisterTest("EngineThroughput/4Threads", EngineThroughput<4>);
+  perftest::RegisterTest("EngineThroughput/8Threads", EngineThroughput<8>);
+}
+
+PERFTEST_CTOR(RegisterTests)
+}  // namespace
@@ -89,7 +89,7 @@ uint64_t GetBufferWordsWritten(const uint64_t* buffer, uint64_t size_in_words) {
 
 TransferStatus BufferForwarder::WriteChunkBy(BufferForwarder::ForwardStrategy strategy,
                                              const zx::vmo& vmo, uint64_t vmo_offset,
-                                             uint64_t size) const {
+                                             uint64_t size, uint64_t* out_bytes_written) const {
   FX_LOGS(DEBUG) << ": Writing chunk: vmo offset 0x" << std::hex << vmo_offset << ", size 0x"
                  << std::hex << size
                  << (strategy == ForwardStrategy::Size ? ", by-size" : ", by-record");
@@ -110,15 +110,18 @@ TransferStatus BufferForwarder::WriteChunkBy(BufferForwarder::ForwardStrategy st
   uint64_t page_aligned_offset = vmo_offset & (~(ZX_PAGE_SIZE - 1));
   uint64_t page_aligned_remainder = vmo_offset % ZX_PAGE_SIZE;
 
+  uint64_t map_size = size + page_aligned_remainder;
   zx_vaddr_t addr;
-  zx_status_t map_result = zx::vmar::root_self()->map(ZX_VM_PERM_READ, 0, vmo, page_aligned_offset,
-                                                      size + page_aligned_remainder, &addr);
+  zx_status_t map_result =
+      zx::vmar::root_self()->map(ZX_VM_PERM_READ, 0, vmo, page_aligned_offset, map_size, &addr);
   if (map_result != ZX_OK) {
     FX_PLOGS(ERROR, map_result) << "Failed to read data from buffer_vmo: "
                                 << "offset=" << page_aligned_offset << ", size=" << size;
     return TransferStatus::kProviderError;
   }
-  auto d = fit::defer([addr, size]() { zx::vmar::root_self()->unmap(addr, size); });
+  // Unmap the whole mapping: when |vmo_offset| isn't page aligned it extends past |size|, and
+  // unmapping only |size| bytes would leak the tail page of every chunk written.
+  auto d = fit::defer([addr, map_size]() { zx::vmar::root_self()->unmap(addr, map_size); });
 
   zx_vaddr_t offset_addr = addr + page_aligned_remainder;
   uint64_t bytes_written;
@@ -130,6 +133,9 @@ TransferStatus BufferForwarder::WriteChunkBy(BufferForwarder::ForwardStrategy st
   } else {
     bytes_written = size;
   }
+  if (out_bytes_written != nullptr) {
+    *out_bytes_written = bytes_written;
+  }
 
   return WriteBuffer({reinterpret_cast<const uint8_t*>(offset_addr), bytes_written});
 }
@@ -38,8 +38,12 @@ class BufferForwarder {
   // This function handles both cases. If |strategy| is ForwardStrategy::Record then run through the
   // buffer computing the size of each record until we find no more records. If |strategy| is
   // ForwardStrategy::Size then |size| is the number of bytes to write.
+  //
+  // The chunk is mapped and written to the socket directly from the mapping, so it is never copied
+  // into an intermediate buffer. If |out_bytes_written| is not null it is set to the number of
+  // bytes that were forwarded.
   TransferStatus WriteChunkBy(ForwardStrategy strategy, const zx::vmo& vmo, size_t vmo_offset,
-                              size_t size) const;
+                              size_t size, uint64_t* out_bytes_written = nullptr) const;
 
  private:
   // Writes the contents of |data| to the output socket. Returns
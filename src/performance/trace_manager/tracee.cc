@@ -8,6 +8,7 @@
 #include <lib/syslog/cpp/macros.h>
 #include <lib/trace-engine/fields.h>
 #include <lib/trace-provider/provider.h>
+#include <lib/zx/clock.h>
 
 #include <memory>
 
@@ -315,11 +316,23 @@ TransferStatus Tracee::WriteChunk(uint64_t offset, uint64_t last, uint64_t end,
       // If end is zero then the header wasn't updated when tracing stopped.
       end == 0) {
     uint64_t size = buffer_size - last;
-    return output_->WriteChunkBy(BufferForwarder::ForwardStrategy::Records, buffer_vmo_, offset,
-                                 size);
+    return ForwardChunk(BufferForwarder::ForwardStrategy::Records, offset, size);
   }
   uint64_t size = end - last;
-  return output_->WriteChunkBy(BufferForwarder::ForwardStrategy::Size, buffer_vmo_, offset, size);
+  return ForwardChunk(BufferForwarder::ForwardStrategy::Size, offset, size);
+}
+
+TransferStatus Tracee::ForwardChunk(BufferForwarder::ForwardStrategy strategy, uint64_t offset,
+                                    uint64_t size) const {
+  uint64_t bytes_written = 0;
+  zx::time start = zx::clock::get_monotonic();
+  TransferStatus status =
+      output_->WriteChunkBy(strategy, buffer_vmo_, offset, size, &bytes_written);
+  forward_time_ += zx::clock::get_monotonic() - start;
+  if (status == TransferStatus::kComplete) {
+    bytes_forwarded_ += bytes_written;
+  }
+  return status;
 }
 
 TransferStatus Tracee::TransferRecords() const {
@@ -442,6 +455,14 @@ TransferStatus Tracee::TransferRecords() const {
     FX_LOGS(INFO) << "Non-durable buffer: 0x" << std::hex << header->rolling_data_end(0) << ",0x"
                   << std::hex << header->rolling_data_end(1) << ", size 0x" << std::hex
                   << header->rolling_buffer_size();
+    if (forward_time_ > zx::duration(0)) {
+      FX_LOGS(INFO) << "Forwarded " << std::dec << bytes_forwarded_ << " bytes in "
+                    << forward_time_.to_msecs() << "ms ("
+                    << static_cast<double>(bytes_forwarded_) /
+                           (static_cast<double>(forward_time_.to_nsecs()) / ZX_SEC(1)) /
+                           (1024 * 1024)
+                    << " MiB/s)";
+    }
   }
 
   return TransferStatus::kComplete;
@@ -528,9 +549,9 @@ bool Tracee::DoTransferBuffer(uint32_t wrapped_count, uint64_t durable_data_end)
   if (durable_data_end > last_durable_data_end_) {
     uint64_t size = durable_data_end - last_durable_data_end_;
     FX_LOGS(DEBUG) << "Writing durable buffer for " << bundle_->name;
-    if (output_->WriteChunkBy(BufferForwarder::ForwardStrategy::Size, buffer_vmo_,
-                              durable_buffer_offset + last_durable_data_end_,
-                              size) != TransferStatus::kComplete) {
+    if (ForwardChunk(BufferForwarder::ForwardStrategy::Size,
+                     durable_buffer_offset + last_durable_data_end_,
+                     size) != TransferStatus::kComplete) {
       return false;
     }
   }
@@ -538,8 +559,8 @@ bool Tracee::DoTransferBuffer(uint32_t wrapped_count, uint64_t durable_data_end)
   uint64_t buffer_offset = header->GetRollingBufferOffset(buffer_number);
   auto name = buffer_number == 0 ? "rolling buffer 0" : "rolling buffer 1";
   FX_LOGS(DEBUG) << "Writing " << name << "for " << bundle_->name;
-  return output_->WriteChunkBy(BufferForwarder::ForwardStrategy::Size, buffer_vmo_, buffer_offset,
-                               rolling_data_end) == TransferStatus::kComplete;
+  return ForwardChunk(BufferForwarder::ForwardStrategy::Size, buffer_offset, rolling_data_end) ==
+         TransferStatus::kComplete;
 }
 
 void Tracee::NotifyBufferSaved(uint32_t wrapped_count, uint64_t durable_data_end) {
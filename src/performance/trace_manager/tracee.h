@@ -11,6 +11,7 @@
 #include <lib/fidl/cpp/vector.h>
 #include <lib/fit/function.h>
 #include <lib/zx/fifo.h>
+#include <lib/zx/time.h>
 #include <lib/zx/vmo.h>
 
 #include <iosfwd>
@@ -117,6 +118,9 @@ class Tracee {
   TransferStatus WriteProviderIdRecord() const;
   TransferStatus WriteChunk(uint64_t offset, uint64_t last, uint64_t end,
                             uint64_t buffer_size) const;
+  // Forwards a chunk of |buffer_vmo_| to |output_|, accounting for it in the transfer stats.
+  TransferStatus ForwardChunk(BufferForwarder::ForwardStrategy strategy, uint64_t offset,
+                              uint64_t size) const;
 
   void NotifyBufferSaved(uint32_t wrapped_count, uint64_t durable_data_end);
 
@@ -159,6 +163,11 @@ class Tracee {
   // Final trace stats
   mutable controller::ProviderStats provider_stats_;
 
+  // Total bytes forwarded to the output socket, and the time spent forwarding them, over all of the
+  // streaming buffer saves and the final transfer.
+  mutable uint64_t bytes_forwarded_ = 0;
+  mutable zx::duration forward_time_;
+
   fxl::WeakPtrFactory<Tracee> weak_ptr_factory_;
 
   Tracee(const Tracee&) = delete;
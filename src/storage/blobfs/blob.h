@@ -159,6 +159,7 @@ class Blob final : public CacheNode, fbl::Recyclable<Blob> {
   BlobCache& GetCache() final;
   bool ShouldCache() const final __TA_EXCLUDES(mutex_);
   void ActivateLowMemory() final __TA_EXCLUDES(mutex_);
+  uint64_t CachedBytes() const final __TA_EXCLUDES(mutex_) { return FileSize(); }
 
   // Returns a clone of the blobfs VMO.
   //
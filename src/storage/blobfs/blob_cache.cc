@@ -46,7 +46,24 @@ void BlobCache::Reset() {
   ResetLocked();
 }
 
+void BlobCache::SetCacheBudget(uint64_t budget_bytes) {
+  fbl::AutoLock lock(&hash_lock_);
+  cache_budget_ = budget_bytes;
+  TrimRecentlyClosedLocked();
+}
+
+void BlobCache::TrimRecentlyClosedLocked() {
+  while (recently_closed_bytes_ > cache_budget_ && !recently_closed_.is_empty()) {
+    CacheNode* node = recently_closed_.pop_front();
+    recently_closed_bytes_ -= node->CachedBytes();
+    node->ActivateLowMemory();
+  }
+}
+
 void BlobCache::ResetLocked() {
+  recently_closed_.clear();
+  recently_closed_bytes_ = 0;
+
   // All nodes in closed_hash_ have been leaked. If we're attempting to reset the
   // cache, these nodes must be explicitly deleted.
   CacheNode* node = nullptr;
@@ -237,6 +254,11 @@ void BlobCache::Downgrade(CacheNode* raw_vnode) {
       break;
     case CachePolicy::NeverEvict:
       break;
+    case CachePolicy::EvictLeastRecentlyUsed:
+      recently_closed_.push_back(vnode.get());
+      recently_closed_bytes_ += vnode->CachedBytes();
+      TrimRecentlyClosedLocked();
+      break;
     default:
       ZX_ASSERT_MSG(false, "Unexpected cache policy");
   }
@@ -252,6 +274,10 @@ fbl::RefPtr<CacheNode> BlobCache::UpgradeLocked(const Digest& key) {
   if (raw_vnode == nullptr) {
     return nullptr;
   }
+  if (raw_vnode->recently_closed_node_state_.InContainer()) {
+    recently_closed_.erase(*raw_vnode);
+    recently_closed_bytes_ -= raw_vnode->CachedBytes();
+  }
   open_hash_.insert(raw_vnode);
   // To have existed in the closed_hash_, this RefPtr must have been leaked. See the complement of
   // this adoption in Downgrade.
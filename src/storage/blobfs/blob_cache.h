@@ -42,6 +42,9 @@ class BlobCache {
   BlobCache();
   ~BlobCache();
 
+  // The default memory budget for |CachePolicy::EvictLeastRecentlyUsed|.
+  static constexpr uint64_t kDefaultCacheBudget = 64ull * 1024 * 1024;
+
   // Empties the cache, evicting all open nodes and deleting all closed nodes.
   void Reset();
 
@@ -50,6 +53,12 @@ class BlobCache {
   // Refer to the declaration of |CachePolicy| for more information.
   void SetCachePolicy(CachePolicy policy) { cache_policy_ = policy; }
 
+  // Sets the amount of memory, in bytes, that closed nodes may keep in use under
+  // |CachePolicy::EvictLeastRecentlyUsed|. Nodes beyond the budget are placed in the low-memory
+  // state immediately, oldest first, so this may also be used to shrink the cache in response to
+  // memory pressure.
+  void SetCacheBudget(uint64_t budget_bytes) __TA_EXCLUDES(hash_lock_);
+
   // Iterates over all non-evicted cached nodes with strong references, invoking |callback| on each
   // one.
   //
@@ -122,6 +131,10 @@ class BlobCache {
   // Resets the cache by deleting all members |closed_hash_|.
   void ResetLocked() __TA_REQUIRES(hash_lock_);
 
+  // Places the least recently closed nodes in the low-memory state until the remaining ones fit
+  // within |cache_budget_|.
+  void TrimRecentlyClosedLocked() __TA_REQUIRES(hash_lock_);
+
   // We need to define this structure to allow the CacheNodes to be indexable by a key which is
   // larger than a primitive type: the keys are 'digest::kSha256Length' bytes long.
   struct MerkleRootTraits {
@@ -144,6 +157,12 @@ class BlobCache {
   // All 'closed' blobs.
   WAVLTreeByMerkle closed_hash_ __TA_GUARDED(hash_lock_);
 
+  // The subset of |closed_hash_| that is being kept out of the low-memory state under
+  // |CachePolicy::EvictLeastRecentlyUsed|, ordered from least to most recently closed.
+  CacheNode::RecentlyClosedList recently_closed_ __TA_GUARDED(hash_lock_);
+  uint64_t recently_closed_bytes_ __TA_GUARDED(hash_lock_) = 0;
+  uint64_t cache_budget_ __TA_GUARDED(hash_lock_) = kDefaultCacheBudget;
+
   // A condition variable which is signalled whenever a CacheNode has been removed from the
   // |open_hash_|. When a CacheNode runs out of references, it exists in the |open_hash_| with no
   // strong references for a short period of time before being removed and either resurrected or
@@ -387,6 +387,8 @@ zx::result<std::optional<Blob::WrittenBlob>> Blob::Writer::WriteInternal(Blob& b
   // decompressor to update the Merkle tree via a callback, otherwise we update it directly.
   if (streaming_decompressor_) {
     // Update the decompressor with the data we got since the last write.
+    TRACE_DURATION("blobfs", "Blob::Writer::Decompress", "len",
+                   payload_written() - payload_processed_);
     zx::result status = streaming_decompressor_->Update(
         {payload() + payload_processed_, payload_written() - payload_processed_});
     if (status.is_error()) {
@@ -694,6 +696,7 @@ zx::result<> Blob::Writer::Initialize(uint64_t blob_size, uint64_t data_size) {
 }
 
 zx::result<> Blob::Writer::StreamBufferedData() {
+  TRACE_DURATION("blobfs", "Blob::Writer::StreamBufferedData");
   if (!allocated_space_) {
     if (zx::result status = SpaceAllocate(); status.is_error()) {
       return status.take_error();
@@ -95,6 +95,10 @@ using ::fs::JournalSuperblock;
 using ::id_allocator::IdAllocator;
 using ::storage::BlockingRingBuffer;
 
+// Upper bound on the number of ranges recorded by the page-in trace, which keeps the Inspect
+// snapshot of it to a reasonable size.
+constexpr size_t kPageInTraceMaxEntries = 4096;
+
 struct DirectoryCookie {
   size_t index;       // Index into node map
   uint64_t reserved;  // Unused
@@ -106,6 +110,8 @@ const char* CachePolicyToString(CachePolicy policy) {
       return "NEVER_EVICT";
     case CachePolicy::EvictImmediately:
       return "EVICT_IMMEDIATELY";
+    case CachePolicy::EvictLeastRecentlyUsed:
+      return "EVICT_LEAST_RECENTLY_USED";
   }
 }
 
@@ -213,6 +219,11 @@ zx::result<std::unique_ptr<Blobfs>> Blobfs::Create(async_dispatcher_t* dispatche
   }
   fs->page_loader_ = std::move(page_loader_or).value();
   FX_LOGS(INFO) << "Initialized user pager with " << options.paging_threads << " threads";
+  if (options.page_in_trace_duration > zx::duration(0)) {
+    FX_LOGS(INFO) << "Recording page-in trace for " << options.page_in_trace_duration.to_secs()
+                  << " seconds";
+    fs->GetMetrics()->StartPageInTrace(options.page_in_trace_duration, kPageInTraceMaxEntries);
+  }
 
   JournalSuperblock journal_superblock;
   if (options.writability != blobfs::Writability::ReadOnlyDisk) {
@@ -620,7 +631,8 @@ void Blobfs::DeleteExtent(uint64_t start_block, uint64_t num_blocks,
 static_assert(sizeof(DirectoryCookie) <= sizeof(fs::VdirCookie),
               "Blobfs dircookie too large to fit in IO state");
 
-zx_status_t Blobfs::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual) {
+zx_status_t Blobfs::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual,
+                            std::vector<fs::VnodeAttributes>* attributes) {
   TRACE_DURATION("blobfs", "Blobfs::Readdir", "len", len);
   fs::DirentFiller df(dirents, len);
   DirectoryCookie* c = reinterpret_cast<DirectoryCookie*>(cookie);
@@ -648,6 +660,11 @@ zx_status_t Blobfs::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, s
       if (df.Next(name, VTYPE_TO_DTYPE(V_TYPE_FILE), ino) != ZX_OK) {
         break;
       }
+      if (attributes) {
+        // The blob is already in hand, so this avoids a cache lookup of its name per entry.
+        zx::result attrs = vnode->GetAttributes();
+        attributes->push_back(attrs.is_ok() ? *std::move(attrs) : fs::VnodeAttributes{});
+      }
       c->index = i + 1;
     }
   }
@@ -157,7 +157,10 @@ class Blobfs : public TransactionManager, public BlockIteratorProvider {
 
   BlobCache& GetCache() { return blob_cache_; }
 
-  zx_status_t Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual);
+  // Lists the blobs of the filesystem. If |attributes| is provided, the attributes of each blob
+  // listed are appended to it.
+  zx_status_t Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual,
+                      std::vector<fs::VnodeAttributes>* attributes = nullptr);
 
   BlockDevice* Device() const { return block_device_.get(); }
 
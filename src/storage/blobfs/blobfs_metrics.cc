@@ -39,6 +39,25 @@ BlobfsMetrics::BlobfsMetrics(bool should_record_page_in, inspect::Inspector insp
         return fpromise::make_result_promise(fpromise::ok(std::move(insp)));
       },
       &inspector_);
+
+  root_.CreateLazyNode(
+      "page_in_trace",
+      [this] {
+        inspect::Inspector insp;
+        std::lock_guard lock(page_in_trace_lock_);
+        insp.GetRoot().CreateUint("entries", page_in_trace_.size(), &insp);
+        insp.GetRoot().CreateUint("dropped", page_in_trace_dropped_, &insp);
+        for (size_t i = 0; i < page_in_trace_.size(); ++i) {
+          const PageInTraceEntry& entry = page_in_trace_[i];
+          inspect::Node node = insp.GetRoot().CreateChild(std::to_string(i));
+          node.CreateString("merkle_hash", entry.merkle_hash.c_str(), &insp);
+          node.CreateUint("offset", entry.offset, &insp);
+          node.CreateUint("length", entry.length, &insp);
+          insp.emplace(std::move(node));
+        }
+        return fpromise::make_result_promise(fpromise::ok(std::move(insp)));
+      },
+      &inspector_);
 }
 
 void BlobfsMetrics::UpdateAllocation(uint64_t size_data, const fs::Duration& duration) {
@@ -63,6 +82,8 @@ void BlobfsMetrics::UpdateClientWrite(uint64_t data_size, uint64_t merkle_size,
 
 void BlobfsMetrics::IncrementPageIn(const fbl::String& merkle_hash, uint64_t offset,
                                     uint64_t length) {
+  RecordPageInTrace(merkle_hash, offset, length);
+
   // Page-in metrics are a developer feature that is not intended to be used in production. Enabling
   // this feature also requires increasing the size of the Inspect VMO considerably (>512KB).
   if (!should_record_page_in_) {
@@ -100,4 +121,37 @@ void BlobfsMetrics::IncrementPageIn(const fbl::String& merkle_hash, uint64_t off
   }
 }
 
+void BlobfsMetrics::StartPageInTrace(zx::duration duration, size_t max_entries) {
+  std::lock_guard lock(page_in_trace_lock_);
+  page_in_trace_deadline_ = zx::deadline_after(duration);
+  page_in_trace_max_entries_ = max_entries;
+  page_in_trace_dropped_ = 0;
+  page_in_trace_.clear();
+}
+
+std::vector<PageInTraceEntry> BlobfsMetrics::GetPageInTrace() const {
+  std::lock_guard lock(page_in_trace_lock_);
+  return page_in_trace_;
+}
+
+void BlobfsMetrics::RecordPageInTrace(const fbl::String& merkle_hash, uint64_t offset,
+                                      uint64_t length) {
+  std::lock_guard lock(page_in_trace_lock_);
+  if (page_in_trace_max_entries_ == 0 || zx::clock::get_monotonic() >= page_in_trace_deadline_) {
+    return;
+  }
+  if (!page_in_trace_.empty()) {
+    PageInTraceEntry& last = page_in_trace_.back();
+    if (last.merkle_hash == merkle_hash && last.offset + last.length == offset) {
+      last.length += length;
+      return;
+    }
+  }
+  if (page_in_trace_.size() >= page_in_trace_max_entries_) {
+    ++page_in_trace_dropped_;
+    return;
+  }
+  page_in_trace_.push_back({merkle_hash, offset, length});
+}
+
 }  // namespace blobfs
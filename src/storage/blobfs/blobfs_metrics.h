@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include <fbl/string.h>
 
@@ -30,6 +31,13 @@ struct BlobPageInFrequencies {
   std::map<uint64_t, inspect::UintProperty> offset_map;
 };
 
+// A range of a blob that was paged in while the page-in trace was being recorded.
+struct PageInTraceEntry {
+  fbl::String merkle_hash;
+  uint64_t offset;
+  uint64_t length;
+};
+
 // Encapsulates Blobfs-specific metrics available via Inspect.
 //
 // TODO(https://fxbug.dev/42160612): Make this properly thread-safe.  IncrementPageIn(),
@@ -58,6 +66,15 @@ class BlobfsMetrics final {
   // has been set in the BUILD.gn
   void IncrementPageIn(const fbl::String& merkle_hash, uint64_t offset, uint64_t length);
 
+  // Starts recording the order in which blob ranges are paged in, for |duration| from now or until
+  // |max_entries| ranges have been recorded, whichever comes first. The recorded sequence is
+  // exposed through Inspect under "page_in_trace" so that it can be collected after boot and
+  // replayed as prefetches on the next one.
+  void StartPageInTrace(zx::duration duration, size_t max_entries);
+
+  // Returns a copy of the page-in trace recorded so far.
+  std::vector<PageInTraceEntry> GetPageInTrace() const;
+
   // Accessors for ReadMetrics. The metrics objects returned are NOT thread-safe. The metrics
   // objects are to be used by exactly one thread (main or pager). Used to increment relevant
   // metrics from the blobfs main thread and the user pager thread.
@@ -139,6 +156,16 @@ class BlobfsMetrics final {
   std::map<fbl::String, BlobPageInFrequencies> all_page_in_frequencies_
       __TA_GUARDED(frequencies_lock_);
 
+  // PAGE-IN TRACE
+  // Adjacent page-ins of the same blob are merged into a single entry.
+  void RecordPageInTrace(const fbl::String& merkle_hash, uint64_t offset, uint64_t length);
+
+  mutable std::mutex page_in_trace_lock_;
+  zx::time page_in_trace_deadline_ __TA_GUARDED(page_in_trace_lock_) = zx::time::infinite_past();
+  size_t page_in_trace_max_entries_ __TA_GUARDED(page_in_trace_lock_) = 0;
+  uint64_t page_in_trace_dropped_ __TA_GUARDED(page_in_trace_lock_) = 0;
+  std::vector<PageInTraceEntry> page_in_trace_ __TA_GUARDED(page_in_trace_lock_);
+
   // VERIFICATION STATS
   VerificationMetrics verification_metrics_;
 };
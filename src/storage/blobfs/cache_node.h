@@ -11,6 +11,7 @@
 
 #include <optional>
 
+#include <fbl/intrusive_double_list.h>
 #include <fbl/intrusive_wavl_tree.h>
 #include <fbl/recycler.h>
 
@@ -65,6 +66,14 @@ class CacheNode : public fs::PagedVnode,
   // implementation of this method must not attempt to acquire a reference to |this|.
   virtual void ActivateLowMemory() = 0;
 
+  // Returns an estimate of the memory, in bytes, that the node keeps in use while it is closed but
+  // not in the low-memory state. Used to enforce the budget of
+  // |CachePolicy::EvictLeastRecentlyUsed|.
+  //
+  // The implementation of this method must not invoke any other CacheNode methods. The
+  // implementation of this method must not attempt to acquire a reference to |this|.
+  virtual uint64_t CachedBytes() const { return 0; }
+
   // If the node should have a specific cache discipline, this method returns it. Otherwise, the
   // system-wide policy is applied.
   std::optional<CachePolicy> overriden_cache_policy() const { return overriden_cache_policy_; }
@@ -75,7 +84,19 @@ class CacheNode : public fs::PagedVnode,
   void RecycleNode() override;
 
  private:
+  friend class BlobCache;
+
+  // Allows nodes to be placed on the BlobCache's list of recently closed nodes.
+  struct RecentlyClosedListTraits {
+    static fbl::DoublyLinkedListNodeState<CacheNode*>& node_state(CacheNode& node) {
+      return node.recently_closed_node_state_;
+    }
+  };
+  using RecentlyClosedList =
+      fbl::DoublyLinkedListCustomTraits<CacheNode*, RecentlyClosedListTraits>;
+
   Digest digest_;
+  fbl::DoublyLinkedListNodeState<CacheNode*> recently_closed_node_state_;
   std::optional<CachePolicy> overriden_cache_policy_;
 };
 
@@ -24,6 +24,14 @@ enum class CachePolicy {
   // reduced, since the kernel can reclaim data pages as needed. This is the recommended
   // configuration. (Note that the kernel does not reclaim in-memory metadata such as merkle trees.)
   NeverEvict,
+
+  // When all strong references to a node are closed, the node is kept in memory on a
+  // least-recently-closed list. Once the nodes on that list use more memory than the cache budget
+  // (see |BlobCache::SetCacheBudget()|), the oldest are placed in the low-memory state as with
+  // |EvictImmediately|.
+  //
+  // This option bounds the memory cost of caching while keeping frequently reopened blobs warm.
+  EvictLeastRecentlyUsed,
 };
 
 }  // namespace blobfs
@@ -44,6 +44,12 @@ zx_status_t Directory::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len
   return blobfs_->Readdir(cookie, dirents, len, out_actual);
 }
 
+zx_status_t Directory::ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                             size_t* out_actual, fs::VnodeAttributesQuery query,
+                                             std::vector<fs::VnodeAttributes>* attributes) {
+  return blobfs_->Readdir(cookie, dirents, len, out_actual, attributes);
+}
+
 zx_status_t Directory::Read(void* data, size_t len, size_t off, size_t* out_actual) {
   return ZX_ERR_NOT_FILE;
 }
@@ -13,6 +13,7 @@
 
 #include <cstddef>
 #include <string_view>
+#include <vector>
 
 #include <fbl/ref_ptr.h>
 
@@ -33,6 +34,9 @@ class Directory final : public fs::Vnode {
   // fs::Vnode interface.
   fuchsia_io::NodeProtocolKinds GetProtocols() const final;
   zx_status_t Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual) final;
+  zx_status_t ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                    size_t* out_actual, fs::VnodeAttributesQuery query,
+                                    std::vector<fs::VnodeAttributes>* attributes) final;
   zx_status_t Read(void* data, size_t len, size_t off, size_t* out_actual) final;
   zx_status_t Write(const void* data, size_t len, size_t offset, size_t* out_actual) final;
   zx_status_t Append(const void* data, size_t len, size_t* out_end, size_t* out_actual) final;
@@ -4,16 +4,34 @@
 
 #include "src/storage/blobfs/metrics/read_metrics.h"
 
+#include <lib/fzl/time.h>
 #include <lib/inspect/cpp/vmo/types.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <string_view>
 #include <utility>
 
 #include "src/storage/blobfs/compression_settings.h"
 #include "src/storage/lib/vfs/cpp/ticker.h"
 
 namespace blobfs {
+namespace {
+
+// Page request latencies range from tens of microseconds for uncompressed data already in the
+// block cache to hundreds of milliseconds for large cold reads, so buckets start at 10us and double
+// up to ~160ms.
+inspect::ExponentialUintHistogram CreateLatencyHistogram(std::string_view name,
+                                                         inspect::Node& node) {
+  static constexpr uint64_t kFloor = 0;
+  static constexpr uint64_t kInitialStep = 10;
+  static constexpr uint64_t kStepMultiplier = 2;
+  static constexpr size_t kBuckets = 15;
+  return node.CreateExponentialUintHistogram(name, kFloor, kInitialStep, kStepMultiplier, kBuckets);
+}
+
+}  // namespace
 
 ReadMetrics::ReadMetrics(inspect::Node* read_metrics_node)
     : uncompressed_inspect_(read_metrics_node->CreateChild("uncompressed")),
@@ -26,7 +44,12 @@ ReadMetrics::PerCompressionInspect::PerCompressionInspect(inspect::Node node)
       read_ticks_node(parent_node.CreateInt("read_ticks", {})),
       read_bytes_node(parent_node.CreateUint("read_bytes", 0)),
       decompress_ticks_node(parent_node.CreateInt("decompress_ticks", {})),
-      decompress_bytes_node(parent_node.CreateUint("decompress_bytes", 0)) {}
+      decompress_bytes_node(parent_node.CreateUint("decompress_bytes", 0)),
+      page_request_ticks_node(parent_node.CreateInt("page_request_ticks", {})),
+      page_request_bytes_node(parent_node.CreateUint("page_request_bytes", 0)),
+      page_requests_node(parent_node.CreateUint("page_requests", 0)),
+      page_request_latency_us_node(CreateLatencyHistogram("page_request_latency_us", parent_node)) {
+}
 
 ReadMetrics::PerCompressionSnapshot ReadMetrics::GetSnapshot(CompressionAlgorithm algorithm) const {
   std::lock_guard lock(lock_);
@@ -85,6 +108,22 @@ void ReadMetrics::IncrementDecompression(CompressionAlgorithm algorithm, uint64_
   remote_decompressions_++;
 }
 
+void ReadMetrics::IncrementPageRequest(CompressionAlgorithm algorithm, uint64_t request_size,
+                                       fs::Duration duration) {
+  PerCompressionInspect& inspect = MutableInspect(algorithm);
+  inspect.page_request_ticks_node.Add(duration.get());
+  inspect.page_request_bytes_node.Add(request_size);
+  inspect.page_requests_node.Add(1);
+  inspect.page_request_latency_us_node.Insert(fzl::TicksToNs(duration).to_usecs());
+
+  // Hold the lock until snapshot goes out of scope.
+  std::lock_guard lock(lock_);
+  PerCompressionSnapshot& snapshot = MutableSnapshotLocked(algorithm);
+  snapshot.page_request_ticks += duration.get();
+  snapshot.page_request_bytes += request_size;
+  snapshot.page_requests++;
+}
+
 uint64_t ReadMetrics::GetRemoteDecompressions() const {
   std::lock_guard lock(lock_);
   return remote_decompressions_;
@@ -36,6 +36,11 @@ class ReadMetrics {
   void IncrementDecompression(CompressionAlgorithm algorithm, uint64_t decompressed_size,
                               fs::Duration decompress_duration) __TA_EXCLUDES(lock_);
 
+  // Increments aggregate information about page requests served by the pager since mounting.
+  // |duration| covers the whole request, from reading the data to supplying the pages.
+  void IncrementPageRequest(CompressionAlgorithm algorithm, uint64_t request_size,
+                            fs::Duration duration) __TA_EXCLUDES(lock_);
+
   struct PerCompressionSnapshot {
     // Metrics for reads from disk
     zx_ticks_t read_ticks = {};
@@ -44,6 +49,11 @@ class ReadMetrics {
     // Metrics for decompression
     zx_ticks_t decompress_ticks = {};
     uint64_t decompress_bytes = {};
+
+    // Metrics for page requests
+    zx_ticks_t page_request_ticks = {};
+    uint64_t page_request_bytes = {};
+    uint64_t page_requests = {};
   };
 
   // Returns a snapshot of metrics recorded by this class.
@@ -59,6 +69,11 @@ class ReadMetrics {
     inspect::UintProperty read_bytes_node;
     inspect::IntProperty decompress_ticks_node;
     inspect::UintProperty decompress_bytes_node;
+    inspect::IntProperty page_request_ticks_node;
+    inspect::UintProperty page_request_bytes_node;
+    inspect::UintProperty page_requests_node;
+    // Distribution of per-request latencies, in microseconds.
+    inspect::ExponentialUintHistogram page_request_latency_us_node;
   };
 
   PerCompressionSnapshot& MutableSnapshotLocked(CompressionAlgorithm algorithm)
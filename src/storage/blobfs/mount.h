@@ -9,6 +9,7 @@
 #include <fidl/fuchsia.process.lifecycle/cpp/wire.h>
 #include <lib/fidl/cpp/wire/channel.h>
 #include <lib/zx/resource.h>
+#include <lib/zx/time.h>
 #include <lib/zx/result.h>
 
 #include <optional>
@@ -45,6 +46,10 @@ struct MountOptions {
   DecompressorCreatorConnector* decompression_connector = nullptr;
 
   int paging_threads = 2;
+
+  // If non-zero, the order in which blob ranges are paged in is recorded for this long after
+  // mounting and exposed through Inspect. See |BlobfsMetrics::StartPageInTrace()|.
+  zx::duration page_in_trace_duration;
 #ifndef NDEBUG
   bool fsck_at_end_of_every_transaction = false;
 #endif
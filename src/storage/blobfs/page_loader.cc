@@ -225,9 +225,20 @@ PagerErrorStatus PageLoader::Worker::TransferPages(const PageLoader::PageSupplie
     return PagerErrorStatus::kErrBadState;
   }
 
-  if (info.decompressor)
-    return TransferChunkedPages(page_supplier, offset, length, info);
-  return TransferUncompressedPages(page_supplier, offset, length, info);
+  fs::Ticker ticker;
+  PagerErrorStatus status;
+  CompressionAlgorithm algorithm;
+  if (info.decompressor) {
+    algorithm = CompressionAlgorithm::kChunked;
+    status = TransferChunkedPages(page_supplier, offset, length, info);
+  } else {
+    algorithm = CompressionAlgorithm::kUncompressed;
+    status = TransferUncompressedPages(page_supplier, offset, length, info);
+  }
+  if (status == PagerErrorStatus::kOK) {
+    metrics_->paged_read_metrics().IncrementPageRequest(algorithm, length, ticker.End());
+  }
+  return status;
 }
 
 // The requested range is aligned in multiple steps as follows:
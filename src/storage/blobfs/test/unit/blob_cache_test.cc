@@ -9,6 +9,7 @@
 
 #include <iterator>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -37,6 +38,8 @@ class TestNode : public CacheNode, fbl::Recyclable<TestNode> {
 
   void ActivateLowMemory() final { using_memory_ = false; }
 
+  uint64_t CachedBytes() const final { return cached_bytes_; }
+
   // fs::PagedVnode implementation.
   void VmoRead(uint64_t offset, uint64_t length) override {
     ASSERT_TRUE(false);  // Should not get called in these tests.
@@ -48,6 +51,8 @@ class TestNode : public CacheNode, fbl::Recyclable<TestNode> {
 
   void SetHighMemory() { using_memory_ = true; }
 
+  void SetCachedBytes(uint64_t cached_bytes) { cached_bytes_ = cached_bytes; }
+
   fuchsia_io::NodeProtocolKinds GetProtocols() const final {
     return fuchsia_io::NodeProtocolKinds::kFile;
   }
@@ -56,6 +61,7 @@ class TestNode : public CacheNode, fbl::Recyclable<TestNode> {
   BlobCache* cache_;
   bool should_cache_ = true;
   bool using_memory_ = false;
+  uint64_t cached_bytes_ = 0;
 };
 
 Digest GenerateDigest(size_t seed) {
@@ -355,5 +361,45 @@ TEST_F(BlobCacheTest, CachePolicyOverrideSettingsRespected) {
   ASSERT_FALSE(node->UsingMemory());
 }
 
+TEST_F(BlobCacheTest, CachePolicyEvictLeastRecentlyUsed) {
+  BlobCache cache;
+  cache.SetCachePolicy(CachePolicy::EvictLeastRecentlyUsed);
+  cache.SetCacheBudget(2 * kBlobfsBlockSize);
+
+  // Close three nodes in order; only the two most recently closed fit within the budget.
+  std::vector<TestNode*> nodes;
+  for (size_t i = 0; i < 3; ++i) {
+    auto node = fbl::MakeRefCounted<TestNode>(vfs(), GenerateDigest(i), &cache);
+    node->SetHighMemory();
+    node->SetCachedBytes(kBlobfsBlockSize);
+    ASSERT_EQ(cache.Add(node), ZX_OK);
+    nodes.push_back(node.get());
+  }
+  EXPECT_FALSE(nodes[0]->UsingMemory());
+  EXPECT_TRUE(nodes[1]->UsingMemory());
+  EXPECT_TRUE(nodes[2]->UsingMemory());
+
+  // Reopening a node takes it off the recently closed list and closing it again makes it the most
+  // recent, so the next node to go over budget is evicted instead.
+  {
+    fbl::RefPtr<CacheNode> cache_node;
+    ASSERT_EQ(cache.Lookup(GenerateDigest(1), &cache_node), ZX_OK);
+  }
+  auto node = fbl::MakeRefCounted<TestNode>(vfs(), GenerateDigest(3), &cache);
+  node->SetHighMemory();
+  node->SetCachedBytes(kBlobfsBlockSize);
+  ASSERT_EQ(cache.Add(node), ZX_OK);
+  TestNode* last = node.get();
+  node.reset();
+  EXPECT_TRUE(nodes[1]->UsingMemory());
+  EXPECT_FALSE(nodes[2]->UsingMemory());
+  EXPECT_TRUE(last->UsingMemory());
+
+  // Shrinking the budget evicts the remaining nodes.
+  cache.SetCacheBudget(0);
+  EXPECT_FALSE(nodes[1]->UsingMemory());
+  EXPECT_FALSE(last->UsingMemory());
+}
+
 }  // namespace
 }  // namespace blobfs
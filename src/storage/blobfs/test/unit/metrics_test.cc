@@ -76,6 +76,33 @@ TEST(ReadMetricsTest, ChunkedDecompression) {
   EXPECT_EQ(read_metrics.GetRemoteDecompressions(), static_cast<uint64_t>(kNumOperations));
 }
 
+TEST(ReadMetricsTest, PageRequests) {
+  inspect::Node metrics_node;
+  ReadMetrics read_metrics(&metrics_node);
+
+  auto stats = read_metrics.GetSnapshot(CompressionAlgorithm::kChunked);
+  EXPECT_EQ(stats.page_requests, 0u);
+  EXPECT_EQ(stats.page_request_bytes, 0u);
+  EXPECT_EQ(stats.page_request_ticks, 0);
+
+  constexpr uint64_t kRequestBytes = 1 * MB;
+  const zx_ticks_t kRequestDuration = 10 * ms;
+
+  for (int i = 0; i < kNumOperations; i++) {
+    read_metrics.IncrementPageRequest(CompressionAlgorithm::kChunked, kRequestBytes,
+                                      zx::ticks(kRequestDuration));
+  }
+
+  stats = read_metrics.GetSnapshot(CompressionAlgorithm::kChunked);
+  EXPECT_EQ(stats.page_requests, static_cast<uint64_t>(kNumOperations));
+  EXPECT_EQ(stats.page_request_bytes, kRequestBytes * kNumOperations);
+  EXPECT_EQ(stats.page_request_ticks, kRequestDuration * kNumOperations);
+
+  // Requests for other compression algorithms are tracked separately.
+  stats = read_metrics.GetSnapshot(CompressionAlgorithm::kUncompressed);
+  EXPECT_EQ(stats.page_requests, 0u);
+}
+
 TEST(VerificationMetricsTest, MerkleVerifyMultithreaded) {
   VerificationMetrics verification_metrics;
 
@@ -155,5 +182,35 @@ TEST_F(MetricsTest, PageInMetrics) {
   EXPECT_EQ(frequency->value(), 1ul);
 }
 
+TEST(PageInTraceTest, RecordsMergedRangesInOrder) {
+  BlobfsMetrics metrics{false};
+
+  // Nothing is recorded before the trace is started.
+  metrics.IncrementPageIn("aaaa", 0, 8192);
+  EXPECT_TRUE(metrics.GetPageInTrace().empty());
+
+  metrics.StartPageInTrace(zx::duration::infinite(), 2);
+  metrics.IncrementPageIn("aaaa", 0, 8192);
+  metrics.IncrementPageIn("aaaa", 8192, 8192);  // Merged with the previous range.
+  metrics.IncrementPageIn("bbbb", 0, 8192);
+  metrics.IncrementPageIn("aaaa", 32768, 8192);  // Dropped, the trace is full.
+
+  std::vector<PageInTraceEntry> trace = metrics.GetPageInTrace();
+  ASSERT_EQ(trace.size(), 2ul);
+  EXPECT_EQ(trace[0].merkle_hash, "aaaa");
+  EXPECT_EQ(trace[0].offset, 0ul);
+  EXPECT_EQ(trace[0].length, 16384ul);
+  EXPECT_EQ(trace[1].merkle_hash, "bbbb");
+  EXPECT_EQ(trace[1].offset, 0ul);
+  EXPECT_EQ(trace[1].length, 8192ul);
+}
+
+TEST(PageInTraceTest, StopsRecordingAfterDuration) {
+  BlobfsMetrics metrics{false};
+  metrics.StartPageInTrace(zx::duration(0), 16);
+  metrics.IncrementPageIn("aaaa", 0, 8192);
+  EXPECT_TRUE(metrics.GetPageInTrace().empty());
+}
+
 }  // namespace
 }  // namespace blobfs
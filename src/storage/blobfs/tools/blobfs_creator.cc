@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <ios>
@@ -108,6 +109,9 @@ zx_status_t BlobfsCreator::Usage() {
           "\t--deprecated_padded_format\tFormat blobfs using the deprecated format that uses more "
           "space.\n"
           "Valid for the commands: mkfs and create.\n");
+  fprintf(stderr,
+          "\t--report_throughput\tPrint how long processing the blobs took and the resulting "
+          "throughput.\n");
   // Additional information about manifest format.
   fprintf(stderr, "\nEach manifest line must adhere to one of the following formats:\n");
   fprintf(stderr, "\t'dst/path=src/path'\n");
@@ -206,6 +210,12 @@ zx_status_t BlobfsCreator::ProcessCustom(int argc, char** argv, uint8_t* process
     return ZX_OK;
   }
 
+  if (strcmp(argv[0], "--report_throughput") == 0) {
+    report_throughput_ = true;
+    *processed = 1;
+    return ZX_OK;
+  }
+
   fprintf(stderr, "Argument not found: %s\n", argv[0]);
   return ZX_ERR_INVALID_ARGS;
 }
@@ -247,6 +257,7 @@ zx_status_t BlobfsCreator::CalculateRequiredSize(off_t* out) {
   // Accessing this with relaxed memory ordering across threads. It doesn't matter much if we do
   // a little more work than we should, eventual consistency is fine.
   std::atomic<zx_status_t> status = ZX_OK;
+  const auto start_time = std::chrono::steady_clock::now();
   for (uint32_t j = n_threads; j > 0; j--) {
     threads.emplace_back([&] {
       while (true) {
@@ -281,6 +292,18 @@ zx_status_t BlobfsCreator::CalculateRequiredSize(off_t* out) {
     return end_status;
   }
 
+  if (report_throughput_) {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    uint64_t total_bytes = 0;
+    for (const auto& [digest, blob_info] : blob_info_list_) {
+      total_bytes += blob_info.GetBlobLayout().FileSize();
+    }
+    const double total_mib = static_cast<double>(total_bytes) / (1 << 20);
+    printf("Processed %zu blobs (%.1f MiB) in %.2fs using %u threads: %.1f MiB/s\n",
+           blob_info_list_.size(), total_mib, elapsed.count(), n_threads,
+           elapsed.count() > 0 ? total_mib / elapsed.count() : 0.0);
+  }
+
   uint64_t required_node_count = 0;
   for (const auto& [digest, blob_info] : blob_info_list_) {
     uint64_t block_count = blob_info.GetBlobLayout().TotalBlockCount();
@@ -68,6 +68,9 @@ class BlobfsCreator : public FsCreator {
 
   // The number of inodes required in the resultant blobfs image.
   uint64_t required_inodes_ = 0;
+
+  // Whether to print the time taken and throughput of processing |blob_list_|.
+  bool report_throughput_ = false;
 };
 
 #endif  // SRC_STORAGE_BLOBFS_TOOLS_BLOBFS_CREATOR_H_
@@ -515,6 +515,30 @@ bool Dir::IsEmptyDir() {
 }
 
 zx_status_t Dir::Readdir(fs::VdirCookie *cookie, void *dirents, size_t len, size_t *out_actual) {
+  return ReaddirInternal(cookie, dirents, len, out_actual, nullptr);
+}
+
+zx_status_t Dir::ReaddirWithAttributes(fs::VdirCookie *cookie, void *dirents, size_t len,
+                                       size_t *out_actual, fs::VnodeAttributesQuery query,
+                                       std::vector<fs::VnodeAttributes> *attributes) {
+  // Collect the inode numbers first so that no dentry page is locked while loading inodes.
+  std::vector<ino_t> inos;
+  if (zx_status_t ret = ReaddirInternal(cookie, dirents, len, out_actual, &inos); ret != ZX_OK) {
+    return ret;
+  }
+  attributes->reserve(attributes->size() + inos.size());
+  for (ino_t ino : inos) {
+    zx::result<fs::VnodeAttributes> attrs = zx::ok(fs::VnodeAttributes{});
+    if (zx::result vnode = fs()->GetVnode(ino); vnode.is_ok()) {
+      attrs = (*vnode)->GetAttributes();
+    }
+    attributes->push_back(attrs.is_ok() ? *std::move(attrs) : fs::VnodeAttributes{});
+  }
+  return ZX_OK;
+}
+
+zx_status_t Dir::ReaddirInternal(fs::VdirCookie *cookie, void *dirents, size_t len,
+                                 size_t *out_actual, std::vector<ino_t> *inos) {
   fs::DirentFiller df(dirents, len);
   uint64_t *pos_cookie = reinterpret_cast<uint64_t *>(cookie);
   uint64_t pos = *pos_cookie;
@@ -528,7 +552,7 @@ zx_status_t Dir::Readdir(fs::VdirCookie *cookie, void *dirents, size_t len, size
   }
 
   if (TestFlag(InodeInfoFlag::kInlineDentry))
-    return ReadInlineDir(cookie, dirents, len, out_actual);
+    return ReadInlineDir(cookie, dirents, len, out_actual, inos);
 
   const unsigned char *types = kFiletypeTable;
   const size_t npages = DirBlocks();
@@ -563,6 +587,9 @@ zx_status_t Dir::Readdir(fs::VdirCookie *cookie, void *dirents, size_t len, size
           ret = ZX_OK;
           break;
         }
+        if (inos) {
+          inos->push_back(LeToCpu(de.ino));
+        }
       }
 
       size_t slots = GetDentrySlots(LeToCpu(de.name_len));
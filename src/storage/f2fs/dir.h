@@ -56,8 +56,15 @@ class Dir : public VnodeF2fs, public fbl::Recyclable<Dir> {
       __TA_REQUIRES_SHARED(mutex_);
   zx_status_t Readdir(fs::VdirCookie *cookie, void *dirents, size_t len, size_t *out_actual) final
       __TA_EXCLUDES(mutex_);
-  zx_status_t ReadInlineDir(fs::VdirCookie *cookie, void *dirents, size_t len, size_t *out_actual)
-      __TA_REQUIRES_SHARED(mutex_);
+  zx_status_t ReaddirWithAttributes(fs::VdirCookie *cookie, void *dirents, size_t len,
+                                    size_t *out_actual, fs::VnodeAttributesQuery query,
+                                    std::vector<fs::VnodeAttributes> *attributes) final
+      __TA_EXCLUDES(mutex_);
+  // If |inos| is provided, the inode number of each entry read is appended to it.
+  zx_status_t ReaddirInternal(fs::VdirCookie *cookie, void *dirents, size_t len,
+                              size_t *out_actual, std::vector<ino_t> *inos) __TA_EXCLUDES(mutex_);
+  zx_status_t ReadInlineDir(fs::VdirCookie *cookie, void *dirents, size_t len, size_t *out_actual,
+                            std::vector<ino_t> *inos) __TA_REQUIRES_SHARED(mutex_);
 
   // rename
   zx_status_t Rename(fbl::RefPtr<fs::Vnode> _newdir, std::string_view oldname,
@@ -184,6 +184,21 @@ zx::result<> F2fs::MakeReadOperations(zx::vmo& vmo, std::vector<block_t>& addrs,
   return ret;
 }
 
+zx::result<> F2fs::MakeReadOperations(std::vector<block_t>& addrs,
+                                      Reader::SupplyCallback supply) {
+  auto ret = reader_->ReadBlocks(addrs, std::move(supply));
+  // ZX_ERR_BUFFER_TOO_SMALL means that callers should fall back to reading into their own vmo.
+  if (ret.is_error() && ret.status_value() != ZX_ERR_BUFFER_TOO_SMALL) {
+    FX_LOGS(WARNING) << "failed to read blocks. " << ret.status_string();
+    if (ret.status_value() == ZX_ERR_UNAVAILABLE || ret.status_value() == ZX_ERR_PEER_CLOSED) {
+      // The underlying block device is unavailable. Set kCpErrorFlag for f2fs to enter read-only
+      // mode.
+      superblock_info_->SetCpFlags(CpFlag::kCpErrorFlag);
+    }
+  }
+  return ret;
+}
+
 zx::result<> F2fs::MakeReadOperations(std::vector<LockedPage>& pages, std::vector<block_t>& addrs,
                                       PageType type, bool is_sync) {
   auto ret = reader_->ReadBlocks(pages, addrs);
@@ -641,11 +656,15 @@ void F2fs::BalanceFs(uint32_t num_blocks) {
   WaitForAvailableMemory();
   if (segment_manager_->HasNotEnoughFreeSecs(0, num_blocks)) {
     // Wait for writeback before gc. The writeback task stops when there is not enough space.
+    zx::time start = zx::clock::get_monotonic();
     std::lock_guard lock(f2fs::GetGlobalLock());
     if (auto ret = StartGc(); ret.is_error()) {
       // Run() returns ZX_ERR_UNAVAILABLE when there is no available victim section, otherwise BUG
       ZX_DEBUG_ASSERT(ret.error_value() == ZX_ERR_UNAVAILABLE);
     }
+    // The caller was stalled for as long as it waited for the lock and GC.
+    zx::duration stall = zx::clock::get_monotonic() - start;
+    inspect_tree_->OnForegroundGcStall(stall);
   }
 }
 
@@ -162,6 +162,10 @@ class F2fs final {
                                  bool is_sync = true);
   zx::result<> MakeReadOperations(zx::vmo &vmo, std::vector<block_t> &addrs, PageType type,
                                   bool is_sync = true);
+  // It reads |addrs| into a pre-attached transfer buffer and hands its vmo to |supply|. See
+  // Reader::ReadBlocks().
+  zx::result<> MakeReadOperations(std::vector<block_t> &addrs,
+                                  fit::function<zx::result<>(const zx::vmo &)> supply);
   zx_status_t MakeTrimOperation(block_t blk_addr, block_t nblocks) const;
   void ScheduleWritebackAndReclaimPages();
 
@@ -309,7 +309,7 @@ bool Dir::IsEmptyInlineDir() {
 }
 
 zx_status_t Dir::ReadInlineDir(fs::VdirCookie *cookie, void *dirents, size_t len,
-                               size_t *out_actual) {
+                               size_t *out_actual, std::vector<ino_t> *inos) {
   fs::DirentFiller df(dirents, len);
   uint64_t *pos_cookie = reinterpret_cast<uint64_t *>(cookie);
 
@@ -348,6 +348,9 @@ zx_status_t Dir::ReadInlineDir(fs::VdirCookie *cookie, void *dirents, size_t len
         *out_actual = df.BytesFilled();
         return ZX_OK;
       }
+      if (inos) {
+        inos->push_back(LeToCpu(de->ino));
+      }
     }
 
     bit_pos += GetDentrySlots(LeToCpu(de->name_len));
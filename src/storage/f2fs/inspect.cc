@@ -46,6 +46,35 @@ void InspectTree::Initialize() {
 
   fs_inspect_nodes_ = fs_inspect::CreateTree(inspector_.GetRoot(), CreateCallbacks());
   inspector_.CreateStatsNode();
+
+  // Report how many blocks have been written through each active log, so the balance of data and
+  // node writes across temperatures can be observed.
+  inspector_.GetRoot().CreateLazyNode(
+      "active_logs",
+      [this] {
+        static constexpr const char *kLogNames[kNrCursegType] = {
+            "hot_data", "warm_data", "cold_data", "hot_node", "warm_node", "cold_node"};
+        inspect::Inspector insp;
+        SegmentManager &segment_manager = fs_->GetSegmentManager();
+        for (int type = 0; type < kNrCursegType; ++type) {
+          insp.GetRoot().CreateUint(kLogNames[type], segment_manager.CursegAllocatedBlocks(type),
+                                    &insp);
+        }
+        return fpromise::make_ok_promise(std::move(insp));
+      },
+      &inspector_);
+
+  inspector_.GetRoot().CreateLazyNode(
+      "gc",
+      [this] {
+        inspect::Inspector insp;
+        std::lock_guard guard(gc_mutex_);
+        insp.GetRoot().CreateUint("fg_gc_stalls", fg_gc_stalls_, &insp);
+        insp.GetRoot().CreateUint("fg_gc_stall_time_us", fg_gc_stall_time_.to_usecs(), &insp);
+        insp.GetRoot().CreateUint("max_fg_gc_stall_us", max_fg_gc_stall_.to_usecs(), &insp);
+        return fpromise::make_ok_promise(std::move(insp));
+      },
+      &inspector_);
 }
 
 void InspectTree::UpdateUsage() {
@@ -103,6 +132,13 @@ void InspectTree::OnOutOfSpace() {
   }
 }
 
+void InspectTree::OnForegroundGcStall(zx::duration duration) {
+  std::lock_guard guard(gc_mutex_);
+  ++fg_gc_stalls_;
+  fg_gc_stall_time_ += duration;
+  max_fg_gc_stall_ = std::max(max_fg_gc_stall_, duration);
+}
+
 fs_inspect::NodeCallbacks InspectTree::CreateCallbacks() {
   return {
       .info_callback =
@@ -17,6 +17,8 @@ class InspectTree final {
 
   void Initialize();
   void OnOutOfSpace();
+  // Records that a writer was stalled for |duration| while foreground GC ran.
+  void OnForegroundGcStall(zx::duration duration);
   const inspect::Inspector &GetInspector() { return inspector_; }
 
  private:
@@ -39,6 +41,12 @@ class InspectTree final {
   static constexpr zx::duration kOutOfSpaceDuration = zx::min(5);
   zx::time last_out_of_space_time_ __TA_GUARDED(fvm_mutex_){zx::time::infinite_past()};
 
+  // Foreground GC stalls of writers in BalanceFs().
+  mutable std::mutex gc_mutex_{};
+  uint64_t fg_gc_stalls_ __TA_GUARDED(gc_mutex_) = 0;
+  zx::duration fg_gc_stall_time_ __TA_GUARDED(gc_mutex_);
+  zx::duration max_fg_gc_stall_ __TA_GUARDED(gc_mutex_);
+
   // The Inspector to which the tree is attached.
   inspect::Inspector inspector_;
 
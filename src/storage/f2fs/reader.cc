@@ -87,6 +87,49 @@ zx::result<> Reader::ReadBlocks(zx::vmo &vmo, std::vector<block_t> &addrs) {
   return zx::ok();
 }
 
+zx::result<> Reader::ReadBlocks(std::vector<block_t> &addrs, SupplyCallback supply) {
+  if (addrs.size() > pool_->GetLargeBufferSize()) {
+    return zx::error(ZX_ERR_BUFFER_TOO_SMALL);
+  }
+  OwnedStorageBuffer buffer = pool_->Get(addrs.size());
+  storage::VmoBuffer &vmo_buffer = buffer->GetVmoBuffer();
+  fs::BufferedOperationsBuilder builder;
+  // A run of invalid addrs starting at |hole|.
+  size_t hole = 0;
+  for (size_t i = 0; i <= addrs.size(); ++i) {
+    if (i < addrs.size() && !IsValidBlockAddr(addrs[i])) {
+      continue;
+    }
+    // Transfer buffers can keep data of previous requests. Zero the pages that are not read.
+    if (hole < i) {
+      if (zx_status_t status = vmo_buffer.vmo().op_range(
+              ZX_VMO_OP_ZERO, hole * Page::Size(), (i - hole) * Page::Size(), nullptr, 0);
+          status != ZX_OK) {
+        return zx::error(status);
+      }
+    }
+    hole = i + 1;
+    if (i == addrs.size()) {
+      break;
+    }
+    storage::Operation op = {
+        .type = storage::OperationType::kRead,
+        .vmo_offset = i,
+        .dev_offset = addrs[i],
+        .length = 1,
+    };
+    builder.Add(op, &vmo_buffer);
+  }
+  std::vector<storage::BufferedOperation> operations = builder.TakeOperations();
+  if (!operations.empty()) {
+    if (zx_status_t io_status = bcache_mapper_->RunRequests(operations); io_status != ZX_OK) {
+      FX_LOGS(ERROR) << "read operations failed" << zx_status_get_string(io_status);
+      return zx::error(io_status);
+    }
+  }
+  return supply(vmo_buffer.vmo());
+}
+
 zx::result<> Reader::ReadBlocks(std::vector<LockedPage> &pages, std::vector<block_t> &addrs) {
   // indice for |pages| and |addrs|.
   size_t from, to = 0;
@@ -31,6 +31,14 @@ class Reader {
   zx::result<> ReadBlocks(std::vector<LockedPage> &pages, std::vector<block_t> &addrs);
   zx::result<> ReadBlocks(zx::vmo &vmo, std::vector<block_t> &addrs);
 
+  // It reads |addrs| directly into a transfer buffer that was attached to the underlying storage
+  // when |pool_| was created, and then calls |supply| with the vmo of the buffer. The i-th page of
+  // the vmo holds the block of |addrs[i]|, and pages for invalid addrs are zero-filled. It allows
+  // the pager to move the pages out of the buffer without copying them into another vmo. If
+  // |addrs| doesn't fit in a single transfer buffer, it returns ZX_ERR_BUFFER_TOO_SMALL.
+  using SupplyCallback = fit::function<zx::result<>(const zx::vmo &vmo)>;
+  zx::result<> ReadBlocks(std::vector<block_t> &addrs, SupplyCallback supply);
+
  private:
   std::vector<storage::BufferedOperation> BuildBufferedOperations(OwnedStorageBuffer &buffer,
                                                                   const std::vector<block_t> &addrs,
@@ -328,6 +328,11 @@ uint16_t SegmentManager::CursegBlkoff(int type) {
   return curseg->next_blkoff;
 }
 
+uint64_t SegmentManager::CursegAllocatedBlocks(int type) const {
+  const CursegInfo *curseg = CURSEG_I(static_cast<CursegType>(type));
+  return curseg->allocated_blocks.load(std::memory_order_relaxed);
+}
+
 void SegmentManager::CheckSegRange(uint32_t segno) const { ZX_ASSERT(segno < segment_count_); }
 
 #if 0  // porting needed
@@ -910,6 +915,7 @@ block_t SegmentManager::GetBlockAddrOnSegment(LockedPage &page, block_t old_blka
   {
     std::lock_guard curseg_lock(curseg->curseg_mutex);
     new_blkaddr = NextFreeBlkAddr(type);
+    curseg->allocated_blocks.fetch_add(1, std::memory_order_relaxed);
 
     // AddSumEntry should be resided under the curseg_mutex
     // because this function updates a summary entry in the
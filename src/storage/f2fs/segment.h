@@ -5,6 +5,8 @@
 #ifndef SRC_STORAGE_F2FS_SEGMENT_H_
 #define SRC_STORAGE_F2FS_SEGMENT_H_
 
+#include <atomic>
+
 #include "src/storage/f2fs/bitmap.h"
 #include "src/storage/f2fs/common.h"
 #include "src/storage/f2fs/layout.h"
@@ -122,6 +124,7 @@ struct CursegInfo {
   std::shared_mutex curseg_mutex;  // lock for consistency
   uint16_t next_blkoff = 0;        // next block offset to write
   uint8_t alloc_type = 0;          // current allocation type
+  std::atomic<uint64_t> allocated_blocks = 0;  // blocks allocated from this log since mount
 };
 
 // For SIT manager
@@ -196,6 +199,7 @@ class SegmentManager {
   uint32_t CursegSegno(int type);
   uint8_t CursegAllocType(int type);
   uint16_t CursegBlkoff(int type);
+  uint64_t CursegAllocatedBlocks(int type) const;
   void CheckSegRange(uint32_t segno) const;
   void CheckBlockCount(uint32_t segno, SitEntry &raw_sit);
   pgoff_t CurrentSitAddr(uint32_t start) __TA_REQUIRES_SHARED(sentry_lock_);
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -292,5 +293,46 @@ TEST_F(DirectoryTest, SetDentryLevel1DoWriteAndRead) {
   test_dir_vn = nullptr;
 }
 
+TEST_F(DirectoryTest, ReaddirWithAttributes) {
+  zx::result test_dir = root_dir_->Create("test", fs::CreationType::kDirectory);
+  ASSERT_TRUE(test_dir.is_ok()) << test_dir.status_string();
+  fbl::RefPtr<Dir> dir = fbl::RefPtr<Dir>::Downcast(*std::move(test_dir));
+
+  std::unordered_set<std::string> child_set = {"a", "b", "c"};
+  for (const auto &name : child_set) {
+    FileTester::CreateChild(dir.get(), S_IFREG, name);
+  }
+
+  fs::VdirCookie cookie;
+  uint8_t buf[kPageSize];
+  size_t len;
+  std::vector<fs::VnodeAttributes> attributes;
+  ASSERT_EQ(dir->ReaddirWithAttributes(&cookie, buf, sizeof(buf), &len,
+                                       fs::VnodeAttributesQuery::kId, &attributes),
+            ZX_OK);
+
+  // Each entry is reported with the attributes of the vnode it names.
+  child_set.insert(".");
+  size_t index = 0;
+  for (uint8_t *buf_ptr = buf; buf_ptr < buf + len; ++index) {
+// TODO(b/293947862): Remove use of deprecated `vdirent_t` when transitioning ReadDir to Enumerate
+// as part of io2 migration.
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    auto entry = reinterpret_cast<const vdirent_t *>(buf_ptr);
+    buf_ptr += entry->size + sizeof(vdirent_t);
+#pragma clang diagnostic pop
+    std::string name(entry->name, entry->size);
+    ASSERT_EQ(child_set.erase(name), 1u) << name;
+    ASSERT_LT(index, attributes.size());
+    EXPECT_EQ(attributes[index].id, entry->ino);
+    EXPECT_TRUE(attributes[index].mode.has_value());
+  }
+  EXPECT_TRUE(child_set.empty());
+  EXPECT_EQ(index, attributes.size());
+
+  ASSERT_EQ(dir->Close(), ZX_OK);
+}
+
 }  // namespace
 }  // namespace f2fs
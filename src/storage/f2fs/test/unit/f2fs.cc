@@ -332,6 +332,24 @@ TEST_F(StorageTest, LargeIOs) {
     page->ClearUptodate();
   }
 
+  // Verify reads into a transfer buffer. Invalid addrs should be zero-filled even though the buffer
+  // keeps data of previous reads.
+  auto no_supply = [](const zx::vmo &) { return zx::ok(); };
+  ASSERT_EQ(reader_->ReadBlocks(addrs, no_supply).status_value(), ZX_ERR_BUFFER_TOO_SMALL);
+  std::vector<block_t> buffer_addrs(addrs.begin(), addrs.begin() + large_buffer_size);
+  size_t num_supplied = 0;
+  auto supply = [&](const zx::vmo &vmo) -> zx::result<> {
+    for (size_t i = 0; i < buffer_addrs.size(); ++i) {
+      block_t data = 0;
+      EXPECT_EQ(vmo.read(&data, i * Page::Size(), sizeof(data)), ZX_OK);
+      EXPECT_EQ(data, IsValidBlockAddr(buffer_addrs[i]) ? buffer_addrs[i] : 0U);
+      ++num_supplied;
+    }
+    return zx::ok();
+  };
+  ASSERT_TRUE(reader_->ReadBlocks(buffer_addrs, supply).is_ok());
+  ASSERT_EQ(num_supplied, buffer_addrs.size());
+
   ASSERT_EQ(zx::vmar::root_self()->unmap(paddr, num_pages * Page::Size()), ZX_OK);
 }
 
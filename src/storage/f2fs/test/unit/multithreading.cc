@@ -92,6 +92,49 @@ TEST_P(MultiThreadsWithLFS, Write) {
   }
 }
 
+TEST_P(MultiThreadsWithLFS, WriteDisjointRanges) {
+  zx::result test_file = root_dir_->Create("test", fs::CreationType::kFile);
+  ASSERT_TRUE(test_file.is_ok()) << test_file.status_string();
+  {
+    fbl::RefPtr<f2fs::File> vn = fbl::RefPtr<f2fs::File>::Downcast(*std::move(test_file));
+
+    // Each thread owns a disjoint range of the same file and rewrites it with its own pattern.
+    constexpr int kNThreads = 8;
+    constexpr size_t kBlocksPerThread = 256;
+    constexpr size_t kRangeSize = kBlocksPerThread * kBlockSize;
+    constexpr int kNTry = 4;
+    std::thread threads[kNThreads];
+    for (auto nThread = 0; nThread < kNThreads; ++nThread) {
+      threads[nThread] = std::thread([nThread, vn]() {
+        std::vector<uint8_t> buf(kBlockSize * 4, static_cast<uint8_t>(nThread + 1));
+        const size_t base = static_cast<size_t>(nThread) * kRangeSize;
+        for (int i = 0; i < kNTry; ++i) {
+          for (size_t off = 0; off < kRangeSize; off += buf.size()) {
+            size_t out_actual;
+            ASSERT_EQ(FileTester::Write(vn.get(), buf.data(), buf.size(), base + off, &out_actual),
+                      ZX_OK);
+            ASSERT_EQ(out_actual, buf.size());
+          }
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    // No write may spill into a range owned by another thread.
+    ASSERT_EQ(vn->GetSize(), kNThreads * kRangeSize);
+    std::vector<uint8_t> buf(kRangeSize);
+    for (auto nThread = 0; nThread < kNThreads; ++nThread) {
+      FileTester::ReadFromFile(vn.get(), buf.data(), buf.size(), nThread * kRangeSize);
+      std::vector<uint8_t> expected(kRangeSize, static_cast<uint8_t>(nThread + 1));
+      ASSERT_EQ(buf, expected);
+    }
+    vn->Close();
+  }
+}
+
 const std::array<bool, 2> kAllocParams = {false, true};
 INSTANTIATE_TEST_SUITE_P(/*no prefix*/, MultiThreadsWithLFS, ::testing::ValuesIn(kAllocParams));
 
@@ -134,28 +134,65 @@ zx_status_t VnodeF2fs::ClonePagedVmo(fuchsia_io::wire::VmoFlags flags, size_t si
 }
 
 void VnodeF2fs::VmoRead(uint64_t offset, uint64_t length) {
-  zx::vmo vmo;
-  auto size_or = CreateAndPopulateVmo(vmo, offset, length);
-  fs::SharedLock rlock(mutex_);
-  if (unlikely(!paged_vmo())) {
-    // Races with calling FreePagedVmo() on another thread can result in stale read requests. Ignore
-    // them if the VMO is gone.
-    FX_LOGS(WARNING) << "A pager-backed VMO is already freed: " << ZX_ERR_NOT_FOUND;
-    return;
+  size_t num_read_blocks = 0;
+  zx::result<> ret = zx::ok();
+  zx::result addrs = GetVmoReadAddrs(offset, length, num_read_blocks);
+  if (addrs.is_ok()) {
+    const size_t vmo_size = addrs->size() * kBlockSize;
+    auto supply = [this, offset, length, vmo_size](const zx::vmo &vmo) -> zx::result<> {
+      fs::SharedLock rlock(mutex_);
+      if (unlikely(!paged_vmo())) {
+        // Races with calling FreePagedVmo() on another thread can result in stale read requests.
+        // Ignore them if the VMO is gone.
+        FX_LOGS(WARNING) << "A pager-backed VMO is already freed: " << ZX_ERR_NOT_FOUND;
+        return zx::ok();
+      }
+      std::optional vfs = this->vfs();
+      ZX_DEBUG_ASSERT(vfs.has_value());
+      if (auto supplied = vfs.value().get().SupplyPages(paged_vmo(), offset, vmo_size, vmo, 0);
+          supplied.is_error()) {
+        ReportPagerErrorUnsafe(ZX_PAGER_VMO_READ, offset, length, supplied.error_value());
+      }
+      return zx::ok();
+    };
+    // Read blocks straight into a transfer buffer that is already attached to the block device, and
+    // move its pages to the paged vmo.
+    ret = fs()->MakeReadOperations(*addrs, supply);
+    if (ret.status_value() == ZX_ERR_BUFFER_TOO_SMALL) {
+      // The request doesn't fit in a transfer buffer. Create a vmo to feed paged vmo.
+      zx::vmo vmo;
+      ret = zx::make_result(zx::vmo::create(vmo_size, 0, &vmo));
+      if (ret.is_ok() && num_read_blocks) {
+        ret = fs()->MakeReadOperations(vmo, *addrs, PageType::kData);
+      }
+      if (ret.is_ok()) {
+        ret = supply(vmo);
+      }
+    }
+  } else {
+    ret = addrs.take_error();
   }
-  if (unlikely(size_or.is_error())) {
-    return ReportPagerErrorUnsafe(ZX_PAGER_VMO_READ, offset, length, size_or.error_value());
+
+  if (unlikely(ret.is_error())) {
+    fs::SharedLock rlock(mutex_);
+    if (unlikely(!paged_vmo())) {
+      FX_LOGS(WARNING) << "A pager-backed VMO is already freed: " << ZX_ERR_NOT_FOUND;
+      return;
+    }
+    return ReportPagerErrorUnsafe(ZX_PAGER_VMO_READ, offset, length, ret.error_value());
   }
-  std::optional vfs = this->vfs();
-  ZX_DEBUG_ASSERT(vfs.has_value());
-  if (auto ret = vfs.value().get().SupplyPages(paged_vmo(), offset, *size_or, std::move(vmo), 0);
-      ret.is_error()) {
-    ReportPagerErrorUnsafe(ZX_PAGER_VMO_READ, offset, length, ret.error_value());
+
+  if (num_read_blocks) {
+    // Load read pages on FileCache as hints of readahead. It's okay to fail because the failure
+    // doesn't affect read operations but only readahead.
+    const size_t start_block = offset / kBlockSize;
+    [[maybe_unused]] zx::result pages = GrabPages(start_block, start_block + num_read_blocks);
   }
 }
 
-zx::result<size_t> VnodeF2fs::CreateAndPopulateVmo(zx::vmo &vmo, const size_t offset,
-                                                   const size_t length) {
+zx::result<std::vector<block_t>> VnodeF2fs::GetVmoReadAddrs(const size_t offset,
+                                                            const size_t length,
+                                                            size_t &num_read_blocks) {
   constexpr size_t block_size = kBlockSize;
   const size_t file_size = GetSize();
   const size_t max_block = CheckedDivRoundUp(file_size, block_size);
@@ -163,7 +200,7 @@ zx::result<size_t> VnodeF2fs::CreateAndPopulateVmo(zx::vmo &vmo, const size_t of
   const size_t start_block = offset / kBlockSize;
   const size_t end_block = std::min(CheckedDivRoundUp(offset + length, block_size), max_block);
   const size_t request_blocks = end_block - start_block;
-  size_t num_read_blocks = 0;
+  num_read_blocks = 0;
 
   // Do not readahead if it has inline data or memory pressure is high.
   if (!TestFlag(InodeInfoFlag::kInlineData) && !TestFlag(InodeInfoFlag::kNoAlloc) &&
@@ -192,22 +229,9 @@ zx::result<size_t> VnodeF2fs::CreateAndPopulateVmo(zx::vmo &vmo, const size_t of
     }
   }
 
-  // Create vmo to feed paged vmo.
-  size_t vmo_size = std::max(request_blocks, num_read_blocks) * block_size;
-  if (auto status = zx::vmo::create(vmo_size, 0, &vmo); status != ZX_OK) {
-    return zx::error(status);
-  }
-
-  if (num_read_blocks) {
-    addrs->resize(num_read_blocks, kNullAddr);
-    if (auto status = fs()->MakeReadOperations(vmo, *addrs, PageType::kData); status.is_error()) {
-      return status.take_error();
-    }
-    // Load read pages on FileCache as hints of readahead. It's okay to fail because the failure
-    // doesn't affect read operations but only readahead.
-    [[maybe_unused]] zx::result ret = GrabPages(start_block, start_block + num_read_blocks);
-  }
-  return zx::ok(vmo_size);
+  // The vmo to feed paged vmo covers the request and the readahead blocks.
+  addrs->resize(std::max(request_blocks, num_read_blocks), kNullAddr);
+  return addrs;
 }
 
 void VnodeF2fs::VmoDirty(uint64_t offset, uint64_t length) {
@@ -109,8 +109,10 @@ class VnodeF2fs : public fs::PagedVnode,
   void VmoRead(uint64_t offset, uint64_t length) override __TA_EXCLUDES(mutex_);
   void VmoDirty(uint64_t offset, uint64_t length) override __TA_EXCLUDES(mutex_);
 
-  zx::result<size_t> CreateAndPopulateVmo(zx::vmo &vmo, const size_t offset, const size_t length)
-      __TA_EXCLUDES(mutex_);
+  // It returns the block addrs of the pages to supply for a VmoRead() request. The first
+  // |num_read_blocks| of them include every valid addr to read.
+  zx::result<std::vector<block_t>> GetVmoReadAddrs(const size_t offset, const size_t length,
+                                                   size_t &num_read_blocks) __TA_EXCLUDES(mutex_);
   void OnNoPagedVmoClones() final __TA_REQUIRES(mutex_);
 
   void ReleasePagedVmoUnsafe() __TA_REQUIRES(mutex_);
@@ -0,0 +1,281 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Standard workloads which are run against every filesystem in the suite, so that their
+// performance can be compared and tracked for regressions. Each test records one value per run in
+// a perftest results set, which is written out in the perftest JSON format if the binary is passed
+// --out=<path>.
+
+#include <fcntl.h>
+#include <lib/zx/clock.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fbl/string.h>
+#include <fbl/unique_fd.h>
+#include <gtest/gtest.h>
+#include <perftest/results.h>
+
+#include "src/storage/fs_test/fs_test_fixture.h"
+
+namespace fs_test {
+namespace {
+
+constexpr char kTestSuite[] = "fuchsia.storage.fs_test";
+
+constexpr int kRunCount = 5;
+constexpr size_t kFileSize = 8 * 1024 * 1024;
+constexpr size_t kSequentialIoSize = 64 * 1024;
+constexpr size_t kRandomIoSize = 4096;
+constexpr int kRandomIoCount = 512;
+constexpr int kSmallFileCount = 128;
+constexpr size_t kSmallFileSize = 4096;
+constexpr int kFsyncCount = 32;
+
+perftest::ResultsSet& GetResults() {
+  static perftest::ResultsSet results;
+  return results;
+}
+
+class PerfTest : public FilesystemTest {
+ protected:
+  // Returns the results to append this test's values to, labelled "<filesystem>/<workload>".
+  perftest::TestCaseResults* AddTestCase(std::string_view workload, std::string_view unit) {
+    std::string label = fs().GetTraits().name;
+    label.append("/").append(workload);
+    return GetResults().AddTestCase(kTestSuite, fbl::String(label.data(), label.size()),
+                                    fbl::String(unit.data(), unit.size()));
+  }
+
+  // Creates a file of |kFileSize| bytes filled with a pattern.
+  void CreateFile(const std::string& path) {
+    fbl::unique_fd fd(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666));
+    ASSERT_TRUE(fd);
+    std::vector<uint8_t> buffer(kSequentialIoSize);
+    for (size_t offset = 0; offset < kFileSize; offset += buffer.size()) {
+      memset(buffer.data(), static_cast<int>(offset / buffer.size()), buffer.size());
+      ASSERT_EQ(write(fd.get(), buffer.data(), buffer.size()),
+                static_cast<ssize_t>(buffer.size()));
+    }
+    ASSERT_EQ(fsync(fd.get()), 0);
+  }
+
+  // Remounts the filesystem so that the next read finds nothing in the filesystem's caches.
+  // In-memory filesystems lose their contents when unmounted, so they are left alone.
+  void DropCaches() {
+    if (fs().GetTraits().in_memory) {
+      return;
+    }
+    ASSERT_EQ(fs().Unmount().status_value(), ZX_OK);
+    ASSERT_EQ(fs().Mount().status_value(), ZX_OK);
+  }
+};
+
+double BytesPerSecond(size_t bytes, zx::duration elapsed) {
+  return static_cast<double>(bytes) * 1e9 / static_cast<double>(elapsed.to_nsecs());
+}
+
+double NanosecondsPerOp(zx::duration elapsed, int count) {
+  return static_cast<double>(elapsed.to_nsecs()) / count;
+}
+
+TEST_P(PerfTest, SequentialWrite) {
+  perftest::TestCaseResults* results = AddTestCase("SequentialWrite", "bytes/second");
+  const std::string path = GetPath("file");
+  std::vector<uint8_t> buffer(kSequentialIoSize, 0xab);
+  for (int run = 0; run < kRunCount; ++run) {
+    fbl::unique_fd fd(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666));
+    ASSERT_TRUE(fd);
+    zx::time start = zx::clock::get_monotonic();
+    for (size_t offset = 0; offset < kFileSize; offset += buffer.size()) {
+      ASSERT_EQ(write(fd.get(), buffer.data(), buffer.size()),
+                static_cast<ssize_t>(buffer.size()));
+    }
+    ASSERT_EQ(fsync(fd.get()), 0);
+    results->AppendValue(BytesPerSecond(kFileSize, zx::clock::get_monotonic() - start));
+    fd.reset();
+    ASSERT_EQ(unlink(path.c_str()), 0);
+  }
+}
+
+TEST_P(PerfTest, SequentialRead) {
+  perftest::TestCaseResults* results = AddTestCase("SequentialRead", "bytes/second");
+  const std::string path = GetPath("file");
+  ASSERT_NO_FATAL_FAILURE(CreateFile(path));
+  std::vector<uint8_t> buffer(kSequentialIoSize);
+  for (int run = 0; run < kRunCount; ++run) {
+    ASSERT_NO_FATAL_FAILURE(DropCaches());
+    fbl::unique_fd fd(open(path.c_str(), O_RDONLY));
+    ASSERT_TRUE(fd);
+    zx::time start = zx::clock::get_monotonic();
+    for (size_t offset = 0; offset < kFileSize; offset += buffer.size()) {
+      ASSERT_EQ(read(fd.get(), buffer.data(), buffer.size()), static_cast<ssize_t>(buffer.size()));
+    }
+    results->AppendValue(BytesPerSecond(kFileSize, zx::clock::get_monotonic() - start));
+  }
+}
+
+TEST_P(PerfTest, RandomWrite) {
+  perftest::TestCaseResults* results = AddTestCase("RandomWrite", "nanoseconds");
+  const std::string path = GetPath("file");
+  ASSERT_NO_FATAL_FAILURE(CreateFile(path));
+  std::vector<uint8_t> buffer(kRandomIoSize, 0xcd);
+  std::mt19937 random(0);
+  std::uniform_int_distribution<size_t> block(0, kFileSize / kRandomIoSize - 1);
+  for (int run = 0; run < kRunCount; ++run) {
+    fbl::unique_fd fd(open(path.c_str(), O_RDWR));
+    ASSERT_TRUE(fd);
+    zx::time start = zx::clock::get_monotonic();
+    for (int i = 0; i < kRandomIoCount; ++i) {
+      ASSERT_EQ(pwrite(fd.get(), buffer.data(), buffer.size(),
+                       static_cast<off_t>(block(random) * kRandomIoSize)),
+                static_cast<ssize_t>(buffer.size()));
+    }
+    ASSERT_EQ(fsync(fd.get()), 0);
+    results->AppendValue(NanosecondsPerOp(zx::clock::get_monotonic() - start, kRandomIoCount));
+  }
+}
+
+TEST_P(PerfTest, RandomRead) {
+  perftest::TestCaseResults* results = AddTestCase("RandomRead", "nanoseconds");
+  const std::string path = GetPath("file");
+  ASSERT_NO_FATAL_FAILURE(CreateFile(path));
+  std::vector<uint8_t> buffer(kRandomIoSize);
+  std::mt19937 random(0);
+  std::uniform_int_distribution<size_t> block(0, kFileSize / kRandomIoSize - 1);
+  for (int run = 0; run < kRunCount; ++run) {
+    ASSERT_NO_FATAL_FAILURE(DropCaches());
+    fbl::unique_fd fd(open(path.c_str(), O_RDONLY));
+    ASSERT_TRUE(fd);
+    zx::time start = zx::clock::get_monotonic();
+    for (int i = 0; i < kRandomIoCount; ++i) {
+      ASSERT_EQ(pread(fd.get(), buffer.data(), buffer.size(),
+                      static_cast<off_t>(block(random) * kRandomIoSize)),
+                static_cast<ssize_t>(buffer.size()));
+    }
+    results->AppendValue(NanosecondsPerOp(zx::clock::get_monotonic() - start, kRandomIoCount));
+  }
+}
+
+// Measures the time to create, write, close and unlink a small file.
+TEST_P(PerfTest, SmallFileCreateDelete) {
+  perftest::TestCaseResults* results = AddTestCase("SmallFileCreateDelete", "nanoseconds");
+  ASSERT_EQ(mkdir(GetPath("dir").c_str(), 0755), 0);
+  std::vector<uint8_t> buffer(kSmallFileSize, 0xef);
+  for (int run = 0; run < kRunCount; ++run) {
+    zx::time start = zx::clock::get_monotonic();
+    for (int i = 0; i < kSmallFileCount; ++i) {
+      const std::string path = GetPath("dir/file" + std::to_string(i));
+      fbl::unique_fd fd(open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666));
+      ASSERT_TRUE(fd);
+      ASSERT_EQ(write(fd.get(), buffer.data(), buffer.size()),
+                static_cast<ssize_t>(buffer.size()));
+    }
+    for (int i = 0; i < kSmallFileCount; ++i) {
+      ASSERT_EQ(unlink(GetPath("dir/file" + std::to_string(i)).c_str()), 0);
+    }
+    results->AppendValue(NanosecondsPerOp(zx::clock::get_monotonic() - start, kSmallFileCount));
+  }
+}
+
+// Measures the latency of fsync after a small overwrite.
+TEST_P(PerfTest, FsyncLatency) {
+  perftest::TestCaseResults* results = AddTestCase("FsyncLatency", "nanoseconds");
+  const std::string path = GetPath("file");
+  fbl::unique_fd fd(open(path.c_str(), O_RDWR | O_CREAT, 0666));
+  ASSERT_TRUE(fd);
+  std::vector<uint8_t> buffer(kRandomIoSize, 0x12);
+  for (int run = 0; run < kRunCount; ++run) {
+    zx::duration total;
+    for (int i = 0; i < kFsyncCount; ++i) {
+      ASSERT_EQ(pwrite(fd.get(), buffer.data(), buffer.size(), 0),
+                static_cast<ssize_t>(buffer.size()));
+      zx::time start = zx::clock::get_monotonic();
+      ASSERT_EQ(fsync(fd.get()), 0);
+      total += zx::clock::get_monotonic() - start;
+    }
+    results->AppendValue(NanosecondsPerOp(total, kFsyncCount));
+  }
+}
+
+// Measures the cost of a page fault on a freshly mapped file, which includes the filesystem
+// supplying the page when it isn't already resident.
+using MmapPerfTest = PerfTest;
+
+TEST_P(MmapPerfTest, MmapPageFault) {
+  perftest::TestCaseResults* results = AddTestCase("MmapPageFault", "nanoseconds");
+  const std::string path = GetPath("file");
+  ASSERT_NO_FATAL_FAILURE(CreateFile(path));
+  const size_t page_count = kFileSize / PAGE_SIZE;
+  for (int run = 0; run < kRunCount; ++run) {
+    ASSERT_NO_FATAL_FAILURE(DropCaches());
+    fbl::unique_fd fd(open(path.c_str(), O_RDONLY));
+    ASSERT_TRUE(fd);
+    void* addr = mmap(nullptr, kFileSize, PROT_READ, MAP_SHARED, fd.get(), 0);
+    ASSERT_NE(addr, MAP_FAILED);
+    const volatile uint8_t* data = static_cast<const volatile uint8_t*>(addr);
+    zx::time start = zx::clock::get_monotonic();
+    for (size_t page = 0; page < page_count; ++page) {
+      [[maybe_unused]] uint8_t value = data[page * PAGE_SIZE];
+    }
+    results->AppendValue(NanosecondsPerOp(zx::clock::get_monotonic() - start,
+                                          static_cast<int>(page_count)));
+    ASSERT_EQ(munmap(addr, kFileSize), 0);
+  }
+}
+
+std::vector<TestFilesystemOptions> GetMmapPerfTestCombinations() {
+  return MapAndFilterAllTestFilesystems(
+      [](const TestFilesystemOptions& options) -> std::optional<TestFilesystemOptions> {
+        if (options.filesystem->GetTraits().supports_mmap) {
+          return options;
+        }
+        return std::nullopt;
+      });
+}
+
+INSTANTIATE_TEST_SUITE_P(/*no prefix*/, PerfTest, testing::ValuesIn(AllTestFilesystems()),
+                         testing::PrintToStringParamName());
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PerfTest);
+
+INSTANTIATE_TEST_SUITE_P(/*no prefix*/, MmapPerfTest,
+                         testing::ValuesIn(GetMmapPerfTestCombinations()),
+                         testing::PrintToStringParamName());
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MmapPerfTest);
+
+}  // namespace
+}  // namespace fs_test
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+
+  // gtest removes the flags it recognizes, leaving our own.
+  const char* output_path = nullptr;
+  constexpr std::string_view kOutFlag = "--out=";
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg(argv[i]);
+    if (arg.substr(0, kOutFlag.size()) == kOutFlag) {
+      output_path = argv[i] + kOutFlag.size();
+    }
+  }
+
+  int result = RUN_ALL_TESTS();
+  fs_test::GetResults().PrintSummaryStatistics(stdout);
+  if (output_path != nullptr && !fs_test::GetResults().WriteJSONFile(output_path)) {
+    return 1;
+  }
+  return result;
+}
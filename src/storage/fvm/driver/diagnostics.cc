@@ -49,31 +49,36 @@ void Diagnostics::OnMount(OnMountArgs args) {
   mount_time_num_partitions_.Set(args.partitions.size());
   mount_time_num_reserved_slices_.Set(args.num_reserved_slices);
   for (auto& partition : args.partitions) {
-    AddPerPartitionMetrics(std::move(partition.name), partition.num_slices);
+    AddPerPartitionMetrics(std::move(partition.name), partition.num_slices,
+                           partition.num_physical_extents);
   }
 }
 
-void Diagnostics::UpdatePartitionMetrics(const std::string& partition_name, size_t num_slices) {
+void Diagnostics::UpdatePartitionMetrics(const std::string& partition_name, size_t num_slices,
+                                         size_t num_physical_extents) {
   auto partition = per_partition_.find(partition_name);
   if (partition == per_partition_.end()) {
-    AddPerPartitionMetrics(std::string(partition_name), 0u);
+    AddPerPartitionMetrics(std::string(partition_name), 0u, 0u);
     partition = per_partition_.find(partition_name);
   }
   partition->second.total_slices_reserved.Set(num_slices);
+  partition->second.physical_extents.Set(num_physical_extents);
 }
 
 void Diagnostics::UpdateMaxBytes(const std::string& partition_name, size_t max_bytes) {
   auto partition = per_partition_.find(partition_name);
   if (partition == per_partition_.end()) {
-    AddPerPartitionMetrics(std::string(partition_name), 0u);
+    AddPerPartitionMetrics(std::string(partition_name), 0u, 0u);
     partition = per_partition_.find(partition_name);
   }
   partition->second.max_bytes.Set(max_bytes);
 }
 
-void Diagnostics::AddPerPartitionMetrics(std::string name, uint64_t num_slices) {
+void Diagnostics::AddPerPartitionMetrics(std::string name, uint64_t num_slices,
+                                         uint64_t num_physical_extents) {
   Diagnostics::PerPartitionMetrics metrics{.root = per_partition_node_.CreateChild(name)};
   metrics.total_slices_reserved = metrics.root.CreateUint("total_slices_reserved", num_slices);
+  metrics.physical_extents = metrics.root.CreateUint("physical_extents", num_physical_extents);
   metrics.max_bytes = metrics.root.CreateUint("max_bytes", 0);
   per_partition_.insert(
       std::pair<std::string, PerPartitionMetrics>(std::move(name), std::move(metrics)));
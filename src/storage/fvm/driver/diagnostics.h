@@ -52,14 +52,19 @@ class Diagnostics {
       std::string name;
       // Number of slices reserved for the partition
       uint64_t num_slices = 0;
+      // Number of physically contiguous runs the partition's slices are spread across
+      uint64_t num_physical_extents = 0;
     };
     std::vector<Partition> partitions{};
   };
   // Reports the initial state of the FVM instance. Should be called once on mount.
   void OnMount(OnMountArgs args);
 
-  // Reports the metrics stored for a partition.
-  void UpdatePartitionMetrics(const std::string& partition_name, size_t num_slices);
+  // Reports the metrics stored for a partition. |num_physical_extents| is the number of physically
+  // contiguous runs of slices backing the partition; a value close to |num_slices| means the
+  // partition is badly fragmented.
+  void UpdatePartitionMetrics(const std::string& partition_name, size_t num_slices,
+                              size_t num_physical_extents);
 
   // Update the partition's size limit metric.
   void UpdateMaxBytes(const std::string& partition_name, size_t max_bytes);
@@ -96,13 +101,15 @@ class Diagnostics {
     inspect::Node root;
 
     inspect::UintProperty total_slices_reserved;
+    inspect::UintProperty physical_extents;
     inspect::UintProperty max_bytes;
   };
   inspect::Node per_partition_node_;
   // Maps vpartition names to an object holding metrics for that vpartition.
   std::map<std::string, PerPartitionMetrics, std::less<>> per_partition_;
 
-  void AddPerPartitionMetrics(std::string name, uint64_t num_slices);
+  void AddPerPartitionMetrics(std::string name, uint64_t num_slices,
+                              uint64_t num_physical_extents);
 };
 
 }  // namespace fvm
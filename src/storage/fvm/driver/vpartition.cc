@@ -201,6 +201,21 @@ size_t VPartition::NumSlicesLocked() TA_REQ(lock_) {
   return count;
 }
 
+size_t VPartition::NumPhysicalExtentsLocked() TA_REQ(lock_) {
+  size_t count = 0;
+  uint64_t next_pslice = 0;
+  for (const auto& extent : slice_map_) {
+    for (uint64_t vslice = extent.start(); vslice < extent.end(); vslice++) {
+      uint64_t pslice = extent.at(vslice);
+      if (count == 0 || pslice != next_pslice) {
+        count++;
+      }
+      next_pslice = pslice + 1;
+    }
+  }
+  return count;
+}
+
 void VPartition::ExtentDestroyLocked(uint64_t vslice) TA_REQ(lock_) {
   ZX_ASSERT(vslice < mgr_->VSliceMax());
   ZX_ASSERT(SliceCanFree(vslice));
@@ -94,6 +94,10 @@ class VPartition : public PartitionDeviceType,
   // Returns the number of slices which are assigned to the vpartition.
   size_t NumSlicesLocked() TA_REQ(lock_);
 
+  // Returns the number of runs of physically contiguous slices backing this partition. Virtual
+  // extents that happen to be physically adjacent are counted as one run.
+  size_t NumPhysicalExtentsLocked() TA_REQ(lock_);
+
   // Destroy the extent containing the vslice.
   void ExtentDestroyLocked(uint64_t vslice) TA_REQ(lock_);
 
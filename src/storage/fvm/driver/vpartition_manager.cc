@@ -382,13 +382,20 @@ zx_status_t VPartitionManager::Load() {
       FreeSlices(vpartitions[i].get(), 0, VSliceMax());
       continue;
     }
+    size_t num_physical_extents;
+    {
+      fbl::AutoLock partition_lock(&vpartitions[i]->lock_);
+      num_physical_extents = vpartitions[i]->NumPhysicalExtentsLocked();
+    }
     sync_completion_t on_visible = {};
     if ((status = AddPartition(std::move(vpartitions[i]), &on_visible)) != ZX_OK) {
       zxlogf(ERROR, "Failed to add partition: %s", zx_status_get_string(status));
       continue;
     }
     sync_completion_wait(&on_visible, ZX_TIME_INFINITE);
-    partitions.push_back({.name = entry->name(), .num_slices = entry->slices});
+    partitions.push_back({.name = entry->name(),
+                          .num_slices = entry->slices,
+                          .num_physical_extents = num_physical_extents});
     device_count++;
   }
 
@@ -485,6 +492,35 @@ zx_status_t VPartitionManager::FindFreeSliceLocked(size_t* out, size_t hint) con
   return ZX_ERR_NO_SPACE;
 }
 
+zx_status_t VPartitionManager::FindFreeSliceRunLocked(size_t* out, size_t count,
+                                                      size_t hint) const {
+  hint = std::max(hint, 1lu);
+  const size_t slice_count = GetHeaderLocked()->GetAllocationTableUsedEntryCount();
+  if (count == 0 || count > slice_count) {
+    return ZX_ERR_NO_SPACE;
+  }
+  // Scan [hint, slice_count] and then [1, hint). A run does not wrap past the end of the table.
+  size_t run = 0;
+  for (size_t n = 0; n < slice_count; n++) {
+    size_t i = hint + n;
+    if (i > slice_count) {
+      i -= slice_count;
+    }
+    if (i == 1) {
+      run = 0;
+    }
+    if (!GetSliceEntryLocked(i)->IsFree()) {
+      run = 0;
+      continue;
+    }
+    if (++run == count) {
+      *out = i + 1 - count;
+      return ZX_OK;
+    }
+  }
+  return ZX_ERR_NO_SPACE;
+}
+
 zx_status_t VPartitionManager::AllocateSlices(VPartition* vp, size_t vslice_start, size_t count) {
   fbl::AutoLock lock(&lock_);
   return AllocateSlicesLocked(vp, vslice_start, count);
@@ -502,6 +538,7 @@ zx_status_t VPartitionManager::AllocateSlicesLocked(VPartition* vp, size_t vslic
   zx_status_t status = ZX_OK;
   size_t hint = 0;
   size_t total_slices_reserved = 0;
+  size_t total_physical_extents = 0;
 
   {
     fbl::AutoLock lock(&vp->lock_);
@@ -520,9 +557,26 @@ zx_status_t VPartitionManager::AllocateSlicesLocked(VPartition* vp, size_t vslic
       }
     }
 
+    // Prefer to continue the physical run backing the preceding vslice, so that growing a
+    // partition keeps it contiguous on disk.
+    if (size_t prev_pslice;
+        vslice_start > 0 && vp->SliceGetLocked(vslice_start - 1, &prev_pslice)) {
+      hint = prev_pslice + 1;
+    }
+    // Searching for a run scans the whole allocation table, so give up on it after one miss.
+    bool search_runs = true;
+
     for (size_t i = 0; i < count; i++) {
       size_t pslice;
       auto vslice = vslice_start + i;
+      // When the next slice of the current run is taken, move to a free run large enough for the
+      // rest of the request rather than filling isolated holes one slice at a time. If there is
+      // no such run, FindFreeSliceLocked() below falls back to the first free slice.
+      if (search_runs &&
+          (hint == 0 || hint > GetHeaderLocked()->GetAllocationTableUsedEntryCount() ||
+           !GetSliceEntryLocked(hint)->IsFree())) {
+        search_runs = FindFreeSliceRunLocked(&hint, count - i, hint) == ZX_OK;
+      }
       if (vp->SliceGetLocked(vslice, &pslice)) {
         zxlogf(ERROR, "FVM: Attempting to allocate vslice %zu that is already allocated.", vslice);
         status = ZX_ERR_INVALID_ARGS;
@@ -548,11 +602,13 @@ zx_status_t VPartitionManager::AllocateSlicesLocked(VPartition* vp, size_t vslic
     }
 
     total_slices_reserved = vp->NumSlicesLocked();
+    total_physical_extents = vp->NumPhysicalExtentsLocked();
   }
 
   if ((status = WriteFvmLocked()) == ZX_OK) {
     VPartitionEntry* entry = GetVPartEntryLocked(vp->entry_index());
-    diagnostics().UpdatePartitionMetrics(entry->name(), total_slices_reserved);
+    diagnostics().UpdatePartitionMetrics(entry->name(), total_slices_reserved,
+                                         total_physical_extents);
   } else {
     // Undo allocation in the event of failure; avoid holding VPartition lock while writing to fvm.
     fbl::AutoLock lock(&vp->lock_);
@@ -619,6 +675,7 @@ zx_status_t VPartitionManager::FreeSlicesLocked(VPartition* vp, uint64_t vslice_
   bool valid_range = false;
   std::string partition_name;
   size_t total_slices_reserved = 0;
+  size_t total_physical_extents = 0;
   {
     fbl::AutoLock lock(&vp->lock_);
     if (vp->IsKilledLocked())
@@ -658,6 +715,7 @@ zx_status_t VPartitionManager::FreeSlicesLocked(VPartition* vp, uint64_t vslice_
       }
     }
     total_slices_reserved = vp->NumSlicesLocked();
+    total_physical_extents = vp->NumPhysicalExtentsLocked();
   }
 
   if (!valid_range) {
@@ -666,7 +724,8 @@ zx_status_t VPartitionManager::FreeSlicesLocked(VPartition* vp, uint64_t vslice_
 
   zx_status_t status = WriteFvmLocked();
   if (status == ZX_OK) {
-    diagnostics().UpdatePartitionMetrics(partition_name, total_slices_reserved);
+    diagnostics().UpdatePartitionMetrics(partition_name, total_slices_reserved,
+                                         total_physical_extents);
   }
   return status;
 }
@@ -152,6 +152,9 @@ class VPartitionManager : public ManagerDeviceType {
 
   zx_status_t FindFreeVPartEntryLocked(size_t* out) const TA_REQ(lock_);
   zx_status_t FindFreeSliceLocked(size_t* out, size_t hint) const TA_REQ(lock_);
+  // Finds the first physical slice, starting at |hint| and wrapping around, that begins a run of
+  // at least |count| free slices.
+  zx_status_t FindFreeSliceRunLocked(size_t* out, size_t count, size_t hint) const TA_REQ(lock_);
 
   // See also GetHeader() for unlocked access.
   Header* GetHeaderLocked() const TA_REQ(lock_) { return &metadata_.GetHeader(); }
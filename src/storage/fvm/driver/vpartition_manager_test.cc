@@ -336,6 +336,42 @@ TEST_F(VPartitionManagerTest, InspectVmoTracksPartitionLimit) {
   }
 }
 
+// Verifies that extending a partition skips holes too small for the request, and that the resulting
+// fragmentation is reported in Inspect.
+TEST_F(VPartitionManagerTest, AllocateSlicesPrefersContiguousRun) {
+  // Physical layout: part1 = {1}, part2 = {2, 3}, part3 = {4}.
+  auto part1_or = AllocatePartition("part1", 1u);
+  ASSERT_TRUE(part1_or.is_ok());
+  auto part2_or = AllocatePartition("part2", 2u);
+  ASSERT_TRUE(part2_or.is_ok());
+  auto part3_or = AllocatePartition("part3", 1u);
+  ASSERT_TRUE(part3_or.is_ok());
+
+  // Leave a one slice hole at pslice 3.
+  ASSERT_EQ(device_->FreeSlices(part2_or.value().get(), 1, 1), ZX_OK);
+
+  // Three slices don't fit in the hole, so they should be placed together after part3.
+  ASSERT_EQ(device_->AllocateSlices(part1_or.value().get(), 1, 3), ZX_OK);
+  {
+    fbl::AutoLock lock(&part1_or.value()->lock_);
+    for (uint64_t vslice = 1; vslice < 4; vslice++) {
+      uint64_t pslice;
+      ASSERT_TRUE(part1_or.value()->SliceGetLocked(vslice, &pslice));
+      EXPECT_EQ(pslice, vslice + 4);
+    }
+  }
+
+  fpromise::result<inspect::Hierarchy> hierarchy =
+      inspect::ReadFromVmo(device_->diagnostics().DuplicateVmo());
+  ASSERT_TRUE(hierarchy.is_ok());
+  const inspect::Hierarchy* node = hierarchy.value().GetByPath({"fvm", "partitions", "part1"});
+  ASSERT_NE(node, nullptr);
+  auto* physical_extents =
+      node->node().get_property<inspect::UintPropertyValue>("physical_extents");
+  ASSERT_NE(physical_extents, nullptr);
+  EXPECT_EQ(physical_extents->value(), 2u);
+}
+
 // Tests that opening a device at a newer "oldest revision" updates the device's oldest revision to
 // the current revision value.
 constexpr uint64_t kNextRevision = kCurrentMinorVersion + 1;
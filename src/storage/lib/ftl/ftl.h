@@ -164,6 +164,8 @@ typedef struct FtlCounters {
   uint32_t wear_count;
   uint32_t initial_bad_blocks;
   uint32_t running_bad_blocks;
+  uint32_t map_cache_hits;
+  uint32_t map_cache_misses;
 } FtlCounters;
 
 // NDM Partition Information.
@@ -405,6 +405,8 @@ int FtlnReport(void* vol, ui32 msg, ...) {
       counters->wear_count = ftl->high_wc;
       counters->initial_bad_blocks = ndmInitialBadBlocks(ftl->ndm);
       counters->running_bad_blocks = ndmRunningBadBlocks(ftl->ndm);
+      counters->map_cache_hits = ftl->map_cache->hits;
+      counters->map_cache_misses = ftl->map_cache->misses;
       return 0;
     }
 
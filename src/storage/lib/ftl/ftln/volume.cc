@@ -140,6 +140,8 @@ zx_status_t VolumeImpl::GetCounters(Counters* counters) {
   counters->wear_count = ftl_counters.wear_count;
   counters->initial_bad_blocks = ftl_counters.initial_bad_blocks;
   counters->running_bad_blocks = ftl_counters.running_bad_blocks;
+  counters->map_cache_hits = ftl_counters.map_cache_hits;
+  counters->map_cache_misses = ftl_counters.map_cache_misses;
   return ZX_OK;
 }
 
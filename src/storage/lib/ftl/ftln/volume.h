@@ -56,6 +56,10 @@ class __EXPORT Volume {
     uint32_t wear_count = 0;
     uint32_t initial_bad_blocks = 0;
     uint32_t running_bad_blocks = 0;
+
+    // Lookups of the map page cache since the volume was mounted.
+    uint32_t map_cache_hits = 0;
+    uint32_t map_cache_misses = 0;
   };
 
   Volume() {}
@@ -89,6 +89,25 @@ TEST(FtlTest, WriteRemountRead) {
   ASSERT_EQ(0, memcmp(buf, buf2, kPageSize));
 }
 
+TEST(FtlTest, MapCacheCountersTrackLookups) {
+  FtlShell ftl;
+  ASSERT_TRUE(ftl.Init(kDefaultOptions));
+  ftl::Volume* volume = ftl.volume();
+  uint8_t buf[kPageSize] = {};
+  ASSERT_EQ(ZX_OK, volume->Write(1, 1, buf));
+
+  ftl::Volume::Counters before;
+  ASSERT_EQ(ZX_OK, volume->GetCounters(&before));
+  ASSERT_EQ(ZX_OK, volume->Read(1, 1, buf));
+  ASSERT_EQ(ZX_OK, volume->Read(1, 1, buf));
+
+  // The map page was cached by the write, so both reads should hit.
+  ftl::Volume::Counters after;
+  ASSERT_EQ(ZX_OK, volume->GetCounters(&after));
+  EXPECT_EQ(after.map_cache_misses, before.map_cache_misses);
+  EXPECT_GE(after.map_cache_hits, before.map_cache_hits + 2);
+}
+
 // Test powercuts on map block transfer.
 TEST(FtlTest, PowerCutOnBlockTransfer) {
   FtlShell ftl_shell;
@@ -222,6 +222,8 @@ void* ftlmcGetPage(FTLMC* cache, ui32 mpn, int* new_ptr) {
   // Check if specified page is in the cache.
   entry = in_cache(cache, mpn);
   if (entry) {
+    ++cache->hits;
+
     // Move entry to LRU list tail (MRU position).
     CIRC_NODE_REMOVE(&entry->lru_link);
     CIRC_LIST_APPEND(&entry->lru_link, &cache->lru_list);
@@ -241,6 +243,8 @@ void* ftlmcGetPage(FTLMC* cache, ui32 mpn, int* new_ptr) {
     return entry->data;
   }
 
+  ++cache->misses;
+
   // Not cached. Search LRU list for least recently used clean entry
   // If none found, use least recently used entry (head of LRU list).
   for (link = CIRC_LIST_HEAD(&cache->lru_list);; link = link->next_bck) {
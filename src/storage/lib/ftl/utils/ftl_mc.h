@@ -30,6 +30,8 @@ typedef struct {
   ui32 num_mpgs;          // number of cached map pages
   ui32 num_dirty;         // number of dirty cached entries
   ui32 mpg_sz;            // size of a cached map page in bytes
+  ui32 hits;              // number of lookups satisfied by the cache
+  ui32 misses;            // number of lookups that read the map page
 } FTLMC;
 
 __BEGIN_CDECLS
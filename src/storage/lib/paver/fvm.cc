@@ -17,6 +17,7 @@
 #include <lib/fit/defer.h>
 #include <lib/fzl/vmo-mapper.h>
 #include <lib/zx/channel.h>
+#include <lib/zx/clock.h>
 #include <lib/zx/fifo.h>
 #include <lib/zx/time.h>
 #include <lib/zx/vmo.h>
@@ -24,8 +25,14 @@
 #include <zircon/syscalls.h>
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <fbl/algorithm.h>
 #include <fbl/array.h>
@@ -140,12 +147,150 @@ zx_status_t FlushClient(block_client::Client& client) {
   return client.Transaction(&request, 1);
 }
 
-// Stream an FVM partition to disk.
-zx_status_t StreamFvmPartition(fvm::SparseReader* reader, PartitionInfo* part,
-                               const fzl::VmoMapper& mapper, block_client::Client& client,
-                               size_t block_size, block_fifo_request_t* request) {
+// Partition data is streamed to disk in chunks of |kChunkSize| bytes, through a VMO which holds
+// |kChunkCount| chunks followed by one chunk of zeroes. While one chunk is being read and
+// decompressed, the others can be in flight to the device.
+constexpr size_t kChunkSize = 1 << 20;
+constexpr size_t kChunkCount = 4;
+constexpr size_t kZeroChunk = kChunkCount;
+constexpr size_t kStreamVmoSize = (kChunkCount + 1) * kChunkSize;
+constexpr size_t kWriterThreadCount = kChunkCount - 1;
+
+// Writes chunks of the stream VMO to a block device from a pool of threads, so that reading and
+// decompressing the image overlaps with several outstanding writes.
+class WritePipeline {
+ public:
+  WritePipeline(block_client::Client& client, vmoid_t vmoid, size_t block_size)
+      : client_(client), vmoid_(vmoid), block_size_(block_size) {
+    for (size_t chunk = 0; chunk < kChunkCount; ++chunk) {
+      free_chunks_.push_back(chunk);
+    }
+    for (std::thread& writer : writers_) {
+      writer = std::thread([this] { WriteLoop(); });
+    }
+  }
+
+  // Abandons any writes which haven't been issued yet.
+  ~WritePipeline() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    condition_.notify_all();
+    for (std::thread& writer : writers_) {
+      writer.join();
+    }
+  }
+
+  WritePipeline(const WritePipeline&) = delete;
+  WritePipeline& operator=(const WritePipeline&) = delete;
+
+  // Waits for a chunk to be free and returns its index, or the error of a write which failed.
+  zx::result<size_t> AcquireChunk() {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [this] { return !free_chunks_.empty() || status_ != ZX_OK; });
+    if (status_ != ZX_OK) {
+      return zx::error(status_);
+    }
+    size_t chunk = free_chunks_.back();
+    free_chunks_.pop_back();
+    return zx::ok(chunk);
+  }
+
+  // Queues writing the first |length| bytes of |chunk| to the device at byte offset |dev_offset|.
+  // The chunk is freed again once written, unless it's |kZeroChunk|.
+  void Write(size_t chunk, uint64_t dev_offset, size_t length) {
+    {
+      std::lock_guard lock(mutex_);
+      pending_.push_back({.chunk = chunk, .dev_offset = dev_offset, .length = length});
+      ++outstanding_;
+    }
+    condition_.notify_all();
+  }
+
+  // Waits for all queued writes to complete and returns the first error from any of them.
+  zx_status_t Drain() {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [this] { return outstanding_ == 0; });
+    return status_;
+  }
+
+  uint64_t bytes_written() const {
+    std::lock_guard lock(mutex_);
+    return bytes_written_;
+  }
+
+ private:
+  struct PendingWrite {
+    size_t chunk;
+    uint64_t dev_offset;
+    size_t length;
+  };
+
+  void WriteLoop() {
+    while (true) {
+      PendingWrite write;
+      {
+        std::unique_lock lock(mutex_);
+        condition_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+        if (stopping_) {
+          return;
+        }
+        write = pending_.front();
+        pending_.pop_front();
+      }
+
+      block_fifo_request_t request = {
+          .command = {.opcode = BLOCK_OPCODE_WRITE, .flags = 0},
+          .group = 0,
+          .vmoid = vmoid_,
+      };
+      request.length = safemath::checked_cast<uint32_t>(write.length / block_size_);
+      request.vmo_offset = write.chunk * kChunkSize / block_size_;
+      request.dev_offset = write.dev_offset / block_size_;
+      zx_status_t status = client_.Transaction(&request, 1);
+      if (status != ZX_OK) {
+        ERROR("Error writing partition data length:%u dev_offset:%lu: %s\n", request.length,
+              request.dev_offset, zx_status_get_string(status));
+      }
+
+      {
+        std::lock_guard lock(mutex_);
+        if (status_ == ZX_OK) {
+          status_ = status;
+        }
+        if (write.chunk != kZeroChunk) {
+          free_chunks_.push_back(write.chunk);
+        }
+        if (status == ZX_OK) {
+          bytes_written_ += write.length;
+        }
+        --outstanding_;
+      }
+      condition_.notify_all();
+    }
+  }
+
+  block_client::Client& client_;
+  const vmoid_t vmoid_;
+  const size_t block_size_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<size_t> free_chunks_;
+  std::deque<PendingWrite> pending_;
+  // Writes which have been queued but haven't completed yet.
+  size_t outstanding_ = 0;
+  uint64_t bytes_written_ = 0;
+  zx_status_t status_ = ZX_OK;
+  bool stopping_ = false;
+  std::array<std::thread, kWriterThreadCount> writers_;
+};
+
+// Stream an FVM partition to disk. |chunks| is the mapping of the stream VMO.
+zx_status_t StreamFvmPartition(fvm::SparseReader* reader, PartitionInfo* part, uint8_t* chunks,
+                               WritePipeline& pipeline, size_t block_size) {
   size_t slice_size = reader->Image()->slice_size;
-  const size_t vmo_cap = mapper.size();
   for (size_t e = 0; e < part->aligned_pd.extent_count; e++) {
     LOG("Writing extent %zu... \n", e);
     fvm::ExtentDescriptor ext = GetExtent(part->pd, e);
@@ -154,42 +299,32 @@ zx_status_t StreamFvmPartition(fvm::SparseReader* reader, PartitionInfo* part,
 
     // Write real data
     while (bytes_left > 0) {
+      zx::result chunk = pipeline.AcquireChunk();
+      if (chunk.is_error()) {
+        return chunk.status_value();
+      }
       size_t actual;
-      zx_status_t status = reader->ReadData(reinterpret_cast<uint8_t*>(mapper.start()),
-                                            std::min(bytes_left, vmo_cap), &actual);
+      zx_status_t status = reader->ReadData(chunks + chunk.value() * kChunkSize,
+                                            std::min(bytes_left, kChunkSize), &actual);
       if (status != ZX_OK) {
         ERROR("Error reading extent data with %zu bytes of %zu remaining: %s\n", bytes_left,
               ext.extent_length, zx_status_get_string(status));
         return status;
       }
 
-      const size_t vmo_sz = actual;
       bytes_left -= actual;
 
-      if (vmo_sz == 0) {
+      if (actual == 0) {
         ERROR("Read nothing from src_fd; %zu bytes left\n", bytes_left);
         return ZX_ERR_IO;
       }
-      if (vmo_sz % block_size != 0) {
-        ERROR("Cannot write non-block size multiple: %zu\n", vmo_sz);
+      if (actual % block_size != 0) {
+        ERROR("Cannot write non-block size multiple: %zu\n", actual);
         return ZX_ERR_IO;
       }
 
-      uint64_t length = vmo_sz / block_size;
-      if (length > UINT32_MAX) {
-        ERROR("Error writing partition: Too large\n");
-        return ZX_ERR_OUT_OF_RANGE;
-      }
-      request->length = static_cast<uint32_t>(length);
-      request->vmo_offset = 0;
-      request->dev_offset = offset / block_size;
-
-      if (zx_status_t status = client.Transaction(request, 1); status != ZX_OK) {
-        ERROR("Error writing partition data\n");
-        return status;
-      }
-
-      offset += vmo_sz;
+      pipeline.Write(chunk.value(), offset, actual);
+      offset += actual;
     }
 
     // Write trailing zeroes (which are implied, but were omitted from
@@ -197,29 +332,22 @@ zx_status_t StreamFvmPartition(fvm::SparseReader* reader, PartitionInfo* part,
     bytes_left = (ext.slice_count * slice_size) - ext.extent_length;
     if (bytes_left > 0) {
       LOG("%zu bytes written, %zu zeroes left\n", ext.extent_length, bytes_left);
-      memset(mapper.start(), 0, vmo_cap);
     }
     while (bytes_left > 0) {
-      uint64_t length = std::min(bytes_left, vmo_cap) / block_size;
-      if (length > UINT32_MAX) {
-        ERROR("Error writing trailing zeroes: Too large(%lu)\n", length);
-        return ZX_ERR_OUT_OF_RANGE;
-      }
-      request->length = static_cast<uint32_t>(length);
-      request->vmo_offset = 0;
-      request->dev_offset = offset / block_size;
-
-      if (zx_status_t status = client.Transaction(request, 1); status != ZX_OK) {
-        ERROR("Error writing trailing zeroes length:%u dev_offset:%lu vmo_offset:%lu\n",
-              request->length, request->dev_offset, request->vmo_offset);
-        return status;
-      }
-
-      offset += request->length * block_size;
-      bytes_left -= request->length * block_size;
+      size_t length = std::min(bytes_left, kChunkSize);
+      pipeline.Write(kZeroChunk, offset, length);
+      offset += length;
+      bytes_left -= length;
     }
   }
-  return ZX_OK;
+  return pipeline.Drain();
+}
+
+// Logs how much data was written in |elapsed| and the resulting throughput.
+void LogThroughput(const char* what, uint64_t bytes, zx::duration elapsed) {
+  const int64_t elapsed_ms = std::max<int64_t>(elapsed.to_msecs(), 1);
+  LOG("%s: wrote %lu MiB in %ld ms (%lu MiB/s)\n", what, bytes >> 20, elapsed_ms,
+      (bytes >> 20) * 1000 / elapsed_ms);
 }
 
 }  // namespace
@@ -827,16 +955,17 @@ zx::result<> FvmStreamPartitions(const fbl::unique_fd& devfs_root,
 
   LOG("Partition space pre-allocated successfully.\n");
 
-  constexpr size_t vmo_size = 1 << 20;
-
   fzl::VmoMapper mapping;
   zx::vmo vmo;
-  if (mapping.CreateAndMap(vmo_size, ZX_VM_PERM_READ | ZX_VM_PERM_WRITE, nullptr, &vmo) != ZX_OK) {
+  if (mapping.CreateAndMap(kStreamVmoSize, ZX_VM_PERM_READ | ZX_VM_PERM_WRITE, nullptr, &vmo) !=
+      ZX_OK) {
     ERROR("Failed to create stream VMO\n");
     return zx::error(ZX_ERR_NO_MEMORY);
   }
 
   // Now that all partitions are preallocated, begin streaming data to them.
+  const zx::time stream_start = zx::clock::get_monotonic();
+  uint64_t total_bytes_written = 0;
   for (size_t p = 0; p < parts.size(); p++) {
     const fidl::WireResult result = fidl::WireCall(parts[p].partition)->GetInfo();
     if (!result.ok()) {
@@ -850,6 +979,10 @@ zx::result<> FvmStreamPartitions(const fbl::unique_fd& devfs_root,
       return response.take_error();
     }
     const fuchsia_hardware_block::wire::BlockInfo& info = response.value()->info;
+    if (kChunkSize % info.block_size != 0) {
+      ERROR("Unsupported block size %u\n", info.block_size);
+      return zx::error(ZX_ERR_NOT_SUPPORTED);
+    }
 
     auto [session, server] = fidl::Endpoints<block::Session>::Create();
     if (fidl::Status result = fidl::WireCall(parts[p].partition)->OpenSession(std::move(server));
@@ -870,15 +1003,16 @@ zx::result<> FvmStreamPartitions(const fbl::unique_fd& devfs_root,
       return vmoid.take_error();
     }
 
-    block_fifo_request_t request = {
-        .command = {.opcode = BLOCK_OPCODE_WRITE, .flags = 0},
-        .group = 0,
-        .vmoid = vmoid->get(),
-    };
-
     LOG("Streaming partition %zu\n", p);
-    status = zx::make_result(
-        StreamFvmPartition(reader.get(), &parts[p], mapping, client, info.block_size, &request));
+    const zx::time partition_start = zx::clock::get_monotonic();
+    uint64_t bytes_written;
+    {
+      WritePipeline pipeline(client, vmoid->get(), info.block_size);
+      status = zx::make_result(StreamFvmPartition(reader.get(), &parts[p],
+                                                  static_cast<uint8_t*>(mapping.start()), pipeline,
+                                                  info.block_size));
+      bytes_written = pipeline.bytes_written();
+    }
     LOG("Done streaming partition %zu\n", p);
     if (status.is_error()) {
       ERROR("Failed to stream partition status=%d\n", status.error_value());
@@ -889,7 +1023,10 @@ zx::result<> FvmStreamPartitions(const fbl::unique_fd& devfs_root,
       return status.take_error();
     }
     LOG("Done flushing partition %zu\n", p);
+    LogThroughput("Partition", bytes_written, zx::clock::get_monotonic() - partition_start);
+    total_bytes_written += bytes_written;
   }
+  LogThroughput("FVM image", total_bytes_written, zx::clock::get_monotonic() - stream_start);
 
   for (const PartitionInfo& part_info : parts) {
     // Upgrade the old partition (currently active) to the new partition (currently
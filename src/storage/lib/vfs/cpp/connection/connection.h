@@ -41,7 +41,8 @@ namespace fs::internal {
 // The Vnode's methods will be invoked in response to FIDL protocol messages received over the
 // channel.
 //
-// This class is thread-safe, although only a single-threaded dispatcher is supported.
+// This class is thread-safe. On a multi-threaded dispatcher, FIDL handles the messages of a single
+// connection one at a time, so per-connection state needs no locking.
 class Connection : public fbl::DoublyLinkedListable<Connection*> {
  public:
   // Closes the connection.
@@ -258,6 +258,8 @@ zx_status_t FuchsiaVfs::Rename(zx::event token, fbl::RefPtr<Vnode> oldparent,
         status != ZX_OK) {
       return status;
     }
+    InvalidateLookup(*oldparent, oldStr);
+    InvalidateLookup(*newparent, newStr);
   }
   oldparent->Notify(oldStr, fio::wire::WatchEvent::kRemoved);
   newparent->Notify(newStr, fio::wire::WatchEvent::kAdded);
@@ -309,12 +311,13 @@ zx_status_t FuchsiaVfs::Link(zx::event token, fbl::RefPtr<Vnode> oldparent, std:
 
   // Look up the target vnode
   fbl::RefPtr<Vnode> target;
-  if (zx_status_t status = oldparent->Lookup(oldStr, &target); status != ZX_OK) {
+  if (zx_status_t status = LookupLocked(oldparent, oldStr, &target); status != ZX_OK) {
     return status;
   }
   if (zx_status_t status = newparent->Link(newStr, target); status != ZX_OK) {
     return status;
   }
+  InvalidateLookup(*newparent, newStr);
   newparent->Notify(newStr, fio::wire::WatchEvent::kAdded);
   return ZX_OK;
 }
@@ -232,6 +232,8 @@ class FuchsiaVfs : public Vfs {
   void WillDestroy() {
     ZX_ASSERT(!is_terminating_);
     is_terminating_.store(true);
+    // Cached lookups must not keep vnodes alive past the filesystem's teardown.
+    ClearLookupCache();
     // Return the strong count taken in the constructor.
     SharedPtr strong(this);
   }
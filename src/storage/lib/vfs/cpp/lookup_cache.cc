@@ -0,0 +1,113 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/storage/lib/vfs/cpp/lookup_cache.h"
+
+#include <zircon/assert.h>
+
+#include <utility>
+
+namespace fs {
+
+LookupCache::LookupCache(size_t capacity) : capacity_(capacity) { ZX_ASSERT(capacity_ > 0); }
+
+LookupCache::~LookupCache() = default;
+
+zx_status_t LookupCache::Lookup(const fbl::RefPtr<Vnode>& dir, std::string_view name,
+                                fbl::RefPtr<Vnode>* out) {
+  uint64_t generation;
+  {
+    std::lock_guard lock(lock_);
+    if (auto it = index_.find(Key{dir.get(), name}); it != index_.end()) {
+      // Move the entry to the front of the LRU list.
+      entries_.splice(entries_.begin(), entries_, it->second);
+      const fbl::RefPtr<Vnode>& vnode = it->second->vnode;
+      if (!vnode) {
+        ++stats_.negative_hits;
+        return ZX_ERR_NOT_FOUND;
+      }
+      ++stats_.hits;
+      *out = vnode;
+      return ZX_OK;
+    }
+    ++stats_.misses;
+    generation = generation_;
+  }
+
+  fbl::RefPtr<Vnode> vnode;
+  zx_status_t status = dir->Lookup(name, &vnode);
+  if (status == ZX_OK) {
+    Insert(dir, name, vnode, generation);
+    *out = std::move(vnode);
+  } else if (status == ZX_ERR_NOT_FOUND) {
+    Insert(dir, name, nullptr, generation);
+  }
+  return status;
+}
+
+void LookupCache::Insert(const fbl::RefPtr<Vnode>& dir, std::string_view name,
+                         fbl::RefPtr<Vnode> vnode, uint64_t generation) {
+  EntryList removed;
+  std::lock_guard lock(lock_);
+  if (generation != generation_) {
+    return;
+  }
+  // A concurrent lookup of the same name may have inserted it already.
+  if (index_.find(Key{dir.get(), name}) != index_.end()) {
+    return;
+  }
+  if (entries_.size() >= capacity_) {
+    const Entry& lru = entries_.back();
+    EraseLocked(index_.find(Key{lru.dir.get(), lru.name}), removed);
+    ++stats_.evictions;
+  }
+  entries_.push_front(Entry{.dir = dir, .name = std::string(name), .vnode = std::move(vnode)});
+  index_.emplace(Key{dir.get(), entries_.front().name}, entries_.begin());
+}
+
+void LookupCache::Invalidate(const Vnode& dir, std::string_view name) {
+  EntryList removed;
+  std::lock_guard lock(lock_);
+  ++generation_;
+  if (auto it = index_.find(Key{&dir, name}); it != index_.end()) {
+    EraseLocked(it, removed);
+  }
+}
+
+void LookupCache::Invalidate(const Vnode& dir) {
+  EntryList removed;
+  std::lock_guard lock(lock_);
+  ++generation_;
+  // Entries are ordered by directory first, so all of the entries of |dir| are adjacent.
+  auto it = index_.lower_bound(Key{&dir, std::string_view()});
+  while (it != index_.end() && it->first.dir == &dir) {
+    EraseLocked(it++, removed);
+  }
+}
+
+void LookupCache::Clear() {
+  EntryList removed;
+  std::lock_guard lock(lock_);
+  ++generation_;
+  index_.clear();
+  removed.swap(entries_);
+}
+
+size_t LookupCache::size() const {
+  std::lock_guard lock(lock_);
+  return entries_.size();
+}
+
+LookupCache::Stats LookupCache::GetStats() const {
+  std::lock_guard lock(lock_);
+  return stats_;
+}
+
+void LookupCache::EraseLocked(EntryMap::iterator it, EntryList& removed) {
+  EntryList::iterator entry = it->second;
+  index_.erase(it);
+  removed.splice(removed.end(), entries_, entry);
+}
+
+}  // namespace fs
@@ -0,0 +1,112 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_STORAGE_LIB_VFS_CPP_LOOKUP_CACHE_H_
+#define SRC_STORAGE_LIB_VFS_CPP_LOOKUP_CACHE_H_
+
+#include <zircon/compiler.h>
+#include <zircon/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <fbl/ref_ptr.h>
+
+#include "src/storage/lib/vfs/cpp/vnode.h"
+
+namespace fs {
+
+// A bounded, least-recently-used cache of directory lookups which is shared by all connections of
+// a |Vfs|. Each entry maps a directory and a name to the vnode which |Vnode::Lookup| returned for
+// it, or records that the lookup failed with ZX_ERR_NOT_FOUND (a negative entry), so that repeated
+// path walks and failed opens of the same names don't reach the filesystem.
+//
+// Entries hold references to both the directory and the child, so a cached directory can't be
+// destroyed and have its address reused by an unrelated vnode while the entry exists.
+//
+// The cache doesn't observe directory modifications by itself. |Vfs| invalidates the affected
+// entries of the operations it performs, and filesystems which modify directories without going
+// through |Vfs| must call |Invalidate| themselves. This class is thread-safe.
+class LookupCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t negative_hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+
+  explicit LookupCache(size_t capacity);
+  ~LookupCache();
+
+  LookupCache(const LookupCache&) = delete;
+  LookupCache& operator=(const LookupCache&) = delete;
+
+  // Looks up |name| in |dir|, consulting the cache first and calling |dir->Lookup| on a miss. The
+  // result of the lookup is cached if it succeeded or failed with ZX_ERR_NOT_FOUND. |name| must be
+  // a single, canonical path component.
+  zx_status_t Lookup(const fbl::RefPtr<Vnode>& dir, std::string_view name,
+                     fbl::RefPtr<Vnode>* out);
+
+  // Drops any entry for |name| in |dir|. Must be called whenever |name| is added to, removed from,
+  // or replaced in |dir|.
+  void Invalidate(const Vnode& dir, std::string_view name);
+
+  // Drops every entry for names in |dir|.
+  void Invalidate(const Vnode& dir);
+
+  // Drops every entry.
+  void Clear();
+
+  size_t capacity() const { return capacity_; }
+  size_t size() const;
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    fbl::RefPtr<Vnode> dir;
+    std::string name;
+    // Null for a negative entry.
+    fbl::RefPtr<Vnode> vnode;
+  };
+  using EntryList = std::list<Entry>;
+
+  struct Key {
+    const Vnode* dir;
+    std::string_view name;
+  };
+  struct KeyLess {
+    bool operator()(const Key& a, const Key& b) const {
+      return a.dir < b.dir || (a.dir == b.dir && a.name < b.name);
+    }
+  };
+  // Keys view the name stored in the corresponding list entry, which never moves.
+  using EntryMap = std::map<Key, EntryList::iterator, KeyLess>;
+
+  void Insert(const fbl::RefPtr<Vnode>& dir, std::string_view name, fbl::RefPtr<Vnode> vnode,
+              uint64_t generation) __TA_EXCLUDES(lock_);
+  // Unlinks the entry at |it| and moves it into |removed|, so that the references it holds are
+  // released once |lock_| is dropped.
+  void EraseLocked(EntryMap::iterator it, EntryList& removed) __TA_REQUIRES(lock_);
+
+  const size_t capacity_;
+
+  mutable std::mutex lock_;
+  // Ordered from most to least recently used.
+  EntryList entries_ __TA_GUARDED(lock_);
+  EntryMap index_ __TA_GUARDED(lock_);
+  // Incremented by every invalidation, so that a lookup which raced with one doesn't cache a result
+  // which may already be stale.
+  uint64_t generation_ __TA_GUARDED(lock_) = 0;
+  Stats stats_ __TA_GUARDED(lock_);
+};
+
+}  // namespace fs
+
+#endif  // SRC_STORAGE_LIB_VFS_CPP_LOOKUP_CACHE_H_
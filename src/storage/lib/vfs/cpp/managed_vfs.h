@@ -27,7 +27,11 @@ namespace fs {
 // This implementation is the normal one used on Fuchsia. It will not work in host builds.
 //
 // This class is thread-safe, but it is unsafe to shutdown the dispatch loop before shutting down
-// the ManagedVfs object, and a multi-threaded dispatcher is *not* supported.
+// the ManagedVfs object.
+//
+// Connections may be served by a multi-threaded dispatcher. The messages of a single connection are
+// still handled one at a time, but different connections are handled in parallel, so every vnode
+// reachable from the VFS must then be safe to use from several threads at once.
 class ManagedVfs : public FuchsiaVfs {
  public:
   explicit ManagedVfs(async_dispatcher_t* dispatcher);
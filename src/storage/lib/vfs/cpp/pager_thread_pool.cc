@@ -10,6 +10,8 @@
 #include <zircon/syscalls/types.h>
 #include <zircon/threads.h>
 
+#include <optional>
+
 #include <fbl/auto_lock.h>
 
 #include "src/storage/lib/vfs/cpp/paged_vfs.h"
@@ -56,10 +58,29 @@ std::vector<zx::unowned_thread> PagerThreadPool::GetPagerThreads() const {
   return result;
 }
 
+namespace {
+
+// Returns whether |next| is a read request that continues exactly where |range| ends, so the two
+// can be serviced as a single read.
+bool CanCoalesceRead(const zx_port_packet_t& range, const zx_port_packet_t& next) {
+  return next.type == ZX_PKT_TYPE_PAGE_REQUEST && next.key == range.key &&
+         next.page_request.command == ZX_PAGER_VMO_READ &&
+         next.page_request.offset == range.page_request.offset + range.page_request.length;
+}
+
+}  // namespace
+
 void PagerThreadPool::ThreadProc() {
+  // A packet that was dequeued while coalescing but couldn't be merged. It's handled on the next
+  // iteration instead of waiting on the port.
+  std::optional<zx_port_packet_t> pending;
+
   while (true) {
     zx_port_packet_t packet;
-    if (zx_status_t status = port_.wait(zx::time::infinite(), &packet); status != ZX_OK) {
+    if (pending) {
+      packet = *pending;
+      pending.reset();
+    } else if (zx_status_t status = port_.wait(zx::time::infinite(), &packet); status != ZX_OK) {
       // TODO(brettw) it would be nice to log from here but some drivers that depend on this
       // library aren't allowed to log.
       // FX_LOGST(ERROR, "pager") << "Pager port wait failed, stopping. The system will probably go
@@ -75,6 +96,20 @@ void PagerThreadPool::ThreadProc() {
 
     switch (packet.page_request.command) {
       case ZX_PAGER_VMO_READ:
+        // A sequential fault pattern queues a run of read requests for consecutive ranges of the
+        // same vmo. Service whatever part of that run is already queued with a single read so the
+        // filesystem can issue one larger transfer and supply the pages in one call. This never
+        // blocks: the first packet that isn't a continuation is kept for the next iteration.
+        for (int i = 1; i < kMaxCoalescedReadRequests; i++) {
+          zx_port_packet_t next;
+          if (port_.wait(zx::time::infinite_past(), &next) != ZX_OK)
+            break;
+          if (!CanCoalesceRead(packet, next)) {
+            pending = next;
+            break;
+          }
+          packet.page_request.length += next.page_request.length;
+        }
         vfs_.PagerVmoRead(packet.key, packet.page_request.offset, packet.page_request.length);
         break;
       case ZX_PAGER_VMO_DIRTY:
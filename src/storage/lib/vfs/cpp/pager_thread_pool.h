@@ -46,6 +46,10 @@ class PagerThreadPool {
   std::vector<zx::unowned_thread> GetPagerThreads() const;
 
  private:
+  // The maximum number of queued read requests for adjacent ranges of a vmo that a thread will
+  // merge into a single call to PagedVfs::PagerVmoRead().
+  static constexpr int kMaxCoalescedReadRequests = 16;
+
   // This function runs each background thread.
   void ThreadProc();
 
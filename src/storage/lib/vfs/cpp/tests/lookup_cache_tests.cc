@@ -0,0 +1,133 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/storage/lib/vfs/cpp/lookup_cache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "src/storage/lib/vfs/cpp/pseudo_dir.h"
+#include "src/storage/lib/vfs/cpp/pseudo_file.h"
+
+namespace {
+
+// A pseudo-directory which counts calls to |Lookup|.
+class CountingDir : public fs::PseudoDir {
+ public:
+  zx_status_t Lookup(std::string_view name, fbl::RefPtr<fs::Vnode>* out) override {
+    ++lookups;
+    return PseudoDir::Lookup(name, out);
+  }
+
+  int lookups = 0;
+
+ private:
+  friend fbl::internal::MakeRefCountedHelper<CountingDir>;
+  friend fbl::RefPtr<CountingDir>;
+
+  CountingDir() = default;
+  ~CountingDir() override = default;
+};
+
+TEST(LookupCache, CachesPositiveAndNegativeLookups) {
+  auto dir = fbl::MakeRefCounted<CountingDir>();
+  auto file = fbl::MakeRefCounted<fs::UnbufferedPseudoFile>();
+  ASSERT_EQ(dir->AddEntry("file", file), ZX_OK);
+  fs::LookupCache cache(8);
+
+  for (int i = 0; i < 3; ++i) {
+    fbl::RefPtr<fs::Vnode> out;
+    ASSERT_EQ(cache.Lookup(dir, "file", &out), ZX_OK);
+    EXPECT_EQ(out, file);
+    EXPECT_EQ(cache.Lookup(dir, "missing", &out), ZX_ERR_NOT_FOUND);
+  }
+  EXPECT_EQ(dir->lookups, 2);
+  EXPECT_EQ(cache.size(), 2u);
+
+  fs::LookupCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.negative_hits, 2u);
+}
+
+TEST(LookupCache, InvalidateDropsEntries) {
+  auto dir = fbl::MakeRefCounted<CountingDir>();
+  fs::LookupCache cache(8);
+
+  fbl::RefPtr<fs::Vnode> out;
+  ASSERT_EQ(cache.Lookup(dir, "file", &out), ZX_ERR_NOT_FOUND);
+
+  // A negative entry must not hide an entry added afterwards.
+  auto file = fbl::MakeRefCounted<fs::UnbufferedPseudoFile>();
+  ASSERT_EQ(dir->AddEntry("file", file), ZX_OK);
+  cache.Invalidate(*dir, "file");
+  ASSERT_EQ(cache.Lookup(dir, "file", &out), ZX_OK);
+  EXPECT_EQ(out, file);
+  EXPECT_EQ(dir->lookups, 2);
+
+  // Nor may a positive entry outlive the removal of its name.
+  ASSERT_EQ(dir->RemoveEntry("file"), ZX_OK);
+  cache.Invalidate(*dir);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.Lookup(dir, "file", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(dir->lookups, 3);
+}
+
+TEST(LookupCache, InvalidateDirectoryOnlyDropsItsEntries) {
+  auto dir_a = fbl::MakeRefCounted<CountingDir>();
+  auto dir_b = fbl::MakeRefCounted<CountingDir>();
+  fs::LookupCache cache(8);
+
+  fbl::RefPtr<fs::Vnode> out;
+  for (const char* name : {"a", "b", "c"}) {
+    EXPECT_EQ(cache.Lookup(dir_a, name, &out), ZX_ERR_NOT_FOUND);
+    EXPECT_EQ(cache.Lookup(dir_b, name, &out), ZX_ERR_NOT_FOUND);
+  }
+  EXPECT_EQ(cache.size(), 6u);
+
+  cache.Invalidate(*dir_a);
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.Lookup(dir_b, "b", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(dir_b->lookups, 3);
+}
+
+TEST(LookupCache, EvictsLeastRecentlyUsed) {
+  auto dir = fbl::MakeRefCounted<CountingDir>();
+  fs::LookupCache cache(2);
+
+  fbl::RefPtr<fs::Vnode> out;
+  EXPECT_EQ(cache.Lookup(dir, "a", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(cache.Lookup(dir, "b", &out), ZX_ERR_NOT_FOUND);
+  // Touch "a" so that "b" is the least recently used entry.
+  EXPECT_EQ(cache.Lookup(dir, "a", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(cache.Lookup(dir, "c", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(dir->lookups, 3);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.GetStats().evictions, 1u);
+
+  EXPECT_EQ(cache.Lookup(dir, "a", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(dir->lookups, 3);
+  EXPECT_EQ(cache.Lookup(dir, "b", &out), ZX_ERR_NOT_FOUND);
+  EXPECT_EQ(dir->lookups, 4);
+}
+
+TEST(LookupCache, ClearReleasesVnodes) {
+  auto dir = fbl::MakeRefCounted<CountingDir>();
+  auto file = fbl::MakeRefCounted<fs::UnbufferedPseudoFile>();
+  ASSERT_EQ(dir->AddEntry("file", file), ZX_OK);
+  fs::LookupCache cache(8);
+
+  fbl::RefPtr<fs::Vnode> out;
+  ASSERT_EQ(cache.Lookup(dir, "file", &out), ZX_OK);
+  out.reset();
+  ASSERT_EQ(dir->RemoveEntry("file"), ZX_OK);
+  EXPECT_EQ(file->ref_count_debug(), 2);
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(file->ref_count_debug(), 1);
+}
+
+}  // namespace
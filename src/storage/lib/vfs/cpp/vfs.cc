@@ -26,8 +26,11 @@ namespace {
 // On success, |path| will be the canonical name for the entry to lookup within |vndir|. Note that
 // on Fuchsia, the dot path (".") is used as the canonical form for a reference to |vndir| itself.
 //
+// Intermediate components are looked up through |lookup_cache| if it isn't null.
+//
 // See https://fxbug.dev/42103076 for a discussion on this mapping.
-zx_status_t Traverse(fbl::RefPtr<Vnode>& vndir, std::string_view& path) {
+zx_status_t Traverse(fbl::RefPtr<Vnode>& vndir, std::string_view& path,
+                     LookupCache* lookup_cache) {
   if (path.empty() || path.length() >= fio::kMaxPathLength) {
     return ZX_ERR_INVALID_ARGS;
   }
@@ -68,7 +71,9 @@ zx_status_t Traverse(fbl::RefPtr<Vnode>& vndir, std::string_view& path) {
     }
     // Traverse to the next component, updating |vndir| and |path| in-place.
     fbl::RefPtr<fs::Vnode> next_vn;
-    if (zx_status_t status = vndir->Lookup(component, &next_vn); status != ZX_OK) {
+    zx_status_t status = lookup_cache ? lookup_cache->Lookup(vndir, component, &next_vn)
+                                      : vndir->Lookup(component, &next_vn);
+    if (status != ZX_OK) {
       return status;
     }
     vndir = std::move(next_vn);
@@ -100,13 +105,62 @@ constexpr zx::result<CreationType> GetCreationType(fio::Flags flags) {
 
 Vfs::Vfs() = default;
 
+void Vfs::EnableLookupCache(size_t capacity) {
+  ZX_ASSERT(!lookup_cache_);
+  lookup_cache_ = std::make_unique<LookupCache>(capacity);
+}
+
+void Vfs::InvalidateLookup(const Vnode& dir, std::string_view name) {
+  if (lookup_cache_) {
+    lookup_cache_->Invalidate(dir, name);
+  }
+}
+
+void Vfs::InvalidateLookups(const Vnode& dir) {
+  if (lookup_cache_) {
+    lookup_cache_->Invalidate(dir);
+  }
+}
+
+std::optional<LookupCache::Stats> Vfs::GetLookupCacheStats() const {
+  if (!lookup_cache_) {
+    return std::nullopt;
+  }
+  return lookup_cache_->GetStats();
+}
+
+void Vfs::ClearLookupCache() {
+  if (lookup_cache_) {
+    lookup_cache_->Clear();
+  }
+}
+
+zx_status_t Vfs::LookupLocked(const fbl::RefPtr<Vnode>& vndir, std::string_view name,
+                              fbl::RefPtr<Vnode>* out) {
+  if (lookup_cache_) {
+    return lookup_cache_->Lookup(vndir, name, out);
+  }
+  return vndir->Lookup(name, out);
+}
+
 Vfs::OpenResult Vfs::Open(fbl::RefPtr<Vnode> vndir, std::string_view path,
                           VnodeConnectionOptions options, fuchsia_io::Rights connection_rights) {
   FS_PRETTY_TRACE_DEBUG("Vfs::Open: path='", path, "' options=", options,
                         ", connection_rights=", connection_rights);
+  // An open which cannot create an entry doesn't modify the namespace.
+  if (internal::CreationModeFromFidl(options.flags) == CreationMode::kNever) {
+    SharedLock lock(vfs_lock_);
+    return OpenLocked(std::move(vndir), path, options, connection_rights);
+  }
   std::lock_guard lock(vfs_lock_);
+  return OpenLocked(std::move(vndir), path, options, connection_rights);
+}
+
+Vfs::OpenResult Vfs::OpenLocked(fbl::RefPtr<Vnode> vndir, std::string_view path,
+                                VnodeConnectionOptions options,
+                                fuchsia_io::Rights connection_rights) {
   // Traverse directory tree until last component, updating |vndir| and |path| in-place.
-  if (zx_status_t status = Traverse(vndir, path); status != ZX_OK) {
+  if (zx_status_t status = Traverse(vndir, path, lookup_cache_.get()); status != ZX_OK) {
     return status;
   }
   if (vndir->IsRemote()) {
@@ -193,14 +247,26 @@ zx::result<Vfs::Open2Result> Vfs::Open3(fbl::RefPtr<Vnode> vndir, std::string_vi
   FS_PRETTY_TRACE_DEBUG("Vfs::Open3: path: '", path, "', flags: ", flags, ", options: ", *options,
                         ", rights: ", connection_rights);
 
+  // An open which cannot create an entry doesn't modify the namespace.
+  if (internal::CreationModeFromFidl(flags) == CreationMode::kNever) {
+    SharedLock lock(vfs_lock_);
+    return Open3Locked(std::move(vndir), path, flags, options, connection_rights);
+  }
   std::lock_guard lock(vfs_lock_);
+  return Open3Locked(std::move(vndir), path, flags, options, connection_rights);
+}
+
+zx::result<Vfs::Open2Result> Vfs::Open3Locked(fbl::RefPtr<Vnode> vndir, std::string_view path,
+                                              fuchsia_io::Flags flags,
+                                              const fuchsia_io::wire::Options* options,
+                                              fuchsia_io::Rights connection_rights) {
 
   if (ReadonlyLocked() && (connection_rights & fs::kAllMutableIo2Rights)) {
     FS_PRETTY_TRACE_DEBUG("Vfs::Open3: Rights incompatible, filesystem is read-only.");
     return zx::error(ZX_ERR_ACCESS_DENIED);
   }
   // Traverse directory tree until last component, updating |vndir| and |path| in-place.
-  if (zx_status_t status = Traverse(vndir, path); status != ZX_OK) {
+  if (zx_status_t status = Traverse(vndir, path, lookup_cache_.get()); status != ZX_OK) {
     return zx::error(status);
   }
   if (vndir->IsRemote()) {
@@ -299,6 +365,7 @@ zx_status_t Vfs::Unlink(fbl::RefPtr<Vnode> vndir, std::string_view name, bool mu
     if (zx_status_t status = vndir->Unlink(name, must_be_dir); status != ZX_OK) {
       return status;
     }
+    InvalidateLookup(*vndir, name);
   }
   return ZX_OK;
 }
@@ -326,6 +393,7 @@ zx::result<std::tuple<fbl::RefPtr<Vnode>, /*vnode_is_open*/ bool>> Vfs::CreateOr
       // |Vnode::Create()| ensures the returned object has already been opened on success.
       zx::result created = vndir->Create(name, *type);
       if (created.is_ok()) {
+        InvalidateLookup(*vndir, name);
         vndir->Notify(name, fio::WatchEvent::kAdded);
         return zx::ok(std::tuple{*std::move(created), true});
       }
@@ -355,7 +423,7 @@ zx::result<std::tuple<fbl::RefPtr<Vnode>, /*vnode_is_open*/ bool>> Vfs::CreateOr
   }
   // We didn't create a new object, try to lookup an existing entry matching |name|.
   fbl::RefPtr<Vnode> vn;
-  if (zx_status_t status = vndir->Lookup(name, &vn); status != ZX_OK) {
+  if (zx_status_t status = LookupLocked(vndir, name, &vn); status != ZX_OK) {
     return zx::error(status);
   }
   if (mode == CreationMode::kAlways) {
@@ -389,10 +457,17 @@ zx::result<bool> Vfs::TrimName(std::string_view& name) {
 
 zx_status_t Vfs::Readdir(Vnode* vn, VdirCookie* cookie, void* dirents, size_t len,
                          size_t* out_actual) {
-  std::lock_guard lock(vfs_lock_);
+  SharedLock lock(vfs_lock_);
   return vn->Readdir(cookie, dirents, len, out_actual);
 }
 
+zx_status_t Vfs::ReaddirWithAttributes(Vnode* vn, VdirCookie* cookie, void* dirents, size_t len,
+                                       size_t* out_actual, VnodeAttributesQuery query,
+                                       std::vector<VnodeAttributes>* attributes) {
+  SharedLock lock(vfs_lock_);
+  return vn->ReaddirWithAttributes(cookie, dirents, len, out_actual, query, attributes);
+}
+
 void Vfs::SetReadonly(bool value) {
   std::lock_guard lock(vfs_lock_);
   readonly_ = value;
@@ -16,14 +16,19 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fbl/ref_counted.h>
 #include <fbl/ref_ptr.h>
 
+#include "src/storage/lib/vfs/cpp/lookup_cache.h"
+#include "src/storage/lib/vfs/cpp/shared_mutex.h"
 #include "src/storage/lib/vfs/cpp/vfs_types.h"
 #include "src/storage/lib/vfs/cpp/vnode.h"
 
@@ -77,18 +82,40 @@ class Vfs {
   zx_status_t Readdir(Vnode* vn, VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual)
       __TA_EXCLUDES(vfs_lock_);
 
+  // Calls |Vnode::ReaddirWithAttributes| on the Vnode while holding the vfs_lock, like |Readdir|.
+  zx_status_t ReaddirWithAttributes(Vnode* vn, VdirCookie* cookie, void* dirents, size_t len,
+                                    size_t* out_actual, VnodeAttributesQuery query,
+                                    std::vector<VnodeAttributes>* attributes)
+      __TA_EXCLUDES(vfs_lock_);
+
   // Sets whether this file system is read-only.
   void SetReadonly(bool value) __TA_EXCLUDES(vfs_lock_);
 
   // Query if this file system is read-only.
   bool IsReadonly() const __TA_EXCLUDES(vfs_lock_) {
-    std::lock_guard lock(vfs_lock_);
+    SharedLock lock(vfs_lock_);
     return readonly_;
   }
 
+  // Caches the results of up to |capacity| directory lookups made while walking paths, including
+  // lookups which found nothing. The cache is disabled by default, and must be enabled before any
+  // connections are served. Filesystems which enable it must call |InvalidateLookup| whenever they
+  // add, remove or replace a directory entry other than through this class, and the cached vnodes
+  // stay referenced until their entries are invalidated or evicted.
+  void EnableLookupCache(size_t capacity);
+
+  // Drops the cached lookup of |name| in |dir|, if any.
+  void InvalidateLookup(const Vnode& dir, std::string_view name);
+
+  // Drops all of the cached lookups in |dir|.
+  void InvalidateLookups(const Vnode& dir);
+
+  // Returns the statistics of the lookup cache, or std::nullopt if it isn't enabled.
+  std::optional<LookupCache::Stats> GetLookupCacheStats() const;
+
  protected:
   // Whether this file system is read-only.
-  bool ReadonlyLocked() const __TA_REQUIRES(vfs_lock_) { return readonly_; }
+  bool ReadonlyLocked() const __TA_REQUIRES_SHARED(vfs_lock_) { return readonly_; }
 
   // Trim trailing slashes from name before sending it to internal filesystem functions. This also
   // validates whether the name has internal slashes and rejects them. Returns failure if the
@@ -98,15 +125,26 @@ class Vfs {
   // directory.
   static zx::result<bool> TrimName(std::string_view& name);
 
+  // Looks up |name| in |vndir| through the lookup cache, if enabled.
+  zx_status_t LookupLocked(const fbl::RefPtr<Vnode>& vndir, std::string_view name,
+                           fbl::RefPtr<Vnode>* out) __TA_REQUIRES_SHARED(vfs_lock_);
+
+  // Drops every cached lookup, releasing the vnodes they reference.
+  void ClearLookupCache();
+
   // Create or lookup an entry with |name| inside of |vndir|. Returns a tuple of the resulting node,
-  // and a boolean indicating if the returned vnode is open or not.
+  // and a boolean indicating if the returned vnode is open or not. Callers must hold |vfs_lock_|
+  // exclusively unless |mode| is CreationMode::kNever.
   zx::result<std::tuple<fbl::RefPtr<Vnode>, /*vnode_is_open*/ bool>> CreateOrLookup(
       fbl::RefPtr<fs::Vnode> vndir, std::string_view name, CreationMode mode,
       std::optional<CreationType> type, fuchsia_io::Rights connection_rights)
-      __TA_REQUIRES(vfs_lock_);
+      __TA_REQUIRES_SHARED(vfs_lock_);
 
-  // A lock which should be used to protect lookup and walk operations
-  mutable std::mutex vfs_lock_;
+  // A lock which should be used to protect lookup and walk operations. Operations which modify the
+  // namespace hold it exclusively. Lookups and walks which cannot create an entry only hold it
+  // shared, so that they can run concurrently when connections are served by a multi-threaded
+  // dispatcher. Vnodes must then protect their own state against concurrent lookups.
+  mutable std::shared_mutex vfs_lock_;
 
   // A separate lock to protected vnode registration. The vnodes will call into this class according
   // to their lifetimes, and many of these lifetimes are managed from within the VFS lock which can
@@ -115,7 +153,19 @@ class Vfs {
   mutable std::mutex live_nodes_lock_;
 
  private:
+  OpenResult OpenLocked(fbl::RefPtr<Vnode> vn, std::string_view path,
+                        VnodeConnectionOptions options, fuchsia_io::Rights connection_rights)
+      __TA_REQUIRES_SHARED(vfs_lock_);
+  zx::result<Open2Result> Open3Locked(fbl::RefPtr<Vnode> vndir, std::string_view path,
+                                      fuchsia_io::Flags flags,
+                                      const fuchsia_io::wire::Options* options,
+                                      fuchsia_io::Rights connection_rights)
+      __TA_REQUIRES_SHARED(vfs_lock_);
+
   bool readonly_ = false;
+
+  // Set once by |EnableLookupCache| before serving, so it isn't guarded by |vfs_lock_|.
+  std::unique_ptr<LookupCache> lookup_cache_;
 };
 
 class Vfs::OpenResult {
@@ -172,6 +172,38 @@ zx_status_t Vnode::Readdir(VdirCookie* cookie, void* dirents, size_t len, size_t
   return ZX_ERR_NOT_SUPPORTED;
 }
 
+zx_status_t Vnode::ReaddirWithAttributes(VdirCookie* cookie, void* dirents, size_t len,
+                                         size_t* out_actual, VnodeAttributesQuery query,
+                                         std::vector<VnodeAttributes>* attributes) {
+  if (zx_status_t status = Readdir(cookie, dirents, len, out_actual); status != ZX_OK) {
+    return status;
+  }
+  const char* ptr = static_cast<const char*>(dirents);
+  size_t remaining = *out_actual;
+// TODO(b/293947862): Remove use of deprecated `vdirent_t` when transitioning ReadDir to Enumerate
+// as part of io2 migration.
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+  while (remaining >= sizeof(vdirent_t)) {
+    const vdirent_t* dirent = reinterpret_cast<const vdirent_t*>(ptr);
+    const size_t entry_len = dirent->size + sizeof(vdirent_t);
+    ZX_ASSERT(entry_len <= remaining);  // Prevent underflow
+    std::string_view name(dirent->name, dirent->size);
+#pragma clang diagnostic pop
+    zx::result<VnodeAttributes> attrs = zx::ok(VnodeAttributes{});
+    fbl::RefPtr<Vnode> child;
+    if (name == ".") {
+      attrs = GetAttributes();
+    } else if (Lookup(name, &child) == ZX_OK) {
+      attrs = child->GetAttributes();
+    }
+    attributes->push_back(attrs.is_ok() ? *std::move(attrs) : VnodeAttributes{});
+    remaining -= entry_len;
+    ptr += entry_len;
+  }
+  return ZX_OK;
+}
+
 zx::result<fbl::RefPtr<Vnode>> Vnode::Create(std::string_view name, CreationType type) {
   return zx::error(ZX_ERR_NOT_SUPPORTED);
 }
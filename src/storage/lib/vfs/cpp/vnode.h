@@ -20,6 +20,7 @@
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <fbl/intrusive_double_list.h>
 #include <fbl/intrusive_single_list.h>
@@ -256,6 +257,19 @@ class Vnode : public VnodeRefCounted<Vnode>, public fbl::Recyclable<Vnode> {
   // beginning, cookie may be zero'd.
   virtual zx_status_t Readdir(VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual);
 
+  // Like |Readdir|, but also appends the attributes of every entry written to |dirents| to
+  // |attributes|, in the same order. This lets callers which need the attributes of each entry
+  // (e.g. `ls -l`) enumerate a directory without a lookup and an attribute query per entry.
+  // |query| is the set of attributes the caller needs, and implementations may report more. An
+  // entry whose attributes can't be retrieved, e.g. because it was removed concurrently, gets an
+  // empty set of attributes.
+  //
+  // The default implementation looks up every entry returned by |Readdir|. Filesystems which can
+  // reach the vnode of an entry while enumerating should override it.
+  virtual zx_status_t ReaddirWithAttributes(VdirCookie* cookie, void* dirents, size_t len,
+                                            size_t* out_actual, VnodeAttributesQuery query,
+                                            std::vector<VnodeAttributes>* attributes);
+
   // METHODS FOR OPENED OR UNOPENED NODES
   //
   // The following operations may be invoked on a Vnode, even if it has not been "Open()"-ed.
@@ -137,7 +137,19 @@ zx_status_t Dnode::ReaddirStart(fs::DirentFiller* df, void* cookie) {
   return ZX_OK;
 }
 
-void Dnode::Readdir(fs::DirentFiller* df, void* cookie) const {
+namespace {
+
+void AppendAttributes(const Vnode& vnode, std::vector<fs::VnodeAttributes>* attributes) {
+  if (attributes) {
+    zx::result attrs = vnode.GetAttributes();
+    attributes->push_back(attrs.is_ok() ? *std::move(attrs) : fs::VnodeAttributes{});
+  }
+}
+
+}  // namespace
+
+void Dnode::Readdir(fs::DirentFiller* df, void* cookie,
+                    std::vector<fs::VnodeAttributes>* attributes) const {
   dircookie_t* c = static_cast<dircookie_t*>(cookie);
   zx_status_t r = 0;
 
@@ -145,6 +157,7 @@ void Dnode::Readdir(fs::DirentFiller* df, void* cookie) const {
     if ((r = Dnode::ReaddirStart(df, cookie)) != ZX_OK) {
       return;
     }
+    AppendAttributes(*vnode_, attributes);
   }
 
   for (const auto& dn : children_) {
@@ -153,9 +166,10 @@ void Dnode::Readdir(fs::DirentFiller* df, void* cookie) const {
     }
     uint32_t vtype = dn.IsDirectory() ? V_TYPE_DIR : V_TYPE_FILE;
     if ((r = df->Next(std::string_view(dn.name_.get(), dn.NameLen()), VTYPE_TO_DTYPE(vtype),
-                      dn.AcquireVnode()->ino())) != ZX_OK) {
+                      dn.vnode_->ino())) != ZX_OK) {
       return;
     }
+    AppendAttributes(*dn.vnode_, attributes);
     c->order = dn.ordering_token_ + 1;
   }
 }
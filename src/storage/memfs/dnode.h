@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include <fbl/intrusive_double_list.h>
 #include <fbl/ref_counted.h>
@@ -87,8 +88,11 @@ class Dnode : public fbl::DoublyLinkedListable<std::unique_ptr<Dnode>> {
   // ReaddirStart reads the canned "." and ".." entries that should appear
   // at the beginning of a directory.
   // On success, return the number of bytes read.
+  //
+  // If |attributes| is provided, the attributes of each entry read are appended to it.
   static zx_status_t ReaddirStart(fs::DirentFiller* df, void* cookie);
-  void Readdir(fs::DirentFiller* df, void* cookie) const;
+  void Readdir(fs::DirentFiller* df, void* cookie,
+               std::vector<fs::VnodeAttributes>* attributes = nullptr) const;
 
   // Answers the question: "Is dn a subdirectory of this?"
   bool IsSubdirectory(const Dnode* dn) const;
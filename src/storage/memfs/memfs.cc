@@ -37,9 +37,10 @@ zx::result<fs::FilesystemInfo> Memfs::GetFilesystemInfo() {
 
   // TODO(https://fxbug.dev/42168054) Define a better value for "unknown" or "undefined" for the total_bytes
   // and used_bytes (memfs vends writable duplicates of its underlying VMOs to its clients which
-  // makes accounting difficult).
-  info.total_bytes = UINT64_MAX;
-  info.used_bytes = 0;
+  // makes accounting difficult). |used_bytes| is only as current as the last time each file was
+  // observed by memfs.
+  info.total_bytes = memory_budget_.load(std::memory_order_relaxed);
+  info.used_bytes = committed_bytes_.load(std::memory_order_relaxed);
   info.total_nodes = UINT64_MAX;
   uint64_t deleted_ino_count = Vnode::GetDeletedInoCounter();
   uint64_t ino_count = Vnode::GetInoCounter();
@@ -75,9 +76,23 @@ Memfs::Memfs(async_dispatcher_t* dispatcher) : fs::PagedVfs(dispatcher) {}
 
 Memfs::~Memfs() { TearDown(); }
 
+void Memfs::SetMemoryBudget(std::optional<uint64_t> bytes) {
+  memory_budget_.store(bytes.value_or(UINT64_MAX), std::memory_order_relaxed);
+}
+
+bool Memfs::IsOverMemoryBudget() const {
+  return committed_bytes_.load(std::memory_order_relaxed) >
+         memory_budget_.load(std::memory_order_relaxed);
+}
+
+void Memfs::AccountCommittedBytes(int64_t delta) {
+  // A negative delta wraps around when converted, so the unsigned addition subtracts it.
+  committed_bytes_.fetch_add(static_cast<uint64_t>(delta), std::memory_order_relaxed);
+}
+
 zx_status_t Memfs::CreateFromVmo(VnodeDir* parent, std::string_view name, zx_handle_t vmo,
                                  zx_off_t off, zx_off_t len) {
-  std::lock_guard<std::mutex> lock(vfs_lock_);
+  std::lock_guard lock(vfs_lock_);
   return parent->CreateFromVmo(name, vmo, off, len);
 }
 
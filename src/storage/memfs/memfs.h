@@ -10,7 +10,9 @@
 #include <lib/zx/result.h>
 #include <zircon/types.h>
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include <fbl/ref_ptr.h>
@@ -49,6 +51,19 @@ class Memfs : public fs::PagedVfs {
     return PagedVfs::pager_for_next_vdso_syscalls();
   }
 
+  // Limits the memory committed to file contents to |bytes|, or removes the limit if std::nullopt.
+  // Once the limit is exceeded, creating files and growing them with |Truncate| fail with
+  // ZX_ERR_NO_SPACE until memory is released. Writes through a file's stream commit pages in the
+  // kernel without going through memfs, so they are only accounted for, and can overshoot the
+  // budget, until memfs next observes the file (e.g. when it's closed or its attributes queried).
+  void SetMemoryBudget(std::optional<uint64_t> bytes);
+
+  // Whether the memory committed to file contents exceeds the budget, if any.
+  bool IsOverMemoryBudget() const;
+
+  // Adjusts the memory accounted as committed to file contents.
+  void AccountCommittedBytes(int64_t delta);
+
  private:
   explicit Memfs(async_dispatcher_t* dispatcher);
 
@@ -57,6 +72,11 @@ class Memfs : public fs::PagedVfs {
 
   // Since no directory contains the root, it is owned by the VFS object.
   std::unique_ptr<Dnode> root_;
+
+  // Memory accounted as committed to the contents of all files.
+  std::atomic<uint64_t> committed_bytes_ = 0;
+  // Limit on |committed_bytes_|. UINT64_MAX if unlimited.
+  std::atomic<uint64_t> memory_budget_ = UINT64_MAX;
 };
 
 }  // namespace memfs
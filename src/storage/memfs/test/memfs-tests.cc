@@ -17,6 +17,7 @@
 
 #include <future>
 #include <limits>
+#include <vector>
 
 #include <fbl/unique_fd.h>
 #include <gmock/gmock.h>
@@ -501,5 +502,87 @@ TEST(MemfsTest, TruncateToMaxFileSize) {
   ASSERT_STATUS(file->Truncate(kMaxFileSize + 1), ZX_ERR_OUT_OF_RANGE);
 }
 
+TEST(MemfsTest, MemoryBudget) {
+  async::Loop loop(&kAsyncLoopConfigAttachToCurrentThread);
+
+  zx::result result = memfs::Memfs::Create(loop.dispatcher(), "<tmp>");
+  ASSERT_TRUE(result.is_ok()) << result.status_string();
+  auto& [vfs, root] = result.value();
+
+  zx::result file = root->Create("file", fs::CreationType::kFile);
+  ASSERT_OK(file.status_value());
+  zx::result<zx::stream> stream = file->CreateStream(ZX_STREAM_MODE_READ | ZX_STREAM_MODE_WRITE);
+  ASSERT_OK(stream.status_value());
+
+  std::vector<char> data(4 * GetPageSize(), 'a');
+  zx_iovec_t iov = {
+      .buffer = data.data(),
+      .capacity = data.size(),
+  };
+  size_t actual = 0;
+  ASSERT_OK(stream->writev_at(0, 0, &iov, 1, &actual));
+  ASSERT_EQ(actual, data.size());
+  ASSERT_OK(file->GetAttributes().status_value());
+
+  zx::result info = vfs->GetFilesystemInfo();
+  ASSERT_OK(info.status_value());
+  EXPECT_EQ(info->used_bytes, data.size());
+
+  // Once the written pages exceed the budget, files can neither be created nor grown.
+  vfs->SetMemoryBudget(GetPageSize());
+  EXPECT_TRUE(vfs->IsOverMemoryBudget());
+  EXPECT_STATUS(root->Create("other", fs::CreationType::kFile).status_value(), ZX_ERR_NO_SPACE);
+  EXPECT_STATUS(file->Truncate(data.size() + 1), ZX_ERR_NO_SPACE);
+
+  // Truncating the file releases its pages and brings it back under budget.
+  ASSERT_OK(file->Truncate(0));
+  EXPECT_FALSE(vfs->IsOverMemoryBudget());
+  EXPECT_OK(root->Create("other", fs::CreationType::kFile).status_value());
+  EXPECT_OK(file->Truncate(data.size()));
+
+  vfs->SetMemoryBudget(std::nullopt);
+  zx::result other = root->Create("another", fs::CreationType::kFile);
+  EXPECT_OK(other.status_value());
+}
+
+TEST(MemfsTest, ReaddirWithAttributes) {
+  async::Loop loop(&kAsyncLoopConfigAttachToCurrentThread);
+
+  zx::result result = memfs::Memfs::Create(loop.dispatcher(), "<tmp>");
+  ASSERT_TRUE(result.is_ok()) << result.status_string();
+  auto& [vfs, root] = result.value();
+
+  zx::result file = root->Create("file", fs::CreationType::kFile);
+  ASSERT_OK(file.status_value());
+  ASSERT_OK(file->Truncate(10));
+  zx::result subdirectory = root->Create("subdirectory", fs::CreationType::kDirectory);
+  ASSERT_OK(subdirectory.status_value());
+
+  auto directory = static_cast<fbl::RefPtr<fs::Vnode>>(root);
+  fs::VdirCookie cookie;
+  uint8_t buffer[4096];
+  size_t actual;
+  std::vector<fs::VnodeAttributes> attributes;
+  ASSERT_OK(directory->ReaddirWithAttributes(&cookie, buffer, sizeof(buffer), &actual,
+                                             fs::VnodeAttributesQuery::kContentSize, &attributes));
+
+  // One set of attributes is reported per entry: ".", "file" and "subdirectory".
+  ASSERT_EQ(attributes.size(), 3u);
+  zx::result directory_attr = directory->GetAttributes();
+  ASSERT_TRUE(directory_attr.is_ok()) << directory_attr.status_string();
+  EXPECT_EQ(attributes[0], *directory_attr);
+  EXPECT_EQ(attributes[1].content_size, 10u);
+  zx::result subdirectory_attr = subdirectory->GetAttributes();
+  ASSERT_TRUE(subdirectory_attr.is_ok()) << subdirectory_attr.status_string();
+  EXPECT_EQ(attributes[2], *subdirectory_attr);
+
+  // The cookie is advanced just like for Readdir.
+  attributes.clear();
+  ASSERT_OK(directory->ReaddirWithAttributes(&cookie, buffer, sizeof(buffer), &actual,
+                                             fs::VnodeAttributesQuery::kContentSize, &attributes));
+  EXPECT_EQ(actual, 0u);
+  EXPECT_TRUE(attributes.empty());
+}
+
 }  // namespace
 }  // namespace memfs
@@ -83,6 +83,21 @@ zx_status_t VnodeDir::Readdir(fs::VdirCookie* cookie, void* data, size_t len, si
   return ZX_OK;
 }
 
+zx_status_t VnodeDir::ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                            size_t* out_actual, fs::VnodeAttributesQuery query,
+                                            std::vector<fs::VnodeAttributes>* attributes) {
+  fs::DirentFiller df(dirents, len);
+  if (!IsDirectory()) {
+    // This WAS a directory, but it has been deleted.
+    *out_actual = 0;
+    return ZX_OK;
+  }
+  // Every entry already references its vnode, so the attributes are read while enumerating.
+  dnode_->Readdir(&df, cookie, attributes);
+  *out_actual = df.BytesFilled();
+  return ZX_OK;
+}
+
 zx::result<fbl::RefPtr<fs::Vnode>> VnodeDir::Create(std::string_view name, fs::CreationType type) {
   if (zx_status_t status = CanCreate(name); status != ZX_OK) {
     return zx::error(status);
@@ -98,6 +113,9 @@ zx::result<fbl::RefPtr<fs::Vnode>> VnodeDir::Create(std::string_view name, fs::C
       break;
     }
     case fs::CreationType::kFile: {
+      if (memfs_.IsOverMemoryBudget()) {
+        return zx::error(ZX_ERR_NO_SPACE);
+      }
       vn = fbl::AdoptRef(new (&ac) memfs::VnodeFile(memfs_));
       break;
     }
@@ -33,6 +33,9 @@ class VnodeDir final : public Vnode {
 
  private:
   zx_status_t Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual) final;
+  zx_status_t ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                    size_t* out_actual, fs::VnodeAttributesQuery query,
+                                    std::vector<fs::VnodeAttributes>* attributes) final;
 
   // Resolves the question, "Can this directory create a child node with the name?"
   // Returns "ZX_OK" on success; otherwise explains failure with error message.
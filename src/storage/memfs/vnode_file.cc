@@ -12,10 +12,19 @@
 #include "src/storage/memfs/memfs.h"
 
 namespace memfs {
+namespace {
+
+// File VMOs are created this large, so that neither writes nor truncates below this size ever resize
+// them and the size of a file is just the content size of its VMO. Pages are only committed as they
+// are written to. Larger files still grow the VMO on demand.
+constexpr uint64_t kPreallocatedVmoSize = 1ull << 36;
+
+}  // namespace
 
 VnodeFile::VnodeFile(Memfs& memfs) : Vnode(memfs), memfs_(memfs) {}
 
 VnodeFile::~VnodeFile() {
+  memfs_.AccountCommittedBytes(-static_cast<int64_t>(accounted_bytes_.load()));
   fbl::RefPtr<fs::Vnode> file = FreePagedVmo();
   // FreePagedVmo is being called from the destructor so PagedVnode shouldn't have been holding onto
   // reference at this point.
@@ -79,6 +88,7 @@ zx::result<fs::VnodeAttributes> VnodeFile::GetAttributes() const {
     if (paged_vmo().is_valid()) {
       content_size = GetContentSize();
       UpdateModifiedIfVmoChanged();
+      UpdateCommittedBytes();
     }
   }
 
@@ -118,17 +128,75 @@ zx_status_t VnodeFile::Truncate(size_t length) {
   if (zx_status_t status = CreateBackingStoreIfNeeded(); status != ZX_OK) {
     return status;
   }
-  if (zx_status_t status = paged_vmo().set_size(length); status != ZX_OK) {
+  UpdateCommittedBytes();
+  const uint64_t content_size = GetContentSize();
+  if (length > content_size && memfs_.IsOverMemoryBudget()) {
+    return ZX_ERR_NO_SPACE;
+  }
+
+  uint64_t vmo_size;
+  if (zx_status_t status = paged_vmo().get_size(&vmo_size); status != ZX_OK) {
     return status;
   }
+  if (length > vmo_size) {
+    // Growing the VMO also sets its content size. The range being added is already zero.
+    if (zx_status_t status = paged_vmo().set_size(length); status != ZX_OK) {
+      return status;
+    }
+  } else {
+    // Release the truncated range, so that it reads as zeroes if the file grows again.
+    if (length < content_size) {
+      if (zx_status_t status = ReleaseRange(length, content_size); status != ZX_OK) {
+        return status;
+      }
+    }
+    if (zx_status_t status = paged_vmo().set_prop_content_size(length); status != ZX_OK) {
+      return status;
+    }
+  }
 
+  UpdateCommittedBytes();
   UpdateModified();
   return ZX_OK;
 }
 
 zx_status_t VnodeFile::CreateBackingStoreIfNeeded() {
-  // TODO(https://fxbug.dev/42067655): Use a fixed sized VMO.
-  return EnsureCreatePagedVmo(0, ZX_VMO_RESIZABLE).status_value();
+  if (paged_vmo().is_valid()) {
+    return ZX_OK;
+  }
+  if (zx::result result = EnsureCreatePagedVmo(0, ZX_VMO_RESIZABLE); result.is_error()) {
+    return result.status_value();
+  }
+  // The VMO is grown after creation, rather than created at its full size, so that the kernel
+  // provides zero pages for the range instead of requesting them from the pager.
+  if (zx_status_t status = paged_vmo().set_size(kPreallocatedVmoSize); status != ZX_OK) {
+    return status;
+  }
+  return paged_vmo().set_prop_content_size(0);
+}
+
+zx_status_t VnodeFile::ReleaseRange(uint64_t offset, uint64_t end) {
+  const uint64_t first_page = fbl::round_up(offset, GetPageSize());
+  const uint64_t last_page = fbl::round_down(end, GetPageSize());
+  if (first_page >= last_page) {
+    return paged_vmo().op_range(ZX_VMO_OP_ZERO, offset, end - offset, nullptr, 0);
+  }
+  if (zx_status_t status =
+          paged_vmo().op_range(ZX_VMO_OP_ZERO, offset, first_page - offset, nullptr, 0);
+      status != ZX_OK) {
+    return status;
+  }
+  zx_status_t status =
+      paged_vmo().op_range(ZX_VMO_OP_DECOMMIT, first_page, last_page - first_page, nullptr, 0);
+  if (status == ZX_ERR_NOT_SUPPORTED) {
+    // The kernel doesn't decommit pages of pager-backed VMOs. Zeroing the pages lets it free them
+    // instead.
+    status = paged_vmo().op_range(ZX_VMO_OP_ZERO, first_page, last_page - first_page, nullptr, 0);
+  }
+  if (status != ZX_OK) {
+    return status;
+  }
+  return paged_vmo().op_range(ZX_VMO_OP_ZERO, last_page, end - last_page, nullptr, 0);
 }
 
 uint64_t VnodeFile::GetContentSize() const {
@@ -142,6 +210,7 @@ uint64_t VnodeFile::GetContentSize() const {
 zx_status_t VnodeFile::CloseNode() {
   fs::SharedLock lock(mutex_);
   UpdateModifiedIfVmoChanged();
+  UpdateCommittedBytes();
   return ZX_OK;
 }
 
@@ -149,6 +218,7 @@ void VnodeFile::Sync(SyncCallback closure) {
   closure(ZX_OK);
   fs::SharedLock lock(mutex_);
   UpdateModifiedIfVmoChanged();
+  UpdateCommittedBytes();
 }
 
 void VnodeFile::UpdateModifiedIfVmoChanged() const {
@@ -166,4 +236,16 @@ void VnodeFile::UpdateModifiedIfVmoChanged() const {
   }
 }
 
+void VnodeFile::UpdateCommittedBytes() const {
+  if (!paged_vmo().is_valid()) {
+    return;
+  }
+  zx_info_vmo_t info;
+  if (paged_vmo().get_info(ZX_INFO_VMO, &info, sizeof(info), nullptr, nullptr) != ZX_OK) {
+    return;
+  }
+  const uint64_t previous = accounted_bytes_.exchange(info.committed_bytes);
+  memfs_.AccountCommittedBytes(static_cast<int64_t>(info.committed_bytes - previous));
+}
+
 }  // namespace memfs
@@ -7,6 +7,8 @@
 
 #include <lib/zx/vmo.h>
 
+#include <atomic>
+
 #include "src/storage/lib/vfs/cpp/vfs_types.h"
 #include "src/storage/memfs/memfs.h"
 #include "src/storage/memfs/vnode.h"
@@ -39,7 +41,18 @@ class VnodeFile final : public Vnode {
   // called. If the file was modified then the mtime is updated.
   void UpdateModifiedIfVmoChanged() const __TA_REQUIRES_SHARED(mutex_);
 
-  [[maybe_unused]] Memfs& memfs_;
+  // Brings the memory accounted to |memfs_| for this file up to date with the pages committed to
+  // |paged_vmo()|, which writes through streams and mappings change without going through memfs.
+  void UpdateCommittedBytes() const __TA_REQUIRES_SHARED(mutex_);
+
+  // Releases the memory backing [|offset|, |end|) of |paged_vmo()|, so that the range reads as
+  // zeroes. Whole pages are decommitted, and the partial pages at either end are zeroed.
+  zx_status_t ReleaseRange(uint64_t offset, uint64_t end) __TA_REQUIRES(mutex_);
+
+  Memfs& memfs_;
+
+  // The committed bytes of |paged_vmo()| last accounted to |memfs_|.
+  mutable std::atomic<uint64_t> accounted_bytes_ = 0;
 };
 
 }  // namespace memfs
@@ -558,6 +558,18 @@ static_assert(sizeof(DirCookie) <= sizeof(fs::VdirCookie),
 
 zx_status_t Directory::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len,
                                size_t* out_actual) {
+  return ReaddirInternal(cookie, dirents, len, out_actual, nullptr);
+}
+
+zx_status_t Directory::ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                             size_t* out_actual, fs::VnodeAttributesQuery query,
+                                             std::vector<fs::VnodeAttributes>* attributes) {
+  return ReaddirInternal(cookie, dirents, len, out_actual, attributes);
+}
+
+zx_status_t Directory::ReaddirInternal(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                       size_t* out_actual,
+                                       std::vector<fs::VnodeAttributes>* attributes) {
   TRACE_DURATION("minfs", "Directory::Readdir");
   FX_LOGS(DEBUG) << "minfs_readdir() vn=" << this << "(#" << GetIno() << ") cookie=" << cookie
                  << " len=" << len;
@@ -617,6 +629,14 @@ zx_status_t Directory::Readdir(fs::VdirCookie* cookie, void* dirents, size_t len
           // no more space
           goto done;
         }
+        if (attributes) {
+          // Fetching the vnode by inode number skips the name search a lookup would do.
+          zx::result<fs::VnodeAttributes> attrs = zx::ok(fs::VnodeAttributes{});
+          if (zx::result vn = Vfs()->VnodeGet(de->ino); vn.is_ok()) {
+            attrs = (*vn)->GetAttributes();
+          }
+          attributes->push_back(attrs.is_ok() ? *std::move(attrs) : fs::VnodeAttributes{});
+        }
       }
 
       off += DirentReservedSize(de, off);
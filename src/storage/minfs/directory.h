@@ -8,6 +8,7 @@
 #include <lib/zx/result.h>
 
 #include <string_view>
+#include <vector>
 
 #include <fbl/algorithm.h>
 #include <fbl/ref_ptr.h>
@@ -52,6 +53,9 @@ class Directory final : public VnodeMinfs, public fbl::Recyclable<Directory> {
   zx_status_t Write(const void* data, size_t len, size_t offset, size_t* out_actual) final;
   zx_status_t Append(const void* data, size_t len, size_t* out_end, size_t* out_actual) final;
   zx_status_t Readdir(fs::VdirCookie* cookie, void* dirents, size_t len, size_t* out_actual) final;
+  zx_status_t ReaddirWithAttributes(fs::VdirCookie* cookie, void* dirents, size_t len,
+                                    size_t* out_actual, fs::VnodeAttributesQuery query,
+                                    std::vector<fs::VnodeAttributes>* attributes) final;
   zx::result<fbl::RefPtr<Vnode>> Create(std::string_view name, fs::CreationType type) final;
   zx_status_t Unlink(std::string_view name, bool must_be_dir) final;
   zx_status_t Rename(fbl::RefPtr<fs::Vnode> newdir, std::string_view oldname,
@@ -70,6 +74,11 @@ class Directory final : public VnodeMinfs, public fbl::Recyclable<Directory> {
     kIteratorSaveSync,
   };
 
+  // Implements |Readdir|. If |attributes| is provided, the attributes of each entry read are
+  // appended to it, fetching the vnodes by the inode numbers found in the dirents.
+  zx_status_t ReaddirInternal(fs::VdirCookie* cookie, void* dirents, size_t len,
+                              size_t* out_actual, std::vector<fs::VnodeAttributes>* attributes);
+
   // minfs::Vnode interface.
   zx::result<> CanUnlink() const final;
   blk_t GetBlockCount() const final;
@@ -99,16 +99,22 @@ void File::AllocateAndCommitData(std::unique_ptr<Transaction> transaction) {
         BlocksSwap(transaction.get(), bno_start, bno_count, allocated_blocks.data()).is_ok(),
         "Failed to reserve blocks.");
 
-    // Enqueue each data block one at a time, as they may not be contiguous on disk.
+    // Enqueue the data one run of device-contiguous blocks at a time. The blocks of a range are
+    // usually allocated contiguously, so this is normally a single operation for the whole range.
     UnownedVmoBuffer buffer(vmo());
-    for (blk_t i = 0; i < bno_count; i++) {
+    for (blk_t i = 0; i < bno_count;) {
+      blk_t run = 1;
+      while (i + run < bno_count && allocated_blocks[i + run] == allocated_blocks[i] + run) {
+        ++run;
+      }
       storage::Operation operation = {
           .type = storage::OperationType::kWrite,
           .vmo_offset = bno_start + i,
           .dev_offset = allocated_blocks[i] + Vfs()->Info().dat_block,
-          .length = 1,
+          .length = run,
       };
       transaction->EnqueueData(operation, &buffer);
+      i += run;
     }
 
     // Since we are updating the file in "chunks", only update the on-disk inode size
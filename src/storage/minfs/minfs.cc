@@ -533,6 +533,10 @@ std::unique_ptr<Bcache> Minfs::Destroy(std::unique_ptr<Minfs> minfs) {
 
 void Minfs::Terminate() {
 #ifdef __Fuchsia__
+  // Don't drop syncs that are still waiting for the coalescing window to close.
+  if (dispatcher_ && coalesced_sync_task_.Cancel() == ZX_OK) {
+    SyncCoalesced();
+  }
   // Try to cancel any scheduled syncs, if it can't then if the dispatcher is running on another
   // thread, ensure that there isn't a sync running by pushing another task into it.
   if (dispatcher_ && journal_sync_task_.Cancel() != ZX_OK &&
@@ -718,6 +722,38 @@ void Minfs::Sync(SyncCallback closure) {
       closure(ZX_OK);
     return;
   }
+  if (closure && dispatcher_ && mount_options_.sync_coalescing_window > zx::duration(0)) {
+    std::lock_guard lock(coalesced_sync_lock_);
+    coalesced_sync_callbacks_.push_back(std::move(closure));
+    if (!coalesced_sync_task_.is_pending()) {
+      coalesced_sync_task_.PostDelayed(dispatcher_, mount_options_.sync_coalescing_window);
+    }
+    return;
+  }
+  if (closure) {
+    inspect_tree_.OnSyncBatch(1);
+  }
+  FlushAndEnqueueSync(std::move(closure));
+}
+
+void Minfs::SyncCoalesced() {
+  std::vector<SyncCallback> callbacks;
+  {
+    std::lock_guard lock(coalesced_sync_lock_);
+    callbacks.swap(coalesced_sync_callbacks_);
+  }
+  if (callbacks.empty()) {
+    return;
+  }
+  inspect_tree_.OnSyncBatch(callbacks.size());
+  FlushAndEnqueueSync([callbacks = std::move(callbacks)](zx_status_t status) mutable {
+    for (SyncCallback& callback : callbacks) {
+      callback(status);
+    }
+  });
+}
+
+void Minfs::FlushAndEnqueueSync(SyncCallback closure) {
   auto dirty_vnodes = GetDirtyVnodes();
   for (const fbl::RefPtr<VnodeMinfs>& vnode : dirty_vnodes) {
     auto status = vnode->FlushCachedWrites();
@@ -737,6 +773,7 @@ Minfs::Minfs(async_dispatcher_t* dispatcher, std::unique_ptr<Bcache> bc,
       block_allocator_(std::move(block_allocator)),
       inodes_(std::move(inodes)),
       journal_sync_task_([this]() { Sync(); }),
+      coalesced_sync_task_([this]() { SyncCoalesced(); }),
       inspect_tree_(dispatcher, bc_->device()),
       limits_(sb_->Info()),
       mount_options_(mount_options),
@@ -7,6 +7,8 @@
 #include <lib/syslog/cpp/macros.h>
 #include <lib/zx/clock.h>
 
+#include <algorithm>
+
 #include <safemath/checked_math.h>
 
 namespace minfs {
@@ -97,6 +99,13 @@ void MinfsInspectTree::SubtractDirtyBytes(uint64_t bytes) {
   dirty_bytes_ = safemath::CheckSub(dirty_bytes_, bytes).ValueOrDie();
 }
 
+void MinfsInspectTree::OnSyncBatch(uint64_t requests) {
+  std::lock_guard guard(sync_mutex_);
+  ++sync_batches_;
+  synced_requests_ += requests;
+  max_sync_batch_size_ = std::max(max_sync_batch_size_, requests);
+}
+
 fs_inspect::FvmData MinfsInspectTree::GetFvmData() {
   zx::result<fs_inspect::FvmData::SizeInfo> size_info = zx::error(ZX_ERR_BAD_HANDLE);
   {
@@ -126,6 +135,12 @@ inspect::LazyNodeCallbackFn MinfsInspectTree::CreateDetailNode() const {
     }
     insp.GetRoot().CreateUint("recovered_space_events", recovered_space_events, &insp);
     insp.GetRoot().CreateUint("dirty_bytes", dirty_bytes, &insp);
+    {
+      std::lock_guard guard(sync_mutex_);
+      insp.GetRoot().CreateUint("sync_batches", sync_batches_, &insp);
+      insp.GetRoot().CreateUint("synced_requests", synced_requests_, &insp);
+      insp.GetRoot().CreateUint("max_sync_batch_size", max_sync_batch_size_, &insp);
+    }
     return fpromise::make_ok_promise(insp);
   };
 }
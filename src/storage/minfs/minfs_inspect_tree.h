@@ -48,6 +48,9 @@ class MinfsInspectTree final {
   // Subtract |bytes| from the dirty bytes counter.
   void SubtractDirtyBytes(uint64_t bytes) __TA_EXCLUDES(fvm_mutex_);
 
+  // Record that |requests| syncs were issued to the journal as a single sync.
+  void OnSyncBatch(uint64_t requests) __TA_EXCLUDES(sync_mutex_);
+
   // Reference to the Inspector this object owns.
   const inspect::Inspector& Inspector() { return component_inspector_.inspector(); }
 
@@ -105,6 +108,13 @@ class MinfsInspectTree final {
   // Number of bytes currently in the dirty cache.
   uint64_t dirty_bytes_ __TA_GUARDED(fvm_mutex_){};
 
+  // Number of journal syncs issued on behalf of callers, the number of callers they covered, and
+  // the largest number of callers covered by a single journal sync.
+  mutable std::mutex sync_mutex_{};
+  uint64_t sync_batches_ __TA_GUARDED(sync_mutex_){};
+  uint64_t synced_requests_ __TA_GUARDED(sync_mutex_){};
+  uint64_t max_sync_batch_size_ __TA_GUARDED(sync_mutex_){};
+
   inspect::LazyNodeCallbackFn CreateDetailNode() const;
 
   // The Inspector to which the tree is attached.
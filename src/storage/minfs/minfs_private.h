@@ -11,7 +11,9 @@
 #include <inttypes.h>
 
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #ifdef __Fuchsia__
 #include <fidl/fuchsia.io/cpp/wire.h>
@@ -287,6 +289,9 @@ class Minfs final : public TransactionalFs {
   zx::result<fs::FilesystemInfo> GetFilesystemInfo();
 
   // Signals the completion object as soon as the journal has finished synchronizing.
+  //
+  // If |MountOptions::sync_coalescing_window| is set, a sync with a |closure| is delayed by up to
+  // that long and issued together with any other syncs requested in the meantime.
   void Sync(SyncCallback closure = {});
 #endif
 
@@ -364,6 +369,13 @@ class Minfs final : public TransactionalFs {
 
   // Issues a sync to the journal's background thread and waits for it to complete.
   zx::result<> BlockingJournalSync();
+
+  // Issues a single sync on behalf of all the syncs held in |coalesced_sync_callbacks_|.
+  void SyncCoalesced() __TA_EXCLUDES(coalesced_sync_lock_);
+
+  // Flushes cached writes for all dirty vnodes and enqueues a journal sync, invoking |closure| once
+  // it completes.
+  void FlushAndEnqueueSync(SyncCallback closure);
 #endif
 
   Bcache* GetMutableBcache() final { return bc_.get(); }
@@ -444,6 +456,11 @@ class Minfs final : public TransactionalFs {
   // TODO(https://fxbug.dev/42059522): Stop accessing outside `dispatcher_` thread.
   async::TaskClosure journal_sync_task_;
 
+  // Syncs waiting for |sync_coalescing_window| to close, and the task that issues them.
+  std::mutex coalesced_sync_lock_;
+  std::vector<SyncCallback> coalesced_sync_callbacks_ __TA_GUARDED(coalesced_sync_lock_);
+  async::TaskClosure coalesced_sync_task_;
+
   MinfsInspectTree inspect_tree_;
   void InitializeInspectTree();
 #else
@@ -9,6 +9,7 @@
 
 #ifdef __Fuchsia__
 #include <fidl/fuchsia.process.lifecycle/cpp/wire.h>
+#include <lib/zx/time.h>
 
 #include "src/storage/lib/vfs/cpp/managed_vfs.h"
 #include "src/storage/minfs/bcache.h"
@@ -44,6 +45,12 @@ struct MountOptions {
   // Should only use for testing to adjust inode counts if we run out of inodes.
   // TODO(https://fxbug.dev/375550868): should not be overriding inode count.
   uint32_t inode_count = 0;
+
+#ifdef __Fuchsia__
+  // If non-zero, syncs are held for up to this long so that concurrent syncs can share a single
+  // journal flush instead of each paying for their own.
+  zx::duration sync_coalescing_window;
+#endif
 };
 
 #ifdef __Fuchsia__
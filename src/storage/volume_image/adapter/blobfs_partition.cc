@@ -63,6 +63,14 @@ class BackupSuperblockReader final : public Reader {
     return reader_->Read(offset, buffer);
   }
 
+  // Neither superblock is ever a hole.
+  bool IsHole(uint64_t offset, uint64_t length) const final {
+    if (offset < 2 * blobfs::kBlobfsBlockSize) {
+      return false;
+    }
+    return reader_->IsHole(offset - blobfs::kBlobfsBlockSize, length);
+  }
+
  private:
   std::unique_ptr<Reader> reader_;
 };
@@ -94,6 +102,11 @@ class PatchedSuperblockReader final : public Reader {
     return fpromise::ok();
   }
 
+  // The patched superblock is never a hole.
+  bool IsHole(uint64_t offset, uint64_t length) const final {
+    return offset >= blobfs::kBlobfsBlockSize && reader_->IsHole(offset, length);
+  }
+
   blobfs::Superblock& superblock() { return superblock_; }
 
  private:
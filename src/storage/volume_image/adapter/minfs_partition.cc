@@ -72,6 +72,15 @@ class PatchedSuperblockReader final : public Reader {
     return fpromise::ok();
   }
 
+  // The patched superblock is never a hole.
+  bool IsHole(uint64_t offset, uint64_t length) const final {
+    if (offset < superblock_offset_ + minfs::kMinfsBlockSize &&
+        offset + length > superblock_offset_) {
+      return false;
+    }
+    return reader_->IsHole(offset, length);
+  }
+
   minfs::Superblock& superblock() { return superblock_; }
 
  private:
@@ -251,6 +251,10 @@ fpromise::result<void, std::string> FvmDescriptor::WriteBlockImage(Writer& write
       }
       for (uint64_t slice = 0; slice < slice_count; ++slice) {
         auto slice_data_view = std::span<uint8_t>(slice_buffer);
+        // Slices which would only contain zeroes are neither read nor copied through
+        // |slice_buffer|, so that the cost of writing the image depends on the amount of data
+        // rather than on the size of the partitions.
+        bool zero_slice = fill_value.value_or(0) == 0;
         if (slice < data_slice_count) {
           // Byte offset of current slice.
           const uint64_t slice_offset = slice * options_.slice_size;
@@ -271,10 +275,13 @@ fpromise::result<void, std::string> FvmDescriptor::WriteBlockImage(Writer& write
           uint64_t data_length = data_vslice_end < vslice_end ? data_vslice_end - data_vslice_start
                                                               : vslice_end - data_vslice_start;
           slice_data_view = slice_data_view.subspan(data_vslice_start, data_length);
-          auto read_result = partition.reader()->Read(
-              mapping.source + slice_offset + data_vslice_start, slice_data_view);
-          if (read_result.is_error()) {
-            return read_result.take_error_result();
+          const uint64_t source_offset = mapping.source + slice_offset + data_vslice_start;
+          if (!zero_slice || !partition.reader()->IsHole(source_offset, slice_data_view.size())) {
+            zero_slice = false;
+            auto read_result = partition.reader()->Read(source_offset, slice_data_view);
+            if (read_result.is_error()) {
+              return read_result.take_error_result();
+            }
           }
         }
 
@@ -286,6 +293,15 @@ fpromise::result<void, std::string> FvmDescriptor::WriteBlockImage(Writer& write
 
         // Finally write current slice.
         const uint64_t physical_slice_offset = header.GetSliceDataOffset(current_physical_slice);
+        if (zero_slice) {
+          // |slice_buffer| is still all zeroes, so there's nothing to clean up.
+          auto write_result = writer.WriteZeroes(physical_slice_offset, slice_buffer.size());
+          if (write_result.is_error()) {
+            return write_result.take_error_result();
+          }
+          current_physical_slice++;
+          continue;
+        }
         auto write_result = writer.Write(physical_slice_offset, slice_buffer);
         if (write_result.is_error()) {
           return write_result.take_error_result();
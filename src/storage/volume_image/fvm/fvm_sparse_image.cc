@@ -143,8 +143,10 @@ fpromise::result<uint64_t, std::string> FvmSparseWriteImageInternal(const FvmDes
         remaining_bytes -= bytes_to_read;
         auto buffer_view = std::span(data.data(), bytes_to_read);
 
-        auto extent_data_read_result = reader->Read(read_offset, buffer_view);
-        if (extent_data_read_result.is_error()) {
+        if (reader->IsHole(read_offset, bytes_to_read)) {
+          memset(buffer_view.data(), 0, buffer_view.size());
+        } else if (auto extent_data_read_result = reader->Read(read_offset, buffer_view);
+                   extent_data_read_result.is_error()) {
           return extent_data_read_result.take_error_result();
         }
         read_offset += bytes_to_read;
@@ -206,6 +208,10 @@ class SharedReader final : public Reader {
     return image_reader_->Read(offset_ + offset, buffer);
   }
 
+  bool IsHole(uint64_t offset, uint64_t length) const final {
+    return offset + length <= length_ && image_reader_->IsHole(offset_ + offset, length);
+  }
+
  private:
   uint64_t offset_ = 0;
   uint64_t length_ = 0;
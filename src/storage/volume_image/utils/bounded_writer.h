@@ -33,6 +33,16 @@ class BoundedWriter final : public Writer {
     return writer_->Write(offset_ + offset, buffer);
   }
 
+  fpromise::result<void, std::string> WriteZeroes(uint64_t offset, uint64_t length) final {
+    if (offset + length > length_) {
+      return fpromise::error(
+          "BoundedWriter::WriteZeroes out of bounds. offset: " + std::to_string(offset) +
+          " byte_cout: " + std::to_string(length) + " min_offset: " + std::to_string(offset_) +
+          " max_offset: " + std::to_string(offset_ + length_ - 1) + ".");
+    }
+    return writer_->WriteZeroes(offset_ + offset, length);
+  }
+
  private:
   uint64_t offset_ = 0;
   uint64_t length_ = 0;
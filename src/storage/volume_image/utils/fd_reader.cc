@@ -7,7 +7,9 @@
 #include <fcntl.h>
 #include <lib/fpromise/result.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
@@ -65,4 +67,22 @@ fpromise::result<void, std::string> FdReader::Read(uint64_t offset,
   return fpromise::ok();
 }
 
+bool FdReader::IsHole(uint64_t offset, uint64_t length) const {
+#if defined(SEEK_DATA)
+  struct stat file_stats = {};
+  if (fstat(fd_.get(), &file_stats) != 0 || !S_ISREG(file_stats.st_mode) ||
+      offset + length > static_cast<uint64_t>(file_stats.st_size)) {
+    return false;
+  }
+  off_t data_offset = lseek(fd_.get(), safemath::checked_cast<off_t>(offset), SEEK_DATA);
+  if (data_offset < 0) {
+    // ENXIO means there is no data at or after |offset|.
+    return errno == ENXIO;
+  }
+  return static_cast<uint64_t>(data_offset) >= offset + length;
+#else
+  return false;
+#endif
+}
+
 }  // namespace storage::volume_image
@@ -42,6 +42,10 @@ class FdReader final : public Reader {
   // On error the returned result to contains a string describing the error.
   fpromise::result<void, std::string> Read(uint64_t offset, std::span<uint8_t> buffer) const final;
 
+  // Returns true if [|offset|, |offset| + |length|) lies within a hole of the underlying file, on
+  // hosts which support SEEK_DATA.
+  bool IsHole(uint64_t offset, uint64_t length) const final;
+
   // Returns a unique identifier for this |FdReader|.
   std::string_view name() const { return name_; }
 
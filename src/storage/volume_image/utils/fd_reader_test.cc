@@ -156,5 +156,27 @@ TEST(FdReaderTest, ReadOutOfBoundsIsError) {
   EXPECT_TRUE(reader.Read(1, std::span(buffer.data(), buffer.size())).is_error());
 }
 
+TEST(FdReaderTest, DataAndOutOfBoundsRangesAreNotHoles) {
+  constexpr std::string_view kFileContents = "12345678901234567890abcedf12345";
+
+  auto temp_file_result = TempFile::Create();
+  ASSERT_TRUE(temp_file_result.is_ok()) << temp_file_result.error();
+  TempFile file = temp_file_result.take_value();
+
+  fbl::unique_fd target_fd(open(file.path().data(), O_RDWR | O_APPEND));
+  ASSERT_TRUE(target_fd.is_valid());
+  ASSERT_NO_FATAL_FAILURE(
+      Write(target_fd.get(), std::span(kFileContents.data(), kFileContents.size())));
+
+  auto fd_reader_or_error = FdReader::Create(file.path());
+  ASSERT_TRUE(fd_reader_or_error.is_ok()) << fd_reader_or_error.error();
+  auto reader = fd_reader_or_error.take_value();
+
+  EXPECT_FALSE(reader.IsHole(0, kFileContents.size()));
+  EXPECT_FALSE(reader.IsHole(1, 1));
+  // Ranges past the end of the file must be reported as errors by |Read| instead.
+  EXPECT_FALSE(reader.IsHole(kFileContents.size(), 1));
+}
+
 }  // namespace
 }  // namespace storage::volume_image
@@ -6,6 +6,8 @@
 
 #include <fcntl.h>
 #include <lib/fpromise/result.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <cstdio>
 #include <cstdlib>
@@ -47,4 +49,18 @@ fpromise::result<void, std::string> FdWriter::Write(uint64_t offset,
   return fpromise::ok();
 }
 
+fpromise::result<void, std::string> FdWriter::WriteZeroes(uint64_t offset, uint64_t length) {
+  struct stat file_stats = {};
+  if (fstat(fd_.get(), &file_stats) == 0 && S_ISREG(file_stats.st_mode) &&
+      offset >= static_cast<uint64_t>(file_stats.st_size)) {
+    off_t end = safemath::CheckAdd(offset, length).Cast<off_t>().ValueOrDie();
+    if (ftruncate(fd_.get(), end) != 0) {
+      return fpromise::error("Truncate failed from " + name_ + ". More specifically " +
+                             strerror(errno));
+    }
+    return fpromise::ok();
+  }
+  return Writer::WriteZeroes(offset, length);
+}
+
 }  // namespace storage::volume_image
@@ -36,6 +36,10 @@ class FdWriter final : public Writer {
   // On error the returned result to contains a string describing the error.
   fpromise::result<void, std::string> Write(uint64_t offset, std::span<const uint8_t> buffer) final;
 
+  // Zeroes past the end of a regular file are written by extending the file, which leaves them as
+  // a hole on filesystems which support sparse files. Otherwise the zeroes are written out.
+  fpromise::result<void, std::string> WriteZeroes(uint64_t offset, uint64_t length) final;
+
   // Returns a unique identifier for this |FdWriter|.
   std::string_view name() const { return name_; }
 
@@ -5,6 +5,7 @@
 #include "src/storage/volume_image/utils/fd_writer.h"
 
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #include <array>
 #include <cstdint>
@@ -172,5 +173,40 @@ TEST(FdWriterTest, WritingPastEndOfFileIsOk) {
                      kFileContents.size()) == 0);
 }
 
+TEST(FdWriterTest, WriteZeroesOverwritesAndExtendsFile) {
+  auto temp_file_result = TempFile::Create();
+  ASSERT_TRUE(temp_file_result.is_ok()) << temp_file_result.error();
+  TempFile file = temp_file_result.take_value();
+
+  fbl::unique_fd target_fd(open(file.path().data(), O_RDONLY));
+  ASSERT_TRUE(target_fd.is_valid());
+
+  auto fd_writer_or_error = FdWriter::Create(file.path());
+  ASSERT_TRUE(fd_writer_or_error.is_ok()) << fd_writer_or_error.error();
+  auto writer = fd_writer_or_error.take_value();
+
+  EXPECT_TRUE(writer
+                  .Write(0, std::span(reinterpret_cast<const uint8_t*>(kFileContents.data()),
+                                      kFileContents.size()))
+                  .is_ok());
+  // Zero the middle of the existing contents, and then a range past the end of the file.
+  EXPECT_TRUE(writer.WriteZeroes(1, kFileContents.size() - 2).is_ok());
+  EXPECT_TRUE(writer.WriteZeroes(2 * kFileContents.size(), kFileContents.size()).is_ok());
+
+  struct stat file_stats = {};
+  ASSERT_EQ(fstat(target_fd.get(), &file_stats), 0);
+  EXPECT_EQ(static_cast<uint64_t>(file_stats.st_size), 3 * kFileContents.size());
+
+  std::vector<char> buffer(kFileContents.size() * 3, 'a');
+  ASSERT_NO_FATAL_FAILURE(Read(target_fd.get(), buffer));
+  EXPECT_EQ(buffer.front(), kFileContents.front());
+  EXPECT_EQ(buffer[kFileContents.size() - 1], kFileContents.back());
+  for (size_t i = 1; i < buffer.size(); ++i) {
+    if (i != kFileContents.size() - 1) {
+      EXPECT_EQ(buffer[i], 0) << "at offset " << i;
+    }
+  }
+}
+
 }  // namespace
 }  // namespace storage::volume_image
@@ -30,6 +30,11 @@ class Reader {
   // On error the returned result to contains a string describing the error.
   virtual fpromise::result<void, std::string> Read(uint64_t offset,
                                                    std::span<uint8_t> buffer) const = 0;
+
+  // Returns true if [|offset|, |offset| + |length|) is known to read back as zeroes without being
+  // backed by any data, e.g. because it is a hole in a sparse file. This allows skipping reading
+  // such ranges altogether. Readers which can't tell return false.
+  virtual bool IsHole(uint64_t offset, uint64_t length) const { return false; }
 };
 
 }  // namespace storage::volume_image
@@ -7,8 +7,11 @@
 
 #include <lib/fpromise/result.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <span>
 #include <string>
+#include <vector>
 
 namespace storage::volume_image {
 
@@ -26,6 +29,27 @@ class Writer {
   // On error the returned result to contains a string describing the error.
   virtual fpromise::result<void, std::string> Write(uint64_t offset,
                                                     std::span<const uint8_t> buffer) = 0;
+
+  // On success data backing this writer is updated at [|offset|, |offset| + |length|] to zeroes.
+  //
+  // Writers which can do so without writing every byte, e.g. by leaving a hole in a sparse file,
+  // should override this.
+  virtual fpromise::result<void, std::string> WriteZeroes(uint64_t offset, uint64_t length) {
+    const std::vector<uint8_t> zeroes(std::min<uint64_t>(length, kZeroesBufferSize), 0);
+    while (length > 0) {
+      auto chunk =
+          std::span<const uint8_t>(zeroes.data(), std::min<uint64_t>(length, zeroes.size()));
+      if (auto write_result = Write(offset, chunk); write_result.is_error()) {
+        return write_result.take_error_result();
+      }
+      offset += chunk.size();
+      length -= chunk.size();
+    }
+    return fpromise::ok();
+  }
+
+ private:
+  static constexpr uint64_t kZeroesBufferSize = 1 << 16;
 };
 
 }  // namespace storage::volume_image
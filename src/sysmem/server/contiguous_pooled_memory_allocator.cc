@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <optional>
 
 #include <fbl/string_printf.h>
 
@@ -132,6 +133,9 @@ ContiguousPooledMemoryAllocator::ContiguousPooledMemoryAllocator(
   last_failed_guard_region_check_timestamp_ns_property_ =
       node_.CreateUint("last_failed_guard_region_check_timestamp_ns", 0);
   large_contiguous_region_sum_property_ = node_.CreateUint("large_contiguous_region_sum", 0);
+  free_region_count_property_ = node_.CreateUint("free_region_count", 0);
+  max_free_region_size_property_ = node_.CreateUint("max_free_region_size", 0);
+  fragmentation_percent_property_ = node_.CreateUint("fragmentation_percent", 0);
 
   // CMM/PCMM properties - these values aren't quite true yet, but will be soon.
   loanable_efficiency_property_ =
@@ -433,11 +437,13 @@ zx_status_t ContiguousPooledMemoryAllocator::Allocate(
 
   const uint64_t guard_region_size = has_internal_guard_regions_ ? guard_region_size_ : 0;
   uint64_t allocation_size = size + guard_region_size_ * 2;
-  // TODO(https://fxbug.dev/42119460): Use a fragmentation-reducing allocator (such as best fit).
+  // Both ways of getting a region pick the smallest free region that fits (best fit).
   //
   // The "region" param is an out ref.
   zx_status_t status =
-      region_allocator_.GetRegion(allocation_size, zx_system_get_page_size(), region);
+      allocation_size < small_allocation_threshold_
+          ? GetRegionFromEnd(allocation_size, region)
+          : region_allocator_.GetRegion(allocation_size, zx_system_get_page_size(), region);
   if (status != ZX_OK) {
     LOG(WARNING, "GetRegion failed (out of space?) - size: %" PRIu64 " status: %d", size, status);
     DumpPoolStats();
@@ -1202,6 +1208,43 @@ uint64_t ContiguousPooledMemoryAllocator::CalculateLargeContiguousRegionSize() {
   return top_region_sum;
 }
 
+zx_status_t ContiguousPooledMemoryAllocator::GetRegionFromEnd(
+    uint64_t size, RegionAllocator::Region::UPtr& region) {
+  std::optional<ralloc_region_t> best_region;
+  region_allocator_.WalkAvailableRegions([size, &best_region](const ralloc_region_t* r) -> bool {
+    // On a tie prefer the higher region, to keep small allocations together at the end of the pool.
+    if (r->size >= size && (!best_region.has_value() || r->size < best_region->size ||
+                            (r->size == best_region->size && r->base > best_region->base))) {
+      best_region = *r;
+    }
+    return true;
+  });
+  if (!best_region.has_value()) {
+    return ZX_ERR_NOT_FOUND;
+  }
+  // All region bases and sizes are page multiples, so the end of the region is page-aligned too.
+  ZX_DEBUG_ASSERT((best_region->base + best_region->size) % zx_system_get_page_size() == 0);
+  ZX_DEBUG_ASSERT(size % zx_system_get_page_size() == 0);
+  return region_allocator_.GetRegion(
+      {.base = best_region->base + best_region->size - size, .size = size}, region);
+}
+
+void ContiguousPooledMemoryAllocator::UpdateFragmentationMetrics() {
+  uint64_t free_region_count = 0;
+  uint64_t unused_size = 0;
+  uint64_t max_free_size = 0;
+  region_allocator_.WalkAvailableRegions([&](const ralloc_region_t* r) -> bool {
+    ++free_region_count;
+    unused_size += r->size;
+    max_free_size = std::max(max_free_size, r->size);
+    return true;
+  });
+  free_region_count_property_.Set(free_region_count);
+  max_free_region_size_property_.Set(max_free_size);
+  fragmentation_percent_property_.Set(
+      unused_size ? (unused_size - max_free_size) * 100 / unused_size : 0);
+}
+
 void ContiguousPooledMemoryAllocator::DumpPoolStats() {
   uint64_t unused_size = 0;
   uint64_t max_free_size = 0;
@@ -1238,6 +1281,7 @@ void ContiguousPooledMemoryAllocator::TracePoolSize(bool initial_trace) {
   });
   used_size_property_.Set(used_size);
   large_contiguous_region_sum_property_.Set(CalculateLargeContiguousRegionSize());
+  UpdateFragmentationMetrics();
   // heap_name_ points at a string literal, as required by TRACE_COUNTER
   TRACE_COUNTER("gfx", heap_name_, counter_id_, "size", used_size);
   bool trace_high_water_mark = initial_trace;
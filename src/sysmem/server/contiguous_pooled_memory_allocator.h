@@ -102,6 +102,15 @@ class ContiguousPooledMemoryAllocator : public MemoryAllocator {
   }
   bool is_bti_fake() { return is_bti_fake_; }
 
+  // Allocations (including any internal guard regions) smaller than `threshold` bytes are placed at
+  // the end of the smallest free region that can hold them, instead of at its start. Large
+  // allocations keep taking the start of their region, so small and often short-lived buffers stop
+  // splitting up the free space that large buffers (such as video frames) need. Zero, the default,
+  // places every allocation at the start of its region.
+  void set_small_allocation_threshold(uint64_t threshold) {
+    small_allocation_threshold_ = threshold;
+  }
+
   const fuchsia_sysmem2::Heap& heap() {
     ZX_ASSERT(heap_.has_value());
     return *heap_;
@@ -199,6 +208,9 @@ class ContiguousPooledMemoryAllocator : public MemoryAllocator {
   void DumpPoolHighWaterMark();
   void TracePoolSize(bool initial_trace);
   uint64_t CalculateLargeContiguousRegionSize();
+  void UpdateFragmentationMetrics();
+  // Allocates `size` bytes from the end of the smallest free region that fits.
+  zx_status_t GetRegionFromEnd(uint64_t size, RegionAllocator::Region::UPtr& region);
   void UpdateLoanableMetrics();
 
   // This method iterates over all the sub-regions of an unused region.  The sub-regions are regions
@@ -337,6 +349,12 @@ class ContiguousPooledMemoryAllocator : public MemoryAllocator {
   inspect::UintProperty last_failed_guard_region_check_timestamp_ns_property_;
   // This tracks the sum of the size of the 10 largest free regions.
   inspect::UintProperty large_contiguous_region_sum_property_;
+  // The number of free regions, and the size of the largest one.
+  inspect::UintProperty free_region_count_property_;
+  inspect::UintProperty max_free_region_size_property_;
+  // The percentage of free space that is outside the largest free region; 0 means all the free
+  // space is contiguous.
+  inspect::UintProperty fragmentation_percent_property_;
 
   // CMM / PCMM properties regarding loaning of pages to Zircon.
   //
@@ -392,6 +410,8 @@ class ContiguousPooledMemoryAllocator : public MemoryAllocator {
 
   bool is_bti_fake_ = false;
 
+  uint64_t small_allocation_threshold_ = 0;
+
   // We cap the number of DeletedRegion we're willing to track; otherwise the overhead could get a
   // bit excessive in pathological cases if we were to allow tracking a DeletedRegion per page for
   // example.  This is optimized for update, not (at all) for lookup, since we only do lookups if
@@ -0,0 +1,99 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "recycled_vmo_cache.h"
+
+#include <lib/trace/event.h>
+#include <zircon/assert.h>
+
+#include <algorithm>
+
+#include "macros.h"
+
+namespace sysmem_service {
+
+RecycledVmoCache::RecycledVmoCache(uint64_t max_cached_bytes, inspect::Node node)
+    : max_cached_bytes_(max_cached_bytes), node_(std::move(node)) {
+  max_cached_bytes_property_ = node_.CreateUint("max_cached_bytes", max_cached_bytes_);
+  cached_bytes_property_ = node_.CreateUint("cached_bytes", 0);
+  cached_count_property_ = node_.CreateUint("cached_count", 0);
+  hit_count_property_ = node_.CreateUint("hit_count", 0);
+  miss_count_property_ = node_.CreateUint("miss_count", 0);
+  hit_rate_percent_property_ = node_.CreateUint("hit_rate_percent", 0);
+  evicted_count_property_ = node_.CreateUint("evicted_count", 0);
+}
+
+std::optional<zx::vmo> RecycledVmoCache::Take(uint64_t size,
+                                              fuchsia_sysmem2::CoherencyDomain coherency_domain) {
+  TRACE_DURATION("gfx", "RecycledVmoCache::Take", "size", size);
+  // Prefer the most recently cached VMO, as it's the most likely to still be warm in the cache.
+  auto it = std::find_if(entries_.rbegin(), entries_.rend(), [&](const Entry& entry) {
+    return entry.size == size && entry.coherency_domain == coherency_domain;
+  });
+  if (it == entries_.rend()) {
+    ++miss_count_;
+    UpdateInspect();
+    return std::nullopt;
+  }
+
+  zx::vmo vmo = std::move(it->vmo);
+  cached_bytes_ -= it->size;
+  entries_.erase(std::next(it).base());
+
+  // The previous contents belong to a different client, so they must not leak to the next one.
+  zx_status_t status = vmo.op_range(ZX_VMO_OP_ZERO, 0, size, nullptr, 0);
+  if (status != ZX_OK) {
+    LOG(WARNING, "Dropping cached VMO that failed to zero - status: %d", status);
+    ++miss_count_;
+    UpdateInspect();
+    return std::nullopt;
+  }
+
+  ++hit_count_;
+  UpdateInspect();
+  return vmo;
+}
+
+void RecycledVmoCache::Put(zx::vmo vmo, uint64_t size,
+                           fuchsia_sysmem2::CoherencyDomain coherency_domain) {
+  if (size > max_cached_bytes_) {
+    // ~vmo
+    return;
+  }
+  while (cached_bytes_ + size > max_cached_bytes_) {
+    EvictOldest();
+  }
+  entries_.push_back(Entry{
+      .vmo = std::move(vmo),
+      .size = size,
+      .coherency_domain = coherency_domain,
+  });
+  cached_bytes_ += size;
+  UpdateInspect();
+}
+
+void RecycledVmoCache::Trim() {
+  while (!entries_.empty()) {
+    EvictOldest();
+  }
+  UpdateInspect();
+}
+
+void RecycledVmoCache::EvictOldest() {
+  ZX_DEBUG_ASSERT(!entries_.empty());
+  cached_bytes_ -= entries_.front().size;
+  entries_.pop_front();
+  evicted_count_property_.Add(1);
+}
+
+void RecycledVmoCache::UpdateInspect() {
+  cached_bytes_property_.Set(cached_bytes_);
+  cached_count_property_.Set(entries_.size());
+  hit_count_property_.Set(hit_count_);
+  miss_count_property_.Set(miss_count_);
+  const uint64_t lookup_count = hit_count_ + miss_count_;
+  hit_rate_percent_property_.Set(lookup_count ? hit_count_ * 100 / lookup_count : 0);
+}
+
+}  // namespace sysmem_service
@@ -0,0 +1,82 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_SYSMEM_SERVER_RECYCLED_VMO_CACHE_H_
+#define SRC_SYSMEM_SERVER_RECYCLED_VMO_CACHE_H_
+
+#include <fidl/fuchsia.sysmem2/cpp/fidl.h>
+#include <lib/inspect/cpp/inspect.h>
+#include <lib/zx/vmo.h>
+
+#include <deque>
+#include <optional>
+
+namespace sysmem_service {
+
+// Holds on to VMOs that a MemoryAllocator has been asked to Delete(), so that a later Allocate() of
+// the same size and coherency domain can reuse one instead of creating a new VMO. This is meant for
+// allocators whose VMOs are expensive or unreliable to create, such as contiguous VMOs, and which
+// are asked for the same buffer shapes repeatedly (for example at every camera or video stream
+// start).
+//
+// A cache instance is per-allocator, so per-heap. Cached VMOs are zeroed before they're handed
+// out again; the caller is still responsible for any cache flush the heap needs after allocation.
+//
+// The cache never holds more than `max_cached_bytes`, evicting the least-recently cached VMOs
+// first. Callers should Trim() the cache before treating a failure to create a new VMO as final.
+//
+// Not thread-safe; like the allocators, this is only used from the sysmem loop thread.
+class RecycledVmoCache {
+ public:
+  RecycledVmoCache(uint64_t max_cached_bytes, inspect::Node node);
+
+  RecycledVmoCache(const RecycledVmoCache&) = delete;
+  RecycledVmoCache& operator=(const RecycledVmoCache&) = delete;
+
+  // Returns a zeroed cached VMO of exactly `size` bytes which was last used with
+  // `coherency_domain`, or std::nullopt if there isn't one.
+  std::optional<zx::vmo> Take(uint64_t size, fuchsia_sysmem2::CoherencyDomain coherency_domain);
+
+  // Takes ownership of `vmo`, which must have no children and no other handles. The VMO is closed
+  // instead if it doesn't fit in the cache at all.
+  void Put(zx::vmo vmo, uint64_t size, fuchsia_sysmem2::CoherencyDomain coherency_domain);
+
+  // Closes all cached VMOs.
+  void Trim();
+
+  uint64_t cached_bytes() const { return cached_bytes_; }
+  size_t cached_count() const { return entries_.size(); }
+  uint64_t hit_count() const { return hit_count_; }
+  uint64_t miss_count() const { return miss_count_; }
+
+ private:
+  struct Entry {
+    zx::vmo vmo;
+    uint64_t size;
+    fuchsia_sysmem2::CoherencyDomain coherency_domain;
+  };
+
+  void EvictOldest();
+  void UpdateInspect();
+
+  const uint64_t max_cached_bytes_;
+  // Oldest first.
+  std::deque<Entry> entries_;
+  uint64_t cached_bytes_ = 0;
+  uint64_t hit_count_ = 0;
+  uint64_t miss_count_ = 0;
+
+  inspect::Node node_;
+  inspect::UintProperty max_cached_bytes_property_;
+  inspect::UintProperty cached_bytes_property_;
+  inspect::UintProperty cached_count_property_;
+  inspect::UintProperty hit_count_property_;
+  inspect::UintProperty miss_count_property_;
+  inspect::UintProperty hit_rate_percent_property_;
+  inspect::UintProperty evicted_count_property_;
+};
+
+}  // namespace sysmem_service
+
+#endif  // SRC_SYSMEM_SERVER_RECYCLED_VMO_CACHE_H_
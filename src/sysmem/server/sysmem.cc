@@ -29,8 +29,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #include <bind/fuchsia/hardware/sysmem/cpp/bind.h>
 #include <bind/fuchsia/sysmem/heap/cpp/bind.h>
@@ -44,6 +46,7 @@
 #include "src/sysmem/server/contiguous_pooled_memory_allocator.h"
 #include "src/sysmem/server/external_memory_allocator.h"
 #include "src/sysmem/server/macros.h"
+#include "src/sysmem/server/recycled_vmo_cache.h"
 #include "src/sysmem/server/utils.h"
 #include "zircon/status.h"
 
@@ -155,8 +158,9 @@ class ContiguousSystemRamMemoryAllocator : public MemoryAllocator {
             // zero-fill already flushed to RAM (at least for the RAM coherency
             // domain, this should probably remain true).
             /*need_clear=*/false, /*need_flush=*/true)),
-        parent_device_(parent_device) {
-    node_ = parent_device_->heap_node()->CreateChild("ContiguousSystemRamMemoryAllocator");
+        parent_device_(parent_device),
+        node_(parent_device_->heap_node()->CreateChild("ContiguousSystemRamMemoryAllocator")),
+        recycled_vmos_(kMaxRecycledBytes, node_.CreateChild("recycled_vmos")) {
     node_.CreateUint("id", id(), &properties_);
   }
 
@@ -168,6 +172,17 @@ class ContiguousSystemRamMemoryAllocator : public MemoryAllocator {
         fbl::round_up(*settings.buffer_settings()->size_bytes(), zx_system_get_page_size()) == size,
         "size_bytes: %" PRIu64 " size: 0x%" PRIx64, *settings.buffer_settings()->size_bytes(),
         size);
+    const fuchsia_sysmem2::CoherencyDomain coherency_domain =
+        *settings.buffer_settings()->coherency_domain();
+    // Clients tend to allocate the same buffer shapes over and over, so a VMO from a recently
+    // deleted collection avoids both the cost of create_contiguous() and its increasing chance of
+    // failing as physical memory fragments.
+    if (std::optional<zx::vmo> recycled_vmo = recycled_vmos_.Take(size, coherency_domain)) {
+      *parent_vmo = std::move(*recycled_vmo);
+      vmo_coherency_domains_[parent_vmo->get()] = coherency_domain;
+      return ZX_OK;
+    }
+
     zx::vmo result_parent_vmo;
     // This code is unlikely to work after running for a while and physical
     // memory is more fragmented than early during boot. The
@@ -175,6 +190,11 @@ class ContiguousSystemRamMemoryAllocator : public MemoryAllocator {
     // a separate pool of contiguous memory.
     zx_status_t status =
         zx::vmo::create_contiguous(parent_device_->bti(), size, 0, &result_parent_vmo);
+    if (status != ZX_OK && recycled_vmos_.cached_bytes() != 0) {
+      // Give the recycled VMOs back to the system and try once more before failing.
+      recycled_vmos_.Trim();
+      status = zx::vmo::create_contiguous(parent_device_->bti(), size, 0, &result_parent_vmo);
+    }
     if (status != ZX_OK) {
       LOG(ERROR, "zx::vmo::create_contiguous() failed - size_bytes: %" PRIu64 " status: %d", size,
           status);
@@ -185,10 +205,18 @@ class ContiguousSystemRamMemoryAllocator : public MemoryAllocator {
     constexpr const char vmo_name[] = "Sysmem-contig-core";
     result_parent_vmo.set_property(ZX_PROP_NAME, vmo_name, sizeof(vmo_name));
     *parent_vmo = std::move(result_parent_vmo);
+    vmo_coherency_domains_[parent_vmo->get()] = coherency_domain;
     return ZX_OK;
   }
   void Delete(zx::vmo parent_vmo) override {
-    // ~vmo
+    auto node = vmo_coherency_domains_.extract(parent_vmo.get());
+    ZX_DEBUG_ASSERT(node);
+    uint64_t size;
+    if (!node || parent_vmo.get_size(&size) != ZX_OK) {
+      // ~vmo
+      return;
+    }
+    recycled_vmos_.Put(std::move(parent_vmo), size, node.mapped());
   }
   // Since this allocator only allocates independent VMOs, it's fine to orphan those VMOs from the
   // allocator since the VMOs independently track what pages they're using.  So this allocator can
@@ -196,8 +224,16 @@ class ContiguousSystemRamMemoryAllocator : public MemoryAllocator {
   bool is_empty() override { return true; }
 
  private:
+  // Enough for a few sets of camera or video buffers, while staying small next to the memory such a
+  // device needs for the streams themselves.
+  static constexpr uint64_t kMaxRecycledBytes = 32ull * 1024 * 1024;
+
   Owner* const parent_device_;
   inspect::Node node_;
+  RecycledVmoCache recycled_vmos_;
+  // The coherency domain each outstanding VMO was allocated for, keyed by the VMO handle value,
+  // which stays the same until Delete() takes the VMO back.
+  std::unordered_map<zx_handle_t, fuchsia_sysmem2::CoherencyDomain> vmo_coherency_domains_;
   inspect::ValueList properties_;
 };
 
@@ -578,6 +614,9 @@ zx::result<> Sysmem::Initialize(const CreateArgs& create_args) {
       LOG(ERROR, "Contiguous system ram allocator initialization failed");
       return zx::error(ZX_ERR_NO_MEMORY);
     }
+    // Keep buffers below the size of a video frame away from the space that video frames need.
+    constexpr uint64_t kSmallAllocationThreshold = 1024ull * 1024;
+    pooled_allocator->set_small_allocation_threshold(kSmallAllocationThreshold);
     uint64_t guard_region_size;
     bool unused_pages_guarded;
     int64_t unused_guard_pattern_period_bytes;
@@ -489,5 +489,50 @@ TEST_F(ContiguousPooledSystem, FreeRegionReporting) {
   }
 }
 
+TEST_F(ContiguousPooledSystem, SmallAllocationsFromEnd) {
+  allocator_.set_small_allocation_threshold(2 * kVmoSize);
+  EXPECT_OK(PrepareAllocator());
+
+  auto allocate = [this](uint64_t size) {
+    zx::vmo vmo;
+    fuchsia_sysmem2::SingleBufferSettings settings;
+    settings.buffer_settings().emplace();
+    settings.buffer_settings()->size_bytes() = size;
+    EXPECT_OK(allocator_.Allocate(size, settings, "", kBufferCollectionId, kBufferIndex, &vmo));
+    return vmo;
+  };
+
+  // Large allocations come from the start of the pool, small ones from the end.
+  zx::vmo large_vmo = allocate(4 * kVmoSize);
+  zx::vmo small_vmo = allocate(kVmoSize);
+  EXPECT_EQ(0u, allocator_.GetVmoRegionOffsetForTest(large_vmo));
+  EXPECT_EQ(kVmoSize * (kVmoCount - 1), allocator_.GetVmoRegionOffsetForTest(small_vmo));
+
+  // Leave a two page gap before the small allocation. Once the large allocation is freed too, the
+  // next small allocation goes to the end of the smallest free region that fits, which is that gap.
+  zx::vmo filler_vmo = allocate(kVmoCount * kVmoSize - 7 * kVmoSize);
+  EXPECT_EQ(4 * kVmoSize, allocator_.GetVmoRegionOffsetForTest(filler_vmo));
+  allocator_.Delete(std::move(large_vmo));
+  zx::vmo second_small_vmo = allocate(kVmoSize);
+  EXPECT_EQ(kVmoSize * (kVmoCount - 2), allocator_.GetVmoRegionOffsetForTest(second_small_vmo));
+
+  auto hierarchy = inspect::ReadFromVmo(inspector_.DuplicateVmo());
+  auto* value = hierarchy.value().GetByPath({"test-pool"});
+  ASSERT_TRUE(value);
+  // Four pages are free at the start of the pool and one page is free near the end.
+  EXPECT_EQ(2u,
+            value->node().get_property<inspect::UintPropertyValue>("free_region_count")->value());
+  EXPECT_EQ(4u * kVmoSize, value->node()
+                               .get_property<inspect::UintPropertyValue>("max_free_region_size")
+                               ->value());
+  EXPECT_EQ(20u, value->node()
+                     .get_property<inspect::UintPropertyValue>("fragmentation_percent")
+                     ->value());
+
+  allocator_.Delete(std::move(small_vmo));
+  allocator_.Delete(std::move(second_small_vmo));
+  allocator_.Delete(std::move(filler_vmo));
+}
+
 }  // namespace
 }  // namespace sysmem_service
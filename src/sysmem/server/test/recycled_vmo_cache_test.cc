@@ -0,0 +1,101 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/sysmem/server/recycled_vmo_cache.h"
+
+#include <lib/inspect/cpp/inspect.h>
+#include <zircon/syscalls.h>
+
+#include <cstdint>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "src/lib/testing/predicates/status.h"
+
+namespace sysmem_service {
+namespace {
+
+using fuchsia_sysmem2::CoherencyDomain;
+
+class RecycledVmoCacheTest : public ::testing::Test {
+ protected:
+  static uint64_t PageSize() { return zx_system_get_page_size(); }
+
+  zx::vmo CreateVmo(uint64_t size) {
+    zx::vmo vmo;
+    EXPECT_OK(zx::vmo::create(size, 0, &vmo));
+    return vmo;
+  }
+
+  inspect::Inspector inspector_;
+};
+
+TEST_F(RecycledVmoCacheTest, ReusesMatchingVmo) {
+  RecycledVmoCache cache(4 * PageSize(), inspector_.GetRoot().CreateChild("cache"));
+
+  zx::vmo vmo = CreateVmo(PageSize());
+  zx_koid_t koid = 0;
+  {
+    zx_info_handle_basic_t info;
+    ASSERT_OK(vmo.get_info(ZX_INFO_HANDLE_BASIC, &info, sizeof(info), nullptr, nullptr));
+    koid = info.koid;
+  }
+  cache.Put(std::move(vmo), PageSize(), CoherencyDomain::kRam);
+  EXPECT_EQ(cache.cached_bytes(), PageSize());
+
+  // A different size or coherency domain doesn't match.
+  EXPECT_FALSE(cache.Take(2 * PageSize(), CoherencyDomain::kRam).has_value());
+  EXPECT_FALSE(cache.Take(PageSize(), CoherencyDomain::kCpu).has_value());
+
+  std::optional<zx::vmo> recycled = cache.Take(PageSize(), CoherencyDomain::kRam);
+  ASSERT_TRUE(recycled.has_value());
+  zx_info_handle_basic_t info;
+  ASSERT_OK(recycled->get_info(ZX_INFO_HANDLE_BASIC, &info, sizeof(info), nullptr, nullptr));
+  EXPECT_EQ(info.koid, koid);
+
+  EXPECT_EQ(cache.cached_bytes(), 0u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+  EXPECT_EQ(cache.miss_count(), 2u);
+}
+
+TEST_F(RecycledVmoCacheTest, ZeroesBeforeReuse) {
+  RecycledVmoCache cache(4 * PageSize(), inspector_.GetRoot().CreateChild("cache"));
+
+  zx::vmo vmo = CreateVmo(PageSize());
+  const uint64_t pattern = 0xdeadbeefcafef00d;
+  ASSERT_OK(vmo.write(&pattern, PageSize() - sizeof(pattern), sizeof(pattern)));
+  cache.Put(std::move(vmo), PageSize(), CoherencyDomain::kCpu);
+
+  std::optional<zx::vmo> recycled = cache.Take(PageSize(), CoherencyDomain::kCpu);
+  ASSERT_TRUE(recycled.has_value());
+  uint64_t value = 1;
+  ASSERT_OK(recycled->read(&value, PageSize() - sizeof(value), sizeof(value)));
+  EXPECT_EQ(value, 0u);
+}
+
+TEST_F(RecycledVmoCacheTest, EvictsOldestToStayWithinLimit) {
+  RecycledVmoCache cache(2 * PageSize(), inspector_.GetRoot().CreateChild("cache"));
+
+  cache.Put(CreateVmo(PageSize()), PageSize(), CoherencyDomain::kRam);
+  cache.Put(CreateVmo(PageSize()), PageSize(), CoherencyDomain::kCpu);
+  cache.Put(CreateVmo(PageSize()), PageSize(), CoherencyDomain::kInaccessible);
+  EXPECT_EQ(cache.cached_count(), 2u);
+  EXPECT_EQ(cache.cached_bytes(), 2 * PageSize());
+
+  // The kRam VMO was cached first, so it was evicted.
+  EXPECT_FALSE(cache.Take(PageSize(), CoherencyDomain::kRam).has_value());
+  EXPECT_TRUE(cache.Take(PageSize(), CoherencyDomain::kCpu).has_value());
+
+  // A VMO that can never fit isn't cached, and doesn't evict anything.
+  cache.Put(CreateVmo(4 * PageSize()), 4 * PageSize(), CoherencyDomain::kRam);
+  EXPECT_EQ(cache.cached_count(), 1u);
+
+  cache.Trim();
+  EXPECT_EQ(cache.cached_count(), 0u);
+  EXPECT_EQ(cache.cached_bytes(), 0u);
+}
+
+}  // namespace
+}  // namespace sysmem_service
@@ -5,11 +5,17 @@
 #include <fuchsia/zircon/benchmarks/cpp/fidl.h>
 #include <lib/async-loop/cpp/loop.h>
 #include <lib/async-loop/default.h>
+#include <lib/async/cpp/task.h>
+#include <lib/async/cpp/wait.h>
 #include <lib/fidl/cpp/binding.h>
 #include <lib/zx/channel.h>
+#include <lib/zx/event.h>
 #include <lib/zx/handle.h>
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -24,6 +30,9 @@
 //
 // The server process phase exercises Zircon's channel waiting and reading
 // mechanisms, trivial FIDL message decoding, and the libasync dispatch loop.
+//
+// The AsyncLoopPostTasks and AsyncLoopWaits benchmarks measure how task and wait dispatch
+// throughput scales with the number of threads servicing a single loop.
 
 namespace {
 
@@ -65,6 +74,87 @@ bool AsyncLoopProcessBatch(uint32_t count, perftest::RepeatState* state) {
   return true;
 }
 
+// Starts |num_threads| threads servicing |loop|.
+void StartLoopThreads(async::Loop& loop, uint32_t num_threads) {
+  for (uint32_t i = 0; i < num_threads; i++) {
+    ASSERT_OK(loop.StartThread());
+  }
+}
+
+// Signals |done| once |count| is decremented to zero.
+void CountDown(std::atomic<uint32_t>& count, const zx::event& done) {
+  if (count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    ASSERT_OK(done.signal(0, ZX_EVENT_SIGNALED));
+  }
+}
+
+void WaitAndReset(const zx::event& done) {
+  ASSERT_OK(done.wait_one(ZX_EVENT_SIGNALED, zx::time::infinite(), nullptr));
+  ASSERT_OK(done.signal(ZX_EVENT_SIGNALED, 0));
+}
+
+// Measures posting a batch of tasks to a loop serviced by |num_threads| threads, and waiting for
+// all of them to run.
+bool AsyncLoopPostTasks(uint32_t num_threads, perftest::RepeatState* state) {
+  constexpr uint32_t kTasks = 100;
+
+  async::Loop loop(&kAsyncLoopConfigNoAttachToCurrentThread);
+  StartLoopThreads(loop, num_threads);
+  zx::event done;
+  ASSERT_OK(zx::event::create(0, &done));
+
+  while (state->KeepRunning()) {
+    std::atomic<uint32_t> remaining = kTasks;
+    for (uint32_t i = 0; i < kTasks; i++) {
+      ASSERT_OK(async::PostTask(loop.dispatcher(), [&] { CountDown(remaining, done); }));
+    }
+    WaitAndReset(done);
+  }
+
+  loop.Shutdown();
+  return true;
+}
+
+// Measures signaling a batch of objects waited on by a loop serviced by |num_threads| threads,
+// and waiting for all of the wait handlers to run.
+bool AsyncLoopWaits(uint32_t num_threads, perftest::RepeatState* state) {
+  constexpr uint32_t kWaits = 16;
+
+  async::Loop loop(&kAsyncLoopConfigNoAttachToCurrentThread);
+  StartLoopThreads(loop, num_threads);
+  zx::event done;
+  ASSERT_OK(zx::event::create(0, &done));
+
+  std::atomic<uint32_t> remaining;
+  std::vector<zx::event> events(kWaits);
+  std::vector<std::unique_ptr<async::WaitOnce>> waits;
+  for (auto& event : events) {
+    ASSERT_OK(zx::event::create(0, &event));
+    waits.push_back(std::make_unique<async::WaitOnce>(event.get(), ZX_EVENT_SIGNALED));
+  }
+
+  while (state->KeepRunning()) {
+    remaining = kWaits;
+    for (uint32_t i = 0; i < kWaits; i++) {
+      ASSERT_OK(waits[i]->Begin(loop.dispatcher(),
+                                [&, event = events[i].get()](
+                                    async_dispatcher_t*, async::WaitOnce*, zx_status_t status,
+                                    const zx_packet_signal_t*) {
+                                  ASSERT_OK(status);
+                                  ASSERT_OK(zx_object_signal(event, ZX_EVENT_SIGNALED, 0));
+                                  CountDown(remaining, done);
+                                }));
+    }
+    for (auto& event : events) {
+      ASSERT_OK(event.signal(0, ZX_EVENT_SIGNALED));
+    }
+    WaitAndReset(done);
+  }
+
+  loop.Shutdown();
+  return true;
+}
+
 void RegisterTests() {
   // Return a benchmark function the processes "count" messages per batch.
   auto AsyncLoopProcessBatchN = [](uint32_t count) {
@@ -76,6 +166,17 @@ void RegisterTests() {
   perftest::RegisterTest("AsyncLoopProcessBatch/4", AsyncLoopProcessBatchN(4));
   perftest::RegisterTest("AsyncLoopProcessBatch/8", AsyncLoopProcessBatchN(8));
   perftest::RegisterTest("AsyncLoopProcessBatch/16", AsyncLoopProcessBatchN(16));
+
+  for (uint32_t num_threads : {1, 2, 4, 8}) {
+    perftest::RegisterTest(
+        ("AsyncLoopPostTasks/100tasks/" + std::to_string(num_threads) + "threads").c_str(),
+        [num_threads](perftest::RepeatState* state) {
+          return AsyncLoopPostTasks(num_threads, state);
+        });
+    perftest::RegisterTest(
+        ("AsyncLoopWaits/16waits/" + std::to_string(num_threads) + "threads").c_str(),
+        [num_threads](perftest::RepeatState* state) { return AsyncLoopWaits(num_threads, state); });
+  }
 }
 PERFTEST_CTOR(RegisterTests)
 
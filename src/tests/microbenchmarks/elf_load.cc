@@ -0,0 +1,139 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <fidl/fuchsia.io/cpp/wire.h>
+#include <lib/elfldltl/container.h>
+#include <lib/elfldltl/diagnostics.h>
+#include <lib/elfldltl/load.h>
+#include <lib/elfldltl/memory.h>
+#include <lib/elfldltl/segment-with-vmo.h>
+#include <lib/elfldltl/vmar-loader.h>
+#include <lib/elfldltl/vmo.h>
+#include <lib/fdio/fd.h>
+#include <lib/fdio/io.h>
+#include <lib/zx/vmar.h>
+#include <lib/zx/vmo.h>
+#include <stdio.h>
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <fbl/unique_fd.h>
+#include <perftest/perftest.h>
+
+#include "assert.h"
+
+namespace {
+
+// The same small executable that the fdio_spawn benchmarks launch.
+constexpr const char* kPath = "/pkg/bin/no_op_executable";
+
+using Elf = elfldltl::Elf<>;
+using Phdr = Elf::Phdr;
+using PhdrVector = std::vector<Phdr>;
+
+template <class SegmentWrapper = elfldltl::NoSegmentWrapper>
+using LoadInfo = elfldltl::LoadInfo<Elf, elfldltl::StdContainer<std::vector>::Container,
+                                    elfldltl::PhdrLoadPolicy::kBasic, SegmentWrapper>;
+
+auto MakeDiagnostics() {
+  return elfldltl::Diagnostics(elfldltl::FprintfDiagnosticsReport(stderr, kPath, ": "),
+                               elfldltl::DiagnosticsPanicFlags());
+}
+
+zx::vmo GetExecutableVmo() {
+  fbl::unique_fd fd;
+  ASSERT_OK(fdio_open3_fd(
+      kPath, static_cast<uint64_t>(fuchsia_io::kPermReadable | fuchsia_io::kPermExecutable),
+      fd.reset_and_get_address()));
+  zx::vmo vmo;
+  ASSERT_OK(fdio_get_vmo_exec(fd.get(), vmo.reset_and_get_address()));
+  return vmo;
+}
+
+// Reads the headers from |vmo| and fills in |load_info| from them, as every fresh load must do.
+template <class Diagnostics, class Info>
+void DecodeHeaders(Diagnostics& diag, const zx::vmo& vmo, Info& load_info) {
+  elfldltl::UnownedVmoFile file{vmo.borrow(), diag};
+  auto headers = elfldltl::LoadHeadersFromFile<Elf>(
+      diag, file, elfldltl::ContainerArrayFromFile<PhdrVector>(diag, "impossible"));
+  ZX_ASSERT(headers);
+  auto& [ehdr, phdrs] = *headers;
+  ZX_ASSERT(elfldltl::DecodePhdrs(diag, std::span<const Phdr>{phdrs},
+                                  load_info.GetPhdrObserver(elfldltl::VmarLoader::page_size())));
+}
+
+// Write to one byte of each page of the writable segments, as the process's startup dynamic
+// linker does when it applies relocations, so each of them takes its copy-on-write fault.
+template <class Info>
+void TouchWritablePages(const Info& load_info, zx_vaddr_t load_bias) {
+  const size_t page_size = elfldltl::VmarLoader::page_size();
+  load_info.VisitSegments([load_bias, page_size](const auto& segment) {
+    if (segment.writable()) {
+      for (size_t offset = 0; offset < segment.memsz(); offset += page_size) {
+        auto* byte = reinterpret_cast<volatile std::byte*>(load_bias + segment.vaddr() + offset);
+        *byte = *byte;
+      }
+    }
+    return true;
+  });
+}
+
+// Measures the time to load an executable's segments into a new VMAR from scratch: reading and
+// decoding the program headers, then mapping each segment with a copy-on-write child VMO for each
+// writable one and zeroing the partial page before the bss. This is the work that every process
+// launch repeats for an executable.
+bool ElfLoadFresh(perftest::RepeatState* state, bool touch) {
+  auto diag = MakeDiagnostics();
+  zx::vmo vmo = GetExecutableVmo();
+
+  while (state->KeepRunning()) {
+    LoadInfo<> load_info;
+    DecodeHeaders(diag, vmo, load_info);
+    elfldltl::RemoteVmarLoader loader{*zx::vmar::root_self()};
+    ZX_ASSERT(loader.Load(diag, load_info, vmo.borrow()));
+    if (touch) {
+      TouchWritablePages(load_info, loader.load_bias());
+    }
+  }
+
+  return true;
+}
+
+// Measures the same load when the decoded segments have been prepared ahead of time and are
+// reused for every load, as a launcher that spawns the same executable repeatedly can do. The
+// segments are decoded once and elfldltl::SegmentWithVmo::AlignSegments does the partial-page
+// zeroing once in a read-only per-segment VMO, so each load only maps the segments and makes the
+// copy-on-write children for the writable ones.
+bool ElfLoadPrepared(perftest::RepeatState* state, bool touch) {
+  auto diag = MakeDiagnostics();
+  zx::vmo vmo = GetExecutableVmo();
+
+  LoadInfo<elfldltl::SegmentWithVmo::Copy> load_info;
+  DecodeHeaders(diag, vmo, load_info);
+  ZX_ASSERT(elfldltl::SegmentWithVmo::AlignSegments(
+      diag, load_info, vmo.borrow(), elfldltl::VmarLoader::page_size(), true));
+
+  while (state->KeepRunning()) {
+    elfldltl::AlignedRemoteVmarLoader loader{*zx::vmar::root_self()};
+    ZX_ASSERT(loader.Load(diag, load_info, vmo.borrow()));
+    if (touch) {
+      TouchWritablePages(load_info, loader.load_bias());
+    }
+  }
+
+  return true;
+}
+
+void RegisterTests() {
+  perftest::RegisterTest("ElfLoad/Fresh", ElfLoadFresh, false);
+  perftest::RegisterTest("ElfLoad/Fresh/TouchWritable", ElfLoadFresh, true);
+  perftest::RegisterTest("ElfLoad/Prepared", ElfLoadPrepared, false);
+  perftest::RegisterTest("ElfLoad/Prepared/TouchWritable", ElfLoadPrepared, true);
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
@@ -7,6 +7,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <vector>
+
+#include <fbl/string_printf.h>
 #include <fbl/unique_fd.h>
 #include <perftest/perftest.h>
 
@@ -39,10 +42,28 @@ bool FstatTest(perftest::RepeatState* state) {
   return true;
 }
 
+// Measure the time taken to create a small file in /tmp, write |file_size| bytes to it, close it
+// and unlink it, which is the pattern of short-lived temporary files.
+bool TmpFileChurnTest(perftest::RepeatState* state, size_t file_size) {
+  const std::vector<char> data(file_size, 'a');
+  while (state->KeepRunning()) {
+    fbl::unique_fd fd(open("/tmp/churn", O_RDWR | O_CREAT | O_EXCL, 0644));
+    FX_CHECK(fd.is_valid());
+    FX_CHECK(write(fd.get(), data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+    FX_CHECK(close(fd.release()) == 0);
+    FX_CHECK(unlink("/tmp/churn") == 0);
+  }
+  return true;
+}
+
 void RegisterTests() {
   perftest::RegisterSimpleTest<StatTest>("Filesystem_Stat");
   perftest::RegisterSimpleTest<OpenTest>("Filesystem_Open");
   perftest::RegisterTest("Filesystem_Fstat", FstatTest);
+  for (size_t file_size : {64, 4096, 65536}) {
+    auto name = fbl::StringPrintf("Filesystem_TmpFileChurn/%zubytes", file_size);
+    perftest::RegisterTest(name.c_str(), TmpFileChurnTest, file_size);
+  }
 }
 PERFTEST_CTOR(RegisterTests)
 
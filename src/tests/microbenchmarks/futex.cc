@@ -0,0 +1,69 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <zircon/assert.h>
+#include <zircon/syscalls.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <fbl/string_printf.h>
+#include <perftest/perftest.h>
+
+#include "assert.h"
+
+namespace {
+
+// Wakes a futex that has no waiters. This only looks the futex up in the process's futex table.
+void WakeNoWaiters(zx_futex_t* futex) { ASSERT_OK(zx_futex_wake(futex, 1)); }
+
+// Waits on a futex with a value that does not match. This activates the futex, checks its value
+// and releases it again, without blocking.
+void WaitMismatch(zx_futex_t* futex) {
+  ZX_ASSERT(zx_futex_wait(futex, 1, ZX_HANDLE_INVALID, ZX_TIME_INFINITE) == ZX_ERR_BAD_STATE);
+}
+
+// Measures the time taken by a futex operation that never blocks while |num_threads| - 1 other
+// threads perform the same operation in a loop. Every thread uses its own futex, so any slowdown as
+// the thread count increases comes from state shared by all futexes in the process rather than
+// from the futexes themselves.
+template <void (*FutexOp)(zx_futex_t*)>
+bool FutexContentionTest(perftest::RepeatState* state, uint32_t num_threads) {
+  struct alignas(64) PaddedFutex {
+    zx_futex_t value = 0;
+  };
+  std::vector<PaddedFutex> futexes(num_threads);
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < num_threads; i++) {
+    threads.emplace_back([&stop, futex = &futexes[i].value] {
+      while (!stop.load(std::memory_order_relaxed)) {
+        FutexOp(futex);
+      }
+    });
+  }
+
+  while (state->KeepRunning()) {
+    FutexOp(&futexes[0].value);
+  }
+
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return true;
+}
+
+void RegisterTests() {
+  for (uint32_t threads : {1, 2, 8, 32}) {
+    auto wake_name = fbl::StringPrintf("FutexContention/WakeNoWaiters/%uThreads", threads);
+    perftest::RegisterTest(wake_name.c_str(), FutexContentionTest<WakeNoWaiters>, threads);
+    auto wait_name = fbl::StringPrintf("FutexContention/WaitMismatch/%uThreads", threads);
+    perftest::RegisterTest(wait_name.c_str(), FutexContentionTest<WaitMismatch>, threads);
+  }
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
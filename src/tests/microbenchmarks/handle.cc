@@ -58,9 +58,54 @@ bool HandleValid(perftest::RepeatState* state, uint32_t num_threads) {
   return true;
 }
 
+// Helper function that will run in its own thread. Continuously duplicates and
+// closes handles to |event| until told to stop via a shared variable. This
+// takes the process's handle table lock for writing on every iteration.
+void DoHandleChurn(std::atomic<bool>* stop, zx::event* event) {
+  while (!stop->load(std::memory_order_relaxed)) {
+    zx::event dup;
+    ASSERT_OK(event->duplicate(ZX_RIGHT_SAME_RIGHTS, &dup));
+  }
+}
+
+// Measure how long looking up a handle in a syscall takes whilst other cores
+// are adding and removing handles in the same process. This is the pattern of
+// a multi-threaded server that is constantly receiving and closing handles,
+// and measures how much handle lookups are delayed by updates to the handle
+// table.
+//
+// The same restriction on the number of threads as for HandleValid applies.
+bool HandleLookupWithChurn(perftest::RepeatState* state, uint32_t num_threads) {
+  zx::event event;
+  ASSERT_OK(zx::event::create(0, &event));
+
+  std::atomic<bool> stop(false);
+
+  std::vector<std::thread> threads(num_threads - 1);
+
+  for (auto& t : threads) {
+    t = std::thread(&DoHandleChurn, &stop, &event);
+  }
+
+  while (state->KeepRunning()) {
+    ASSERT_OK(event.signal(0, ZX_USER_SIGNAL_0));
+  }
+
+  stop.store(true, std::memory_order_seq_cst);
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  return true;
+}
+
 void RegisterTests() {
   perftest::RegisterTest("HandleValid/1Threads", HandleValid, 1);
   perftest::RegisterTest("HandleValid/CpuCountThreads", HandleValid, zx_system_get_num_cpus());
+  perftest::RegisterTest("HandleLookupWithChurn/2Threads", HandleLookupWithChurn, 2);
+  perftest::RegisterTest("HandleLookupWithChurn/CpuCountThreads", HandleLookupWithChurn,
+                         zx_system_get_num_cpus());
 }
 PERFTEST_CTOR(RegisterTests)
 
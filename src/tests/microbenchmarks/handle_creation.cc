@@ -11,6 +11,12 @@
 #include <lib/zx/process.h>
 #include <lib/zx/thread.h>
 #include <lib/zx/vmar.h>
+#include <zircon/syscalls.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <perftest/perftest.h>
 
 namespace {
@@ -113,6 +119,44 @@ bool VmoCreateTest(perftest::RepeatState* state) {
   return true;
 }
 
+void CreateAndCloseChannel() {
+  zx::channel handle1;
+  zx::channel handle2;
+  ZX_ASSERT(zx::channel::create(0, &handle1, &handle2) == ZX_OK);
+}
+
+void CreateAndCloseEvent() {
+  zx::event handle;
+  ZX_ASSERT(zx::event::create(0, &handle) == ZX_OK);
+}
+
+// Measures the time taken to create and close an object while |num_threads| - 1
+// other threads do the same in a loop. This stresses the kernel's object
+// allocators under concurrent churn, rather than the uncontended fast path
+// covered by the tests above.
+template <void (*CreateAndClose)()>
+bool ChurnTest(perftest::RepeatState* state, uint32_t num_threads) {
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < num_threads; i++) {
+    threads.emplace_back([&stop] {
+      while (!stop.load(std::memory_order_relaxed)) {
+        CreateAndClose();
+      }
+    });
+  }
+
+  while (state->KeepRunning()) {
+    CreateAndClose();
+  }
+
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return true;
+}
+
 void RegisterTests() {
   perftest::RegisterTest("HandleCreate_Channel", ChannelCreateTest);
   perftest::RegisterTest("HandleCreate_Event", EventCreateTest);
@@ -121,6 +165,13 @@ void RegisterTests() {
   perftest::RegisterTest("HandleCreate_Port", PortCreateTest);
   perftest::RegisterTest("HandleCreate_Thread", ThreadCreateTest);
   perftest::RegisterTest("HandleCreate_Vmo", VmoCreateTest);
+
+  perftest::RegisterTest("HandleChurn_Channel/1Threads", ChurnTest<CreateAndCloseChannel>, 1);
+  perftest::RegisterTest("HandleChurn_Channel/CpuCountThreads", ChurnTest<CreateAndCloseChannel>,
+                         zx_system_get_num_cpus());
+  perftest::RegisterTest("HandleChurn_Event/1Threads", ChurnTest<CreateAndCloseEvent>, 1);
+  perftest::RegisterTest("HandleChurn_Event/CpuCountThreads", ChurnTest<CreateAndCloseEvent>,
+                         zx_system_get_num_cpus());
 }
 PERFTEST_CTOR(RegisterTests)
 
@@ -0,0 +1,101 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <zircon/assert.h>
+
+#include <memory>
+#include <vector>
+
+#include <fbl/intrusive_hash_table.h>
+#include <fbl/intrusive_single_list.h>
+#include <fbl/string_printf.h>
+#include <perftest/perftest.h>
+
+namespace {
+
+struct Obj : public fbl::SinglyLinkedListable<Obj*> {
+  size_t GetKey() const { return key; }
+  static size_t GetHash(size_t key) { return key * 0x9e3779b97f4a7c15; }
+  size_t key = 0;
+};
+
+using BucketType = fbl::SinglyLinkedList<Obj*>;
+using HashTableType = fbl::HashTable<size_t, Obj*, BucketType, size_t, fbl::kDynamicBucketCount>;
+
+// Tables which grow start out with this many buckets and double their bucket
+// count whenever they hold more than kMaxLoadFactor elements per bucket.
+constexpr size_t kInitialBucketCount = 16;
+constexpr size_t kMaxLoadFactor = 2;
+
+enum class Growth {
+  // The table is given enough buckets for every element up front.
+  kFixed,
+  // The table is resized, rehashing every element at once, when it fills up.
+  kEager,
+  // The table is resized incrementally, spreading the rehashing over the
+  // inserts which follow.
+  kIncremental,
+};
+
+std::unique_ptr<BucketType[]> MakeBuckets(size_t count) {
+  return std::unique_ptr<BucketType[]>(new BucketType[count]);
+}
+
+// Measure the time taken to fill a dynamically sized fbl::HashTable with
+// |count| elements, look each of them up, and then empty it again.
+bool HashTableTest(perftest::RepeatState* state, Growth growth, size_t count) {
+  state->DeclareStep("insert");
+  state->DeclareStep("find");
+  state->DeclareStep("clear");
+
+  std::vector<Obj> objs(count);
+  for (size_t i = 0; i < count; ++i) {
+    objs[i].key = i;
+  }
+
+  while (state->KeepRunning()) {
+    const size_t bucket_count =
+        (growth == Growth::kFixed) ? count / kMaxLoadFactor : kInitialBucketCount;
+    HashTableType table{MakeBuckets(bucket_count), bucket_count};
+    for (Obj& obj : objs) {
+      if (growth != Growth::kFixed && table.size() >= table.bucket_count() * kMaxLoadFactor) {
+        const size_t new_bucket_count = table.bucket_count() * 2;
+        table.Resize(MakeBuckets(new_bucket_count), new_bucket_count);
+        if (growth == Growth::kEager) {
+          table.FinishResize();
+        }
+      }
+      table.insert(&obj);
+    }
+    state->NextStep();
+
+    for (const Obj& obj : objs) {
+      ZX_ASSERT(table.find(obj.key).IsValid());
+    }
+    state->NextStep();
+
+    table.clear();
+  }
+  return true;
+}
+
+void RegisterTests() {
+  constexpr struct {
+    Growth growth;
+    const char* name;
+  } kGrowths[] = {
+      {Growth::kFixed, "Fixed"},
+      {Growth::kEager, "Eager"},
+      {Growth::kIncremental, "Incremental"},
+  };
+  for (const auto& [growth, name] : kGrowths) {
+    for (size_t count : {1024, 65536}) {
+      auto test_name = fbl::StringPrintf("HashTable/%s/%zu", name, count);
+      perftest::RegisterTest(test_name.c_str(), HashTableTest, growth, count);
+    }
+  }
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
@@ -10,9 +10,12 @@
 #include <zircon/types.h>
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include <fbl/algorithm.h>
+#include <fbl/string_printf.h>
 #include <perftest/perftest.h>
 
 #include "assert.h"
@@ -121,9 +124,59 @@ bool MmuMapUnmapWithFaultsTest(perftest::RepeatState* state) {
   return true;
 }
 
+// Maps |kSize| bytes into |helper|'s VMAR, optionally faults them in, and
+// unmaps them again.  This is one iteration of the two tests above.
+void MapFaultUnmap(Helper& helper, bool fault_in) {
+  const size_t kPageSize = zx_system_get_page_size();
+  ASSERT_OK(helper.MapInChunks(511 * KB(4), kSize, /* force_into_mmu */ !fault_in));
+  if (fault_in) {
+    auto p = reinterpret_cast<volatile uint8_t*>(helper.vmar_base);
+    for (size_t offset = 0; offset < kSize; offset += kPageSize) {
+      p[offset];
+    }
+  }
+  ASSERT_OK(helper.vmar.unmap(helper.vmar_base, kSize));
+}
+
+// Measure the time taken by one map, (optional) fault in and unmap cycle
+// while |num_threads| - 1 other threads do the same.  Every thread uses its
+// own VMAR and VMO, so the threads only share the process's address space.
+// Any slowdown as the thread count increases comes from the address space
+// lock and from TLB shootdowns to the other CPUs running the process.
+bool MmuMapUnmapContentionTest(perftest::RepeatState* state, bool fault_in,
+                               uint32_t num_threads) {
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < num_threads; i++) {
+    threads.emplace_back([&stop, fault_in] {
+      Helper helper;
+      while (!stop.load(std::memory_order_relaxed)) {
+        MapFaultUnmap(helper, fault_in);
+      }
+    });
+  }
+
+  Helper helper;
+  while (state->KeepRunning()) {
+    MapFaultUnmap(helper, fault_in);
+  }
+
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return true;
+}
+
 void RegisterTests() {
   perftest::RegisterTest("Mmu/MapUnmap", MmuMapUnmapTest);
   perftest::RegisterTest("Mmu/MapUnmapWithFaults", MmuMapUnmapWithFaultsTest);
+  for (uint32_t threads : {1, 2, 8}) {
+    auto name = fbl::StringPrintf("Mmu/MapUnmapContention/%uThreads", threads);
+    perftest::RegisterTest(name.c_str(), MmuMapUnmapContentionTest, false, threads);
+    auto faults_name = fbl::StringPrintf("Mmu/MapUnmapWithFaultsContention/%uThreads", threads);
+    perftest::RegisterTest(faults_name.c_str(), MmuMapUnmapContentionTest, true, threads);
+  }
 }
 PERFTEST_CTOR(RegisterTests)
 
@@ -5,6 +5,11 @@
 #include <lib/zx/port.h>
 #include <zircon/syscalls/port.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <fbl/string_printf.h>
 #include <perftest/perftest.h>
 
 #include "assert.h"
@@ -32,7 +37,52 @@ bool PortQueueWaitTest(perftest::RepeatState* state) {
   return true;
 }
 
-void RegisterTests() { perftest::RegisterTest("Port/QueueWait", PortQueueWaitTest); }
+// Measure the time taken to enqueue and then dequeue a packet from a port
+// while |num_threads| - 1 other threads do the same on the same port.  Each
+// thread queues a packet before it waits, so there is always a packet
+// available for every waiter and no thread blocks, but a thread may dequeue a
+// packet that another thread queued.  This measures how well the port's queue
+// scales when it is shared by the threads of a server.
+bool PortQueueWaitContentionTest(perftest::RepeatState* state, uint32_t num_threads) {
+  zx::port port;
+  ASSERT_OK(zx::port::create(0, &port));
+
+  auto queue_wait = [&port] {
+    zx_port_packet out_packet = {};
+    out_packet.type = ZX_PKT_TYPE_USER;
+    zx_port_packet in_packet;
+    ASSERT_OK(port.queue(&out_packet));
+    ASSERT_OK(port.wait(zx::time::infinite(), &in_packet));
+  };
+
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < num_threads; i++) {
+    threads.emplace_back([&stop, &queue_wait] {
+      while (!stop.load(std::memory_order_relaxed)) {
+        queue_wait();
+      }
+    });
+  }
+
+  while (state->KeepRunning()) {
+    queue_wait();
+  }
+
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return true;
+}
+
+void RegisterTests() {
+  perftest::RegisterTest("Port/QueueWait", PortQueueWaitTest);
+  for (uint32_t threads : {1, 2, 8, 32}) {
+    auto name = fbl::StringPrintf("Port/QueueWaitContention/%uThreads", threads);
+    perftest::RegisterTest(name.c_str(), PortQueueWaitContentionTest, threads);
+  }
+}
 PERFTEST_CTOR(RegisterTests)
 
 }  // namespace
@@ -0,0 +1,77 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <perftest/perftest.h>
+
+#include "src/lib/unwinder/memory.h"
+#include "src/lib/unwinder/module.h"
+#include "src/lib/unwinder/third_party/libunwindstack/context.h"
+#include "src/lib/unwinder/unwind.h"
+
+namespace {
+
+// Each run unwinds one stack that is at least this deep, so the number of stacks unwound per
+// second is the reciprocal of the per-run time.
+constexpr size_t kStackDepth = 32;
+
+std::vector<unwinder::Module> GetLocalModules(unwinder::Memory* memory) {
+  struct Context {
+    unwinder::Memory* memory;
+    std::vector<unwinder::Module> modules;
+  } context{memory, {}};
+  dl_iterate_phdr(
+      [](dl_phdr_info* info, size_t, void* p_context) {
+        auto context = reinterpret_cast<Context*>(p_context);
+        context->modules.emplace_back(info->dlpi_addr, context->memory,
+                                      unwinder::Module::AddressMode::kProcess);
+        return 0;
+      },
+      &context);
+  return context.modules;
+}
+
+// Unwinds the current stack on each run. With |reuse_unwinder|, one Unwinder is used for all of
+// the runs, as a profiler that keeps the unwinder for a process does, so the parsed CFI is cached
+// across unwinds. Otherwise each run starts from a fresh Unwinder.
+[[gnu::noinline]] bool UnwindStack(perftest::RepeatState* state, bool reuse_unwinder) {
+  unwinder::LocalMemory memory;
+  std::vector<unwinder::Module> modules = GetLocalModules(&memory);
+  unwinder::Registers registers = unwinder::GetContext();
+
+  unwinder::Unwinder reused(modules);
+  while (state->KeepRunning()) {
+    if (reuse_unwinder) {
+      reused.Unwind(&memory, registers, kStackDepth * 2);
+    } else {
+      unwinder::Unwinder(modules).Unwind(&memory, registers, kStackDepth * 2);
+    }
+  }
+  return true;
+}
+
+// Recurses |depth| frames before unwinding, so that the unwound stack has a known depth.
+[[gnu::noinline]] bool UnwindAtDepth(perftest::RepeatState* state, size_t depth,
+                                     bool reuse_unwinder) {
+  if (depth == 0) {
+    return UnwindStack(state, reuse_unwinder);
+  }
+  bool result = UnwindAtDepth(state, depth - 1, reuse_unwinder);
+  // Prevent a tail call so that each level keeps its frame.
+  __asm__ volatile("");
+  return result;
+}
+
+void RegisterTests() {
+  perftest::RegisterTest("Unwinder/LocalStack/Fresh", UnwindAtDepth, kStackDepth, false);
+  perftest::RegisterTest("Unwinder/LocalStack/Reused", UnwindAtDepth, kStackDepth, true);
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
@@ -0,0 +1,155 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <fidl/fuchsia.io/cpp/wire.h>
+#include <lib/async-loop/cpp/loop.h>
+#include <lib/async-loop/default.h>
+#include <lib/fdio/directory.h>
+#include <lib/zx/event.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fbl/ref_ptr.h>
+#include <fbl/string_printf.h>
+#include <perftest/perftest.h>
+
+#include "assert.h"
+#include "src/storage/lib/vfs/cpp/managed_vfs.h"
+#include "src/storage/lib/vfs/cpp/pseudo_dir.h"
+#include "src/storage/lib/vfs/cpp/pseudo_file.h"
+#include "util.h"
+
+namespace {
+
+namespace fio = fuchsia_io;
+
+constexpr size_t kFileCount = 64;
+constexpr size_t kOpsPerClient = 16;
+
+// Measures the throughput of opening and stat-ing files in a directory served by a ManagedVfs
+// whose dispatcher runs on |server_threads| threads. Each iteration has |client_threads| threads,
+// each with a connection of its own to the directory, open a file and query its attributes
+// |kOpsPerClient| times. With more server threads, requests of different connections can be
+// handled in parallel.
+class VfsOpenStat {
+ public:
+  VfsOpenStat(uint32_t server_threads, uint32_t client_threads)
+      : loop_(&kAsyncLoopConfigNoAttachToCurrentThread),
+        vfs_(loop_.dispatcher()),
+        names_(util::MakeDeterministicNamesList(kFileCount)),
+        clients_(client_threads) {
+    auto root = fbl::MakeRefCounted<fs::PseudoDir>();
+    for (const auto& name : names_) {
+      root->AddEntry(name, fbl::MakeRefCounted<fs::UnbufferedPseudoFile>());
+    }
+    for (uint32_t i = 0; i < server_threads; ++i) {
+      ASSERT_OK(loop_.StartThread("vfs-server"));
+    }
+    ASSERT_OK(zx::event::create(0, &ack_));
+    for (auto& client : clients_) {
+      auto [client_end, server_end] = fidl::Endpoints<fio::Directory>::Create();
+      ASSERT_OK(vfs_.ServeDirectory(root, std::move(server_end)));
+      client.root = std::move(client_end);
+      ASSERT_OK(zx::event::create(0, &client.event));
+    }
+    for (size_t i = 0; i < clients_.size(); ++i) {
+      clients_[i].thread = std::thread([this, i] { ClientLoop(i); });
+    }
+  }
+
+  ~VfsOpenStat() {
+    stop_.store(true, std::memory_order_relaxed);
+    for (auto& client : clients_) {
+      ASSERT_OK(client.event.signal(0, ZX_USER_SIGNAL_0));
+    }
+    for (auto& client : clients_) {
+      client.thread.join();
+    }
+    clients_.clear();
+
+    zx::event shutdown;
+    ASSERT_OK(zx::event::create(0, &shutdown));
+    vfs_.Shutdown([&shutdown](zx_status_t status) {
+      ASSERT_OK(status);
+      ASSERT_OK(shutdown.signal(0, ZX_USER_SIGNAL_0));
+    });
+    ASSERT_OK(shutdown.wait_one(ZX_USER_SIGNAL_0, zx::time::infinite(), nullptr));
+    loop_.Shutdown();
+  }
+
+  // Runs one batch of open/stat requests on every client and waits for all of them to finish.
+  void Run() {
+    remaining_.store(static_cast<uint32_t>(clients_.size()), std::memory_order_relaxed);
+    for (auto& client : clients_) {
+      ASSERT_OK(client.event.signal(0, ZX_USER_SIGNAL_0));
+    }
+    ASSERT_OK(ack_.wait_one(ZX_USER_SIGNAL_0, zx::time::infinite(), nullptr));
+    ASSERT_OK(ack_.signal(ZX_USER_SIGNAL_0, 0));
+  }
+
+ private:
+  struct Client {
+    fidl::ClientEnd<fio::Directory> root;
+    zx::event event;
+    std::thread thread;
+  };
+
+  void ClientLoop(size_t index) {
+    Client& client = clients_[index];
+    size_t next_name = index;
+    while (true) {
+      ASSERT_OK(client.event.wait_one(ZX_USER_SIGNAL_0, zx::time::infinite(), nullptr));
+      ASSERT_OK(client.event.signal(ZX_USER_SIGNAL_0, 0));
+      if (stop_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      for (size_t i = 0; i < kOpsPerClient; ++i) {
+        const std::string& name = names_[next_name++ % names_.size()];
+        auto [node, server_end] = fidl::Endpoints<fio::Node>::Create();
+        ASSERT_OK(fdio_open3_at(client.root.channel().get(), name.c_str(),
+                                static_cast<uint64_t>(fio::kPermReadable),
+                                server_end.TakeChannel().release()));
+        auto attrs = fidl::WireCall(node)->GetAttributes(fio::NodeAttributesQuery::kContentSize);
+        ASSERT_OK(attrs.status());
+      }
+      // The last client to finish signals the main thread.
+      if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ASSERT_OK(ack_.signal(0, ZX_USER_SIGNAL_0));
+      }
+    }
+  }
+
+  async::Loop loop_;
+  fs::ManagedVfs vfs_;
+  const std::vector<std::string> names_;
+  std::vector<Client> clients_;
+  zx::event ack_;
+  std::atomic<uint32_t> remaining_{0};
+  std::atomic<bool> stop_{false};
+};
+
+bool VfsOpenStatTest(perftest::RepeatState* state, uint32_t server_threads,
+                     uint32_t client_threads) {
+  VfsOpenStat test(server_threads, client_threads);
+  while (state->KeepRunning()) {
+    test.Run();
+  }
+  return true;
+}
+
+void RegisterTests() {
+  for (uint32_t server_threads : {1, 4}) {
+    for (uint32_t client_threads : {1, 4}) {
+      auto name = fbl::StringPrintf("Vfs/OpenStat/%uServerThreads/%uClientThreads", server_threads,
+                                    client_threads);
+      perftest::RegisterTest(name.c_str(), VfsOpenStatTest, server_threads, client_threads);
+    }
+  }
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
@@ -114,6 +114,48 @@ bool VmarDecommit(perftest::RepeatState* state, bool commit, uint32_t num_mappin
   return true;
 }
 
+// Measures the time taken to find a free spot for, map and unmap a non-specific mapping of
+// |map_pages| pages in a VMAR already containing |num_mappings| single page mappings. The existing
+// mappings are separated by single page gaps, followed by a free range at the end of the VMAR, so
+// that single page allocations have |num_mappings| candidate gaps to choose from whereas larger
+// allocations can only be satisfied by the trailing free range. |compact| selects between compact
+// and randomized placement within the VMAR.
+bool VmarMapInPopulatedVmar(perftest::RepeatState* state, bool compact, uint32_t num_mappings,
+                            uint32_t map_pages) {
+  const uint32_t page_size = zx_system_get_page_size();
+  const size_t populated_size = size_t{num_mappings} * 2 * page_size;
+  const size_t vmar_size = populated_size * 2;
+  zx::vmar vmar;
+  zx_vaddr_t addr = 0;
+  ASSERT_OK(zx::vmar::root_self()->allocate(ZX_VM_CAN_MAP_SPECIFIC | ZX_VM_CAN_MAP_READ |
+                                                ZX_VM_CAN_MAP_WRITE | (compact ? ZX_VM_COMPACT : 0),
+                                            0, vmar_size, &vmar, &addr));
+
+  const size_t map_size = size_t{map_pages} * page_size;
+  zx::vmo vmo;
+  ASSERT_OK(zx::vmo::create(map_size, 0, &vmo));
+
+  // Map every second page in the populated range. Every mapping uses the same VMO offset, so no
+  // two mappings can be merged even if they become adjacent.
+  for (uint32_t i = 0; i < num_mappings; i++) {
+    zx_vaddr_t map_addr;
+    const size_t vmar_offset = size_t{i} * 2 * page_size;
+    ASSERT_OK(vmar.map(ZX_VM_PERM_READ | ZX_VM_SPECIFIC, vmar_offset, vmo, 0, page_size,
+                       &map_addr));
+  }
+
+  state->DeclareStep("map");
+  state->DeclareStep("unmap");
+  while (state->KeepRunning()) {
+    zx_vaddr_t map_addr;
+    ASSERT_OK(vmar.map(ZX_VM_PERM_READ, 0, vmo, 0, map_size, &map_addr));
+    state->NextStep();
+    ASSERT_OK(vmar.unmap(map_addr, map_size));
+  }
+  vmar.destroy();
+  return true;
+}
+
 void RegisterTests() {
   for (unsigned total : {1, 16, 128}) {
     for (unsigned protect : {1, 16, 128}) {
@@ -138,6 +180,15 @@ void RegisterTests() {
       }
     }
   }
+  for (unsigned mappings : {1000, 100000}) {
+    for (unsigned pages : {1, 2}) {
+      for (bool compact : {true, false}) {
+        auto map_name = fbl::StringPrintf("Vmar/Map%s/%uMappings/%uPages",
+                                          compact ? "Compact" : "Random", mappings, pages);
+        perftest::RegisterTest(map_name.c_str(), VmarMapInPopulatedVmar, compact, mappings, pages);
+      }
+    }
+  }
 }
 PERFTEST_CTOR(RegisterTests)
 
@@ -0,0 +1,99 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <lib/zx/event.h>
+#include <zircon/syscalls.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <perftest/perftest.h>
+
+#include "assert.h"
+
+namespace {
+
+// Measures the time taken for a burst of wakeups to all be serviced. Each
+// iteration wakes |num_threads| blocked worker threads at once and waits until
+// the last of them has run, so the per-iteration time is the tail wakeup
+// latency of the burst. When the burst is larger than one CPU can service
+// promptly, this is dominated by how quickly idle CPUs pick up the threads that
+// were queued on busy ones.
+class WakeupBurst {
+ public:
+  explicit WakeupBurst(uint32_t num_threads) : workers_(num_threads) {
+    ASSERT_OK(zx::event::create(0, &ack_));
+    for (auto& worker : workers_) {
+      ASSERT_OK(zx::event::create(0, &worker.event));
+    }
+    for (auto& worker : workers_) {
+      worker.thread = std::thread([this, &worker] { WorkerLoop(worker.event); });
+    }
+  }
+
+  ~WakeupBurst() {
+    stop_.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+      ASSERT_OK(worker.event.signal(0, ZX_USER_SIGNAL_0));
+    }
+    for (auto& worker : workers_) {
+      worker.thread.join();
+    }
+  }
+
+  // Wakes every worker and waits for all of them to have run.
+  void Run() {
+    remaining_.store(static_cast<uint32_t>(workers_.size()), std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+      ASSERT_OK(worker.event.signal(0, ZX_USER_SIGNAL_0));
+    }
+    ASSERT_OK(ack_.wait_one(ZX_USER_SIGNAL_0, zx::time::infinite(), nullptr));
+    ASSERT_OK(ack_.signal(ZX_USER_SIGNAL_0, 0));
+  }
+
+ private:
+  struct Worker {
+    zx::event event;
+    std::thread thread;
+  };
+
+  void WorkerLoop(const zx::event& event) {
+    while (true) {
+      ASSERT_OK(event.wait_one(ZX_USER_SIGNAL_0, zx::time::infinite(), nullptr));
+      ASSERT_OK(event.signal(ZX_USER_SIGNAL_0, 0));
+      if (stop_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      // The last worker to run signals the main thread.
+      if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ASSERT_OK(ack_.signal(0, ZX_USER_SIGNAL_0));
+      }
+    }
+  }
+
+  std::vector<Worker> workers_;
+  zx::event ack_;
+  std::atomic<uint32_t> remaining_{0};
+  std::atomic<bool> stop_{false};
+};
+
+bool WakeupBurstTest(perftest::RepeatState* state, uint32_t num_threads) {
+  WakeupBurst burst(num_threads);
+  while (state->KeepRunning()) {
+    burst.Run();
+  }
+  return true;
+}
+
+void RegisterTests() {
+  perftest::RegisterTest("WakeupBurst/1Threads", WakeupBurstTest, 1);
+  perftest::RegisterTest("WakeupBurst/CpuCountThreads", WakeupBurstTest,
+                         zx_system_get_num_cpus());
+  perftest::RegisterTest("WakeupBurst/2xCpuCountThreads", WakeupBurstTest,
+                         2 * zx_system_get_num_cpus());
+}
+PERFTEST_CTOR(RegisterTests)
+
+}  // namespace
@@ -30,16 +30,6 @@ inline bool FieldFits(size_t report_len, const Attributes& attr) {
   return (attr.offset + attr.bit_sz) <= (report_len * 8);
 }
 
-// Extracts bits from a byte and returns them.
-// |begin| is the starting bit: it starts at 0 and counts from LSB to MSB.
-// The bits are placed at the beginning of return value.
-// Make sure when this is called that (|begin| + |count|) <= 8.
-// Example: ExtractBitsFromByte(1b00010100, 2, 3) returns 1b101.
-inline uint8_t ExtractBitsFromByte(uint8_t val, uint32_t begin, uint8_t count) {
-  uint8_t mask = static_cast<uint8_t>((0xFF >> (8 - count)) << begin);
-  return static_cast<uint8_t>((val & mask) >> begin);
-}
-
 // Create a mask of set bits of a given |size| starting at |start_bit|.
 // Eg. create_mask(2, 3) = 1b11100;
 constexpr uint32_t create_mask(uint32_t start_bit, uint32_t size) {
@@ -59,23 +49,24 @@ bool ExtractUint(const uint8_t* report, size_t report_len, const hid::Attributes
   if (!FieldFits(report_len, attr)) {
     return false;
   }
-  T val = 0;
-
-  const uint32_t start_bit = attr.offset;
-  const uint32_t end_bit = start_bit + attr.bit_sz;
-  uint32_t index_bit = attr.offset;
-  while (index_bit < end_bit) {
-    uint8_t bits_till_byte_end = static_cast<uint8_t>(8u - (index_bit % 8u));
-    uint8_t bit_count = static_cast<uint8_t>(MIN(bits_till_byte_end, end_bit - index_bit));
-
-    uint8_t extracted_bits = ExtractBitsFromByte(report[index_bit / 8u], index_bit % 8u, bit_count);
-
-    val = static_cast<T>(val | (extracted_bits << (index_bit - start_bit)));
+  if (attr.bit_sz == 0) {
+    *value_out = 0;
+    return true;
+  }
 
-    index_bit += bit_count;
+  // Fields are at most 32 bits, so a field spans at most 5 bytes. Gather those bytes into one
+  // little-endian word and extract the field with a single shift and mask, instead of masking
+  // and shifting each byte separately. This runs for every field of every report.
+  const uint32_t first_byte = attr.offset / 8u;
+  const uint32_t last_byte = (attr.offset + attr.bit_sz - 1) / 8u;
+  uint64_t word = 0;
+  for (uint32_t i = first_byte; i <= last_byte; i++) {
+    word |= static_cast<uint64_t>(report[i]) << ((i - first_byte) * 8u);
   }
+  word >>= attr.offset % 8u;
+  word &= (uint64_t{1} << attr.bit_sz) - 1;
 
-  *value_out = val;
+  *value_out = static_cast<T>(word);
   return true;
 }
 
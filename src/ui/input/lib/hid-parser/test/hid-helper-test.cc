@@ -247,6 +247,28 @@ TEST(HidParserHelperTest, ExtractTests) {
   EXPECT_FALSE(ret);
 }
 
+TEST(HidParserHelperTest, ExtractMatchesBitByBit) {
+  const uint8_t report[] = {0xA5, 0x3C, 0x96, 0x0F, 0xF0, 0x5A, 0xC3, 0x69};
+  const size_t report_len = sizeof(report);
+
+  for (uint32_t offset = 0; offset < report_len * 8; offset++) {
+    for (uint8_t bit_sz = 0; bit_sz <= 32 && offset + bit_sz <= report_len * 8; bit_sz++) {
+      uint32_t expected = 0;
+      for (uint32_t i = 0; i < bit_sz; i++) {
+        uint32_t bit = offset + i;
+        expected |= static_cast<uint32_t>((report[bit / 8] >> (bit % 8)) & 1) << i;
+      }
+
+      hid::Attributes attr = {};
+      attr.offset = offset;
+      attr.bit_sz = bit_sz;
+      uint32_t value = 0xdeadbeef;
+      ASSERT_TRUE(ExtractUint(report, report_len, attr, &value));
+      EXPECT_EQ(value, expected) << "offset " << offset << " bit_sz " << unsigned{bit_sz};
+    }
+  }
+}
+
 TEST(HidParserHelperTest, ExtractAsUnitTests) {
   uint8_t report[] = {0x0F, 10, 0x0F, 0x0F, 0x0F};
   size_t report_len = sizeof(report);
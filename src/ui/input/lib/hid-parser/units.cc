@@ -390,6 +390,12 @@ UnitType GetUnitTypeFromUnit(const Unit& unit) {
 }
 
 double ConvertValToUnitType(const Unit& unit_in, double val_in) {
+  // A unit without any measurement, e.g., for buttons and most usages that are not sensor values,
+  // cannot be converted to any of the defined units. Skip trying each of them.
+  if ((unit_in.type & ~system_mask) == 0) {
+    return val_in;
+  }
+
   double val_out;
 
   for (size_t i = 0; i < std::size(defined_units); i++) {
@@ -260,7 +260,8 @@ void RectangleCompositor::DrawBatch(CommandBuffer* cmd_buf,
                                     const std::vector<TexturePtr>& textures,
                                     const std::vector<ColorData>& color_data,
                                     const ImagePtr& output_image, const TexturePtr& depth_buffer,
-                                    bool apply_color_conversion) {
+                                    bool apply_color_conversion,
+                                    std::optional<vk::Rect2D> render_area) {
   TRACE_DURATION("gfx", "RectangleCompositor::DrawBatch");
   // TODO(https://fxbug.dev/42119564): Add custom clear colors. We could either pass in another
   // parameter to this function or try to embed clear-data into the existing api. For example, one
@@ -274,7 +275,15 @@ void RectangleCompositor::DrawBatch(CommandBuffer* cmd_buf,
 
   // Initialize the render pass.
   RenderPassInfo render_pass;
-  vk::Rect2D render_area = {{0, 0}, {output_image->width(), output_image->height()}};
+  if (render_area) {
+    FX_DCHECK(render_area->offset.x >= 0 && render_area->offset.y >= 0);
+    FX_DCHECK(static_cast<uint32_t>(render_area->offset.x) + render_area->extent.width <=
+              output_image->width());
+    FX_DCHECK(static_cast<uint32_t>(render_area->offset.y) + render_area->extent.height <=
+              output_image->height());
+  } else {
+    render_area = vk::Rect2D({0, 0}, {output_image->width(), output_image->height()});
+  }
 
   // Construct the bounds that are used in the vertex shader to convert the
   // renderable positions into normalized device coordinates (NDC). The width
@@ -287,7 +296,7 @@ void RectangleCompositor::DrawBatch(CommandBuffer* cmd_buf,
   // If we don't have any color conversion data, stick to a single subpass.
   if (!apply_color_conversion) {
     // Setup a standard 1-pass renderpass where we render directly into the output image.
-    if (!RenderPassInfo::InitRenderPassInfo(&render_pass, render_area, output_image,
+    if (!RenderPassInfo::InitRenderPassInfo(&render_pass, *render_area, output_image,
                                             depth_buffer)) {
       FX_LOGS(ERROR) << "RectangleCompositor::DrawBatch(): RenderPassInfo initialization failed. "
                         "Exiting.";
@@ -312,7 +321,7 @@ void RectangleCompositor::DrawBatch(CommandBuffer* cmd_buf,
     // we try to use a transient buffer to avoid flushing memory from GPU caches to GPU-external
     // memory) and then use that as an input attachment for the output pass, where we finally
     // apply color correction.
-    if (!SetupColorConversionDualPass(&render_pass, render_area, transient_image, output_image,
+    if (!SetupColorConversionDualPass(&render_pass, *render_area, transient_image, output_image,
                                       depth_buffer)) {
       FX_LOGS(ERROR) << "RectangleCompositor::DrawBatch(): RenderPassInfo initialization failed. "
                         "Exiting.";
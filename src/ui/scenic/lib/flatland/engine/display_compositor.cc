@@ -18,7 +18,9 @@
 #include <lib/trace/event.h>
 #include <zircon/status.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "fidl/fuchsia.hardware.display.types/cpp/common_types.h"
@@ -532,51 +534,135 @@ void DisplayCompositor::SetDisplayLayers(
       << "Failed to call FIDL SetDisplayLayers method: " << set_display_layers_result.error_value();
 }
 
-bool DisplayCompositor::SetRenderDataOnDisplay(const RenderData& data) {
-  FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
-  // Every rectangle should have an associated image.
-  const uint32_t num_images = static_cast<uint32_t>(data.images.size());
+DisplayCompositor::GpuCompositionReason DisplayCompositor::CanScanOut(const RenderData& data,
+                                                                      size_t index) const {
+  const allocation::ImageMetadata& image = data.images[index];
+  if (image.identifier != allocation::kInvalidImageId) {
+    const auto it = buffer_collection_supports_display_.find(image.collection_id);
+    return it != buffer_collection_supports_display_.end() && it->second
+               ? GpuCompositionReason::kNone
+               : GpuCompositionReason::kUnsupportedImage;
+  }
 
-  // Since we map 1 image to 1 layer, if there are more images than layers available for
-  // the given display, then they cannot be directly composited to the display in hardware.
-  const std::vector<fuchsia_hardware_display::LayerId>& layers =
-      display_engine_data_map_.at(data.display_id.value()).layers;
-  if (layers.size() < num_images) {
-    return false;
+  // TODO(https://fxbug.dev/42056054): Not all display hardware is able to handle color layers
+  // with specific sizes, which is required for doing solid-fill rects on the display path. Unless
+  // the rect is the backmost layer and fullscreen, it must be GPU-composited.
+  const ImageRect& rect = data.rectangles[index];
+  const glm::uvec2& display_size = display_info_map_.at(data.display_id.value()).dimensions;
+  if (index == 0 && rect.origin.x == 0 && rect.origin.y == 0 &&
+      rect.extent.x == static_cast<float>(display_size.x) &&
+      rect.extent.y == static_cast<float>(display_size.y)) {
+    return GpuCompositionReason::kNone;
   }
+  return GpuCompositionReason::kUnsupportedColorRect;
+}
 
-  // We only set as many layers as needed for the images we have.
-  SetDisplayLayers(data.display_id, std::vector<fuchsia_hardware_display::LayerId>(
-                                        layers.begin(), layers.begin() + num_images));
-
-  for (uint32_t i = 0; i < num_images; i++) {
-    const allocation::GlobalImageId image_id = data.images[i].identifier;
-    if (image_id != allocation::kInvalidImageId) {
-      if (buffer_collection_supports_display_[data.images[i].collection_id]) {
-        ApplyLayerImage(layers[i], data.rectangles[i], data.images[i],
-                        /*wait_id*/ kInvalidEventId,
-                        /*signal_id*/ kInvalidEventId);
-      } else {
-        return false;
+std::pair<size_t, DisplayCompositor::GpuCompositionReason> DisplayCompositor::AssignDisplayLayers(
+    const RenderData& data) const {
+  const size_t num_images = data.images.size();
+  const DisplayEngineData& display_engine_data =
+      display_engine_data_map_.at(data.display_id.value());
+  const size_t num_layers = display_engine_data.layers.size();
+
+  // Since we map 1 image to 1 layer, every image can be scanned out only if there are enough
+  // layers and the display supports each of them.
+  GpuCompositionReason reason =
+      num_images > num_layers ? GpuCompositionReason::kTooManyImages : GpuCompositionReason::kNone;
+  for (size_t i = 0; i < num_images && reason == GpuCompositionReason::kNone; ++i) {
+    reason = CanScanOut(data, i);
+  }
+  if (reason == GpuCompositionReason::kNone) {
+    return {0, reason};
+  }
+  if (display_engine_data.vmo_count == 0) {
+    return {num_images, GpuCompositionReason::kNoRenderTargets};
+  }
+
+  // Otherwise the bottom layer shows the GPU composition of the bottom images, and the layers above
+  // it scan out as many of the topmost images as they can, until one that the display can't take.
+  size_t gpu_image_count = num_images;
+  while (gpu_image_count > 0 && num_images - gpu_image_count + 2 <= num_layers &&
+         CanScanOut(data, gpu_image_count - 1) == GpuCompositionReason::kNone) {
+    --gpu_image_count;
+  }
+  FX_DCHECK(gpu_image_count > 0);
+  return {gpu_image_count, reason};
+}
+
+const allocation::ImageMetadata& DisplayCompositor::NextRenderTarget(
+    const DisplayEngineData& display_engine_data,
+    const std::vector<allocation::ImageMetadata>& images) const {
+  const auto& render_targets = renderer_->RequiresRenderInProtected(images)
+                                   ? display_engine_data.protected_render_targets
+                                   : display_engine_data.render_targets;
+  FX_DCHECK(display_engine_data.curr_vmo < render_targets.size())
+      << display_engine_data.curr_vmo << "/" << render_targets.size();
+  return render_targets[display_engine_data.curr_vmo];
+}
+
+void DisplayCompositor::AccumulateDamage(const RenderData& render_data) {
+  const auto it = display_engine_data_map_.find(render_data.display_id.value());
+  if (it == display_engine_data_map_.end()) {
+    return;
+  }
+  auto& display_engine_data = it->second;
+
+  if (!display_engine_data.previous_render_data) {
+    for (auto& damage : display_engine_data.render_target_damage) {
+      damage.reset();
+    }
+    for (auto& damage : display_engine_data.protected_render_target_damage) {
+      damage.reset();
+    }
+  } else {
+    const Damage frame_damage =
+        ComputeDamage(*display_engine_data.previous_render_data, render_data);
+    for (auto& damage : display_engine_data.render_target_damage) {
+      if (damage) {
+        damage->Add(frame_damage);
       }
-    } else {
-      // TODO(https://fxbug.dev/42056054): Not all display hardware is able to handle color layers
-      // with specific sizes, which is required for doing solid-fill rects on the display path. If
-      // we encounter one of those rects here -- unless it is the backmost layer and fullscreen
-      // -- then we abort.
-      const auto& rect = data.rectangles[i];
-      const glm::uvec2& display_size = display_info_map_[data.display_id.value()].dimensions;
-      if (i == 0 && rect.origin.x == 0 && rect.origin.y == 0 &&
-          rect.extent.x == static_cast<float>(display_size.x) &&
-          rect.extent.y == static_cast<float>(display_size.y)) {
-        ApplyLayerColor(layers[i], rect, data.images[i]);
-      } else {
-        return false;
+    }
+    for (auto& damage : display_engine_data.protected_render_target_damage) {
+      if (damage) {
+        damage->Add(frame_damage);
       }
     }
   }
+  display_engine_data.previous_render_data = render_data;
+}
+
+void DisplayCompositor::InvalidateRenderTargets() {
+  for (auto& [_, display_engine_data] : display_engine_data_map_) {
+    display_engine_data.previous_render_data.reset();
+  }
+}
 
-  return true;
+void DisplayCompositor::SetRenderDataOnDisplay(const RenderData& data, size_t gpu_image_count) {
+  FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
+  const size_t num_images = data.images.size();
+  FX_DCHECK(gpu_image_count <= num_images);
+
+  // The GPU-composited images, if any, share the bottom layer, and each of the others gets its own
+  // layer above it. We only set as many layers as needed for the images we have.
+  const std::vector<fuchsia_hardware_display::LayerId>& layers =
+      display_engine_data_map_.at(data.display_id.value()).layers;
+  const size_t first_direct_layer = gpu_image_count > 0 ? 1 : 0;
+  const size_t num_layers = first_direct_layer + num_images - gpu_image_count;
+  FX_DCHECK(num_layers <= layers.size());
+  SetDisplayLayers(data.display_id, std::vector<fuchsia_hardware_display::LayerId>(
+                                        layers.begin(), layers.begin() + num_layers));
+
+  for (size_t i = gpu_image_count; i < num_images; i++) {
+    const fuchsia_hardware_display::LayerId& layer =
+        layers[first_direct_layer + i - gpu_image_count];
+    if (data.images[i].identifier != allocation::kInvalidImageId) {
+      ApplyLayerImage(layer, data.rectangles[i], data.images[i],
+                      /*wait_id*/ kInvalidEventId,
+                      /*signal_id*/ kInvalidEventId);
+    } else {
+      ApplyLayerColor(layer, data.rectangles[i], data.images[i]);
+    }
+  }
 }
 
 void DisplayCompositor::ApplyLayerColor(const fuchsia_hardware_display::LayerId& layer_id,
@@ -752,6 +838,7 @@ fuchsia_hardware_display_types::ConfigStamp DisplayCompositor::ApplyConfig() {
 bool DisplayCompositor::PerformGpuComposition(const uint64_t frame_number,
                                               const zx::time presentation_time,
                                               const std::vector<RenderData>& render_data_list,
+                                              const std::vector<size_t>* gpu_image_counts,
                                               std::vector<zx::event> release_fences,
                                               scheduling::FramePresentedCallback callback) {
   TRACE_DURATION("gfx", "flatland::DisplayCompositor::PerformGpuComposition");
@@ -765,16 +852,35 @@ bool DisplayCompositor::PerformGpuComposition(const uint64_t frame_number,
   // every frame.
   zx::event render_finished_fence = utils::CreateEvent();
 
+  FX_DCHECK(!gpu_image_counts || gpu_image_counts->size() == render_data_list.size());
+  size_t final_display = render_data_list.size() - 1;
+  if (gpu_image_counts) {
+    final_display = 0;
+    for (size_t i = 0; i < render_data_list.size(); ++i) {
+      if ((*gpu_image_counts)[i] > 0) {
+        final_display = i;
+      }
+    }
+  }
+
   for (size_t i = 0; i < render_data_list.size(); ++i) {
-    const bool is_final_display = i == (render_data_list.size() - 1);
     const auto& render_data = render_data_list[i];
+    const size_t gpu_image_count =
+        gpu_image_counts ? (*gpu_image_counts)[i] : render_data.images.size();
+    // When only some of the images are GPU-composited, the display already scans out the others
+    // and applies color conversion to every layer, including ours.
+    const bool is_partial = gpu_image_counts != nullptr;
+    if (is_partial && gpu_image_count == 0) {
+      continue;
+    }
+    const bool is_final_display = i == final_display;
     const auto display_engine_data_it =
         display_engine_data_map_.find(render_data.display_id.value());
     FX_DCHECK(display_engine_data_it != display_engine_data_map_.end());
     auto& display_engine_data = display_engine_data_it->second;
 
     // Clear any past CC state here, before applying GPU CC.
-    if (cc_state_machine_.GpuRequiresDisplayClearing()) {
+    if (!is_partial && cc_state_machine_.GpuRequiresDisplayClearing()) {
       TRACE_DURATION("gfx", "flatland::DisplayCompositor::PerformGpuComposition[cc]");
       const fit::result<fidl::OneWayStatus> set_display_color_conversion_result =
           display_coordinator_->SetDisplayColorConversion(
@@ -793,23 +899,28 @@ bool DisplayCompositor::PerformGpuComposition(const uint64_t frame_number,
                        << render_data.display_id.value() << ".";
       return false;
     }
+    // Only the bottom |gpu_image_count| images are rendered.
+    std::vector<allocation::ImageMetadata> images(render_data.images.begin(),
+                                                  render_data.images.begin() + gpu_image_count);
+    const std::vector<ImageRect> rectangles(render_data.rectangles.begin(),
+                                            render_data.rectangles.begin() + gpu_image_count);
     const uint32_t curr_vmo = display_engine_data.curr_vmo;
+    const auto& render_target = NextRenderTarget(display_engine_data, images);
+    auto& damages = renderer_->RequiresRenderInProtected(images)
+                        ? display_engine_data.protected_render_target_damage
+                        : display_engine_data.render_target_damage;
+    FX_DCHECK(curr_vmo < damages.size()) << curr_vmo << "/" << damages.size();
+    auto& damage = damages[curr_vmo];
     display_engine_data.curr_vmo =
         (display_engine_data.curr_vmo + 1) % display_engine_data.vmo_count;
-    const auto& render_targets = renderer_->RequiresRenderInProtected(render_data.images)
-                                     ? display_engine_data.protected_render_targets
-                                     : display_engine_data.render_targets;
-    FX_DCHECK(curr_vmo < render_targets.size()) << curr_vmo << "/" << render_targets.size();
     FX_DCHECK(curr_vmo < display_engine_data.frame_event_datas.size())
         << curr_vmo << "/" << display_engine_data.frame_event_datas.size();
-    const auto& render_target = render_targets[curr_vmo];
 
     // Reset the event data.
     auto& event_data = display_engine_data.frame_event_datas[curr_vmo];
     event_data.wait_event.signal(ZX_EVENT_SIGNALED, 0);
 
     // Apply the debugging color to the images.
-    auto images = render_data.images;
     const uint8_t VISUAL_DEBUGGING_LEVEL_INFO_PLATFORM = 2;
     if (visual_debugging_level_ >= VISUAL_DEBUGGING_LEVEL_INFO_PLATFORM) {
       for (auto& image : images) {
@@ -820,22 +931,50 @@ bool DisplayCompositor::PerformGpuComposition(const uint64_t frame_number,
       }
     }
 
-    const auto apply_cc = (cc_state_machine_.GetDataToApply() != std::nullopt);
+    const auto apply_cc = !is_partial && (cc_state_machine_.GetDataToApply() != std::nullopt);
+    if (apply_cc != display_engine_data.applied_color_conversion) {
+      for (auto& target_damage : display_engine_data.render_target_damage) {
+        target_damage.reset();
+      }
+      for (auto& target_damage : display_engine_data.protected_render_target_damage) {
+        target_damage.reset();
+      }
+      display_engine_data.applied_color_conversion = apply_cc;
+    }
+
     std::vector<zx::event> render_fences;
     render_fences.push_back(std::move(event_data.wait_event));
     // Only add render_finished_fence if we're rendering the final display's framebuffer.
     if (is_final_display) {
       render_fences.push_back(std::move(render_finished_fence));
-      renderer_->Render(render_target, render_data.rectangles, images, render_fences, apply_cc);
-      // Retrieve fence.
-      render_finished_fence = std::move(render_fences.back());
+    }
+    // A render target that was last fully composited only needs what changed since rendered again.
+    // Partially composited frames leave out the scanned-out images, so those targets can't be
+    // reused.
+    if (!is_partial && damage) {
+      const ImageRect region = damage->empty()
+                                   ? ImageRect(glm::vec2(0), glm::vec2(0))
+                                   : ImageRect(damage->min, damage->max - damage->min);
+      renderer_->RenderRegion(render_target, rectangles, images, render_fences, apply_cc, region);
+    } else {
+      renderer_->Render(render_target, rectangles, images, render_fences, apply_cc);
+    }
+    if (is_partial) {
+      damage.reset();
     } else {
-      renderer_->Render(render_target, render_data.rectangles, images, render_fences, apply_cc);
+      damage = Damage{};
     }
 
-    // Retrieve fence.
+    // Retrieve fences.
+    if (is_final_display) {
+      render_finished_fence = std::move(render_fences.back());
+    }
     event_data.wait_event = std::move(render_fences[0]);
 
+    if (is_partial) {
+      continue;
+    }
+
     const fuchsia_hardware_display::LayerId layer = display_engine_data.layers[0];
     SetDisplayLayers(render_data.display_id, {layer});
     ApplyLayerImage(layer, {glm::vec2(0), glm::vec2(render_target.width, render_target.height)},
@@ -854,8 +993,14 @@ bool DisplayCompositor::PerformGpuComposition(const uint64_t frame_number,
 
   // See ReleaseFenceManager comments for details.
   FX_DCHECK(render_finished_fence);
-  release_fence_manager_.OnGpuCompositedFrame(frame_number, std::move(render_finished_fence),
-                                              std::move(release_fences), std::move(callback));
+  if (gpu_image_counts) {
+    release_fence_manager_.OnPartiallyGpuCompositedFrame(
+        frame_number, std::move(render_finished_fence), std::move(release_fences),
+        std::move(callback));
+  } else {
+    release_fence_manager_.OnGpuCompositedFrame(frame_number, std::move(render_finished_fence),
+                                                std::move(release_fences), std::move(callback));
+  }
   return true;
 }
 
@@ -867,12 +1012,28 @@ DisplayCompositor::RenderFrameResult DisplayCompositor::RenderFrame(
   TRACE_DURATION("gfx", "flatland::DisplayCompositor::RenderFrame");
   std::scoped_lock lock(lock_);
 
-  // Determine whether we need to fall back to GPU composition. Avoid calling CheckConfig() if we
-  // don't need to, because this requires a round-trip to the display coordinator.
+  for (const auto& render_data : render_data_list) {
+    AccumulateDamage(render_data);
+  }
+
+  // Determine whether we need to fall back to GPU composition for the whole frame. Avoid calling
+  // CheckConfig() if we don't need to, because this requires a round-trip to the display
+  // coordinator.
   // Note: TryDirectToDisplay() failing indicates hardware failure to do display composition.
-  const bool fallback_to_gpu_composition = !enable_display_composition_ ||
-                                           test_args.force_gpu_composition ||
-                                           !TryDirectToDisplay(render_data_list) || !CheckConfig();
+  std::vector<size_t> gpu_image_counts(render_data_list.size(), 0);
+  GpuCompositionReason reason = GpuCompositionReason::kNone;
+  bool fallback_to_gpu_composition = true;
+  if (!enable_display_composition_) {
+    reason = GpuCompositionReason::kDisplayCompositionDisabled;
+  } else if (test_args.force_gpu_composition) {
+    reason = GpuCompositionReason::kForcedByTest;
+  } else if (TryDirectToDisplay(render_data_list, gpu_image_counts, reason)) {
+    if (CheckConfig()) {
+      fallback_to_gpu_composition = false;
+    } else {
+      reason = GpuCompositionReason::kConfigRejected;
+    }
+  }
 
   if (fallback_to_gpu_composition) {
     // Discard only if we have attempted to TryDirectToDisplay() and have an unapplied config.
@@ -880,43 +1041,94 @@ DisplayCompositor::RenderFrameResult DisplayCompositor::RenderFrame(
     if (enable_display_composition_) {
       DiscardConfig();
     }
+  }
 
+  size_t gpu_image_count = 0;
+  size_t image_count = 0;
+  for (size_t i = 0; i < render_data_list.size(); ++i) {
+    const size_t display_image_count = render_data_list[i].images.size();
+    gpu_image_count += fallback_to_gpu_composition ? display_image_count : gpu_image_counts[i];
+    image_count += display_image_count;
+  }
+  const bool uses_gpu = fallback_to_gpu_composition || gpu_image_count > 0;
+
+  if (uses_gpu) {
+    TRACE_INSTANT("gfx", "flatland::DisplayCompositor::GpuComposition", TRACE_SCOPE_PROCESS,
+                  "frame_number", frame_number, "reason",
+                  TA_STRING(GpuCompositionReasonName(reason)), "gpu_images", gpu_image_count,
+                  "direct_images", image_count - gpu_image_count);
+    // Only pass the per-display counts when some images are scanned out.
     if (!PerformGpuComposition(frame_number, presentation_time, render_data_list,
+                               fallback_to_gpu_composition ? nullptr : &gpu_image_counts,
                                std::move(release_fences), std::move(callback))) {
       return RenderFrameResult::kFailure;
     }
-  } else {
+  }
+
+  if (!fallback_to_gpu_composition) {
     // CC was successfully applied to the config so we update the state machine.
     cc_state_machine_.SetApplyConfigSucceeded();
 
-    // See ReleaseFenceManager comments for details.
-    release_fence_manager_.OnDirectScanoutFrame(frame_number, std::move(release_fences),
-                                                std::move(callback));
+    if (!uses_gpu) {
+      // See ReleaseFenceManager comments for details.
+      release_fence_manager_.OnDirectScanoutFrame(frame_number, std::move(release_fences),
+                                                  std::move(callback));
+    }
   }
 
   const fuchsia_hardware_display_types::ConfigStamp config_stamp = ApplyConfig();
   pending_apply_configs_.push_back({.config_stamp = config_stamp, .frame_number = frame_number});
 
-  return fallback_to_gpu_composition ? RenderFrameResult::kGpuComposition
-                                     : RenderFrameResult::kDirectToDisplay;
+  return uses_gpu ? RenderFrameResult::kGpuComposition : RenderFrameResult::kDirectToDisplay;
 }
 
-bool DisplayCompositor::TryDirectToDisplay(const std::vector<RenderData>& render_data_list) {
+bool DisplayCompositor::TryDirectToDisplay(const std::vector<RenderData>& render_data_list,
+                                           std::vector<size_t>& gpu_image_counts,
+                                           GpuCompositionReason& reason) {
   FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
   FX_DCHECK(enable_display_composition_);
+  FX_DCHECK(gpu_image_counts.size() == render_data_list.size());
 
   // TODO(https://fxbug.dev/377979329): re-enable direct-to-display once we have relaxed the display
   // coordinator's restrictions on image reuse.
+  reason = GpuCompositionReason::kDirectToDisplayDisabled;
   return false;
 
-  for (const auto& data : render_data_list) {
-    if (!SetRenderDataOnDisplay(data)) {
-      // TODO(https://fxbug.dev/42157429): just because setting the data on one display fails (e.g.
-      // due to too many layers), that doesn't mean that all displays need to use GPU-composition.
-      // Some day we might want to use GPU-composition for some client images, and direct-scanout
-      // for others.
+  // Assign layers for every display first: if any display needs all of its images GPU-composited,
+  // the whole frame is, so that color conversion is applied in one place for all of them.
+  reason = GpuCompositionReason::kNone;
+  for (size_t i = 0; i < render_data_list.size(); ++i) {
+    const auto [gpu_image_count, display_reason] = AssignDisplayLayers(render_data_list[i]);
+    gpu_image_counts[i] = gpu_image_count;
+    if (reason == GpuCompositionReason::kNone) {
+      reason = display_reason;
+    }
+    if (gpu_image_count > 0 && gpu_image_count == render_data_list[i].images.size()) {
+      reason = display_reason;
       return false;
     }
+  }
+
+  for (size_t i = 0; i < render_data_list.size(); ++i) {
+    const auto& data = render_data_list[i];
+    const size_t gpu_image_count = gpu_image_counts[i];
+    SetRenderDataOnDisplay(data, gpu_image_count);
+
+    // Put the render target that PerformGpuComposition() will render the bottom images into on the
+    // bottom layer now, so that CheckConfig() covers the final config.
+    if (gpu_image_count > 0) {
+      const DisplayEngineData& display_engine_data =
+          display_engine_data_map_.at(data.display_id.value());
+      const std::vector<allocation::ImageMetadata> images(
+          data.images.begin(), data.images.begin() + gpu_image_count);
+      const allocation::ImageMetadata& render_target =
+          NextRenderTarget(display_engine_data, images);
+      ApplyLayerImage(display_engine_data.layers[0],
+                      {glm::vec2(0), glm::vec2(render_target.width, render_target.height)},
+                      render_target,
+                      display_engine_data.frame_event_datas[display_engine_data.curr_vmo].wait_id,
+                      /*signal_id*/ kInvalidEventId);
+    }
 
     // Check the state machine to see if there's any CC data to apply.
     if (const auto cc_data = cc_state_machine_.GetDataToApply()) {
@@ -937,6 +1149,30 @@ bool DisplayCompositor::TryDirectToDisplay(const std::vector<RenderData>& render
   return true;
 }
 
+// static
+const char* DisplayCompositor::GpuCompositionReasonName(GpuCompositionReason reason) {
+  switch (reason) {
+    case GpuCompositionReason::kNone:
+      return "none";
+    case GpuCompositionReason::kDisplayCompositionDisabled:
+      return "display_composition_disabled";
+    case GpuCompositionReason::kForcedByTest:
+      return "forced_by_test";
+    case GpuCompositionReason::kDirectToDisplayDisabled:
+      return "direct_to_display_disabled";
+    case GpuCompositionReason::kTooManyImages:
+      return "too_many_images";
+    case GpuCompositionReason::kUnsupportedImage:
+      return "unsupported_image";
+    case GpuCompositionReason::kUnsupportedColorRect:
+      return "unsupported_color_rect";
+    case GpuCompositionReason::kNoRenderTargets:
+      return "no_render_targets";
+    case GpuCompositionReason::kConfigRejected:
+      return "config_rejected";
+  }
+}
+
 void DisplayCompositor::OnVsync(zx::time timestamp,
                                 fuchsia_hardware_display_types::ConfigStamp applied_config_stamp) {
   FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
@@ -1046,6 +1282,8 @@ void DisplayCompositor::AddDisplay(scenic_impl::display::Display* display, const
   }
   display_engine_data.vmo_count = num_render_targets;
   display_engine_data.curr_vmo = 0;
+  display_engine_data.render_target_damage.resize(num_render_targets);
+  display_engine_data.protected_render_target_damage.resize(num_render_targets);
 
   // Create another set of tokens and allocate a protected render target. Protected memory buffer
   // pool is usually limited, so it is better for Scenic to preallocate to avoid being blocked by
@@ -1065,6 +1303,7 @@ void DisplayCompositor::SetColorConversionValues(const std::array<float, 9>& coe
       {.coefficients = coefficients, .preoffsets = preoffsets, .postoffsets = postoffsets});
 
   renderer_->SetColorConversionValues(coefficients, preoffsets, postoffsets);
+  InvalidateRenderTargets();
 }
 
 bool DisplayCompositor::SetMinimumRgb(const uint8_t minimum_rgb) {
@@ -15,6 +15,7 @@
 #include <deque>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 #include "lib/fidl/cpp/wire/internal/transport_channel.h"
 #include "src/lib/fxl/synchronization/thread_annotations.h"
@@ -159,6 +160,21 @@ class DisplayCompositor final : public allocation::BufferCollectionImporter,
     zx::event wait_event;
   };
 
+  // Why some or all of a frame's images were composited on the GPU, rather than each being scanned
+  // out on its own display layer. Reported in a trace event for every frame that uses the GPU.
+  enum class GpuCompositionReason {
+    kNone,
+    kDisplayCompositionDisabled,
+    kForcedByTest,
+    kDirectToDisplayDisabled,
+    kTooManyImages,
+    kUnsupportedImage,
+    kUnsupportedColorRect,
+    kNoRenderTargets,
+    kConfigRejected,
+  };
+  static const char* GpuCompositionReasonName(GpuCompositionReason reason);
+
   struct DisplayEngineData {
     // The hardware layers we've created to use on this display.
     std::vector<fuchsia_hardware_display::LayerId> layers;
@@ -178,6 +194,18 @@ class DisplayCompositor final : public allocation::BufferCollectionImporter,
 
     // Used to synchronize buffer rendering with setting the buffer on the display.
     std::vector<FrameEventData> frame_event_datas;
+
+    // The render data of the previous frame, to compute what changed in the current one.
+    std::optional<RenderData> previous_render_data;
+
+    // For each of |render_targets| and |protected_render_targets|, the area that changed since it
+    // was last fully GPU-composited with the same color conversion, or std::nullopt if its contents
+    // can't be reused at all.
+    std::vector<std::optional<Damage>> render_target_damage;
+    std::vector<std::optional<Damage>> protected_render_target_damage;
+
+    // Whether GPU composition last applied color conversion on this display.
+    bool applied_color_conversion = false;
   };
 
   // Notifies the compositor that a vsync has occurred, in response to a display configuration
@@ -205,21 +233,56 @@ class DisplayCompositor final : public allocation::BufferCollectionImporter,
   fuchsia::sysmem2::BufferCollectionSyncPtr TakeDisplayBufferCollectionPtr(
       allocation::GlobalBufferCollectionId collection_id) FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
-  // Used when we're forced to fall back to GPU rendering.
+  // Used when we're forced to fall back to GPU rendering. If |gpu_image_counts| is null, all of the
+  // images of every display are rendered and the result is put on each display's only layer.
+  // Otherwise only the first |(*gpu_image_counts)[i]| images of |render_data_list[i]| are, and
+  // TryDirectToDisplay() has already put the render target on the bottom layer and the rest of the
+  // images on the layers above it, leaving color conversion to the display.
   bool PerformGpuComposition(uint64_t frame_number, zx::time presentation_time,
                              const std::vector<RenderData>& render_data_list,
+                             const std::vector<size_t>* gpu_image_counts,
                              std::vector<zx::event> release_fences,
                              scheduling::FramePresentedCallback callback)
       FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
+  // Returns kNone if the image at |index| in |data| can be scanned out on its own layer, or
+  // otherwise the reason it can't.
+  GpuCompositionReason CanScanOut(const RenderData& data, size_t index) const
+      FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Returns how many of the bottom images of |data| must be GPU-composited into the bottom layer so
+  // that the display's remaining layers can scan out the rest, which is 0 if every image can be
+  // scanned out, along with the reason the images can't all be scanned out.
+  std::pair<size_t, GpuCompositionReason> AssignDisplayLayers(const RenderData& data) const
+      FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // Returns the render target that the next GPU composition of |images| on the display renders
+  // into. |display_engine_data| must have render targets.
+  const allocation::ImageMetadata& NextRenderTarget(
+      const DisplayEngineData& display_engine_data,
+      const std::vector<allocation::ImageMetadata>& images) const;
+
+  // Adds what changed in |render_data| since the previous frame on its display to the damage of
+  // every render target of that display.
+  void AccumulateDamage(const RenderData& render_data);
+
+  // Forgets the contents of every render target of every display, so that each is fully rendered
+  // the next time it is used.
+  void InvalidateRenderTargets();
+
   // Does all the setup for applying the render data, which includes images and rectangles,
-  // onto the display via the display coordinator interface. Returns false if this cannot
-  // be completed.
-  bool SetRenderDataOnDisplay(const RenderData& data) FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // onto the display via the display coordinator interface. The first |gpu_image_count| images
+  // are skipped; if there are any, the bottom layer is left for their GPU composition.
+  void SetRenderDataOnDisplay(const RenderData& data, size_t gpu_image_count)
+      FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
-  // Calls SetRenderData for each item in |render_data_list| and applies direct-to-display color
-  // conversion. Return false if this fails for any RenderData.
-  bool TryDirectToDisplay(const std::vector<RenderData>& render_data_list)
+  // Assigns the images of each item in |render_data_list| to display layers, GPU-compositing the
+  // bottom |gpu_image_counts[i]| of them into one layer where the display can't take them all, and
+  // applies direct-to-display color conversion. Returns false, and the reason in |reason|, if any
+  // display needs all of its images GPU-composited; in that case the whole frame is. Otherwise
+  // |reason| is why any images that still need the GPU do, or kNone.
+  bool TryDirectToDisplay(const std::vector<RenderData>& render_data_list,
+                          std::vector<size_t>& gpu_image_counts, GpuCompositionReason& reason)
       FXL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
   // Sets the provided layers onto the display referenced by the given display_id.
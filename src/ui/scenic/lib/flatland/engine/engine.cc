@@ -66,7 +66,7 @@ void Engine::InitializeInspectObjects() {
 
     const SceneState scene_state(*this, *root_transform);
     std::ostringstream output;
-    DumpScene(scene_state.snapshot, scene_state.topology_data, scene_state.images,
+    DumpScene(scene_state.snapshot, *scene_state.topology_data, scene_state.images,
               scene_state.image_indices, scene_state.image_rectangles, output);
     inspector.GetRoot().CreateString(kSceneDump, output.str(), &inspector);
     return fpromise::make_ok_promise(std::move(inspector));
@@ -82,17 +82,18 @@ void Engine::RenderScheduledFrame(uint64_t frame_number, zx::time presentation_t
                  presentation_time.get());
   TRACE_FLOW_STEP("gfx", "scenic_frame", frame_number);
 
-  SceneState scene_state(*this, display.root_transform());
+  SceneState scene_state(*this, display.root_transform(), &topology_cache_);
   scenic_impl::display::Display* const hw_display = display.display();
 
 #if defined(USE_FLATLAND_VERBOSE_LOGGING)
   std::ostringstream str;
   str << "Engine::RenderScheduledFrame()\n"
-      << "Root transform of global topology: " << scene_state.topology_data.topology_vector[0]
+      << "Root transform of global topology: " << scene_state.topology_data->topology_vector[0]
       << "\nTopologically-sorted transforms and their corresponding parent transforms:";
-  for (size_t i = 1; i < scene_state.topology_data.topology_vector.size(); ++i) {
-    str << "\n        " << scene_state.topology_data.topology_vector[i] << " -> "
-        << scene_state.topology_data.topology_vector[scene_state.topology_data.parent_indices[i]];
+  const auto& topology_data = *scene_state.topology_data;
+  for (size_t i = 1; i < topology_data.topology_vector.size(); ++i) {
+    str << "\n        " << topology_data.topology_vector[i] << " -> "
+        << topology_data.topology_vector[topology_data.parent_indices[i]];
   }
   str << "\nFrame display-list contains " << scene_state.image_rectangles.size()
       << " image-rectangles and " << scene_state.images.size() << " images.";
@@ -105,8 +106,8 @@ void Engine::RenderScheduledFrame(uint64_t frame_number, zx::time presentation_t
   FLATLAND_VERBOSE_LOG << str.str();
 #endif
 
-  link_system_->UpdateLinks(scene_state.topology_data.topology_vector,
-                            scene_state.topology_data.live_handles, scene_state.global_matrices,
+  link_system_->UpdateLinks(scene_state.topology_data->topology_vector,
+                            scene_state.topology_data->live_handles, scene_state.global_matrices,
                             hw_display->device_pixel_ratio(), scene_state.snapshot);
 
   // TODO(https://fxbug.dev/42156567): hack!  need a better place to call AddDisplay().
@@ -129,6 +130,11 @@ void Engine::RenderScheduledFrame(uint64_t frame_number, zx::time presentation_t
 
   {
     TRACE_DURATION("gfx", "flatland::Engine::RenderScheduledFrame[move topology_data]");
+    topology_cache_ = TopologyCache{.root_transform = display.root_transform(),
+                                    .snapshot = std::move(scene_state.snapshot),
+                                    .links = std::move(scene_state.links),
+                                    .topology_data = scene_state.topology_data,
+                                    .global_matrices = std::move(scene_state.global_matrices)};
     last_global_topology_data_ = std::move(scene_state.topology_data);
   }
 
@@ -146,7 +152,8 @@ void Engine::RenderScheduledFrame(uint64_t frame_number, zx::time presentation_t
   flatland_compositor_->RenderFrame(frame_number, presentation_time,
                                     {{.rectangles = std::move(scene_state.image_rectangles),
                                       .images = std::move(scene_state.images),
-                                      .display_id = hw_display->display_id()}},
+                                      .display_id = hw_display->display_id(),
+                                      .updated_images = std::move(scene_state.updated_images)}},
                                     flatland_presenter_->TakeReleaseFences(), std::move(callback));
 }
 
@@ -155,7 +162,7 @@ view_tree::SubtreeSnapshot Engine::GenerateViewTreeSnapshot(
   TRACE_DURATION("gfx", "flatland::Engine::GenerateViewTreeSnapshot");
   const auto uber_struct_snapshot = uber_struct_system_->Snapshot();
   const auto link_child_to_parent_transform_map = link_system_->GetLinkChildToParentTransformMap();
-  const auto& topology_data = last_global_topology_data_;
+  const auto& topology_data = *last_global_topology_data_;
 
   const auto matrix_vector = ComputeGlobalMatrices(
       topology_data.topology_vector, topology_data.parent_indices, uber_struct_snapshot);
@@ -184,33 +191,69 @@ Renderables Engine::GetRenderables(const FlatlandDisplay& display) {
   return std::make_pair(std::move(scene_state.image_rectangles), std::move(scene_state.images));
 }
 
-Engine::SceneState::SceneState(Engine& engine, TransformHandle root_transform) {
+Engine::SceneState::SceneState(Engine& engine, TransformHandle root_transform,
+                               std::optional<TopologyCache>* topology_cache) {
   TRACE_DURATION("gfx", "flatland::Engine::SceneState");
   snapshot = engine.uber_struct_system_->Snapshot();
 
-  const auto links = engine.link_system_->GetResolvedTopologyLinks();
+  links = engine.link_system_->GetResolvedTopologyLinks();
   const auto link_system_id = engine.link_system_->GetInstanceId();
 
-  topology_data = GlobalTopologyData::ComputeGlobalTopologyData(snapshot, links, link_system_id,
-                                                                root_transform);
-  global_matrices =
-      ComputeGlobalMatrices(topology_data.topology_vector, topology_data.parent_indices, snapshot);
+  // Most frames only change content within Views, not the shape of the scene, so reuse the last
+  // frame's topology when none of its inputs changed, and only update the global matrices of the
+  // transforms that moved.
+  std::optional<TopologyCache> cache;
+  if (topology_cache) {
+    cache = std::move(*topology_cache);
+    topology_cache->reset();
+  }
+  if (cache && cache->root_transform == root_transform &&
+      GlobalTopologyData::IsTopologyUnchanged(cache->snapshot, cache->links, snapshot, links)) {
+    topology_data = std::move(cache->topology_data);
+    global_matrices =
+        ComputeGlobalMatrices(topology_data->topology_vector, topology_data->parent_indices,
+                              snapshot, cache->snapshot, std::move(cache->global_matrices));
+  } else {
+    topology_data = std::make_shared<const GlobalTopologyData>(
+        GlobalTopologyData::ComputeGlobalTopologyData(snapshot, links, link_system_id,
+                                                      root_transform));
+    global_matrices = ComputeGlobalMatrices(topology_data->topology_vector,
+                                            topology_data->parent_indices, snapshot);
+  }
 
-  auto [indices, im] =
-      ComputeGlobalImageData(topology_data.topology_vector, topology_data.parent_indices, snapshot);
+  auto [indices, im] = ComputeGlobalImageData(topology_data->topology_vector,
+                                              topology_data->parent_indices, snapshot);
   this->image_indices = std::move(indices);
   this->images = std::move(im);
 
   const auto global_image_sample_regions = ComputeGlobalImageSampleRegions(
-      topology_data.topology_vector, topology_data.parent_indices, snapshot);
+      topology_data->topology_vector, topology_data->parent_indices, snapshot);
 
   const auto global_clip_regions = ComputeGlobalTransformClipRegions(
-      topology_data.topology_vector, topology_data.parent_indices, global_matrices, snapshot);
+      topology_data->topology_vector, topology_data->parent_indices, global_matrices, snapshot);
 
   image_rectangles =
       ComputeGlobalRectangles(FilterByIndices(global_matrices, image_indices),
                               FilterByIndices(global_image_sample_regions, image_indices),
                               FilterByIndices(global_clip_regions, image_indices), images);
+
+  // An instance whose UberStruct is the one of the last frame hasn't presented since, so none of
+  // its images can have new contents. The cache is only comparable if it was filled for the same
+  // display, i.e. the same root transform.
+  if (cache && cache->root_transform == root_transform) {
+    updated_images.emplace();
+    for (const auto& [instance_id, uber_struct] : snapshot) {
+      const auto previous = cache->snapshot.find(instance_id);
+      if (previous != cache->snapshot.end() && previous->second == uber_struct) {
+        continue;
+      }
+      for (const auto& [_, image] : uber_struct->images) {
+        if (image.identifier != allocation::kInvalidImageId) {
+          updated_images->insert(image.identifier);
+        }
+      }
+    }
+  }
 }
 
 void Engine::SkipRender(scheduling::FramePresentedCallback callback) {
@@ -12,8 +12,10 @@
 // TODO(https://fxbug.dev/42156567): delete when we delete hack_seen_display_id_values_.
 #include <lib/fit/function.h>
 
+#include <memory>
 #include <optional>
 #include <set>
+#include <unordered_set>
 #include <utility>
 
 #include "src/ui/scenic/lib/flatland/engine/display_compositor.h"
@@ -64,15 +66,31 @@ class Engine {
   // Initialize all inspect::Nodes, so that the Engine state can be observed.
   void InitializeInspectObjects();
 
+  // The inputs and results of the last frame's topology and matrix computations, so that the next
+  // frame can reuse them when its topology hasn't changed.
+  struct TopologyCache {
+    TransformHandle root_transform;
+    UberStruct::InstanceMap snapshot;
+    GlobalTopologyData::LinkTopologyMap links;
+    std::shared_ptr<const flatland::GlobalTopologyData> topology_data;
+    flatland::GlobalMatrixVector global_matrices;
+  };
+
   struct SceneState {
     UberStruct::InstanceMap snapshot;
-    flatland::GlobalTopologyData topology_data;
+    GlobalTopologyData::LinkTopologyMap links;
+    std::shared_ptr<const flatland::GlobalTopologyData> topology_data;
     flatland::GlobalMatrixVector global_matrices;
     flatland::GlobalImageVector images;
     flatland::GlobalIndexVector image_indices;
     flatland::GlobalRectangleVector image_rectangles;
+    // The images of the instances that presented since |topology_cache| was filled, or std::nullopt
+    // if there was no usable cache.
+    std::optional<std::unordered_set<allocation::GlobalImageId>> updated_images;
 
-    SceneState(Engine& engine, TransformHandle root_transform);
+    // If |topology_cache| is set, its contents are taken and reused where still valid.
+    SceneState(Engine& engine, TransformHandle root_transform,
+               std::optional<TopologyCache>* topology_cache = nullptr);
   };
 
   std::shared_ptr<flatland::DisplayCompositor> flatland_compositor_;
@@ -80,7 +98,11 @@ class Engine {
   std::shared_ptr<flatland::UberStructSystem> uber_struct_system_;
   std::shared_ptr<flatland::LinkSystem> link_system_;
 
-  flatland::GlobalTopologyData last_global_topology_data_ = {};
+  std::shared_ptr<const flatland::GlobalTopologyData> last_global_topology_data_ =
+      std::make_shared<const flatland::GlobalTopologyData>();
+
+  // Only used by RenderScheduledFrame().
+  std::optional<TopologyCache> topology_cache_;
 
   bool first_frame_with_image_is_rendered_ = false;
 
@@ -8,11 +8,25 @@
 #include <fidl/fuchsia.math/cpp/fidl.h>
 #include <lib/syslog/cpp/macros.h>
 
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
 namespace {
 
 using fuchsia::ui::composition::Orientation;
 using fuchsia_ui_composition::ImageFlip;
 
+// Unlike ImageRect::operator==(), any difference in geometry counts, since it may change pixels.
+bool SameGeometry(const flatland::ImageRect& a, const flatland::ImageRect& b) {
+  return a.origin == b.origin && a.extent == b.extent && a.orientation == b.orientation &&
+         a.texel_uvs == b.texel_uvs;
+}
+
+bool SameImage(const allocation::ImageMetadata& a, const allocation::ImageMetadata& b) {
+  return a.identifier == b.identifier && a == b && a.flip == b.flip;
+}
+
 }  // namespace
 namespace flatland {
 
@@ -92,4 +106,46 @@ fuchsia_hardware_display_types::CoordinateTransformation GetDisplayTransformFrom
   FX_NOTREACHED();
 }
 
+void Damage::Add(const ImageRect& rect) {
+  min = glm::min(min, glm::min(rect.origin, rect.origin + rect.extent));
+  max = glm::max(max, glm::max(rect.origin, rect.origin + rect.extent));
+}
+
+void Damage::Add(const Damage& other) {
+  if (!other.empty()) {
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+  }
+}
+
+Damage ComputeDamage(const RenderData& previous, const RenderData& data) {
+  FX_DCHECK(previous.rectangles.size() == previous.images.size());
+  FX_DCHECK(data.rectangles.size() == data.images.size());
+
+  // Outside of the damage, every pixel is covered by the same stack of rectangles, with the same
+  // images, in both frames, so it renders the same.
+  Damage damage;
+  const size_t count = std::max(previous.rectangles.size(), data.rectangles.size());
+  for (size_t i = 0; i < count; ++i) {
+    if (i >= data.rectangles.size()) {
+      damage.Add(previous.rectangles[i]);
+      continue;
+    }
+    if (i >= previous.rectangles.size()) {
+      damage.Add(data.rectangles[i]);
+      continue;
+    }
+
+    const allocation::ImageMetadata& image = data.images[i];
+    const allocation::ImageMetadata& previous_image = previous.images[i];
+    const bool updated = !data.updated_images || data.updated_images->count(image.identifier) > 0;
+    if (updated || !SameGeometry(data.rectangles[i], previous.rectangles[i]) ||
+        !SameImage(image, previous_image)) {
+      damage.Add(previous.rectangles[i]);
+      damage.Add(data.rectangles[i]);
+    }
+  }
+  return damage;
+}
+
 }  // namespace flatland
@@ -10,6 +10,11 @@
 #include <fidl/fuchsia.math/cpp/fidl.h>
 #include <fidl/fuchsia.ui.composition/cpp/fidl.h>
 
+#include <limits>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
 #include "src/ui/scenic/lib/allocation/buffer_collection_importer.h"
 #include "src/ui/scenic/lib/flatland/flatland_types.h"
 
@@ -36,8 +41,30 @@ struct RenderData {
   // std::map of RenderData keyed by display_id?  That would have the benefit of guaranteeing by
   // construction that each display_id could only appear once.
   fuchsia_hardware_display_types::DisplayId display_id;
+  // The images whose contents may have changed since the previous frame, because their Flatland
+  // instance presented since. If unset, every image is assumed to have changed.
+  std::optional<std::unordered_set<allocation::GlobalImageId>> updated_images;
 };
 
+// The bounding box, in pixels, of the area of a render target that needs to be rendered again.
+struct Damage {
+  glm::vec2 min = glm::vec2(std::numeric_limits<float>::max());
+  glm::vec2 max = glm::vec2(std::numeric_limits<float>::lowest());
+
+  bool empty() const { return min.x >= max.x || min.y >= max.y; }
+
+  // Grows the damage to include |rect|.
+  void Add(const ImageRect& rect);
+
+  // Grows the damage to include |other|.
+  void Add(const Damage& other);
+};
+
+// Returns the area of the display where |data| may render differently than |previous|, the render
+// data of the previous frame for the same display. This covers every rectangle whose position in
+// the list, geometry, image or image contents changed, in both frames.
+Damage ComputeDamage(const RenderData& previous, const RenderData& data);
+
 // Struct to combine the source and destination rectangles used to set a layer's
 // position on the display. The src rectangle represents the (cropped) UV coordinates
 // of the image and the dst rectangle represents the position in screen space where
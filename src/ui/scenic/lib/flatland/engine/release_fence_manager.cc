@@ -8,6 +8,8 @@
 #include <lib/syslog/cpp/macros.h>
 #include <lib/trace/event.h>
 
+#include <iterator>
+
 namespace {
 
 void SignalAll(const std::vector<zx::event>& events) {
@@ -28,8 +30,23 @@ void ReleaseFenceManager::OnGpuCompositedFrame(
     uint64_t frame_number, zx::event render_finished_fence, std::vector<zx::event> release_fences,
     scheduling::FramePresentedCallback frame_presented_callback) {
   TRACE_DURATION("gfx", "ReleaseFenceManager::OnGpuCompositedFrame", "frame number", frame_number);
-  auto record = NewGpuCompositionFrameRecord(frame_number, std::move(render_finished_fence),
-                                             std::move(frame_presented_callback));
+  auto record =
+      NewGpuCompositionFrameRecord(FrameType::kGpuComposition, frame_number,
+                                   std::move(render_finished_fence),
+                                   std::move(frame_presented_callback));
+  SignalOrScheduleSignalForReleaseFences(frame_number, *record, std::move(release_fences));
+  StashFrameRecord(frame_number, std::move(record));
+}
+
+void ReleaseFenceManager::OnPartiallyGpuCompositedFrame(
+    uint64_t frame_number, zx::event render_finished_fence, std::vector<zx::event> release_fences,
+    scheduling::FramePresentedCallback frame_presented_callback) {
+  TRACE_DURATION("gfx", "ReleaseFenceManager::OnPartiallyGpuCompositedFrame", "frame number",
+                 frame_number);
+  auto record =
+      NewGpuCompositionFrameRecord(FrameType::kPartialGpuComposition, frame_number,
+                                   std::move(render_finished_fence),
+                                   std::move(frame_presented_callback));
   SignalOrScheduleSignalForReleaseFences(frame_number, *record, std::move(release_fences));
   StashFrameRecord(frame_number, std::move(record));
 }
@@ -58,15 +75,30 @@ void ReleaseFenceManager::OnVsync(uint64_t frame_number, zx::time timestamp) {
   const auto end_it = frame_records_.upper_bound(frame_number);
   bool all_earlier_callbacks_were_invoked = true;
 
+  // Signal the fences of all the frames presented by this vsync in one batch, before invoking any
+  // callback, so that a client with many images (or several skipped frames) is woken up once
+  // rather than interleaved with callbacks.
+  std::vector<zx::event> release_fences;
+  for (auto it = begin_it; it != end_it; ++it) {
+    auto& record = *it->second;
+    if (!record.frame_presented) {
+      auto& fences = record.release_fences_to_signal_when_frame_presented;
+      std::move(std::begin(fences), std::end(fences), std::back_inserter(release_fences));
+      fences.clear();
+    }
+  }
+  if (!release_fences.empty()) {
+    TRACE_DURATION("gfx", "ReleaseFenceManager::OnVsync[SignalReleaseFences]", "fence count",
+                   release_fences.size());
+    SignalAll(release_fences);
+  }
+
   for (auto it = begin_it; it != end_it;) {
     auto& record = *it->second;
     if (!record.frame_presented) {
       record.frame_presented = true;
       record.timestamps.actual_presentation_time = timestamp;
 
-      SignalAll(record.release_fences_to_signal_when_frame_presented);
-      record.release_fences_to_signal_when_frame_presented.clear();
-
       // The contract with the FrameScheduler dictates that callbacks must be invoked in order.
       // Therefore, if we reach a record whose callback cannot be invoked (e.g. because that frame
       // is GPU-composited and hasn't finished rendering), then no subsequent callback can be
@@ -161,6 +193,17 @@ void ReleaseFenceManager::SignalOrScheduleSignalForReleaseFences(
       std::move(std::begin(release_fences), std::end(release_fences),
                 std::back_inserter(current_frame.release_fences_to_signal_when_frame_presented));
     } break;
+    case FrameType::kPartialGpuComposition: {
+      // Both of the above: if the previous frame has finished rendering, only the scanned-out
+      // images remain in use, until this frame is presented.  Otherwise, stash the fences on the
+      // previous frame, which hands them over to this one when it finishes rendering.
+      FX_DCHECK(!current_frame.frame_presented);
+      auto& fences = previous_frame.render_finished
+                         ? current_frame.release_fences_to_signal_when_frame_presented
+                         : previous_frame.release_fences_to_hand_to_next_frame;
+      FX_DCHECK(fences.empty());
+      std::move(std::begin(release_fences), std::end(release_fences), std::back_inserter(fences));
+    } break;
   }
 
   // It's possible that the previous frame was already finished (i.e. callback was already invoked),
@@ -169,11 +212,12 @@ void ReleaseFenceManager::SignalOrScheduleSignalForReleaseFences(
 }
 
 std::unique_ptr<ReleaseFenceManager::FrameRecord> ReleaseFenceManager::NewGpuCompositionFrameRecord(
-    uint64_t frame_number, zx::event render_finished_fence,
+    FrameType frame_type, uint64_t frame_number, zx::event render_finished_fence,
     scheduling::FramePresentedCallback frame_presented_callback) {
   FX_DCHECK(render_finished_fence);
+  FX_DCHECK(frame_type != FrameType::kDirectScanout);
   auto record = std::make_unique<ReleaseFenceManager::FrameRecord>();
-  record->frame_type = FrameType::kGpuComposition;
+  record->frame_type = frame_type;
   record->frame_presented_callback = std::move(frame_presented_callback);
 
   // Set up a waiter on the |render_finished_fence|.
@@ -257,6 +301,21 @@ void ReleaseFenceManager::OnRenderFinished(uint64_t frame_number, zx::time times
     SignalAll(record.release_fences_to_signal_when_render_finished);
     record.release_fences_to_signal_when_render_finished.clear();
     record.render_finished_wait.reset();  // safe from within WaitOnce() closure.
+
+    // The fences stashed here by the next frame of a partially GPU-composited frame still wait for
+    // that next frame to be presented.  Its record still exists, because its callback can't have
+    // been invoked before this one's.
+    auto& fences = record.release_fences_to_hand_to_next_frame;
+    if (!fences.empty()) {
+      auto& next_frame = *FindFrameRecord(frame_number + 1)->second;
+      if (next_frame.frame_presented) {
+        SignalAll(fences);
+      } else {
+        std::move(std::begin(fences), std::end(fences),
+                  std::back_inserter(next_frame.release_fences_to_signal_when_frame_presented));
+      }
+      fences.clear();
+    }
   }
 
   // If there are previous frames whose callback hasn't been invoked, we cannot invoke the
@@ -29,6 +29,8 @@ namespace flatland {
 // GPU-composition case: fences can be signaled as soon as Vulkan is finished rendering the frame.
 // Direct-scanout case: client images are directly read by the display controller, and so the fences
 // cannot be signaled until the *next* frame is displayed on-screen.
+// Partially GPU-composited case: some client images are read by Vulkan and the rest by the display
+// controller, so the fences cannot be signaled until both of the above have happened.
 //
 // ReleaseFenceManager handles these cases separately, in order to minimize the latency before
 // clients can reuse their images.
@@ -49,11 +51,11 @@ namespace flatland {
 // === Usage ===
 //
 // ReleaseFenceManager is very simple to use.  Each frame, the caller (typically DisplayCompositor)
-// calls either OnGpuCompositedFrame() or OnDirectScanoutFrame().  The caller has two other
-// responsibilities:
+// calls one of OnGpuCompositedFrame(), OnPartiallyGpuCompositedFrame() or OnDirectScanoutFrame().
+// The caller has two other responsibilities:
 //
-// 1) for GPU-composited frames, to signal the |render_finished_event| (typically done via a Vulkan
-//    semaphore).
+// 1) for (partially) GPU-composited frames, to signal the |render_finished_event| (typically done
+//    via a Vulkan semaphore).
 //
 // 2) to call OnVsync() when a frame is presented on the display
 //
@@ -80,6 +82,14 @@ class ReleaseFenceManager final {
                             std::vector<zx::event> release_fences,
                             scheduling::FramePresentedCallback frame_presented_callback);
 
+  // Stores a record for a new frame where some images were GPU-composited into one layer and the
+  // rest were scanned out directly.  Invokes |frame_presented_callback| under the same conditions
+  // as OnGpuCompositedFrame(), but the release fences passed with the *next* frame wait both for
+  // |render_finished_fence| and for that next frame to be presented.
+  void OnPartiallyGpuCompositedFrame(uint64_t frame_number, zx::event render_finished_fence,
+                                     std::vector<zx::event> release_fences,
+                                     scheduling::FramePresentedCallback frame_presented_callback);
+
   // Stores a record for a new direct-scanout frame.  |frame_number| must be one larger than the
   // previous frame.  Later, when it is safe, signals |release_fences| (see class comment).
   // Invokes |frame_presented_callback| when:
@@ -96,7 +106,7 @@ class ReleaseFenceManager final {
   size_t frame_record_count() const { return frame_records_.size(); }
 
  private:
-  enum class FrameType { kGpuComposition, kDirectScanout };
+  enum class FrameType { kGpuComposition, kPartialGpuComposition, kDirectScanout };
 
   struct FrameRecord {
     FrameType frame_type;
@@ -106,6 +116,10 @@ class ReleaseFenceManager final {
     std::vector<zx::event> release_fences_to_signal_when_render_finished;
     std::vector<zx::event> release_fences_to_signal_when_frame_presented;
 
+    // Only used by partially GPU-composited frames: the fences passed with the next frame, if it
+    // arrived before this one finished rendering.  They move to the next frame once it has.
+    std::vector<zx::event> release_fences_to_hand_to_next_frame;
+
     scheduling::FramePresentedCallback frame_presented_callback;
 
     // Note the relative ordering of these two fields is important because
@@ -129,7 +143,7 @@ class ReleaseFenceManager final {
   FrameRecordIterator FindFrameRecord(uint64_t frame_number);
 
   std::unique_ptr<FrameRecord> NewGpuCompositionFrameRecord(
-      uint64_t frame_number, zx::event render_finished_fence,
+      FrameType frame_type, uint64_t frame_number, zx::event render_finished_fence,
       scheduling::FramePresentedCallback frame_presented_callback);
 
   std::unique_ptr<FrameRecord> NewDirectScanoutFrameRecord(
@@ -13,6 +13,7 @@
 #include <lib/zx/time.h>
 
 #include <memory>
+#include <unordered_set>
 
 #include <gmock/gmock.h>
 
@@ -1945,4 +1946,47 @@ TEST_F(DisplayCompositorTest, RendererOnly_ImportAndReleaseBufferCollectionTest)
   display_compositor_.reset();
 }
 
+TEST(ComputeDamageTest, CoversOnlyChangedRectangles) {
+  const ImageMetadata image_a = {.identifier = 1, .width = 100, .height = 100};
+  const ImageMetadata image_b = {.identifier = 2, .width = 100, .height = 100};
+  const RenderData previous = {
+      .rectangles = {ImageRect(glm::vec2(0), glm::vec2(10)),
+                     ImageRect(glm::vec2(20), glm::vec2(10))},
+      .images = {image_a, image_b},
+  };
+
+  // Nothing changed.
+  RenderData data = previous;
+  data.updated_images.emplace();
+  EXPECT_TRUE(ComputeDamage(previous, data).empty());
+
+  // Only the second image has new contents.
+  data.updated_images = std::unordered_set<allocation::GlobalImageId>{image_b.identifier};
+  Damage damage = ComputeDamage(previous, data);
+  EXPECT_EQ(damage.min, glm::vec2(20));
+  EXPECT_EQ(damage.max, glm::vec2(30));
+
+  // The first rectangle moved, so both where it was and where it is now are damaged.
+  data.updated_images.emplace();
+  data.rectangles[0] = ImageRect(glm::vec2(5), glm::vec2(10));
+  damage = ComputeDamage(previous, data);
+  EXPECT_EQ(damage.min, glm::vec2(0));
+  EXPECT_EQ(damage.max, glm::vec2(15));
+
+  // A removed rectangle damages where it was.
+  data = previous;
+  data.updated_images.emplace();
+  data.rectangles.pop_back();
+  data.images.pop_back();
+  damage = ComputeDamage(previous, data);
+  EXPECT_EQ(damage.min, glm::vec2(20));
+  EXPECT_EQ(damage.max, glm::vec2(30));
+
+  // Without |updated_images|, everything is damaged.
+  data = previous;
+  damage = ComputeDamage(previous, data);
+  EXPECT_EQ(damage.min, glm::vec2(0));
+  EXPECT_EQ(damage.max, glm::vec2(30));
+}
+
 }  // namespace flatland::test
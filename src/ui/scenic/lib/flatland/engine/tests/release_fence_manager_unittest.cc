@@ -27,6 +27,7 @@
 //    Tests:
 //    - SignalingWhenPreviousFrameWasGpuComposited
 //    - SignalingWhenPreviousFrameWasDirectScanout
+//    - SignalingWhenPreviousFrameWasPartiallyGpuComposited
 //
 // 2) Dropped/Skipped frames.  OnVsync() for later frame causes frame callback of earlier frames to
 //    be invoked (assuming that all render_finished_fences are signaled for earlier GPU-composited
@@ -186,6 +187,43 @@ TEST_F(ReleaseFenceManagerTest, SignalingWhenPreviousFrameWasDirectScanout) {
   }
 }
 
+TEST_F(ReleaseFenceManagerTest, SignalingWhenPreviousFrameWasPartiallyGpuComposited) {
+  // The fences wait for both the first frame to finish rendering and the second to be displayed,
+  // whichever happens last.  Test both orders.
+  for (auto& render_finishes_first : std::array<bool, 2>{true, false}) {
+    ReleaseFenceManager manager(dispatcher());
+
+    zx::event render_finished_fence = utils::CreateEvent();
+    manager.OnPartiallyGpuCompositedFrame(
+        /*frame_number*/ 1, utils::CopyEvent(render_finished_fence), {},
+        [](scheduling::Timestamps) {});
+
+    std::vector<zx::event> release_fences = utils::CreateEventArray(2);
+    manager.OnDirectScanoutFrame(
+        /*frame_number*/ 2, utils::CopyEventArray(release_fences), [](scheduling::Timestamps) {});
+
+    if (render_finishes_first) {
+      render_finished_fence.signal(0u, ZX_EVENT_SIGNALED);
+      RunLoopUntilIdle();
+    } else {
+      manager.OnVsync(/*frame_number*/ 2, zx::time(1));
+    }
+    for (auto& fence : release_fences) {
+      EXPECT_FALSE(utils::IsEventSignalled(fence, ZX_EVENT_SIGNALED));
+    }
+
+    if (render_finishes_first) {
+      manager.OnVsync(/*frame_number*/ 2, zx::time(1));
+    } else {
+      render_finished_fence.signal(0u, ZX_EVENT_SIGNALED);
+      RunLoopUntilIdle();
+    }
+    for (auto& fence : release_fences) {
+      EXPECT_TRUE(utils::IsEventSignalled(fence, ZX_EVENT_SIGNALED));
+    }
+  }
+}
+
 TEST_F(ReleaseFenceManagerTest, FramePresentedCallbackForGpuCompositedFrame) {
   // Test common case, where render_finished_fence is signaled before the OnVsync() is received.
   {
@@ -116,7 +116,8 @@ std::shared_ptr<Flatland> Flatland::New(
     fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::TouchSource>, zx_koid_t)>
         register_touch_source,
     fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::MouseSource>, zx_koid_t)>
-        register_mouse_source) {
+        register_mouse_source,
+    zx::duration image_release_grace_period) {
   // clang-format off
   auto flatland = std::shared_ptr<Flatland>(new Flatland(
       dispatcher_holder,
@@ -128,7 +129,8 @@ std::shared_ptr<Flatland> Flatland::New(
       std::move(register_view_focuser),
       std::move(register_view_ref_focused),
       std::move(register_touch_source),
-      std::move(register_mouse_source)));
+      std::move(register_mouse_source),
+      image_release_grace_period));
   // clang-format on
 
   // Natural FIDL bindings must be created and deleted on the same thread that it handles messages.
@@ -155,7 +157,8 @@ Flatland::Flatland(std::shared_ptr<utils::DispatcherHolder> dispatcher_holder,
                    fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::TouchSource>, zx_koid_t)>
                        register_touch_source,
                    fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::MouseSource>, zx_koid_t)>
-                       register_mouse_source)
+                       register_mouse_source,
+                   zx::duration image_release_grace_period)
     : dispatcher_holder_(std::move(dispatcher_holder)),
       session_id_(session_id),
       present2_helper_([this](fuchsia_scenic_scheduling::FramePresentedInfo info) {
@@ -178,6 +181,8 @@ Flatland::Flatland(std::shared_ptr<utils::DispatcherHolder> dispatcher_holder,
       local_root_(transform_graph_.CreateTransform()),
       error_reporter_(scenic_impl::ErrorReporter::DefaultUnique()),
       images_to_release_(std::make_shared<std::unordered_set<allocation::GlobalImageId>>()),
+      released_images_(std::make_shared<ReleasedImageCache>(
+          dispatcher(), buffer_collection_importers_, image_release_grace_period)),
       register_view_focuser_(std::move(register_view_focuser)),
       register_view_ref_focused_(std::move(register_view_ref_focused)),
       register_touch_source_(std::move(register_touch_source)),
@@ -262,6 +267,9 @@ Flatland::~Flatland() {
   ProcessDeadTransforms(data);
   FX_DCHECK(image_metadatas_.empty());
 
+  // Parked images are already past their release fence, so they can be released right away.
+  released_images_->ReleaseAll();
+
   // If there are any images to release, set up a waiter, and pass the event-to-be-signaled to
   // `FlatlandPresenter::RemoveSession`.  This will schedule another frame and signal the event
   // just like any other release fence.
@@ -273,7 +281,7 @@ Flatland::~Flatland() {
     auto wait = std::make_shared<async::WaitOnce>(evt.get(), ZX_EVENT_SIGNALED);
     zx_status_t status = wait->Begin(
         dispatcher(),
-        [importer_refs = buffer_collection_importers_, images_to_release = images_to_release_,
+        [released_images = released_images_, images_to_release = images_to_release_,
          // We keep several objects alive in the closure:
          //   - the dispatcher, which is about to be released by the Flatland and FlatlandManager.
          //   - the wait object keeps itself alive via the ref in this closure
@@ -283,9 +291,7 @@ Flatland::~Flatland() {
          keepalive_evt = std::move(evt)](async_dispatcher_t*, async::WaitOnce*, zx_status_t status,
                                          const zx_packet_signal_t* /*signal*/) mutable {
           for (auto& image_id : *images_to_release) {
-            for (auto& importer : importer_refs) {
-              importer->ReleaseBufferImage(image_id);
-            }
+            released_images->Release(image_id);
           }
           images_to_release->clear();
         });
@@ -393,7 +399,7 @@ void Flatland::Present(fuchsia_ui_composition::PresentArgs args) {
     auto wait = std::make_shared<async::WaitOnce>(image_release_fence.get(), ZX_EVENT_SIGNALED);
     status = wait->Begin(
         dispatcher(),
-        [copy_ref = wait, importer_refs = buffer_collection_importers_, images_to_release,
+        [copy_ref = wait, released_images = released_images_, images_to_release,
          all_images_to_release = images_to_release_,
          session_id = session_id_](async_dispatcher_t*, async::WaitOnce*, zx_status_t status,
                                    const zx_packet_signal_t* /*signal*/) mutable {
@@ -418,9 +424,7 @@ void Flatland::Present(fuchsia_ui_composition::PresentArgs args) {
               continue;
             }
 
-            for (auto& importer : importer_refs) {
-              importer->ReleaseBufferImage(image_id);
-            }
+            released_images->Release(image_id);
           }
         });
     FX_DCHECK(status == ZX_OK) << "status is: " << status;
@@ -1227,25 +1231,32 @@ void Flatland::CreateImage(ContentId image_id,
   metadata.height = properties.size()->height();
   metadata.blend_mode = fuchsia_ui_composition::BlendMode::kSrc;
 
-  for (uint32_t i = 0; i < buffer_collection_importers_.size(); i++) {
-    auto& importer = buffer_collection_importers_[i];
-
-    // TODO(https://fxbug.dev/42140615): Give more detailed errors.
-    auto result =
-        importer->ImportBufferImage(metadata, allocation::BufferCollectionUsage::kClientImage);
-    if (!result) {
-      // If this importer fails, we need to release the image from
-      // all of the importers that it passed on. Luckily we can do
-      // this right here instead of waiting for a fence since we know
-      // this image isn't being used by anything yet.
-      for (uint32_t j = 0; j < i; j++) {
-        buffer_collection_importers_[j]->ReleaseBufferImage(metadata.identifier);
-      }
+  // Reuse a recently released image of the same VMO and size, if it is still imported.
+  if (const auto parked_image_id = released_images_->Take(metadata);
+      parked_image_id != allocation::kInvalidImageId) {
+    metadata.identifier = parked_image_id;
+  } else {
+    for (uint32_t i = 0; i < buffer_collection_importers_.size(); i++) {
+      auto& importer = buffer_collection_importers_[i];
+
+      // TODO(https://fxbug.dev/42140615): Give more detailed errors.
+      auto result =
+          importer->ImportBufferImage(metadata, allocation::BufferCollectionUsage::kClientImage);
+      if (!result) {
+        // If this importer fails, we need to release the image from
+        // all of the importers that it passed on. Luckily we can do
+        // this right here instead of waiting for a fence since we know
+        // this image isn't being used by anything yet.
+        for (uint32_t j = 0; j < i; j++) {
+          buffer_collection_importers_[j]->ReleaseBufferImage(metadata.identifier);
+        }
 
-      error_reporter_->ERROR() << "Importer could not import image.";
-      CloseConnection(FlatlandError::kBadOperation);
-      return;
+        error_reporter_->ERROR() << "Importer could not import image.";
+        CloseConnection(FlatlandError::kBadOperation);
+        return;
+      }
     }
+    released_images_->OnImageImported(metadata);
   }
 
   // Now that we've successfully been able to import the image into the importers,
@@ -12,6 +12,7 @@
 #include <lib/fidl/cpp/binding.h>
 #include <lib/fit/function.h>
 #include <lib/zx/channel.h>
+#include <lib/zx/time.h>
 
 #include <map>
 #include <memory>
@@ -24,6 +25,7 @@
 #include "src/ui/scenic/lib/allocation/buffer_collection_importer.h"
 #include "src/ui/scenic/lib/flatland/flatland_presenter.h"
 #include "src/ui/scenic/lib/flatland/link_system.h"
+#include "src/ui/scenic/lib/flatland/released_image_cache.h"
 #include "src/ui/scenic/lib/flatland/transform_graph.h"
 #include "src/ui/scenic/lib/flatland/transform_handle.h"
 #include "src/ui/scenic/lib/flatland/uber_struct_system.h"
@@ -64,6 +66,9 @@ class Flatland : public fidl::Server<fuchsia_ui_composition::Flatland>,
   // `flatland_presenter`, `link_system`, `uber_struct_queue`, and `buffer_collection_importers`
   // allow this Flatland object to access resources shared by all Flatland instances for actions
   // like frame scheduling, linking, buffer allocation, and presentation to the global scene graph.
+  //
+  // Released images stay imported for `image_release_grace_period`, so that a matching
+  // CreateImage() can reuse them; see ReleasedImageCache.
   static std::shared_ptr<Flatland> New(
       std::shared_ptr<utils::DispatcherHolder> dispatcher_holder,
       fidl::ServerEnd<fuchsia_ui_composition::Flatland> server_end,
@@ -80,7 +85,8 @@ class Flatland : public fidl::Server<fuchsia_ui_composition::Flatland>,
       fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::TouchSource>, zx_koid_t)>
           register_touch_source,
       fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::MouseSource>, zx_koid_t)>
-          register_mouse_source);
+          register_mouse_source,
+      zx::duration image_release_grace_period = zx::duration(0));
 
   // Because this object captures its "this" pointer in internal closures, it is unsafe to copy or
   // move it. Disable all copy and move operations.
@@ -294,7 +300,8 @@ class Flatland : public fidl::Server<fuchsia_ui_composition::Flatland>,
            fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::TouchSource>, zx_koid_t)>
                register_touch_source,
            fit::function<void(fidl::ServerEnd<fuchsia_ui_pointer::MouseSource>, zx_koid_t)>
-               register_mouse_source);
+               register_mouse_source,
+           zx::duration image_release_grace_period);
 
   // `Flatland::New()` dispatches a task to invoke this.
   void Bind(fidl::ServerEnd<fuchsia_ui_composition::Flatland> server_end,
@@ -490,6 +497,11 @@ class Flatland : public fidl::Server<fuchsia_ui_composition::Flatland>,
   // this code was written).
   std::shared_ptr<std::unordered_set<allocation::GlobalImageId>> images_to_release_;
 
+  // Once their release fence is signaled, images are released through this cache, which may keep
+  // them imported for a while so that CreateImage() can reuse them.  Shared for the same reason as
+  // `images_to_release_`.
+  std::shared_ptr<ReleasedImageCache> released_images_;
+
   // Callbacks for registering View-bound protocols.
   fit::function<void(fidl::ServerEnd<fuchsia_ui_views::Focuser>, zx_koid_t)> register_view_focuser_;
   fit::function<void(fidl::ServerEnd<fuchsia_ui_views::ViewRefFocused>, zx_koid_t)>
@@ -19,6 +19,14 @@
 
 namespace flatland {
 
+namespace {
+
+// How long sessions keep released images imported, so that recreating an image of the same buffer
+// soon after releasing it doesn't import it again.
+constexpr zx::duration kImageReleaseGracePeriod = zx::sec(1);
+
+}  // namespace
+
 FlatlandManager::FlatlandManager(
     async_dispatcher_t* dispatcher, const std::shared_ptr<FlatlandPresenter>& flatland_presenter,
     const std::shared_ptr<UberStructSystem>& uber_struct_system,
@@ -174,7 +182,8 @@ std::shared_ptr<Flatland> FlatlandManager::NewFlatland(
                           CheckIsOnMainThread();
                           register_mouse_source_(fidl::NaturalToHLCPP(mouse_source), view_ref_koid);
                         });
-      });
+      },
+      kImageReleaseGracePeriod);
 }
 
 void FlatlandManager::CreateFlatlandDisplay(
@@ -8,6 +8,8 @@
 #include <lib/trace/event.h>
 
 #include <cmath>
+#include <optional>
+#include <vector>
 
 #include "src/ui/scenic/lib/flatland/flatland_types.h"
 
@@ -322,6 +324,57 @@ GlobalMatrixVector ComputeGlobalMatrices(
   return matrices;
 }
 
+GlobalMatrixVector ComputeGlobalMatrices(
+    const GlobalTopologyData::TopologyVector& global_topology,
+    const GlobalTopologyData::ParentIndexVector& parent_indices,
+    const UberStruct::InstanceMap& uber_structs,
+    const UberStruct::InstanceMap& previous_uber_structs, GlobalMatrixVector previous_matrices) {
+  TRACE_DURATION("gfx", "ComputeGlobalMatrices[incremental]");
+  FX_DCHECK(previous_matrices.size() == global_topology.size());
+  GlobalMatrixVector matrices = std::move(previous_matrices);
+
+  // Whether the global matrix at each index differs from the previous one.
+  std::vector<bool> changed(global_topology.size(), false);
+
+  // Transforms of the same instance are mostly contiguous in the topology, so only look up the
+  // UberStructs again when the instance changes.
+  std::optional<TransformHandle::InstanceId> last_instance_id;
+  const UberStruct* uber_struct = nullptr;
+  bool uber_struct_changed = false;
+
+  for (size_t i = 0; i < global_topology.size(); ++i) {
+    const TransformHandle& handle = global_topology[i];
+    // The root entry's parent pointer points to itself, so special case it.
+    const bool parent_changed = i > 0 && changed[parent_indices[i]];
+
+    if (handle.GetInstanceId() != last_instance_id) {
+      last_instance_id = handle.GetInstanceId();
+      const auto uber_struct_kv = uber_structs.find(handle.GetInstanceId());
+      FX_DCHECK(uber_struct_kv != uber_structs.end());
+      const auto previous_kv = previous_uber_structs.find(handle.GetInstanceId());
+      FX_DCHECK(previous_kv != previous_uber_structs.end());
+      uber_struct = uber_struct_kv->second.get();
+      uber_struct_changed = uber_struct_kv->second != previous_kv->second;
+    }
+
+    if (!uber_struct_changed && !parent_changed) {
+      continue;
+    }
+
+    const glm::mat3 parent_matrix = i > 0 ? matrices[parent_indices[i]] : glm::mat3();
+    const auto matrix_kv = uber_struct->local_matrices.find(handle);
+    const glm::mat3 matrix = matrix_kv == uber_struct->local_matrices.end()
+                                 ? parent_matrix
+                                 : parent_matrix * matrix_kv->second;
+    if (matrix != matrices[i]) {
+      matrices[i] = matrix;
+      changed[i] = true;
+    }
+  }
+
+  return matrices;
+}
+
 GlobalImageSampleRegionVector ComputeGlobalImageSampleRegions(
     const GlobalTopologyData::TopologyVector& global_topology,
     const GlobalTopologyData::ParentIndexVector& parent_indices,
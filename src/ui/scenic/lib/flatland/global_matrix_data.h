@@ -39,6 +39,17 @@ GlobalMatrixVector ComputeGlobalMatrices(
     const GlobalTopologyData::ParentIndexVector& parent_indices,
     const UberStruct::InstanceMap& uber_structs);
 
+// Same as above, but updates |previous_matrices|, which were computed for the same
+// |global_topology| from |previous_uber_structs|, rather than starting from scratch. Only
+// transforms whose UberStruct was replaced since, or whose parent's global matrix changed, are
+// recomputed, so a frame where a single client moved content only walks that client's transforms
+// and the subtrees below the ones that moved.
+GlobalMatrixVector ComputeGlobalMatrices(
+    const GlobalTopologyData::TopologyVector& global_topology,
+    const GlobalTopologyData::ParentIndexVector& parent_indices,
+    const UberStruct::InstanceMap& uber_structs,
+    const UberStruct::InstanceMap& previous_uber_structs, GlobalMatrixVector previous_matrices);
+
 // Gathers the image sample regions for each transform in |global_topology| using the local
 // image sample regions in the |uber_structs|. If a transform doesn't have image sample
 // regions present in the appropriate UberStruct, this function assumes the region is null.
@@ -5,6 +5,7 @@
 #include "src/ui/scenic/lib/flatland/global_topology_data.h"
 
 #include <fuchsia/math/cpp/fidl.h>
+#include <lib/fidl/cpp/comparison.h>
 #include <lib/syslog/cpp/macros.h>
 #include <lib/trace/event.h>
 
@@ -124,6 +125,20 @@ glm::mat4 Convert2DTransformTo3D(glm::mat3 in_matrix) {
   return out_matrix;
 }
 
+bool ClipRegionsEqual(const std::unordered_map<TransformHandle, TransformClipRegion>& a,
+                      const std::unordered_map<TransformHandle, TransformClipRegion>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (const auto& [handle, region] : a) {
+    const auto kv = b.find(handle);
+    if (kv == b.end() || !fidl::Equals(region, kv->second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Wrapper function to check against implementation's sentinel value for infinite regions.
 bool HitRegionContainsPoint(flatland::HitRegion region, float x, float y) {
   if (!region.is_finite()) {
@@ -518,19 +533,19 @@ GlobalTopologyData GlobalTopologyData::ComputeGlobalTopologyData(
     parent_indices.push_back(parent_counts.empty() ? 0 : parent_counts.back().parent_index);
     live_transforms.insert(current_entry.handle);
 
-    // For the root of each local topology (i.e. the View), save the debug name if it is not empty.
-    if (current_entry == vector[0] &&
-        !uber_structs.at(current_entry.handle.GetInstanceId())->debug_name.empty()) {
-      debug_names.emplace(current_entry.handle,
-                          uber_structs.at(current_entry.handle.GetInstanceId())->debug_name);
-    }
-
-    // For each node in the local topology, save the TransformClipRegion of its child instances.
-    for (auto& [child_handle, child_clip_region] :
-         uber_structs.at(current_entry.handle.GetInstanceId())->local_clip_regions) {
-      TransformClipRegion clip_region;
-      fidl::Clone(child_clip_region, &clip_region);
-      clip_regions.try_emplace(child_handle, std::move(clip_region));
+    // For the root of each local topology (i.e. the View), save the debug name if it is not empty,
+    // and the TransformClipRegions of the local topology. An instance's root is visited exactly
+    // once, and only if the rest of its local topology is included.
+    if (current_entry == vector[0]) {
+      const auto& uber_struct = uber_structs.at(current_entry.handle.GetInstanceId());
+      if (!uber_struct->debug_name.empty()) {
+        debug_names.emplace(current_entry.handle, uber_struct->debug_name);
+      }
+      for (auto& [child_handle, child_clip_region] : uber_struct->local_clip_regions) {
+        TransformClipRegion clip_region;
+        fidl::Clone(child_clip_region, &clip_region);
+        clip_regions.try_emplace(child_handle, std::move(clip_region));
+      }
     }
 
     // If this entry was the last child for the previous parent, pop that off the stack.
@@ -567,6 +582,37 @@ GlobalTopologyData GlobalTopologyData::ComputeGlobalTopologyData(
   return output;
 }
 
+bool GlobalTopologyData::IsTopologyUnchanged(const UberStruct::InstanceMap& previous_uber_structs,
+                                             const LinkTopologyMap& previous_links,
+                                             const UberStruct::InstanceMap& uber_structs,
+                                             const LinkTopologyMap& links) {
+  TRACE_DURATION("gfx", "flatland::GlobalTopologyData::IsTopologyUnchanged");
+  if (uber_structs.size() != previous_uber_structs.size() || links != previous_links) {
+    return false;
+  }
+
+  for (const auto& [instance_id, uber_struct] : uber_structs) {
+    const auto previous_kv = previous_uber_structs.find(instance_id);
+    if (previous_kv == previous_uber_structs.end()) {
+      return false;
+    }
+    const auto& previous_uber_struct = previous_kv->second;
+    // Instances that haven't presented since keep the same UberStruct.
+    if (uber_struct == previous_uber_struct) {
+      continue;
+    }
+    if (uber_struct->local_topology != previous_uber_struct->local_topology ||
+        uber_struct->view_ref != previous_uber_struct->view_ref ||
+        uber_struct->debug_name != previous_uber_struct->debug_name ||
+        !ClipRegionsEqual(uber_struct->local_clip_regions,
+                          previous_uber_struct->local_clip_regions)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 view_tree::SubtreeSnapshot GlobalTopologyData::GenerateViewTreeSnapshot(
     const GlobalTopologyData& data, HitRegions hit_regions,
     std::vector<TransformClipRegion> global_clip_regions,
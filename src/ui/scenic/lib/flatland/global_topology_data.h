@@ -108,6 +108,17 @@ struct GlobalTopologyData {
                                                       TransformHandle::InstanceId link_instance_id,
                                                       TransformHandle root);
 
+  // Returns true if ComputeGlobalTopologyData() would return the same result for |uber_structs|
+  // and |links| as for |previous_uber_structs| and |previous_links|, given the same root and
+  // |link_instance_id|. This holds when the same instances are present, the links are the same,
+  // and no UberStruct changed the data that the topology is built from: its local topology,
+  // ViewRef, debug name and clip regions. A frame in which clients only moved content or changed
+  // images can then reuse the previous topology instead of recomputing it.
+  static bool IsTopologyUnchanged(const UberStruct::InstanceMap& previous_uber_structs,
+                                  const LinkTopologyMap& previous_links,
+                                  const UberStruct::InstanceMap& uber_structs,
+                                  const LinkTopologyMap& links);
+
   static view_tree::SubtreeSnapshot GenerateViewTreeSnapshot(
       const GlobalTopologyData& data, HitRegions hit_regions,
       std::vector<TransformClipRegion> global_clip_regions,
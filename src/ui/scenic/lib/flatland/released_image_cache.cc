@@ -0,0 +1,137 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ui/scenic/lib/flatland/released_image_cache.h"
+
+#include <lib/async/cpp/task.h>
+#include <lib/async/cpp/time.h>
+#include <lib/syslog/cpp/macros.h>
+#include <lib/trace/event.h>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+namespace flatland {
+
+ReleasedImageCache::ReleasedImageCache(
+    async_dispatcher_t* dispatcher,
+    std::vector<std::shared_ptr<allocation::BufferCollectionImporter>>
+        buffer_collection_importers,
+    zx::duration grace_period)
+    : dispatcher_(dispatcher),
+      buffer_collection_importers_(std::move(buffer_collection_importers)),
+      grace_period_(grace_period) {
+  FX_DCHECK(grace_period_ >= zx::duration(0));
+}
+
+ReleasedImageCache::~ReleasedImageCache() { ReleaseAll(); }
+
+ReleasedImageCache::Key ReleasedImageCache::MakeKey(const allocation::ImageMetadata& metadata) {
+  return {metadata.collection_id, metadata.vmo_index, metadata.width, metadata.height};
+}
+
+void ReleasedImageCache::OnImageImported(const allocation::ImageMetadata& metadata) {
+  if (grace_period_ == zx::duration(0)) {
+    return;
+  }
+  keys_.emplace(metadata.identifier, MakeKey(metadata));
+}
+
+allocation::GlobalImageId ReleasedImageCache::Take(const allocation::ImageMetadata& metadata) {
+  auto it = parked_images_.find(MakeKey(metadata));
+  if (it == parked_images_.end()) {
+    return allocation::kInvalidImageId;
+  }
+
+  // Take the most recently parked image; the oldest ones are the next to expire.
+  const allocation::GlobalImageId image_id = it->second.back().image_id;
+  it->second.pop_back();
+  if (it->second.empty()) {
+    parked_images_.erase(it);
+  }
+  return image_id;
+}
+
+void ReleasedImageCache::Release(allocation::GlobalImageId image_id) {
+  auto it = keys_.find(image_id);
+  if (it == keys_.end() || released_all_) {
+    ReleaseFromImporters(image_id);
+    return;
+  }
+
+  parked_images_[it->second].push_back(
+      {.image_id = image_id, .expiry = async::Now(dispatcher_) + grace_period_});
+  MaybeScheduleSweep(grace_period_);
+}
+
+void ReleasedImageCache::ReleaseAll() {
+  released_all_ = true;
+  for (auto& [key, parked_images] : parked_images_) {
+    for (auto& parked_image : parked_images) {
+      ReleaseFromImporters(parked_image.image_id);
+    }
+  }
+  parked_images_.clear();
+}
+
+size_t ReleasedImageCache::parked_image_count() const {
+  size_t count = 0;
+  for (auto& [key, parked_images] : parked_images_) {
+    count += parked_images.size();
+  }
+  return count;
+}
+
+void ReleasedImageCache::ReleaseFromImporters(allocation::GlobalImageId image_id) {
+  keys_.erase(image_id);
+  for (auto& importer : buffer_collection_importers_) {
+    importer->ReleaseBufferImage(image_id);
+  }
+}
+
+void ReleasedImageCache::Sweep() {
+  TRACE_DURATION("gfx", "flatland::ReleasedImageCache::Sweep");
+  sweep_scheduled_ = false;
+
+  const zx::time now = async::Now(dispatcher_);
+  std::optional<zx::time> next_expiry;
+  for (auto it = parked_images_.begin(); it != parked_images_.end();) {
+    auto& parked_images = it->second;
+    while (!parked_images.empty() && parked_images.front().expiry <= now) {
+      ReleaseFromImporters(parked_images.front().image_id);
+      parked_images.pop_front();
+    }
+    if (parked_images.empty()) {
+      it = parked_images_.erase(it);
+      continue;
+    }
+    next_expiry = std::min(next_expiry.value_or(zx::time::infinite()),
+                           parked_images.front().expiry);
+    ++it;
+  }
+
+  if (next_expiry) {
+    MaybeScheduleSweep(*next_expiry - now);
+  }
+}
+
+void ReleasedImageCache::MaybeScheduleSweep(zx::duration delay) {
+  if (sweep_scheduled_) {
+    return;
+  }
+  sweep_scheduled_ = true;
+
+  // The cache may be destroyed first, in which case it has already released everything.
+  async::PostDelayedTask(
+      dispatcher_,
+      [weak = weak_from_this()] {
+        if (auto cache = weak.lock()) {
+          cache->Sweep();
+        }
+      },
+      delay);
+}
+
+}  // namespace flatland
@@ -0,0 +1,98 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_UI_SCENIC_LIB_FLATLAND_RELEASED_IMAGE_CACHE_H_
+#define SRC_UI_SCENIC_LIB_FLATLAND_RELEASED_IMAGE_CACHE_H_
+
+#include <lib/async/dispatcher.h>
+#include <lib/zx/time.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "src/ui/scenic/lib/allocation/buffer_collection_importer.h"
+
+namespace flatland {
+
+// Keeps the client images of a Flatland session imported for a grace period after they are no
+// longer used, so that a later CreateImage() for the same VMO of the same buffer collection, with
+// the same size, can reuse the import instead of importing it into every BufferCollectionImporter
+// again.  Clients which rebuild many small images (icon grids, video thumbnails) otherwise import
+// and release the same buffers over and over.
+//
+// With a zero grace period, images are released from the importers as soon as Release() is called,
+// and nothing is cached.
+//
+// Not thread-safe: all methods must be called on the |dispatcher| passed to the constructor, which
+// is also used to release parked images once their grace period has expired.
+class ReleasedImageCache : public std::enable_shared_from_this<ReleasedImageCache> {
+ public:
+  ReleasedImageCache(
+      async_dispatcher_t* dispatcher,
+      std::vector<std::shared_ptr<allocation::BufferCollectionImporter>>
+          buffer_collection_importers,
+      zx::duration grace_period);
+  ReleasedImageCache(const ReleasedImageCache&) = delete;
+  ReleasedImageCache& operator=(const ReleasedImageCache&) = delete;
+
+  // Releases all parked images.
+  ~ReleasedImageCache();
+
+  // Records that |metadata| was imported into all importers, so that it can be parked on Release().
+  void OnImageImported(const allocation::ImageMetadata& metadata);
+
+  // Returns the id of a parked image imported from the same VMO with the same size as |metadata|,
+  // which is no longer parked, or allocation::kInvalidImageId if there is none.
+  allocation::GlobalImageId Take(const allocation::ImageMetadata& metadata);
+
+  // Called once |image_id| is no longer referenced by any render data.  Parks it for the grace
+  // period, or releases it from all importers right away.
+  void Release(allocation::GlobalImageId image_id);
+
+  // Releases all parked images, and makes any later Release() immediate.  Called when the session
+  // is destroyed.
+  void ReleaseAll();
+
+  // For testing.
+  size_t parked_image_count() const;
+
+ private:
+  // Images are interchangeable if they were imported from the same VMO with the same size.
+  using Key = std::tuple<allocation::GlobalBufferCollectionId, uint32_t, uint32_t, uint32_t>;
+  static Key MakeKey(const allocation::ImageMetadata& metadata);
+
+  struct ParkedImage {
+    allocation::GlobalImageId image_id;
+    zx::time expiry;
+  };
+
+  void ReleaseFromImporters(allocation::GlobalImageId image_id);
+
+  // Releases the parked images whose grace period has expired, and schedules another sweep if any
+  // remain.
+  void Sweep();
+  void MaybeScheduleSweep(zx::duration delay);
+
+  async_dispatcher_t* const dispatcher_;
+  const std::vector<std::shared_ptr<allocation::BufferCollectionImporter>>
+      buffer_collection_importers_;
+  const zx::duration grace_period_;
+
+  // The keys of all imported images which haven't yet been released from the importers.
+  std::unordered_map<allocation::GlobalImageId, Key> keys_;
+
+  // Parked images by key, oldest first.
+  std::map<Key, std::deque<ParkedImage>> parked_images_;
+
+  bool sweep_scheduled_ = false;
+  bool released_all_ = false;
+};
+
+}  // namespace flatland
+
+#endif  // SRC_UI_SCENIC_LIB_FLATLAND_RELEASED_IMAGE_CACHE_H_
@@ -10,8 +10,10 @@
 #include <fuchsia/ui/composition/cpp/fidl.h>
 #include <lib/syslog/cpp/macros.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <optional>
 
 #include "src/ui/scenic/lib/allocation/id.h"
@@ -20,6 +22,49 @@
 #include "src/ui/scenic/lib/utils/helpers.h"
 #include "src/ui/scenic/lib/utils/pixel.h"
 
+namespace {
+
+constexpr uint32_t kBytesPerPixel = 4;
+
+bool IsRgbaOrBgra(fuchsia::images2::PixelFormat format) {
+  return format == fuchsia::images2::PixelFormat::B8G8R8A8 ||
+         format == fuchsia::images2::PixelFormat::R8G8B8A8;
+}
+
+// Copies |width| pixels of row |y| of the image into |dest_row|, converting them from
+// |image_type| to |render_type|. The 32-bit formats only differ in the order of their red and blue
+// channels, so they are converted with whole-word operations that the compiler vectorizes; the rest
+// go through utils::Pixel one pixel at a time.
+void CopyRow(const uint8_t* image_ptr, uint32_t image_pixels_per_row, uint32_t y, uint32_t width,
+             fuchsia::images2::PixelFormat image_type, uint8_t* dest_row,
+             fuchsia::images2::PixelFormat render_type, std::vector<uint8_t>& color) {
+  if (image_type == render_type && IsRgbaOrBgra(image_type)) {
+    memcpy(dest_row, image_ptr + static_cast<size_t>(y) * image_pixels_per_row * kBytesPerPixel,
+           static_cast<size_t>(width) * kBytesPerPixel);
+    return;
+  }
+
+  if (IsRgbaOrBgra(image_type) && IsRgbaOrBgra(render_type)) {
+    const uint8_t* src_row =
+        image_ptr + static_cast<size_t>(y) * image_pixels_per_row * kBytesPerPixel;
+    for (uint32_t x = 0; x < width; x++) {
+      uint32_t pixel;
+      memcpy(&pixel, src_row + x * kBytesPerPixel, sizeof(pixel));
+      pixel = (pixel & 0xff00ff00u) | ((pixel >> 16) & 0xffu) | ((pixel & 0xffu) << 16);
+      memcpy(dest_row + x * kBytesPerPixel, &pixel, sizeof(pixel));
+    }
+    return;
+  }
+
+  for (uint32_t x = 0; x < width; x++) {
+    utils::Pixel pixel = utils::Pixel::FromVmo(image_ptr, image_pixels_per_row, x, y, image_type);
+    pixel.ToFormat(render_type, color);
+    memcpy(dest_row + x * kBytesPerPixel, color.data(), kBytesPerPixel);
+  }
+}
+
+}  // namespace
+
 namespace flatland {
 
 const std::vector<uint8_t> kTransparent = {0, 0, 0, 0};
@@ -177,8 +222,6 @@ void CpuRenderer::Render(const allocation::ImageMetadata& render_target,
     uint32_t rectangle_width = static_cast<uint32_t>(rectangle.extent.x);
     uint32_t rectangle_height = static_cast<uint32_t>(rectangle.extent.y);
 
-    constexpr uint64_t kBytesPerPixel = 4;
-
     // |allocation::kInvalidImageId| indicates solid fill color. Create and fill vmo for common ops.
     if (image_id == allocation::kInvalidImageId) {
       image.width = rectangle_width;
@@ -192,9 +235,16 @@ void CpuRenderer::Render(const allocation::ImageMetadata& render_target,
       zx::vmo::create(kBytesPerPixel * rectangle_width * rectangle_height, 0, &solid_fill_vmo);
       MapHostPointer(solid_fill_vmo, flatland::HostPointerAccessMode::kWriteOnly,
                      [&image](uint8_t* vmo_ptr, uint32_t num_bytes) {
-                       for (uint32_t i = 0; i < num_bytes; ++i) {
-                         vmo_ptr[i] =
-                             static_cast<uint8_t>(255 * image.multiply_color[i % kBytesPerPixel]);
+                       // Convert the color once and then fill whole pixels with it.
+                       uint8_t color[kBytesPerPixel];
+                       for (uint32_t i = 0; i < kBytesPerPixel; ++i) {
+                         color[i] = static_cast<uint8_t>(255 * image.multiply_color[i]);
+                       }
+                       uint32_t pixel;
+                       memcpy(&pixel, color, sizeof(pixel));
+                       const uint32_t num_pixels = num_bytes / kBytesPerPixel;
+                       for (uint32_t i = 0; i < num_pixels; ++i) {
+                         memcpy(vmo_ptr + i * kBytesPerPixel, &pixel, sizeof(pixel));
                        }
                      });
       image_map_[allocation::kInvalidImageId] =
@@ -250,6 +300,15 @@ void CpuRenderer::Render(const allocation::ImageMetadata& render_target,
                            uint32_t min_height = std::min(image.height, render_target.height);
                            uint32_t min_width = std::min(image.width, render_target.width);
 
+                           // When both buffers are laid out identically, copy them in one go.
+                           if (image_type == render_type && IsRgbaOrBgra(image_type) &&
+                               image_pixels_per_row == render_target_pixels_per_row &&
+                               min_width == image_pixels_per_row) {
+                             memcpy(render_target_ptr, image_ptr,
+                                    static_cast<size_t>(min_height) * min_width * kBytesPerPixel);
+                             return;
+                           }
+
                            // Avoid allocation in the inner loop.
                            std::vector<uint8_t> color;
                            color.reserve(kBytesPerPixel);
@@ -259,16 +318,11 @@ void CpuRenderer::Render(const allocation::ImageMetadata& render_target,
                              // Note that the stride of the buffer may be different
                              // than the width of the image due to memory alignment, so we use the
                              // pixels per row instead.
-                             for (uint32_t x = 0; x < min_width; x++) {
-                               utils::Pixel pixel = utils::Pixel::FromVmo(
-                                   image_ptr, image_pixels_per_row, x, y, image_type);
-                               pixel.ToFormat(render_type, color);
-                               uint32_t start = y * render_target_pixels_per_row * kBytesPerPixel +
-                                                x * kBytesPerPixel;
-                               for (uint32_t offset = 0; offset < kBytesPerPixel; offset++) {
-                                 render_target_ptr[start + offset] = color[offset];
-                               }
-                             }
+                             CopyRow(image_ptr, image_pixels_per_row, y, min_width, image_type,
+                                     render_target_ptr + static_cast<size_t>(y) *
+                                                             render_target_pixels_per_row *
+                                                             kBytesPerPixel,
+                                     render_type, color);
                            }
                          });
         });
@@ -56,6 +56,18 @@ class Renderer : public allocation::BufferCollectionImporter {
                       const std::vector<zx::event>& release_fences = {},
                       bool apply_color_conversion = false) = 0;
 
+  // Same as Render(), but only |region| of |render_target|, in pixels, needs to be rendered: the
+  // caller guarantees that the rest of |render_target| already holds what Render() would produce
+  // there, because it was rendered from the same content before. Renderers that can't make use of
+  // this render the whole target.
+  virtual void RenderRegion(const allocation::ImageMetadata& render_target,
+                            const std::vector<ImageRect>& rectangles,
+                            const std::vector<allocation::ImageMetadata>& images,
+                            const std::vector<zx::event>& release_fences,
+                            bool apply_color_conversion, const ImageRect& region) {
+    Render(render_target, rectangles, images, release_fences, apply_color_conversion);
+  }
+
   // Values needed to adjust the color of the framebuffer as a postprocessing effect.
   virtual void SetColorConversionValues(const std::array<float, 9>& coefficients,
                                         const std::array<float, 3>& preoffsets,
@@ -176,6 +176,15 @@ std::vector<escher::Rectangle2D> GetNormalizedUvRects(
   return normalized_rects;
 }
 
+// Returns the pixels of a |width| x |height| target covered by |region|, rounded outwards.
+vk::Rect2D GetRenderArea(const flatland::ImageRect& region, uint32_t width, uint32_t height) {
+  const glm::vec2 size(static_cast<float>(width), static_cast<float>(height));
+  const glm::vec2 min = glm::clamp(glm::floor(region.origin), glm::vec2(0.f), size);
+  const glm::vec2 max = glm::clamp(glm::ceil(region.origin + region.extent), min, size);
+  return vk::Rect2D({static_cast<int32_t>(min.x), static_cast<int32_t>(min.y)},
+                    {static_cast<uint32_t>(max.x - min.x), static_cast<uint32_t>(max.y - min.y)});
+}
+
 std::atomic<uint64_t> next_buffer_collection_id = 1;
 
 uint64_t GetNextBufferCollectionId() { return next_buffer_collection_id++; }
@@ -783,6 +792,28 @@ void VkRenderer::Render(const ImageMetadata& render_target,
                         const std::vector<zx::event>& release_fences, bool apply_color_conversion) {
   FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
   TRACE_DURATION("gfx", "VkRenderer::Render");
+  RenderInternal(render_target, rectangles, images, release_fences, apply_color_conversion,
+                 /*region=*/std::nullopt);
+}
+
+void VkRenderer::RenderRegion(const ImageMetadata& render_target,
+                              const std::vector<ImageRect>& rectangles,
+                              const std::vector<ImageMetadata>& images,
+                              const std::vector<zx::event>& release_fences,
+                              bool apply_color_conversion, const ImageRect& region) {
+  FX_DCHECK(main_dispatcher_ == async_get_default_dispatcher());
+  TRACE_DURATION("gfx", "VkRenderer::RenderRegion", "x", region.origin.x, "y", region.origin.y,
+                 "width", region.extent.x, "height", region.extent.y);
+  RenderInternal(render_target, rectangles, images, release_fences, apply_color_conversion,
+                 region);
+}
+
+void VkRenderer::RenderInternal(const ImageMetadata& render_target,
+                                const std::vector<ImageRect>& rectangles,
+                                const std::vector<ImageMetadata>& images,
+                                const std::vector<zx::event>& release_fences,
+                                bool apply_color_conversion,
+                                const std::optional<ImageRect>& region) {
 
   FX_DCHECK(rectangles.size() == images.size())
       << "# rects: " << rectangles.size() << " and #images: " << images.size();
@@ -864,18 +895,30 @@ void VkRenderer::Render(const ImageMetadata& render_target,
   const auto output_image = local_render_target_map.at(render_target.identifier);
   const auto depth_texture = local_depth_target_map.at(render_target.identifier);
 
+  // A render target that was just imported holds nothing yet, so it has to be rendered in full.
+  std::optional<vk::Rect2D> render_area;
+  if (region &&
+      local_pending_render_targets.find(render_target.identifier) ==
+          local_pending_render_targets.end()) {
+    render_area = GetRenderArea(*region, output_image->width(), output_image->height());
+  }
+
   // Transition to eColorAttachmentOptimal for rendering.  Note the src queue family is FOREIGN,
-  // since we assume that this image was previously presented to the display controller.
+  // since we assume that this image was previously presented to the display controller. When only
+  // part of the image is rendered, the rest of its contents must be kept, so the transition is
+  // from the eGeneral layout it was presented in rather than from eUndefined.
   auto render_image_layout = vk::ImageLayout::eColorAttachmentOptimal;
-  command_buffer->impl()->TransitionImageLayout(output_image, vk::ImageLayout::eUndefined,
-                                                render_image_layout, VK_QUEUE_FAMILY_FOREIGN_EXT,
-                                                escher_->device()->vk_main_queue_family());
-
-  const auto normalized_rects = GetNormalizedUvRects(rectangles, images);
-
-  // Now the compositor can finally draw.
-  compositor_.DrawBatch(command_buffer, normalized_rects, textures, color_data, output_image,
-                        depth_texture, apply_color_conversion);
+  command_buffer->impl()->TransitionImageLayout(
+      output_image, render_area ? vk::ImageLayout::eGeneral : vk::ImageLayout::eUndefined,
+      render_image_layout, VK_QUEUE_FAMILY_FOREIGN_EXT, escher_->device()->vk_main_queue_family());
+
+  // Now the compositor can finally draw. Nothing needs drawing if the region is empty, but the
+  // frame is still submitted so that the release fences are signaled.
+  if (!render_area || (render_area->extent.width > 0 && render_area->extent.height > 0)) {
+    const auto normalized_rects = GetNormalizedUvRects(rectangles, images);
+    compositor_.DrawBatch(command_buffer, normalized_rects, textures, color_data, output_image,
+                          depth_texture, apply_color_conversion, render_area);
+  }
 
   const auto readback_image_it = local_readback_image_map.find(render_target.identifier);
   // Copy to the readback image if there is a readback image.
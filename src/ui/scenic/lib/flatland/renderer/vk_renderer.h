@@ -60,6 +60,13 @@ class VkRenderer final : public Renderer {
               const std::vector<zx::event>& release_fences = {},
               bool apply_color_conversion = false) override;
 
+  // |Renderer|.
+  // Only called from the main thread.
+  void RenderRegion(const ImageMetadata& render_target, const std::vector<ImageRect>& rectangles,
+                    const std::vector<ImageMetadata>& images,
+                    const std::vector<zx::event>& release_fences, bool apply_color_conversion,
+                    const ImageRect& region) override;
+
   // |Renderer|.
   // Only called from the main thread.
   void SetColorConversionValues(const std::array<float, 9>& coefficients,
@@ -131,6 +138,13 @@ class VkRenderer final : public Renderer {
                                     vk::BufferCollectionFUCHSIA collection)
       FXL_LOCKS_EXCLUDED(lock_);
 
+  // Shared implementation of Render() and RenderRegion(). If |region| is set, only the pixels of
+  // |render_target| it touches are cleared and drawn, and the rest keep their contents.
+  void RenderInternal(const ImageMetadata& render_target, const std::vector<ImageRect>& rectangles,
+                      const std::vector<ImageMetadata>& images,
+                      const std::vector<zx::event>& release_fences, bool apply_color_conversion,
+                      const std::optional<ImageRect>& region);
+
   // Copies |source_image| into |dest_image|.
   void BlitRenderTarget(escher::CommandBuffer* command_buffer, escher::ImagePtr source_image,
                         vk::ImageLayout* source_image_layout, escher::ImagePtr dest_image,
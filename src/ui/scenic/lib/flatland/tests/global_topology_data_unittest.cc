@@ -211,6 +211,57 @@ TEST(GlobalTopologyDataTest, GlobalTopologyIncompleteLink) {
   EXPECT_THAT(output.parent_indices, ::testing::ElementsAreArray(expected_parent_indices));
 }
 
+TEST(GlobalTopologyDataTest, IsTopologyUnchanged) {
+  UberStruct::InstanceMap uber_structs;
+  GlobalTopologyData::LinkTopologyMap links;
+
+  const auto link_2 = GetInternalLinkHandle(2);
+
+  const TransformGraph::TopologyVector vectors[] = {{{{1, 0}, 1}, {link_2, 0}},  // 1:0 - 0:2
+                                                    {{{2, 0}, 0}}};              // 2:0
+
+  MakeLink(links, 2);  // 0:2 - 2:0
+
+  for (const auto& v : vectors) {
+    auto uber_struct = std::make_unique<UberStruct>();
+    uber_struct->local_topology = v;
+    uber_structs[v[0].handle.GetInstanceId()] = std::move(uber_struct);
+  }
+
+  EXPECT_TRUE(GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, uber_structs, links));
+
+  // A new UberStruct that only changes a matrix leaves the topology unchanged.
+  auto next_uber_structs = uber_structs;
+  auto uber_struct = std::make_unique<UberStruct>();
+  uber_struct->local_topology = vectors[1];
+  uber_struct->local_matrices[{2, 0}] = glm::scale(glm::mat3(), {2.f, 2.f});
+  next_uber_structs[2] = std::move(uber_struct);
+  EXPECT_TRUE(
+      GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, next_uber_structs, links));
+
+  // Changing the local topology does not.
+  uber_struct = std::make_unique<UberStruct>();
+  uber_struct->local_topology = {{{2, 0}, 1}, {{2, 1}, 0}};
+  next_uber_structs[2] = std::move(uber_struct);
+  EXPECT_FALSE(
+      GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, next_uber_structs, links));
+
+  // Neither does changing a clip region.
+  uber_struct = std::make_unique<UberStruct>();
+  uber_struct->local_topology = vectors[1];
+  uber_struct->local_clip_regions[{2, 0}] = {.x = 0, .y = 0, .width = 10, .height = 10};
+  next_uber_structs[2] = std::move(uber_struct);
+  EXPECT_FALSE(
+      GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, next_uber_structs, links));
+
+  // Nor does removing a link, or adding an instance.
+  EXPECT_FALSE(GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, uber_structs, {}));
+  next_uber_structs = uber_structs;
+  next_uber_structs[3] = std::make_unique<UberStruct>();
+  EXPECT_FALSE(
+      GlobalTopologyData::IsTopologyUnchanged(uber_structs, links, next_uber_structs, links));
+}
+
 TEST(GlobalTopologyDataTest, GlobalTopologyLinksMismatchedUberStruct) {
   UberStruct::InstanceMap uber_structs;
   GlobalTopologyData::LinkTopologyMap links;
@@ -187,6 +187,63 @@ TEST(GlobalMatrixDataTest, GlobalMatricesMultipleUberStructs) {
   EXPECT_THAT(global_matrices, ::testing::ElementsAreArray(expected_matrices));
 }
 
+TEST(GlobalMatrixDataTest, IncrementalGlobalMatricesMatchFullComputation) {
+  UberStruct::InstanceMap uber_structs;
+
+  // Make a global topology representing the following graph:
+  //
+  // 1:0 - 2:0 - 2:1
+  //       //       1:1
+  GlobalTopologyData::TopologyVector topology_vector = {{1, 0}, {2, 0}, {2, 1}, {1, 1}};
+  GlobalTopologyData::ParentIndexVector parent_indices = {0, 0, 1, 0};
+
+  auto uber_struct1 = std::make_unique<UberStruct>();
+  uber_struct1->local_matrices[{1, 0}] = glm::scale(glm::mat3(), {2.f, 2.f});
+  uber_struct1->local_matrices[{1, 1}] = glm::scale(glm::mat3(), {3.f, 3.f});
+  auto uber_struct2 = std::make_unique<UberStruct>();
+  uber_struct2->local_matrices[{2, 1}] = glm::scale(glm::mat3(), {5.f, 5.f});
+  uber_structs[1] = std::move(uber_struct1);
+  uber_structs[2] = std::move(uber_struct2);
+
+  const auto global_matrices = ComputeGlobalMatrices(topology_vector, parent_indices, uber_structs);
+
+  // Nothing changed, so nothing is recomputed.
+  EXPECT_THAT(ComputeGlobalMatrices(topology_vector, parent_indices, uber_structs, uber_structs,
+                                    global_matrices),
+              ::testing::ElementsAreArray(global_matrices));
+
+  // Moving 2:0 changes its own matrix and its child's, but not those of instance 1.
+  auto next_uber_structs = uber_structs;
+  uber_struct2 = std::make_unique<UberStruct>();
+  uber_struct2->local_matrices[{2, 0}] = glm::scale(glm::mat3(), {7.f, 7.f});
+  uber_struct2->local_matrices[{2, 1}] = glm::scale(glm::mat3(), {5.f, 5.f});
+  next_uber_structs[2] = std::move(uber_struct2);
+
+  std::vector<glm::mat3> expected_matrices = {
+      glm::scale(glm::mat3(), glm::vec2(2.f)),   // 1:0 = 2
+      glm::scale(glm::mat3(), glm::vec2(14.f)),  // 1:0 * 2:0 = 2 * 7 = 14
+      glm::scale(glm::mat3(), glm::vec2(70.f)),  // 1:0 * 2:0 * 2:1 = 2 * 7 * 5 = 70
+      glm::scale(glm::mat3(), glm::vec2(6.f)),   // 1:0 * 1:1 = 2 * 3 = 6
+  };
+  EXPECT_THAT(ComputeGlobalMatrices(topology_vector, parent_indices, next_uber_structs,
+                                    uber_structs, global_matrices),
+              ::testing::ElementsAreArray(expected_matrices));
+
+  // Moving the root changes every matrix.
+  uber_struct1 = std::make_unique<UberStruct>();
+  uber_struct1->local_matrices[{1, 1}] = glm::scale(glm::mat3(), {3.f, 3.f});
+  next_uber_structs[1] = std::move(uber_struct1);
+  expected_matrices = {
+      glm::mat3(),
+      glm::scale(glm::mat3(), glm::vec2(7.f)),
+      glm::scale(glm::mat3(), glm::vec2(35.f)),
+      glm::scale(glm::mat3(), glm::vec2(3.f)),
+  };
+  EXPECT_THAT(ComputeGlobalMatrices(topology_vector, parent_indices, next_uber_structs,
+                                    uber_structs, global_matrices),
+              ::testing::ElementsAreArray(expected_matrices));
+}
+
 // The following tests ensure that different clip boundaries affect rectangles in the proper manner.
 
 // Test that if a clip region is completely larger than the rectangle, it has no effect on the
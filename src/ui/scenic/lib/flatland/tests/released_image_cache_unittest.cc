@@ -0,0 +1,118 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ui/scenic/lib/flatland/released_image_cache.h"
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/lib/testing/loop_fixture/test_loop_fixture.h"
+#include "src/ui/scenic/lib/allocation/id.h"
+#include "src/ui/scenic/lib/allocation/mock_buffer_collection_importer.h"
+
+using allocation::ImageMetadata;
+using allocation::MockBufferCollectionImporter;
+using testing::_;
+
+namespace flatland {
+namespace test {
+
+class ReleasedImageCacheTest : public gtest::TestLoopFixture {
+ protected:
+  std::shared_ptr<ReleasedImageCache> MakeCache(zx::duration grace_period) {
+    return std::make_shared<ReleasedImageCache>(
+        dispatcher(), std::vector<std::shared_ptr<allocation::BufferCollectionImporter>>{importer_},
+        grace_period);
+  }
+
+  static ImageMetadata MakeImage(uint32_t vmo_index, uint32_t width = 100) {
+    return {.collection_id = 1,
+            .identifier = allocation::GenerateUniqueImageId(),
+            .vmo_index = vmo_index,
+            .width = width,
+            .height = 100};
+  }
+
+  std::shared_ptr<MockBufferCollectionImporter> importer_ =
+      std::make_shared<testing::StrictMock<MockBufferCollectionImporter>>();
+};
+
+TEST_F(ReleasedImageCacheTest, ZeroGracePeriodReleasesImmediately) {
+  auto cache = MakeCache(zx::duration(0));
+  const ImageMetadata image = MakeImage(0);
+  cache->OnImageImported(image);
+
+  EXPECT_CALL(*importer_, ReleaseBufferImage(image.identifier)).Times(1);
+  cache->Release(image.identifier);
+  EXPECT_EQ(cache->parked_image_count(), 0u);
+  EXPECT_EQ(cache->Take(image), allocation::kInvalidImageId);
+}
+
+TEST_F(ReleasedImageCacheTest, MatchingImageIsReused) {
+  auto cache = MakeCache(zx::sec(1));
+  const ImageMetadata image = MakeImage(0);
+  cache->OnImageImported(image);
+  cache->Release(image.identifier);
+  EXPECT_EQ(cache->parked_image_count(), 1u);
+
+  // Neither another VMO nor another size of the same VMO matches.
+  EXPECT_EQ(cache->Take(MakeImage(1)), allocation::kInvalidImageId);
+  EXPECT_EQ(cache->Take(MakeImage(0, /*width=*/200)), allocation::kInvalidImageId);
+
+  EXPECT_EQ(cache->Take(MakeImage(0)), image.identifier);
+  EXPECT_EQ(cache->parked_image_count(), 0u);
+
+  // The reused image isn't released when its grace period would have expired.
+  RunLoopFor(zx::sec(2));
+
+  // Once released again, it is parked until the cache is destroyed.
+  cache->Release(image.identifier);
+  EXPECT_EQ(cache->parked_image_count(), 1u);
+  EXPECT_CALL(*importer_, ReleaseBufferImage(image.identifier)).Times(1);
+  cache.reset();
+}
+
+TEST_F(ReleasedImageCacheTest, ReleasedAfterGracePeriod) {
+  auto cache = MakeCache(zx::sec(1));
+  const ImageMetadata first = MakeImage(0);
+  const ImageMetadata second = MakeImage(1);
+  cache->OnImageImported(first);
+  cache->OnImageImported(second);
+
+  cache->Release(first.identifier);
+  RunLoopFor(zx::msec(500));
+  cache->Release(second.identifier);
+
+  EXPECT_CALL(*importer_, ReleaseBufferImage(first.identifier)).Times(1);
+  RunLoopFor(zx::msec(600));
+  testing::Mock::VerifyAndClearExpectations(importer_.get());
+  EXPECT_EQ(cache->parked_image_count(), 1u);
+
+  EXPECT_CALL(*importer_, ReleaseBufferImage(second.identifier)).Times(1);
+  RunLoopFor(zx::msec(500));
+  EXPECT_EQ(cache->parked_image_count(), 0u);
+}
+
+TEST_F(ReleasedImageCacheTest, ReleaseAll) {
+  auto cache = MakeCache(zx::sec(1));
+  const ImageMetadata first = MakeImage(0);
+  const ImageMetadata second = MakeImage(1);
+  cache->OnImageImported(first);
+  cache->OnImageImported(second);
+  cache->Release(first.identifier);
+
+  EXPECT_CALL(*importer_, ReleaseBufferImage(first.identifier)).Times(1);
+  cache->ReleaseAll();
+  testing::Mock::VerifyAndClearExpectations(importer_.get());
+
+  // Images released afterwards aren't parked anymore.
+  EXPECT_CALL(*importer_, ReleaseBufferImage(second.identifier)).Times(1);
+  cache->Release(second.identifier);
+  EXPECT_EQ(cache->parked_image_count(), 0u);
+}
+
+}  // namespace test
+}  // namespace flatland
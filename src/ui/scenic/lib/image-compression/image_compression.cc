@@ -6,8 +6,10 @@
 
 #include <lib/async/cpp/task.h>
 #include <lib/async/dispatcher.h>
+#include <lib/fzl/vmo-mapper.h>
 #include <lib/syslog/cpp/macros.h>
 
+#include <cstring>
 #include <iostream>
 
 // PNG Imports
@@ -22,6 +24,19 @@
 
 namespace image_compression {
 
+namespace {
+
+// Where libpng writes the encoded image to.
+struct PngOutput {
+  zx::vmo* vmo;
+  // |vmo| mapped into memory, or null if it couldn't be mapped and has to be written to instead.
+  uint8_t* mapped = nullptr;
+  size_t capacity;
+  size_t size = 0;
+};
+
+}  // namespace
+
 void ImageCompression::EncodePng(EncodePngRequest& request, EncodePngCompleter::Sync& completer) {
   // This is an async protocol.
   auto async_completer = completer.ToAsync();
@@ -68,6 +83,35 @@ void ImageCompression::EncodePng(EncodePngRequest& request, EncodePngCompleter::
     return;
   }
 
+  // Read the raw image in place when possible, rather than copying it out of the VMO first.
+  fzl::VmoMapper raw_mapper;
+  std::vector<uint8_t> imgdata;
+  const uint8_t* raw_ptr = nullptr;
+  if (raw_mapper.Map(raw_image.vmo(), 0, 0, ZX_VM_PERM_READ) == ZX_OK) {
+    raw_ptr = reinterpret_cast<const uint8_t*>(raw_mapper.start());
+  } else if (fsl::VectorFromVmo(raw_image, &imgdata)) {
+    raw_ptr = imgdata.data();
+  } else {
+    FX_LOGS(WARNING) << "ImageCompression::EncodePng(): Cannot extract data from raw image VMO";
+    async_completer.Reply(
+        fit::as_error(fuchsia::ui::compression::internal::ImageCompressionError::BAD_OPERATION));
+    return;
+  }
+
+  // Stream the encoded output straight into |png_vmo|, mapped if it can be.
+  PngOutput output = {.vmo = &*request.png_vmo(), .capacity = png_vmo_size};
+  fzl::VmoMapper png_mapper;
+  if (png_mapper.Map(*request.png_vmo(), 0, png_vmo_size,
+                     ZX_VM_PERM_READ | ZX_VM_PERM_WRITE | ZX_VM_ALLOW_FAULTS) == ZX_OK) {
+    output.mapped = reinterpret_cast<uint8_t*>(png_mapper.start());
+  }
+
+  // Give libpng a pointer to each pixel at the beginning of each row.
+  std::vector<uint8_t*> rows(height);
+  for (size_t y = 0; y < height; ++y) {
+    rows[y] = const_cast<uint8_t*>(raw_ptr) + y * stride;
+  }
+
   // Start libpng specific operations.
   png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
   if (!png_ptr) {
@@ -85,9 +129,11 @@ void ImageCompression::EncodePng(EncodePngRequest& request, EncodePngCompleter::
     return;
   }
 
-  // This is libpng obscure syntax for setting up the error handler.
+  // This is libpng obscure syntax for setting up the error handler: libpng errors, including
+  // running out of space in |png_vmo|, jump back here.
   if (setjmp(png_jmpbuf(png_ptr))) {
-    FX_LOGS(WARNING) << "ImageCompression::EncodePng(): Cannot set libpng error handler";
+    FX_LOGS(WARNING) << "ImageCompression::EncodePng(): libpng failed to encode the image";
+    png_destroy_write_struct(&png_ptr, &info_ptr);
     async_completer.Reply(
         fit::as_error(fuchsia::ui::compression::internal::ImageCompressionError::BAD_OPERATION));
     return;
@@ -99,40 +145,43 @@ void ImageCompression::EncodePng(EncodePngRequest& request, EncodePngCompleter::
   png_set_IHDR(png_ptr, info_ptr, (uint32_t)width, (uint32_t)height, bit_depth, PNG_COLOR_TYPE_RGBA,
                PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 
-  std::vector<uint8_t> imgdata;
-  if (!fsl::VectorFromVmo(raw_image, &imgdata)) {
-    FX_LOGS(WARNING) << "ImageCompression::EncodePng(): Cannot extract data from raw image VMO";
-    async_completer.Reply(
-        fit::as_error(fuchsia::ui::compression::internal::ImageCompressionError::BAD_OPERATION));
-    return;
-  }
+  // By default libpng tries all five filters on every row to pick the best one, which costs about
+  // as much as the compression itself. Sub and Up together catch the flat areas and repeated rows
+  // that screenshots are mostly made of.
+  png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB | PNG_FILTER_UP);
+  png_set_compression_level(png_ptr, compression_level_);
 
-  // Give libpng a pointer to each pixel at the beginning of each row.
-  std::vector<uint8_t*> rows(height);
-  for (size_t y = 0; y < height; ++y) {
-    rows[y] = imgdata.data() + y * stride;
-  }
   png_set_rows(png_ptr, info_ptr, rows.data());
 
   // Tell libpng how to process each row.
-  std::vector<uint8_t> pixels;
   png_set_write_fn(
-      png_ptr, &pixels,
+      png_ptr, &output,
       [](png_structp png_ptr, png_bytep data, png_size_t length) {
-        auto p = reinterpret_cast<std::vector<uint8_t>*>(png_get_io_ptr(png_ptr));
-        p->insert(p->end(), data, data + length);
+        auto* output = reinterpret_cast<PngOutput*>(png_get_io_ptr(png_ptr));
+        if (length > output->capacity - output->size) {
+          png_error(png_ptr, "png_vmo is too small");
+        }
+        if (output->mapped) {
+          memcpy(output->mapped + output->size, data, length);
+        } else if (output->vmo->write(data, output->size, length) != ZX_OK) {
+          png_error(png_ptr, "Cannot write to png_vmo");
+        }
+        output->size += length;
       },
       nullptr);
 
-  // This is actually the blocking call. At the end, the info and image will be written to |pixels|.
-  // Note the swizzle flag, which instructs the library to read from BGRA data.
+  // This is actually the blocking call. At the end, the info and image will be written to
+  // |png_vmo|. Note the swizzle flag, which instructs the library to read from BGRA data.
   png_write_png(png_ptr, info_ptr, PNG_TRANSFORM_BGR, nullptr);
+  png_destroy_write_struct(&png_ptr, &info_ptr);
+
+  // The VMO can't be resized while it is mapped.
+  png_mapper.Unmap();
 
   // This may fail if the client does not allow resizing - but that's okay as it's not necessary.
-  request.png_vmo()->set_size(pixels.size());
+  request.png_vmo()->set_size(output.size);
 
   // Success!
-  request.png_vmo()->write(pixels.data(), 0, pixels.size() * sizeof(uint8_t));
   async_completer.Reply(fit::ok());
 }
 
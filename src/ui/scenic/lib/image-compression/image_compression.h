@@ -16,6 +16,16 @@ namespace image_compression {
 // This class implements the ImageCompressor protocol.
 class ImageCompression : public fidl::Server<fuchsia_ui_compression_internal::ImageCompressor> {
  public:
+  // The zlib compression level used by default. Screenshots are usually decoded once and then
+  // discarded, so speed matters more than size: higher levels take several times longer on large
+  // images for a modestly smaller output.
+  static constexpr int kDefaultCompressionLevel = 1;
+
+  // |compression_level| is a zlib compression level, from 0 (no compression) to 9 (smallest
+  // output).
+  explicit ImageCompression(int compression_level = kDefaultCompressionLevel)
+      : compression_level_(compression_level) {}
+
   // |fidl::Server<fuchsia_ui_compression_internal::ImageCompressor>|
   void EncodePng(EncodePngRequest& request, EncodePngCompleter::Sync& completer) override;
 
@@ -32,6 +42,7 @@ class ImageCompression : public fidl::Server<fuchsia_ui_compression_internal::Im
   void OnFidlClosed(fidl::UnbindInfo info) {}
 
  private:
+  const int compression_level_;
   fidl::ServerBindingGroup<fuchsia_ui_compression_internal::ImageCompressor> bindings_;
 };
 
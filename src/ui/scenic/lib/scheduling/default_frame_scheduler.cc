@@ -386,10 +386,11 @@ void DefaultFrameScheduler::RemoveSession(SessionId session_id) {
   RemoveSessionIdFromMap(session_id, &presents_);
   RemoveSessionIdFromMap(session_id, &pending_present_requests_);
   RemoveSessionIdFromMap(session_id, &release_fences_);
+  stats_.RemoveSession(session_id);
 }
 
 std::unordered_map<SessionId, PresentId> DefaultFrameScheduler::CollectUpdatesForThisFrame(
-    zx::time target_presentation_time) {
+    zx::time target_presentation_time, std::unordered_map<SessionId, zx::time>& deadlines) {
   std::unordered_map<SessionId, PresentId> updates;
 
   SessionId current_session = scheduling::kInvalidSessionId;
@@ -410,7 +411,13 @@ std::unordered_map<SessionId, PresentId> DefaultFrameScheduler::CollectUpdatesFo
         sessions_with_unsquashable_updates_pending_presentation_.count(id_pair.session_id) == 0) {
       TRACE_FLOW_END("gfx", "request_to_render", present_request.flow_id);
       // Return only the last relevant present id for each session.
+      const bool first_update = updates.find(current_session) == updates.end();
       updates[current_session] = id_pair.present_id;
+      // Presents are ordered by PresentId, not requested time, so take the earliest.
+      const zx::time deadline =
+          std::max(present_request.requested_presentation_time, target_presentation_time);
+      deadlines[current_session] =
+          first_update ? deadline : std::min(deadlines[current_session], deadline);
       if (!present_request.squashable) {
         sessions_with_unsquashable_updates_pending_presentation_.emplace(id_pair.session_id);
       }
@@ -427,9 +434,13 @@ std::unordered_map<SessionId, PresentId> DefaultFrameScheduler::CollectUpdatesFo
 }
 
 std::vector<zx::event> DefaultFrameScheduler::PrepareUpdates(
-    const std::unordered_map<SessionId, PresentId>& updates, zx::time latched_time,
+    const std::unordered_map<SessionId, PresentId>& updates,
+    std::unordered_map<SessionId, zx::time> deadlines, zx::time latched_time,
     uint64_t frame_number) {
-  latched_updates_.push({.frame_number = frame_number, .updated_sessions = updates});
+  latched_updates_.push({.frame_number = frame_number,
+                         .updated_sessions = updates,
+                         .deadlines = std::move(deadlines),
+                         .latched_time = latched_time});
   std::vector<zx::event> fences;
 
   for (const auto& [session_id, present_id] : updates) {
@@ -480,9 +491,11 @@ bool DefaultFrameScheduler::ApplyUpdates(zx::time target_presentation_time, zx::
 
   TRACE_FLOW_BEGIN("gfx", "scenic_frame", frame_number);
 
-  const auto update_map = CollectUpdatesForThisFrame(target_presentation_time);
+  std::unordered_map<SessionId, zx::time> deadlines;
+  const auto update_map = CollectUpdatesForThisFrame(target_presentation_time, deadlines);
   const bool have_updates = !update_map.empty();
-  auto fences_from_previous_presents = PrepareUpdates(update_map, latched_time, frame_number);
+  auto fences_from_previous_presents =
+      PrepareUpdates(update_map, std::move(deadlines), latched_time, frame_number);
   update_sessions_(update_map, frame_number, std::move(fences_from_previous_presents));
 
   // If anything was updated, we need to render.
@@ -495,9 +508,16 @@ void DefaultFrameScheduler::SignalPresentedUpTo(uint64_t frame_number, zx::time
   std::unordered_map<SessionId, PresentId> last_updates;
   std::unordered_map<SessionId, std::map<PresentId, zx::time>> latched_times;
   while (!latched_updates_.empty() && latched_updates_.front().frame_number <= frame_number) {
-    for (const auto& [session_id, present_id] : latched_updates_.front().updated_sessions) {
+    const FrameUpdate& frame_update = latched_updates_.front();
+    for (const auto& [session_id, present_id] : frame_update.updated_sessions) {
       last_updates[session_id] = present_id;
     }
+    // Updates latched for frames that were dropped are only presented now, so they count against
+    // their sessions' deadlines too.
+    for (const auto& [session_id, deadline] : frame_update.deadlines) {
+      stats_.RecordSessionUpdate(session_id, frame_update.latched_time, deadline,
+                                 presentation_time, presentation_interval);
+    }
     latched_updates_.pop();
   }
 
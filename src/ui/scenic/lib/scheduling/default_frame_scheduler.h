@@ -124,13 +124,16 @@ class DefaultFrameScheduler final : public FrameScheduler {
   void SetLatchedTimeForPresentsUpTo(SchedulingIdPair id_pair, zx::time latched_time);
 
   // Extracts all presents that should be updated this frame and returns them as a map of SessionIds
-  // to the last PresentId that should be updated for that session.
+  // to the last PresentId that should be updated for that session. |deadlines| is filled with the
+  // presentation deadline of each of those sessions: the earliest requested presentation time of
+  // its extracted presents, or |target_presentation_time| if that is later.
   std::unordered_map<SessionId, PresentId> CollectUpdatesForThisFrame(
-      zx::time target_presentation_time);
+      zx::time target_presentation_time, std::unordered_map<SessionId, zx::time>& deadlines);
 
   // Prepares all per-present data for later OnFrameRendered and OnFramePresented events.
   // Returns all the fences from previous presents for each session in |updates|.
   std::vector<zx::event> PrepareUpdates(const std::unordered_map<SessionId, PresentId>& updates,
+                                        std::unordered_map<SessionId, zx::time> deadlines,
                                         zx::time latched_time, uint64_t frame_number);
 
   struct PresentRequest {
@@ -148,6 +151,8 @@ class DefaultFrameScheduler final : public FrameScheduler {
   struct FrameUpdate {
     uint64_t frame_number;
     std::unordered_map<SessionId, PresentId> updated_sessions;
+    // The deadline of each session in |updated_sessions|, used for the per-session stats.
+    std::unordered_map<SessionId, zx::time> deadlines;
     zx::time latched_time;
   };
   // Queue of session updates mapped to frame numbers. Used in OnFramePresented.
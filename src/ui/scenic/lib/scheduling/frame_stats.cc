@@ -79,6 +79,22 @@ void FrameStats::RecordFrame(Timestamps timestamps, zx::duration display_vsync_i
                                                       timestamps.render_start_time)]++;
 }
 
+void FrameStats::RecordSessionUpdate(SessionId session_id, zx::time latch_point_time,
+                                     zx::time deadline, zx::time actual_presentation_time,
+                                     zx::duration display_vsync_interval) {
+  FX_DCHECK(actual_presentation_time != kTimeDropped);
+  SessionStats& stats = session_stats_[session_id];
+  ++stats.presented_updates;
+  stats.latch_to_presentation_time += actual_presentation_time - latch_point_time;
+  if (actual_presentation_time - (display_vsync_interval / 2) >= deadline) {
+    ++stats.missed_deadlines;
+    TRACE_INSTANT("gfx", "SessionMissedDeadline", TRACE_SCOPE_PROCESS, "session_id", session_id,
+                  "missed by", (actual_presentation_time - deadline).get());
+  }
+}
+
+void FrameStats::RemoveSession(SessionId session_id) { session_stats_.erase(session_id); }
+
 uint32_t FrameStats::GetCobaltBucketIndex(zx::duration duration) {
   return frame_times_bucket_config_->BucketIndex(duration.to_usecs() / 100);
 }
@@ -296,6 +312,29 @@ void FrameStats::ReportStats(inspect::Inspector* insp) const {
     insp->emplace(std::move(node));
   }
 
+  // Stats for each session that is still alive.
+  {
+    inspect::Node node = insp->GetRoot().CreateChild("3 - Per-Session Stats (times in ms)");
+    for (const auto& [session_id, stats] : session_stats_) {
+      inspect::Node session_node = node.CreateChild(std::to_string(session_id));
+      session_node.CreateUint("Presented Update Count", stats.presented_updates, insp);
+      session_node.CreateUint("Missed Deadline Count", stats.missed_deadlines, insp);
+      session_node.CreateDouble("Missed Deadline Percentage",
+                                stats.presented_updates > 0
+                                    ? 100.0 * static_cast<double>(stats.missed_deadlines) /
+                                          static_cast<double>(stats.presented_updates)
+                                    : 0.0,
+                                insp);
+      if (stats.presented_updates > 0) {
+        session_node.CreateUint(
+            "Mean Latch To Presentation Time",
+            (stats.latch_to_presentation_time / stats.presented_updates).to_msecs(), insp);
+      }
+      insp->emplace(std::move(session_node));
+    }
+    insp->emplace(std::move(node));
+  }
+
   {
     inspect::Node node = insp->GetRoot().CreateChild("frame_history");
 
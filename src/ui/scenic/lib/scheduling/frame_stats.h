@@ -10,6 +10,7 @@
 
 #include <deque>
 #include <functional>
+#include <unordered_map>
 
 #include "lib/inspect/cpp/inspect.h"
 #include "src/ui/scenic/lib/scheduling/frame_scheduler.h"
@@ -34,6 +35,16 @@ class FrameStats {
 
   void RecordFrame(Timestamps timestamps, zx::duration display_vsync_interval);
 
+  // Records that an update of |session_id|, latched at |latch_point_time|, was presented at
+  // |actual_presentation_time|. The update missed its deadline if it was presented on a later
+  // VSYNC than |deadline|, which is the latest of the time the session requested and the
+  // presentation time targeted by the frame that latched it.
+  void RecordSessionUpdate(SessionId session_id, zx::time latch_point_time, zx::time deadline,
+                           zx::time actual_presentation_time, zx::duration display_vsync_interval);
+
+  // Forgets the stats of |session_id|.
+  void RemoveSession(SessionId session_id);
+
   // Time interval between each flush is 10 minutes.
   static constexpr zx::duration kCobaltDataCollectionInterval = zx::min(10);
 
@@ -116,6 +127,17 @@ class FrameStats {
     }
   };
 
+  struct SessionStats {
+    // The number of frames that presented an update of the session.
+    uint64_t presented_updates = 0;
+
+    // The number of those updates that were presented after their deadline.
+    uint64_t missed_deadlines = 0;
+
+    // The total time from latching the session's updates to presenting them.
+    zx::duration latch_to_presentation_time = zx::duration(0);
+  };
+
   static zx::duration CalculateMeanDuration(
       const std::deque<Timestamps>& timestamps,
       std::function<zx::duration(const Timestamps&)> duration_func, uint32_t percentile);
@@ -154,6 +176,8 @@ class FrameStats {
   // Ring buffer of stats for the last kNumMinutesHistory minutes of frame timings.
   std::deque<HistoryStats> history_stats_;
 
+  std::unordered_map<SessionId, SessionStats> session_stats_;
+
   inspect::Node inspect_node_;
   inspect::LazyNode inspect_frame_stats_dump_;
 
@@ -433,6 +433,57 @@ TEST_F(FrameStatsTest, HistoryPopulatedOverTime) {
   }
 }
 
+TEST_F(FrameStatsTest, PerSessionStats) {
+  FrameStats stats(inspector_.GetRoot().CreateChild(kFrameStatsNodeName), nullptr);
+  const std::string kPerSessionStats = "3 - Per-Session Stats (times in ms)";
+
+  const zx::duration vsync_interval = zx::msec(16);
+  const zx::time latch_point_time = zx::time(0) + zx::msec(4);
+  const zx::time deadline = zx::time(0) + vsync_interval;
+
+  // Session 1 is on time for 3 updates. Session 2 is on time once and then late by a VSYNC.
+  for (int i = 0; i < 3; i++) {
+    stats.RecordSessionUpdate(1, latch_point_time, deadline, deadline, vsync_interval);
+  }
+  stats.RecordSessionUpdate(2, latch_point_time, deadline, deadline, vsync_interval);
+  stats.RecordSessionUpdate(2, latch_point_time, deadline, deadline + vsync_interval,
+                            vsync_interval);
+
+  {
+    auto root = ReadInspect().take_value();
+    const auto* session_1 = root.GetByPath({kFrameStatsNodeName, kPerSessionStats, "1"});
+    ASSERT_TRUE(session_1);
+    EXPECT_EQ(3U, session_1->node()
+                      .get_property<inspect::UintPropertyValue>("Presented Update Count")
+                      ->value());
+    EXPECT_EQ(0U, session_1->node()
+                      .get_property<inspect::UintPropertyValue>("Missed Deadline Count")
+                      ->value());
+    EXPECT_EQ(12U, session_1->node()
+                       .get_property<inspect::UintPropertyValue>("Mean Latch To Presentation Time")
+                       ->value());
+
+    const auto* session_2 = root.GetByPath({kFrameStatsNodeName, kPerSessionStats, "2"});
+    ASSERT_TRUE(session_2);
+    EXPECT_EQ(2U, session_2->node()
+                      .get_property<inspect::UintPropertyValue>("Presented Update Count")
+                      ->value());
+    EXPECT_EQ(1U, session_2->node()
+                      .get_property<inspect::UintPropertyValue>("Missed Deadline Count")
+                      ->value());
+    EXPECT_EQ(50., session_2->node()
+                       .get_property<inspect::DoublePropertyValue>("Missed Deadline Percentage")
+                       ->value());
+  }
+
+  stats.RemoveSession(2);
+  {
+    auto root = ReadInspect().take_value();
+    EXPECT_TRUE(root.GetByPath({kFrameStatsNodeName, kPerSessionStats, "1"}));
+    EXPECT_FALSE(root.GetByPath({kFrameStatsNodeName, kPerSessionStats, "2"}));
+  }
+}
+
 class FrameStatsMetricsTest : public gtest::TestLoopFixture {};
 
 TEST_F(FrameStatsMetricsTest, LogFrameTimes) {
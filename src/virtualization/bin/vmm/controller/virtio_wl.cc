@@ -8,6 +8,8 @@
 #include <lib/sys/cpp/service_directory.h>
 #include <lib/syslog/cpp/macros.h>
 
+#include <virtio/virtio_ring.h>
+
 namespace {
 
 constexpr auto kComponentName = "virtio_wl";
@@ -17,7 +19,8 @@ constexpr auto kComponentUrl = "#meta/virtio_wl.cm";
 }  // namespace
 
 VirtioWl::VirtioWl(const PhysMem& phys_mem)
-    : VirtioComponentDevice("Virtio WL", phys_mem, VIRTIO_WL_F_TRANS_FLAGS,
+    : VirtioComponentDevice("Virtio WL", phys_mem,
+                            VIRTIO_WL_F_TRANS_FLAGS | (1 << VIRTIO_RING_F_EVENT_IDX),
                             fit::bind_member(this, &VirtioWl::ConfigureQueue),
                             fit::bind_member(this, &VirtioWl::Ready)) {}
 
@@ -51,6 +51,9 @@ class VirtioQueueFake {
   };
   std::optional<UsedElement> NextUsed();
 
+  // Sets the used event, which the device reads when VIRTIO_RING_F_EVENT_IDX is negotiated.
+  void SetUsedEvent(uint16_t index) { *const_cast<uint16_t*>(ring_.used_event) = index; }
+
  private:
   const PhysMem& phys_mem_;
   const zx_gpaddr_t desc_;
@@ -33,40 +33,47 @@ void VirtioQueue::Configure(uint16_t size, zx_gpaddr_t desc, zx_gpaddr_t avail,
 
   const uintptr_t avail_event_addr = used + used_size;
   ring_.avail_event = phys_mem_->aligned_as<uint16_t>(avail_event_addr);
+
+  signalled_used_index_ = 0;
 }
 
-bool VirtioQueue::NextChain(VirtioChain* chain) {
-  uint16_t head;
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    // Validate that we have been configured before proceeding.
-    if (ring_.avail == nullptr) {
-      return false;
-    }
-    uint16_t avail_index = __atomic_load_n(&ring_.avail->idx, __ATOMIC_ACQUIRE);
-    uint16_t length = avail_index - ring_.index;
-    // Validate that:
-    //  1. We have not exceeded the queue length. This protects us from faulty
-    //     clients that have an invalid available index, which can occur if the
-    //     guest driver crashes.
-    //  2. We have not exceeded the available index. This protects us from
-    //     excessive queue notifications from guest drivers, which can occur in
-    //     normal operation as we process the queue asynchronously.
-    if (length > ring_.size || avail_index == ring_.index) {
-      return false;
-    }
+bool VirtioQueue::NextChain(VirtioChain* chain) { return NextChains(chain, 1) == 1; }
+
+size_t VirtioQueue::NextChains(VirtioChain* chains, size_t max_chains) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Validate that we have been configured before proceeding.
+  if (ring_.avail == nullptr) {
+    return 0;
+  }
+  uint16_t avail_index = __atomic_load_n(&ring_.avail->idx, __ATOMIC_ACQUIRE);
+  uint16_t length = avail_index - ring_.index;
+  // Validate that we have not exceeded the queue length. This protects us from faulty clients
+  // that have an invalid available index, which can occur if the guest driver crashes.
+  //
+  // The loop below also stops at the available index. This protects us from excessive queue
+  // notifications from guest drivers, which can occur in normal operation as we process the
+  // queue asynchronously.
+  if (length > ring_.size) {
+    return 0;
+  }
+  size_t count = 0;
+  while (count < max_chains && ring_.index != avail_index) {
     // Validate that the head of the chain does not exceed the queue length.
-    head = ring_.avail->ring[ring_.index % ring_.size];
+    uint16_t head = ring_.avail->ring[ring_.index % ring_.size];
     if (head >= ring_.size) {
-      return false;
+      break;
     }
     ring_.index++;
-    if (use_event_index_) {
-      *ring_.avail_event = ring_.index;
-    }
+    chains[count++] = VirtioChain(this, head);
   }
-  *chain = VirtioChain(this, head);
-  return true;
+  if (count > 0 && use_event_index_) {
+    // Ask the driver to notify us when it makes the next chain available. The driver may have
+    // read the old avail event just before this store, so it must be visible before we next load
+    // the avail index. Doing this once per batch rather than per chain is the point of batching.
+    *ring_.avail_event = ring_.index;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+  return count;
 }
 
 zx_status_t VirtioQueue::NextAvailLocked(uint16_t* index) {
@@ -135,15 +142,17 @@ zx_status_t VirtioQueue::Return(uint16_t index, uint32_t len, uint8_t actions) {
   bool needs_interrupt = false;
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    struct vring_used_elem* used = &ring_.used->ring[ring_.used->idx % ring_.size];
+    uint16_t used_index = ring_.used->idx;
+    struct vring_used_elem* used = &ring_.used->ring[used_index % ring_.size];
     used->id = index;
     used->len = len;
+    used_index++;
     // Update the used index with a release to ensure that all our previous writes are
     // made visible to the guest before it can observe that the index has changed.
     // We do not need the increment to be atomic, we only require that a memory order
     // be enforced, since there will be no other writers to this location and so we
     // can use the cheaper __atomic_store instead of __atomic_add_fetch
-    __atomic_store_n(&ring_.used->idx, ring_.used->idx + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring_.used->idx, used_index, __ATOMIC_RELEASE);
 
     // Must ensure the read of flags or used_event occurs *after* we have returned the chain and
     // published the index. We also need to ensure that in the event we do send an interrupt that
@@ -170,7 +179,14 @@ zx_status_t VirtioQueue::Return(uint16_t index, uint32_t len, uint8_t actions) {
       //      descriptor index was placed) was equal to used_event, the device
       //      MUST send an interrupt.
       //    - Otherwise the device SHOULD NOT send an interrupt.
-      needs_interrupt = ring_.used->idx == (*ring_.used_event + 1);
+      //
+      // Chains returned without TRY_INTERRUPT don't consume the event, so check every index
+      // published since the last attempt. Otherwise a batch whose interrupt is deferred to its
+      // final chain would miss a used_event that fell earlier in the batch.
+      needs_interrupt = vring_need_event(*ring_.used_event, used_index, signalled_used_index_);
+      if (actions & TRY_INTERRUPT) {
+        signalled_used_index_ = used_index;
+      }
     }
   }
 
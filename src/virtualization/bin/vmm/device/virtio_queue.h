@@ -94,6 +94,11 @@ class VirtioQueue {
 
   bool NextChain(VirtioChain* chain);
 
+  // Reads up to |max_chains| descriptor chains from the avail ring into |chains|, and returns the
+  // number read. Each of |chains| that is written must have been invalid. This takes the queue lock
+  // and publishes the avail event once for the whole batch.
+  size_t NextChains(VirtioChain* chains, size_t max_chains);
+
   // Get the index of the next descriptor in the available ring.
   //
   // If a buffer is a available, the descriptor index is written to |index|, the
@@ -123,7 +128,8 @@ class VirtioQueue {
   // The |action| parameter allows the caller to suppress sending an interrupt
   // if (for example) the device is returning several descriptors sequentially.
   // The |SEND_INTERRUPT| flag will still respect any requirements enforced by
-  // the bus regarding interrupt suppression.
+  // the bus regarding interrupt suppression. With event indices, the last
+  // return of a batch accounts for every descriptor returned before it.
   zx_status_t Return(uint16_t index, uint32_t len, uint8_t actions = SET_QUEUE | TRY_INTERRUPT);
 
   // Reads a single descriptor from the queue.
@@ -143,6 +149,8 @@ class VirtioQueue {
   VirtioRing ring_ __TA_GUARDED(mutex_) = {};
   zx::event event_;
   bool use_event_index_ __TA_GUARDED(mutex_) = false;
+  // The used index as of the last return that tried to interrupt the driver.
+  uint16_t signalled_used_index_ __TA_GUARDED(mutex_) = 0;
 
   friend class VirtioQueueFake;
 };
@@ -59,4 +59,73 @@ TEST(VirtioQueueTest, VirtioReadDesc) {
   ASSERT_EQ(queue.ReadDesc(2, &desc), ZX_ERR_OUT_OF_RANGE);
 }
 
+class VirtioQueueEventTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    zx::vmo vmo;
+    ASSERT_EQ(zx::vmo::create(4 * PAGE_SIZE, 0, &vmo), ZX_OK);
+    ASSERT_EQ(phys_mem_.Init(std::move(vmo)), ZX_OK);
+    queue_fake_.Configure(PAGE_SIZE, 3 * PAGE_SIZE);
+    queue_.set_phys_mem(&phys_mem_);
+    queue_.set_interrupt([this](uint8_t actions) {
+      if (actions & VirtioQueue::TRY_INTERRUPT) {
+        interrupts_++;
+      }
+      return ZX_OK;
+    });
+    queue_.Configure(queue_fake_.size(), queue_fake_.desc(), queue_fake_.avail(),
+                     queue_fake_.used());
+  }
+
+  void MakeChains(size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      ASSERT_EQ(DescriptorChainBuilder(queue_fake_).AppendReadableDescriptor(&i, sizeof(i)).Build(),
+                ZX_OK);
+    }
+  }
+
+  PhysMem phys_mem_;
+  VirtioQueueFake queue_fake_{phys_mem_, 0, 16};
+  VirtioQueue queue_;
+  size_t interrupts_ = 0;
+};
+
+TEST_F(VirtioQueueEventTest, NextChainsBatch) {
+  MakeChains(3);
+
+  VirtioChain chains[4];
+  ASSERT_EQ(queue_.NextChains(chains, 4), 3u);
+  EXPECT_TRUE(chains[2].IsValid());
+  EXPECT_FALSE(chains[3].IsValid());
+  EXPECT_EQ(queue_.NextChains(chains + 3, 1), 0u);
+
+  for (size_t i = 0; i < 3; i++) {
+    chains[i].Return();
+  }
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_TRUE(queue_fake_.NextUsed().has_value());
+  }
+  EXPECT_FALSE(queue_fake_.NextUsed().has_value());
+}
+
+TEST_F(VirtioQueueEventTest, EventIndexCoversDeferredReturns) {
+  queue_.set_use_event_index(true);
+  MakeChains(3);
+
+  VirtioChain chains[3];
+  ASSERT_EQ(queue_.NextChains(chains, 3), 3u);
+
+  // The driver wants an interrupt once the first chain is used. The device defers the interrupt
+  // to the second return, which must still send it.
+  queue_fake_.SetUsedEvent(0);
+  chains[0].Return(VirtioQueue::SET_QUEUE);
+  EXPECT_EQ(interrupts_, 0u);
+  chains[1].Return();
+  EXPECT_EQ(interrupts_, 1u);
+
+  // The event has already passed, so the last return is suppressed.
+  chains[2].Return();
+  EXPECT_EQ(interrupts_, 1u);
+}
+
 }  // namespace
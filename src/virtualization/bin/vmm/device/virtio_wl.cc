@@ -20,6 +20,7 @@
 #include <vector>
 
 #include <fbl/algorithm.h>
+#include <virtio/virtio_ring.h>
 
 #include "src/lib/fsl/handles/object_info.h"
 #include "src/virtualization/bin/vmm/bits.h"
@@ -401,6 +402,9 @@ void VirtioWl::ExportImage(uint32_t vfd_id, ExportImageCallback callback) {
 
 void VirtioWl::Ready(uint32_t negotiated_features, ReadyCallback callback) {
   auto deferred = fit::defer(std::move(callback));
+  for (auto& queue : queues_) {
+    queue.set_use_event_index(negotiated_features & (1 << VIRTIO_RING_F_EVENT_IDX));
+  }
 }
 
 void VirtioWl::ConfigureQueue(uint16_t queue, uint16_t size, zx_gpaddr_t desc, zx_gpaddr_t avail,
@@ -359,6 +359,20 @@ zx_status_t Guest::CreateMapping(TrapType type, uint64_t addr, size_t size, uint
   return ZX_OK;
 }
 
+zx_status_t Guest::MapCommittedMemory() {
+  // The guest physical VMAR is based at 0, so guest physical addresses are also VMAR addresses.
+  for (const GuestMemoryRegion& region : memory_regions_) {
+    zx_status_t status =
+        vmar_.op_range(ZX_VMAR_OP_MAP_RANGE, region.base, region.size, nullptr, 0);
+    if (status != ZX_OK) {
+      FX_PLOGS(ERROR, status) << "Failed to map committed guest memory in region " << region.base
+                              << " - " << region.base + region.size;
+      return status;
+    }
+  }
+  return ZX_OK;
+}
+
 zx_status_t Guest::CreateSubVmar(uint64_t addr, size_t size, zx::vmar* vmar) {
   uintptr_t guest_addr;
   return vmar_.allocate(ZX_VM_CAN_MAP_READ | ZX_VM_CAN_MAP_WRITE | ZX_VM_SPECIFIC, addr, size, vmar,
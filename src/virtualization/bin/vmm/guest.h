@@ -49,6 +49,11 @@ class Guest {
   zx_status_t CreateMapping(TrapType type, uint64_t addr, size_t size, uint64_t offset,
                             IoHandler* handler, async_dispatcher_t* dispatcher = nullptr);
 
+  // Populates the guest's physical address space for memory that is already committed, such as
+  // the loaded kernel and ramdisk, so that the guest does not take a fault on each of those pages
+  // as it boots. This does not commit any new memory.
+  zx_status_t MapCommittedMemory();
+
   // Creates a VMAR for a specific region of guest memory.
   zx_status_t CreateSubVmar(uint64_t addr, size_t size, zx::vmar* vmar);
 
@@ -459,6 +459,12 @@ fit::result<GuestError> Vmm::Initialize(GuestConfig cfg, ::sys::ComponentContext
     return fit::error(GuestError::KERNEL_LOAD_FAILURE);
   }
 
+  // The guest can still fault these pages in on demand, so this is only an optimization.
+  status = guest_->MapCommittedMemory();
+  if (status != ZX_OK) {
+    FX_PLOGS(WARNING, status) << "Failed to map committed guest memory, continuing";
+  }
+
   auto result = AddPublicServices();
   if (result.is_error()) {
     return result;
@@ -406,10 +406,23 @@ void SyscallDecoder::LoadOutputs() {
   if (error_.type() != DecoderError::Type::kNone) {
     SyscallDecodingError();
   } else {
+    ResumeThread();
     DecodeOutputs();
   }
 }
 
+void SyscallDecoder::ResumeThread() {
+  // Everything that the outputs need has been copied out of the target by now. Let the thread run
+  // while we decode and display them, as StepToReturnAddress already does for the inputs, so that
+  // the traced program isn't held up by our decoding.
+  zxdb::Thread* thread = weak_thread_.get();
+  if (!aborted_ && (thread != nullptr)) {
+    thread->Continue(false);
+  }
+  // Prevents DeleteDecoder from restarting the thread a second time.
+  aborted_ = true;
+}
+
 void SyscallDecoder::DecodeOutputs() {
   if (pending_request_count_ > 0) {
     return;
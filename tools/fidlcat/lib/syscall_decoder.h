@@ -217,6 +217,10 @@ class SyscallDecoder : public SyscallDecoderInterface {
   // parallel.
   void LoadOutputs();
 
+  // Restarts the thread, which is stopped at the return address, once all the outputs have been
+  // loaded.
+  void ResumeThread();
+
   // Decodes the outputs, generates the outputevent if possible and uses the outputs.
   void DecodeOutputs();
 
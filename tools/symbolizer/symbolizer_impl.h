@@ -6,6 +6,7 @@
 #define TOOLS_SYMBOLIZER_SYMBOLIZER_IMPL_H_
 
 #include <cstdint>
+#include <deque>
 #include <iostream>
 #include <memory>
 #include <string_view>
@@ -141,9 +142,14 @@ class SymbolizerImpl : public Symbolizer,
   // commands. It's different from build_id.
   std::unordered_map<uint64_t, ModuleInfo> modules_;
 
-  // Holds symbol data from the previously handled stack trace.
-  // Replaced immediately once a new stack trace is handled.
-  std::vector<fxl::RefPtr<zxdb::ModuleSymbols>> previous_modules_;
+  // Holds symbol data from previously handled stack traces, most recently used first, so that a
+  // module that appears again in a later stack trace doesn't have to be loaded again. Logs from
+  // crash archives usually contain many stack traces from the same handful of binaries.
+  std::deque<fxl::RefPtr<zxdb::ModuleSymbols>> retained_modules_;
+
+  // The maximum size of |retained_modules_|. Symbols for large binaries can take hundreds of MB,
+  // so this bounds the memory that is held on to.
+  static constexpr size_t kMaxRetainedModules = 16;
 
   // Mapping from base address of each module to the module_id.
   // Useful when doing binary search for the module from an address.
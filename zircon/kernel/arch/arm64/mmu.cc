@@ -477,15 +477,17 @@ class ArmArchVmAspace::ConsistencyManager {
     // Check we have queued too many entries already.
     if (num_pending_tlbs_ >= kMaxPendingTlbs) {
       // Most of the time we will now prefer to invalidate the entire ASID, the exception is if
-      // this aspace is using the global ASID, since we cannot perform a global TLB invalidation
-      // for all ASIDs. Note that there is an instruction to invalidate the entire TLB, but it is
-      // only available in EL2, and we are in EL1.
-      if (aspace_.asid_ != MMU_ARM64_GLOBAL_ASID) {
+      // this aspace is using the global ASID, since the only way to invalidate it as a whole is to
+      // invalidate all ASIDs. That also discards the TLB entries of every user aspace, so only do
+      // so once this operation has invalidated enough pages to make it worthwhile.
+      if (aspace_.asid_ != MMU_ARM64_GLOBAL_ASID ||
+          global_tlbs_flushed_ + num_pending_tlbs_ >= kMaxGlobalTlbs) {
         // Keep counting entries so that we can track how many TLB invalidates we saved by grouping.
         num_pending_tlbs_++;
         return;
       }
       // Flush what pages we've cached up until now and reset counter to zero.
+      global_tlbs_flushed_ += num_pending_tlbs_;
       Flush();
     }
 
@@ -520,12 +522,14 @@ class ArmArchVmAspace::ConsistencyManager {
     if (num_pending_tlbs_ > kMaxPendingTlbs || aspace_.type_ == ArmAspaceType::kHypervisor) {
       cm_flush_all.Add(1);
       cm_flush_all_replacing.Add(num_pending_tlbs_);
-      // If we're a shared aspace, we should be invalidating across all ASIDs.
-      if (aspace_.IsShared()) {
+      // If we're a shared aspace, or the kernel aspace using the global ASID, we should be
+      // invalidating across all ASIDs.
+      if (aspace_.IsShared() || aspace_.type_ == ArmAspaceType::kKernel) {
         aspace_.FlushAllAsids();
       } else {
         aspace_.FlushAsid();
       }
+      global_tlbs_flushed_ = 0;
     } else {
       for (size_t i = 0; i < num_pending_tlbs_; i++) {
         const vaddr_t va = pending_tlbs_[i].va();
@@ -559,6 +563,10 @@ class ArmArchVmAspace::ConsistencyManager {
   // Maximum number of TLB entries we will queue before switching to ASID invalidation.
   static constexpr size_t kMaxPendingTlbs = 16;
 
+  // Maximum number of TLB entries for the global ASID we will invalidate individually, in batches
+  // of kMaxPendingTlbs, before switching to invalidating all ASIDs.
+  static constexpr size_t kMaxGlobalTlbs = 256;
+
   // Pending TLBs to flush are stored as 63 bits, with the bottom bit stolen to store the terminal
   // flag. 63 bits is more than enough as these entries are page aligned at the minimum.
   struct PendingTlbs {
@@ -586,6 +594,10 @@ class ArmArchVmAspace::ConsistencyManager {
 
   // The main list of pending TLBs.
   size_t num_pending_tlbs_ = 0;
+
+  // Number of global ASID TLB entries already invalidated individually by this consistency manager
+  // since the last full invalidation.
+  size_t global_tlbs_flushed_ = 0;
   PendingTlbs pending_tlbs_[kMaxPendingTlbs];
 };
 
@@ -818,8 +830,7 @@ void ArmArchVmAspace::FlushTLBEntry(vaddr_t vaddr, bool terminal) const {
 }
 
 void ArmArchVmAspace::FlushAllAsids() const {
-  DEBUG_ASSERT(type_ == ArmAspaceType::kUser);
-  DEBUG_ASSERT(IsShared());
+  DEBUG_ASSERT((type_ == ArmAspaceType::kUser && IsShared()) || type_ == ArmAspaceType::kKernel);
   ARM64_TLBI_NOADDR(vmalle1is);
 }
 
@@ -831,8 +842,8 @@ void ArmArchVmAspace::FlushAsid() const {
       return;
     }
     case ArmAspaceType::kKernel: {
-      // The alle1is instruction that invalidates the TLBs for all ASIDs is only available in EL2,
-      // and not EL1.
+      // The kernel uses the global ASID, which cannot be invalidated on its own. FlushAllAsids
+      // must be used instead.
       panic("FlushAsid not available for kernel address space");
       return;
     }
@@ -83,9 +83,12 @@ extern "C" {
 void x86_64_context_switch(vaddr_t* oldsp, vaddr_t newsp, vaddr_t* old_unsafe_sp,
                            vaddr_t new_unsafe_sp);
 void x86_uspace_entry(const struct iframe_t* iframe, vaddr_t unsafe_sp) __NO_RETURN;
+void x86_uspace_entry_sysret(vaddr_t pc, uint64_t arg1, uint64_t arg2,
+                             vaddr_t unsafe_sp) __NO_RETURN;
 #else
 void x86_64_context_switch(vaddr_t* oldsp, vaddr_t newsp);
 void x86_uspace_entry(const struct iframe_t* iframe) __NO_RETURN;
+void x86_uspace_entry_sysret(vaddr_t pc, uint64_t arg1, uint64_t arg2) __NO_RETURN;
 #endif
 
 void x86_syscall();
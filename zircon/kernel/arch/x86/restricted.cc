@@ -17,7 +17,9 @@
 #include <arch/x86.h>
 #include <arch/x86/descriptor.h>
 #include <arch/x86/feature.h>
+#include <arch/x86/mp.h>
 #include <kernel/restricted.h>
+#include <kernel/thread.h>
 #include <vm/vm_address_region.h>
 
 #define LOCAL_TRACE 0
@@ -272,17 +274,18 @@ void RestrictedState::ArchSaveRestrictedIframeState(zx_restricted_state_t& state
   // load the user fs/gs base from normal mode
   set_fsgsbase(arch_state.normal_fs_base_, arch_state.normal_gs_base_);
 
-  // set up a mostly blank iframe and return back to normal mode
-  iframe_t iframe{};
-  iframe.rdi = context;
-  iframe.rsi = code;
-  iframe.ip = vector_table;
-  iframe.cs = USER_CODE_64_SELECTOR;
-  iframe.flags = X86_FLAGS_IF;
-  iframe.user_ss = USER_DATA_SELECTOR;
-
-  // load the new state and exit
-  arch_enter_uspace(&iframe);
+  // Return back to normal mode with otherwise blank register state. This happens on every
+  // restricted mode syscall, so use sysret rather than building an iframe and using iret. The
+  // vector table address was validated when entering restricted mode, but sysret with a
+  // non-canonical address would fault in kernel mode with the user gs base, so check it again.
+  ASSERT(arch_is_valid_user_pc(vector_table));
+  DEBUG_ASSERT(is_kernel_address(x86_get_percpu()->default_tss.rsp0));
+#if __has_feature(safe_stack)
+  x86_uspace_entry_sysret(vector_table, context, code,
+                          Thread::Current::Get()->stack().unsafe_top());
+#else
+  x86_uspace_entry_sysret(vector_table, context, code);
+#endif
 
   __UNREACHABLE;
 }
@@ -7,6 +7,7 @@
 #include <zircon/errors.h>
 #include <zircon/types.h>
 
+#include <cstring>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -25,19 +26,30 @@ extern "C" X64CopyToFromUserRet FUNCTION_NAME(void* dst, const void* src, size_t
                                               uint64_t* fault_return, uint64_t fault_return_mask);
 namespace {
 
+// Bytes on either side of the destination that must not be written.
+constexpr size_t kGuard = 8;
+constexpr uint8_t kGuardValue = 0xa5;
+
 TEST(X86UserCopyTests, FUNCTION_NAME) {
-  for (size_t i = 1; i < 40; ++i) {
-    auto dst = std::make_unique<uint8_t[]>(i);
+  for (size_t i = 0; i < 40; ++i) {
+    auto dst = std::make_unique<uint8_t[]>(i + 2 * kGuard);
+    memset(dst.get(), kGuardValue, i + 2 * kGuard);
     std::unique_ptr<uint8_t[]> src(new uint8_t[i]);
+    // Distinct values, so that a copy of the wrong bytes (e.g., from a
+    // misplaced overlapping move) is caught.
     for (size_t j = 0; j < i; ++j) {
-      src[j] = static_cast<uint8_t>(i);
+      src[j] = static_cast<uint8_t>(i + j + 1);
     }
 
     uint64_t fault_return = 0;
-    auto result = FUNCTION_NAME(dst.get(), src.get(), i, &fault_return, 0);
+    auto result = FUNCTION_NAME(dst.get() + kGuard, src.get(), i, &fault_return, 0);
     EXPECT_EQ(ZX_OK, result.status);
     for (size_t j = 0; j < i; ++j) {
-      EXPECT_EQ(src[j], dst[j]) << "case (" << i << ", " << j << ")";
+      EXPECT_EQ(src[j], dst[kGuard + j]) << "case (" << i << ", " << j << ")";
+    }
+    for (size_t j = 0; j < kGuard; ++j) {
+      EXPECT_EQ(kGuardValue, dst[j]) << "case (" << i << ", " << j << ")";
+      EXPECT_EQ(kGuardValue, dst[kGuard + i + j]) << "case (" << i << ", " << j << ")";
     }
 
     // The fault return address should have been reset.
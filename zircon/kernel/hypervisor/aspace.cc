@@ -5,11 +5,14 @@
 // https://opensource.org/licenses/MIT
 
 #include <align.h>
+#include <lib/counters.h>
+#include <lib/ktrace.h>
 
 #include <fbl/alloc_checker.h>
 #include <hypervisor/aspace.h>
 #include <kernel/range_check.h>
 #include <ktl/move.h>
+#include <platform/timer.h>
 #include <vm/fault.h>
 #include <vm/page_source.h>
 #include <vm/physmap.h>
@@ -30,6 +33,8 @@ constexpr size_t kNumPhysmapPages = PHYSMAP_SIZE / PAGE_SIZE;
 
 }  // namespace
 
+KCOUNTER(guest_page_faults, "hypervisor.guest_physical_aspace.page_faults")
+
 namespace hypervisor {
 
 zx::result<GuestPhysicalAspace> GuestPhysicalAspace::Create() {
@@ -97,6 +102,8 @@ zx::result<> GuestPhysicalAspace::PageFault(zx_gpaddr_t guest_paddr) {
   __UNINITIALIZED MultiPageRequest page_request;
 
   guest_paddr = ROUNDDOWN(guest_paddr, PAGE_SIZE);
+  zx_ticks_t start_time = current_ticks();
+  guest_page_faults.Add(1);
 
   zx_status_t status;
   do {
@@ -131,6 +138,9 @@ zx::result<> GuestPhysicalAspace::PageFault(zx_gpaddr_t guest_paddr) {
     }
   } while (status == ZX_ERR_SHOULD_WAIT);
 
+  KTRACE_COMPLETE("kernel:vm", "guest_page_fault", start_time,
+                  ("guest_paddr", ktrace::Pointer{guest_paddr}), ("status", status));
+
   return zx::make_result(status);
 }
 
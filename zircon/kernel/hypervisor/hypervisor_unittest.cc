@@ -584,6 +584,29 @@ static bool trap_map_insert_trap_out_of_range() {
   END_TEST;
 }
 
+static bool trap_map_find_trap_counts_exits() {
+  BEGIN_TEST;
+
+  hypervisor::TrapMap trap_map;
+  ASSERT_EQ(ZX_OK, trap_map.InsertTrap(ZX_GUEST_TRAP_BELL, 0, 10, nullptr, 0).status_value());
+  ASSERT_EQ(ZX_OK, trap_map.InsertTrap(ZX_GUEST_TRAP_MEM, 10, 10, nullptr, 0).status_value());
+
+  zx::result<hypervisor::Trap*> bell = trap_map.FindTrap(ZX_GUEST_TRAP_BELL, 5);
+  ASSERT_EQ(ZX_OK, bell.status_value());
+  EXPECT_EQ(1u, (*bell)->exit_count());
+  zx::result<hypervisor::Trap*> mem = trap_map.FindTrap(ZX_GUEST_TRAP_MEM, 15);
+  ASSERT_EQ(ZX_OK, mem.status_value());
+  EXPECT_EQ(ZX_OK, trap_map.FindTrap(ZX_GUEST_TRAP_MEM, 19).status_value());
+  EXPECT_EQ(2u, (*mem)->exit_count());
+
+  // A miss is not counted against any trap.
+  EXPECT_EQ(ZX_ERR_NOT_FOUND, trap_map.FindTrap(ZX_GUEST_TRAP_MEM, 20).status_value());
+  EXPECT_EQ(1u, (*bell)->exit_count());
+  EXPECT_EQ(2u, (*mem)->exit_count());
+
+  END_TEST;
+}
+
 // Use the function name as the test name
 #define HYPERVISOR_UNITTEST(fname) UNITTEST(#fname, fname)
 
@@ -604,4 +627,5 @@ HYPERVISOR_UNITTEST(direct_physical_aspace_create)
 HYPERVISOR_UNITTEST(interrupt_bitmap)
 HYPERVISOR_UNITTEST(trap_map_insert_trap_intersecting)
 HYPERVISOR_UNITTEST(trap_map_insert_trap_out_of_range)
+HYPERVISOR_UNITTEST(trap_map_find_trap_counts_exits)
 UNITTEST_END_TESTCASE(hypervisor, "hypervisor", "Hypervisor unit tests.")
@@ -12,6 +12,7 @@
 #include <fbl/ref_ptr.h>
 #include <hypervisor/state_invalidator.h>
 #include <kernel/semaphore.h>
+#include <ktl/atomic.h>
 #include <object/port_dispatcher.h>
 
 namespace hypervisor {
@@ -39,6 +40,9 @@ class Trap : public fbl::WAVLTreeContainable<ktl::unique_ptr<Trap>> {
   ~Trap();
 
   zx::result<> Init();
+  // Records a VCPU exit handled by this trap, in its exit count, the hypervisor.trap kcounters
+  // and the trace.
+  void RecordExit();
   zx::result<> Queue(const zx_port_packet_t& packet, StateInvalidator* invalidator = nullptr);
 
   zx_gpaddr_t GetKey() const { return addr_; }
@@ -49,6 +53,8 @@ class Trap : public fbl::WAVLTreeContainable<ktl::unique_ptr<Trap>> {
   zx_gpaddr_t addr() const { return addr_; }
   size_t len() const { return len_; }
   uint64_t key() const { return key_; }
+  // The number of VCPU exits that have been handled by this trap.
+  uint64_t exit_count() const { return exit_count_.load(ktl::memory_order_relaxed); }
 
  private:
   const uint32_t kind_;
@@ -57,6 +63,7 @@ class Trap : public fbl::WAVLTreeContainable<ktl::unique_ptr<Trap>> {
   const fbl::RefPtr<PortDispatcher> port_;
   const uint64_t key_;  // Key for packets in this port range.
   BlockingPortAllocator port_allocator_;
+  ktl::atomic<uint64_t> exit_count_ = 0;
 };
 
 // Contains all the traps within a guest.
@@ -64,6 +71,8 @@ class TrapMap {
  public:
   zx::result<> InsertTrap(uint32_t kind, zx_gpaddr_t addr, size_t len,
                           fbl::RefPtr<PortDispatcher> port, uint64_t key);
+  // Finds the trap containing |addr|. This is called for each VCPU exit that may be handled by a
+  // trap, so the exit is recorded against the trap that is found.
   zx::result<Trap*> FindTrap(uint32_t kind, zx_gpaddr_t addr);
 
  private:
@@ -4,6 +4,7 @@
 // license that can be found in the LICENSE file or at
 // https://opensource.org/licenses/MIT
 
+#include <lib/counters.h>
 #include <lib/ktrace.h>
 #include <zircon/errors.h>
 #include <zircon/syscalls/hypervisor.h>
@@ -18,6 +19,24 @@ namespace {
 
 constexpr size_t kMaxPacketsPerRange = 256;
 
+KCOUNTER(bell_trap_exits, "hypervisor.trap.bell_exits")
+KCOUNTER(mem_trap_exits, "hypervisor.trap.mem_exits")
+KCOUNTER(io_trap_exits, "hypervisor.trap.io_exits")
+
+void CountTrapExit(uint32_t kind) {
+  switch (kind) {
+    case ZX_GUEST_TRAP_BELL:
+      bell_trap_exits.Add(1);
+      break;
+    case ZX_GUEST_TRAP_MEM:
+      mem_trap_exits.Add(1);
+      break;
+    case ZX_GUEST_TRAP_IO:
+      io_trap_exits.Add(1);
+      break;
+  }
+}
+
 bool ValidRange(uint32_t kind, zx_gpaddr_t addr, size_t len) {
   if (len == 0) {
     return false;
@@ -77,6 +96,13 @@ Trap::~Trap() {
 
 zx::result<> Trap::Init() { return port_allocator_.Init(); }
 
+void Trap::RecordExit() {
+  CountTrapExit(kind_);
+  uint64_t exit_count = exit_count_.fetch_add(1, ktl::memory_order_relaxed) + 1;
+  KTRACE_INSTANT("kernel:arch", "trap", ("kind", kind_), ("addr", addr_), ("key", key_),
+                 ("exit_count", exit_count));
+}
+
 zx::result<> Trap::Queue(const zx_port_packet_t& packet, StateInvalidator* invalidator) {
   if (invalidator != nullptr) {
     invalidator->Invalidate();
@@ -151,6 +177,7 @@ zx::result<Trap*> TrapMap::FindTrap(uint32_t kind, zx_gpaddr_t addr) {
   if (!found->Contains(addr)) {
     return zx::error(ZX_ERR_NOT_FOUND);
   }
+  found->RecordExit();
   return zx::ok(found);
 }
 
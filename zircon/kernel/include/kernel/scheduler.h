@@ -30,6 +30,7 @@
 #include <kernel/spinlock.h>
 #include <kernel/thread.h>
 #include <kernel/wait.h>
+#include <ktl/atomic.h>
 #include <ktl/optional.h>
 
 // Forward declarations.
@@ -531,6 +532,14 @@ class Scheduler {
   // Returns the Scheduler instance for the given CPU.
   static Scheduler* Get(cpu_num_t cpu);
 
+  // Returns true if |thread| appears to be the thread currently running on |cpu|.
+  //
+  // This is a lockless hint intended for adaptive spinning.  The answer may be
+  // stale by the time it is returned, and |thread| is only compared, never
+  // dereferenced, so it is safe to pass a pointer to a thread which may have
+  // since exited.
+  static bool IsLikelyRunningOn(cpu_num_t cpu, const Thread* thread);
+
   // Find an appropriate CPU for a thread to run on, then lock that scheduler,
   // confirm that it is still active, and invoke the user-supplied callback with
   // the scheduler's queue_lock held.
@@ -1017,6 +1026,10 @@ class Scheduler {
   TA_GUARDED(queue_lock_)
   Thread* active_thread_{nullptr};
 
+  // A copy of |active_thread_| which may be observed without holding the queue
+  // lock.  See IsLikelyRunningOn.
+  ktl::atomic<const Thread*> active_thread_hint_{nullptr};
+
   // Monotonically increasing counter to break ties when queuing tasks with
   // the same key. This has the effect of placing newly queued tasks behind
   // already queued tasks with the same key. This is also necessary to
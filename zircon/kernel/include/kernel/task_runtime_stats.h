@@ -16,6 +16,7 @@
 
 #include <kernel/lockdep.h>
 #include <kernel/scheduler_state.h>
+#include <ktl/algorithm.h>
 #include <ktl/array.h>
 
 //
@@ -135,6 +136,12 @@ class ThreadRuntimeStats {
       const zx_ticks_t delta = zx_ticks_sub_ticks(now, stats.state_change_ticks);
       ktl::atomic_ref(stats.total_ready_ticks)
           .store(zx_ticks_add_ticks(stats.total_ready_ticks, delta), ktl::memory_order_relaxed);
+      if (new_state == THREAD_RUNNING) {
+        // Updates are serialized by the sequence lock, so a plain load and store is sufficient
+        // and avoids the cost of an atomic read-modify-write.
+        RelaxedAtomic<uint64_t>& bucket = queue_latency_[QueueLatencyBucket(delta)];
+        bucket.store(bucket.load() + 1);
+      }
     }
 
     ktl::atomic_ref(stats.state_change_ticks).store(now, ktl::memory_order_relaxed);
@@ -146,6 +153,16 @@ class ThreadRuntimeStats {
   void AddPageFaultTicks(zx_ticks_t delta) { page_fault_ticks_.fetch_add(delta); }
   void AddLockContentionTicks(zx_ticks_t delta) { lock_contention_ticks_.fetch_add(delta); }
 
+  // Returns the distribution of the time the thread spent ready before running. The buckets are
+  // read individually and so are not a coherent snapshot with respect to each other.
+  zx_info_thread_queue_latency_t GetQueueLatency() const {
+    zx_info_thread_queue_latency_t info{};
+    for (size_t i = 0; i < kQueueLatencyBuckets; ++i) {
+      info.buckets[i] = queue_latency_[i].load();
+    }
+    return info;
+  }
+
   // Returns the instantaneous runtime stats for the thread, including the time
   // the thread has spent in its current state (if that state is either READY or
   // RUNNING).
@@ -171,6 +188,18 @@ class ThreadRuntimeStats {
  private:
   friend struct ::TaskRuntimeStatsTests;
 
+  static constexpr size_t kQueueLatencyBuckets = ZX_INFO_THREAD_QUEUE_LATENCY_BUCKETS;
+
+  // Bucket 0 holds zero length waits, and bucket i holds waits in [2^(i-1), 2^i) ticks, with the
+  // final bucket absorbing everything longer.
+  static size_t QueueLatencyBucket(zx_ticks_t delta) {
+    if (delta <= 0) {
+      return 0;
+    }
+    const size_t bucket = 64 - __builtin_clzll(static_cast<uint64_t>(delta));
+    return ktl::min(bucket, kQueueLatencyBuckets - 1);
+  }
+
   struct ReadResult {
     ThreadStats stats;
     zx_ticks_t now{};
@@ -221,6 +250,7 @@ class ThreadRuntimeStats {
   SeqLockPayload<ThreadStats, decltype(seq_lock_)> published_stats_ TA_GUARDED(seq_lock_){};
   RelaxedAtomic<zx_ticks_t> page_fault_ticks_{0};
   RelaxedAtomic<zx_ticks_t> lock_contention_ticks_{0};
+  ktl::array<RelaxedAtomic<uint64_t>, kQueueLatencyBuckets> queue_latency_{};
 };
 
 }  // namespace task_runtime_stats::internal
@@ -107,6 +107,11 @@ class Timer : public fbl::DoublyLinkedListable<Timer*, fbl::NodeOptions::AllowRe
 
   // Stores the applied slack adjustment from the ideal scheduled_time.
   zx_duration_t slack_ = 0;
+
+  // The earliest time, on the same timeline as scheduled_time_, at which the timer's slack allows
+  // it to fire. A timer at the head of the queue may be fired as early as this when the queue is
+  // already being serviced, rather than needing a wakeup of its own.
+  zx_time_t earliest_deadline_ = 0;
   Callback callback_ = nullptr;
   void* arg_ = nullptr;
 
@@ -237,7 +242,8 @@ class TimerQueue {
   // Converts the given boot timestamp to the raw ticks value it corresponds to.
   static zx_ticks_t ConvertBootTimeToRawTicks(zx_instant_boot_t boot);
 
-  // This is called by Tick(), and processes all timers with scheduled times less than now.
+  // This is called by Tick(), and processes all timers with scheduled times less than now, along
+  // with any timers at the front of the queue whose slack already allows them to fire.
   // Once it's done, the scheduled time of the timer at the front of the queue is returned.
   template <typename TimestampType>
   static void TickInternal(TimestampType now, cpu_num_t cpu,
@@ -47,6 +47,10 @@
 
 #define LOCAL_TRACE 0
 
+// Counts the number of times a thread gave up spinning on a contended mutex
+// because the owner did not appear to be running.
+KCOUNTER(mutex_spin_owner_not_running, "mutex.spin.owner_not_running")
+
 namespace {
 
 enum class KernelMutexTracingLevel {
@@ -299,7 +303,18 @@ __NO_INLINE bool Mutex::AcquireContendedMutex(
       // Note: The accuracy of |curr_cpu_num| depends on whether preemption is
       // currently enabled or not and whether we re-enable it below.
       const cpu_num_t curr_cpu_num = arch_curr_cpu_num();
-      if (curr_cpu_num == maybe_acquired_on_cpu_.load(ktl::memory_order_relaxed)) {
+      const cpu_num_t owner_cpu_num = maybe_acquired_on_cpu_.load(ktl::memory_order_relaxed);
+      if (curr_cpu_num == owner_cpu_num) {
+        break;
+      }
+
+      // Stop spinning if the owner no longer appears to be running on the CPU
+      // it acquired the mutex on.  It has most likely blocked or been
+      // preempted, and will not release the mutex before our spin runs out.
+      // If it has simply migrated to another CPU, blocking is early but safe.
+      if (owner_cpu_num != INVALID_CPU &&
+          !Scheduler::IsLikelyRunningOn(owner_cpu_num, holder_from_val(old_mutex_state))) {
+        kcounter_add(mutex_spin_owner_not_running, 1);
         break;
       }
 
@@ -65,6 +65,21 @@ KCOUNTER(counter_deadline_past, "scheduler.deadline_past")
 // selected Target became in-active after we chose it.
 KCOUNTER(counter_find_target_cpu_retries, "scheduler.find_target_cpu.retries")
 
+// Counts the placements made by FindTargetCpu, split by whether the target is in
+// the same cluster as the CPU the search started from (the thread's last CPU, if
+// any). On asymmetric systems, inter-cluster placements are the ones that move
+// work between cores of different capacity.
+KCOUNTER(counter_find_target_cpu_intra_cluster, "scheduler.find_target_cpu.intra_cluster")
+KCOUNTER(counter_find_target_cpu_inter_cluster, "scheduler.find_target_cpu.inter_cluster")
+
+// Counts the threads an idle or otherwise out-of-work CPU stole from another
+// CPU, split by whether the victim was in the same cluster or not. Inter-cluster
+// steals lose any cache warmth the thread had and should be comparatively rare.
+KCOUNTER(counter_steal_intra_cluster, "scheduler.steal.intra_cluster")
+KCOUNTER(counter_steal_inter_cluster, "scheduler.steal.inter_cluster")
+// Counts the number of times StealWork was called but found nothing to steal.
+KCOUNTER(counter_steal_none, "scheduler.steal.none")
+
 namespace {
 
 // The minimum possible weight and its reciprocal.
@@ -441,6 +456,10 @@ Scheduler* Scheduler::Get() { return Get(arch_curr_cpu_num()); }
 
 Scheduler* Scheduler::Get(cpu_num_t cpu) { return &percpu::Get(cpu).scheduler; }
 
+bool Scheduler::IsLikelyRunningOn(cpu_num_t cpu, const Thread* thread) {
+  return Get(cpu)->active_thread_hint_.load(ktl::memory_order_relaxed) == thread;
+}
+
 void Scheduler::InitializeThread(Thread* thread, const SchedulerState::BaseProfile& profile) {
   new (&thread->scheduler_state()) SchedulerState{profile};
   thread->scheduler_state().expected_runtime_ns_ =
@@ -474,6 +493,7 @@ void Scheduler::InitializeFirstThread(Thread* thread) {
     SchedulerQueueState& sqs = thread->scheduler_queue_state();
     sqs.active = true;
     sched->active_thread_ = thread;
+    sched->active_thread_hint_.store(thread, ktl::memory_order_relaxed);
 
     sched->weight_total_ = ss.effective_profile_.fair.weight;
     sched->runnable_fair_task_count_++;
@@ -527,6 +547,7 @@ void Scheduler::RemoveFirstThread(Thread* thread) {
     DEBUG_ASSERT(sched->runnable_fair_task_count_ > 0);
     sqs.active = false;
     sched->active_thread_ = nullptr;
+    sched->active_thread_hint_.store(nullptr, ktl::memory_order_relaxed);
     sched->weight_total_ -= ss.effective_profile_.fair.weight;
     sched->runnable_fair_task_count_--;
     sched->UpdateTotalExpectedRuntime(-ss.expected_runtime_ns_);
@@ -610,6 +631,8 @@ Thread* Scheduler::StealWork(SchedTime now, SchedPerformanceScale scale_up_facto
   const cpu_mask_t active_cpu_mask = PeekActiveMask();
 
   Thread* thread = nullptr;
+  cpu_num_t victim_cpu = INVALID_CPU;
+  bool inter_cluster = false;
   const CpuSearchSet& search_set = percpu::Get(current_cpu).search_set;
   for (const auto& entry : search_set.const_iterator()) {
     if (entry.cpu != current_cpu && active_cpu_mask & cpu_num_to_mask(entry.cpu)) {
@@ -682,6 +705,8 @@ Thread* Scheduler::StealWork(SchedTime now, SchedPerformanceScale scale_up_facto
           queue->FindEarliestEligibleThread(&queue->deadline_run_queue_, now, deadline_predicate);
       if (thread != nullptr) {
         StealFromQueue(queue->deadline_run_queue_, *thread);
+        victim_cpu = entry.cpu;
+        inter_cluster = cluster() != entry.cluster;
         break;
       }
 
@@ -726,6 +751,8 @@ Thread* Scheduler::StealWork(SchedTime now, SchedPerformanceScale scale_up_facto
           queue->FindEarliestEligibleThread(&queue->fair_run_queue_, eligible_time, fair_predicate);
       if (thread != nullptr) {
         StealFromQueue(queue->fair_run_queue_, *thread);
+        victim_cpu = entry.cpu;
+        inter_cluster = cluster() != entry.cluster;
         break;
       }
     }
@@ -776,6 +803,12 @@ Thread* Scheduler::StealWork(SchedTime now, SchedPerformanceScale scale_up_facto
     //
     MarkHasOwnedThreadAccess(*thread);
     FinishTransition(now, thread);
+
+    kcounter_add(inter_cluster ? counter_steal_inter_cluster : counter_steal_intra_cluster, 1);
+    trace = KTRACE_END_SCOPE(("victim_cpu", victim_cpu),
+                             ("inter_cluster", inter_cluster ? 1u : 0u), ("tid", thread->tid()));
+  } else {
+    kcounter_add(counter_steal_none, 1);
   }
   return thread;
 }
@@ -1114,7 +1147,13 @@ cpu_num_t Scheduler::FindTargetCpu(Thread* thread) {
   }
 
   DEBUG_ASSERT(target_cpu != INVALID_CPU);
-  trace = KTRACE_END_SCOPE(("last_cpu", last_cpu), ("target_cpu", target_cpu));
+  const bool inter_cluster = target_queue.queue->cluster() != Get(starting_cpu)->cluster();
+  kcounter_add(
+      inter_cluster ? counter_find_target_cpu_inter_cluster : counter_find_target_cpu_intra_cluster,
+      1);
+  trace = KTRACE_END_SCOPE(("last_cpu", last_cpu), ("target_cpu", target_cpu),
+                           ("target_cluster", target_queue.queue->cluster()),
+                           ("inter_cluster", inter_cluster ? 1u : 0u));
   return target_cpu;
 }
 
@@ -1544,6 +1583,7 @@ void Scheduler::RescheduleCommon(Thread* const current_thread, SchedTime now,
   next_state->last_cpu_ = current_cpu;
   DEBUG_ASSERT(next_state->curr_cpu_ == current_cpu);
   active_thread_ = next_thread;
+  active_thread_hint_.store(next_thread, ktl::memory_order_relaxed);
 
   // Handle any pending migration work.
   next_thread->CallMigrateFnLocked(Thread::MigrateStage::Restore);
@@ -33,6 +33,7 @@
 #include <ktl/array.h>
 #include <ktl/atomic.h>
 #include <ktl/bit.h>
+#include <ktl/limits.h>
 #include <ktl/unique_ptr.h>
 
 #include <ktl/enforce.h>
@@ -994,6 +995,42 @@ struct TaskRuntimeStatsTests {
 
     END_TEST;
   }
+
+  static bool thread_queue_latency_test() {
+    BEGIN_TEST;
+
+    EXPECT_EQ(0u, ThreadRuntimeStats::QueueLatencyBucket(0));
+    EXPECT_EQ(1u, ThreadRuntimeStats::QueueLatencyBucket(1));
+    EXPECT_EQ(2u, ThreadRuntimeStats::QueueLatencyBucket(2));
+    EXPECT_EQ(2u, ThreadRuntimeStats::QueueLatencyBucket(3));
+    EXPECT_EQ(11u, ThreadRuntimeStats::QueueLatencyBucket(1024));
+    EXPECT_EQ(ThreadRuntimeStats::kQueueLatencyBuckets - 1,
+              ThreadRuntimeStats::QueueLatencyBucket(ktl::numeric_limits<zx_ticks_t>::max()));
+
+    ThreadRuntimeStats stats;
+    auto total = [&stats]() {
+      const zx_info_thread_queue_latency_t info = stats.GetQueueLatency();
+      uint64_t sum = 0;
+      for (uint64_t count : info.buckets) {
+        sum += count;
+      }
+      return sum;
+    };
+    EXPECT_EQ(0u, total());
+
+    // Only a transition from READY to RUNNING is recorded.
+    stats.Update(thread_state::THREAD_READY, ThreadRuntimeStats::IrqSave);
+    EXPECT_EQ(0u, total());
+    stats.Update(thread_state::THREAD_RUNNING, ThreadRuntimeStats::IrqSave);
+    EXPECT_EQ(1u, total());
+    stats.Update(thread_state::THREAD_BLOCKED, ThreadRuntimeStats::IrqSave);
+    stats.Update(thread_state::THREAD_READY, ThreadRuntimeStats::IrqSave);
+    EXPECT_EQ(1u, total());
+    stats.Update(thread_state::THREAD_RUNNING, ThreadRuntimeStats::IrqSave);
+    EXPECT_EQ(2u, total());
+
+    END_TEST;
+  }
 };
 
 UNITTEST_START_TESTCASE(thread_tests)
@@ -1013,4 +1050,5 @@ UNITTEST("scoped_allocation_disabled_test", scoped_allocation_disabled_test)
 UNITTEST("backtrace_static_method_test", backtrace_static_method_test)
 UNITTEST("backtrace_instance_method_test", backtrace_instance_method_test)
 UNITTEST("thread_runtime_test", TaskRuntimeStatsTests::thread_runtime_test)
+UNITTEST("thread_queue_latency_test", TaskRuntimeStatsTests::thread_queue_latency_test)
 UNITTEST_END_TESTCASE(thread_tests, "thread", "thread tests")
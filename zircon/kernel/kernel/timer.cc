@@ -47,6 +47,7 @@
 #include <kernel/spinlock.h>
 #include <kernel/stats.h>
 #include <kernel/thread.h>
+#include <ktl/optional.h>
 #include <platform/timer.h>
 
 #define LOCAL_TRACE 0
@@ -57,6 +58,10 @@ KCOUNTER(timer_created_counter, "timer.created")
 // Number of timers merged into an existing timer because of slack.
 KCOUNTER(timer_coalesced_counter, "timer.coalesced")
 
+// Number of platform timer wakeups avoided by firing timers early, within their slack, from a
+// wakeup that was already happening.
+KCOUNTER(timer_wakeups_avoided_counter, "timer.wakeups_avoided")
+
 // Number of timers that have fired (i.e. callback was invoked).
 KCOUNTER(timer_fired_counter, "timer.fired")
 
@@ -339,6 +344,7 @@ void Timer::Set(const Deadline& deadline, Callback callback, void* arg) {
 
   // Set up the structure.
   scheduled_time_ = deadline.when();
+  earliest_deadline_ = earliest_deadline;
   callback_ = callback;
   arg_ = arg;
   cancel_.store(false, ktl::memory_order_relaxed);
@@ -488,6 +494,10 @@ void TimerQueue::TickInternal(TimestampType now, cpu_num_t cpu,
                               fbl::DoublyLinkedList<Timer*>* timer_list) {
   Guard<MonitoredSpinLock, NoIrqSave> guard{Timer::TimerLock::Get(), SOURCE_TAG};
 
+  // The scheduled time of the last timer fired early, so that timers sharing a scheduled time
+  // (and therefore a wakeup) are only counted once.
+  ktl::optional<zx_time_t> last_early_scheduled_time;
+
   for (;;) {
     // See if there's an event to process.
     if (timer_list->is_empty()) {
@@ -499,7 +509,16 @@ void TimerQueue::TickInternal(TimestampType now, cpu_num_t cpu,
     LTRACEF("next item on timer queue %p at %" PRIi64 " now %" PRIi64 " (%p, arg %p)\n", &timer,
             timer.scheduled_time_, now, timer.callback_, timer.arg_);
     if (likely(now < timer.scheduled_time_)) {
-      break;
+      // Timers are only ever coalesced when they are inserted, so a timer set before one with an
+      // earlier deadline and no slack keeps its own scheduled time. If its slack already allows it
+      // to fire, do so now rather than programming another wakeup for it.
+      if (likely(now < timer.earliest_deadline_)) {
+        break;
+      }
+      if (last_early_scheduled_time != timer.scheduled_time_) {
+        kcounter_add(timer_wakeups_avoided_counter, 1);
+        last_early_scheduled_time = timer.scheduled_time_;
+      }
     }
 
     // Process it.
@@ -582,10 +601,11 @@ ktl::optional<Timer*> TimerQueue::TransitionTimerList(fbl::DoublyLinkedList<Time
   // Move all the timers from the src_list to the dst_list.
   Timer* timer;
   while ((timer = src_list.pop_front()) != nullptr) {
-    // We lost the original asymmetric slack information so when we combine them
-    // with the other timer queue they are not coalesced again.
+    // We lost the original late slack information so when we combine them with the other timer
+    // queue they are only coalesced with earlier timers.
     // TODO(cpu): figure how important this case is.
-    InsertIntoTimerList(dst_list, timer, timer->scheduled_time_, timer->scheduled_time_);
+    const zx_time_t earliest = ktl::min(timer->earliest_deadline_, timer->scheduled_time_);
+    InsertIntoTimerList(dst_list, timer, earliest, timer->scheduled_time_);
     // Note, we do not increment the "created" counter here because we are simply moving these
     // timers from one queue to another and we already counted them when they were first
     // created.
@@ -400,7 +400,9 @@ int DLog::DumperThread() {
   // assembly buffer with room for log text plus header text
   char tmp[DLOG_MAX_DATA + 128];
 
-  dlog_record_t rec;
+  // Records are read out in small batches to take the debuglog lock fewer
+  // times while draining a burst, without growing this thread's stack much.
+  dlog_record_t records[4];
   DlogReader reader;
   reader.Initialize([](void* cookie) { static_cast<Event*>(cookie)->Signal(); },
                     &dumper_state_.event, this);
@@ -420,26 +422,28 @@ int DLog::DumperThread() {
     done = dumper_state_.shutdown_requested.load();
 
     // Read out all the records and dump them to the kernel console.
-    size_t actual;
-    while (reader.Read(0, &rec, &actual) == ZX_OK) {
-      StringFile tmp_file({tmp, sizeof(tmp)});
-      uint64_t gap = rec.hdr.sequence - expected_sequence;
-      if (gap > 0) {
-        fprintf(&tmp_file, "debuglog: dropped %zu messages\n", gap);
-
+    size_t count;
+    while (reader.ReadBatch(0, records, &count) == ZX_OK) {
+      for (const dlog_record_t& rec : ktl::span<const dlog_record_t>(records, count)) {
+        StringFile tmp_file({tmp, sizeof(tmp)});
+        uint64_t gap = rec.hdr.sequence - expected_sequence;
+        if (gap > 0) {
+          fprintf(&tmp_file, "debuglog: dropped %zu messages\n", gap);
+
+          const ktl::string_view sv = tmp_file.as_string_view();
+          OutputLogMessage(sv);
+        }
+        expected_sequence = rec.hdr.sequence + 1;
+
+        tmp_file.Skip(FormatHeader(tmp_file.available_region(), rec.hdr));
+        tmp_file.Write({rec.data, rec.hdr.datalen});
+        // If the record didn't end with a newline, add one now.
+        if ((rec.hdr.datalen == 0) || (rec.data[rec.hdr.datalen - 1] != '\n')) {
+          tmp_file.Write("\n");
+        }
         const ktl::string_view sv = tmp_file.as_string_view();
         OutputLogMessage(sv);
       }
-      expected_sequence = rec.hdr.sequence + 1;
-
-      tmp_file.Skip(FormatHeader(tmp_file.available_region(), rec.hdr));
-      tmp_file.Write({rec.data, rec.hdr.datalen});
-      // If the record didn't end with a newline, add one now.
-      if ((rec.hdr.datalen == 0) || (rec.data[rec.hdr.datalen - 1] != '\n')) {
-        tmp_file.Write("\n");
-      }
-      const ktl::string_view sv = tmp_file.as_string_view();
-      OutputLogMessage(sv);
     }
   }
 
@@ -451,10 +455,19 @@ void DLog::DeferredSignal() {
   pending_deferred_signal_.store(false);
 }
 
-// TODO: support reading multiple messages at a time
 // TODO: filter with flags
 zx_status_t DlogReader::Read(uint32_t flags, dlog_record_t* record, size_t* actual) {
-  zx_status_t status = ZX_ERR_SHOULD_WAIT;
+  size_t count;
+  zx_status_t status = ReadBatch(flags, {record, 1}, &count);
+  if (status == ZX_OK) {
+    *actual = sizeof(record->hdr) + record->hdr.datalen;
+  }
+  return status;
+}
+
+zx_status_t DlogReader::ReadBatch(uint32_t flags, ktl::span<dlog_record_t> records,
+                                  size_t* count) {
+  size_t read = 0;
 
   {
     Guard<MonitoredSpinLock, IrqSave> guard{&log_->lock_, SOURCE_TAG};
@@ -469,9 +482,11 @@ zx_status_t DlogReader::Read(uint32_t flags, dlog_record_t* record, size_t* actu
       rtail = log_->tail_;
     }
 
-    if (rtail != log_->head_) {
+    for (; read < records.size() && rtail != log_->head_; ++read) {
+      dlog_record_t* record = &records[read];
+
       // Attempt to read the header into the user supplied buffer.
-      status = log_->ReassembleFromOffset(
+      zx_status_t status = log_->ReassembleFromOffset(
           rtail, {reinterpret_cast<uint8_t*>(&record->hdr), sizeof(record->hdr)});
       if (status != ZX_OK) {
         guard.Release();  // Drop the dlog lock before panicking, or asserting anything.
@@ -506,18 +521,20 @@ zx_status_t DlogReader::Read(uint32_t flags, dlog_record_t* record, size_t* actu
         return ZX_ERR_INTERNAL;
       }
 
-      // Everything went well.  Advance the tail pointer, report the actual length read, and get
-      // out.
+      // Everything went well.  Advance the tail pointer and move on to the
+      // next record.
       rtail += DLOG_HDR_GET_FIFOLEN(record->hdr.preamble);
-      *actual = DLOG_HDR_GET_READLEN(record->hdr.preamble);
       record->hdr.preamble = 0;
-      status = ZX_OK;
     }
 
     tail_ = rtail;
   }
 
-  return status;
+  if (read == 0) {
+    return ZX_ERR_SHOULD_WAIT;
+  }
+  *count = read;
+  return ZX_OK;
 }
 
 DlogReader::~DlogReader() {
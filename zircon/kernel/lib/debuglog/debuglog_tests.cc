@@ -152,6 +152,48 @@ struct DebuglogTests {
     END_TEST;
   }
 
+  // Read several records from the debuglog at once.
+  static bool log_reader_read_batch() {
+    BEGIN_TEST;
+
+    fbl::AllocChecker ac;
+    ktl::unique_ptr<DLog> log = ktl::make_unique<DLog>(&ac);
+    ASSERT_TRUE(ac.check());
+
+    const char* msgs[] = {"one", "two", "three"};
+    for (const char* msg : msgs) {
+      ASSERT_EQ(ZX_OK, log->Write(DEBUGLOG_INFO, 0, msg));
+    }
+
+    DlogReader reader;
+    reader.Initialize(nullptr, nullptr, log.get());
+
+    // A batch smaller than the number of records leaves the rest for the next
+    // read.
+    dlog_record_t recs[2]{};
+    size_t count;
+    ASSERT_EQ(ZX_OK, reader.ReadBatch(0, recs, &count));
+    ASSERT_EQ(2u, count);
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(0u, recs[i].hdr.preamble);
+      EXPECT_EQ(i, recs[i].hdr.sequence);
+      EXPECT_EQ(strlen(msgs[i]), recs[i].hdr.datalen);
+      EXPECT_BYTES_EQ(reinterpret_cast<const uint8_t*>(msgs[i]),
+                      reinterpret_cast<const uint8_t*>(recs[i].data), recs[i].hdr.datalen);
+    }
+
+    ASSERT_EQ(ZX_OK, reader.ReadBatch(0, recs, &count));
+    ASSERT_EQ(1u, count);
+    EXPECT_EQ(2u, recs[0].hdr.sequence);
+    EXPECT_EQ(strlen(msgs[2]), recs[0].hdr.datalen);
+
+    EXPECT_EQ(ZX_ERR_SHOULD_WAIT, reader.ReadBatch(0, recs, &count));
+
+    reader.Disconnect();
+
+    END_TEST;
+  }
+
   // Write to the log, exceeding its capacity and see that data is lost.
   static bool log_reader_dataloss() {
     BEGIN_TEST;
@@ -588,6 +630,7 @@ UNITTEST_START_TESTCASE(debuglog_tests)
 DEBUGLOG_UNITTEST(DebuglogTests::log_format)
 DEBUGLOG_UNITTEST(DebuglogTests::log_wrap)
 DEBUGLOG_UNITTEST(DebuglogTests::log_reader_read)
+DEBUGLOG_UNITTEST(DebuglogTests::log_reader_read_batch)
 DEBUGLOG_UNITTEST(DebuglogTests::log_reader_dataloss)
 DEBUGLOG_UNITTEST(DebuglogTests::log_dumper_test)
 DEBUGLOG_UNITTEST(DebuglogTests::render_to_crashlog)
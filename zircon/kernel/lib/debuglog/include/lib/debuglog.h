@@ -48,6 +48,13 @@ class DlogReader : public fbl::DoublyLinkedListable<DlogReader*> {
   // Upon success, returns ZX_OK and sets *|actual| to the record's size.
   zx_status_t Read(uint32_t flags, dlog_record_t* record, size_t* actual);
 
+  // Read as many records as are available, up to |records.size()|, out of the
+  // log under a single acquisition of its lock.
+  //
+  // Upon success, returns ZX_OK and sets *|count| to the number of records
+  // read. Returns ZX_ERR_SHOULD_WAIT if there were none.
+  zx_status_t ReadBatch(uint32_t flags, ktl::span<dlog_record_t> records, size_t* count);
+
   void Notify();
 
   // Similar to Initialize, DlogReaders are be manually stopped via |Disconnect|
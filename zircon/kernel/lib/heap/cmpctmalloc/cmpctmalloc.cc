@@ -32,6 +32,14 @@
 #define NO_ASAN
 #endif  // KERNEL_ASAN
 
+// Per-CPU magazines (see below) are only used in the kernel, and not with ASAN,
+// where every free should instead go through the quarantine.
+#if defined(_KERNEL) && !KERNEL_ASAN
+#define CMPCT_MAGAZINES 1
+#else
+#define CMPCT_MAGAZINES 0
+#endif
+
 // Malloc implementation tuned for space.
 //
 // Allocation strategy takes place with a global mutex.  Freelist entries are
@@ -118,6 +126,15 @@
 //   Exception: to avoid OS free/alloc churn when right on the edge, the heap
 //   will try to hold onto one entirely-free, non-large OS allocation instead of
 //   returning it to the OS. See cached_os_alloc.
+//
+// Magazines:
+//   In the kernel, small memory areas are cached in per-CPU magazines in front
+//   of the free buckets, so that most small allocations and frees only take an
+//   uncontended per-CPU lock rather than the global heap lock. Areas in a
+//   magazine remain allocated as far as the rest of the heap is concerned: they
+//   are not coalesced, and they count as used. A magazine is refilled in a
+//   batch from the free buckets on a miss, half of it is flushed back to them
+//   when it overflows, and cmpct_drain_magazines() empties all of them.
 
 #if defined(DEBUG) || LK_DEBUGLEVEL > 2
 #include <platform.h>
@@ -130,7 +147,10 @@
 #include <lib/ktrace.h>
 #include <trace.h>
 
+#include <arch/defines.h>
+#include <arch/ops.h>
 #include <kernel/auto_preempt_disabler.h>
+#include <kernel/mutex.h>
 
 #define LOCAL_TRACE_DURATION(label, name, ...) \
   ktrace::Scope name = KTRACE_BEGIN_SCOPE_ENABLE(false, "kernel:sched", label, ##__VA_ARGS__)
@@ -152,6 +172,14 @@ KCOUNTER(malloc_size_le_2048, "malloc.size_le_2048")
 KCOUNTER(malloc_size_other, "malloc.size_other")
 // The number of failed attempts at growing the heap.
 KCOUNTER(malloc_heap_grow_fail, "malloc.heap_grow_fail")
+// Small allocations and frees served by a per-CPU magazine without taking the heap lock, and the
+// ones that had to take it to refill or flush the magazine.
+KCOUNTER(malloc_magazine_alloc_hit, "malloc.magazine.alloc_hit")
+KCOUNTER(malloc_magazine_alloc_miss, "malloc.magazine.alloc_miss")
+KCOUNTER(malloc_magazine_free_hit, "malloc.magazine.free_hit")
+KCOUNTER(malloc_magazine_free_miss, "malloc.magazine.free_miss")
+// Bytes returned from the magazines to the free buckets by cmpct_drain_magazines().
+KCOUNTER(malloc_magazine_drained_bytes, "malloc.magazine.drained_bytes")
 
 #else
 
@@ -843,6 +871,179 @@ static void cmpct_test_return_to_os(void) TA_EXCL(TheHeapLock::Get()) {
 }
 #endif  // HEAP_ENABLE_TESTS
 
+// Carves a memory area of |rounded_up| bytes (including the header) for an
+// allocation of |size| bytes out of the free buckets, starting the search at
+// |start_bucket|. If there's no suitable free area, the heap is grown if |grow|
+// is set. Returns the header of the new allocation, or NULL on failure.
+NO_ASAN static header_t* alloc_locked(size_t size, size_t rounded_up, int start_bucket, bool grow)
+    TA_REQ(TheHeapLock::Get()) {
+  int bucket = find_nonempty_bucket(start_bucket);
+  if (bucket == -1) {
+    if (!grow) {
+      return NULL;
+    }
+    // Grow heap by at least 12% if we can.
+    size_t growby =
+        std::min(HEAP_LARGE_ALLOC_BYTES,
+                 std::max(theheap.size >> 3, std::max(kHeapUsableGrowSize, rounded_up)));
+    // Validate that our growby calculation is correct, and that if we grew the heap by this amount
+    // we would actually satisfy our allocation.
+    ZX_DEBUG_ASSERT(growby >= rounded_up);
+    // Try to add a new OS allocation to the heap, reducing the size until
+    // we succeed or get too small.
+    while (!heap_grow(growby)) {
+      if (growby <= rounded_up) {
+        return NULL;
+      }
+      growby = std::max(growby >> 1, rounded_up);
+    }
+    bucket = find_nonempty_bucket(start_bucket);
+    // It should be the case that, since we hold the heap lock, after growing the heap there should
+    // be something in our target bucket. However, if there was any confusion in calculating the
+    // |growby| amount, then it's possible we still do not have something. As this could only happen
+    // due to a systemic configuration error, and this should get caught in tests, this only needs
+    // to be a DEBUG_ASSERT and not a always enabled ASSERT. Further, it should not be possible for
+    // the assertion of the growby amount above to succeed and then this assertion to fail.
+    ZX_DEBUG_ASSERT(bucket != -1);
+  }
+  free_t* head = theheap.free_lists[bucket];
+  size_t left_over = head->header.size - rounded_up;
+  // We can't carve off the rest for a new free space if it's smaller than the
+  // free-list linked structure.  We also don't carve it off if it's less than
+  // 1.6% the size of the allocation.  This is to avoid small long-lived
+  // allocations being placed right next to large allocations, hindering
+  // coalescing and returning pages to the OS.
+  if (left_over >= sizeof(free_t) && left_over > (size >> 6)) {
+    header_t* right = right_header(&head->header);
+    unlink_free(head, bucket);
+    void* free = (char*)head + rounded_up;
+    create_free_area(free, head, left_over);
+    FixLeftPointer(right, (header_t*)free);
+    head->header.size -= static_cast<uint32_t>(left_over);
+  } else {
+    unlink_free(head, bucket);
+  }
+  create_allocation_header(head, 0, head->header.size, head->header.left);
+  return &head->header;
+}
+
+NO_ASAN static void cmpct_free_internal(void* payload, header_t* header) TA_REQ(TheHeapLock::Get());
+
+#if CMPCT_MAGAZINES
+
+// Memory areas whose usable size is at most this many bytes are cached in the
+// per-CPU magazines, one magazine per free bucket.
+constexpr size_t kMagazineMaxSize = 256;
+constexpr int kMagazineBuckets = size_to_index_freeing(kMagazineMaxSize) + 1;
+
+// The capacity of each magazine, and how many areas a miss refills it with.
+constexpr uint32_t kMagazineRounds = 16;
+constexpr uint32_t kMagazineRefill = kMagazineRounds / 2;
+
+// An area in the magazine for bucket |i| has at least the usable size of an
+// allocation that starts its search at bucket |i|: on free an area goes to the
+// bucket given by size_to_index_freeing(), which rounds down, while refilled
+// areas were allocated for that very bucket.
+struct alignas(MAX_CACHE_LINE) Magazines {
+  DECLARE_MUTEX(Magazines) lock;
+  uint32_t count[kMagazineBuckets] TA_GUARDED(lock) = {};
+  header_t* rounds[kMagazineBuckets][kMagazineRounds] TA_GUARDED(lock) = {};
+};
+
+static Magazines g_magazines[SMP_MAX_CPUS];
+
+// Returns the magazine that the allocated area |header| would be freed to, or
+// kMagazineBuckets or more if it's too large for one. The size of an allocated
+// area only changes while it's owned by its allocator, so this doesn't need
+// the heap lock.
+NO_ASAN static int magazine_bucket(const header_t* header) {
+  ZX_ASSERT_MSG(header->size > sizeof(header_t), "got %u min %lu", header->size, sizeof(header_t));
+  return size_to_index_freeing(header->size - sizeof(header_t));
+}
+
+NO_ASAN static void* magazine_alloc(size_t size, size_t rounded_up, int bucket)
+    TA_EXCL(TheHeapLock::Get()) {
+  PREEMPT_DISABLE(preempt_disable);
+  Magazines& magazines = g_magazines[arch_curr_cpu_num()];
+  Guard<Mutex> magazine_guard{&magazines.lock};
+  uint32_t& count = magazines.count[bucket];
+
+  header_t* header;
+  if (count > 0) {
+    kcounter_add(malloc_magazine_alloc_hit, 1);
+    header = magazines.rounds[bucket][--count];
+    header->cookie = 0;
+  } else {
+    kcounter_add(malloc_magazine_alloc_miss, 1);
+    LockGuard guard(TheHeapLock::Get());
+    LOCAL_TRACE_DURATION("locked", trace_lock);
+    header = alloc_locked(size, rounded_up, bucket, /*grow=*/true);
+    if (header == NULL) {
+      guard.Release();
+      magazine_guard.Release();
+      heap_report_alloc_failure();
+      return NULL;
+    }
+    // Refill from what's already free, leaving growing the heap to the
+    // allocations that need it.
+    while (count < kMagazineRefill) {
+      header_t* round = alloc_locked(size, rounded_up, bucket, /*grow=*/false);
+      if (round == NULL) {
+        break;
+      }
+      magazines.rounds[bucket][count++] = round;
+    }
+  }
+  magazine_guard.Release();
+
+  void* result = header + 1;
+#ifdef CMPCT_DEBUG
+  memset(result, ALLOC_FILL, size);
+#endif
+  if (size < g_fill_on_alloc_threshold) {
+    memset(result, 0, size);
+  }
+  return result;
+}
+
+NO_ASAN static void magazine_free(header_t* header, int bucket) TA_EXCL(TheHeapLock::Get()) {
+#ifdef CMPCT_DEBUG
+  memset(header + 1, FREE_FILL, header->size - sizeof(header_t));
+#endif
+
+  PREEMPT_DISABLE(preempt_disable);
+  Magazines& magazines = g_magazines[arch_curr_cpu_num()];
+  Guard<Mutex> magazine_guard{&magazines.lock};
+  uint32_t& count = magazines.count[bucket];
+  header_t** rounds = magazines.rounds[bucket];
+
+#ifdef CMPCT_DEBUG
+  for (uint32_t i = 0; i < count; i++) {
+    ZX_ASSERT_MSG(rounds[i] != header, "double free of %p", header + 1);
+  }
+#endif
+
+  if (count == kMagazineRounds) {
+    // Flush the least recently freed half, keeping the areas most likely to
+    // still be in the cache.
+    kcounter_add(malloc_magazine_free_miss, 1);
+    {
+      LockGuard guard(TheHeapLock::Get());
+      LOCAL_TRACE_DURATION("locked", trace_lock);
+      for (uint32_t i = 0; i < kMagazineRounds / 2; i++) {
+        cmpct_free_internal(rounds[i] + 1, rounds[i]);
+      }
+    }
+    count -= kMagazineRounds / 2;
+    memmove(rounds, rounds + kMagazineRounds / 2, count * sizeof(rounds[0]));
+  } else {
+    kcounter_add(malloc_magazine_free_hit, 1);
+  }
+  rounds[count++] = header;
+}
+
+#endif  // CMPCT_MAGAZINES
+
 /****************************************************
  *
  * Public API
@@ -915,55 +1116,22 @@ NO_ASAN void* cmpct_alloc(size_t size) {
 
   rounded_up += sizeof(header_t);
 
+#if CMPCT_MAGAZINES
+  if (start_bucket < kMagazineBuckets) {
+    return magazine_alloc(size, rounded_up, start_bucket);
+  }
+#endif
+
   PREEMPT_DISABLE(preempt_disable);
   LockGuard guard(TheHeapLock::Get());
   LOCAL_TRACE_DURATION("locked", trace_lock);
-  int bucket = find_nonempty_bucket(start_bucket);
-  if (bucket == -1) {
-    // Grow heap by at least 12% if we can.
-    size_t growby =
-        std::min(HEAP_LARGE_ALLOC_BYTES,
-                 std::max(theheap.size >> 3, std::max(kHeapUsableGrowSize, rounded_up)));
-    // Validate that our growby calculation is correct, and that if we grew the heap by this amount
-    // we would actually satisfy our allocation.
-    ZX_DEBUG_ASSERT(growby >= rounded_up);
-    // Try to add a new OS allocation to the heap, reducing the size until
-    // we succeed or get too small.
-    while (!heap_grow(growby)) {
-      if (growby <= rounded_up) {
-        guard.Release();
-        heap_report_alloc_failure();
-        return NULL;
-      }
-      growby = std::max(growby >> 1, rounded_up);
-    }
-    bucket = find_nonempty_bucket(start_bucket);
-    // It should be the case that, since we hold the heap lock, after growing the heap there should
-    // be something in our target bucket. However, if there was any confusion in calculating the
-    // |growby| amount, then it's possible we still do not have something. As this could only happen
-    // due to a systemic configuration error, and this should get caught in tests, this only needs
-    // to be a DEBUG_ASSERT and not a always enabled ASSERT. Further, it should not be possible for
-    // the assertion of the growby amount above to succeed and then this assertion to fail.
-    ZX_DEBUG_ASSERT(bucket != -1);
-  }
-  free_t* head = theheap.free_lists[bucket];
-  size_t left_over = head->header.size - rounded_up;
-  // We can't carve off the rest for a new free space if it's smaller than the
-  // free-list linked structure.  We also don't carve it off if it's less than
-  // 1.6% the size of the allocation.  This is to avoid small long-lived
-  // allocations being placed right next to large allocations, hindering
-  // coalescing and returning pages to the OS.
-  if (left_over >= sizeof(free_t) && left_over > (size >> 6)) {
-    header_t* right = right_header(&head->header);
-    unlink_free(head, bucket);
-    void* free = (char*)head + rounded_up;
-    create_free_area(free, head, left_over);
-    FixLeftPointer(right, (header_t*)free);
-    head->header.size -= static_cast<uint32_t>(left_over);
-  } else {
-    unlink_free(head, bucket);
+  header_t* head = alloc_locked(size, rounded_up, start_bucket, /*grow=*/true);
+  if (head == NULL) {
+    guard.Release();
+    heap_report_alloc_failure();
+    return NULL;
   }
-  void* result = create_allocation_header(head, 0, head->header.size, head->header.left);
+  void* result = head + 1;
 #ifdef CMPCT_DEBUG
   check_free_fill(result, size);
   memset(result, ALLOC_FILL, size);
@@ -1046,10 +1214,16 @@ NO_ASAN void cmpct_free(void* payload) {
     return;
   }
 
+  header_t* header = (header_t*)payload - 1;
+#if CMPCT_MAGAZINES
+  if (const int bucket = magazine_bucket(header); bucket < kMagazineBuckets) {
+    return magazine_free(header, bucket);
+  }
+#endif
+
   PREEMPT_DISABLE(preempt_disable);
   LockGuard guard(TheHeapLock::Get());
   LOCAL_TRACE_DURATION("locked", trace_locked);
-  header_t* header = (header_t*)payload - 1;
   return cmpct_free_internal(payload, header);
 }
 
@@ -1059,9 +1233,6 @@ NO_ASAN void cmpct_sized_free(void* payload, size_t s) {
     return;
   }
 
-  PREEMPT_DISABLE(preempt_disable);
-  LockGuard guard(TheHeapLock::Get());
-  LOCAL_TRACE_DURATION("locked", trace_locked);
   header_t* header = (header_t*)payload - 1;
   // header->size is the size of the heap block |payload| is in, plus sizeof(header_t), plus
   // the difference between the block size and the requested allocation size. If kernel ASAN
@@ -1072,13 +1243,24 @@ NO_ASAN void cmpct_sized_free(void* payload, size_t s) {
   // 1. sizeof(header_t)
   // 2. sizeof(free_t) - we don't split heap blocks if the remaining space is < free_t,
   //    so free_t additional bytes can be present
-  // 3. A bucket- and size-dependent extra space, see cmpct_alloc's computation.
+  // 3. A bucket- and size-dependent extra space, see cmpct_alloc's computation. Tiny sizes are
+  //    first rounded up to the minimum usable size, which can exceed any proportional bound.
   //
   // The computation here is a conservative limit on that difference rather than a precise limit.
-  const size_t max_diff = sizeof(header_t) + sizeof(free_t) + (s >> 2);
+  const size_t max_diff =
+      sizeof(header_t) + sizeof(free_t) + std::max(s >> 2, sizeof(free_t) - sizeof(header_t));
   ZX_ASSERT_MSG((static_cast<size_t>(header->size) - s) <= max_diff, "header->size %u s %lu",
                 header->size, s);
 #endif
+#if CMPCT_MAGAZINES
+  if (const int bucket = magazine_bucket(header); bucket < kMagazineBuckets) {
+    return magazine_free(header, bucket);
+  }
+#endif
+
+  PREEMPT_DISABLE(preempt_disable);
+  LockGuard guard(TheHeapLock::Get());
+  LOCAL_TRACE_DURATION("locked", trace_locked);
   return cmpct_free_internal(payload, header);
 }
 
@@ -1134,6 +1316,27 @@ NO_ASAN void* cmpct_memalign(size_t alignment, size_t size) {
 
 void cmpct_set_fill_on_alloc_threshold(size_t size) { g_fill_on_alloc_threshold = size; }
 
+NO_ASAN size_t cmpct_drain_magazines(void) {
+  size_t drained_bytes = 0;
+#if CMPCT_MAGAZINES
+  for (Magazines& magazines : g_magazines) {
+    PREEMPT_DISABLE(preempt_disable);
+    Guard<Mutex> magazine_guard{&magazines.lock};
+    LockGuard guard(TheHeapLock::Get());
+    for (int bucket = 0; bucket < kMagazineBuckets; bucket++) {
+      for (uint32_t i = 0; i < magazines.count[bucket]; i++) {
+        header_t* header = magazines.rounds[bucket][i];
+        drained_bytes += header->size;
+        cmpct_free_internal(header + 1, header);
+      }
+      magazines.count[bucket] = 0;
+    }
+  }
+  kcounter_add(malloc_magazine_drained_bytes, drained_bytes);
+#endif
+  return drained_bytes;
+}
+
 void cmpct_init(void) {
   LTRACE_ENTRY;
   LockGuard guard(TheHeapLock::Get());
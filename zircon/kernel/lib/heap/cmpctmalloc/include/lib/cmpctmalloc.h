@@ -46,6 +46,11 @@ void* cmpct_memalign(size_t alignment, size_t size) TA_EXCL(TheHeapLock::Get());
 
 // Zero-fill allocations smaller than |size|
 void cmpct_set_fill_on_alloc_threshold(size_t size);
+
+// Returns the memory areas cached in the per-CPU magazines to the free buckets, so that they can be
+// coalesced and possibly returned to the OS. Returns the number of bytes drained. This is intended
+// to be used to recover memory under low memory conditions.
+size_t cmpct_drain_magazines(void) TA_EXCL(TheHeapLock::Get());
 void cmpct_init(void) TA_EXCL(TheHeapLock::Get());
 void cmpct_dump(CmpctDumpOptions options) TA_EXCL(TheHeapLock::Get());
 void cmpct_get_info(size_t* used_bytes, size_t* free_bytes, size_t* cached_bytes)
@@ -261,6 +261,8 @@ void heap_get_info(size_t* total_bytes, size_t* free_bytes) {
   }
 }
 
+size_t heap_drain_caches() { return cmpct_drain_magazines(); }
+
 static void heap_test() { cmpct_test(); }
 
 void* heap_page_alloc(size_t pages) {
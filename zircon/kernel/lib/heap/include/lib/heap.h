@@ -34,6 +34,11 @@ void sized_free(void* ptr, size_t s);
 // from the PMM), |free_bytes| is the free portion.
 void heap_get_info(size_t* total_bytes, size_t* free_bytes);
 
+// Returns the memory held in the heap's per-CPU caches to the heap proper, so that it can be
+// coalesced and possibly returned to the PMM. Returns the number of bytes drained. This is intended
+// to be used to recover memory under low memory conditions.
+size_t heap_drain_caches(void);
+
 // called once at kernel initialization
 void heap_init(void);
 
@@ -186,6 +186,16 @@ class KTraceState {
     KTraceState* ks_{nullptr};
   };
 
+  // The number of records which could not be written because no space could be reserved for
+  // them, and the number of bytes of older records discarded to make room for newer ones while
+  // operating in circular mode. Both are reset by a rewind. The same events are also accumulated,
+  // per CPU, in the ktrace.* kcounters.
+  uint64_t dropped_records() const { return dropped_records_.load(ktl::memory_order_relaxed); }
+  uint64_t overwritten_bytes() const TA_EXCL(write_lock_) {
+    Guard<TraceDisabledSpinLock, IrqSave> write_guard{&write_lock_};
+    return overwritten_bytes_;
+  }
+
   // Reserve enough bytes of contiguous space in the buffer to fit the FXT Record described by
   // `header`, if possible.
   zx::result<PendingCommit> Reserve(uint64_t header) {
@@ -194,6 +204,7 @@ class KTraceState {
     }
     uint64_t* const ptr = ReserveRaw(fxt::RecordFields::RecordSize::Get<uint32_t>(header));
     if (ptr == nullptr) {
+      RecordDroppedRecord();
       ClearMaskDisableWrites();
       DecPendingWrite();
       return zx::error(ZX_ERR_NO_MEMORY);
@@ -238,6 +249,9 @@ class KTraceState {
   // Attempt to allocate our buffer, if we have not already done so.
   zx_status_t AllocBuffer() TA_REQ(lock_);
 
+  // Accounts for a record which was dropped because ReserveRaw failed.
+  void RecordDroppedRecord();
+
   // Reserve the given number of words in the trace buffer. Returns nullptr if the reservation
   // fails.
   uint64_t* ReserveRaw(uint32_t num_words);
@@ -404,6 +418,10 @@ class KTraceState {
   uint64_t wr_ TA_GUARDED(write_lock_){0};
   uint32_t circular_size_ TA_GUARDED(write_lock_){0};
   uint32_t wrap_offset_ TA_GUARDED(write_lock_){0};
+  uint64_t overwritten_bytes_ TA_GUARDED(write_lock_){0};
+
+  // Updated outside of the write lock, when a reservation has already failed.
+  ktl::atomic<uint64_t> dropped_records_{0};
 
   // Note: these don't _actually_ have to be protected by the write lock.
   // Memory ordering consistency for mutators of these variables are protected
@@ -6,6 +6,7 @@
 
 #include <debug.h>
 #include <lib/boot-options/boot-options.h>
+#include <lib/counters.h>
 #include <lib/fxt/fields.h>
 #include <lib/fxt/interned_category.h>
 #include <lib/ktrace.h>
@@ -37,6 +38,12 @@ namespace {
 
 using fxt::operator""_category;
 
+// Records which could not be written to the trace buffer, and bytes of older records discarded to
+// make room for new ones in circular mode. Kcounters are kept per CPU, so these show which CPUs
+// are losing trace data.
+KCOUNTER(ktrace_records_dropped, "ktrace.records_dropped")
+KCOUNTER(ktrace_bytes_overwritten, "ktrace.bytes_overwritten")
+
 struct CategoryEntry {
   uint32_t index;
   const fxt::InternedCategory& category;
@@ -218,6 +225,10 @@ zx_status_t KTraceState::Stop() {
     return ZX_ERR_TIMED_OUT;
   }
 
+  if (const uint64_t dropped = dropped_records(); dropped > 0) {
+    DiagsPrintf(INFO, "ktrace: %lu records dropped since the last rewind\n", dropped);
+  }
+
   // Great, we are now officially stopped.  Record this.
   is_started_ = false;
   return ZX_OK;
@@ -247,6 +258,9 @@ zx_status_t KTraceState::RewindLocked() {
     wrap_offset_ = 0;
     circular_size_ = 0;
 
+    overwritten_bytes_ = 0;
+    dropped_records_.store(0, ktl::memory_order_relaxed);
+
     // We cannot add metadata rewind if we have not allocated a buffer yet.
     if (buffer_ == nullptr) {
       wr_ = 0;
@@ -491,6 +505,11 @@ zx_status_t KTraceState::AllocBuffer() {
   return ZX_OK;
 }
 
+void KTraceState::RecordDroppedRecord() {
+  dropped_records_.fetch_add(1, ktl::memory_order_relaxed);
+  ktrace_records_dropped.Add(1);
+}
+
 uint64_t* KTraceState::ReserveRaw(uint32_t num_words) {
   // At least one word must be reserved to store the trace record header.
   DEBUG_ASSERT(num_words >= 1);
@@ -573,6 +592,8 @@ uint64_t* KTraceState::ReserveRaw(uint32_t num_words) {
         // Now go ahead and move read up.
         rd_ += sz;
         avail += sz;
+        overwritten_bytes_ += sz;
+        ktrace_bytes_overwritten.Add(sz);
       }
 
       // Great, we now have space for our reservation.  If we have enough space
@@ -261,6 +261,11 @@ class TestKTraceState : public ::internal::KTraceState {
     EXPECT_TRUE(state.TestAllRecords(rcnt, checker));
     EXPECT_EQ(kMaxWords / 2, rcnt);
 
+    // Saturating drops the record which did not fit, after which the group
+    // mask is cleared and no further writes are attempted.
+    EXPECT_EQ(1u, state.dropped_records());
+    EXPECT_EQ(0u, state.overwritten_bytes());
+
     // Finally, rewind again.  The offset should return to the
     // beginning, and there should be no records in the buffer.
     ASSERT_OK(state.Rewind());
@@ -268,6 +273,7 @@ class TestKTraceState : public ::internal::KTraceState {
     EXPECT_EQ(0u, state.grpmask());
     EXPECT_TRUE(state.TestAllRecords(rcnt, checker));
     EXPECT_EQ(0u, rcnt);
+    EXPECT_EQ(0u, state.dropped_records());
 
     END_TEST;
   }
@@ -541,6 +547,10 @@ class TestKTraceState : public ::internal::KTraceState {
         EXPECT_EQ(2u + kMaxCircular32bRecords, enumerated_records);
         EXPECT_FALSE(saw_padding);
       }
+
+      // Wrapping discards older records rather than dropping new ones.
+      EXPECT_EQ(0u, state.dropped_records());
+      EXPECT_LT(0u, state.overwritten_bytes());
     }
 
     END_TEST;
@@ -8,6 +8,7 @@
 #define ZIRCON_KERNEL_LIB_PAGE_CACHE_INCLUDE_LIB_PAGE_CACHE_H_
 
 #include <inttypes.h>
+#include <lib/fit/defer.h>
 #include <lib/ktrace.h>
 #include <lib/zx/result.h>
 #include <trace.h>
@@ -25,6 +26,7 @@
 #include <kernel/mutex.h>
 #include <ktl/move.h>
 #include <ktl/unique_ptr.h>
+#include <platform/timer.h>
 #include <vm/page_state.h>
 #include <vm/physmap.h>
 #include <vm/pmm.h>
@@ -146,6 +148,11 @@ class PageCache {
 
   size_t reserve_pages() const { return reserve_pages_; }
 
+  // Returns all pages held in the per-CPU caches to the PMM, returning the number of pages freed.
+  // The caches will be refilled, in batches, on subsequent allocations. This is intended to be used
+  // to recover memory under low memory conditions.
+  size_t Drain();
+
   void SeedRandomShouldWait();
 
  private:
@@ -171,6 +178,8 @@ class PageCache {
   static void CountRefillPages(size_t page_count);
   static void CountReturnPages(size_t page_count);
   static void CountFreePages(size_t page_count);
+  static void CountDrainPages(size_t page_count);
+  static void CountFillTime(zx_duration_t duration);
 
   // Attempts to allocate the given number of pages from the CPU cache. If the
   // cache is insufficient for the request, falls back to the PMM to fulfill the
@@ -256,6 +265,11 @@ class PageCache {
         kTraceEnabled, "kernel:sched", "PageCache::AllocatePagesAndFillCache",
         ("requested_pages", requested_pages), ("alloc_flags", alloc_flags));
 
+    // Track the time spent waiting on the fill lock and in the PMM, which is
+    // the cost paid by a cache miss.
+    const zx_time_t fill_start = current_time();
+    auto count_fill_time = fit::defer([fill_start]() { CountFillTime(current_time() - fill_start); });
+
     // Serialize cache fill + allocate operations on this cache. Contention
     // means another thread tried to allocate from the PMM and blocked on the
     // PMM lock. There's no benefit to following the owning thread into the PMM
@@ -17,6 +17,8 @@ KCOUNTER(page_cache_miss_pages, "cache.page.missed")
 KCOUNTER(page_cache_refill_pages, "cache.page.refilled")
 KCOUNTER(page_cache_return_pages, "cache.page.returned")
 KCOUNTER(page_cache_free_pages, "cache.page.freed")
+KCOUNTER(page_cache_drain_pages, "cache.page.drained")
+KCOUNTER(page_cache_fill_time, "cache.page.fill_time_ns")
 
 namespace page_cache {
 
@@ -33,6 +35,24 @@ zx::result<PageCache> PageCache::Create(size_t reserve_pages) {
   return zx::ok(PageCache{reserve_pages, ktl::move(entries)});
 }
 
+size_t PageCache::Drain() {
+  ASSERT(per_cpu_caches_);
+  size_t drained = 0;
+  for (auto &entry : per_cpu_caches_) {
+    // Pages are returned to the PMM by the PageList destructor, which runs after the cache lock has
+    // been dropped.
+    PageList page_list;
+    {
+      Guard<Mutex> guard{&entry.cache_lock};
+      list_move(&entry.free_list, &page_list);
+      drained += entry.available_pages;
+      entry.available_pages = 0;
+    }
+  }
+  CountDrainPages(drained);
+  return drained;
+}
+
 void PageCache::SeedRandomShouldWait() {
   ASSERT(per_cpu_caches_);
   for (auto &entry : per_cpu_caches_) {
@@ -63,4 +83,10 @@ void PageCache::CountFreePages(size_t page_count) {
   page_cache_free_pages.Add(static_cast<int64_t>(page_count));
 }
 
+void PageCache::CountDrainPages(size_t page_count) {
+  page_cache_drain_pages.Add(static_cast<int64_t>(page_count));
+}
+
+void PageCache::CountFillTime(zx_duration_t duration) { page_cache_fill_time.Add(duration); }
+
 }  // namespace page_cache
@@ -116,6 +116,23 @@ bool page_cache_tests() {
     EXPECT_EQ(0u, list_length(&null_result2->page_list));
   }
 
+  // Draining returns all cached pages to the PMM and leaves the cache empty, with the next
+  // allocation refilling it.
+  {
+    auto null_result = page_cache.Allocate(0);
+    ASSERT_TRUE(null_result.is_ok());
+    EXPECT_EQ(reserve_pages, null_result->available_pages);
+
+    EXPECT_EQ(reserve_pages, page_cache.Drain());
+    EXPECT_EQ(0u, page_cache.Drain());
+
+    const size_t page_count = 1;
+    auto result = page_cache.Allocate(page_count);
+    ASSERT_TRUE(result.is_ok());
+    EXPECT_EQ(page_count, list_length(&result->page_list));
+    EXPECT_EQ(reserve_pages, result->available_pages);
+  }
+
   // Verify that random should wait will work by repeatedly allocating and freeing a page until we
   // get should wait.
   {
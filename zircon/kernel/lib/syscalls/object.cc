@@ -470,6 +470,16 @@ zx_status_t sys_object_get_info(zx_handle_t handle, uint32_t topic, user_out_ptr
 
       return single_record_result(_buffer, buffer_size, _actual, _avail, info);
     }
+    case ZX_INFO_THREAD_QUEUE_LATENCY: {
+      fbl::RefPtr<ThreadDispatcher> thread;
+      auto error =
+          up->handle_table().GetDispatcherWithRights(*up, handle, ZX_RIGHT_INSPECT, &thread);
+      if (error != ZX_OK)
+        return error;
+
+      const zx_info_thread_queue_latency_t info = thread->GetQueueLatency();
+      return single_record_result(_buffer, buffer_size, _actual, _avail, info);
+    }
     case ZX_INFO_TASK_STATS: {
       // TODO(https://fxbug.dev/42105279): Handle forward/backward compatibility issues
       // with changes to the struct.
@@ -30,6 +30,9 @@ class user_iovec {
 
   explicit user_iovec(VecType* vector, size_t count) : vector_(vector), count_(count) {}
 
+  // Returns the number of buffers in the iovec.
+  size_t count() const { return count_; }
+
   zx_status_t GetTotalCapacity(size_t* out_capacity) const {
     size_t total_capacity = 0;
     zx_status_t status = ForEach([&total_capacity](PtrType ptr, size_t capacity) {
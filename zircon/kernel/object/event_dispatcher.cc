@@ -6,30 +6,52 @@
 
 #include "object/event_dispatcher.h"
 
+#include <lib/boot-options/boot-options.h>
 #include <lib/counters.h>
 #include <zircon/errors.h>
 #include <zircon/rights.h>
 #include <zircon/types.h>
 
-#include <fbl/alloc_checker.h>
+#include <lk/init.h>
 
 KCOUNTER(dispatcher_event_create_count, "dispatcher.event.create")
 KCOUNTER(dispatcher_event_destroy_count, "dispatcher.event.destroy")
+KCOUNTER(dispatcher_event_alloc_failed_count, "dispatcher.event.alloc_failed")
+
+namespace {
+
+// Per-cpu cache allocator for EventDispatchers.
+object_cache::ObjectCache<EventDispatcher, object_cache::Option::PerCpu> event_allocator;
+
+}  // namespace
 
 zx_status_t EventDispatcher::Create(uint32_t options, KernelHandle<EventDispatcher>* handle,
                                     zx_rights_t* rights) {
-  fbl::AllocChecker ac;
-  KernelHandle event(fbl::AdoptRef(new (&ac) EventDispatcher(options)));
-  if (!ac.check())
-    return ZX_ERR_NO_MEMORY;
+  zx::result result = event_allocator.Allocate(ConstructorTag{}, options);
+  if (result.is_error()) {
+    kcounter_add(dispatcher_event_alloc_failed_count, 1);
+    return result.error_value();
+  }
+  KernelHandle event(fbl::AdoptRef(result.value().release()));
 
   *rights = default_rights();
   *handle = ktl::move(event);
   return ZX_OK;
 }
 
-EventDispatcher::EventDispatcher(uint32_t options) {
+EventDispatcher::EventDispatcher(ConstructorTag, uint32_t options) {
   kcounter_add(dispatcher_event_create_count, 1);
 }
 
 EventDispatcher::~EventDispatcher() { kcounter_add(dispatcher_event_destroy_count, 1); }
+
+void EventDispatcher::InitializeCacheAllocator(uint32_t /*level*/) {
+  zx::result result =
+      object_cache::ObjectCache<EventDispatcher, object_cache::Option::PerCpu>::Create(
+          gBootOptions->event_reserve_pages);
+  ASSERT(result.is_ok());
+  event_allocator = ktl::move(*result);
+}
+
+// Initialize the cache after the percpu data structures are initialized.
+LK_INIT_HOOK(event_cache_init, EventDispatcher::InitializeCacheAllocator, LK_INIT_LEVEL_KERNEL + 1)
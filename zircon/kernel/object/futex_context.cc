@@ -245,6 +245,18 @@ zx_status_t FutexContext::FutexWait(user_in_ptr<const zx_futex_t> value_ptr,
     return result;
   }
 
+  // Check the value once before touching any futex state. If it already differs from
+  // |current_value| the wait would fail the same check below, and returning now avoids taking the
+  // process-wide pool lock to activate and then release a FutexState. If the value matches, or
+  // cannot be read here, the check is repeated under the FutexState lock, which is what makes the
+  // comparison atomic with respect to wakes.
+  {
+    zx_futex_t value;
+    if (value_ptr.copy_from_user(&value) == ZX_OK && value != current_value) {
+      return ZX_ERR_BAD_STATE;
+    }
+  }
+
   fbl::RefPtr<ThreadDispatcher> futex_owner_thread;
   const zx_status_t validator_status = ValidateFutexOwner(new_futex_owner, &futex_owner_thread);
 
@@ -11,20 +11,29 @@
 #include <zircon/rights.h>
 #include <zircon/types.h>
 
+#include <lib/object_cache.h>
 #include <object/dispatcher.h>
 #include <object/handle.h>
 
+// Events are among the most frequently created and destroyed kernel objects, so
+// they are allocated from a per-CPU object cache rather than the general heap.
 class EventDispatcher final
-    : public SoloDispatcher<EventDispatcher, ZX_DEFAULT_EVENT_RIGHTS, ZX_EVENT_SIGNALED> {
+    : public SoloDispatcher<EventDispatcher, ZX_DEFAULT_EVENT_RIGHTS, ZX_EVENT_SIGNALED>,
+      public object_cache::Deletable<EventDispatcher> {
+  // Restricts construction to Create() while keeping the constructor visible to
+  // the object cache.
+  struct ConstructorTag {};
+
  public:
   static zx_status_t Create(uint32_t options, KernelHandle<EventDispatcher>* handle,
                             zx_rights_t* rights);
 
+  EventDispatcher(ConstructorTag, uint32_t options);
   ~EventDispatcher() final;
   zx_obj_type_t get_type() const final { return ZX_OBJ_TYPE_EVENT; }
 
- private:
-  explicit EventDispatcher(uint32_t options);
+  // Initializes the object cache backing EventDispatcher allocations.
+  static void InitializeCacheAllocator(uint32_t level);
 };
 
 fbl::RefPtr<EventDispatcher> GetMemPressureEvent(uint32_t kind);
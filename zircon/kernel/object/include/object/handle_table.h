@@ -254,6 +254,12 @@ class HandleTable : public fbl::RefCounted<HandleTable> {
 
     {
       // Scope utilized to reduce lock duration.
+      //
+      // Although the Handle storage is type stable, and so could be validated optimistically
+      // under a sequence lock, the reference to the dispatcher must be acquired while the handle
+      // is known to still be in the table. Once the handle is removed its dispatcher reference may
+      // be the last one and the dispatcher can be destroyed at any point, so without a deferred
+      // reclamation scheme the lock is what keeps the dispatcher alive here.
       Guard<BrwLockPi, BrwLockPi::Reader> guard{&lock_};
       Handle* handle = GetHandleLocked(caller, handle_value);
       if (!handle)
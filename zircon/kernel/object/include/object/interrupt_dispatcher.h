@@ -13,6 +13,7 @@
 #include <zircon/rights.h>
 #include <zircon/types.h>
 
+#include <kernel/cpu.h>
 #include <kernel/event.h>
 #include <kernel/spinlock.h>
 #include <object/dispatcher.h>
@@ -44,6 +45,22 @@ class InterruptDispatcher : public SoloDispatcher<InterruptDispatcher, ZX_DEFAUL
   zx_status_t Bind(fbl::RefPtr<PortDispatcher> port_dispatcher, uint64_t key);
   zx_status_t Unbind(fbl::RefPtr<PortDispatcher> port_dispatcher);
 
+  // Steers the interrupt to the CPUs in |mask|, and co-locates the threads that wait for it in
+  // WaitForInterrupt() by setting their soft affinity to the same CPUs, so that an interrupt and
+  // the thread processing it don't cross cores on every completion.
+  //
+  // Virtual interrupts have no routing of their own, so only their waiters are affected.
+  //
+  // Returns ZX_ERR_INVALID_ARGS if |mask| contains no online CPU, or ZX_ERR_NOT_SUPPORTED if the
+  // routing of this interrupt can't be changed.
+  zx_status_t SetAffinity(cpu_mask_t mask);
+
+  // The mask from the last successful SetAffinity(), or 0 if it was never called.
+  cpu_mask_t affinity() const {
+    Guard<SpinLock, IrqSave> guard{&spinlock_};
+    return affinity_;
+  }
+
   void on_zero_handles() final;
 
   // Default wake vector diagnostics for interrupt dispatchers.
@@ -57,6 +74,8 @@ class InterruptDispatcher : public SoloDispatcher<InterruptDispatcher, ZX_DEFAUL
   virtual void UnmaskInterrupt() = 0;
   virtual void DeactivateInterrupt() = 0;
   virtual void UnregisterInterruptHandler() = 0;
+  // Routes the hardware interrupt to the CPUs in |mask|. Not supported by default.
+  virtual zx_status_t SetInterruptAffinity(cpu_mask_t mask) { return ZX_ERR_NOT_SUPPORTED; }
 
   enum Flags : uint32_t {
     // The interrupt is virtual.
@@ -100,9 +119,10 @@ class InterruptDispatcher : public SoloDispatcher<InterruptDispatcher, ZX_DEFAUL
   PortInterruptPacket port_packet_ TA_GUARDED(spinlock_) = {};
   fbl::RefPtr<PortDispatcher> port_dispatcher_ TA_GUARDED(spinlock_);
   wake_vector::WakeEvent wake_event_ TA_GUARDED(spinlock_);
+  cpu_mask_t affinity_ TA_GUARDED(spinlock_) = 0;
 
   // Controls the access to Interrupt properties
-  DECLARE_SPINLOCK(InterruptDispatcher) spinlock_;
+  mutable DECLARE_SPINLOCK(InterruptDispatcher) spinlock_;
 };
 
 #endif  // ZIRCON_KERNEL_OBJECT_INCLUDE_OBJECT_INTERRUPT_DISPATCHER_H_
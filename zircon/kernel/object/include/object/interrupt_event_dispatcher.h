@@ -37,6 +37,7 @@ class InterruptEventDispatcher final : public InterruptDispatcher {
   void UnmaskInterrupt() final;
   void DeactivateInterrupt() final;
   void UnregisterInterruptHandler() final;
+  zx_status_t SetInterruptAffinity(cpu_mask_t mask) final;
 
   zx_status_t RegisterInterruptHandler();
   static void IrqHandler(void* ctx);
@@ -105,7 +105,10 @@ class MBufChain {
     // Always 0 in ZX_SOCKET_STREAM mode.
     uint32_t pkt_len_ = 0u;
     uint64_t unused_;
-    char data_[kPayloadSize] = {0};
+    // Deliberately left uninitialized: only the first |len_| bytes are ever read, and they are
+    // always written first, so zeroing each new MBuf would only add a 2KB memset to every
+    // allocation on the write path.
+    char data_[kPayloadSize];
     // TODO: maybe union data_ with char* blocks for large messages
   };
   static_assert(sizeof(MBuf) == MBuf::kMallocSize);
@@ -18,6 +18,7 @@
 #include <kernel/mutex.h>
 #include <kernel/semaphore.h>
 #include <kernel/spinlock.h>
+#include <ktl/span.h>
 #include <ktl/unique_ptr.h>
 #include <object/dispatcher.h>
 #include <object/handle.h>
@@ -245,6 +246,11 @@ class PortDispatcher final : public SoloDispatcher<PortDispatcher, ZX_DEFAULT_PO
   zx_status_t QueueUser(const zx_port_packet_t& packet);
   bool QueueInterruptPacket(PortInterruptPacket* port_packet, zx_instant_boot_t timestamp);
   zx_status_t Dequeue(const Deadline& deadline, zx_port_packet_t* packet);
+  // Waits until |deadline| for at least one packet, as Dequeue does, and then dequeues as many
+  // further packets as are immediately available without blocking, up to the size of |packets|.
+  // On success |actual| is set to the number of packets written, which is at least one.
+  zx_status_t DequeueMany(const Deadline& deadline, ktl::span<zx_port_packet_t> packets,
+                          size_t* actual);
   bool RemoveInterruptPacket(PortInterruptPacket* port_packet);
 
   // This method determines the observer's fate. Upon return, one of the following will have
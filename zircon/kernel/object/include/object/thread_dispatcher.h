@@ -189,6 +189,9 @@ class ThreadDispatcher final : public SoloDispatcher<ThreadDispatcher, ZX_DEFAUL
   // ready or running state.
   TaskRuntimeStats GetCompensatedTaskRuntimeStats() const;
 
+  // Fetch the distribution of time this thread has spent ready to run before being scheduled.
+  zx_info_thread_queue_latency_t GetQueueLatency() const;
+
   // For debugger usage.
   zx_status_t ReadState(zx_thread_state_topic_t state_kind, user_out_ptr<void> buffer,
                         size_t buffer_size) TA_EXCL(get_lock());
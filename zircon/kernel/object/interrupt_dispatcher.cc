@@ -6,15 +6,24 @@
 
 #include "object/interrupt_dispatcher.h"
 
+#include <lib/counters.h>
 #include <platform.h>
 #include <zircon/syscalls/port.h>
 
 #include <dev/interrupt.h>
 #include <kernel/auto_preempt_disabler.h>
 #include <kernel/idle_power_thread.h>
+#include <kernel/mp.h>
+#include <kernel/thread.h>
 #include <object/port_dispatcher.h>
 #include <object/process_dispatcher.h>
 
+// Interrupts delivered to a waiting thread or port.
+KCOUNTER(interrupt_delivered_count, "interrupt.delivered")
+// Interrupts that arrived while a previous one was still pending delivery or acknowledgement, and
+// were merged into it.
+KCOUNTER(interrupt_coalesced_count, "interrupt.coalesced")
+
 InterruptDispatcher::InterruptDispatcher(Flags flags)
     : WakeVector(&InterruptDispatcher::wake_event_),
       timestamp_(0),
@@ -27,9 +36,11 @@ InterruptDispatcher::InterruptDispatcher(Flags flags)
 
 zx_status_t InterruptDispatcher::WaitForInterrupt(zx_instant_boot_t* out_timestamp) {
   bool defer_unmask = false;
+  cpu_mask_t affinity = 0;
   while (true) {
     {
       Guard<SpinLock, IrqSave> guard{&spinlock_};
+      affinity = affinity_;
       if (port_dispatcher_) {
         return ZX_ERR_BAD_STATE;
       }
@@ -37,6 +48,7 @@ zx_status_t InterruptDispatcher::WaitForInterrupt(zx_instant_boot_t* out_timesta
         case InterruptState::DESTROYED:
           return ZX_ERR_CANCELED;
         case InterruptState::TRIGGERED:
+          interrupt_delivered_count.Add(1);
           state_ = InterruptState::NEEDACK;
           *out_timestamp = timestamp_;
           timestamp_ = 0;
@@ -63,6 +75,15 @@ zx_status_t InterruptDispatcher::WaitForInterrupt(zx_instant_boot_t* out_timesta
       UnmaskInterrupt();
     }
 
+    // Follow the interrupt, so that the waiter is woken on the CPU that took it. This only takes
+    // the thread lock when the affinity actually changes.
+    if (affinity != 0) {
+      Thread* current = Thread::Current::Get();
+      if (current->GetSoftCpuAffinity() != affinity) {
+        current->SetSoftCpuAffinity(affinity);
+      }
+    }
+
     {
       ThreadDispatcher::AutoBlocked by(ThreadDispatcher::Blocked::INTERRUPT);
       zx_status_t status = event_.Wait(Deadline::infinite());
@@ -82,6 +103,9 @@ zx_status_t InterruptDispatcher::WaitForInterrupt(zx_instant_boot_t* out_timesta
 
 bool InterruptDispatcher::SendPacketLocked(zx_instant_boot_t timestamp) {
   bool status = port_dispatcher_->QueueInterruptPacket(&port_packet_, timestamp);
+  if (status) {
+    interrupt_delivered_count.Add(1);
+  }
   if (flags_ & INTERRUPT_MASK_POSTWAIT) {
     MaskInterrupt();
   }
@@ -108,8 +132,12 @@ zx_status_t InterruptDispatcher::Trigger(zx_instant_boot_t timestamp) {
   if (state_ == InterruptState::NEEDACK && port_dispatcher_) {
     // Cannot trigger a interrupt without ACK
     // only record timestamp if this is the first signal since we started waiting
+    interrupt_coalesced_count.Add(1);
     return ZX_OK;
   }
+  if (state_ == InterruptState::TRIGGERED) {
+    interrupt_coalesced_count.Add(1);
+  }
 
   if (port_dispatcher_) {
     SendPacketLocked(timestamp);
@@ -121,6 +149,20 @@ zx_status_t InterruptDispatcher::Trigger(zx_instant_boot_t timestamp) {
   return ZX_OK;
 }
 
+zx_status_t InterruptDispatcher::SetAffinity(cpu_mask_t mask) {
+  if ((mask & mp_get_online_mask()) == 0) {
+    return ZX_ERR_INVALID_ARGS;
+  }
+  if (!(flags_ & INTERRUPT_VIRTUAL)) {
+    if (zx_status_t status = SetInterruptAffinity(mask); status != ZX_OK) {
+      return status;
+    }
+  }
+  Guard<SpinLock, IrqSave> guard{&spinlock_};
+  affinity_ = mask;
+  return ZX_OK;
+}
+
 void InterruptDispatcher::InterruptHandler() {
   // Using preempt disable is not necessary for correctness, since we should
   // be in an interrupt context with preemption disabled, but we re-disable anyway
@@ -133,8 +175,12 @@ void InterruptDispatcher::InterruptHandler() {
     timestamp_ = current_boot_time();
   }
   if (state_ == InterruptState::NEEDACK && port_dispatcher_) {
+    interrupt_coalesced_count.Add(1);
     return;
   }
+  if (state_ == InterruptState::TRIGGERED) {
+    interrupt_coalesced_count.Add(1);
+  }
   if (port_dispatcher_) {
     SendPacketLocked(timestamp_);
     state_ = InterruptState::NEEDACK;
@@ -161,3 +161,7 @@ zx_status_t InterruptEventDispatcher::RegisterInterruptHandler() {
 void InterruptEventDispatcher::UnregisterInterruptHandler() {
   register_int_handler(vector_, nullptr, nullptr);
 }
+
+zx_status_t InterruptEventDispatcher::SetInterruptAffinity(cpu_mask_t mask) {
+  return set_interrupt_affinity(vector_, mask);
+}
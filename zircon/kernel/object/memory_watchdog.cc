@@ -7,6 +7,7 @@
 #include <lib/boot-options/boot-options.h>
 #include <lib/counters.h>
 #include <lib/debuglog.h>
+#include <lib/heap.h>
 #include <lib/zircon-internal/macros.h>
 
 #include <object/executor.h>
@@ -15,6 +16,7 @@
 #include <platform/halt_token.h>
 #include <pretty/cpp/sizes.h>
 #include <vm/scanner.h>
+#include <vm/vm_cow_pages.h>
 
 using pretty::FormattedBytes;
 
@@ -224,6 +226,19 @@ void MemoryWatchdog::WorkerThread() {
       printf("memory-pressure: free memory is %zuMB, evicting pages to prevent OOM...\n",
              pmm_count_free_pages() * PAGE_SIZE / MB);
       pmm_page_queues()->Dump();
+      // Pages held in the per-CPU VMO page caches are immediately reclaimable, so return them
+      // before resorting to eviction.
+      const size_t drained_pages = VmCowPages::DrainPageCache();
+      if (drained_pages > 0) {
+        printf("memory-pressure: returned %zu cached pages to the pmm\n", drained_pages);
+        mem_event_idx_ = CalculatePressureLevel();
+      }
+      // Likewise for the heap's per-CPU caches, which may free up entire heap allocations.
+      const size_t drained_heap_bytes = heap_drain_caches();
+      if (drained_heap_bytes > 0) {
+        printf("memory-pressure: returned %zu cached bytes to the heap\n", drained_heap_bytes);
+        mem_event_idx_ = CalculatePressureLevel();
+      }
       // Keep trying to perform eviction for as long as we are evicting non-zero pages and we remain
       // in the out of memory state.
       while (mem_event_idx_ == PressureLevel::kOutOfMemory) {
@@ -6,6 +6,7 @@
 
 #include "object/message_packet.h"
 
+#include <lib/counters.h>
 #include <stdint.h>
 #include <string.h>
 #include <zircon/errors.h>
@@ -20,6 +21,16 @@
 
 #include <ktl/enforce.h>
 
+// Counts of user messages by how their payload was gathered from user space, along with the number
+// of bytes copied in by each path. Every byte counted here is copied once into the BufferChain on
+// write and once more out of it on read.
+KCOUNTER(channel_write_contiguous, "channel.write.contiguous")
+KCOUNTER(channel_write_contiguous_bytes, "channel.write.contiguous.bytes")
+KCOUNTER(channel_write_iovec, "channel.write.iovec")
+KCOUNTER(channel_write_iovec_bytes, "channel.write.iovec.bytes")
+KCOUNTER(channel_write_iovec_unbounded, "channel.write.iovec_unbounded")
+KCOUNTER(channel_write_iovec_unbounded_bytes, "channel.write.iovec_unbounded.bytes")
+
 // MessagePackets have special allocation requirements because they can contain a variable number of
 // handles and a variable size payload.
 //
@@ -94,6 +105,8 @@ zx_status_t MessagePacket::Create(user_in_ptr<const char> data, uint32_t data_si
   if (unlikely(status != ZX_OK)) {
     return status;
   }
+  channel_write_contiguous.Add(1);
+  channel_write_contiguous_bytes.Add(data_size);
   *msg = ktl::move(new_msg);
   return ZX_OK;
 }
@@ -148,6 +161,8 @@ zx_status_t MessagePacket::CreateIovecBounded(user_in_ptr<const zx_channel_iovec
     }
   }
 
+  channel_write_iovec.Add(1);
+  channel_write_iovec_bytes.Add(message_size);
   *msg = ktl::move(new_msg);
   return ZX_OK;
 }
@@ -193,6 +208,9 @@ zx_status_t MessagePacket::CreateIovecUnbounded(user_in_ptr<const zx_channel_iov
   new_msg->buffer_chain_->FreeUnusedBuffers();
   new_msg->set_data_size(static_cast<uint32_t>(message_size));
 
+  channel_write_iovec_unbounded.Add(1);
+  channel_write_iovec_unbounded_bytes.Add(message_size);
+
   *msg = ktl::move(new_msg);
   return ZX_OK;
 }
@@ -41,6 +41,8 @@ KCOUNTER(port_ephemeral_packet_freed, "port.ephemeral_packet.freed")
 KCOUNTER(port_full_count, "port.full.count")
 KCOUNTER(port_dequeue_count, "port.dequeue.count")
 KCOUNTER(port_dequeue_spurious_count, "port.dequeue.spurious.count")
+KCOUNTER(port_dequeue_many_count, "port.dequeue_many.count")
+KCOUNTER(port_dequeue_many_packets, "port.dequeue_many.packets")
 KCOUNTER(dispatcher_port_create_count, "dispatcher.port.create")
 KCOUNTER(dispatcher_port_destroy_count, "dispatcher.port.destroy")
 
@@ -379,6 +381,32 @@ zx_status_t PortDispatcher::Dequeue(const Deadline& deadline, zx_port_packet_t*
   return ZX_OK;
 }
 
+zx_status_t PortDispatcher::DequeueMany(const Deadline& deadline,
+                                        ktl::span<zx_port_packet_t> packets, size_t* actual) {
+  canary_.Assert();
+  DEBUG_ASSERT(actual);
+
+  if (packets.empty()) {
+    return ZX_ERR_INVALID_ARGS;
+  }
+
+  // Only the first dequeue may block. Subsequent ones use a deadline that has already passed so
+  // that they only consume packets that were already counted by |sema_|.
+  zx_status_t status = Dequeue(deadline, &packets[0]);
+  if (status != ZX_OK) {
+    return status;
+  }
+  size_t count = 1;
+  while (count < packets.size() && Dequeue(Deadline::infinite_past(), &packets[count]) == ZX_OK) {
+    ++count;
+  }
+
+  kcounter_add(port_dequeue_many_count, 1);
+  kcounter_add(port_dequeue_many_packets, static_cast<int64_t>(count));
+  *actual = count;
+  return ZX_OK;
+}
+
 void PortDispatcher::MaybeReap(PortObserver* observer, PortPacket* port_packet) {
   canary_.Assert();
 
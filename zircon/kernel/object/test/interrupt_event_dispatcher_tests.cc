@@ -19,6 +19,7 @@
 #include <object/interrupt_dispatcher.h>
 #include <object/interrupt_event_dispatcher.h>
 #include <object/port_dispatcher.h>
+#include <object/virtual_interrupt_dispatcher.h>
 
 #include <ktl/enforce.h>
 
@@ -164,10 +165,31 @@ bool TestPendingWakeEventBlocksSuspend() {
   END_TEST;
 }
 
+// Tests that a virtual interrupt records the affinity of its waiters, and that masks without any
+// online CPU are rejected.
+bool TestVirtualInterruptAffinity() {
+  BEGIN_TEST;
+
+  KernelHandle<InterruptDispatcher> interrupt;
+  zx_rights_t rights;
+  ASSERT_EQ(ZX_OK, VirtualInterruptDispatcher::Create(&interrupt, &rights, ZX_INTERRUPT_VIRTUAL));
+  EXPECT_EQ(0u, interrupt.dispatcher()->affinity());
+
+  EXPECT_EQ(ZX_ERR_INVALID_ARGS, interrupt.dispatcher()->SetAffinity(0));
+  EXPECT_EQ(0u, interrupt.dispatcher()->affinity());
+
+  const cpu_mask_t boot_cpu = cpu_num_to_mask(BOOT_CPU_ID);
+  EXPECT_EQ(ZX_OK, interrupt.dispatcher()->SetAffinity(boot_cpu));
+  EXPECT_EQ(boot_cpu, interrupt.dispatcher()->affinity());
+
+  END_TEST;
+}
+
 }  // namespace
 
 UNITTEST_START_TESTCASE(interrupt_event_dispatcher_tests)
 UNITTEST("ConcurrentIntEventDispatcherTeardown", TestConcurrentIntEventDispatcherTeardown)
 UNITTEST("PendingWakeEventBlocksSuspend", TestPendingWakeEventBlocksSuspend)
+UNITTEST("VirtualInterruptAffinity", TestVirtualInterruptAffinity)
 UNITTEST_END_TESTCASE(interrupt_event_dispatcher_tests, "interrupt_event_dispatcher_tests",
                       "InterruptEventDispatcher tests")
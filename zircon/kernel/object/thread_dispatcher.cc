@@ -617,6 +617,11 @@ TaskRuntimeStats ThreadDispatcher::GetCompensatedTaskRuntimeStats() const {
   return runtime_stats_.GetCompensatedTaskRuntimeStats();
 }
 
+zx_info_thread_queue_latency_t ThreadDispatcher::GetQueueLatency() const {
+  canary_.Assert();
+  return runtime_stats_.GetQueueLatency();
+}
+
 void ThreadDispatcher::UpdateRuntimeStats(thread_state new_state) {
   canary_.Assert();
   DEBUG_ASSERT(arch_ints_disabled());
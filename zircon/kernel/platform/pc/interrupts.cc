@@ -197,6 +197,12 @@ zx_status_t get_interrupt_config(unsigned int vector, enum interrupt_trigger_mod
   return kInterruptManager.GetInterruptConfig(vector, tm, pol);
 }
 
+// TODO: Program the IO APIC redirection entry's destination. Until then, interrupts stay on the
+// boot CPU.
+zx_status_t set_interrupt_affinity(unsigned int vector, cpu_mask_t mask) {
+  return ZX_ERR_NOT_SUPPORTED;
+}
+
 void platform_irq(iframe_t* frame) {
   CPU_STATS_INC(interrupts);
   // get the current vector
@@ -15,13 +15,21 @@
 #include <vm/pmm.h>
 #include <vm/tri_page_storage.h>
 
+KCOUNTER(compression_tier_primary_stored, "vm.compression.tier.primary.pages_stored")
+KCOUNTER(compression_tier_primary_bytes, "vm.compression.tier.primary.compressed_bytes")
+KCOUNTER(compression_tier_primary_decompress_ns, "vm.compression.tier.primary.decompression_ns")
+KCOUNTER(compression_tier_fallback_attempts, "vm.compression.tier.fallback.attempts")
+KCOUNTER(compression_tier_fallback_stored, "vm.compression.tier.fallback.pages_stored")
+KCOUNTER(compression_tier_fallback_bytes, "vm.compression.tier.fallback.compressed_bytes")
+KCOUNTER(compression_tier_fallback_decompress_ns, "vm.compression.tier.fallback.decompression_ns")
+
 namespace {
 
-// We always add zx_ticks_t to any data that we store, so ensure that the maximum size of the
+// We always add a trailer to any data that we store, so ensure that the maximum size of the
 // compressed data combined with that would not require us to store more than a page.
-constexpr size_t ensure_threshold(size_t threshold) {
-  if (threshold + sizeof(zx_ticks_t) > PAGE_SIZE) {
-    return PAGE_SIZE - sizeof(zx_ticks_t);
+constexpr size_t ensure_threshold(size_t threshold, size_t trailer_size) {
+  if (threshold + trailer_size > PAGE_SIZE) {
+    return PAGE_SIZE - trailer_size;
   }
   return threshold;
 }
@@ -48,15 +56,17 @@ VmCompression::CompressorGuard VmCompression::AcquireCompressor() {
 
 VmCompression::VmCompression(fbl::RefPtr<VmCompressedStorage> storage,
                              fbl::RefPtr<VmCompressionStrategy> strategy,
-                             size_t compression_threshold)
+                             size_t compression_threshold,
+                             fbl::RefPtr<VmCompressionStrategy> fallback_strategy)
     : storage_(ktl::move(storage)),
       strategy_(ktl::move(strategy)),
-      compression_threshold_(ensure_threshold(compression_threshold)),
+      fallback_strategy_(ktl::move(fallback_strategy)),
+      compression_threshold_(ensure_threshold(compression_threshold, sizeof(Trailer))),
       instance_(*this, kTempReferenceValue) {
   ASSERT(storage_);
   ASSERT(strategy_);
-  // Ensure we can steal space to store the compression timestamp.
-  ASSERT(compression_threshold_ + sizeof(zx_ticks_t) <= PAGE_SIZE);
+  // Ensure we can steal space to store the trailer.
+  ASSERT(compression_threshold_ + sizeof(Trailer) <= PAGE_SIZE);
 }
 
 VmCompression::~VmCompression() {
@@ -83,7 +93,16 @@ VmCompression::CompressResult VmCompression::Compress(const void* page_src, zx_t
   // Compress into the buffer page, measuring the time taken to do so.
   const zx_duration_t start_runtime = Thread::Current::Get()->Runtime();
   void* buffer_ptr = paddr_to_physmap(buffer_page_->paddr());
+  Tier tier = Tier::Primary;
   auto result = strategy_->Compress(page_src, buffer_ptr, compression_threshold_);
+  // If the primary strategy could not achieve the threshold give the fallback tier, if any, a
+  // chance. Zero pages are always detected by the primary tier, so there is no need to retry those.
+  if (fallback_strategy_ && ktl::holds_alternative<FailTag>(result)) {
+    compression_fallback_attempts_.fetch_add(1);
+    kcounter_add(compression_tier_fallback_attempts, 1);
+    tier = Tier::Fallback;
+    result = fallback_strategy_->Compress(page_src, buffer_ptr, compression_threshold_);
+  }
   const zx_duration_t end_runtime = Thread::Current::Get()->Runtime();
   if (likely(end_runtime > start_runtime)) {
     compression_time_.fetch_add(end_runtime - start_runtime);
@@ -105,11 +124,14 @@ VmCompression::CompressResult VmCompression::Compress(const void* page_src, zx_t
   const size_t compressed_size = *ktl::get_if<size_t>(&result);
   DEBUG_ASSERT(compressed_size > 0 && compressed_size <= compression_threshold_);
 
-  // Store the current ticks for tracking how long pages remain compressed. We had previously
-  // validated in the constructor that we would always have space on the page.
-  const size_t storage_size = compressed_size + sizeof(zx_ticks_t);
+  // Store the current ticks for tracking how long pages remain compressed, along with the tier
+  // needed to decompress. We had previously validated in the constructor that we would always have
+  // space on the page.
+  const size_t storage_size = compressed_size + sizeof(Trailer);
   DEBUG_ASSERT(storage_size <= PAGE_SIZE);
-  *reinterpret_cast<zx_ticks_t*>(reinterpret_cast<uintptr_t>(buffer_ptr) + compressed_size) = now;
+  const Trailer trailer{.compressed_ticks = now, .tier = tier};
+  memcpy(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(buffer_ptr) + compressed_size),
+         &trailer, sizeof(trailer));
 
   // Store the data, it takes ownership of the buffer_page_ and might return ownership of a page.
   // Metadata associated with the page will be stored later, when the caller reaccquires the VMO
@@ -121,6 +143,16 @@ VmCompression::CompressResult VmCompression::Compress(const void* page_src, zx_t
     // Make sure the storage system never produced the temp reference.
     ASSERT(!IsTempReference(*ref));
     compression_success_.fetch_add(1);
+    TierStats& tier_stats = stats_for_tier(tier);
+    tier_stats.pages_stored.fetch_add(1);
+    tier_stats.compressed_bytes.fetch_add(compressed_size);
+    if (tier == Tier::Fallback) {
+      kcounter_add(compression_tier_fallback_stored, 1);
+      kcounter_add(compression_tier_fallback_bytes, compressed_size);
+    } else {
+      kcounter_add(compression_tier_primary_stored, 1);
+      kcounter_add(compression_tier_primary_bytes, compressed_size);
+    }
     return *ref;
   }
   compression_fail_.fetch_add(1);
@@ -140,19 +172,30 @@ void VmCompression::Decompress(CompressedRef ref, void* page_dest, uint32_t* met
   auto [src, metadata, len] = storage_->CompressedData(ref);
   *metadata_dest = metadata;
 
-  // pull out the timestamp and determine how long this was compressed for.
-  DEBUG_ASSERT(len >= sizeof(zx_ticks_t));
-  const zx_ticks_t compressed_ticks =
-      *reinterpret_cast<zx_ticks_t*>(reinterpret_cast<uintptr_t>(src) + len - sizeof(zx_ticks_t));
-  const size_t bucket = bucket_for_ticks(compressed_ticks, now);
+  // pull out the trailer and determine how long this was compressed for.
+  DEBUG_ASSERT(len >= sizeof(Trailer));
+  const size_t data_len = len - sizeof(Trailer);
+  Trailer trailer;
+  memcpy(&trailer, reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(src) + data_len),
+         sizeof(trailer));
+  const size_t bucket = bucket_for_ticks(trailer.compressed_ticks, now);
   decompressions_within_log_seconds_[bucket].fetch_add(1);
 
-  // Decompress the data, excluding our timestamp, and measure how long decompression takes.
+  // Decompress the data, excluding our trailer, and measure how long decompression takes.
   const zx_duration_t start_runtime = Thread::Current::Get()->Runtime();
-  strategy_->Decompress(src, len - sizeof(zx_ticks_t), page_dest);
+  strategy_for_tier(trailer.tier).Decompress(src, data_len, page_dest);
   const zx_duration_t end_runtime = Thread::Current::Get()->Runtime();
+  TierStats& tier_stats = stats_for_tier(trailer.tier);
+  tier_stats.decompressions.fetch_add(1);
   if (end_runtime > start_runtime) {
-    decompression_time_.fetch_add(end_runtime - start_runtime);
+    const zx_duration_t elapsed = end_runtime - start_runtime;
+    decompression_time_.fetch_add(elapsed);
+    tier_stats.decompression_time.fetch_add(elapsed);
+    if (trailer.tier == Tier::Fallback) {
+      kcounter_add(compression_tier_fallback_decompress_ns, elapsed);
+    } else {
+      kcounter_add(compression_tier_primary_decompress_ns, elapsed);
+    }
   }
 
   // Now that decompression is finished, free the backing memory.
@@ -215,7 +258,24 @@ void VmCompression::Dump() const {
       decompressions_within_log_seconds_[2].load(), decompressions_within_log_seconds_[3].load(),
       decompressions_within_log_seconds_[4].load(), decompressions_within_log_seconds_[5].load(),
       decompressions_within_log_seconds_[6].load(), decompressions_within_log_seconds_[7].load());
+  printf("[zram]: Fallback tier attempts: %zu\n", compression_fallback_attempts_.load());
+  printf("[zram]: Decompress around events: %zu pages: %zu\n", decompress_around_events_.load(),
+         decompress_around_pages_.load());
+  for (size_t i = 0; i < kNumTiers; i++) {
+    const TierStats& tier_stats = tier_stats_[i];
+    const uint64_t stored = tier_stats.pages_stored.load();
+    const uint64_t bytes = tier_stats.compressed_bytes.load();
+    const uint64_t decompressions = tier_stats.decompressions.load();
+    const zx_duration_t time = tier_stats.decompression_time.load();
+    printf("[zram]: Tier %zu stored: %zu avg size: %zu decompressions: %zu avg time: %" PRIi64
+           " ns\n",
+           i, stored, stored > 0 ? bytes / stored : 0, decompressions,
+           decompressions > 0 ? time / static_cast<zx_duration_t>(decompressions) : 0);
+  }
   strategy_->Dump();
+  if (fallback_strategy_) {
+    fallback_strategy_->Dump();
+  }
   storage_->Dump();
 }
 
@@ -260,6 +320,7 @@ fbl::RefPtr<VmCompression> VmCompression::CreateDefault() {
       static_cast<uint32_t>(PAGE_SIZE) * gBootOptions->compression_threshold / 100u;
 
   fbl::RefPtr<VmCompressionStrategy> strategy;
+  fbl::RefPtr<VmCompressionStrategy> fallback_strategy;
   switch (gBootOptions->compression_strategy) {
     case CompressionStrategy::kLz4:
       strategy = VmLz4Compressor::Create();
@@ -268,6 +329,16 @@ fbl::RefPtr<VmCompression> VmCompression::CreateDefault() {
         return nullptr;
       }
       printf("[ZRAM]: Using compression strategy: lz4\n");
+      if (gBootOptions->compression_lz4_fallback_acceleration != 0) {
+        const int fallback_acceleration =
+            static_cast<int>(gBootOptions->compression_lz4_fallback_acceleration);
+        fallback_strategy = VmLz4Compressor::Create(fallback_acceleration);
+        if (!fallback_strategy) {
+          printf("[ZRAM]: Failed to create lz4 fallback compressor\n");
+          return nullptr;
+        }
+        printf("[ZRAM]: Using lz4 fallback tier with acceleration %d\n", fallback_acceleration);
+      }
       break;
     case CompressionStrategy::kNone:
       // Original check should have handled this.
@@ -277,7 +348,7 @@ fbl::RefPtr<VmCompression> VmCompression::CreateDefault() {
   ASSERT(strategy);
 
   fbl::RefPtr<VmCompression> compression = fbl::MakeRefCountedChecked<VmCompression>(
-      &ac, ktl::move(storage), ktl::move(strategy), threshold);
+      &ac, ktl::move(storage), ktl::move(strategy), threshold, ktl::move(fallback_strategy));
   if (!ac.check()) {
     printf("[ZRAM]: Failed to create compressor\n");
     return nullptr;
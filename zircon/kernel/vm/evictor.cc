@@ -8,12 +8,14 @@
 #include <lib/counters.h>
 #include <lib/fit/defer.h>
 #include <lib/zircon-internal/macros.h>
+#include <zircon/time.h>
 
 #include <cassert>
 #include <cstdint>
 
 #include <kernel/lockdep.h>
 #include <ktl/algorithm.h>
+#include <platform/timer.h>
 #include <vm/compression.h>
 #include <vm/discardable_vmo_tracker.h>
 #include <vm/evictor.h>
@@ -33,6 +35,7 @@ KCOUNTER(compression_evicted, "vm.reclamation.pages_evicted_compressed.total")
 KCOUNTER(compression_evicted_oom, "vm.reclamation.pages_evicted_compressed.oom")
 KCOUNTER(discardable_pages_evicted, "vm.reclamation.pages_evicted_discardable.total")
 KCOUNTER(discardable_pages_evicted_oom, "vm.reclamation.pages_evicted_discardable.oom")
+KCOUNTER(eviction_accessed_scan_requests, "vm.reclamation.accessed_scan_requests")
 
 inline void CheckedIncrement(uint64_t* a, uint64_t b) {
   uint64_t result;
@@ -284,6 +287,10 @@ Evictor::EvictedPageCounts Evictor::EvictUntilTargetsMet(uint64_t min_pages_to_e
     no_ongoing_eviction_.Signal();
   });
 
+  // Make sure that page ages reflect recent accesses before picking any victims, so that pages in
+  // the working set that were accessed since the last harvest are not evicted.
+  RefreshAccessedInformation();
+
   uint64_t total_non_loaned_pages_freed = 0;
 
   while (true) {
@@ -365,6 +372,22 @@ int Evictor::EvictionThreadLoop() {
   return 0;
 }
 
+void Evictor::RefreshAccessedInformation() const {
+  // Test reclaim functions do not use the page queues, so there is nothing to refresh.
+  if (unlikely(test_reclaim_function_)) {
+    return;
+  }
+  const uint32_t staleness_ms = gBootOptions->page_scanner_eviction_accessed_scan_staleness_ms;
+  if (staleness_ms == 0) {
+    return;
+  }
+  const zx_time_t update_time = zx_time_sub_duration(current_time(), ZX_MSEC(staleness_ms));
+  // Only update the ages and leave the accessed bits in place, so that the regular harvesting
+  // performed by the scanner is not perturbed.
+  scanner_wait_for_accessed_scan(update_time, false);
+  eviction_accessed_scan_requests.Add(1);
+}
+
 uint64_t Evictor::CountFreePages() const {
   if (unlikely(test_free_pages_function_)) {
     return test_free_pages_function_();
@@ -137,9 +137,15 @@ class VmCompression final : public fbl::RefCounted<VmCompression> {
   // Constructs a compression manager using the given storage and compression strategies. The
   // |compression_threshold| is the number of bytes above which a compression is considered to have
   // failed and should not be considered worth storing.
+  //
+  // An optional |fallback_strategy| may be provided as a second compression tier. Pages that the
+  // primary |strategy| cannot compress within |compression_threshold| are retried with the fallback
+  // strategy, which is expected to be slower but achieve a better ratio. The tier that produced any
+  // stored data is recorded alongside it so that the correct strategy is used to decompress.
   // TODO(https://fxbug.dev/42138396): Limit total amount of pages stored.
   VmCompression(fbl::RefPtr<VmCompressedStorage> storage,
-                fbl::RefPtr<VmCompressionStrategy> strategy, size_t compression_threshold);
+                fbl::RefPtr<VmCompressionStrategy> strategy, size_t compression_threshold,
+                fbl::RefPtr<VmCompressionStrategy> fallback_strategy = nullptr);
   ~VmCompression();
 
   // Construct a VmCompression instance using default options for the storage and compression
@@ -250,10 +256,26 @@ class VmCompression final : public fbl::RefCounted<VmCompression> {
   // The returned CompressorGuard must not outlive this object.
   CompressorGuard AcquireCompressor();
 
+  // Records that |pages| references were speculatively decompressed around a faulting access,
+  // in addition to the page that was actually faulted on.
+  void RecordDecompressAround(uint64_t pages) {
+    decompress_around_events_.fetch_add(1);
+    decompress_around_pages_.fetch_add(pages);
+  }
+
   // Perform an information dump of the internal state to the debuglog.
   void Dump() const;
 
   static constexpr size_t kNumLogBuckets = 8;
+
+  // Compression tiers. The primary tier is always present, the fallback tier only exists if a
+  // fallback strategy was provided at construction.
+  enum class Tier : uint8_t {
+    Primary = 0,
+    Fallback = 1,
+  };
+  static constexpr size_t kNumTiers = 2;
+
   struct Stats {
     VmCompressedStorage::MemoryUsage memory_usage;
     zx_duration_t compression_time = 0;
@@ -267,12 +289,41 @@ class VmCompression final : public fbl::RefCounted<VmCompression> {
   Stats GetStats() const;
 
  private:
+  // Every piece of stored data has this trailer appended to it. As the compressed data has
+  // arbitrary length the trailer has no alignment guarantees and must be accessed via memcpy.
+  struct Trailer {
+    // Timestamp at which the data was compressed.
+    zx_ticks_t compressed_ticks;
+    // The Tier whose strategy produced the data.
+    Tier tier;
+  } __PACKED;
+
+  // Returns the strategy for the given tier. Must only be called for tiers that exist.
+  VmCompressionStrategy& strategy_for_tier(Tier tier) {
+    if (tier == Tier::Fallback) {
+      DEBUG_ASSERT(fallback_strategy_);
+      return *fallback_strategy_;
+    }
+    return *strategy_;
+  }
+
+  // Statistics kept for each tier to be able to compare their effectiveness.
+  struct TierStats {
+    RelaxedAtomic<uint64_t> pages_stored = 0;
+    RelaxedAtomic<uint64_t> compressed_bytes = 0;
+    RelaxedAtomic<uint64_t> decompressions = 0;
+    RelaxedAtomic<zx_duration_t> decompression_time = 0;
+  };
+  TierStats& stats_for_tier(Tier tier) { return tier_stats_[static_cast<size_t>(tier)]; }
+
   // References to the backing storage and compression strategies.
   const fbl::RefPtr<VmCompressedStorage> storage_;
   const fbl::RefPtr<VmCompressionStrategy> strategy_;
+  // Optional second tier, may be null.
+  const fbl::RefPtr<VmCompressionStrategy> fallback_strategy_;
   // Pages must compress to less than or equal to this threshold for compression to be considered a
   // success. The largest amount we might need to store is larger than this, as this threshold does
-  // not include the 8 bytes we add on as a timestamp for when a page was compressed.
+  // not include the |Trailer| we add on to record when and how a page was compressed.
   const size_t compression_threshold_;
 
   // Currently only a single VmCompressor instance is supported, so only a single temporary
@@ -310,6 +361,10 @@ class VmCompression final : public fbl::RefCounted<VmCompression> {
   RelaxedAtomic<uint64_t> decompressions_ = 0;
   RelaxedAtomic<uint64_t> decompression_skipped_ = 0;
   RelaxedAtomic<uint64_t> decompressions_within_log_seconds_[kNumLogBuckets] = {};
+  RelaxedAtomic<uint64_t> compression_fallback_attempts_ = 0;
+  RelaxedAtomic<uint64_t> decompress_around_events_ = 0;
+  RelaxedAtomic<uint64_t> decompress_around_pages_ = 0;
+  TierStats tier_stats_[kNumTiers];
 };
 
 #endif  // ZIRCON_KERNEL_VM_INCLUDE_VM_COMPRESSION_H_
@@ -174,6 +174,11 @@ class Evictor {
   // The main loop for the eviction thread.
   int EvictionThreadLoop() TA_EXCL(lock_);
 
+  // Waits for an accessed scan that is no older than the eviction staleness boot option, so that
+  // pages accessed since the last harvest are aged back into the active set before eviction picks
+  // from the reclaim queues. This may acquire arbitrary vmo and aspace locks.
+  void RefreshAccessedInformation() const TA_EXCL(lock_);
+
   // Returns the count of the free pages for use in performing target calculations. This could be
   // from the PMM or a test fake.
   uint64_t CountFreePages() const;
@@ -14,8 +14,10 @@
 
 class VmLz4Compressor final : public VmCompressionStrategy {
  public:
-  // Returns nullptr on allocation or other failure.
+  // Returns nullptr on allocation or other failure. The variant without an explicit acceleration
+  // uses the value from the kernel.compression.lz4.acceleration boot option.
   static fbl::RefPtr<VmLz4Compressor> Create();
+  static fbl::RefPtr<VmLz4Compressor> Create(int acceleration);
   ~VmLz4Compressor() override = default;
   DISALLOW_COPY_ASSIGN_AND_MOVE(VmLz4Compressor);
 
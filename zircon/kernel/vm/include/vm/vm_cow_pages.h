@@ -607,6 +607,10 @@ class VmCowPages final : public VmHierarchyBase,
   // Initializes the PageCache instance for COW page allocations.
   static void InitializePageCache(uint32_t level);
 
+  // Returns any pages held in the per-CPU COW page caches to the PMM. Returns the number of pages
+  // that were freed.
+  static size_t DrainPageCache();
+
   // Unlocked wrapper around ReplacePageLocked, exposed for the physical page provider to cancel
   // loans with.
   zx_status_t ReplacePage(vm_page_t* before_page, uint64_t offset, bool with_loaned,
@@ -917,10 +921,22 @@ class VmCowPages final : public VmHierarchyBase,
   zx_status_t ReplaceReferenceWithPageLocked(VmPageOrMarkerRef page_or_mark, uint64_t offset,
                                              AnonymousPageRequest* page_request) TA_REQ(lock());
 
+  // Opportunistically replaces up to |max_pages| References that contiguously follow the slot at
+  // |cursor|, which is at |offset| in this page_list_, with real pages. This is intended to be used
+  // after a fault has decompressed the slot at |cursor| so that sequential access to compressed
+  // content does not need to take a fault per page. Allocations are performed without waiting and
+  // the walk stops at the first slot that is not a Reference or on any allocation failure. Returns
+  // the number of References that were replaced.
+  uint64_t DecompressReferencesAroundLocked(VMPLCursor cursor, uint64_t offset, uint64_t max_pages)
+      TA_REQ(lock());
+
   zx_status_t AllocateCopyPage(paddr_t parent_paddr, list_node_t* alloc_list,
                                AnonymousPageRequest* request, vm_page_t** clone);
 
   static zx_status_t CacheAllocPage(uint alloc_flags, vm_page_t** p, paddr_t* pa);
+  // Allocates |count| pages, appending them to |list|, with the same semantics as pmm_alloc_pages.
+  // Batches that are small relative to the page cache reserve are serviced from the page cache.
+  static zx_status_t CacheAllocPages(size_t count, uint alloc_flags, list_node_t* list);
   static void CacheFree(list_node_t* list);
   static void CacheFree(vm_page_t* p);
 
@@ -77,8 +77,10 @@ bool VmLz4Compressor::Init() {
 }
 
 fbl::RefPtr<VmLz4Compressor> VmLz4Compressor::Create() {
-  const int acceleration = static_cast<int>(gBootOptions->compression_lz4_acceleration);
+  return Create(static_cast<int>(gBootOptions->compression_lz4_acceleration));
+}
 
+fbl::RefPtr<VmLz4Compressor> VmLz4Compressor::Create(int acceleration) {
   fbl::AllocChecker ac;
   fbl::RefPtr<VmLz4Compressor> lz4 =
       fbl::AdoptRef<VmLz4Compressor>(new (&ac) VmLz4Compressor(acceleration));
@@ -8,6 +8,7 @@
 #include <lib/console.h>
 
 #include <object/memory_watchdog.h>
+#include <vm/compression.h>
 #include <vm/pmm.h>
 #include <vm/scanner.h>
 
@@ -98,6 +99,8 @@ static int cmd_usage(const char* cmd_name) {
       "kernel reclamation that prevent going into OOM. If you want to test system response "
       "to memory pressure, unaltered from the default behavior, use avail_state instead.\n",
       cmd_name);
+  printf("%s compression                              : dump page compression stats\n",
+         cmd_name);
   printf("%s oom dip                                  : allocate until no mem, then free\n",
          cmd_name);
   printf(
@@ -124,6 +127,13 @@ static int cmd_mem(int argc, const cmd_args* argv, uint32_t flags) {
 
   if (!strcmp(argv[1].str, "dump")) {
     GetMemoryWatchdog().Dump();
+  } else if (!strcmp(argv[1].str, "compression")) {
+    VmCompression* compression = pmm_page_compression();
+    if (!compression) {
+      printf("page compression is not enabled\n");
+      return ZX_ERR_NOT_SUPPORTED;
+    }
+    compression->Dump();
   } else if (!strcmp(argv[1].str, "oom")) {
     if (argc > 3) {
       return cmd_usage(name);
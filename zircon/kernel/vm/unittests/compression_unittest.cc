@@ -636,6 +636,57 @@ bool compression_move_reference_test() {
   END_TEST;
 }
 
+// Compression strategy that never succeeds, used to force use of the fallback tier.
+class FailingCompressionStrategy final : public VmCompressionStrategy {
+ public:
+  CompressResult Compress(const void* src, void* dst, size_t dst_limit) override {
+    return FailTag{};
+  }
+  void Decompress(const void* src, size_t src_len, void* dst) override {
+    panic("FailingCompressionStrategy never produces data to decompress");
+  }
+  void Dump() const override {}
+};
+
+// Test that pages the primary tier fails to compress are handled by the fallback tier, and that
+// they are decompressed using the fallback tier strategy.
+bool compression_fallback_tier_test() {
+  BEGIN_TEST;
+
+  constexpr uint32_t kCompressionThreshhold = static_cast<uint32_t>(PAGE_SIZE) * 70u / 100u;
+  fbl::AllocChecker ac;
+  fbl::RefPtr<FailingCompressionStrategy> failing =
+      fbl::MakeRefCountedChecked<FailingCompressionStrategy>(&ac);
+  ASSERT_TRUE(ac.check());
+  fbl::RefPtr<VmLz4Compressor> lz4 = VmLz4Compressor::Create(1);
+  ASSERT_TRUE(lz4);
+  fbl::RefPtr<VmTriPageStorage> storage = fbl::MakeRefCountedChecked<VmTriPageStorage>(&ac);
+  ASSERT_TRUE(ac.check());
+  fbl::RefPtr<VmCompression> compression = fbl::MakeRefCountedChecked<VmCompression>(
+      &ac, ktl::move(storage), ktl::move(failing), kCompressionThreshhold, ktl::move(lz4));
+  ASSERT_TRUE(ac.check());
+
+  vm_page_t* page;
+  zx_status_t status = pmm_alloc_page(0, &page);
+  ASSERT_EQ(ZX_OK, status);
+  auto free_page = fit::defer([page] { pmm_free_page(page); });
+  write_pattern(page, PAGE_SIZE, 0);
+
+  // The primary tier always fails, so a successful result must have come from the fallback.
+  auto result = compression->Compress(paddr_to_physmap(page->paddr()));
+  ASSERT_TRUE(ktl::holds_alternative<VmCompression::CompressedRef>(result));
+  auto ref = ktl::get<VmCompression::CompressedRef>(result);
+
+  // Clobber the page and decompress back into it. The failing strategy panics if asked to
+  // decompress, so this also validates that the tier was recorded correctly.
+  write_zeros(page, PAGE_SIZE);
+  uint32_t metadata;
+  compression->Decompress(ref, paddr_to_physmap(page->paddr()), &metadata);
+  EXPECT_TRUE(validate_pattern(paddr_to_physmap(page->paddr()), PAGE_SIZE, 0));
+
+  END_TEST;
+}
+
 }  // namespace
 
 UNITTEST_START_TESTCASE(compression_tests)
@@ -652,6 +703,7 @@ VM_UNITTEST(compression_smoke_test)
 VM_UNITTEST(compression_zero_test)
 VM_UNITTEST(compression_fail_test)
 VM_UNITTEST(compression_move_reference_test)
+VM_UNITTEST(compression_fallback_tier_test)
 UNITTEST_END_TESTCASE(compression_tests, "compression", "Compression tests")
 
 }  // namespace vm_unittest
@@ -148,10 +148,23 @@ void ZeroPage(vm_page_t* p) {
 }
 
 bool IsZeroPage(vm_page_t* p) {
-  uint64_t* base = (uint64_t*)paddr_to_physmap(p->paddr());
-  for (int i = 0; i < PAGE_SIZE / (int)sizeof(uint64_t); i++) {
-    if (base[i] != 0)
+  const uint64_t* base = (const uint64_t*)paddr_to_physmap(p->paddr());
+  // Most candidate pages are not zero and usually have data near the start of the page, so check the
+  // first word before anything else. After that, test a cache line at a time by OR-ing its words
+  // together, which avoids a branch per word and lets the compiler unroll the inner loop.
+  if (base[0] != 0) {
+    return false;
+  }
+  constexpr size_t kWordsPerChunk = 64 / sizeof(uint64_t);
+  static_assert(PAGE_SIZE % (kWordsPerChunk * sizeof(uint64_t)) == 0);
+  for (size_t i = 0; i < PAGE_SIZE / sizeof(uint64_t); i += kWordsPerChunk) {
+    uint64_t bits = 0;
+    for (size_t j = 0; j < kWordsPerChunk; j++) {
+      bits |= base[i + j];
+    }
+    if (bits != 0) {
       return false;
+    }
   }
   return true;
 }
@@ -419,6 +432,27 @@ zx_status_t VmCowPages::CacheAllocPage(uint alloc_flags, vm_page_t** p, paddr_t*
   return ZX_OK;
 }
 
+zx_status_t VmCowPages::CacheAllocPages(size_t count, uint alloc_flags, list_node_t* list) {
+  // Large batches would just drain the cache and immediately refill it, so send them directly to
+  // the PMM where they can be serviced with a single lock acquisition.
+  if (!page_cache_ || count > page_cache_.reserve_pages()) {
+    return pmm_alloc_pages(count, alloc_flags, list);
+  }
+
+  zx::result result = page_cache_.Allocate(count, alloc_flags);
+  if (result.is_error()) {
+    return result.error_value();
+  }
+
+  DEBUG_ASSERT(list_length(&result->page_list) == count);
+  if (list_is_empty(list)) {
+    list_move(&result->page_list, list);
+  } else {
+    list_splice_after(&result->page_list, list_peek_tail(list));
+  }
+  return ZX_OK;
+}
+
 void VmCowPages::CacheFree(list_node_t* list) {
   if (!page_cache_) {
     pmm_free(list);
@@ -477,6 +511,49 @@ zx_status_t VmCowPages::ReplaceReferenceWithPageLocked(VmPageOrMarkerRef page_or
   return ZX_OK;
 }
 
+uint64_t VmCowPages::DecompressReferencesAroundLocked(VMPLCursor cursor, uint64_t offset,
+                                                      uint64_t max_pages) {
+  VmCompression* compression = pmm_page_compression();
+  DEBUG_ASSERT(compression);
+
+  // Speculative decompressions must never block or generate page requests, so strip any ability to
+  // wait from the allocation flags.
+  const uint32_t alloc_flags = pmm_alloc_flags_ & ~PMM_ALLOC_FLAG_CAN_WAIT;
+  uint64_t decompressed = 0;
+  // The cursor is still pointing at the slot that the caller already handled, so step first.
+  cursor.step();
+  cursor.ForEveryContiguous([&](VmPageOrMarkerRef slot) {
+    AssertHeld(lock_ref());
+    if (decompressed == max_pages || !slot->IsReference()) {
+      return ZX_ERR_STOP;
+    }
+    // A temporary reference is owned by an in progress compression and cannot be decompressed
+    // without going through MoveReference. Skip this case, it is rare enough not to matter.
+    if (compression->IsTempReference(slot->Reference())) {
+      return ZX_ERR_STOP;
+    }
+    vm_page_t* p;
+    paddr_t pa;
+    if (CacheAllocPage(alloc_flags, &p, &pa) != ZX_OK) {
+      return ZX_ERR_STOP;
+    }
+    InitializeVmPage(p);
+    const auto ref = slot.SwapReferenceForPage(p);
+    uint32_t page_metadata;
+    compression->Decompress(ref, paddr_to_physmap(pa), &page_metadata);
+    p->object.share_count = page_metadata;
+    decompressed++;
+    SetNotPinnedLocked(p, offset + decompressed * PAGE_SIZE);
+    return ZX_ERR_NEXT;
+  });
+
+  if (decompressed > 0) {
+    IncrementHierarchyGenerationCountLocked();
+    compression->RecordDecompressAround(decompressed);
+  }
+  return decompressed;
+}
+
 VmCowPages::VmCowPages(const fbl::RefPtr<VmHierarchyState> hierarchy_state_ptr,
                        VmCowPagesOptions options, uint32_t pmm_alloc_flags, uint64_t size,
                        fbl::RefPtr<PageSource> page_source,
@@ -3153,7 +3230,25 @@ VmCowPages::LookupCursor::TargetAllocateCopyPageAsResult(vm_page_t* source, Dirt
 zx_status_t VmCowPages::LookupCursor::CursorReferenceToPage(AnonymousPageRequest* page_request) {
   DEBUG_ASSERT(CursorIsReference());
 
-  return owner()->ReplaceReferenceWithPageLocked(owner_cursor_, owner_offset_, page_request);
+  zx_status_t status =
+      owner()->ReplaceReferenceWithPageLocked(owner_cursor_, owner_offset_, page_request);
+  if (status != ZX_OK) {
+    return status;
+  }
+
+  // Accesses to compressed content are frequently sequential, so decompress any immediately
+  // following references that are within the cursor range in the same batch. This only modifies
+  // the representation of content in the owner and so is valid regardless of whether the owner is
+  // the target or not.
+  const uint64_t decompress_around = gBootOptions->compression_decompress_around;
+  if (decompress_around > 0) {
+    const uint64_t remaining = (visible_end_ - offset_) / PAGE_SIZE - 1;
+    const uint64_t max_pages = ktl::min(decompress_around, remaining);
+    if (max_pages > 0) {
+      owner()->DecompressReferencesAroundLocked(owner_pl_cursor_, owner_offset_, max_pages);
+    }
+  }
+  return ZX_OK;
 }
 
 zx_status_t VmCowPages::LookupCursor::ReadRequest(uint max_request_pages,
@@ -3584,7 +3679,7 @@ zx_status_t VmCowPages::CommitRangeLocked(uint64_t offset, uint64_t len, uint64_
       return ZX_OK;
     }
 
-    zx_status_t status = pmm_alloc_pages(count, pmm_alloc_flags_, &page_list);
+    zx_status_t status = CacheAllocPages(count, pmm_alloc_flags_, &page_list);
     // Ignore ZX_ERR_SHOULD_WAIT since the loop below will fall back to a page by page allocation,
     // allowing us to wait for single pages should we need to.
     if (status != ZX_OK && status != ZX_ERR_SHOULD_WAIT) {
@@ -6045,7 +6140,7 @@ zx_status_t VmCowPages::DirtyPagesLocked(uint64_t offset, uint64_t len, list_nod
     // calls to the PMM to allocate single pages. If the PMM returns ZX_ERR_SHOULD_WAIT, fall back
     // to allocating one page at a time below, giving reclamation strategies a better chance to
     // catch up with incoming allocation requests.
-    status = pmm_alloc_pages(zero_pages_count, pmm_alloc_flags_, alloc_list);
+    status = CacheAllocPages(zero_pages_count, pmm_alloc_flags_, alloc_list);
     if (status == ZX_OK) {
       // All requested pages allocated.
       zero_pages_count = 0;
@@ -7849,7 +7944,11 @@ void VmCowPages::CopyPageForReplacementLocked(vm_page_t* dst_page, vm_page_t* sr
 void VmCowPages::InitializePageCache(uint32_t level) {
   ASSERT(level < LK_INIT_LEVEL_THREADING);
 
-  const size_t reserve_pages = 64;
+  const size_t reserve_pages = gBootOptions->vmo_reserve_pages;
+  if (reserve_pages == 0) {
+    // Leave the page cache uninitialized, causing all allocations to go directly to the PMM.
+    return;
+  }
   zx::result<page_cache::PageCache> result = page_cache::PageCache::Create(reserve_pages);
 
   ASSERT(result.is_ok());
@@ -7860,5 +7959,12 @@ void VmCowPages::InitializePageCache(uint32_t level) {
   }
 }
 
+size_t VmCowPages::DrainPageCache() {
+  if (!page_cache_) {
+    return 0;
+  }
+  return page_cache_.Drain();
+}
+
 // Initialize the cache after the percpu data structures are initialized.
 LK_INIT_HOOK(vm_cow_pages_cache_init, VmCowPages::InitializePageCache, LK_INIT_LEVEL_KERNEL + 1)
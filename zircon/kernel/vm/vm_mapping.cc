@@ -40,6 +40,7 @@ KCOUNTER(vm_mapping_attribution_cache_hits, "vm.attributed_memory.mapping.cache_
 KCOUNTER(vm_mapping_attribution_cache_misses, "vm.attributed_memory.mapping.cache_misses")
 KCOUNTER(vm_mappings_merged, "vm.aspace.mapping.merged_neighbors")
 KCOUNTER(vm_mappings_protect_no_write, "vm.aspace.mapping.protect_without_write")
+KCOUNTER(vm_mappings_contiguous_runs, "vm.aspace.mapping.contiguous_runs")
 
 }  // namespace
 
@@ -622,6 +623,11 @@ namespace {
 // Helper class for batching installing mappings into the arch aspace. The mappings aspace and
 // object lock must be held over the entirety of the lifetime of this object, without ever being
 // released.
+//
+// Up to NumPages arbitrary pages can be batched. Additionally, as long as every page appended is
+// physically contiguous with the previous one, the run can grow beyond NumPages without needing to
+// be flushed. Contiguous runs for new mappings are installed with MapContiguous, allowing the arch
+// layer to use large page mappings where the alignment and size permit.
 template <size_t NumPages>
 class VmMappingCoalescer {
  public:
@@ -633,21 +639,20 @@ class VmMappingCoalescer {
   // Add a page to the mapping run.
   zx_status_t Append(vaddr_t vaddr, paddr_t paddr) {
     // If this isn't the expected vaddr, flush the run we have first.
-    if (!can_append(vaddr)) {
+    if (!can_append(vaddr, paddr)) {
       zx_status_t status = Flush();
       if (status != ZX_OK) {
         return status;
       }
       base_ = vaddr;
     }
-    phys_[count_] = paddr;
-    ++count_;
+    AppendUnchecked(paddr);
     return ZX_OK;
   }
 
   zx_status_t AppendOrAdjustMapping(vaddr_t vaddr, paddr_t paddr, uint mmu_flags) {
     // If this isn't the expected vaddr or mmu_flags have changed, flush the run we have first.
-    if (!can_append(vaddr) || mmu_flags != mmu_flags_) {
+    if (!can_append(vaddr, paddr) || mmu_flags != mmu_flags_) {
       zx_status_t status = Flush();
       if (status != ZX_OK) {
         return status;
@@ -655,36 +660,75 @@ class VmMappingCoalescer {
       base_ = vaddr;
       mmu_flags_ = mmu_flags;
     }
-
-    phys_[count_] = paddr;
-    ++count_;
+    AppendUnchecked(paddr);
     return ZX_OK;
   }
 
   // How much space remains in the phys_ array, starting from vaddr, that can be used to
   // opportunistically map additional pages.
   size_t ExtraPageCapacityFrom(vaddr_t vaddr) {
-    // vaddr must be appendable & the coalescer can't be empty.
-    return (can_append(vaddr) && count_ != 0) ? NumPages - count_ : 0;
+    // vaddr must be the next slot, the coalescer can't be empty and there must be room in phys_.
+    return (vaddr == next_vaddr() && count_ != 0 && count_ < NumPages) ? NumPages - count_ : 0;
   }
 
   // Functions for the user to manually manage the pages array. It is up to the user to manage the
   // page count and ensure the coalescer doesn't overflow, maintains the correct page count and that
   // the pages are contiguous.
-  paddr_t* GetNextPageSlot() { return &phys_[count_]; }
+  paddr_t* GetNextPageSlot() {
+    DEBUG_ASSERT(count_ < NumPages);
+    return &phys_[count_];
+  }
 
-  void IncrementCount(size_t i) { count_ += i; }
+  void IncrementCount(size_t i) {
+    DEBUG_ASSERT(count_ + i <= NumPages);
+    for (size_t j = 0; j < i; j++) {
+      UpdateContiguous(phys_[count_], count_);
+      count_++;
+    }
+  }
 
   // Submit any outstanding mappings to the MMU.
   zx_status_t Flush();
 
   // Drop the current outstanding mappings without sending them to the MMU.
-  void Drop() { count_ = 0; }
+  void Drop() {
+    count_ = 0;
+    contiguous_ = true;
+  }
 
  private:
-  // Vaddr can be appended if it's the next free slot and the coalescer isn't full.
-  bool can_append(vaddr_t vaddr) {
-    return count_ < ktl::size(phys_) && vaddr == base_ + count_ * PAGE_SIZE;
+  vaddr_t next_vaddr() const { return base_ + count_ * PAGE_SIZE; }
+
+  // Vaddr can be appended if it's the next free slot and either the coalescer isn't full, or
+  // |paddr| extends a physically contiguous run that will be installed with MapContiguous.
+  bool can_append(vaddr_t vaddr, paddr_t paddr) const {
+    if (vaddr != next_vaddr()) {
+      return false;
+    }
+    if (count_ < NumPages) {
+      return true;
+    }
+    return existing_entry_action_ == ArchVmAspace::ExistingEntryAction::Error && contiguous_ &&
+           paddr == phys_[0] + count_ * PAGE_SIZE;
+  }
+
+  void AppendUnchecked(paddr_t paddr) {
+    UpdateContiguous(paddr, count_);
+    // Once past the end of phys_ the run is contiguous, and so is fully described by phys_[0].
+    if (count_ < NumPages) {
+      phys_[count_] = paddr;
+    }
+    ++count_;
+  }
+
+  // Updates contiguous_ for |paddr| being placed at |index| in the run.
+  void UpdateContiguous(paddr_t paddr, size_t index) {
+    if (index == 0) {
+      contiguous_ = true;
+    } else if (paddr != phys_[0] + index * PAGE_SIZE) {
+      DEBUG_ASSERT(index < NumPages);
+      contiguous_ = false;
+    }
   }
 
   DISALLOW_COPY_ASSIGN_AND_MOVE(VmMappingCoalescer);
@@ -693,6 +737,8 @@ class VmMappingCoalescer {
   vaddr_t base_;
   paddr_t phys_[NumPages];
   size_t count_;
+  // Whether all count_ pages form a single physically contiguous run starting at phys_[0].
+  bool contiguous_ = true;
   uint mmu_flags_;
   const ArchVmAspace::ExistingEntryAction existing_entry_action_;
 };
@@ -724,20 +770,33 @@ zx_status_t VmMappingCoalescer<NumPages>::Flush() {
 
   // Assert that we're not accidentally mapping the zero page writable. Unless called from a kernel
   // aspace, as the zero page can be mapped writeable from the kernel aspace in mexec.
-  DEBUG_ASSERT(
-      !(mmu_flags_ & ARCH_MMU_FLAG_PERM_WRITE) ||
-      ktl::all_of(phys_, &phys_[count_], [](paddr_t p) { return p != vm_get_zero_page_paddr(); }) ||
-      !mapping_->aspace()->is_user());
+  DEBUG_ASSERT(!(mmu_flags_ & ARCH_MMU_FLAG_PERM_WRITE) ||
+               ktl::all_of(phys_, &phys_[ktl::min(count_, NumPages)],
+                           [](paddr_t p) { return p != vm_get_zero_page_paddr(); }) ||
+               !mapping_->aspace()->is_user());
 
   size_t mapped;
-  zx_status_t ret = mapping_->aspace()->arch_aspace().Map(base_, phys_, count_, mmu_flags_,
-                                                          existing_entry_action_, &mapped);
+  zx_status_t ret;
+  // MapContiguous has the semantics of ExistingEntryAction::Error, so it can only be used when
+  // that was requested. It is only worth using over Map if the run could be larger than a single
+  // page table entry.
+  if (contiguous_ && count_ > 1 &&
+      existing_entry_action_ == ArchVmAspace::ExistingEntryAction::Error) {
+    vm_mappings_contiguous_runs.Add(1);
+    ret = mapping_->aspace()->arch_aspace().MapContiguous(base_, phys_[0], count_, mmu_flags_,
+                                                          &mapped);
+  } else {
+    DEBUG_ASSERT(count_ <= NumPages);
+    ret = mapping_->aspace()->arch_aspace().Map(base_, phys_, count_, mmu_flags_,
+                                                existing_entry_action_, &mapped);
+  }
   if (ret != ZX_OK) {
     TRACEF("error %d mapping %zu pages starting at va %#" PRIxPTR "\n", ret, count_, base_);
   }
   DEBUG_ASSERT_MSG(ret != ZX_OK || mapped == count_, "mapped %zu, count %zu\n", mapped, count_);
   base_ += count_ * PAGE_SIZE;
   count_ = 0;
+  contiguous_ = true;
   return ret;
 }
 
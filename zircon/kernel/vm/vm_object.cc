@@ -164,6 +164,15 @@ zx_status_t VmObject::ReadUserVector(user_out_iovec_t vec, uint64_t offset, size
     return ZX_ERR_OUT_OF_RANGE;
   }
 
+  // Each buffer is read with a separate ReadUser call, and each of those can only wait on page
+  // requests for its own part of the range. For a pager backed VMO and a vector of several buffers
+  // that would turn into one pager round trip per buffer, so first fetch the whole range in a
+  // single batch. This is only an optimization, so any errors are left for the reads below to
+  // report.
+  if (vec.count() > 1 && is_user_pager_backed()) {
+    [[maybe_unused]] zx_status_t prefetch_status = PrefetchRange(offset, len);
+  }
+
   zx_status_t status = vec.ForEach([&](user_out_ptr<char> ptr, size_t capacity) {
     if (capacity > len) {
       capacity = len;
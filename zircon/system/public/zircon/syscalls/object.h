@@ -62,6 +62,7 @@ typedef uint32_t zx_object_info_topic_t;
 #define ZX_INFO_IOB_REGIONS                 ((zx_object_info_topic_t) 35u) // zx_iob_region_info_t[n]
 #define ZX_INFO_VMAR_MAPS                   ((zx_object_info_topic_t) 36u) // zx_info_maps_t[n]
 #define ZX_INFO_POWER_DOMAINS               ((zx_object_info_topic_t) 37u) // zx_info_power_domain_info_t[n] - next syscall.
+#define ZX_INFO_THREAD_QUEUE_LATENCY        ((zx_object_info_topic_t) 38u) // zx_info_thread_queue_latency_t[1]
 
 // Return codes set when a task is killed.
 #define ZX_TASK_RETCODE_SYSCALL_KILL            ((int64_t) -1024)   // via zx_task_kill().
@@ -678,6 +679,17 @@ typedef struct zx_info_task_runtime_v1 {
     zx_duration_t queue_time;
 } zx_info_task_runtime_v1_t;
 
+#define ZX_INFO_THREAD_QUEUE_LATENCY_BUCKETS 32u
+
+// Distribution of the time a thread spent ready to run before it was scheduled.
+typedef struct zx_info_thread_queue_latency {
+    // The number of times the thread went from ready to running with a queue time, in ticks, that
+    // fell in each bucket. Bucket 0 counts queue times of 0 ticks, and bucket i (for i > 0) counts
+    // queue times in [2^(i-1), 2^i) ticks. The last bucket also counts all longer queue times.
+    // Use zx_ticks_per_second() to convert bucket bounds to durations.
+    uint64_t buckets[ZX_INFO_THREAD_QUEUE_LATENCY_BUCKETS];
+} zx_info_thread_queue_latency_t;
+
 
 // kernel statistics per cpu
 // TODO(cpu), expose the deprecated stats via a new syscall.
@@ -108,6 +108,32 @@ class HashTableChecker;
 // ht.Init(std::move(storage), cnt);
 // ```
 //
+// * Incremental resizing *
+//
+// HashTables with dynamically defined bucket storage may also be moved to a
+// new, differently sized, set of buckets after initialization using Resize.
+// Rather than rehashing every element at once, which takes time proportional to
+// the number of elements in the table, Resize hands the new storage to the
+// HashTable and then migrates the contents of a small, fixed number of the old
+// buckets to the new ones during each subsequent insert operation.  Lookups and
+// erases simply look in whichever of the two bucket arrays an element's bucket
+// currently lives in, so the cost of a resize is spread over the operations
+// which follow it instead of stalling one of them.  Users who would rather pay
+// the cost up front may call FinishResize to complete the migration
+// immediately.  For example...
+//
+// ```
+// if (ht.size() > ht.bucket_count() * kMaxLoadFactor) {
+//   const size_t cnt = ht.bucket_count() * 2;
+//   ht.Resize(std::unique_ptr<BucketType[]>(new BucketType[cnt]), cnt);
+// }
+// ht.insert(std::move(obj));
+// ```
+//
+// The old bucket storage is freed by the operation which finishes migrating it.
+// While a resize is in progress, insert operations may move elements from one
+// bucket to another, so they invalidate any outstanding iterators.
+//
 // * Hash function requirements and performance implications *
 //
 // There are two ways users may use to specify the bucket that their object
@@ -156,8 +182,12 @@ class BucketStorage {
   const BucketType* begin() const { return &buckets_[0]; }
   const BucketType* end() const { return &buckets_[NumBuckets]; }
 
-  // Static bucket storage is always valid.
+  // Static bucket storage is always valid, and may never be resized.
   constexpr void AssertValid() const {}
+  constexpr bool is_resizing() const { return false; }
+  constexpr HashType total_size() const { return size(); }
+  BucketType& at(size_t ndx) { return buckets_[ndx]; }
+  const BucketType& at(size_t ndx) const { return buckets_[ndx]; }
 
  private:
   static_assert(NumBuckets > 0, "Hash tables must have at least one bucket");
@@ -200,9 +230,58 @@ class BucketStorage<HashType, BucketType, kDynamicBucketCount> {
 
   void AssertValid() const { ZX_DEBUG_ASSERT(buckets_.get() != nullptr); }
 
+  // Support for incremental resizing.  While a resize is in progress, the old
+  // buckets follow the new ones in the index space used by at(), occupying
+  // [size(), total_size()).  Old buckets are migrated in order, so the ones
+  // below migrated_count() are empty.
+  bool is_resizing() const { return old_bucket_count_ != 0; }
+  HashType total_size() const { return static_cast<HashType>(bucket_count_ + old_bucket_count_); }
+  HashType old_size() const { return old_bucket_count_; }
+  HashType migrated_count() const { return migrated_count_; }
+
+  BucketType& at(size_t ndx) {
+    return (ndx < bucket_count_) ? buckets_[ndx] : old_buckets_[ndx - bucket_count_];
+  }
+  const BucketType& at(size_t ndx) const {
+    return (ndx < bucket_count_) ? buckets_[ndx] : old_buckets_[ndx - bucket_count_];
+  }
+
+  void BeginResize(std::unique_ptr<BucketType[]> buckets, size_t bucket_count) {
+    ZX_DEBUG_ASSERT(!is_resizing());
+    ZX_DEBUG_ASSERT(buckets.get() != nullptr);
+    ZX_DEBUG_ASSERT(bucket_count > 0);
+    ZX_DEBUG_ASSERT(bucket_count <= std::numeric_limits<HashType>::max() - bucket_count_);
+
+    old_buckets_ = std::move(buckets_);
+    old_bucket_count_ = bucket_count_;
+    migrated_count_ = 0;
+    buckets_ = std::move(buckets);
+    bucket_count_ = static_cast<HashType>(bucket_count);
+  }
+
+  // The next old bucket whose contents need to be moved to the new buckets.
+  BucketType& next_to_migrate() {
+    ZX_DEBUG_ASSERT(is_resizing());
+    return old_buckets_[migrated_count_];
+  }
+
+  // Record that next_to_migrate() has been emptied, releasing the old storage
+  // once every old bucket has been.
+  void MigratedOne() {
+    ZX_DEBUG_ASSERT(next_to_migrate().is_empty());
+    if (++migrated_count_ == old_bucket_count_) {
+      old_buckets_.reset();
+      old_bucket_count_ = 0;
+      migrated_count_ = 0;
+    }
+  }
+
  private:
   std::unique_ptr<BucketType[]> buckets_;
   HashType bucket_count_;
+  std::unique_ptr<BucketType[]> old_buckets_;
+  HashType old_bucket_count_ = 0;
+  HashType migrated_count_ = 0;
 };
 
 }  // namespace internal
@@ -325,6 +404,34 @@ class __POINTER(_KeyType) HashTable {
     buckets_.Init(std::move(buckets_storage), bucket_count);
   }
 
+  // Resize
+  //
+  // Begin moving the contents of the HashTable into |buckets_storage|.  The
+  // buckets currently in use are migrated incrementally during subsequent
+  // insert operations (see "Incremental resizing" above).  If a previous resize
+  // has not yet finished, it is completed first.
+  void Resize(std::unique_ptr<BucketType[]> buckets_storage, size_t bucket_count) {
+    static_assert(NumBuckets == kDynamicBucketCount,
+                  "HashTable::Resize cannot be used with template defined bucket count!");
+    buckets_.AssertValid();
+    FinishResize();
+    buckets_.BeginResize(std::move(buckets_storage), bucket_count);
+  }
+
+  // FinishResize
+  //
+  // Migrate everything which remains in the old buckets of an in-progress
+  // resize, if any, releasing the old bucket storage.
+  void FinishResize() {
+    static_assert(NumBuckets == kDynamicBucketCount,
+                  "HashTable::FinishResize cannot be used with template defined bucket count!");
+    while (buckets_.is_resizing()) {
+      MigrateBuckets(buckets_.old_size());
+    }
+  }
+
+  bool is_resizing() const { return buckets_.is_resizing(); }
+
   ~HashTable() { ZX_DEBUG_ASSERT(PtrTraits::IsManaged || is_empty()); }
 
   // Standard begin/end, cbegin/cend iterator accessors.
@@ -339,19 +446,20 @@ class __POINTER(_KeyType) HashTable {
   // make_iterator : construct an iterator out of a reference to an object.
   iterator make_iterator(ValueType& obj) {
     buckets_.AssertValid();
-    HashType ndx = GetHash(KeyTraits::GetKey(obj));
-    return iterator(this, ndx, buckets_[ndx].make_iterator(obj));
+    HashType ndx = GetBucketNdx(KeyTraits::GetKey(obj));
+    return iterator(this, ndx, buckets_.at(ndx).make_iterator(obj));
   }
   const_iterator make_iterator(const ValueType& obj) const {
     buckets_.AssertValid();
-    HashType ndx = GetHash(KeyTraits::GetKey(obj));
-    return const_iterator(this, ndx, buckets_[ndx].make_iterator(obj));
+    HashType ndx = GetBucketNdx(KeyTraits::GetKey(obj));
+    return const_iterator(this, ndx, buckets_.at(ndx).make_iterator(obj));
   }
 
   void insert(const PtrType& ptr) { insert(PtrType(ptr)); }
   void insert(PtrType&& ptr) {
     ZX_DEBUG_ASSERT(ptr != nullptr);
     buckets_.AssertValid();
+    MigrateBuckets(kBucketsMigratedPerInsert);
 
     KeyType key = KeyTraits::GetKey(*ptr);
     BucketType& bucket = GetBucket(key);
@@ -385,10 +493,11 @@ class __POINTER(_KeyType) HashTable {
   bool insert_or_find(PtrType&& ptr, iterator* iter = nullptr) {
     ZX_DEBUG_ASSERT(ptr != nullptr);
     buckets_.AssertValid();
+    MigrateBuckets(kBucketsMigratedPerInsert);
 
     KeyType key = KeyTraits::GetKey(*ptr);
-    HashType ndx = GetHash(key);
-    auto& bucket = buckets_[ndx];
+    HashType ndx = GetBucketNdx(key);
+    auto& bucket = buckets_.at(ndx);
     auto bucket_iter = FindInBucket(bucket, key);
 
     if (bucket_iter.IsValid()) {
@@ -416,10 +525,10 @@ class __POINTER(_KeyType) HashTable {
   PtrType insert_or_replace(PtrType&& ptr) {
     ZX_DEBUG_ASSERT(ptr != nullptr);
     buckets_.AssertValid();
+    MigrateBuckets(kBucketsMigratedPerInsert);
 
     KeyType key = KeyTraits::GetKey(*ptr);
-    HashType ndx = GetHash(key);
-    auto& bucket = buckets_[ndx];
+    auto& bucket = GetBucket(key);
     auto orig = PtrTraits::GetRaw(ptr);
 
     PtrType replaced = bucket.replace_if(
@@ -440,8 +549,8 @@ class __POINTER(_KeyType) HashTable {
   iterator find(const KeyType& key) {
     buckets_.AssertValid();
 
-    HashType ndx = GetHash(key);
-    auto& bucket = buckets_[ndx];
+    HashType ndx = GetBucketNdx(key);
+    auto& bucket = buckets_.at(ndx);
     auto bucket_iter = FindInBucket(bucket, key);
 
     return bucket_iter.IsValid() ? iterator(this, ndx, bucket_iter) : iterator(this, iterator::END);
@@ -450,8 +559,8 @@ class __POINTER(_KeyType) HashTable {
   const_iterator find(const KeyType& key) const {
     buckets_.AssertValid();
 
-    HashType ndx = GetHash(key);
-    const auto& bucket = buckets_[ndx];
+    HashType ndx = GetBucketNdx(key);
+    const auto& bucket = buckets_.at(ndx);
     auto bucket_iter = FindInBucket(bucket, key);
 
     return bucket_iter.IsValid() ? const_iterator(this, ndx, bucket_iter)
@@ -476,7 +585,7 @@ class __POINTER(_KeyType) HashTable {
     if (!iter.IsValid())
       return PtrType(nullptr);
 
-    return direct_erase(buckets_[iter.bucket_ndx_], *iter);
+    return direct_erase(buckets_.at(iter.bucket_ndx_), *iter);
   }
 
   PtrType erase(ValueType& obj) { return direct_erase(GetBucket(obj), obj); }
@@ -488,9 +597,10 @@ class __POINTER(_KeyType) HashTable {
   // which were in it.
   void clear() {
     // No need to assert that delayed-init buckets are valid here; clearing a
-    // non-initialized set of delayed-init buckets is a safe operation.
-    for (auto& e : buckets_)
-      e.clear();
+    // non-initialized set of delayed-init buckets is a safe operation.  Any
+    // old buckets of an in-progress resize are cleared along with the rest.
+    for (HashType i = 0; i < buckets_.total_size(); ++i)
+      buckets_.at(i).clear();
     count_ = 0;
   }
 
@@ -508,8 +618,8 @@ class __POINTER(_KeyType) HashTable {
                   "Container does not support clear_unsafe.  Consider adding "
                   "NodeOptions::AllowClearUnsafe to your node storage.");
 
-    for (auto& e : buckets_)
-      e.clear_unsafe();
+    for (HashType i = 0; i < buckets_.total_size(); ++i)
+      buckets_.at(i).clear_unsafe();
 
     count_ = 0;
   }
@@ -532,8 +642,8 @@ class __POINTER(_KeyType) HashTable {
       return PtrType(nullptr);
     }
 
-    for (HashType i = 0; i < buckets_.size(); ++i) {
-      auto& bucket = buckets_[i];
+    for (HashType i = 0; i < buckets_.total_size(); ++i) {
+      auto& bucket = buckets_.at(i);
       if (!bucket.is_empty()) {
         PtrType ret = bucket.erase_if(fn);
         if (ret != nullptr) {
@@ -726,7 +836,7 @@ class __POINTER(_KeyType) HashTable {
     }
 
     BucketType& GetBucket(HashType ndx) {
-      return const_cast<ContainerType*>(hash_table_)->buckets_[ndx];
+      return const_cast<ContainerType*>(hash_table_)->buckets_.at(ndx);
     }
 
     void advance_if_invalid_iter() {
@@ -748,7 +858,7 @@ class __POINTER(_KeyType) HashTable {
       }
     }
 
-    HashType last_bucket_ndx() const { return hash_table_->bucket_count() - 1; }
+    HashType last_bucket_ndx() const { return hash_table_->buckets_.total_size() - 1; }
 
     const ContainerType* hash_table_ = nullptr;
     HashType bucket_ndx_ = 0;
@@ -803,7 +913,13 @@ class __POINTER(_KeyType) HashTable {
   // Hash tables may not currently be copied, assigned or moved.
   DISALLOW_COPY_ASSIGN_AND_MOVE(HashTable);
 
-  BucketType& GetBucket(const KeyType& key) { return buckets_[GetHash(key)]; }
+  // The number of old buckets migrated by each insert operation while a resize
+  // is in progress.  Migrating more than one per insert guarantees that a
+  // resize which doubles the bucket count finishes well before the table needs
+  // to be resized again.
+  static constexpr HashType kBucketsMigratedPerInsert = 2;
+
+  BucketType& GetBucket(const KeyType& key) { return buckets_.at(GetBucketNdx(key)); }
   BucketType& GetBucket(const ValueType& obj) { return GetBucket(KeyTraits::GetKey(obj)); }
 
   HashType GetHash(const KeyType& obj) const {
@@ -814,6 +930,38 @@ class __POINTER(_KeyType) HashTable {
     }
   }
 
+  // The index (as understood by BucketStorage::at) of the bucket which holds,
+  // or would hold, the element with the given key.  While a resize is in
+  // progress, elements whose old bucket has not been migrated yet stay there,
+  // and new elements are added to it as well, so that every key still maps to
+  // exactly one bucket.
+  HashType GetBucketNdx(const KeyType& key) const {
+    if constexpr (NumBuckets == kDynamicBucketCount) {
+      if (buckets_.is_resizing()) {
+        const HashType old_ndx = HashTraits::GetHash(key) % buckets_.old_size();
+        if (old_ndx >= buckets_.migrated_count()) {
+          return static_cast<HashType>(buckets_.size() + old_ndx);
+        }
+      }
+    }
+    return GetHash(key);
+  }
+
+  // Move the contents of up to |max_buckets| old buckets into the new ones, if
+  // a resize is in progress.
+  void MigrateBuckets(HashType max_buckets) {
+    if constexpr (NumBuckets == kDynamicBucketCount) {
+      for (HashType i = 0; (i < max_buckets) && buckets_.is_resizing(); ++i) {
+        BucketType& old_bucket = buckets_.next_to_migrate();
+        while (!old_bucket.is_empty()) {
+          PtrType ptr = old_bucket.pop_front();
+          buckets_[GetHash(KeyTraits::GetKey(*ptr))].push_front(std::move(ptr));
+        }
+        buckets_.MigratedOne();
+      }
+    }
+  }
+
   size_t count_ = 0UL;
   internal::BucketStorage<HashType, BucketType, NumBuckets> buckets_;
 };
@@ -26,17 +26,18 @@ class HashTableChecker {
     using HashType = typename ContainerType::HashType;
     using KeyTraits = typename ContainerType::KeyTraits;
 
-    // Demand that every bucket pass its sanity check.  Keep a running total
-    // of the total size of the HashTable in the process.
+    // Demand that every bucket (including the old buckets of an in-progress
+    // resize) pass its sanity check.  Keep a running total of the total size
+    // of the HashTable in the process.
     size_t total_size = 0;
-    for (size_t i = 0; i < container.buckets_.size(); ++i) {
-      ASSERT_NO_FATAL_FAILURE(BucketChecker::SanityCheck(container.buckets_[i]));
-      total_size += SizeUtils<BucketType>::size(container.buckets_[i]);
+    for (size_t i = 0; i < container.buckets_.total_size(); ++i) {
+      ASSERT_NO_FATAL_FAILURE(BucketChecker::SanityCheck(container.buckets_.at(i)));
+      total_size += SizeUtils<BucketType>::size(container.buckets_.at(i));
 
       // For every element in the bucket, make sure that the bucket index
       // matches the hash of the element.
-      for (const auto& obj : container.buckets_[i]) {
-        ASSERT_EQ(container.GetHash(KeyTraits::GetKey(obj)), static_cast<HashType>(i));
+      for (const auto& obj : container.buckets_.at(i)) {
+        ASSERT_EQ(container.GetBucketNdx(KeyTraits::GetKey(obj)), static_cast<HashType>(i));
       }
     }
 
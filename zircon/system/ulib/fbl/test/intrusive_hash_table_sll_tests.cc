@@ -223,6 +223,87 @@ TEST(SinglyLinkedHashTableTest, NoRemoveFromContainer) {
 #endif
 }
 
+// Make sure that elements stay reachable while a dynamically sized hashtable is
+// incrementally migrated to a new set of buckets, and that the migration
+// eventually finishes on its own.
+TEST(SinglyLinkedHashTableTest, IncrementalResize) {
+  struct Obj : public SinglyLinkedListable<Obj*> {
+    size_t GetKey() const { return key; }
+    static size_t GetHash(size_t key) { return key; }
+    size_t key = 0;
+  };
+  using HashTableType =
+      fbl::HashTable<size_t, Obj*, fbl::SinglyLinkedList<Obj*>, size_t, kDynamicBucketCount>;
+  using BucketType = HashTableType::BucketType;
+
+  constexpr size_t kOldBucketCount = 7;
+  constexpr size_t kNewBucketCount = 16;
+  constexpr size_t kObjCount = 64;
+  Obj objs[kObjCount];
+  for (size_t i = 0; i < kObjCount; ++i) {
+    objs[i].key = i;
+  }
+
+  HashTableType ht{std::unique_ptr<BucketType[]>(new BucketType[kOldBucketCount]),
+                   kOldBucketCount};
+  for (size_t i = 0; i < kObjCount / 2; ++i) {
+    ht.insert(&objs[i]);
+  }
+  EXPECT_FALSE(ht.is_resizing());
+
+  ht.Resize(std::unique_ptr<BucketType[]>(new BucketType[kNewBucketCount]), kNewBucketCount);
+  EXPECT_TRUE(ht.is_resizing());
+  EXPECT_EQ(kNewBucketCount, ht.bucket_count());
+  EXPECT_EQ(kObjCount / 2, ht.size());
+  ASSERT_NO_FATAL_FAILURE(HashTableChecker::SanityCheck(ht));
+
+  // Every element (whichever bucket array it is in) must be found by key,
+  // visited exactly once by iteration, and erasable.
+  for (size_t i = kObjCount / 2; i < kObjCount; ++i) {
+    ht.insert(&objs[i]);
+    ASSERT_NO_FATAL_FAILURE(HashTableChecker::SanityCheck(ht));
+
+    size_t visited = 0;
+    for (const Obj& obj : ht) {
+      EXPECT_EQ(&objs[obj.key], &obj);
+      ++visited;
+    }
+    EXPECT_EQ(i + 1, visited);
+
+    for (size_t j = 0; j <= i; ++j) {
+      auto iter = ht.find(j);
+      ASSERT_TRUE(iter.IsValid());
+      EXPECT_EQ(&objs[j], &(*iter));
+    }
+    EXPECT_FALSE(ht.find(i + 1).IsValid());
+  }
+
+  // Each insert migrates a fixed number of old buckets, so there were more
+  // than enough of them to finish.
+  EXPECT_FALSE(ht.is_resizing());
+  EXPECT_EQ(kObjCount, ht.size());
+
+  // Erase from the middle of another resize, then finish it eagerly.
+  ht.Resize(std::unique_ptr<BucketType[]>(new BucketType[kOldBucketCount]), kOldBucketCount);
+  ASSERT_TRUE(ht.is_resizing());
+  for (size_t i = 0; i < kObjCount; i += 2) {
+    EXPECT_EQ(&objs[i], ht.erase(i));
+  }
+  EXPECT_TRUE(ht.is_resizing());
+  ASSERT_NO_FATAL_FAILURE(HashTableChecker::SanityCheck(ht));
+
+  ht.FinishResize();
+  EXPECT_FALSE(ht.is_resizing());
+  EXPECT_EQ(kOldBucketCount, ht.bucket_count());
+  EXPECT_EQ(kObjCount / 2, ht.size());
+  ASSERT_NO_FATAL_FAILURE(HashTableChecker::SanityCheck(ht));
+  for (size_t i = 0; i < kObjCount; ++i) {
+    EXPECT_EQ((i % 2) != 0, ht.find(i).IsValid());
+  }
+
+  ht.clear();
+}
+
 // Small helper which will generate tests for both the static and dynamic
 // versions of the HashTable
 #define RUN_HT_ZXTEST(_group, _flavor, _test) \
@@ -7,6 +7,7 @@
 
 #include <lib/fit/function.h>
 #include <lib/inspect/cpp/vmo/block.h>
+#include <lib/inspect/cpp/vmo/snapshot.h>
 #include <zircon/types.h>
 
 namespace inspect {
@@ -23,6 +24,15 @@ namespace internal {
 zx_status_t ScanBlocks(const uint8_t* buffer, size_t size,
                        fit::function<bool(BlockIndex, const Block*)> callback);
 
+// Scans the blocks of |current|, calling |callback| only for those which differ from the bytes at
+// the same index in |previous|, an older snapshot of the same VMO. Nothing is scanned if both
+// snapshots were taken at the same consistent generation.
+//
+// This lets readers which mirror a hierarchy update only the parts that changed. Blocks which were
+// freed show up as changed free blocks, so removals are observed as well.
+zx_status_t ScanChangedBlocks(const Snapshot& previous, const Snapshot& current,
+                              fit::function<bool(BlockIndex, const Block*)> callback);
+
 }  // namespace internal
 }  // namespace inspect
 
@@ -93,6 +93,15 @@ class Snapshot final {
   // snapshot, an error status is returned. There are no observers or writers involved.
   static zx_status_t Create(BackingBuffer&& buffer, Snapshot* out_snapshot);
 
+  // Bring |snapshot|, which was previously taken of the same VMO, up to date with the given
+  // options. Only the header is read if the VMO's generation count hasn't changed since
+  // |snapshot| was taken, in which case |snapshot| is left as it is. Otherwise a new snapshot is
+  // taken as if by |Create|.
+  //
+  // This is meant for readers which poll a VMO frequently, most of which doesn't change between
+  // polls.
+  static zx_status_t Refresh(const zx::vmo& vmo, Options options, Snapshot* snapshot);
+
   Snapshot() = default;
   ~Snapshot() = default;
   Snapshot(Snapshot&&) = default;
@@ -108,6 +117,9 @@ class Snapshot final {
   // Returns the size of the snapshot.
   size_t size() const { return buffer_ ? buffer_->Size() : 0; }
 
+  // Returns the generation count the snapshot was taken at.
+  uint64_t generation() const { return generation_; }
+
  private:
   // Read from the VMO into a buffer.
   static zx_status_t Read(const zx::vmo& vmo, size_t size, uint8_t* buffer);
@@ -122,10 +134,13 @@ class Snapshot final {
 
   // Take a new snapshot of the VMO with default options.
   // If reading fails, the boolean value of the constructed |Snapshot| will be false.
-  explicit Snapshot(BackingBuffer&& buffer);
+  explicit Snapshot(BackingBuffer&& buffer, uint64_t generation);
 
   // The buffer storing the snapshot.
   std::shared_ptr<BackingBuffer> buffer_;
+
+  // The generation count read from the header when the snapshot was taken.
+  uint64_t generation_ = 0;
 };
 
 namespace internal {
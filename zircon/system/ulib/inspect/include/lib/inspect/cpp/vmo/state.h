@@ -155,6 +155,10 @@ class State final {
   LazyNode CreateLazyValues(BorrowedStringValue name, BlockIndex parent,
                             LazyNodeCallbackFn callback);
   // Setters for various property types
+  //
+  // Numeric and boolean properties are updated in place with atomic operations and don't take the
+  // state lock, so counters shared between threads don't contend on it. Arrays and variable-sized
+  // properties still update under the lock.
   void SetIntProperty(IntProperty* property, int64_t value);
   void SetUintProperty(UintProperty* property, uint64_t value);
   void SetDoubleProperty(DoubleProperty* property, double value);
@@ -278,6 +282,15 @@ class State final {
   std::unique_ptr<AutoGenerationIncrement> MaybeFreezeAndIncrementGeneration() const
       __TA_REQUIRES(mutex_);
 
+  // Returns the block at |index| without holding the lock. The heap maps its whole VMO up front,
+  // so blocks never move for the lifetime of the State, and |heap_| and |header_| never change
+  // after construction.
+  Block* GetBlockUnlocked(BlockIndex index) const FIT_NO_THREAD_SAFETY_ANALYSIS;
+
+  // Makes a lock-free update visible to readers by adding two to the generation count, which
+  // changes the count without changing whether a locked write appears to be in progress.
+  void PublishUnlockedUpdate() FIT_NO_THREAD_SAFETY_ANALYSIS;
+
   // Helper method for creating a new VALUE block type.
   zx_status_t InnerCreateValue(BorrowedStringValue name, BlockType type, BlockIndex parent_index,
                                BlockIndex* out_name, BlockIndex* out_value,
@@ -2,9 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <lib/inspect/cpp/vmo/limits.h>
 #include <lib/inspect/cpp/vmo/scanner.h>
+#include <lib/inspect/cpp/vmo/snapshot.h>
 #include <zircon/types.h>
 
+#include <vector>
+
 #include <zxtest/zxtest.h>
 
 namespace {
@@ -15,6 +19,23 @@ using inspect::internal::BlockIndex;
 using inspect::internal::BlockType;
 using inspect::internal::kMinOrderSize;
 using inspect::internal::ScanBlocks;
+using inspect::internal::ScanChangedBlocks;
+
+inspect::Snapshot MakeSnapshot(uint64_t generation, BlockIndex changed_index) {
+  std::vector<uint8_t> buf(1024);
+  Block* header = reinterpret_cast<Block*>(buf.data());
+  header->header = inspect::internal::HeaderBlockFields::Order::Make(0) |
+                   inspect::internal::HeaderBlockFields::Type::Make(BlockType::kHeader) |
+                   inspect::internal::HeaderBlockFields::Version::Make(0);
+  memcpy(&header->header_data[4], inspect::internal::kMagicNumber, 4);
+  header->payload.u64 = generation;
+  if (changed_index != 0) {
+    reinterpret_cast<Block*>(buf.data())[changed_index].payload.u64 = 1;
+  }
+  inspect::Snapshot snapshot;
+  EXPECT_OK(inspect::Snapshot::Create(inspect::BackingBuffer(std::move(buf)), &snapshot));
+  return snapshot;
+}
 
 TEST(Scanner, ReadEmpty) {
   uint8_t buf[1024];
@@ -83,4 +104,31 @@ TEST(Scanner, ReadOutOfBounds) {
   EXPECT_EQ(0u, count);
 }
 
+TEST(Scanner, ScanChangedBlocks) {
+  inspect::Snapshot previous = MakeSnapshot(2, 0);
+  inspect::Snapshot current = MakeSnapshot(4, 10);
+
+  std::vector<BlockIndex> changed;
+  EXPECT_OK(ScanChangedBlocks(previous, current, [&](BlockIndex index, const Block* block) {
+    changed.push_back(index);
+    return true;
+  }));
+  // The header changes along with its generation count.
+  EXPECT_EQ((std::vector<BlockIndex>{0, 10}), changed);
+
+  // Everything is new relative to an empty snapshot.
+  changed.clear();
+  EXPECT_OK(ScanChangedBlocks(inspect::Snapshot(), current, [&](BlockIndex index, const Block*) {
+    changed.push_back(index);
+    return true;
+  }));
+  EXPECT_EQ(1024 / kMinOrderSize, changed.size());
+
+  // Snapshots from the same generation are not compared at all.
+  EXPECT_OK(ScanChangedBlocks(current, MakeSnapshot(4, 20), [](BlockIndex, const Block*) {
+    ADD_FAILURE("unexpected changed block");
+    return false;
+  }));
+}
+
 }  // namespace
@@ -349,4 +349,34 @@ TEST(Snapshot, HeaderWithoutSizeInfo) {
   EXPECT_EQ(0, memcmp(snapshot.data() + kVmoHeaderBlockSize, buf.data(), buf.size()));
 }
 
+TEST(Snapshot, RefreshReusesUnchangedSnapshot) {
+  fzl::OwnedVmoMapper vmo;
+  ASSERT_OK(vmo.CreateAndMap(4096, "test"));
+  memset(vmo.start(), 'a', 4096);
+  Block* header = reinterpret_cast<Block*>(vmo.start());
+  header->header = HeaderBlockFields::Order::Make(kVmoHeaderOrder) |
+                   HeaderBlockFields::Type::Make(BlockType::kHeader) |
+                   HeaderBlockFields::Version::Make(0);
+  memcpy(&header->header_data[4], kMagicNumber, 4);
+  header->payload.u64 = 0;
+  SetHeaderVmoSize(header, vmo.size());
+
+  Snapshot snapshot;
+  ASSERT_OK(Snapshot::Create(vmo.vmo(), &snapshot));
+  EXPECT_EQ(0u, snapshot.generation());
+  const uint8_t* data = snapshot.data();
+
+  // Without a generation change the contents are not copied again, so the new
+  // byte is not observed.
+  reinterpret_cast<uint8_t*>(vmo.start())[kVmoHeaderBlockSize] = 'b';
+  ASSERT_OK(Snapshot::Refresh(vmo.vmo(), Snapshot::kDefaultOptions, &snapshot));
+  EXPECT_EQ(data, snapshot.data());
+  EXPECT_EQ('a', snapshot.data()[kVmoHeaderBlockSize]);
+
+  header->payload.u64 = 2;
+  ASSERT_OK(Snapshot::Refresh(vmo.vmo(), Snapshot::kDefaultOptions, &snapshot));
+  EXPECT_EQ(2u, snapshot.generation());
+  EXPECT_EQ('b', snapshot.data()[kVmoHeaderBlockSize]);
+}
+
 }  // namespace
@@ -1704,6 +1704,25 @@ TEST(State, OutOfOrderDeletion) {
   }
 }
 
+TEST(State, NumericUpdateInTransactionKeepsVmoLocked) {
+  auto state = InitState(4096);
+  ASSERT_TRUE(state != nullptr);
+
+  IntProperty metric = state->CreateIntProperty("a", 0, 0);
+  CheckVmoGenCount(2, state->GetVmo());
+
+  state->BeginTransaction();
+  metric.Add(1);
+  // The lock-free update changes the count but must not make it look like no write is in
+  // progress.
+  Block header;
+  ASSERT_EQ(ZX_OK, state->GetVmo().read(&header, 0, sizeof(header)));
+  EXPECT_EQ(5u, header.payload.u64);
+  state->EndTransaction();
+
+  CheckVmoGenCount(6, state->GetVmo());
+}
+
 TEST(State, CreateNodeHierarchyInTransaction) {
   auto state = InitState(4096);
   ASSERT_TRUE(state != nullptr);
@@ -5,6 +5,8 @@
 #include <lib/inspect/cpp/vmo/limits.h>
 #include <lib/inspect/cpp/vmo/scanner.h>
 
+#include <cstring>
+
 namespace inspect {
 namespace internal {
 
@@ -36,5 +38,24 @@ zx_status_t ScanBlocks(const uint8_t* buffer, size_t size,
   return ZX_OK;
 }
 
+zx_status_t ScanChangedBlocks(const Snapshot& previous, const Snapshot& current,
+                              fit::function<bool(BlockIndex, const Block*)> callback) {
+  if (previous && previous.generation() == current.generation() &&
+      previous.generation() % 2 == 0 && previous.generation() != kVmoFrozen) {
+    return ZX_OK;
+  }
+
+  const uint8_t* previous_data = previous.data();
+  const size_t previous_size = previous.size();
+  return ScanBlocks(current.data(), current.size(), [&](BlockIndex index, const Block* block) {
+    const size_t offset = index * kMinOrderSize;
+    const size_t size = OrderToSize(GetOrder(block));
+    if (offset + size <= previous_size && memcmp(previous_data + offset, block, size) == 0) {
+      return true;
+    }
+    return callback(index, block);
+  });
+}
+
 }  // namespace internal
 }  // namespace inspect
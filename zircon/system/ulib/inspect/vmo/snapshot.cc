@@ -27,8 +27,8 @@ namespace inspect {
 const Snapshot::Options Snapshot::kDefaultOptions = {.read_attempts = 1024,
                                                      .skip_consistency_check = false};
 
-Snapshot::Snapshot(BackingBuffer&& buffer)
-    : buffer_(std::make_shared<BackingBuffer>(std::move(buffer))) {}
+Snapshot::Snapshot(BackingBuffer&& buffer, uint64_t generation)
+    : buffer_(std::make_shared<BackingBuffer>(std::move(buffer))), generation_(generation) {}
 
 zx_status_t Snapshot::Create(BackingBuffer&& buffer, Snapshot* out_snapshot) {
   ZX_ASSERT(out_snapshot);
@@ -37,15 +37,15 @@ zx_status_t Snapshot::Create(BackingBuffer&& buffer, Snapshot* out_snapshot) {
     return ZX_ERR_INVALID_ARGS;
   }
 
-  // A buffer does not have concurrent writers or observers, so we don't use
-  // this.
-  uint64_t unused;
+  // A buffer does not have concurrent writers or observers, so the generation
+  // is only recorded.
+  uint64_t generation;
   // Verify that the buffer can, in fact, be parsed as a snapshot.
-  zx_status_t status = Snapshot::ParseHeader(buffer.Data(), &unused);
+  zx_status_t status = Snapshot::ParseHeader(buffer.Data(), &generation);
   if (status != ZX_OK) {
     return status;
   }
-  *out_snapshot = Snapshot(std::move(buffer));
+  *out_snapshot = Snapshot(std::move(buffer), generation);
   if (!*out_snapshot) {
     return ZX_ERR_INTERNAL;
   }
@@ -70,7 +70,7 @@ zx_status_t Snapshot::Create(const zx::vmo& vmo, Options options, ReadObserver r
       read_observer(maybe_frozen.Data(), maybe_frozen.Size());
     }
 
-    *out_snapshot = Snapshot(std::move(maybe_frozen));
+    *out_snapshot = Snapshot(std::move(maybe_frozen), generation);
     return ZX_OK;
   }
 
@@ -143,7 +143,7 @@ zx_status_t Snapshot::Create(const zx::vmo& vmo, Options options, ReadObserver r
       continue;
     }
 
-    *out_snapshot = Snapshot(BackingBuffer(std::move(buffer)));
+    *out_snapshot = Snapshot(BackingBuffer(std::move(buffer)), generation);
 
     return ZX_OK;
   }
@@ -151,6 +151,25 @@ zx_status_t Snapshot::Create(const zx::vmo& vmo, Options options, ReadObserver r
   return ZX_ERR_INTERNAL;
 }
 
+zx_status_t Snapshot::Refresh(const zx::vmo& vmo, Options options, Snapshot* snapshot) {
+  ZX_ASSERT(snapshot);
+
+  // An odd generation means the snapshot may be inconsistent, and a frozen
+  // VMO's count says nothing about its contents, so only reuse even ones.
+  if (*snapshot && snapshot->generation_ % 2 == 0 &&
+      snapshot->generation_ != internal::kVmoFrozen) {
+    uint8_t header[kVmoHeaderBlockSize];
+    uint64_t generation;
+    if (Snapshot::Read(vmo, sizeof(header), header) == ZX_OK &&
+        Snapshot::ParseHeader(header, &generation) == ZX_OK &&
+        generation == snapshot->generation_) {
+      return ZX_OK;
+    }
+  }
+
+  return Snapshot::Create(vmo, options, snapshot);
+}
+
 zx_status_t Snapshot::Read(const zx::vmo& vmo, size_t size, uint8_t* buffer) {
   memset(buffer, 0, size);
   return vmo.read(buffer, 0, size);
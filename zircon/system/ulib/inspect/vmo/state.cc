@@ -31,6 +31,17 @@ namespace {
 struct Freeze_t {
 } Freeze;
 
+// Atomically adds |value| to the double at |ptr|.
+void AtomicAddDouble(double* ptr, double value) {
+  double expected;
+  __atomic_load(ptr, &expected, __ATOMIC_RELAXED);
+  double desired;
+  do {
+    desired = expected + value;
+  } while (!__atomic_compare_exchange(ptr, &expected, &desired, /*weak=*/true, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_RELAXED));
+}
+
 }  // namespace
 
 // Helper class to support RAII locking of the generation count.
@@ -88,8 +99,9 @@ AutoGenerationIncrement::AutoGenerationIncrement(Freeze_t, BlockIndex target, He
 
 void AutoGenerationIncrement::Acquire(Freeze_t, Block* block) {
   uint64_t* ptr = &block->payload.u64;
-  last_gen_count_ = block->payload.u64;
-  __atomic_store_n(ptr, kVmoFrozen, __ATOMIC_SEQ_CST);
+  // Exchange rather than read and store, so that a concurrent lock-free numeric update can't bump
+  // the count in between and have its bump lost when the count is restored.
+  last_gen_count_ = __atomic_exchange_n(ptr, kVmoFrozen, __ATOMIC_SEQ_CST);
 }
 
 void AutoGenerationIncrement::Acquire(Block* block) {
@@ -546,48 +558,42 @@ Node State::CreateNode(BorrowedStringValue name, BlockIndex parent) {
 
 void State::SetIntProperty(IntProperty* metric, int64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
 
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kIntValue, "Expected int metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.i64 = value;
+  __atomic_store_n(&block->payload.i64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SetUintProperty(UintProperty* metric, uint64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kUintValue, "Expected uint metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.u64 = value;
+  __atomic_store_n(&block->payload.u64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SetDoubleProperty(DoubleProperty* metric, double value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kDoubleValue, "Expected double metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.f64 = value;
+  __atomic_store(&block->payload.f64, &value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SetBoolProperty(BoolProperty* metric, bool value) {
   ZX_ASSERT(metric->state_.get() == this);
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
 
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kBoolValue, "Expected bool metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.u64 = value;
+  __atomic_store_n(&block->payload.u64, static_cast<uint64_t>(value), __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SetIntArray(IntArray* array, size_t index, int64_t value) {
@@ -611,73 +617,61 @@ void State::SetStringArray(StringArray* array, size_t index, BorrowedStringValue
 void State::AddIntProperty(IntProperty* metric, int64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kIntValue, "Expected int metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.i64 += value;
+  __atomic_fetch_add(&block->payload.i64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::AddUintProperty(UintProperty* metric, uint64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kUintValue, "Expected uint metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.u64 += value;
+  __atomic_fetch_add(&block->payload.u64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::AddDoubleProperty(DoubleProperty* metric, double value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kDoubleValue, "Expected double metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.f64 += value;
+  AtomicAddDouble(&block->payload.f64, value);
+  PublishUnlockedUpdate();
 }
 
 void State::SubtractIntProperty(IntProperty* metric, int64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kIntValue, "Expected int metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.i64 -= value;
+  __atomic_fetch_sub(&block->payload.i64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SubtractUintProperty(UintProperty* metric, uint64_t value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kUintValue, "Expected uint metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.u64 -= value;
+  __atomic_fetch_sub(&block->payload.u64, value, __ATOMIC_SEQ_CST);
+  PublishUnlockedUpdate();
 }
 
 void State::SubtractDoubleProperty(DoubleProperty* metric, double value) {
   ZX_ASSERT(metric->state_.get() == this);
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::unique_ptr<AutoGenerationIncrement> gen = MaybeIncrementGeneration();
-
-  auto* block = heap_->GetBlock(metric->value_index_);
+  auto* block = GetBlockUnlocked(metric->value_index_);
   ZX_DEBUG_ASSERT_MSG(GetType(block) == BlockType::kDoubleValue, "Expected double metric, got %d",
                       static_cast<int>(GetType(block)));
-  block->payload.f64 -= value;
+  AtomicAddDouble(&block->payload.f64, -value);
+  PublishUnlockedUpdate();
 }
 
 void State::AddIntArray(IntArray* array, size_t index, int64_t value) {
@@ -778,6 +772,24 @@ void State::DecrementParentRefcount(BlockIndex value_index) {
   }
 }
 
+Block* State::GetBlockUnlocked(BlockIndex index) const { return heap_->GetBlock(index); }
+
+void State::PublishUnlockedUpdate() {
+  uint64_t* ptr = &GetBlockUnlocked(header_)->payload.u64;
+  uint64_t generation = __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+  while (generation != kVmoFrozen) {
+    // Adding two leaves the parity, which is owned by writers holding the lock, untouched.
+    if (__atomic_compare_exchange_n(ptr, &generation, generation + 2, /*weak=*/true,
+                                    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+      return;
+    }
+  }
+  // A frozen copy is being made. The count is restored before the lock is released, so wait for
+  // that rather than overwrite the frozen marker.
+  std::lock_guard<std::mutex> lock(mutex_);
+  __atomic_fetch_add(ptr, 2, __ATOMIC_SEQ_CST);
+}
+
 std::unique_ptr<AutoGenerationIncrement> State::MaybeIncrementGeneration() {
   if (transaction_count_ > 0) {
     return nullptr;
@@ -49,6 +49,11 @@ constexpr uint32_t kMaxPriority = 31;
 // Suggested default priority for a stream.
 constexpr uint32_t kDefaultPriority = 8;
 
+// Ready streams are served strictly by priority, round-robin among streams of equal priority. To
+// bound starvation, after this many consecutive ops are issued from streams of higher priority than
+// the lowest waiting one, one op is issued from the lowest priority ready stream.
+constexpr uint32_t kMaxPriorityInversionRun = 16;
+
 class Scheduler {
  public:
   Scheduler() = default;
@@ -136,6 +141,12 @@ class Scheduler {
   // Insert a single op into a stream.
   zx_status_t InsertOp(UniqueOp op, UniqueOp* op_err) __TA_EXCLUDES(lock_);
 
+  // Add |stream| to |ready_streams_| behind all ready streams of the same or higher priority.
+  void InsertReadyStreamLocked(StreamRef stream) __TA_REQUIRES(lock_);
+
+  // Remove the next stream to be served from |ready_streams_|.
+  StreamRef PopReadyStreamLocked() __TA_REQUIRES(lock_);
+
   // Mark an op as deferred for later completion by a worker thread.
   // This function is intended to be called by async callbacks.
   void DeferOp(UniqueOp op) __TA_EXCLUDES(lock_);
@@ -153,6 +164,9 @@ class Scheduler {
   // List of all streams that have ops ready to be issued, in priority order.
   Stream::ReadyStreamList ready_streams_ __TA_GUARDED(lock_);
 
+  // Number of consecutive ops issued while a lower priority stream was ready.
+  uint32_t priority_inversion_run_ __TA_GUARDED(lock_) = 0;
+
   // List of streams that have deferred ops, in fifo order.
   Stream::DeferredStreamList deferred_streams_ __TA_GUARDED(lock_);
 
@@ -137,7 +137,7 @@ zx_status_t Scheduler::InsertOp(UniqueOp op, UniqueOp* op_err) {
     return status;
   }
   if (!was_ready) {
-    ready_streams_.push_back(std::move(stream));
+    InsertReadyStreamLocked(std::move(stream));
   }
   ops_available_.Signal();
   return ZX_OK;
@@ -176,13 +176,13 @@ zx_status_t Scheduler::Dequeue(bool wait, UniqueOp* out) {
       return ZX_OK;
     }
 
-    stream = ready_streams_.pop_front();
+    stream = PopReadyStreamLocked();
     if (stream != nullptr) {
       stream->GetNext(out);
       ZX_DEBUG_ASSERT(*out != nullptr);
       if (stream->HasReady()) {
-        // Stream has more ops, return to tail of ready stream queue.
-        ready_streams_.push_back(std::move(stream));
+        // Stream has more ops, return to tail of its priority class.
+        InsertReadyStreamLocked(std::move(stream));
       }
       return ZX_OK;
     }
@@ -243,6 +243,32 @@ void Scheduler::ReleaseOp(UniqueOp op) {
   }
 }
 
+void Scheduler::InsertReadyStreamLocked(StreamRef stream) {
+  for (auto iter = ready_streams_.begin(); iter != ready_streams_.end(); ++iter) {
+    if (iter->priority() < stream->priority()) {
+      ready_streams_.insert(iter, std::move(stream));
+      return;
+    }
+  }
+  ready_streams_.push_back(std::move(stream));
+}
+
+StreamRef Scheduler::PopReadyStreamLocked() {
+  if (ready_streams_.is_empty()) {
+    return nullptr;
+  }
+  if (ready_streams_.front().priority() == ready_streams_.back().priority()) {
+    // Every ready stream is in the same priority class.
+    priority_inversion_run_ = 0;
+    return ready_streams_.pop_front();
+  }
+  if (++priority_inversion_run_ >= kMaxPriorityInversionRun) {
+    priority_inversion_run_ = 0;
+    return ready_streams_.pop_back();
+  }
+  return ready_streams_.pop_front();
+}
+
 zx_status_t Scheduler::FindLocked(uint32_t id, StreamRef* out) {
   auto iter = all_streams_.find(id);
   if (!iter.IsValid()) {
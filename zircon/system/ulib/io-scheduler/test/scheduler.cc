@@ -0,0 +1,97 @@
+// Copyright 2026 The Fuchsia Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include <io-scheduler/io-scheduler.h>
+#include <zxtest/zxtest.h>
+
+namespace ioscheduler {
+namespace {
+
+// A client that is never asked to acquire or issue ops, since the tests drive Enqueue() and
+// Dequeue() directly.
+class FakeClient : public SchedulerClient {
+ public:
+  bool CanReorder(StreamOp* first, StreamOp* second) override { return false; }
+  zx_status_t Acquire(StreamOp** sop_list, size_t list_count, size_t* actual_count,
+                      bool wait) override {
+    return ZX_ERR_CANCELED;
+  }
+  zx_status_t Issue(StreamOp* sop) override { return ZX_OK; }
+  void Release(StreamOp* sop) override { delete sop; }
+  void CancelAcquire() override {}
+  void Fatal() override {}
+};
+
+class SchedulerTest : public zxtest::Test {
+ public:
+  void SetUp() override { ASSERT_OK(scheduler_.Init(&client_, kOptionFullyOutOfOrder)); }
+  void TearDown() override { scheduler_.Shutdown(); }
+
+ protected:
+  void EnqueueOps(uint32_t stream_id, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      UniqueOp op(new StreamOp(OpType::kOpTypeRead, stream_id, kOpGroupNone, 0, nullptr));
+      size_t out_actual;
+      ASSERT_OK(scheduler_.Enqueue(&op, 1, &op, &out_actual));
+      ASSERT_EQ(out_actual, 0u);
+    }
+  }
+
+  // Dequeues and releases every ready op, returning the stream ids in issue order.
+  std::vector<uint32_t> DrainStreamIds() {
+    std::vector<uint32_t> ids;
+    UniqueOp op;
+    while (scheduler_.Dequeue(false, &op) == ZX_OK) {
+      ids.push_back(op->stream_id());
+      scheduler_.ReleaseOp(std::move(op));
+    }
+    return ids;
+  }
+
+  FakeClient client_;
+  Scheduler scheduler_;
+};
+
+TEST_F(SchedulerTest, HigherPriorityStreamIssuesFirst) {
+  constexpr uint32_t kLow = 1;
+  constexpr uint32_t kHigh = 2;
+  ASSERT_OK(scheduler_.StreamOpen(kLow, 0));
+  ASSERT_OK(scheduler_.StreamOpen(kHigh, kMaxPriority));
+
+  // The low priority ops arrive first but are issued last.
+  EnqueueOps(kLow, 2);
+  EnqueueOps(kHigh, 2);
+  std::vector<uint32_t> expected = {kHigh, kHigh, kLow, kLow};
+  EXPECT_EQ(DrainStreamIds(), expected);
+}
+
+TEST_F(SchedulerTest, EqualPriorityStreamsRoundRobin) {
+  ASSERT_OK(scheduler_.StreamOpen(1, kDefaultPriority));
+  ASSERT_OK(scheduler_.StreamOpen(2, kDefaultPriority));
+
+  EnqueueOps(1, 2);
+  EnqueueOps(2, 2);
+  std::vector<uint32_t> expected = {1, 2, 1, 2};
+  EXPECT_EQ(DrainStreamIds(), expected);
+}
+
+TEST_F(SchedulerTest, LowPriorityStreamIsNotStarved) {
+  constexpr uint32_t kLow = 1;
+  constexpr uint32_t kHigh = 2;
+  ASSERT_OK(scheduler_.StreamOpen(kLow, 0));
+  ASSERT_OK(scheduler_.StreamOpen(kHigh, kMaxPriority));
+
+  EnqueueOps(kLow, 1);
+  EnqueueOps(kHigh, 2 * kMaxPriorityInversionRun);
+  std::vector<uint32_t> ids = DrainStreamIds();
+  ASSERT_EQ(ids.size(), 2 * kMaxPriorityInversionRun + 1);
+  for (size_t i = 0; i < ids.size(); i++) {
+    EXPECT_EQ(ids[i], i == kMaxPriorityInversionRun - 1 ? kLow : kHigh);
+  }
+}
+
+}  // namespace
+}  // namespace ioscheduler
@@ -185,7 +185,9 @@ int PerfTestMain(int argc, char** argv, const char* test_suite);
 
 // Run a single test for |test_suite| |run_count| times, and add the results to
 // |results_set| using the given name, |test_name|.  On error, this returns
-// false and sets |*error_out| to an error string.
+// false and sets |*error_out| to an error string.  If |warmup_count| is
+// non-zero, the test is run that many extra times first and the times for
+// those runs are not added to |results_set|.
 //
 // This function is useful for test suites that don't want to use
 // PerfTestMain() -- e.g. for test cases with complex parameters based on
@@ -193,7 +195,7 @@ int PerfTestMain(int argc, char** argv, const char* test_suite);
 // and must be run in a particular order.
 bool RunTest(const char* test_suite, const char* test_name,
              const fit::function<TestFunc>& test_func, uint32_t run_count, ResultsSet* results_set,
-             fbl::String* error_out);
+             fbl::String* error_out, uint32_t warmup_count = 0);
 
 // DoNotOptimize() can be used to prevent the computation of |value| from
 // being optimized away by the compiler.  It also prevents the compiler
@@ -26,7 +26,7 @@ typedef fbl::Vector<NamedTest> TestList;
 
 bool RunTests(const char* test_suite, TestList* test_list, uint32_t run_count,
               const char* regex_string, FILE* log_stream, ResultsSet* results_set,
-              bool quiet = false, bool random_order = false);
+              bool quiet = false, bool random_order = false, uint32_t warmup_count = 0);
 
 struct CommandArgs {
   const char* output_filename = nullptr;
@@ -35,6 +35,7 @@ struct CommandArgs {
   uint32_t run_count = 1000;
   bool quiet = false;
   bool random_order = false;
+  uint32_t warmup_count = 0;
 #if defined(__Fuchsia__)
   bool enable_tracing = false;
   double startup_delay_seconds = 0;
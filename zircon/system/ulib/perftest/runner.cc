@@ -57,7 +57,10 @@ internal::TestList* g_tests;
 
 class RepeatStateImpl : public RepeatState {
  public:
-  explicit RepeatStateImpl(uint32_t run_count) : run_count_(run_count) {}
+  // The first |warmup_count| runs are timed like the rest but left out of the results, so that
+  // one-time costs such as cold caches and page faults do not skew the reported times.
+  RepeatStateImpl(uint32_t run_count, uint32_t warmup_count)
+      : run_count_(run_count + warmup_count), warmup_count_(warmup_count) {}
 
   void DeclareStep(const char* name) override {
     if (started_) {
@@ -225,8 +228,8 @@ class RepeatStateImpl : public RepeatState {
   void CopyStepTimes(uint32_t start_step_index, uint32_t end_step_index,
                      TestCaseResults* results) const {
     // Copy the timing results, converting timestamps to elapsed times.
-    results->values.reserve(run_count_);
-    for (uint32_t run = 0; run < run_count_; ++run) {
+    results->values.reserve(run_count_ - warmup_count_);
+    for (uint32_t run = warmup_count_; run < run_count_; ++run) {
       results->AppendValue(
           GetDurationNanos(GetTimestamp(run, start_step_index), GetTimestamp(run, end_step_index)));
     }
@@ -251,8 +254,10 @@ class RepeatStateImpl : public RepeatState {
     }
   }
 
-  // Number of test runs that we intend to do.
+  // Number of test runs that we intend to do, including the warm-up runs.
   uint32_t run_count_;
+  // Number of initial test runs whose times are not reported.
+  uint32_t warmup_count_;
   // Number of steps per test run.  Once initialized, this is >= 1.
   uint32_t step_count_;
   // Names for steps.  May be empty if the test has only one step.
@@ -295,8 +300,8 @@ void RegisterTest(const char* name, fit::function<TestFunc> test_func) {
 
 bool RunTest(const char* test_suite, const char* test_name,
              const fit::function<TestFunc>& test_func, uint32_t run_count, ResultsSet* results_set,
-             fbl::String* error_out) {
-  RepeatStateImpl state(run_count);
+             fbl::String* error_out, uint32_t warmup_count) {
+  RepeatStateImpl state(run_count, warmup_count);
   const char* error = state.RunTestFunc(test_name, test_func);
   if (error) {
     if (error_out) {
@@ -314,7 +319,7 @@ namespace internal {
 
 bool RunTests(const char* test_suite, TestList* test_list, uint32_t run_count,
               const char* regex_string, FILE* log_stream, ResultsSet* results_set, bool quiet,
-              bool random_order) {
+              bool random_order, uint32_t warmup_count) {
   re2::RE2 regex(regex_string);
   if (!regex.ok()) {
     fprintf(log_stream, "Compiling the regular expression \"%s\" failed: %s\n", regex_string,
@@ -365,7 +370,7 @@ bool RunTests(const char* test_suite, TestList* test_list, uint32_t run_count,
 
     fbl::String error_string;
     if (!RunTest(test_suite, test_name, test_case->test_func, run_count, results_set,
-                 &error_string)) {
+                 &error_string, warmup_count)) {
       fprintf(log_stream, "Error: %s\n", error_string.c_str());
       fprintf(log_stream, "[  FAILED  ] %s\n", test_name);
       fflush(log_stream);
@@ -394,6 +399,7 @@ void ParseCommandArgs(int argc, char** argv, CommandArgs* dest) {
       {"runs", required_argument, nullptr, 'r'},
       {"quiet", no_argument, nullptr, 'q'},
       {"random-order", no_argument, nullptr, 'n'},
+      {"warmup-runs", required_argument, nullptr, 'w'},
 #if defined(__Fuchsia__)
       {"enable-tracing", no_argument, nullptr, 't'},
       {"startup-delay", required_argument, nullptr, 'd'},
@@ -431,6 +437,17 @@ void ParseCommandArgs(int argc, char** argv, CommandArgs* dest) {
       case 'n':
         dest->random_order = true;
         break;
+      case 'w': {
+        // Convert string to number (uint32_t).  Unlike --runs, zero is allowed.
+        char* end;
+        long val = strtol(optarg, &end, 0);
+        if (val != static_cast<uint32_t>(val) || *end != '\0' || *optarg == '\0') {
+          fprintf(stderr, "Invalid argument for --warmup-runs: \"%s\"\n", optarg);
+          exit(1);
+        }
+        dest->warmup_count = static_cast<uint32_t>(val);
+        break;
+      }
 #if defined(__Fuchsia__)
       case 't':
         dest->enable_tracing = true;
@@ -474,7 +491,7 @@ static bool PerfTestMode(const char* test_suite, int argc, char** argv) {
 
   ResultsSet results;
   bool success = RunTests(test_suite, g_tests, args.run_count, args.filter_regex, stdout, &results,
-                          args.quiet, args.random_order);
+                          args.quiet, args.random_order, args.warmup_count);
 
   if (!args.quiet) {
     printf("\n");
@@ -526,6 +543,11 @@ int PerfTestMain(int argc, char** argv, const char* test_suite) {
         "  --random-order\n"
         "      Run the tests in random order.  The default is to run them "
         "in the order of their names.\n"
+        "  --warmup-runs NUMBER\n"
+        "      Number of extra runs to do at the start of each test "
+        "whose times are discarded, so that one-time costs such as "
+        "cold caches and page faults are not included in the results.  "
+        "The default is 0.\n"
 #if defined(__Fuchsia__)
         "  --enable-tracing\n"
         "      Enable use of Fuchsia tracing: Enable registering as a "
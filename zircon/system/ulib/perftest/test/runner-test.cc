@@ -85,6 +85,34 @@ TEST(PerfTestRunner, TestResults) {
   EXPECT_TRUE(check_times(test_case));
 }
 
+// Test that warm-up runs are done but not included in the results.
+TEST(PerfTestRunner, TestWarmupRuns) {
+  uint32_t runs_done = 0;
+  perftest::internal::TestList test_list;
+  perftest::internal::NamedTest test{"warmup_test", [&](perftest::RepeatState* state) {
+                                       while (state->KeepRunning()) {
+                                         ++runs_done;
+                                       }
+                                       return true;
+                                     }};
+  test_list.push_back(std::move(test));
+
+  const uint32_t kRunCount = 7;
+  const uint32_t kWarmupCount = 3;
+  perftest::ResultsSet results;
+  DummyOutputStream out;
+  EXPECT_TRUE(perftest::internal::RunTests("test-suite", &test_list, kRunCount, "", out.fp(),
+                                           &results, /* quiet= */ false,
+                                           /* random_order= */ false, kWarmupCount));
+  EXPECT_EQ(runs_done, kRunCount + kWarmupCount);
+
+  auto* test_cases = results.results();
+  ASSERT_EQ(test_cases->size(), 1);
+  auto* test_case = &(*test_cases)[0];
+  EXPECT_EQ(test_case->values.size(), kRunCount);
+  EXPECT_TRUE(check_times(test_case));
+}
+
 // Test that if a perf test fails by returning "false", the failure gets
 // propagated correctly.
 TEST(PerfTestRunner, TestFailingTest) {
@@ -329,6 +357,8 @@ TEST(PerfTestRunner, TestParsingCommandArgs) {
     "--filter",
     "some_regex",
     "--quiet",
+    "--warmup-runs",
+    "10",
 #if defined(__Fuchsia__)
     "--enable-tracing",
     "--startup-delay=456"
@@ -340,6 +370,7 @@ TEST(PerfTestRunner, TestParsingCommandArgs) {
   EXPECT_STREQ(args.output_filename, "dest_file");
   EXPECT_STREQ(args.filter_regex, "some_regex");
   EXPECT_TRUE(args.quiet);
+  EXPECT_EQ(args.warmup_count, 10);
 #if defined(__Fuchsia__)
   EXPECT_TRUE(args.enable_tracing);
   EXPECT_EQ(args.startup_delay_seconds, 456);
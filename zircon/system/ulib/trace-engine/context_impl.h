@@ -174,6 +174,12 @@ struct trace_context {
   // We round this up to 1MB.
   static constexpr size_t kMaxDurableBufferSize = 1024 * 1024;
 
+  // The allocation pointers are updated with an atomic add by every thread
+  // that writes a record. Each gets a cache line of its own so that those
+  // writes don't keep evicting the read-mostly buffer geometry, or each
+  // other, from the caches of the writing cores.
+  static constexpr size_t kCacheLineSize = 64;
+
   // Given a buffer of size |SIZE| in bytes, not including the header,
   // return how much to use for the durable buffer. This is further adjusted
   // to be at most |kMaxDurableBufferSize|, and to account for rolling
@@ -282,7 +288,7 @@ struct trace_context {
   // This only used in circular and streaming modes.
   // Starts at |durable_buffer_start| and grows from there.
   // May exceed |durable_buffer_end| when the buffer is full.
-  std::atomic<uint64_t> durable_buffer_current_;
+  alignas(kCacheLineSize) std::atomic<uint64_t> durable_buffer_current_;
 
   // Offset beyond the last successful allocation, or zero if not full.
   // This only used in circular and streaming modes: There is no separate
@@ -306,12 +312,12 @@ struct trace_context {
   //
   // This value is also used for durable records in oneshot mode: in
   // oneshot mode durable and non-durable records share the same buffer.
-  std::atomic<uint64_t> rolling_buffer_current_;
+  alignas(kCacheLineSize) std::atomic<uint64_t> rolling_buffer_current_;
 
   // Offset beyond the last successful allocation, or zero if not full.
   // Only ever set to non-zero once when the buffer fills.
   // This will only be set in oneshot and streaming modes.
-  std::atomic<uint64_t> rolling_buffer_full_mark_[2];
+  alignas(kCacheLineSize) std::atomic<uint64_t> rolling_buffer_full_mark_[2];
 
   // A count of the number of records that have been dropped.
   std::atomic<uint64_t> num_records_dropped_{0};
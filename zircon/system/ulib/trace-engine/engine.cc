@@ -173,7 +173,8 @@ void notify_engine_all_observers_started_if_needed_locked() __TA_REQUIRES(g_engi
 //    they are all reset to zero.
 // 2. When a TRACE_*() macro is called, it calls
 //    trace_acquire_context_for_category_cached().
-// 3. If the DISABLED bit is set, skip, we're done.
+// 3. If the DISABLED bit is set, skip, we're done. The macros check this
+//    inline with |trace_site_is_disabled()| before calling in.
 // 4. Call trace_acquire_context_for_category()
 // 5. If the ENABLED bit is set, return, we're done.
 // 6. Insert the call site to the head of the chain with the
@@ -213,6 +214,8 @@ constexpr trace_site_state_t kSiteStateFlagsMask = 3u;
 // We don't export this value to the API, the API just says these values
 // must be initialized to zero.
 static_assert(kSiteStateUnknown == 0u);
+// This one is exported, for |trace_site_is_disabled()|.
+static_assert(kSiteStateDisabled == TRACE_SITE_STATE_DISABLED);
 
 // For clarity when reading the source.
 using trace_site_flags_t = trace_site_state_t;
@@ -43,6 +43,16 @@ __BEGIN_CDECLS
 #define TRACE_INTERNAL_SCOPE_ARGS_LABEL(scope) TRACE_INTERNAL_SCOPE_ARGS_LABEL_(scope)
 #define TRACE_INTERNAL_SCOPE_ARGS_LABEL_(scope) scope##_args
 
+// Acquires the context for the category of the call site whose state is
+// |TRACE_INTERNAL_SITE_STATE|, storing its string ref in
+// |TRACE_INTERNAL_CATEGORY_REF|. Sites already known to be disabled are
+// skipped inline without calling into the trace engine.
+#define TRACE_INTERNAL_ACQUIRE_CONTEXT_FOR_SITE(category_literal)                           \
+  (likely(trace_site_is_disabled(&TRACE_INTERNAL_SITE_STATE))                               \
+       ? (trace_context_t*)0                                                                \
+       : trace_acquire_context_for_category_cached(                                         \
+             (category_literal), &TRACE_INTERNAL_SITE_STATE, &TRACE_INTERNAL_CATEGORY_REF))
+
 // Scaffolding for category enabled check.
 #ifndef NTRACE
 #define TRACE_INTERNAL_CATEGORY_ENABLED(category_literal)                                \
@@ -50,8 +60,8 @@ __BEGIN_CDECLS
     static trace_site_t TRACE_INTERNAL_SITE_STATE;                                       \
     trace_string_ref_t TRACE_INTERNAL_CATEGORY_REF;                                      \
     bool TRACE_INTERNAL_CATEGORY_ENABLED_STATE = false;                                  \
-    trace_context_t* TRACE_INTERNAL_CONTEXT = trace_acquire_context_for_category_cached( \
-        (category_literal), &TRACE_INTERNAL_SITE_STATE, &TRACE_INTERNAL_CATEGORY_REF);   \
+    trace_context_t* TRACE_INTERNAL_CONTEXT =                                            \
+        TRACE_INTERNAL_ACQUIRE_CONTEXT_FOR_SITE(category_literal);                       \
     if (unlikely(TRACE_INTERNAL_CONTEXT)) {                                              \
       TRACE_INTERNAL_CATEGORY_ENABLED_STATE = true;                                      \
       trace_release_context(TRACE_INTERNAL_CONTEXT);                                     \
@@ -89,8 +99,8 @@ __BEGIN_CDECLS
   do {                                                                                   \
     static trace_site_t TRACE_INTERNAL_SITE_STATE;                                       \
     trace_string_ref_t TRACE_INTERNAL_CATEGORY_REF;                                      \
-    trace_context_t* TRACE_INTERNAL_CONTEXT = trace_acquire_context_for_category_cached( \
-        (category_literal), &TRACE_INTERNAL_SITE_STATE, &TRACE_INTERNAL_CATEGORY_REF);   \
+    trace_context_t* TRACE_INTERNAL_CONTEXT =                                            \
+        TRACE_INTERNAL_ACQUIRE_CONTEXT_FOR_SITE(category_literal);                       \
     if (unlikely(TRACE_INTERNAL_CONTEXT)) {                                              \
       TRACE_INTERNAL_DECLARE_ARGS(TRACE_INTERNAL_CONTEXT, TRACE_INTERNAL_ARGS, args);    \
       stmt;                                                                              \
@@ -158,8 +168,8 @@ __BEGIN_CDECLS
   do {                                                                                           \
     static trace_site_t TRACE_INTERNAL_SITE_STATE;                                               \
     trace_string_ref_t TRACE_INTERNAL_CATEGORY_REF;                                              \
-    trace_context_t* TRACE_INTERNAL_CONTEXT = trace_acquire_context_for_category_cached(         \
-        (category_literal), &TRACE_INTERNAL_SITE_STATE, &TRACE_INTERNAL_CATEGORY_REF);           \
+    trace_context_t* TRACE_INTERNAL_CONTEXT =                                                    \
+        TRACE_INTERNAL_ACQUIRE_CONTEXT_FOR_SITE(category_literal);                               \
     if (unlikely(TRACE_INTERNAL_CONTEXT)) {                                                      \
       TRACE_INTERNAL_INIT_ARGS(args_variable, args);                                             \
       trace_release_context(TRACE_INTERNAL_CONTEXT);                                             \
@@ -254,8 +264,8 @@ __BEGIN_CDECLS
   do {                                                                                            \
     static trace_site_t TRACE_INTERNAL_SITE_STATE;                                                \
     trace_string_ref_t TRACE_INTERNAL_CATEGORY_REF;                                               \
-    trace_context_t* TRACE_INTERNAL_CONTEXT = trace_acquire_context_for_category_cached(          \
-        (category_literal), &TRACE_INTERNAL_SITE_STATE, &TRACE_INTERNAL_CATEGORY_REF);            \
+    trace_context_t* TRACE_INTERNAL_CONTEXT =                                                     \
+        TRACE_INTERNAL_ACQUIRE_CONTEXT_FOR_SITE(category_literal);                                \
     if (unlikely(TRACE_INTERNAL_CONTEXT)) {                                                       \
       trace_internal_write_blob_attachment_record_and_release_context(                            \
           TRACE_INTERNAL_CONTEXT, &TRACE_INTERNAL_CATEGORY_REF, (name_literal), blob, blob_size); \
@@ -218,9 +218,11 @@ TEST(EngineTests, TestFlushCategoryCache) {
   EXPECT_NULL(context);
   EXPECT_EQ(get_site_state(disabled_category_state) & kSiteStateFlagsMask, kSiteStateDisabled);
   EXPECT_TRUE(get_site_state(disabled_category_state) & ~kSiteStateFlagsMask);
+  EXPECT_TRUE(trace_site_is_disabled(&disabled_category_state));
 
   EXPECT_EQ(trace_engine_flush_category_cache(), ZX_OK);
   EXPECT_EQ(get_site_state(disabled_category_state), 0);
+  EXPECT_FALSE(trace_site_is_disabled(&disabled_category_state));
 
   fixture_initialize_and_start_tracing();
 
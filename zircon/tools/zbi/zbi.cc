@@ -477,6 +477,11 @@ class Compressor final {
     Algo algo_ = Default::kAlgo;
     int level_ = Default::DefaultLevel();
 
+    // If nonzero, zstd payloads are written as a sequence of independent
+    // frames that each hold at most this many bytes of uncompressed data.
+    // Each frame can then be decompressed separately, e.g. in parallel.
+    size_t frame_size_ = 0;
+
     static constexpr Config None() { return Config{kNone, 0}; }
 
     operator bool() const { return algo_ != kNone; }
@@ -496,10 +501,11 @@ class Compressor final {
 
     bool Parse(const char* arg) {
       int level;
+      // The frame size is set by a separate switch, so it's left alone here.
       if (!arg) {
-        *this = {};
+        Set<Default>();
       } else if (!strcasecmp(arg, "none")) {
-        *this = None();
+        clear();
       } else if (!strcasecmp(arg, "lz4f.max")) {
         SetMax<Lz4f>();
       } else if (!strcasecmp(arg, "lz4f")) {
@@ -587,8 +593,11 @@ class Compressor final {
 
     ~Lz4f() { Lz4fCall(LZ4F_freeCompressionContext, ctx_); }
 
+    // LZ4F payloads are always written as a single frame, so frame_size is
+    // ignored.
     template <typename T1, typename T2>
-    void Init(T1 get_buffer, T2 put_buffer, int level, size_t uncompressed_size) {
+    void Init(T1 get_buffer, T2 put_buffer, int level, size_t uncompressed_size,
+              size_t frame_size) {
       prefs_.frameInfo.contentSize = uncompressed_size;
 
       prefs_.frameInfo.blockSizeID = LZ4F_max64KB;
@@ -650,7 +659,8 @@ class Compressor final {
     ~Zstd() { ZstdCall("free", ZSTD_freeCCtx, ctx_); }
 
     template <typename T1, typename T2>
-    void Init(T1 get_buffer, T2 put_buffer, int level, size_t uncompressed_size) {
+    void Init(T1 get_buffer, T2 put_buffer, int level, size_t uncompressed_size,
+              size_t frame_size) {
       ctx_ = ZSTD_createCCtx();
       if (!ctx_) {
         fprintf(stderr, "out of memory\n");
@@ -669,23 +679,27 @@ class Compressor final {
         ZstdCall("enableLongDistanceMatching", ZSTD_CCtx_setParameter, ctx_,
                  ZSTD_c_enableLongDistanceMatching, 1);
       }
-      ZstdCall("PledgedSrcSize", ZSTD_CCtx_setPledgedSrcSize, ctx_, uncompressed_size);
+      unstarted_size_ = uncompressed_size;
+      frame_size_ = frame_size == 0 ? uncompressed_size : frame_size;
+      StartFrame();
     }
 
     template <typename T1, typename T2>
     void Update(T1 get_buffer, T2 put_buffer, const iovec& input) {
-      ZSTD_inBuffer in = {input.iov_base, input.iov_len, 0};
-      while (in.pos < in.size) {
-        // In streaming mode, the size of the overhead of headers can result in
-        // the compressed data being larger than ZSTD_compressBound().
-        // Accordingly, we iteratively request new output buffers as they are
-        // filled.
-        auto buffer = get_buffer(ZSTD_compressBound(in.size - in.pos));
-        ZSTD_outBuffer out = {buffer.data.get(), buffer.size, 0};
-        do {
-          ZstdCall("compress", ZSTD_compressStream2, ctx_, &out, &in, ZSTD_e_continue);
-        } while (in.pos < in.size && out.pos < out.size);
-        put_buffer(std::move(buffer), out.pos);
+      auto data = static_cast<const std::byte*>(input.iov_base);
+      size_t size = input.iov_len;
+      while (size > 0) {
+        if (frame_left_ == 0) {
+          // The current frame is full, so finish it and start the next one.
+          Finish(get_buffer, put_buffer);
+          StartFrame();
+          assert(frame_left_ > 0);
+        }
+        const size_t chunk = std::min(size, frame_left_);
+        Compress(get_buffer, put_buffer, data, chunk);
+        frame_left_ -= chunk;
+        data += chunk;
+        size -= chunk;
       }
     }
 
@@ -706,7 +720,37 @@ class Compressor final {
     }
 
    private:
+    // Each frame's header records its own uncompressed size, so that frames
+    // can be decompressed independently.  The compression parameters carry
+    // over from one frame to the next, but the pledged size must be set
+    // afresh for each frame.
+    void StartFrame() {
+      frame_left_ = std::min(unstarted_size_, frame_size_);
+      unstarted_size_ -= frame_left_;
+      ZstdCall("PledgedSrcSize", ZSTD_CCtx_setPledgedSrcSize, ctx_, frame_left_);
+    }
+
+    template <typename T1, typename T2>
+    void Compress(T1 get_buffer, T2 put_buffer, const std::byte* data, size_t size) {
+      ZSTD_inBuffer in = {data, size, 0};
+      while (in.pos < in.size) {
+        // In streaming mode, the size of the overhead of headers can result in
+        // the compressed data being larger than ZSTD_compressBound().
+        // Accordingly, we iteratively request new output buffers as they are
+        // filled.
+        auto buffer = get_buffer(ZSTD_compressBound(in.size - in.pos));
+        ZSTD_outBuffer out = {buffer.data.get(), buffer.size, 0};
+        do {
+          ZstdCall("compress", ZSTD_compressStream2, ctx_, &out, &in, ZSTD_e_continue);
+        } while (in.pos < in.size && out.pos < out.size);
+        put_buffer(std::move(buffer), out.pos);
+      }
+    }
+
     ZSTD_CCtx* ctx_ = nullptr;
+    size_t frame_size_ = 0;      // Maximum uncompressed bytes per frame.
+    size_t frame_left_ = 0;      // Uncompressed bytes left in the current frame.
+    size_t unstarted_size_ = 0;  // Uncompressed bytes not in any frame yet.
   };
 
   using AlgoData = std::variant<Lz4f, Zstd>;
@@ -765,7 +809,10 @@ void Compressor::Init(OutputStream* out, const zbi_header_t& header) {
   header_.length = 0;
 
   std::visit(
-      [&](auto&& v) { v.Init(BufferGetter(), BufferPutter(out), config_.level_, header_.extra); },
+      [&](auto&& v) {
+        v.Init(BufferGetter(), BufferPutter(out), config_.level_, header_.extra,
+               config_.frame_size_);
+      },
       algo_);
 }
 
@@ -2412,12 +2459,14 @@ bool ImportFile(const FileContents* file, const char* filename, ItemList* items,
 enum LongOnlyOpt : int {
   kOptRecompress = 0x100,
   kOptFilesType = 0x101,
+  kOptCompressFrameSize = 0x102,
 };
 
 constexpr const char kOptString[] = "-B:c::C:d:D:e:Fij:xXRhto:p:T:uv";
 constexpr const option kLongOpts[] = {
     {"bootable", required_argument, nullptr, 'B'},
     {"compressed", optional_argument, nullptr, 'c'},
+    {"compress-frame-size", required_argument, nullptr, kOptCompressFrameSize},
     {"directory", required_argument, nullptr, 'C'},
     {"depfile", required_argument, nullptr, 'd'},
     {"entry", required_argument, nullptr, 'e'},
@@ -2513,6 +2562,8 @@ Format control switches (last switch affects all output):\n\
     --bootable=ARCH, -B ARCH       verify result is a bootable image\n\
     --compressed[=HOW], -c [HOW]   compress BOOTFS images (see below)\n\
     --uncompressed, -u             do not compress BOOTFS images\n\
+    --compress-frame-size=SIZE     split zstd payloads into frames of SIZE\n\
+                                   uncompressed bytes (default: 0, one frame)\n\
 \n\
 HOW defaults to `zstd` and can be one of (case-insensitive):\n\
  * `none` (same as `--uncompressed`)\n\
@@ -2523,6 +2574,10 @@ The meaning of LEVEL depends on the algorithm.  The default is chosen for\n\
 good compression ratios with fast compression time.  `max` is for the best\n\
 compression ratios but much slower compression time (e.g. release builds).\n\
 \n\
+With `--compress-frame-size`, each zstd-compressed payload is written as a\n\
+sequence of independent frames so that a boot loader can decompress them\n\
+separately, e.g. in parallel.  Smaller frames compress less well.\n\
+\n\
 If there are no PATTERN arguments and no files named to add to the BOOTFS\n\
 (via manifest file entries, nonempty directories, or `--entry` switches)\n\
 then any ZBI input items of BOOTFS type are passed through as they are,\n\
@@ -2683,6 +2738,16 @@ int main(int argc, char** argv) {
         compressed.clear();
         continue;
 
+      case kOptCompressFrameSize: {
+        char* end;
+        compressed.frame_size_ = strtoul(optarg, &end, 0);
+        if (*optarg == '\0' || *end != '\0') {
+          fprintf(stderr, "invalid --compress-frame-size: %s\n", optarg);
+          exit(1);
+        }
+        continue;
+      }
+
       case kOptRecompress:
         recompress = true;
         continue;